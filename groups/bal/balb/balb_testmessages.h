@@ -31,6 +31,8 @@ BSLS_IDENT_PRAGMA_ONCE
 
 #include <bdlat_enumeratorinfo.h>
 
+#include <bdlat_nameindex.h>
+
 #include <bdlat_selectioninfo.h>
 
 #include <bdlat_typetraits.h>
@@ -311,6 +313,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Choice4& rhs);
 // TRAITS
 
 BDLAT_DECL_CHOICE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(balb::Choice4)
+BDLAT_DECL_NAME_INDEX_TRAITS(balb::Choice4)
 
 namespace balb {
 
@@ -898,6 +901,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const SequenceWithAnonymityChoice
 // TRAITS
 
 BDLAT_DECL_CHOICE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(balb::SequenceWithAnonymityChoice1)
+BDLAT_DECL_NAME_INDEX_TRAITS(balb::SequenceWithAnonymityChoice1)
 
 namespace balb {
 
@@ -1111,6 +1115,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const SimpleRequest& rhs);
 // TRAITS
 
 BDLAT_DECL_SEQUENCE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(balb::SimpleRequest)
+BDLAT_DECL_NAME_INDEX_TRAITS(balb::SimpleRequest)
 
 namespace balb {
 
@@ -1330,6 +1335,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const UnsignedSequence& rhs);
 // TRAITS
 
 BDLAT_DECL_SEQUENCE_WITH_BITWISEMOVEABLE_TRAITS(balb::UnsignedSequence)
+BDLAT_DECL_NAME_INDEX_TRAITS(balb::UnsignedSequence)
 
 namespace balb {
 
@@ -1730,6 +1736,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Choice5& rhs);
 // TRAITS
 
 BDLAT_DECL_CHOICE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(balb::Choice5)
+BDLAT_DECL_NAME_INDEX_TRAITS(balb::Choice5)
 
 namespace balb {
 
@@ -1987,6 +1994,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Sequence3& rhs);
 // TRAITS
 
 BDLAT_DECL_SEQUENCE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(balb::Sequence3)
+BDLAT_DECL_NAME_INDEX_TRAITS(balb::Sequence3)
 
 namespace balb {
 
@@ -2256,6 +2264,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Sequence5& rhs);
 // TRAITS
 
 BDLAT_DECL_SEQUENCE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(balb::Sequence5)
+BDLAT_DECL_NAME_INDEX_TRAITS(balb::Sequence5)
 
 namespace balb {
 
@@ -2612,6 +2621,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Sequence6& rhs);
 // TRAITS
 
 BDLAT_DECL_SEQUENCE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(balb::Sequence6)
+BDLAT_DECL_NAME_INDEX_TRAITS(balb::Sequence6)
 
 namespace balb {
 
@@ -2880,6 +2890,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Choice3& rhs);
 // TRAITS
 
 BDLAT_DECL_CHOICE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(balb::Choice3)
+BDLAT_DECL_NAME_INDEX_TRAITS(balb::Choice3)
 
 namespace balb {
 
@@ -3148,6 +3159,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const SequenceWithAnonymityChoice
 // TRAITS
 
 BDLAT_DECL_CHOICE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(balb::SequenceWithAnonymityChoice)
+BDLAT_DECL_NAME_INDEX_TRAITS(balb::SequenceWithAnonymityChoice)
 
 namespace balb {
 
@@ -3416,6 +3428,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Choice1& rhs);
 // TRAITS
 
 BDLAT_DECL_CHOICE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(balb::Choice1)
+BDLAT_DECL_NAME_INDEX_TRAITS(balb::Choice1)
 
 namespace balb {
 
@@ -3684,6 +3697,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Choice2& rhs);
 // TRAITS
 
 BDLAT_DECL_CHOICE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(balb::Choice2)
+BDLAT_DECL_NAME_INDEX_TRAITS(balb::Choice2)
 
 namespace balb {
 
@@ -4084,6 +4098,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Sequence4& rhs);
 // TRAITS
 
 BDLAT_DECL_SEQUENCE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(balb::Sequence4)
+BDLAT_DECL_NAME_INDEX_TRAITS(balb::Sequence4)
 
 namespace balb {
 
@@ -4331,6 +4346,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Sequence1& rhs);
 // TRAITS
 
 BDLAT_DECL_SEQUENCE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(balb::Sequence1)
+BDLAT_DECL_NAME_INDEX_TRAITS(balb::Sequence1)
 
 namespace balb {
 
@@ -4577,6 +4593,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Sequence2& rhs);
 // TRAITS
 
 BDLAT_DECL_SEQUENCE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(balb::Sequence2)
+BDLAT_DECL_NAME_INDEX_TRAITS(balb::Sequence2)
 
 namespace balb {
 
@@ -4799,6 +4816,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const SequenceWithAnonymityChoice
 // TRAITS
 
 BDLAT_DECL_CHOICE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(balb::SequenceWithAnonymityChoice2)
+BDLAT_DECL_NAME_INDEX_TRAITS(balb::SequenceWithAnonymityChoice2)
 
 namespace balb {
 
@@ -5463,6 +5481,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const FeatureTestMessage& rhs);
 // TRAITS
 
 BDLAT_DECL_CHOICE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(balb::FeatureTestMessage)
+BDLAT_DECL_NAME_INDEX_TRAITS(balb::FeatureTestMessage)
 
 namespace balb {
 
@@ -5689,6 +5708,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Request& rhs);
 // TRAITS
 
 BDLAT_DECL_CHOICE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(balb::Request)
+BDLAT_DECL_NAME_INDEX_TRAITS(balb::Request)
 
 namespace balb {
 
@@ -5915,6 +5935,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Response& rhs);
 // TRAITS
 
 BDLAT_DECL_CHOICE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(balb::Response)
+BDLAT_DECL_NAME_INDEX_TRAITS(balb::Response)
 
 namespace balb {
 
@@ -15,11 +15,12 @@ BSLS_IDENT("$Id: $")
 //@DESCRIPTION: This component provides a class, 'baljsn::Decoder', for
 // decoding value-semantic objects in the JSON format.  In particular, the
 // 'class' contains a parameterized 'decode' function that decodes an object
-// from a specified stream.  There are two overloaded versions of this
+// from a specified input.  There are three overloaded versions of this
 // function:
 //
 //: o one that reads from a 'bsl::streambuf'
 //: o one that reads from a 'bsl::istream'
+//: o one that reads from a contiguous range of characters
 //
 // This component can be used with types that support the 'bdeat' framework
 // (see the 'bdeat' package for details), which is a compile-time interface for
@@ -38,6 +39,18 @@ BSLS_IDENT("$Id: $")
 // Refer to the details of the JSON encoding format supported by this decoder
 // in the package documentation file (doc/baljsn.txt).
 //
+///Decoding Contiguous Input
+///-------------------------
+// When the entire JSON document is already in memory, the 'decode' overload
+// taking a range of characters should be preferred to wrapping the document
+// in a stream.  That overload tokenizes the document in place: it does not
+// copy the input into an intermediate buffer, element names and values are
+// examined where they lie in the input, and string values that contain no
+// escape sequences are assigned to their target objects in a single
+// operation.  The range must remain valid and unmodified for the duration of
+// the call to 'decode', but need not outlive it.  Characters following the
+// decoded document are ignored.
+//
 ///'validateInputIsUtf8' Option
 ///----------------------------
 // The 'baljsn::DecoderOption' parameter of the 'decode' function has a
@@ -139,6 +152,38 @@ BSLS_IDENT("$Id: $")
 //  assert("New York"      == employee.homeAddress().state());
 //  assert(21              == employee.age());
 //..
+//
+///Example 2: Decoding a Message Held in Memory
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive the JSON text of employee records as whole messages
+// in memory buffers, e.g., from a message queue.  Rather than wrapping each
+// buffer in a stream, we can pass the buffer directly to the decoder, which
+// then decodes the message without copying it (see {Decoding Contiguous
+// Input}).
+//
+// First, we obtain a message.  Note that the buffer need not be
+// null-terminated, and that the decoder is reused:
+//..
+//  const char  MESSAGE[] = "{\"name\":\"Alice\",\"homeAddress\":{\"street\":"
+//                          "\"Park Ave\",\"city\":\"New York City\","
+//                          "\"state\":\"New York\"},\"age\":35}";
+//  const char *messageEnd = MESSAGE + sizeof MESSAGE - 1;
+//..
+// Then, we decode the message into a 'test::Employee' object:
+//..
+//  test::Employee alice;
+//
+//  const int rc2 = decoder.decode(MESSAGE, messageEnd, &alice, options);
+//  assert(0 == rc2);
+//..
+// Finally, we verify the decoded object:
+//..
+//  assert("Alice"         == alice.name());
+//  assert("Park Ave"      == alice.homeAddress().street());
+//  assert("New York City" == alice.homeAddress().city());
+//  assert("New York"      == alice.homeAddress().state());
+//  assert(35              == alice.age());
+//..
 
 #include <balscm_version.h>
 
@@ -231,6 +276,15 @@ class Decoder {
         // formatting mode as specified in 'bdlat_FormattingMode'.  Note that
         // 'ANY_CATEGORY' shall be a tag-type defined in 'bdlat_TypeCategory'.
 
+    template <class TYPE>
+    int startDecoding(TYPE *value, const DecoderOptions& options);
+        // Prepare to decode into the specified 'value', of a (template
+        // parameter) 'TYPE', the JSON data at the start of the input of the
+        // tokenizer owned by this object, using the specified 'options': reset
+        // the log, verify that 'TYPE' is a sequence, choice, or array type,
+        // advance the tokenizer to the first token, and reset 'value' to its
+        // default value.  Return 0 on success and a non-zero value otherwise.
+
     bsl::ostream& logTokenizerError(const char *alternateString);
         // Log the latest tokenizer error to 'd_logStream'.  If the tokenizer
         // did not have an error, log the specified 'alternateString'.  Return
@@ -292,6 +346,29 @@ class Decoder {
         // if decoding is successful, will attempt to update the input position
         // of 'stream' to the last unprocessed byte.
 
+    template <class TYPE>
+    int decode(const char            *begin,
+               const char            *end,
+               TYPE                  *value,
+               const DecoderOptions&  options);
+    template <class TYPE>
+    int decode(const char            *begin,
+               const char            *end,
+               TYPE                  *value,
+               const DecoderOptions  *options);
+        // Decode into the specified 'value', of a (template parameter) 'TYPE',
+        // the JSON data in the range starting at the specified 'begin' and
+        // ending immediately before the specified 'end', using the specified
+        // 'options'.  'TYPE' shall be a 'bdeat'-compatible sequence, choice,
+        // or array type, or a 'bdeat'-compatible dynamic type referring to
+        // one of those types.  Specifying a nullptr 'options' is equivalent to
+        // passing a default-constructed DecoderOptions in 'options'.  Return 0
+        // on success, and a non-zero value otherwise.  The behavior is
+        // undefined unless '[begin .. end)' is a valid range, or both 'begin'
+        // and 'end' are 0.  Note that the input is not copied (see {Decoding
+        // Contiguous Input}), and that characters following the decoded JSON
+        // data are ignored.
+
     template <class TYPE>
     int decode(bsl::streambuf *streamBuf, TYPE *value);
         // Decode an object of (template parameter) 'TYPE' from the specified
@@ -889,27 +966,9 @@ int Decoder::decodeImp(TYPE *, ANY_CATEGORY)
     return -1;
 }
 
-// CREATORS
-inline
-Decoder::Decoder(bslma::Allocator *basicAllocator)
-: d_logStream(basicAllocator)
-, d_tokenizer(basicAllocator)
-, d_elementName(basicAllocator)
-, d_currentDepth(0)
-, d_maxDepth(0)
-, d_skipUnknownElements(false)
-{
-}
-
-// MANIPULATORS
 template <class TYPE>
-int Decoder::decode(bsl::streambuf        *streamBuf,
-                    TYPE                  *value,
-                    const DecoderOptions&  options)
+int Decoder::startDecoding(TYPE *value, const DecoderOptions& options)
 {
-    BSLS_ASSERT(streamBuf);
-    BSLS_ASSERT(value);
-
     d_logStream.clear();
     d_logStream.str("");
 
@@ -924,13 +983,10 @@ int Decoder::decode(bsl::streambuf        *streamBuf,
         return -1;                                                    // RETURN
     }
 
-    d_tokenizer.reset(streamBuf);
     d_tokenizer.setAllowStandAloneValues(false);
     d_tokenizer.setAllowHeterogenousArrays(false);
     d_tokenizer.setAllowNonUtf8StringLiterals(!options.validateInputIsUtf8());
 
-    typedef typename bdlat_TypeCategory::Select<TYPE>::Type TypeCategory;
-
     int rc = d_tokenizer.advanceToNextToken();
     if (rc) {
         logTokenizerError("Error") << " advancing to the first token. "
@@ -940,9 +996,43 @@ int Decoder::decode(bsl::streambuf        *streamBuf,
 
     bdlat_ValueTypeFunctions::reset(value);
 
+    d_currentDepth        = 0;
     d_maxDepth            = options.maxDepth();
     d_skipUnknownElements = options.skipUnknownElements();
 
+    return 0;
+}
+
+// CREATORS
+inline
+Decoder::Decoder(bslma::Allocator *basicAllocator)
+: d_logStream(basicAllocator)
+, d_tokenizer(basicAllocator)
+, d_elementName(basicAllocator)
+, d_currentDepth(0)
+, d_maxDepth(0)
+, d_skipUnknownElements(false)
+{
+}
+
+// MANIPULATORS
+template <class TYPE>
+int Decoder::decode(bsl::streambuf        *streamBuf,
+                    TYPE                  *value,
+                    const DecoderOptions&  options)
+{
+    BSLS_ASSERT(streamBuf);
+    BSLS_ASSERT(value);
+
+    d_tokenizer.reset(streamBuf);
+
+    int rc = startDecoding(value, options);
+    if (rc) {
+        return rc;                                                    // RETURN
+    }
+
+    typedef typename bdlat_TypeCategory::Select<TYPE>::Type TypeCategory;
+
     rc = decodeImp(value, 0, TypeCategory());
 
     d_tokenizer.resetStreamBufGetPointer();
@@ -985,6 +1075,38 @@ int Decoder::decode(bsl::istream&          stream,
     return decode(stream, value, options ? *options : localOpts);
 }
 
+template <class TYPE>
+int Decoder::decode(const char            *begin,
+                    const char            *end,
+                    TYPE                  *value,
+                    const DecoderOptions&  options)
+{
+    BSLS_ASSERT(begin || begin == end);
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(value);
+
+    d_tokenizer.reset(begin, end);
+
+    const int rc = startDecoding(value, options);
+    if (rc) {
+        return rc;                                                    // RETURN
+    }
+
+    typedef typename bdlat_TypeCategory::Select<TYPE>::Type TypeCategory;
+
+    return decodeImp(value, 0, TypeCategory());
+}
+
+template <class TYPE>
+int Decoder::decode(const char            *begin,
+                    const char            *end,
+                    TYPE                  *value,
+                    const DecoderOptions  *options)
+{
+    DecoderOptions localOpts;
+    return decode(begin, end, value, options ? *options : localOpts);
+}
+
 template <class TYPE>
 int Decoder::decode(bsl::streambuf *streamBuf, TYPE *value)
 {
@@ -33,6 +33,9 @@
 #include <bslim_printer.h>
 #include <bslmt_threadutil.h>
 
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+
 #include <bsl_string.h>
 #include <bsl_vector.h>
 #include <bsl_sstream.h>
@@ -71,12 +74,15 @@ namespace test = BloombergLP::s_baltst;
 // [ 4] int decode(bsl::istream& stream, TYPE *v, options);
 // [ 4] int decode(bsl::streambuf *streamBuf, TYPE *v, &options);
 // [ 4] int decode(bsl::istream& stream, TYPE *v, &options);
+// [10] int decode(const char *begin, const char *end, TYPE *v, options);
+// [10] int decode(const char *begin, const char *end, TYPE *v, &options);
 //
 // ACCESSORS
 // [ 4] bsl::string loggedMessages() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [11] USAGE EXAMPLE
+// [-1] PERFORMANCE: DECODING FROM A STREAM AND FROM CONTIGUOUS INPUT
 // [ 5] MULTI-THREADING TEST CASE
 // [ 6] DRQS 43702912
 
@@ -124,6 +130,13 @@ void aSsErT(bool condition, const char *message, int line)
 #define T_           BSLMT_TESTUTIL_T_  // Print a tab (w/o newline).
 #define L_           BSLMT_TESTUTIL_L_  // current Line number
 
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
 // ============================================================================
 //                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
 // ----------------------------------------------------------------------------
@@ -36508,7 +36521,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 10: {
+      case 11: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -36613,8 +36626,325 @@ int main(int argc, char *argv[])
     ASSERT("New York City" == employee.homeAddress().city());
     ASSERT("New York"      == employee.homeAddress().state());
     ASSERT(21              == employee.age());
+//..
+//
+///Example 2: Decoding a Message Held in Memory
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive the JSON text of employee records as whole messages
+// in memory buffers, e.g., from a message queue.  Rather than wrapping each
+// buffer in a stream, we can pass the buffer directly to the decoder, which
+// then decodes the message without copying it (see {Decoding Contiguous
+// Input}).
+//
+// First, we obtain a message.  Note that the buffer need not be
+// null-terminated, and that the decoder is reused:
+//..
+    const char  MESSAGE[] = "{\"name\":\"Alice\",\"homeAddress\":{\"street\":"
+                            "\"Park Ave\",\"city\":\"New York City\","
+                            "\"state\":\"New York\"},\"age\":35}";
+    const char *messageEnd = MESSAGE + sizeof MESSAGE - 1;
+//..
+// Then, we decode the message into a 'test::Employee' object:
+//..
+    test::Employee alice;
+
+    const int rc2 = decoder.decode(MESSAGE, messageEnd, &alice, options);
+    ASSERT(0 == rc2);
+//..
+// Finally, we verify the decoded object:
+//..
+    ASSERT("Alice"         == alice.name());
+    ASSERT("Park Ave"      == alice.homeAddress().street());
+    ASSERT("New York City" == alice.homeAddress().city());
+    ASSERT("New York"      == alice.homeAddress().state());
+    ASSERT(35              == alice.age());
 //..
       } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING DECODING FROM CONTIGUOUS INPUT
+        //
+        // Concerns:
+        //: 1 Decoding from a range of characters produces the same object as
+        //:   decoding the same characters from a stream, for both pretty and
+        //:   compact input, with and without UTF-8 validation.
+        //:
+        //: 2 Decoding fails from a range exactly when it fails from a stream.
+        //:
+        //: 3 No character at or beyond 'end' is examined, and characters
+        //:   following the decoded document are ignored.
+        //:
+        //: 4 String values with and without escape sequences are decoded
+        //:   correctly.
+        //:
+        //: 5 Both overloads taking options are supported, and a null options
+        //:   pointer is equivalent to default options.
+        //:
+        //: 6 A decoder can be reused after a failed decode.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Decode each of the JSON messages used in case 2 from an exactly
+        //:   sized buffer, and compare the result to the expected object.
+        //:   (C-1, 3)
+        //:
+        //: 2 Using the table-driven technique, decode a set of valid and
+        //:   invalid documents, some containing escape sequences, from a
+        //:   'bsl::istringstream' and from an exactly sized buffer, and
+        //:   verify that the results are the same.  (C-2..5)
+        //:
+        //: 3 Decode a document truncated before its closing brace, leaving
+        //:   the brace in memory after 'end', and verify that decoding fails.
+        //:   Decode a document followed by arbitrary characters and verify
+        //:   that decoding succeeds.  (C-3)
+        //:
+        //: 4 Fail to decode a document after entering a nested object, then
+        //:   decode a valid document having the maximum permitted depth
+        //:   using the same decoder.  (C-6)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid ranges and a null 'value' (using the
+        //:   'BSLS_ASSERTTEST_*' macros).  (C-7)
+        //
+        // Testing:
+        //   int decode(const char *begin, const char *end, TYPE *v, options);
+        //   int decode(const char *begin, const char *end, TYPE *v, &options);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING DECODING FROM CONTIGUOUS INPUT" << endl
+                          << "======================================" << endl;
+
+        if (verbose) cout << "\nDecoding complex messages." << endl;
+        {
+            bsl::vector<balb::FeatureTestMessage> testObjects;
+            constructFeatureTestMessage(&testObjects);
+
+            for (int ti = 0; ti < 4 * NUM_XML_TEST_MESSAGES; ++ti) {
+                const int          tj      = ti / 4;
+                const bool         UTF8    = ti & 1;
+                const bool         PRETTY  = ti & 2;
+                const int          LINE    =
+                             PRETTY ? JSON_PRETTY_MESSAGES[tj].d_line
+                                    : JSON_COMPACT_MESSAGES[tj].d_line;
+                const char        *TEXT    =
+                             PRETTY ? JSON_PRETTY_MESSAGES[tj].d_input_p
+                                    : JSON_COMPACT_MESSAGES[tj].d_input_p;
+                const balb::FeatureTestMessage& EXP = testObjects[tj];
+
+                if (veryVerbose) {
+                    P_(ti);    P(LINE);
+                }
+
+                // Copy the text to a buffer of exactly the required size, so
+                // that reading past the end is detectable by tools.
+
+                const bsl::vector<char> BUFFER(TEXT,
+                                               TEXT + bsl::strlen(TEXT));
+
+                baljsn::DecoderOptions options;
+                if (UTF8) {
+                    options.setValidateInputIsUtf8(true);
+                }
+
+                Obj                      decoder;
+                balb::FeatureTestMessage value;
+
+                const int rc = decoder.decode(BUFFER.data(),
+                                              BUFFER.data() + BUFFER.size(),
+                                              &value,
+                                              options);
+                ASSERTV(LINE, decoder.loggedMessages(), rc, 0 == rc);
+                ASSERTV(LINE, decoder.loggedMessages(), EXP, value,
+                        EXP == value);
+            }
+        }
+
+        if (verbose) cout << "\nComparing with decoding from a stream."
+                          << endl;
+        {
+            static const struct {
+                int         d_line;     // source line number
+                const char *d_text_p;   // JSON text
+            } DATA[] = {
+                //line  text
+                //----  ----
+                { L_,   "{}"                                           },
+                { L_,   "  {  }  "                                     },
+                { L_,   "{\"name\":\"Bob\"}"                           },
+                { L_,   "{\"name\":\"\"}"                              },
+                { L_,   "{\"name\":\"B\\\"ob\"}"                       },
+                { L_,   "{\"name\":\"\\\\\\\\\"}"                      },
+                { L_,   "{\"name\":\"Bob\\n\"}"                        },
+                { L_,   "{\"name\":\"\\u00e9t\\u00E9 \\/ \\t\"}"       },
+                { L_,   "{\"name\":\"\\ud83d\\ude00 smile\"}"          },
+                { L_,   "{\"name\":\"\xc3\xa9t\xc3\xa9\"}"             },
+                { L_,   "{\"name\":\"Bob\",\"age\":21}"                },
+                { L_,   "{\"age\":-21,\"name\":\"Bob\"}"               },
+                { L_,   "{\"homeAddress\":{\"street\":\"Some Street\","
+                        "\"city\":\"Some \\\"City\\\"\","
+                        "\"state\":\"NY\"}}"                           },
+                { L_,   "{\"name\":\"Bob\",\"unknown\":[1,{\"a\":2}]}" },
+
+                // invalid
+
+                { L_,   ""                                             },
+                { L_,   "   "                                          },
+                { L_,   "{"                                            },
+                { L_,   "{\"name\""                                    },
+                { L_,   "{\"name\":"                                   },
+                { L_,   "{\"name\":\"Bob"                              },
+                { L_,   "{\"name\":\"Bob\\"                            },
+                { L_,   "{\"name\":\"Bob\\\""                          },
+                { L_,   "{\"name\":\"Bob\""                            },
+                { L_,   "{\"name\":\"Bob\",}"                          },
+                { L_,   "{\"name\":\"\\q\"}"                           },
+                { L_,   "{\"name\":\"\\u00\"}"                         },
+                { L_,   "{\"name\":\"\\ud83d\"}"                       },
+                { L_,   "{\"name\":\"\xc3\"}"                          },
+                { L_,   "{\"name\":\"\xff\xfe\"}"                      },
+                { L_,   "{\"age\":\"Bob\"}"                            },
+                { L_,   "{\"age\":1e999999}"                           },
+                { L_,   "[]"                                           },
+                { L_,   "}"                                            },
+                { L_,   "{\"name\":\"Bob\"]"                           },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < 4 * NUM_DATA; ++ti) {
+                const int          tj      = ti / 4;
+                const bool         UTF8    = ti & 1;
+                const bool         POINTER = ti & 2;
+                const int          LINE    = DATA[tj].d_line;
+                const bsl::string  TEXT    = DATA[tj].d_text_p;
+
+                if (veryVerbose) {
+                    P_(LINE);    P_(UTF8);    P_(POINTER);    P(TEXT);
+                }
+
+                baljsn::DecoderOptions options;
+                options.setSkipUnknownElements(true);
+                if (UTF8) {
+                    options.setValidateInputIsUtf8(true);
+                }
+
+                Obj                decoder;
+                test::Employee     expected;
+                bsl::istringstream iss(TEXT);
+
+                const int EXP_RC = decoder.decode(iss, &expected, options);
+
+                const bsl::vector<char> BUFFER(TEXT.begin(), TEXT.end());
+                const char             *BEGIN = BUFFER.empty()
+                                              ? 0
+                                              : BUFFER.data();
+                const char             *END   = BEGIN + BUFFER.size();
+
+                test::Employee value;
+                value.name() = "garbage";
+
+                const int rc = POINTER
+                             ? decoder.decode(BEGIN, END, &value, &options)
+                             : decoder.decode(BEGIN, END, &value, options);
+
+                ASSERTV(LINE, UTF8, EXP_RC, rc, (0 == EXP_RC) == (0 == rc));
+                if (0 == EXP_RC) {
+                    ASSERTV(LINE, UTF8, expected, value, expected == value);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting a null options pointer." << endl;
+        {
+            const bsl::string TEXT = "{\"name\":\"Bob\",\"unknown\":1}";
+
+            Obj            decoder;
+            test::Employee value;
+
+            // Unknown elements are skipped by default.
+
+            ASSERT(0 == decoder.decode(TEXT.data(),
+                                       TEXT.data() + TEXT.length(),
+                                       &value,
+                                       static_cast<baljsn::DecoderOptions *>(
+                                                                         0)));
+            ASSERT("Bob" == value.name());
+        }
+
+        if (verbose) cout << "\nTesting the end of the input." << endl;
+        {
+            const char TEXT[] = "{\"name\":\"Bob\",\"age\":21} trailing";
+            const int  LENGTH = static_cast<int>(sizeof TEXT - 1);
+            const int  CLOSE  = static_cast<int>(bsl::strchr(TEXT, '}')
+                                                                     - TEXT);
+
+            const baljsn::DecoderOptions options;
+
+            for (int len = 0; len <= LENGTH; ++len) {
+                Obj            decoder;
+                test::Employee value;
+
+                const int rc = decoder.decode(TEXT, TEXT + len, &value,
+                                              options);
+                if (len <= CLOSE) {
+                    ASSERTV(len, rc, 0 != rc);
+                }
+                else {
+                    ASSERTV(len, rc, decoder.loggedMessages(), 0 == rc);
+                    ASSERTV(len, value.name(), "Bob" == value.name());
+                    ASSERTV(len, value.age(),  21    == value.age());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nReusing a decoder after an error." << endl;
+        {
+            const char BAD[]  = "{\"homeAddress\":{\"street\":1.5}}";
+            const char GOOD[] = "{\"homeAddress\":{\"street\":\"Main\"}}";
+
+            baljsn::DecoderOptions options;
+            options.setMaxDepth(2);
+
+            Obj            decoder;
+            test::Employee value;
+
+            ASSERT(0 != decoder.decode(BAD, BAD + sizeof BAD - 1, &value,
+                                       options));
+
+            ASSERTV(decoder.loggedMessages(),
+                    0 == decoder.decode(GOOD,
+                                        GOOD + sizeof GOOD - 1,
+                                        &value,
+                                        options));
+            ASSERT("Main" == value.homeAddress().street());
+
+            options.setMaxDepth(1);
+
+            ASSERT(0 != decoder.decode(GOOD, GOOD + sizeof GOOD - 1, &value,
+                                       options));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const char                   TEXT[] = "{}";
+            const baljsn::DecoderOptions options;
+
+            Obj            decoder;
+            test::Employee value;
+
+            ASSERT_PASS(decoder.decode(TEXT, TEXT + 2, &value, options));
+            ASSERT_FAIL(decoder.decode(TEXT + 2, TEXT, &value, options));
+            ASSERT_FAIL(decoder.decode(0, TEXT, &value, options));
+            ASSERT_FAIL(decoder.decode(TEXT,
+                                       TEXT + 2,
+                                       static_cast<test::Employee *>(0),
+                                       options));
+            ASSERT_PASS(decoder.decode(0, 0, &value, options));
+        }
+      } break;
       case 9: {
         // ------------------------------------------------------------------
         // TESTING UTF-8 DETECTION
@@ -39312,6 +39642,84 @@ int main(int argc, char *argv[])
             ASSERT(21            == bob.age());
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: DECODING FROM A STREAM AND FROM CONTIGUOUS INPUT
+        //
+        // Concerns:
+        //: 1 Decoding a document held in memory is faster when the document is
+        //:   supplied as a range of characters than when it is supplied
+        //:   through a 'bsl::streambuf'.
+        //
+        // Plan:
+        //: 1 Repeatedly decode each of the JSON messages used in case 2, in
+        //:   both pretty and compact format, from a
+        //:   'bdlsb::FixedMemInStreamBuf' and from a range of characters, and
+        //:   report the throughput of each in megabytes per second.  An
+        //:   optional argument specifies the number of passes over the
+        //:   messages.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: DECODING FROM A STREAM AND FROM CONTIGUOUS INPUT
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: DECODING FROM A STREAM AND FROM CONTIGUOUS INPUT"
+             << endl
+             << "============================================================="
+             << endl;
+
+        const int NUM_PASSES = argc > 2 ? atoi(argv[2]) : 2000;
+
+        bsl::vector<bsl::string> messages;
+        bsl::size_t              totalLength = 0;
+        for (int ti = 0; ti < NUM_XML_TEST_MESSAGES; ++ti) {
+            messages.push_back(JSON_PRETTY_MESSAGES[ti].d_input_p);
+            messages.push_back(JSON_COMPACT_MESSAGES[ti].d_input_p);
+            totalLength += messages[messages.size() - 2].length()
+                         + messages.back().length();
+        }
+
+        const double MEGABYTES = static_cast<double>(totalLength)
+                               * NUM_PASSES / (1024.0 * 1024.0);
+
+        const baljsn::DecoderOptions options;
+        Obj                          decoder;
+        balb::FeatureTestMessage     value;
+
+        for (int contiguous = 0; contiguous < 2; ++contiguous) {
+            int             numFailures = 0;
+            bsls::Stopwatch timer;
+            timer.start();
+
+            for (int pass = 0; pass < NUM_PASSES; ++pass) {
+                for (bsl::size_t mi = 0; mi < messages.size(); ++mi) {
+                    const bsl::string& MESSAGE = messages[mi];
+
+                    if (contiguous) {
+                        numFailures += 0 != decoder.decode(
+                                             MESSAGE.data(),
+                                             MESSAGE.data() + MESSAGE.length(),
+                                             &value,
+                                             options);
+                    }
+                    else {
+                        bdlsb::FixedMemInStreamBuf isb(MESSAGE.data(),
+                                                       MESSAGE.length());
+                        numFailures += 0 != decoder.decode(&isb,
+                                                           &value,
+                                                           options);
+                    }
+                }
+            }
+
+            timer.stop();
+            ASSERTV(contiguous, numFailures, 0 == numFailures);
+
+            cout << (contiguous ? "contiguous input: " : "streambuf input:  ")
+                 << MEGABYTES / timer.elapsedTime() << " MB/s" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
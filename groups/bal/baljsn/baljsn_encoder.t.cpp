@@ -48,6 +48,8 @@
 
 #include <bslmf_assert.h>
 
+#include <bsls_stopwatch.h>
+
 #include <bsl_climits.h>
 #include <bsl_cstddef.h>
 #include <bsl_cstdlib.h>
@@ -99,6 +101,7 @@ using bsl::endl;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [14] USAGE EXAMPLE
+// [-1] PERFORMANCE: ENCODING NUMERIC ARRAYS
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -3743,6 +3746,81 @@ int main(int argc, char *argv[])
 
         ASSERTV(ss.str(), "{\"simpleValue\":1}" == ss.str());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: ENCODING NUMERIC ARRAYS
+        //
+        // Concerns:
+        //: 1 The time taken to encode documents consisting mostly of numbers
+        //:   is dominated by the formatting of the numbers.
+        //
+        // Plan:
+        //: 1 Create a 'balb::Sequence4' object holding a large array of
+        //:   integers of assorted magnitudes, and another holding a large
+        //:   array of doubles of assorted magnitudes, and repeatedly encode
+        //:   each of them to a 'bdlsb::MemOutStreamBuf', reporting the
+        //:   throughput in megabytes per second and the time taken per
+        //:   number.  An optional argument specifies the number of passes.
+        //:   (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: ENCODING NUMERIC ARRAYS
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: ENCODING NUMERIC ARRAYS" << endl
+             << "====================================" << endl;
+
+        const int NUM_PASSES = argc > 2 ? atoi(argv[2]) : 100;
+        const int NUM_VALUES = 100000;
+
+        balb::Sequence4 integers;
+        balb::Sequence4 doubles;
+
+        unsigned int seed = 12345;
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            seed = seed * 1103515245u + 12345u;
+
+            // Vary the number of digits, and the exponent, with the index.
+
+            const int value = static_cast<int>(seed >> 1) >> (i % 31);
+            integers.element17().push_back(i % 2 ? value : -value);
+            doubles.element15().push_back(
+                        static_cast<double>(seed) * 1e-10 * (i % 2 ? 1 : -1)
+                                                          * (1 << (i % 20)));
+        }
+
+        const baljsn::EncoderOptions options;
+        Obj                          encoder;
+
+        for (int ti = 0; ti < 2; ++ti) {
+            const balb::Sequence4& VALUE = ti ? doubles : integers;
+
+            bdlsb::MemOutStreamBuf osb;
+            int                    numFailures = 0;
+            bsls::Stopwatch        timer;
+            timer.start();
+
+            for (int pass = 0; pass < NUM_PASSES; ++pass) {
+                osb.pubseekpos(0);
+                numFailures += 0 != encoder.encode(&osb, VALUE, options);
+            }
+
+            timer.stop();
+            ASSERTV(ti, numFailures, encoder.loggedMessages(),
+                    0 == numFailures);
+
+            const double SECONDS   = timer.elapsedTime();
+            const double MEGABYTES = static_cast<double>(osb.length())
+                                   * NUM_PASSES / (1024.0 * 1024.0);
+
+            cout << (ti ? "doubles:  " : "integers: ")
+                 << MEGABYTES / SECONDS << " MB/s, "
+                 << SECONDS * 1e9 / (static_cast<double>(NUM_VALUES)
+                                                                  * NUM_PASSES)
+                 << " ns per value" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -151,9 +151,17 @@ int ParserUtil::getString(bsl::string *value, bslstl::StringRef data)
         return -1;                                                    // RETURN
     }
 
-    value->clear();
-
     ++iter;
+
+    // Find the first escape sequence or quote.  A string literal without
+    // escape sequences (the common case) is assigned in one operation.
+
+    const char *run = iter;
+    while (iter < end && '\\' != *iter && '"' != *iter) {
+        ++iter;
+    }
+    value->assign(run, iter);
+
     while (iter < end) {
         if ('\\' == *iter) {
             ++iter;
@@ -284,7 +292,12 @@ int ParserUtil::getString(bsl::string *value, bslstl::StringRef data)
             return 0;                                                 // RETURN
         }
         else {
-            *value += *iter;
+            run = iter;
+            while (iter < end && '\\' != *iter && '"' != *iter) {
+                ++iter;
+            }
+            value->append(run, iter);
+            continue;
         }
         ++iter;
     }
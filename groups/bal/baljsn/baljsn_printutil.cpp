@@ -9,6 +9,8 @@ BSLS_IDENT_RCSID(baljsn_printutil_cpp,"$Id$ $CSID$")
 
 #include <bsls_annotation.h>
 
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
 #include <bsl_sstream.h>
 
 namespace BloombergLP {
@@ -38,6 +40,22 @@ namespace baljsn {
                               // class PrintUtil
                               // ---------------
 
+// PRIVATE CLASS METHODS
+#if defined(BSLS_PLATFORM_CMP_MSVC) && BSLS_PLATFORM_CMP_VERSION < 1900
+char *PrintUtil::padExponent(char *first, char *last)
+{
+    char *exponent = bsl::find(first, last, 'e');
+    if (last - exponent != 4) {  // no exponent, or three digits already
+        return last;                                                  // RETURN
+    }
+    exponent += 2;  // skip 'e' and the sign
+    bsl::memmove(exponent + 1, exponent, 2);
+    *exponent = '0';
+    return last + 1;
+}
+#endif
+
+// CLASS METHODS
 int PrintUtil::printString(bsl::ostream&            stream,
                            const bslstl::StringRef& value)
 {
@@ -21,6 +21,23 @@ BSLS_IDENT("$Id: $")
 // Refer to the details of the JSON encoding format supported by this utility
 // in the package documentation file (doc/baljsn.txt).
 //
+///Numeric Formatting
+///------------------
+// Numbers are formatted by 'bslalg::NumericFormatterUtil' directly into a
+// local buffer that is then written to the stream, without regard to the
+// formatting flags or the locale of the stream.  Integral values are written
+// in decimal.  A 'float' or 'double' value is written as the shortest decimal
+// that reads back as the same value if that decimal has no more significant
+// digits than the 'maxFloatPrecision' or 'maxDoublePrecision' encoder option
+// (which default to 'bsl::numeric_limits<TYPE>::digits10'), and is otherwise
+// rounded to that many digits, in the notation of the "%g" conversion of
+// 'printf' with that precision.  For instance, with the default options,
+// 0.1 is written as "0.1", 1e+20 as "1e+20", and 1.0 / 3 as
+// "0.333333333333333"; a 'maxDoublePrecision' of 17 produces
+// "0.3333333333333333" for the latter, which reads back exactly.  Note that
+// with the default precisions the result is the same as that of "%g" for all
+// but subnormal values (for which it is shorter).
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -90,6 +107,8 @@ BSLS_IDENT("$Id: $")
 #include <bdlt_iso8601util.h>
 #include <bdlt_datetimeinterval.h>
 
+#include <bslalg_numericformatterutil.h>
+
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
@@ -120,6 +139,23 @@ struct PrintUtil {
         // template parameter 'TYPE' using the specified 'options' to decide.
         // The behavior is undefined unless 'TYPE' is 'float' or 'double'.
 
+#if defined(BSLS_PLATFORM_CMP_MSVC) && BSLS_PLATFORM_CMP_VERSION < 1900
+    static char *padExponent(char *first, char *last);
+        // Insert a '0' before the exponent in the number in the specified
+        // range '[ first, last )' if it is written in scientific notation and
+        // its exponent has fewer than three digits, and return the new end of
+        // the number.  The behavior is undefined unless 'last' is writable.
+        // Note that 'snprintf' on these platforms writes at least three
+        // exponent digits, and this component has always written the same.
+#endif
+
+    template <class TYPE>
+    static int printInteger(bsl::ostream& stream, TYPE value);
+        // Encode the specified integral 'value' into JSON and output the
+        // result to the specified 'stream'.  Return 0.  Note that the digits
+        // are written directly, without regard to the formatting flags or
+        // locale of 'stream'.
+
   public:
     // CLASS METHODS
     template <class TYPE>
@@ -245,6 +281,19 @@ int PrintUtil::maxStreamPrecision<double>(
            : bsl::numeric_limits<double>::digits10;
 }
 
+template <class TYPE>
+inline
+int PrintUtil::printInteger(bsl::ostream& stream, TYPE value)
+{
+    char        buffer[21];  // "-9223372036854775808", the longest 'Int64'
+    const char *end = bslalg::NumericFormatterUtil::toChars(
+                                                        buffer,
+                                                        buffer + sizeof buffer,
+                                                        value);
+    stream.write(buffer, end - buffer);
+    return 0;
+}
+
 // CLASS METHODS
 template <class TYPE>
 inline
@@ -302,20 +351,17 @@ int PrintUtil::printFloatingPoint(bsl::ostream&                 stream,
         const int k_SIZE = 32;
         char      buffer[k_SIZE];
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
-
-        const int len = snprintf(buffer,
-                                 k_SIZE,
-                                 "%-1.*g",
-                                 maxStreamPrecision<TYPE>(options),
-                                 value);
+        char *end = bslalg::NumericFormatterUtil::toChars(
+                                            buffer,
+                                            buffer + k_SIZE,
+                                            value,
+                                            maxStreamPrecision<TYPE>(options));
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
+#if defined(BSLS_PLATFORM_CMP_MSVC) && BSLS_PLATFORM_CMP_VERSION < 1900
+        end = padExponent(buffer, end);
 #endif
-        stream.write(buffer, len);
+
+        stream.write(buffer, end - buffer);
       }
     }
     return 0;
@@ -335,8 +381,7 @@ int PrintUtil::printValue(bsl::ostream& stream,
                           short         value,
                           const EncoderOptions *)
 {
-    stream << value;
-    return 0;
+    return printInteger(stream, value);
 }
 
 inline
@@ -344,8 +389,7 @@ int PrintUtil::printValue(bsl::ostream& stream,
                           int           value,
                           const EncoderOptions *)
 {
-    stream << value;
-    return 0;
+    return printInteger(stream, value);
 }
 
 inline
@@ -353,8 +397,7 @@ int PrintUtil::printValue(bsl::ostream&      stream,
                           bsls::Types::Int64 value,
                           const EncoderOptions *)
 {
-    stream << value;
-    return 0;
+    return printInteger(stream, value);
 }
 
 inline
@@ -362,8 +405,7 @@ int PrintUtil::printValue(bsl::ostream& stream,
                           unsigned char value,
                           const EncoderOptions *)
 {
-    stream << static_cast<int>(value);
-    return 0;
+    return printInteger(stream, static_cast<int>(value));
 }
 
 inline
@@ -371,8 +413,7 @@ int PrintUtil::printValue(bsl::ostream&  stream,
                           unsigned short value,
                           const EncoderOptions *)
 {
-    stream << value;
-    return 0;
+    return printInteger(stream, value);
 }
 
 inline
@@ -380,8 +421,7 @@ int PrintUtil::printValue(bsl::ostream& stream,
                           unsigned int  value,
                           const EncoderOptions *)
 {
-    stream << value;
-    return 0;
+    return printInteger(stream, value);
 }
 
 inline
@@ -389,8 +429,7 @@ int PrintUtil::printValue(bsl::ostream&       stream,
                           bsls::Types::Uint64 value,
                           const EncoderOptions *)
 {
-    stream << value;
-    return 0;
+    return printInteger(stream, value);
 }
 
 inline
@@ -424,8 +463,7 @@ int PrintUtil::printValue(bsl::ostream& stream,
 {
     signed char tmp(value);  // Note that 'char' is unsigned on IBM.
 
-    stream << static_cast<int>(tmp);
-    return 0;
+    return printInteger(stream, static_cast<int>(tmp));
 }
 
 inline
@@ -433,8 +471,7 @@ int PrintUtil::printValue(bsl::ostream& stream,
                           signed char   value,
                           const EncoderOptions *)
 {
-    stream << static_cast<int>(value);
-    return 0;
+    return printInteger(stream, static_cast<int>(value));
 }
 
 inline
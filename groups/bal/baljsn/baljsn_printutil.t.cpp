@@ -122,7 +122,7 @@ void aSsErT(bool condition, const char *message, int line)
 
 #if defined(BSLS_PLATFORM_CMP_MSVC) && BSLS_PLATFORM_CMP_VERSION < 1900
     // 'snprintf' on older Windows libraries outputs an additional '0' in the
-    // exponent for scientific notation.
+    // exponent for scientific notation, which 'baljsn::PrintUtil' reproduces.
 # define BALJSN_PRINTUTIL_EXTRA_ZERO_PADDING_FOR_EXPONENTS 1
 #endif
 
@@ -174,6 +174,16 @@ void testNumber()
 
         bsl::string result = oss.str();
         ASSERTV(LINE, result, EXP, result == EXP);
+
+        // The formatting flags of the stream are not used.
+
+        bsl::ostringstream flagged;
+        flagged << bsl::hex << bsl::showpos << bsl::setfill('*')
+                << bsl::setw(30);
+        ASSERTV(LINE, 0 == Obj::printValue(flagged, VALUE));
+
+        result = flagged.str();
+        ASSERTV(LINE, result, EXP, result == EXP);
     }
 }
 
@@ -697,6 +707,13 @@ int main(int argc, char *argv[])
         //: 2 Encoded numbers used default format.
         //:
         //: 3 Encoding 'unsigned char' prints a number instead of string.
+        //:
+        //: 4 Integral numbers are encoded in decimal regardless of the
+        //:   formatting flags of the stream.
+        //:
+        //: 5 Floating point numbers are encoded as the shortest decimal that
+        //:   reads back as the same value if that has no more digits than
+        //:   the precision, and are rounded to the precision otherwise.
         //
         // Plan:
         //: 1 Use the table-driven technique:
@@ -864,26 +881,26 @@ int main(int argc, char *argv[])
                 { L_,        1.0e-1f, 1, "0.1" },
                 { L_,  0.1234567891f, 1, "0.1" },
                 { L_,  0.1234567891f, 4, "0.1235" },
-                { L_,  0.1234567891f, 9, "0.123456791" },
+                { L_,  0.1234567891f, 9, "0.12345679" },
 
 #if defined(BALJSN_PRINTUTIL_EXTRA_ZERO_PADDING_FOR_EXPONENTS)
-                { L_,           10.0, 1, "1e+001" },
-                { L_,         -1.5e1, 1, "-2e+001" },
-                { L_,-1.23456789e-20, 1, "-1e-020" },
-                { L_,-1.23456789e-20, 2, "-1.2e-020" },
-                { L_,-1.23456789e-20, 8, "-1.2345679e-020"  },
-                { L_,-1.23456789e-20, 9, "-1.23456787e-020" },
-                { L_, 1.23456789e-20, 1, "1e-020" },
-                { L_, 1.23456789e-20, 9, "1.23456787e-020" },
+                { L_,           10.0f, 1, "1e+001" },
+                { L_,         -1.5e1f, 1, "-2e+001" },
+                { L_,-1.23456789e-20f, 1, "-1e-020" },
+                { L_,-1.23456789e-20f, 2, "-1.2e-020" },
+                { L_,-1.23456789e-20f, 8, "-1.2345679e-020"  },
+                { L_,-1.23456789e-20f, 9, "-1.2345679e-020" },
+                { L_, 1.23456789e-20f, 1, "1e-020" },
+                { L_, 1.23456789e-20f, 9, "1.2345679e-020" },
 #else
                 { L_,           10.0f, 1, "1e+01" },
                 { L_,         -1.5e1f, 1, "-2e+01" },
                 { L_,-1.23456789e-20f, 1, "-1e-20" },
                 { L_,-1.23456789e-20f, 2, "-1.2e-20" },
                 { L_,-1.23456789e-20f, 8, "-1.2345679e-20"  },
-                { L_,-1.23456789e-20f, 9, "-1.23456787e-20" },
+                { L_,-1.23456789e-20f, 9, "-1.2345679e-20" },
                 { L_, 1.23456789e-20f, 1, "1e-20" },
-                { L_, 1.23456789e-20f, 9, "1.23456787e-20" },
+                { L_, 1.23456789e-20f, 9, "1.2345679e-20" },
 #endif
             };
             const int NUM_DATA = sizeof DATA / sizeof *DATA;
@@ -929,6 +946,13 @@ int main(int argc, char *argv[])
                 { L_,           3.14e300,  "3.14e+300" },
                 { L_,             1.0e-1,  "0.1" },
                 { L_,          2.23e-308,  "2.23e-308" },
+                { L_,  4.9406564584124654e-324,  "5e-324" },
+#if defined(BALJSN_PRINTUTIL_EXTRA_ZERO_PADDING_FOR_EXPONENTS)
+                { L_,               1e16,  "1e+016" },
+#else
+                { L_,               1e16,  "1e+16" },
+#endif
+                { L_,  123456789012345.0,  "123456789012345" },
                 { L_,   0.12345678912345,  "0.12345678912345" },
                 { L_,  0.12345678901234567,  "0.123456789012346" },
                 { L_, 0.123456789012345678,  "0.123456789012346" },
@@ -974,14 +998,14 @@ int main(int argc, char *argv[])
       { L_,                     -1.5,  2, "-1.5" },
       { L_,                 -9.9e100,  2, "-9.9e+100" },
       { L_,                 -9.9e100, 15, "-9.9e+100" },
-      { L_,                 -9.9e100, 17, "-9.9000000000000003e+100" },
+      { L_,                 -9.9e100, 17, "-9.9e+100" },
       { L_,                -3.14e300, 15, "-3.14e+300" },
-      { L_,                -3.14e300, 17, "-3.1400000000000001e+300" },
+      { L_,                -3.14e300, 17, "-3.14e+300" },
       { L_,                 3.14e300,  2, "3.1e+300" },
-      { L_,                 3.14e300, 17, "3.1400000000000001e+300" },
+      { L_,                 3.14e300, 17, "3.14e+300" },
       { L_,                   1.0e-1,  1, "0.1" },
       { L_,                2.23e-308,  2, "2.2e-308" },
-      { L_,                2.23e-308, 17, "2.2300000000000001e-308" },
+      { L_,                2.23e-308, 17, "2.23e-308" },
       { L_,     0.123456789012345678,  1, "0.1" },
       { L_,     0.123456789012345678,  2, "0.12" },
       { L_,     0.123456789012345678, 15, "0.123456789012346" },
@@ -0,0 +1,455 @@
+// baljsn_scanutil.cpp                                                -*-C++-*-
+#include <baljsn_scanutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(baljsn_scanutil_cpp,"$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstdint.h>
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+#include <emmintrin.h>
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_CLANG)                                         \
+  || (defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 40900))
+    // The AVX2 implementation is compiled for the AVX2 instruction set by
+    // means of the 'target' attribute, independently of the options used to
+    // compile the rest of this file, and is called only if the processor
+    // supports the instruction set.
+
+#define BALJSN_SCANUTIL_AVX2 1
+#define BALJSN_SCANUTIL_TARGET_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#endif
+
+// IMPLEMENTATION NOTES
+// --------------------
+// Each vectorized search loads a block of characters, computes a mask having
+// bit 'i' set if character 'i' of the block is of interest, and returns the
+// address of the character corresponding to the lowest set bit, if any.  Once
+// fewer characters than a block remain, the scalar implementation examines
+// them, so that no character beyond the end of the range is read.
+//
+// The whitespace characters other than ' ' are the contiguous range
+// '[ '\t' .. '\r' ]', which is tested with one (wrapping) subtraction and one
+// unsigned comparison.  The structural characters '[' (0x5b) and ']' (0x5d)
+// differ from '{' (0x7b) and '}' (0x7d) only in bit 0x20, so setting that bit
+// allows testing for the four brackets with two comparisons.
+
+namespace BloombergLP {
+namespace {
+
+typedef bsl::uint32_t Mask;
+
+bsls::AtomicOperations::AtomicTypes::Int s_instructionSet = { -1 };
+    // The instruction set used by the searches, or -1 if it has not yet been
+    // selected.
+
+// SCALAR IMPLEMENTATION
+
+inline
+bool isWhitespace(char character)
+    // Return 'true' if the specified 'character' is a JSON whitespace
+    // character, and 'false' otherwise.
+{
+    return ' ' == character
+        || static_cast<unsigned char>(character - '\t') <= '\r' - '\t';
+}
+
+inline
+bool isValueDelimiter(char character)
+    // Return 'true' if the specified 'character' ends an unquoted JSON value,
+    // and 'false' otherwise.
+{
+    switch (character) {
+      case '{':
+      case '}':
+      case '[':
+      case ']':
+      case ':':
+      case ',':
+      case '\0': {
+        return true;                                                  // RETURN
+      }
+      default: {
+        return isWhitespace(character);                               // RETURN
+      }
+    }
+}
+
+const char *findNonWhitespaceScalar(const char *begin, const char *end)
+{
+    while (begin != end && isWhitespace(*begin)) {
+        ++begin;
+    }
+    return begin;
+}
+
+const char *findQuoteOrBackslashScalar(const char *begin, const char *end)
+{
+    while (begin != end && '"' != *begin && '\\' != *begin) {
+        ++begin;
+    }
+    return begin;
+}
+
+const char *findValueDelimiterScalar(const char *begin, const char *end)
+{
+    while (begin != end && !isValueDelimiter(*begin)) {
+        ++begin;
+    }
+    return begin;
+}
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+
+// SSE2 IMPLEMENTATION
+
+inline
+__m128i whitespaceSse2(__m128i block)
+    // Return a vector having 0xff in each byte corresponding to a whitespace
+    // character in the specified 'block', and 0 in the other bytes.
+{
+    const __m128i shifted = _mm_sub_epi8(block, _mm_set1_epi8('\t'));
+
+    return _mm_or_si128(
+                 _mm_cmpeq_epi8(block, _mm_set1_epi8(' ')),
+                 _mm_cmpeq_epi8(
+                       _mm_min_epu8(shifted, _mm_set1_epi8('\r' - '\t')),
+                       shifted));
+}
+
+inline
+__m128i loadSse2(const char *address)
+    // Return the 16 characters at the specified 'address'.
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(address));
+}
+
+inline
+Mask maskSse2(__m128i matches)
+    // Return the mask of the bytes of the specified 'matches' that are 0xff.
+{
+    return static_cast<Mask>(_mm_movemask_epi8(matches));
+}
+
+const char *findNonWhitespaceSse2(const char *begin, const char *end)
+{
+    while (end - begin >= 16) {
+        const Mask mask = maskSse2(whitespaceSse2(loadSse2(begin))) ^ 0xffff;
+        if (mask) {
+            return begin + bdlb::BitUtil::numTrailingUnsetBits(mask); // RETURN
+        }
+        begin += 16;
+    }
+    return findNonWhitespaceScalar(begin, end);
+}
+
+const char *findQuoteOrBackslashSse2(const char *begin, const char *end)
+{
+    const __m128i quote     = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+
+    while (end - begin >= 16) {
+        const __m128i block = loadSse2(begin);
+        const Mask    mask  = maskSse2(
+                                  _mm_or_si128(_mm_cmpeq_epi8(block, quote),
+                                               _mm_cmpeq_epi8(block,
+                                                              backslash)));
+        if (mask) {
+            return begin + bdlb::BitUtil::numTrailingUnsetBits(mask); // RETURN
+        }
+        begin += 16;
+    }
+    return findQuoteOrBackslashScalar(begin, end);
+}
+
+const char *findValueDelimiterSse2(const char *begin, const char *end)
+{
+    const __m128i caseBit  = _mm_set1_epi8(0x20);
+    const __m128i open     = _mm_set1_epi8('{');
+    const __m128i close    = _mm_set1_epi8('}');
+    const __m128i colon    = _mm_set1_epi8(':');
+    const __m128i comma    = _mm_set1_epi8(',');
+    const __m128i zero     = _mm_setzero_si128();
+
+    while (end - begin >= 16) {
+        const __m128i block    = loadSse2(begin);
+        const __m128i folded   = _mm_or_si128(block, caseBit);
+        const __m128i brackets = _mm_or_si128(_mm_cmpeq_epi8(folded, open),
+                                              _mm_cmpeq_epi8(folded, close));
+        const __m128i others   = _mm_or_si128(
+                                        _mm_or_si128(
+                                             _mm_cmpeq_epi8(block, colon),
+                                             _mm_cmpeq_epi8(block, comma)),
+                                        _mm_or_si128(
+                                             _mm_cmpeq_epi8(block, zero),
+                                             whitespaceSse2(block)));
+        const Mask mask = maskSse2(_mm_or_si128(brackets, others));
+        if (mask) {
+            return begin + bdlb::BitUtil::numTrailingUnsetBits(mask); // RETURN
+        }
+        begin += 16;
+    }
+    return findValueDelimiterScalar(begin, end);
+}
+
+#endif  // BSLS_PLATFORM_CPU_SSE2
+
+#if defined(BALJSN_SCANUTIL_AVX2)
+
+// AVX2 IMPLEMENTATION
+
+BALJSN_SCANUTIL_TARGET_AVX2 inline
+__m256i whitespaceAvx2(__m256i block)
+    // Return a vector having 0xff in each byte corresponding to a whitespace
+    // character in the specified 'block', and 0 in the other bytes.
+{
+    const __m256i shifted = _mm256_sub_epi8(block, _mm256_set1_epi8('\t'));
+
+    return _mm256_or_si256(
+              _mm256_cmpeq_epi8(block, _mm256_set1_epi8(' ')),
+              _mm256_cmpeq_epi8(
+                    _mm256_min_epu8(shifted, _mm256_set1_epi8('\r' - '\t')),
+                    shifted));
+}
+
+BALJSN_SCANUTIL_TARGET_AVX2 inline
+__m256i loadAvx2(const char *address)
+    // Return the 32 characters at the specified 'address'.
+{
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(address));
+}
+
+BALJSN_SCANUTIL_TARGET_AVX2 inline
+Mask maskAvx2(__m256i matches)
+    // Return the mask of the bytes of the specified 'matches' that are 0xff.
+{
+    return static_cast<Mask>(_mm256_movemask_epi8(matches));
+}
+
+BALJSN_SCANUTIL_TARGET_AVX2
+const char *findNonWhitespaceAvx2(const char *begin, const char *end)
+{
+    while (end - begin >= 32) {
+        const Mask mask = ~maskAvx2(whitespaceAvx2(loadAvx2(begin)));
+        if (mask) {
+            return begin + bdlb::BitUtil::numTrailingUnsetBits(mask); // RETURN
+        }
+        begin += 32;
+    }
+    return findNonWhitespaceSse2(begin, end);
+}
+
+BALJSN_SCANUTIL_TARGET_AVX2
+const char *findQuoteOrBackslashAvx2(const char *begin, const char *end)
+{
+    const __m256i quote     = _mm256_set1_epi8('"');
+    const __m256i backslash = _mm256_set1_epi8('\\');
+
+    while (end - begin >= 32) {
+        const __m256i block = loadAvx2(begin);
+        const Mask    mask  = maskAvx2(
+                            _mm256_or_si256(_mm256_cmpeq_epi8(block, quote),
+                                            _mm256_cmpeq_epi8(block,
+                                                              backslash)));
+        if (mask) {
+            return begin + bdlb::BitUtil::numTrailingUnsetBits(mask); // RETURN
+        }
+        begin += 32;
+    }
+    return findQuoteOrBackslashSse2(begin, end);
+}
+
+BALJSN_SCANUTIL_TARGET_AVX2
+const char *findValueDelimiterAvx2(const char *begin, const char *end)
+{
+    const __m256i caseBit  = _mm256_set1_epi8(0x20);
+    const __m256i open     = _mm256_set1_epi8('{');
+    const __m256i close    = _mm256_set1_epi8('}');
+    const __m256i colon    = _mm256_set1_epi8(':');
+    const __m256i comma    = _mm256_set1_epi8(',');
+    const __m256i zero     = _mm256_setzero_si256();
+
+    while (end - begin >= 32) {
+        const __m256i block    = loadAvx2(begin);
+        const __m256i folded   = _mm256_or_si256(block, caseBit);
+        const __m256i brackets = _mm256_or_si256(
+                                           _mm256_cmpeq_epi8(folded, open),
+                                           _mm256_cmpeq_epi8(folded, close));
+        const __m256i others   = _mm256_or_si256(
+                                     _mm256_or_si256(
+                                          _mm256_cmpeq_epi8(block, colon),
+                                          _mm256_cmpeq_epi8(block, comma)),
+                                     _mm256_or_si256(
+                                          _mm256_cmpeq_epi8(block, zero),
+                                          whitespaceAvx2(block)));
+        const Mask mask = maskAvx2(_mm256_or_si256(brackets, others));
+        if (mask) {
+            return begin + bdlb::BitUtil::numTrailingUnsetBits(mask); // RETURN
+        }
+        begin += 32;
+    }
+    return findValueDelimiterSse2(begin, end);
+}
+
+#endif  // BALJSN_SCANUTIL_AVX2
+
+int selectedInstructionSet()
+    // Return the instruction set used by the searches, selecting the most
+    // capable one supported if none has been selected yet.
+{
+    int result = bsls::AtomicOperations::getIntRelaxed(&s_instructionSet);
+
+    if (0 > result) {
+        // Concurrent callers may each perform the (idempotent) selection.
+
+        result = baljsn::ScanUtil::isSupported(baljsn::ScanUtil::e_AVX2)
+                 ? baljsn::ScanUtil::e_AVX2
+                 : baljsn::ScanUtil::isSupported(baljsn::ScanUtil::e_SSE2)
+                   ? baljsn::ScanUtil::e_SSE2
+                   : baljsn::ScanUtil::e_SCALAR;
+
+        bsls::AtomicOperations::setIntRelaxed(&s_instructionSet, result);
+    }
+    return result;
+}
+
+}  // close unnamed namespace
+
+namespace baljsn {
+
+                               // ---------------
+                               // struct ScanUtil
+                               // ---------------
+
+// CLASS METHODS
+const char *ScanUtil::findNonWhitespace(const char *begin, const char *end)
+{
+    BSLS_ASSERT_SAFE(begin <= end);
+
+    switch (selectedInstructionSet()) {
+#if defined(BALJSN_SCANUTIL_AVX2)
+      case e_AVX2: {
+        return findNonWhitespaceAvx2(begin, end);                     // RETURN
+      }
+#endif
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+      case e_SSE2: {
+        return findNonWhitespaceSse2(begin, end);                     // RETURN
+      }
+#endif
+      default: {
+        return findNonWhitespaceScalar(begin, end);                   // RETURN
+      }
+    }
+}
+
+const char *ScanUtil::findQuoteOrBackslash(const char *begin,
+                                           const char *end)
+{
+    BSLS_ASSERT_SAFE(begin <= end);
+
+    switch (selectedInstructionSet()) {
+#if defined(BALJSN_SCANUTIL_AVX2)
+      case e_AVX2: {
+        return findQuoteOrBackslashAvx2(begin, end);                  // RETURN
+      }
+#endif
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+      case e_SSE2: {
+        return findQuoteOrBackslashSse2(begin, end);                  // RETURN
+      }
+#endif
+      default: {
+        return findQuoteOrBackslashScalar(begin, end);                // RETURN
+      }
+    }
+}
+
+const char *ScanUtil::findValueDelimiter(const char *begin, const char *end)
+{
+    BSLS_ASSERT_SAFE(begin <= end);
+
+    switch (selectedInstructionSet()) {
+#if defined(BALJSN_SCANUTIL_AVX2)
+      case e_AVX2: {
+        return findValueDelimiterAvx2(begin, end);                    // RETURN
+      }
+#endif
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+      case e_SSE2: {
+        return findValueDelimiterSse2(begin, end);                    // RETURN
+      }
+#endif
+      default: {
+        return findValueDelimiterScalar(begin, end);                  // RETURN
+      }
+    }
+}
+
+ScanUtil::InstructionSet ScanUtil::instructionSet()
+{
+    return static_cast<InstructionSet>(selectedInstructionSet());
+}
+
+bool ScanUtil::isSupported(InstructionSet instructionSet)
+{
+    switch (instructionSet) {
+      case e_SCALAR: {
+        return true;                                                  // RETURN
+      }
+      case e_SSE2: {
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+        return true;                                                  // RETURN
+#else
+        return false;                                                 // RETURN
+#endif
+      }
+      case e_AVX2: {
+#if defined(BALJSN_SCANUTIL_AVX2)
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");                        // RETURN
+#else
+        return false;                                                 // RETURN
+#endif
+      }
+    }
+    return false;
+}
+
+void ScanUtil::setInstructionSet(InstructionSet instructionSet)
+{
+    BSLS_ASSERT(isSupported(instructionSet));
+
+    bsls::AtomicOperations::setIntRelaxed(&s_instructionSet, instructionSet);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#undef BALJSN_SCANUTIL_AVX2
+#undef BALJSN_SCANUTIL_TARGET_AVX2
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
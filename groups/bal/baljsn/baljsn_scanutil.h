@@ -0,0 +1,174 @@
+// baljsn_scanutil.h                                                  -*-C++-*-
+#ifndef INCLUDED_BALJSN_SCANUTIL
+#define INCLUDED_BALJSN_SCANUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide vectorized searches for JSON structural characters.
+//
+//@CLASSES:
+//  baljsn::ScanUtil: utility for finding token boundaries in JSON text
+//
+//@SEE_ALSO: baljsn_tokenizer
+//
+//@DESCRIPTION: This component provides a 'struct', 'baljsn::ScanUtil', that
+// provides the searches that a JSON tokenizer spends most of its time in:
+// skipping whitespace, finding the end of a string literal (or the next escape
+// sequence within it), and finding the end of a number or literal name.  Each
+// search takes a range of characters and returns the address of the first
+// character of interest in that range, or the end of the range if there is
+// none.
+//
+///Instruction Sets
+///----------------
+// The searches examine many characters at a time using the SIMD instructions
+// of the processor.  Three implementations are provided, enumerated by
+// 'ScanUtil::InstructionSet':
+//
+//: 'e_SCALAR': a portable implementation examining one character at a time,
+//:    available on all platforms
+//:
+//: 'e_SSE2': examines 16 characters at a time, available on all x86-64
+//:   processors (and on x86 platforms compiled for SSE2)
+//:
+//: 'e_AVX2': examines 32 characters at a time, available when compiled with
+//:   gcc or clang for x86-64, and used only when the processor supports it
+//
+// The most capable implementation supported by the processor is selected at
+// runtime on the first call to any search, and the selection can be queried
+// with 'instructionSet'.  'setInstructionSet' overrides the selection; it is
+// provided for testing and benchmarking and need not be called otherwise.  All
+// implementations return identical results.
+//
+// Note that every implementation examines only characters within the supplied
+// range; in particular, the vectorized implementations finish with a scalar
+// loop rather than read past the end of the range.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Splitting Simple JSON Values
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we have a buffer holding a JSON array of numbers and string
+// literals, and we want to find where each element begins and ends.
+//
+// First, we define the input:
+//..
+//  const char  *INPUT = "[  12.5, \"say \\\"hi\\\"\",\n    true ]";
+//  const char  *end   = INPUT + bsl::strlen(INPUT);
+//..
+// Then, we skip the opening bracket and the whitespace that follows it, and
+// find the end of the number:
+//..
+//  const char *begin = baljsn::ScanUtil::findNonWhitespace(INPUT + 1, end);
+//  assert('1' == *begin);
+//
+//  const char *next = baljsn::ScanUtil::findValueDelimiter(begin, end);
+//  assert(bsl::string(begin, next) == "12.5");
+//  assert(','                      == *next);
+//..
+// Next, we find the string literal that follows the comma.  An escaped quote
+// does not end the literal, so we skip each backslash together with the
+// character following it:
+//..
+//  begin = baljsn::ScanUtil::findNonWhitespace(next + 1, end);
+//  assert('"' == *begin);
+//
+//  next = baljsn::ScanUtil::findQuoteOrBackslash(begin + 1, end);
+//  while ('\\' == *next) {
+//      next = baljsn::ScanUtil::findQuoteOrBackslash(next + 2, end);
+//  }
+//  assert(bsl::string(begin, next + 1) == "\"say \\\"hi\\\"\"");
+//..
+// Finally, we find the last element, which is followed by whitespace:
+//..
+//  begin = baljsn::ScanUtil::findNonWhitespace(next + 2, end);
+//  next  = baljsn::ScanUtil::findValueDelimiter(begin, end);
+//  assert(bsl::string(begin, next) == "true");
+//  assert(']' == *baljsn::ScanUtil::findNonWhitespace(next, end));
+//..
+
+#include <balscm_version.h>
+
+namespace BloombergLP {
+namespace baljsn {
+
+                               // ===============
+                               // struct ScanUtil
+                               // ===============
+
+struct ScanUtil {
+    // This 'struct' provides a namespace for functions that find the
+    // characters delimiting JSON tokens in a range of characters.
+
+    // TYPES
+    enum InstructionSet {
+        // This 'enum' lists the implementations of the searches.
+
+        e_SCALAR,  // one character at a time
+        e_SSE2,    // 16 characters at a time
+        e_AVX2     // 32 characters at a time
+    };
+
+    // CLASS METHODS
+    static const char *findNonWhitespace(const char *begin, const char *end);
+        // Return the address of the first character in the specified range
+        // '[begin .. end)' that is not a JSON whitespace character, or 'end'
+        // if there is no such character.  For the purpose of this function,
+        // the whitespace characters are those for which 'isspace' returns
+        // 'true' in the "C" locale (' ', '\t', '\n', '\v', '\f', and '\r').
+
+    static const char *findQuoteOrBackslash(const char *begin,
+                                            const char *end);
+        // Return the address of the first '"' or '\\' character in the
+        // specified range '[begin .. end)', or 'end' if there is no such
+        // character.
+
+    static const char *findValueDelimiter(const char *begin, const char *end);
+        // Return the address of the first character in the specified range
+        // '[begin .. end)' that ends an unquoted JSON value (a number or one
+        // of the literal names), or 'end' if there is no such character.  The
+        // characters ending such a value are the whitespace characters (see
+        // 'findNonWhitespace'), the structural characters '{', '}', '[', ']',
+        // ':', and ',', and the null character.
+
+    static InstructionSet instructionSet();
+        // Return the instruction set used by the searches of this utility.
+        // Unless 'setInstructionSet' has been called, this is the most capable
+        // instruction set supported by the processor.
+
+    static bool isSupported(InstructionSet instructionSet);
+        // Return 'true' if the specified 'instructionSet' is supported by this
+        // build of the component and by the processor, and 'false' otherwise.
+        // Note that 'e_SCALAR' is supported everywhere.
+
+    static void setInstructionSet(InstructionSet instructionSet);
+        // Use the specified 'instructionSet' for subsequent searches.  The
+        // behavior is undefined unless 'isSupported(instructionSet)'.  Note
+        // that this function is intended for testing and benchmarking; its
+        // effect on searches concurrently executing in other threads is
+        // unspecified, but each such search returns a correct result.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,596 @@
+// baljsn_scanutil.t.cpp                                              -*-C++-*-
+#include <baljsn_scanutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides three searches, each having a scalar and
+// up to two vectorized implementations, and functions selecting the
+// implementation.  The searches are tested by comparing the result of every
+// supported implementation to that of a simple oracle, for every character
+// value at every position of ranges of every length up to a few vector
+// widths, and at several alignments.  Each range is copied into a buffer
+// allocated to the exact length of the range so that a read past its end is
+// detected by memory-checking tools.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] const char *findNonWhitespace(const char *, const char *);
+// [ 4] const char *findQuoteOrBackslash(const char *, const char *);
+// [ 5] const char *findValueDelimiter(const char *, const char *);
+// [ 2] InstructionSet instructionSet();
+// [ 2] bool isSupported(InstructionSet);
+// [ 2] void setInstructionSet(InstructionSet);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef baljsn::ScanUtil Util;
+
+const Util::InstructionSet INSTRUCTION_SETS[] = {
+    Util::e_SCALAR,
+    Util::e_SSE2,
+    Util::e_AVX2
+};
+const int NUM_INSTRUCTION_SETS = sizeof  INSTRUCTION_SETS
+                               / sizeof *INSTRUCTION_SETS;
+
+const int MAX_LENGTH = 72;  // longest range tested, over two AVX2 blocks
+
+const int OFFSETS[] = { 0, 1, 15, 17, 31 };
+const int NUM_OFFSETS = sizeof OFFSETS / sizeof *OFFSETS;
+    // offsets of the tested ranges from (typically) 16-byte aligned memory
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+typedef const char *(*SearchFunction)(const char *, const char *);
+typedef bool        (*Predicate)(unsigned char);
+
+bool isWhitespace(unsigned char character)
+    // Return 'true' if the specified 'character' is a JSON whitespace
+    // character, and 'false' otherwise.
+{
+    return 0 != character && 0 != bsl::strchr(" \t\n\v\f\r", character);
+}
+
+bool isNotWhitespace(unsigned char character)
+    // Return 'true' if the specified 'character' is not a JSON whitespace
+    // character, and 'false' otherwise.
+{
+    return !isWhitespace(character);
+}
+
+bool isQuoteOrBackslash(unsigned char character)
+    // Return 'true' if the specified 'character' is '"' or '\\', and 'false'
+    // otherwise.
+{
+    return '"' == character || '\\' == character;
+}
+
+bool isValueDelimiter(unsigned char character)
+    // Return 'true' if the specified 'character' ends an unquoted JSON value,
+    // and 'false' otherwise.
+{
+    return 0 == character
+        || isWhitespace(character)
+        || 0 != bsl::strchr("{}[]:,", character);
+}
+
+void testSearch(SearchFunction search,
+                Predicate      isMatch,
+                unsigned char  filler,
+                bool           verbose)
+    // Test the specified 'search' against the specified 'isMatch' oracle for
+    // every supported instruction set, on ranges of every length up to
+    // 'MAX_LENGTH' filled with the specified 'filler' (which must not match)
+    // and having every character value at every position.  Optionally specify
+    // 'verbose' to print the instruction set being tested.
+{
+    ASSERT(!isMatch(filler));
+
+    const Util::InstructionSet saved = Util::instructionSet();
+
+    for (int ti = 0; ti < NUM_INSTRUCTION_SETS; ++ti) {
+        const Util::InstructionSet INSTRUCTION_SET = INSTRUCTION_SETS[ti];
+
+        if (!Util::isSupported(INSTRUCTION_SET)) {
+            continue;
+        }
+        if (verbose) { T_ P(INSTRUCTION_SET) }
+
+        Util::setInstructionSet(INSTRUCTION_SET);
+
+        for (int length = 0; length <= MAX_LENGTH; ++length) {
+            // The range is at the end of an exactly-sized allocation, and at
+            // several alignments modulo the widest vector.
+
+            for (int oi = 0; oi < NUM_OFFSETS; ++oi) {
+                const int offset = OFFSETS[oi];
+
+                bsl::vector<char> buffer(offset + length,
+                                         static_cast<char>(filler));
+                char       *begin = buffer.data() + offset;
+                char       *end   = begin + length;
+
+                ASSERTV(INSTRUCTION_SET, length, offset,
+                        end == search(begin, end));
+
+                for (int pos = 0; pos < length; ++pos) {
+                    for (int c = 0; c < 256; ++c) {
+                        const unsigned char CHAR =
+                                                static_cast<unsigned char>(c);
+
+                        begin[pos] = static_cast<char>(CHAR);
+
+                        const char *EXP = isMatch(CHAR) ? begin + pos : end;
+
+                        ASSERTV(INSTRUCTION_SET, length, offset, pos, c,
+                                EXP == search(begin, end));
+
+                        // A second match later in the range has no effect.
+
+                        if (pos + 1 < length) {
+                            begin[length - 1] = static_cast<char>(CHAR);
+                            ASSERTV(INSTRUCTION_SET, length, offset, pos, c,
+                                    (isMatch(CHAR) ? begin + pos
+                                                   : end) == search(begin,
+                                                                    end));
+                            begin[length - 1] = static_cast<char>(filler);
+                        }
+                    }
+                    begin[pos] = static_cast<char>(filler);
+                }
+            }
+        }
+    }
+
+    Util::setInstructionSet(saved);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test        = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose     = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    (void)veryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Splitting Simple JSON Values
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we have a buffer holding a JSON array of numbers and string
+// literals, and we want to find where each element begins and ends.
+//
+// First, we define the input:
+//..
+    const char  *INPUT = "[  12.5, \"say \\\"hi\\\"\",\n    true ]";
+    const char  *end   = INPUT + bsl::strlen(INPUT);
+//..
+// Then, we skip the opening bracket and the whitespace that follows it, and
+// find the end of the number:
+//..
+    const char *begin = baljsn::ScanUtil::findNonWhitespace(INPUT + 1, end);
+    ASSERT('1' == *begin);
+
+    const char *next = baljsn::ScanUtil::findValueDelimiter(begin, end);
+    ASSERT(bsl::string(begin, next) == "12.5");
+    ASSERT(','                      == *next);
+//..
+// Next, we find the string literal that follows the comma.  An escaped quote
+// does not end the literal, so we skip each backslash together with the
+// character following it:
+//..
+    begin = baljsn::ScanUtil::findNonWhitespace(next + 1, end);
+    ASSERT('"' == *begin);
+
+    next = baljsn::ScanUtil::findQuoteOrBackslash(begin + 1, end);
+    while ('\\' == *next) {
+        next = baljsn::ScanUtil::findQuoteOrBackslash(next + 2, end);
+    }
+    ASSERT(bsl::string(begin, next + 1) == "\"say \\\"hi\\\"\"");
+//..
+// Finally, we find the last element, which is followed by whitespace:
+//..
+    begin = baljsn::ScanUtil::findNonWhitespace(next + 2, end);
+    next  = baljsn::ScanUtil::findValueDelimiter(begin, end);
+    ASSERT(bsl::string(begin, next) == "true");
+    ASSERT(']' == *baljsn::ScanUtil::findNonWhitespace(next, end));
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'findValueDelimiter'
+        //
+        // Concerns:
+        //: 1 The function returns the address of the first whitespace
+        //:   character, structural character, or null character in the range,
+        //:   and the end of the range if there is none.
+        //:
+        //: 2 Characters outside the range are not read.
+        //:
+        //: 3 Every supported instruction set produces the same result.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using 'testSearch', compare the result with that of an oracle
+        //:   for every character value at every position, on ranges of every
+        //:   length and several alignments, for each supported instruction
+        //:   set.
+        //:   (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid ranges (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-4)
+        //
+        // Testing:
+        //   const char *findValueDelimiter(const char *, const char *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'findValueDelimiter'" << endl
+                          << "============================" << endl;
+
+        testSearch(&Util::findValueDelimiter, &isValueDelimiter, '1', verbose);
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const char DATA[] = "12";
+
+            ASSERT_SAFE_PASS(Util::findValueDelimiter(DATA, DATA + 1));
+            ASSERT_SAFE_FAIL(Util::findValueDelimiter(DATA + 1, DATA));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'findQuoteOrBackslash'
+        //
+        // Concerns:
+        //: 1 The function returns the address of the first '"' or '\\' in the
+        //:   range, and the end of the range if there is none.
+        //:
+        //: 2 Characters outside the range are not read.
+        //:
+        //: 3 Every supported instruction set produces the same result.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using 'testSearch', compare the result with that of an oracle
+        //:   for every character value at every position, on ranges of every
+        //:   length and several alignments, for each supported instruction
+        //:   set.
+        //:   (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid ranges (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-4)
+        //
+        // Testing:
+        //   const char *findQuoteOrBackslash(const char *, const char *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'findQuoteOrBackslash'" << endl
+                          << "==============================" << endl;
+
+        testSearch(&Util::findQuoteOrBackslash,
+                   &isQuoteOrBackslash,
+                   'a',
+                   verbose);
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const char DATA[] = "ab";
+
+            ASSERT_SAFE_PASS(Util::findQuoteOrBackslash(DATA, DATA + 1));
+            ASSERT_SAFE_FAIL(Util::findQuoteOrBackslash(DATA + 1, DATA));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'findNonWhitespace'
+        //
+        // Concerns:
+        //: 1 The function returns the address of the first character in the
+        //:   range other than ' ', '\t', '\n', '\v', '\f', and '\r', and the
+        //:   end of the range if there is none.
+        //:
+        //: 2 Characters outside the range are not read.
+        //:
+        //: 3 Every supported instruction set produces the same result.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using 'testSearch', compare the result with that of an oracle
+        //:   for every character value at every position, on ranges of every
+        //:   length and several alignments, for each supported instruction
+        //:   set.  Use
+        //:   each whitespace character as the filler.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid ranges (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-4)
+        //
+        // Testing:
+        //   const char *findNonWhitespace(const char *, const char *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'findNonWhitespace'" << endl
+                          << "===========================" << endl;
+
+        const char *WHITESPACE = " \t\n\v\f\r";
+
+        for (const char *ws = WHITESPACE; *ws; ++ws) {
+            if (verbose) { P(static_cast<int>(*ws)) }
+
+            testSearch(&Util::findNonWhitespace,
+                       &isNotWhitespace,
+                       *ws,
+                       verbose);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const char DATA[] = "  ";
+
+            ASSERT_SAFE_PASS(Util::findNonWhitespace(DATA, DATA + 1));
+            ASSERT_SAFE_FAIL(Util::findNonWhitespace(DATA + 1, DATA));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING INSTRUCTION SET SELECTION
+        //
+        // Concerns:
+        //: 1 The scalar instruction set is always supported, and SSE2 is
+        //:   supported on x86-64 platforms.
+        //:
+        //: 2 By default, the most capable supported instruction set is used.
+        //:
+        //: 3 'setInstructionSet' changes the instruction set that is used.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Verify that 'isSupported' returns 'true' for 'e_SCALAR' and, on
+        //:   x86-64 platforms, for 'e_SSE2'.  (C-1)
+        //:
+        //: 2 Verify that 'instructionSet' initially returns the last
+        //:   supported instruction set in the enumeration.  (C-2)
+        //:
+        //: 3 For each supported instruction set, call 'setInstructionSet' and
+        //:   verify the value returned by 'instructionSet'.  (C-3)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for unsupported instruction sets (using the
+        //:   'BSLS_ASSERTTEST_*' macros).  (C-4)
+        //
+        // Testing:
+        //   InstructionSet instructionSet();
+        //   bool isSupported(InstructionSet);
+        //   void setInstructionSet(InstructionSet);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING INSTRUCTION SET SELECTION" << endl
+                          << "=================================" << endl;
+
+        ASSERT(Util::isSupported(Util::e_SCALAR));
+#if defined(BSLS_PLATFORM_CPU_X86_64)
+        ASSERT(Util::isSupported(Util::e_SSE2));
+#endif
+
+        Util::InstructionSet best = Util::e_SCALAR;
+        for (int ti = 0; ti < NUM_INSTRUCTION_SETS; ++ti) {
+            if (Util::isSupported(INSTRUCTION_SETS[ti])) {
+                best = INSTRUCTION_SETS[ti];
+            }
+        }
+        if (verbose) { P(best) }
+
+        ASSERTV(best, Util::instructionSet(), best == Util::instructionSet());
+
+        for (int ti = 0; ti < NUM_INSTRUCTION_SETS; ++ti) {
+            const Util::InstructionSet INSTRUCTION_SET = INSTRUCTION_SETS[ti];
+
+            if (!Util::isSupported(INSTRUCTION_SET)) {
+                continue;
+            }
+
+            Util::setInstructionSet(INSTRUCTION_SET);
+            ASSERTV(INSTRUCTION_SET,
+                    INSTRUCTION_SET == Util::instructionSet());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Util::setInstructionSet(Util::e_SCALAR));
+
+            for (int ti = 0; ti < NUM_INSTRUCTION_SETS; ++ti) {
+                if (!Util::isSupported(INSTRUCTION_SETS[ti])) {
+                    ASSERT_FAIL(Util::setInstructionSet(INSTRUCTION_SETS[ti]));
+                }
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The searches find the expected characters.
+        //
+        // Plan:
+        //: 1 Apply each search to a short JSON document.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const char *DOC = "  {\"name\":\"a\\\"b\", "
+                          "\"size\": 1234567890123456}";
+        const char *END = DOC + bsl::strlen(DOC);
+
+        const char *p = Util::findNonWhitespace(DOC, END);
+        ASSERT(DOC + 2 == p);
+
+        p = Util::findQuoteOrBackslash(p, END);
+        ASSERT('"' == *p);
+
+        p = Util::findQuoteOrBackslash(p + 1, END);
+        ASSERT(bsl::string(DOC + 4, p) == "name");
+
+        p = Util::findQuoteOrBackslash(p + 3, END);
+        ASSERT('\\' == *p);
+
+        const char *value = bsl::strstr(DOC, "1234");
+        p = Util::findValueDelimiter(value, END);
+        ASSERT(bsl::string(value, p) == "1234567890123456");
+        ASSERT('}' == *p);
+
+        ASSERT(END == Util::findNonWhitespace(END, END));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
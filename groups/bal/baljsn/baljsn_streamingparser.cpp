@@ -0,0 +1,506 @@
+// baljsn_streamingparser.cpp                                         -*-C++-*-
+#include <baljsn_streamingparser.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(baljsn_streamingparser_cpp,"$Id$ $CSID$")
+
+#include <baljsn_scanutil.h>
+
+#include <bsl_algorithm.h>
+
+// IMPLEMENTATION NOTES
+// --------------------
+// 'Tokenizer' reads from a 'bsl::streambuf' and treats the end of the data
+// available from the 'streambuf' as the end of the input; it cannot be resumed
+// once it has found the end of the input within a token.  So, before any
+// characters are passed to the tokenizer, 'scan' locates the complete tokens
+// among them, keeping its state (whether within a string literal, and the
+// kinds of the enclosing objects and arrays) from one chunk to the next.  A
+// token is complete once its last character, or, for a number or literal
+// name, the character following it, has been scanned.  'parseTokens' then
+// points 'd_streamBuf' at the characters up to the end of the last complete
+// token and advances the tokenizer over exactly the tokens found, so that the
+// tokenizer consumes all of those characters but never reads past them.  The
+// remaining characters of the chunk (the start of an incomplete token) are
+// copied to 'd_pending', and are passed to the tokenizer, together with the
+// characters completing the token, once the token is complete.
+//
+// The character following a nested number or literal name is passed to the
+// tokenizer with it, as the tokenizer would otherwise find the end of its
+// input there.  A top-level value ends the input of the tokenizer (which does
+// not accept a second top-level value), so the character following a
+// top-level number or literal name is not passed with it, and the tokenizer is
+// reset after each top-level value.
+//
+// Whitespace between tokens is not needed by the tokenizer, and so is not
+// copied to 'd_pending'.  'scan' fails on a ':' that does not follow a member
+// name, and on a ',' that does not follow a value within an object or array,
+// so at most one separator precedes a token.  This bounds the length of
+// 'd_pending' by that of the longest token, plus that of a chunk, whatever
+// the input.
+
+namespace BloombergLP {
+namespace baljsn {
+
+                         // --------------------------
+                         // class StreamingParserValue
+                         // --------------------------
+
+// CREATORS
+StreamingParserValue::StreamingParserValue(const bslstl::StringRef& text)
+: d_text(text)
+{
+    BSLS_ASSERT(!text.isEmpty());
+
+    if ('"' == text[0]) {
+        d_type = e_STRING;
+    }
+    else if ("true" == text || "false" == text) {
+        d_type = e_BOOLEAN;
+    }
+    else if ("null" == text) {
+        d_type = e_NULL;
+    }
+    else {
+        d_type = e_NUMBER;
+    }
+}
+
+                           // ---------------------
+                           // class StreamingParser
+                           // ---------------------
+
+// PRIVATE MANIPULATORS
+int StreamingParser::fail(const char *message, bsl::size_t numBytesPending)
+{
+    BSLS_ASSERT(numBytesPending <= d_numBytesFed);
+
+    d_logStream << message << " at offset "
+                << d_numBytesFed - numBytesPending << '\n';
+
+    d_failed = true;
+    return -1;
+}
+
+int StreamingParser::parseTokens(const char  *begin,
+                                 const char  *end,
+                                 int          numTokens,
+                                 bool         documentEnd,
+                                 bsl::size_t  numBytesPending)
+{
+    d_streamBuf.pubsetbuf(begin, end - begin);
+
+    for (int i = 0; i < numTokens; ++i) {
+        if (0 != d_tokenizer.advanceToNextToken()) {
+            return fail("Malformed JSON value", numBytesPending);     // RETURN
+        }
+
+        int rc = 0;
+
+        switch (d_tokenizer.tokenType()) {
+          case Tokenizer::e_START_OBJECT: {
+            if (d_startObjectHandler) {
+                rc = d_startObjectHandler();
+            }
+          } break;
+          case Tokenizer::e_END_OBJECT: {
+            if (d_endObjectHandler) {
+                rc = d_endObjectHandler();
+            }
+          } break;
+          case Tokenizer::e_START_ARRAY: {
+            if (d_startArrayHandler) {
+                rc = d_startArrayHandler();
+            }
+          } break;
+          case Tokenizer::e_END_ARRAY: {
+            if (d_endArrayHandler) {
+                rc = d_endArrayHandler();
+            }
+          } break;
+          case Tokenizer::e_ELEMENT_NAME: {
+            if (!d_keyHandler) {
+                break;                                                 // BREAK
+            }
+
+            // 'value' fails, leaving 'name' empty, for an empty name.
+
+            bslstl::StringRef name;
+            d_tokenizer.value(&name);
+
+            if (name.end() != bsl::find(name.begin(), name.end(), '\\')) {
+                // Replace the escape sequences, which 'ParserUtil' does only
+                // for a quoted string.
+
+                bsl::string quoted(d_name.get_allocator());
+                quoted.reserve(name.length() + 2);
+                quoted += '"';
+                quoted.append(name.begin(), name.end());
+                quoted += '"';
+
+                if (0 != ParserUtil::getValue(&d_name, quoted)) {
+                    return fail("Invalid escape sequence in member name",
+                                numBytesPending);                     // RETURN
+                }
+                name = d_name;
+            }
+
+            rc = d_keyHandler(name);
+          } break;
+          case Tokenizer::e_ELEMENT_VALUE: {
+            if (!d_valueHandler) {
+                break;                                                 // BREAK
+            }
+
+            bslstl::StringRef text;
+            d_tokenizer.value(&text);
+
+            rc = d_valueHandler(StreamingParserValue(text));
+          } break;
+          default: {
+            return fail("Unexpected token", numBytesPending);         // RETURN
+          }
+        }
+
+        if (0 != rc) {
+            d_logStream << "Handler returned " << rc << ", ";
+            return fail("parsing stopped", numBytesPending);          // RETURN
+        }
+    }
+
+    if (documentEnd) {
+        d_tokenizer.reset(&d_streamBuf);
+
+        if (d_endDocumentHandler) {
+            const int rc = d_endDocumentHandler();
+            if (0 != rc) {
+                d_logStream << "Handler returned " << rc << ", ";
+                return fail("parsing stopped", numBytesPending);      // RETURN
+            }
+        }
+    }
+
+    return 0;
+}
+
+StreamingParser::ScanResult StreamingParser::scan(const char *begin,
+                                                  const char *end,
+                                                  bool        stopEarly)
+{
+    ScanResult result;
+    result.d_tokensEnd   = begin;
+    result.d_scanEnd     = end;
+    result.d_numTokens   = 0;
+    result.d_documentEnd = false;
+
+    const char *next = begin;
+
+    while (next != end) {
+        if (stopEarly
+         && 0 < result.d_numTokens
+         && next == result.d_tokensEnd) {
+            result.d_scanEnd = next;
+            return result;                                            // RETURN
+        }
+
+        switch (d_scanState) {
+          case e_BETWEEN_TOKENS: {
+            next = ScanUtil::findNonWhitespace(next, end);
+            if (next == end) {
+                break;                                                 // BREAK
+            }
+
+            switch (*next) {
+              case '{':
+              case '[': {
+                if (static_cast<int>(d_nesting.size()) >= d_maxDepth) {
+                    fail("Maximum nesting depth exceeded", end - next);
+                    result.d_scanEnd = next;
+                    return result;                                    // RETURN
+                }
+
+                d_nesting.push_back(*next);
+                d_lastToken = e_OPEN;
+                ++next;
+                ++result.d_numTokens;
+                result.d_tokensEnd = next;
+              } break;
+              case '}':
+              case ']': {
+                const char open = '}' == *next ? '{' : '[';
+                if (d_nesting.empty() || open != d_nesting.back()) {
+                    fail("Mismatched closing bracket", end - next);
+                    result.d_scanEnd = next;
+                    return result;                                    // RETURN
+                }
+
+                d_nesting.pop_back();
+                d_lastToken = e_VALUE;
+                ++next;
+                ++result.d_numTokens;
+                result.d_tokensEnd = next;
+
+                if (d_nesting.empty()) {
+                    d_lastToken          = e_NO_TOKEN;
+                    result.d_documentEnd = true;
+                    result.d_scanEnd     = next;
+                    return result;                                    // RETURN
+                }
+              } break;
+              case '"': {
+                d_scanState = e_IN_STRING;
+                ++next;
+              } break;
+              case ':': {
+                if (e_KEY != d_lastToken) {
+                    fail("Unexpected ':'", end - next);
+                    result.d_scanEnd = next;
+                    return result;                                    // RETURN
+                }
+
+                d_lastToken = e_COLON;
+                ++next;
+              } break;
+              case ',': {
+                if (e_VALUE != d_lastToken) {
+                    fail("Unexpected ','", end - next);
+                    result.d_scanEnd = next;
+                    return result;                                    // RETURN
+                }
+
+                d_lastToken = e_COMMA;
+                ++next;
+              } break;
+              default: {
+                d_scanState = e_IN_UNQUOTED;
+                ++next;
+              } break;
+            }
+          } break;
+          case e_IN_STRING: {
+            next = ScanUtil::findQuoteOrBackslash(next, end);
+            if (next == end) {
+                break;                                                 // BREAK
+            }
+
+            if ('\\' == *next) {
+                d_scanState = e_IN_ESCAPE;
+                ++next;
+                break;                                                 // BREAK
+            }
+
+            // A string following '{', or ',' within an object, is a member
+            // name.
+
+            d_lastToken = !d_nesting.empty()
+                       && '{' == d_nesting.back()
+                       && (e_OPEN == d_lastToken || e_COMMA == d_lastToken)
+                        ? e_KEY
+                        : e_VALUE;
+
+            d_scanState = e_BETWEEN_TOKENS;
+            ++next;
+            ++result.d_numTokens;
+            result.d_tokensEnd = next;
+
+            if (d_nesting.empty()) {
+                d_lastToken          = e_NO_TOKEN;
+                result.d_documentEnd = true;
+                result.d_scanEnd     = next;
+                return result;                                        // RETURN
+            }
+          } break;
+          case e_IN_ESCAPE: {
+            d_scanState = e_IN_STRING;
+            ++next;
+          } break;
+          case e_IN_UNQUOTED: {
+            next = ScanUtil::findValueDelimiter(next, end);
+            if (next == end) {
+                break;                                                 // BREAK
+            }
+
+            // The delimiter is scanned again, as it may be a token itself.
+
+            d_scanState = e_BETWEEN_TOKENS;
+            d_lastToken = e_VALUE;
+            ++result.d_numTokens;
+
+            if (d_nesting.empty()) {
+                d_lastToken          = e_NO_TOKEN;
+                result.d_tokensEnd   = next;
+                result.d_documentEnd = true;
+                result.d_scanEnd     = next;
+                return result;                                        // RETURN
+            }
+
+            result.d_tokensEnd = next + 1;
+          } break;
+        }
+    }
+
+    return result;
+}
+
+// CREATORS
+StreamingParser::StreamingParser(bslma::Allocator *basicAllocator)
+: d_tokenizer(basicAllocator)
+, d_streamBuf(0, 0)
+, d_pending(basicAllocator)
+, d_nesting(basicAllocator)
+, d_name(basicAllocator)
+, d_logStream(basicAllocator)
+, d_numBytesFed(0)
+, d_scanState(e_BETWEEN_TOKENS)
+, d_lastToken(e_NO_TOKEN)
+, d_maxDepth(k_DEFAULT_MAX_DEPTH)
+, d_failed(false)
+, d_startObjectHandler(bsl::allocator_arg, basicAllocator)
+, d_endObjectHandler(bsl::allocator_arg, basicAllocator)
+, d_startArrayHandler(bsl::allocator_arg, basicAllocator)
+, d_endArrayHandler(bsl::allocator_arg, basicAllocator)
+, d_keyHandler(bsl::allocator_arg, basicAllocator)
+, d_valueHandler(bsl::allocator_arg, basicAllocator)
+, d_endDocumentHandler(bsl::allocator_arg, basicAllocator)
+{
+    d_tokenizer.reset(&d_streamBuf);
+}
+
+StreamingParser::~StreamingParser()
+{
+}
+
+// MANIPULATORS
+int StreamingParser::feed(const char *data, bsl::size_t length)
+{
+    BSLS_ASSERT(data || 0 == length);
+
+    if (hasFailed()) {
+        return -1;                                                    // RETURN
+    }
+
+    d_numBytesFed += length;
+
+    const char *next = data;
+    const char *end  = data + length;
+
+    while (next != end) {
+        // If a token is pending, scan only as far as needed to complete it,
+        // so that the characters following it are tokenized in place.
+
+        const bool       hasPending = !d_pending.empty();
+        const ScanResult result     = scan(next, end, hasPending);
+
+        if (hasFailed()) {
+            return -1;                                                // RETURN
+        }
+
+        if (0 < result.d_numTokens) {
+            int rc;
+            if (hasPending) {
+                d_pending.append(next, result.d_tokensEnd);
+                rc = parseTokens(d_pending.data(),
+                                 d_pending.data() + d_pending.length(),
+                                 result.d_numTokens,
+                                 result.d_documentEnd,
+                                 d_pending.length()
+                                               + (end - result.d_tokensEnd));
+                d_pending.clear();
+            }
+            else {
+                rc = parseTokens(next,
+                                 result.d_tokensEnd,
+                                 result.d_numTokens,
+                                 result.d_documentEnd,
+                                 end - next);
+            }
+
+            if (0 != rc) {
+                return rc;                                            // RETURN
+            }
+
+            next = result.d_tokensEnd;
+        }
+
+        if (e_BETWEEN_TOKENS == d_scanState) {
+            // Only whitespace and at most one ':' or ',' (as 'scan' fails on
+            // a second one) remain: keep the latter.
+
+            for (; next != result.d_scanEnd; ++next) {
+                if (':' == *next || ',' == *next) {
+                    d_pending += *next;
+                }
+            }
+        }
+        else {
+            d_pending.append(next, result.d_scanEnd);
+            next = result.d_scanEnd;
+        }
+    }
+
+    return 0;
+}
+
+int StreamingParser::finish()
+{
+    if (hasFailed()) {
+        return -1;                                                    // RETURN
+    }
+
+    int rc = 0;
+
+    if (e_IN_UNQUOTED == d_scanState && d_nesting.empty()) {
+        // The input ends with a top-level number or literal name.
+
+        d_scanState = e_BETWEEN_TOKENS;
+        rc          = parseTokens(d_pending.data(),
+                                  d_pending.data() + d_pending.length(),
+                                  1,
+                                  true,
+                                  d_pending.length());
+    }
+    else if (e_BETWEEN_TOKENS != d_scanState
+          || !d_nesting.empty()
+          || !d_pending.empty()) {
+        rc = fail("Incomplete JSON value at end of input",
+                  d_pending.length());
+    }
+
+    if (0 == rc) {
+        reset();
+    }
+
+    return rc;
+}
+
+void StreamingParser::reset()
+{
+    d_tokenizer.reset(&d_streamBuf);
+    d_streamBuf.pubsetbuf(static_cast<const char *>(0), 0);
+    d_pending.clear();
+    d_nesting.clear();
+    d_logStream.str("");
+    d_numBytesFed = 0;
+    d_scanState   = e_BETWEEN_TOKENS;
+    d_lastToken   = e_NO_TOKEN;
+    d_failed      = false;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,638 @@
+// baljsn_streamingparser.h                                           -*-C++-*-
+#ifndef INCLUDED_BALJSN_STREAMINGPARSER
+#define INCLUDED_BALJSN_STREAMINGPARSER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an incremental, event-based parser for JSON data.
+//
+//@CLASSES:
+//  baljsn::StreamingParser: push parser reporting JSON data as events
+//  baljsn::StreamingParserValue: view of a JSON value reported by the parser
+//
+//@SEE_ALSO: baljsn_tokenizer, baljsn_parserutil, baljsn_decoder
+//
+//@DESCRIPTION: This component provides a mechanism, 'baljsn::StreamingParser',
+// that parses JSON data supplied in chunks of arbitrary size and reports its
+// structure to handlers registered by the client, in the manner of a SAX
+// parser.  Unlike 'baljsn::Decoder' and 'baljsn::DatumUtil', the parser never
+// holds more than a small part of the input, so it can process documents, or
+// sequences of documents, of any size.
+//
+// Clients register a handler (a 'bsl::function') for each of the following
+// events that they are interested in; events for which no handler is
+// registered are ignored:
+//..
+//  Event           Handler Signature                   Reported For
+//  -----           -----------------                   ------------
+//  start object    int ()                              '{'
+//  end object      int ()                              '}'
+//  start array     int ()                              '['
+//  end array       int ()                              ']'
+//  key             int (const bslstl::StringRef&)      a member name
+//  value           int (const StreamingParserValue&)   a string, number,
+//                                                      'true', 'false', or
+//                                                      'null'
+//  end document    int ()                              the end of a top-level
+//                                                      value
+//..
+// A handler returns 0 to continue parsing, and a non-zero value to stop it, in
+// which case the call to 'feed' (or 'finish') that invoked the handler fails.
+//
+// The name passed to a key handler has had its escape sequences replaced by
+// the characters they denote.  A value handler is passed a
+// 'baljsn::StreamingParserValue', which provides the kind of the value and its
+// JSON text, and converts that text to any of the simple types supported by
+// 'baljsn::ParserUtil'.  The string references passed to handlers are valid
+// only for the duration of the call.
+//
+///Input Format
+///------------
+// The input is a sequence of zero or more JSON values (objects, arrays,
+// strings, numbers, or one of the literals 'true', 'false', and 'null'),
+// separated by optional whitespace.  In particular, the parser accepts "JSON
+// Lines" input, in which each line holds one value.  The end document handler
+// is invoked after the last event of each top-level value.
+//
+// A value need not be supplied in a single call to 'feed': the input may be
+// split at any character, including within a string literal, a number, or a
+// multi-byte UTF-8 sequence.  A top-level number or literal is not reported
+// until the character following it has been supplied, or until 'finish' is
+// called, as only then is it known to be complete.
+//
+///Memory Use
+///----------
+// The parser scans each chunk for complete tokens and passes them to a
+// 'baljsn::Tokenizer' without copying them.  Only the characters of a token
+// that is incomplete at the end of a chunk are copied, to be completed by
+// subsequent chunks.  Hence, the memory used by the parser is proportional to
+// the length of the longest token (in practice, the longest string literal)
+// and to the maximum nesting depth, and not to the size of the input.  The
+// nesting depth is limited by the 'maxDepth' attribute of the parser (32 by
+// default); input nested more deeply is rejected.
+//
+///Error Handling
+///--------------
+// The parser detects malformed JSON, including mismatched brackets and braces,
+// as soon as the malformed token is complete, and a ':' or ',' that does not
+// follow a member name or, respectively, a value within an object or array, as
+// soon as it is supplied.  Once 'feed' or 'finish' has
+// failed, either due to malformed input or to a handler returning a non-zero
+// value, subsequent calls to 'feed' and 'finish' fail until 'reset' is called.
+// A description of the error is available from 'loggedMessages'.  Note that
+// the conversion of a value by 'baljsn::StreamingParserValue::getValue' is
+// the means by which the text of numbers is validated.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Summing a Field of a JSON Lines File
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive a stream of trades in JSON Lines format, in blocks
+// whose boundaries bear no relation to the structure of the data, and that we
+// want to compute the total quantity traded without first assembling each
+// record.
+//
+// First, we define a class to hold the state of the computation, with a
+// method for each of the events we are interested in:
+//..
+//  class TradeTotaler {
+//      // This class accumulates the "qty" members of a sequence of objects.
+//
+//      // DATA
+//      int                 d_depth;       // current nesting depth
+//      bool                d_isQuantity;  // 'true' if the next value is
+//                                         // that of a top-level "qty"
+//      bsls::Types::Int64  d_total;       // total quantity
+//      int                 d_numTrades;   // number of records seen
+//
+//    public:
+//      // CREATORS
+//      TradeTotaler()
+//      : d_depth(0)
+//      , d_isQuantity(false)
+//      , d_total(0)
+//      , d_numTrades(0)
+//      {
+//      }
+//
+//      // MANIPULATORS
+//      int startObject()
+//      {
+//          ++d_depth;
+//          return 0;
+//      }
+//
+//      int endObject()
+//      {
+//          if (0 == --d_depth) {
+//              ++d_numTrades;
+//          }
+//          return 0;
+//      }
+//
+//      int key(const bslstl::StringRef& name)
+//      {
+//          d_isQuantity = 1 == d_depth && "qty" == name;
+//          return 0;
+//      }
+//
+//      int value(const baljsn::StreamingParserValue& value)
+//      {
+//          if (!d_isQuantity) {
+//              return 0;                                             // RETURN
+//          }
+//
+//          int quantity;
+//          if (0 != value.getValue(&quantity)) {
+//              return -1;                                            // RETURN
+//          }
+//          d_total += quantity;
+//          return 0;
+//      }
+//
+//      // ACCESSORS
+//      int numTrades() const { return d_numTrades; }
+//
+//      bsls::Types::Int64 total() const { return d_total; }
+//  };
+//..
+// Then, we create a parser and register the handlers of a 'TradeTotaler':
+//..
+//  TradeTotaler totaler;
+//
+//  baljsn::StreamingParser parser;
+//  parser.setStartObjectHandler(
+//                      bdlf::BindUtil::bind(&TradeTotaler::startObject,
+//                                           &totaler));
+//  parser.setEndObjectHandler(
+//                      bdlf::BindUtil::bind(&TradeTotaler::endObject,
+//                                           &totaler));
+//  parser.setKeyHandler(bdlf::BindUtil::bind(&TradeTotaler::key,
+//                                            &totaler,
+//                                            bdlf::PlaceHolders::_1));
+//  parser.setValueHandler(bdlf::BindUtil::bind(&TradeTotaler::value,
+//                                              &totaler,
+//                                              bdlf::PlaceHolders::_1));
+//..
+// Next, we define the input, which we will supply in blocks of 7 characters,
+// splitting names, numbers, and records alike:
+//..
+//  const char *INPUT =
+//      "{\"sym\":\"IBM\",\"qty\":100,\"px\":143.5}\n"
+//      "{\"sym\":\"AAPL\",\"qty\":2500,\"tags\":[\"odd\",\"lot\"]}\n"
+//      "{\"sym\":\"MSFT\",\"qty\":-300,\"px\":{\"bid\":411.1}}\n";
+//
+//  const bsl::size_t LENGTH = bsl::strlen(INPUT);
+//..
+// Now, we feed the blocks to the parser, and tell it when the input ends:
+//..
+//  for (bsl::size_t offset = 0; offset < LENGTH; offset += 7) {
+//      const bsl::size_t size = bsl::min<bsl::size_t>(7, LENGTH - offset);
+//
+//      int rc = parser.feed(INPUT + offset, size);
+//      assert(0 == rc);
+//  }
+//
+//  int rc = parser.finish();
+//  assert(0 == rc);
+//..
+// Finally, we verify the result:
+//..
+//  assert(3    == totaler.numTrades());
+//  assert(2300 == totaler.total());
+//..
+
+#include <balscm_version.h>
+
+#include <baljsn_parserutil.h>
+#include <baljsn_tokenizer.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
+
+#include <bslma_allocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace baljsn {
+
+                         // ==========================
+                         // class StreamingParserValue
+                         // ==========================
+
+class StreamingParserValue {
+    // This class provides a view of a JSON value (a string, number, or one of
+    // the literals 'true', 'false', and 'null') reported by a
+    // 'StreamingParser'.  The view refers to the JSON text of the value, and
+    // is valid only for as long as that text is.
+
+  public:
+    // TYPES
+    enum Type {
+        // This 'enum' lists the kinds of JSON value.
+
+        e_STRING,   // string literal, including its quotes
+        e_NUMBER,   // any unquoted text other than the literal names
+        e_BOOLEAN,  // 'true' or 'false'
+        e_NULL      // 'null'
+    };
+
+  private:
+    // DATA
+    bslstl::StringRef d_text;  // JSON text of the value
+    Type              d_type;  // kind of the value
+
+  public:
+    // CREATORS
+    explicit StreamingParserValue(const bslstl::StringRef& text);
+        // Create a view of the JSON value having the specified 'text'.  The
+        // behavior is undefined unless 'text' is non-empty.
+
+    // ACCESSORS
+    template <class TYPE>
+    int getValue(TYPE *result) const;
+        // Load into the specified 'result' the value represented by the JSON
+        // text of this value, as converted by 'ParserUtil::getValue'.  Return
+        // 0 on success, and a non-zero value, with no effect on 'result',
+        // otherwise.  Note that 'TYPE' is any of the simple types supported by
+        // 'ParserUtil::getValue', and that string values are converted with
+        // their escape sequences replaced.
+
+    bool isNull() const;
+        // Return 'true' if this value is 'null', and 'false' otherwise.
+
+    const bslstl::StringRef& text() const;
+        // Return a reference providing non-modifiable access to the JSON text
+        // of this value, which, for a string, includes the enclosing quotes
+        // and any escape sequences.
+
+    Type type() const;
+        // Return the kind of this value.  Note that the kind is determined by
+        // the first character of the text of the value, and the text is not
+        // otherwise validated.
+};
+
+                           // =====================
+                           // class StreamingParser
+                           // =====================
+
+class StreamingParser {
+    // This class provides a mechanism for parsing JSON data supplied in chunks
+    // of arbitrary size, reporting its structure to handlers registered by the
+    // client.  See the component-level documentation for details.
+
+  public:
+    // TYPES
+    typedef bsl::function<int()>                           EventHandler;
+        // Handler of an event carrying no data: the start or end of an object
+        // or array, or the end of a document.
+
+    typedef bsl::function<int(const bslstl::StringRef&)>   KeyHandler;
+        // Handler of a member name.
+
+    typedef bsl::function<int(const StreamingParserValue&)> ValueHandler;
+        // Handler of a value other than an object or array.
+
+    enum { k_DEFAULT_MAX_DEPTH = 32 };
+
+  private:
+    // TYPES
+    enum ScanState {
+        // This 'enum' lists the states of the scan for complete tokens.
+
+        e_BETWEEN_TOKENS,  // at whitespace, ':', or ',', or a token start
+        e_IN_STRING,       // within a string literal
+        e_IN_ESCAPE,       // after a '\\' within a string literal
+        e_IN_UNQUOTED      // within a number or literal name
+    };
+
+    enum LastToken {
+        // This 'enum' lists the kinds of the last token scanned within the
+        // current top-level value, which determine whether a ':' or ',' may
+        // follow it.
+
+        e_NO_TOKEN,  // no token scanned
+        e_OPEN,      // '{' or '['
+        e_KEY,       // a member name
+        e_VALUE,     // a nested value, or a closing bracket
+        e_COLON,     // ':'
+        e_COMMA      // ','
+    };
+
+    struct ScanResult {
+        // This 'struct' describes the complete tokens found by a scan.
+
+        const char *d_tokensEnd;    // end of the last complete token
+        const char *d_scanEnd;      // end of the characters scanned
+        int         d_numTokens;    // number of complete tokens
+        bool        d_documentEnd;  // 'true' if the last token ends a
+                                    // top-level value
+    };
+
+    // DATA
+    Tokenizer                d_tokenizer;      // tokenizes complete tokens
+
+    bdlsb::FixedMemInStreamBuf
+                             d_streamBuf;      // supplies complete tokens to
+                                               // 'd_tokenizer'
+
+    bsl::string              d_pending;        // incomplete token, and the
+                                               // separator (if any)
+                                               // preceding it
+
+    bsl::vector<char>        d_nesting;        // '{' or '[' for each
+                                               // enclosing object or array
+
+    bsl::string              d_name;           // decoded member name
+
+    bsl::ostringstream       d_logStream;      // stream to record errors
+
+    bsls::Types::Uint64      d_numBytesFed;    // characters supplied so far
+
+    ScanState                d_scanState;      // state of the scan
+
+    LastToken                d_lastToken;      // kind of the last token
+                                               // scanned
+
+    int                      d_maxDepth;       // maximum nesting depth
+
+    bool                     d_failed;         // 'true' after an error
+
+    EventHandler             d_startObjectHandler;
+    EventHandler             d_endObjectHandler;
+    EventHandler             d_startArrayHandler;
+    EventHandler             d_endArrayHandler;
+    KeyHandler               d_keyHandler;
+    ValueHandler             d_valueHandler;
+    EventHandler             d_endDocumentHandler;
+                                               // handlers (empty if not
+                                               // registered)
+
+    // PRIVATE MANIPULATORS
+    int fail(const char *message, bsl::size_t numBytesPending);
+        // Log the specified 'message', together with the offset in the input
+        // of the first of the specified 'numBytesPending' characters that have
+        // been supplied but not yet parsed, put this parser in the failed
+        // state, and return a non-zero value.
+
+    int parseTokens(const char  *begin,
+                    const char  *end,
+                    int          numTokens,
+                    bool         documentEnd,
+                    bsl::size_t  numBytesPending);
+        // Tokenize the specified 'numTokens' complete tokens that end at the
+        // specified 'end' and are preceded only by whitespace, ':', and ','
+        // from the specified 'begin', and invoke the handlers of the
+        // corresponding events.  If the specified 'documentEnd' is 'true',
+        // the last token ends a top-level value: invoke the end document
+        // handler and prepare to parse a new value.  Use the specified
+        // 'numBytesPending', the number of characters from 'begin' to the end
+        // of the input supplied so far, to report errors.  Return 0 on
+        // success, and a non-zero value otherwise.
+
+    ScanResult scan(const char *begin, const char *end, bool stopEarly);
+        // Scan the characters in the specified range '[begin .. end)' for
+        // complete tokens, continuing from the state left by the previous
+        // scan, and return a description of the tokens found.  The scan stops
+        // at 'end', after a token that ends a top-level value, at the first
+        // malformed nesting or unexpected ':' or ',' (in which case this
+        // parser is put in the failed state), or, if the specified
+        // 'stopEarly' is 'true', after the first complete token that is not
+        // followed by characters of an incomplete token.
+
+    // PRIVATE ACCESSORS
+    bool hasFailed() const;
+        // Return 'true' if this parser is in the failed state, and 'false'
+        // otherwise.
+
+  private:
+    // NOT IMPLEMENTED
+    StreamingParser(const StreamingParser&);
+    StreamingParser& operator=(const StreamingParser&);
+
+  public:
+    // CREATORS
+    explicit StreamingParser(bslma::Allocator *basicAllocator = 0);
+        // Create a parser having no registered handlers and a 'maxDepth' of
+        // 'k_DEFAULT_MAX_DEPTH', ready to parse the start of a JSON input.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    ~StreamingParser();
+        // Destroy this object.
+
+    // MANIPULATORS
+    int feed(const char *data, bsl::size_t length);
+        // Parse the specified 'length' characters at the specified 'data',
+        // which continue the input supplied since construction or the last
+        // call to 'reset' or 'finish', invoking the registered handlers for
+        // each event completed by these characters.  Return 0 on success, and
+        // a non-zero value if the input is malformed, if a handler returns a
+        // non-zero value, or if this parser has failed previously.  The
+        // characters need not be valid after this call returns.
+
+    int finish();
+        // Complete the parsing of the input supplied since construction or the
+        // last call to 'reset' or 'finish', invoking the registered handlers
+        // for a top-level number or literal at the end of the input, and
+        // prepare to parse a new input.  Return 0 on success, and a non-zero
+        // value if the input ends within a value, if a handler returns a
+        // non-zero value, or if this parser has failed previously.
+
+    void reset();
+        // Discard any input supplied since construction or the last call to
+        // 'reset' or 'finish', clear the failed state and the logged messages
+        // of this parser, and prepare to parse a new input.  Note that the
+        // registered handlers and the 'maxDepth' attribute are not changed.
+
+    void setEndArrayHandler(const EventHandler& handler);
+        // Set the handler of the ends of arrays to the specified 'handler'.
+
+    void setEndDocumentHandler(const EventHandler& handler);
+        // Set the handler of the ends of top-level values to the specified
+        // 'handler'.
+
+    void setEndObjectHandler(const EventHandler& handler);
+        // Set the handler of the ends of objects to the specified 'handler'.
+
+    void setKeyHandler(const KeyHandler& handler);
+        // Set the handler of member names to the specified 'handler'.
+
+    void setMaxDepth(int value);
+        // Set the maximum nesting depth of objects and arrays accepted by this
+        // parser to the specified 'value'.  The behavior is undefined unless
+        // '0 < value'.
+
+    void setStartArrayHandler(const EventHandler& handler);
+        // Set the handler of the starts of arrays to the specified 'handler'.
+
+    void setStartObjectHandler(const EventHandler& handler);
+        // Set the handler of the starts of objects to the specified 'handler'.
+
+    void setValueHandler(const ValueHandler& handler);
+        // Set the handler of values other than objects and arrays to the
+        // specified 'handler'.
+
+    // ACCESSORS
+    bsl::string loggedMessages() const;
+        // Return a string describing the error that caused this parser to
+        // fail, or an empty string if it has not failed since construction or
+        // the last call to 'reset'.
+
+    int maxDepth() const;
+        // Return the maximum nesting depth of objects and arrays accepted by
+        // this parser.
+
+    bsls::Types::Uint64 numBytesFed() const;
+        // Return the number of characters supplied to 'feed' since
+        // construction or the last call to 'reset' or 'finish'.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                         // --------------------------
+                         // class StreamingParserValue
+                         // --------------------------
+
+// ACCESSORS
+template <class TYPE>
+inline
+int StreamingParserValue::getValue(TYPE *result) const
+{
+    BSLS_ASSERT(result);
+
+    return ParserUtil::getValue(result, d_text);
+}
+
+inline
+bool StreamingParserValue::isNull() const
+{
+    return e_NULL == d_type;
+}
+
+inline
+const bslstl::StringRef& StreamingParserValue::text() const
+{
+    return d_text;
+}
+
+inline
+StreamingParserValue::Type StreamingParserValue::type() const
+{
+    return d_type;
+}
+
+                           // ---------------------
+                           // class StreamingParser
+                           // ---------------------
+
+// PRIVATE ACCESSORS
+inline
+bool StreamingParser::hasFailed() const
+{
+    return d_failed;
+}
+
+// MANIPULATORS
+inline
+void StreamingParser::setEndArrayHandler(const EventHandler& handler)
+{
+    d_endArrayHandler = handler;
+}
+
+inline
+void StreamingParser::setEndDocumentHandler(const EventHandler& handler)
+{
+    d_endDocumentHandler = handler;
+}
+
+inline
+void StreamingParser::setEndObjectHandler(const EventHandler& handler)
+{
+    d_endObjectHandler = handler;
+}
+
+inline
+void StreamingParser::setKeyHandler(const KeyHandler& handler)
+{
+    d_keyHandler = handler;
+}
+
+inline
+void StreamingParser::setMaxDepth(int value)
+{
+    BSLS_ASSERT(0 < value);
+
+    d_maxDepth = value;
+}
+
+inline
+void StreamingParser::setStartArrayHandler(const EventHandler& handler)
+{
+    d_startArrayHandler = handler;
+}
+
+inline
+void StreamingParser::setStartObjectHandler(const EventHandler& handler)
+{
+    d_startObjectHandler = handler;
+}
+
+inline
+void StreamingParser::setValueHandler(const ValueHandler& handler)
+{
+    d_valueHandler = handler;
+}
+
+// ACCESSORS
+inline
+bsl::string StreamingParser::loggedMessages() const
+{
+    return d_logStream.str();
+}
+
+inline
+int StreamingParser::maxDepth() const
+{
+    return d_maxDepth;
+}
+
+inline
+bsls::Types::Uint64 StreamingParser::numBytesFed() const
+{
+    return d_numBytesFed;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1389 @@
+// baljsn_streamingparser.t.cpp                                       -*-C++-*-
+#include <baljsn_streamingparser.h>
+
+#include <bslim_testutil.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides a push parser that reports the structure
+// of JSON input, supplied in chunks, to registered handlers, and a view of
+// the values it reports.  The parser is tested by recording the events it
+// reports as a string, and comparing that string to the expected one for a
+// table of inputs, each supplied whole and split at every pair of positions,
+// so that every token is split at every character.  Malformed input, handler
+// failures, and the nesting limit are tested separately, as is the memory
+// used when parsing an input much larger than any of its tokens.
+// ----------------------------------------------------------------------------
+// StreamingParserValue
+// [ 2] explicit StreamingParserValue(const bslstl::StringRef& text);
+// [ 2] int getValue(TYPE *result) const;
+// [ 2] bool isNull() const;
+// [ 2] const bslstl::StringRef& text() const;
+// [ 2] Type type() const;
+//
+// StreamingParser
+// [ 3] explicit StreamingParser(bslma::Allocator *basicAllocator = 0);
+// [ 3] ~StreamingParser();
+// [ 3] int feed(const char *data, bsl::size_t length);
+// [ 3] int finish();
+// [ 5] void reset();
+// [ 3] void setEndArrayHandler(const EventHandler& handler);
+// [ 3] void setEndDocumentHandler(const EventHandler& handler);
+// [ 3] void setEndObjectHandler(const EventHandler& handler);
+// [ 3] void setKeyHandler(const KeyHandler& handler);
+// [ 5] void setMaxDepth(int value);
+// [ 3] void setStartArrayHandler(const EventHandler& handler);
+// [ 3] void setStartObjectHandler(const EventHandler& handler);
+// [ 3] void setValueHandler(const ValueHandler& handler);
+// [ 5] bsl::string loggedMessages() const;
+// [ 5] int maxDepth() const;
+// [ 3] bsls::Types::Uint64 numBytesFed() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: INPUT MAY BE SPLIT AT ANY CHARACTER
+// [ 6] CONCERN: MEMORY USE IS INDEPENDENT OF THE SIZE OF THE INPUT
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: PARSING JSON LINES
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef baljsn::StreamingParser      Obj;
+typedef baljsn::StreamingParserValue Value;
+typedef bsls::Types::Int64           Int64;
+typedef bsls::Types::Uint64          Uint64;
+
+static const struct {
+    int         d_line;      // source line number
+    const char *d_input_p;   // JSON input
+    const char *d_events_p;  // expected events (see 'EventRecorder')
+} DATA[] = {
+    //LINE  INPUT
+    //----  -----
+    //      EVENTS
+    //      ------
+
+    { L_,   "",
+            ""                                                               },
+    { L_,   " \t\r\n ",
+            ""                                                               },
+    { L_,   "{}",
+            "{ } $"                                                          },
+    { L_,   "[]",
+            "[ ] $"                                                          },
+    { L_,   "  { }  ",
+            "{ } $"                                                          },
+    { L_,   "{\"a\":1}",
+            "{ k(a) n(1) } $"                                                },
+    { L_,   "{ \"a\" : 1 , \"bc\" : -2.5e-3 }",
+            "{ k(a) n(1) k(bc) n(-2.5e-3) } $"                               },
+    { L_,   "{\"a\":\"x\",\"b\":[true,false,null,10],\"c\":{}}",
+            "{ k(a) s(\"x\") k(b) [ b(true) b(false) z(null) n(10) ] "
+            "k(c) { } } $"                                                   },
+    { L_,   "[[[]],[{}],[[1,[2]]]]",
+            "[ [ [ ] ] [ { } ] [ [ n(1) [ n(2) ] ] ] ] $"                    },
+    { L_,   "[ 1 , \"two\" , { \"three\" : [ 3 ] } ]",
+            "[ n(1) s(\"two\") { k(three) [ n(3) ] } ] $"                    },
+    { L_,   "{\"\":\"\"}",
+            "{ k() s(\"\") } $"                                              },
+    { L_,   "{\"a\\\"b\\\\c\\u0041\":\"d\\\"e\\n\"}",
+            "{ k(a\"b\\cA) s(\"d\\\"e\\n\") } $"                             },
+    { L_,   "[\"\xc3\xa9\xe2\x82\xac\", \"\\u00e9\"]",
+            "[ s(\"\xc3\xa9\xe2\x82\xac\") s(\"\\u00e9\") ] $"               },
+    { L_,   "1",
+            "n(1) $"                                                         },
+    { L_,   "-12.5e+7 ",
+            "n(-12.5e+7) $"                                                  },
+    { L_,   "\"abc\"",
+            "s(\"abc\") $"                                                   },
+    { L_,   "null",
+            "z(null) $"                                                      },
+    { L_,   "1 2\n3",
+            "n(1) $ n(2) $ n(3) $"                                           },
+    { L_,   "\"a\"\"b\"",
+            "s(\"a\") $ s(\"b\") $"                                          },
+    { L_,   "{\"a\":1}\n{\"a\":2}\n",
+            "{ k(a) n(1) } $ { k(a) n(2) } $"                                },
+    { L_,   "{}[]{}",
+            "{ } $ [ ] $ { } $"                                              },
+    { L_,   "[1]true{\"x\":false}",
+            "[ n(1) ] $ b(true) $ { k(x) b(false) } $"                       },
+    { L_,   "[1,2,3][4]",
+            "[ n(1) n(2) n(3) ] $ [ n(4) ] $"                                },
+};
+const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+class EventRecorder {
+    // This class records the events reported by a 'StreamingParser' as a
+    // string of space-separated items: '{', '}', '[', and ']' for the starts
+    // and ends of objects and arrays, 'k(NAME)' for a member name, 's(TEXT)',
+    // 'n(TEXT)', 'b(TEXT)', and 'z(TEXT)' for a string, number, boolean, and
+    // null value having the JSON 'TEXT', and '$' for the end of a document.
+    // The handlers return 0 until a specified number of events has been
+    // recorded, and a specified status thereafter.
+
+    // DATA
+    bsl::string d_events;        // events recorded
+    int         d_numEvents;     // number of events recorded
+    int         d_failAfter;     // events recorded before failing, or -1
+    int         d_failStatus;    // status returned when failing
+
+    // PRIVATE MANIPULATORS
+    int record(const char               *kind,
+               const bslstl::StringRef&  text = bslstl::StringRef())
+        // Append the specified 'kind' of event, followed by the optionally
+        // specified 'text' in parentheses if 'kind' is a letter, to the
+        // events recorded, and return the status of the handler.
+    {
+        if (0 <= d_failAfter && d_numEvents >= d_failAfter) {
+            return d_failStatus;                                      // RETURN
+        }
+
+        if (!d_events.empty()) {
+            d_events += ' ';
+        }
+        d_events += kind;
+        if ('a' <= *kind && *kind <= 'z') {
+            d_events += '(';
+            d_events.append(text.begin(), text.end());
+            d_events += ')';
+        }
+        ++d_numEvents;
+        return 0;
+    }
+
+  public:
+    // CREATORS
+    explicit EventRecorder(bslma::Allocator *basicAllocator = 0)
+    : d_events(basicAllocator)
+    , d_numEvents(0)
+    , d_failAfter(-1)
+    , d_failStatus(0)
+    {
+    }
+
+    // MANIPULATORS
+    int endArray()    { return record("]"); }
+    int endDocument() { return record("$"); }
+    int endObject()   { return record("}"); }
+    int startArray()  { return record("["); }
+    int startObject() { return record("{"); }
+
+    int key(const bslstl::StringRef& name)
+    {
+        return record("k", name);
+    }
+
+    int value(const Value& value)
+    {
+        const char *kind = "?";
+        switch (value.type()) {
+          case Value::e_STRING:  kind = "s"; break;
+          case Value::e_NUMBER:  kind = "n"; break;
+          case Value::e_BOOLEAN: kind = "b"; break;
+          case Value::e_NULL:    kind = "z"; break;
+        }
+        return record(kind, value.text());
+    }
+
+    void clear()
+    {
+        d_events.clear();
+        d_numEvents = 0;
+    }
+
+    void failAfter(int numEvents, int status)
+        // Return the specified 'status' from handlers called after the
+        // specified 'numEvents' have been recorded.
+    {
+        d_failAfter  = numEvents;
+        d_failStatus = status;
+    }
+
+    // ACCESSORS
+    const bsl::string& events() const { return d_events; }
+};
+
+void setHandlers(Obj *parser, EventRecorder *recorder)
+    // Register the handlers of the specified 'recorder' with the specified
+    // 'parser'.
+{
+    using bdlf::PlaceHolders::_1;
+
+    parser->setStartObjectHandler(
+                  bdlf::BindUtil::bind(&EventRecorder::startObject, recorder));
+    parser->setEndObjectHandler(
+                    bdlf::BindUtil::bind(&EventRecorder::endObject, recorder));
+    parser->setStartArrayHandler(
+                   bdlf::BindUtil::bind(&EventRecorder::startArray, recorder));
+    parser->setEndArrayHandler(
+                     bdlf::BindUtil::bind(&EventRecorder::endArray, recorder));
+    parser->setKeyHandler(
+                      bdlf::BindUtil::bind(&EventRecorder::key, recorder, _1));
+    parser->setValueHandler(
+                    bdlf::BindUtil::bind(&EventRecorder::value, recorder, _1));
+    parser->setEndDocumentHandler(
+                  bdlf::BindUtil::bind(&EventRecorder::endDocument, recorder));
+}
+
+int feedInChunks(Obj *parser, const bsl::string& input, bsl::size_t size)
+    // Supply the specified 'input' to the specified 'parser' in chunks of the
+    // specified 'size' (the last of which may be shorter), each copied to a
+    // buffer of exactly its length, and then call 'finish'.  Return the
+    // first non-zero status returned by the parser, or 0 if there is none.
+{
+    for (bsl::size_t offset = 0; offset < input.length(); offset += size) {
+        const bsl::size_t length = bsl::min(size, input.length() - offset);
+
+        const bsl::string chunk(input, offset, length, input.get_allocator());
+        const int         rc = parser->feed(chunk.data(), chunk.length());
+        if (0 != rc) {
+            return rc;                                                // RETURN
+        }
+    }
+    return parser->finish();
+}
+
+int countEvent(int *counter)
+    // Increment the specified 'counter' and return 0.
+{
+    ++*counter;
+    return 0;
+}
+
+int countKey(int *counter, const bslstl::StringRef&)
+    // Increment the specified 'counter' and return 0.
+{
+    ++*counter;
+    return 0;
+}
+
+bsl::string makeJsonLines(int numRecords)
+    // Return a JSON Lines input holding the specified 'numRecords' objects of
+    // assorted members.
+{
+    bsl::ostringstream oss;
+    for (int i = 0; i < numRecords; ++i) {
+        oss << "{\"id\":" << i
+            << ",\"name\":\"record \\\"" << i << "\\\"\""
+            << ",\"price\":" << i * 0.25
+            << ",\"tags\":[\"a\",\"bc\",null,true]"
+            << ",\"nested\":{\"x\":-" << i << ",\"y\":[]}}\n";
+    }
+    return oss.str();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Summing a Field of a JSON Lines File
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive a stream of trades in JSON Lines format, in blocks
+// whose boundaries bear no relation to the structure of the data, and that we
+// want to compute the total quantity traded without first assembling each
+// record.
+//
+// First, we define a class to hold the state of the computation, with a
+// method for each of the events we are interested in:
+//..
+    class TradeTotaler {
+        // This class accumulates the "qty" members of a sequence of objects.
+
+        // DATA
+        int                 d_depth;       // current nesting depth
+        bool                d_isQuantity;  // 'true' if the next value is
+                                           // that of a top-level "qty"
+        bsls::Types::Int64  d_total;       // total quantity
+        int                 d_numTrades;   // number of records seen
+
+      public:
+        // CREATORS
+        TradeTotaler()
+        : d_depth(0)
+        , d_isQuantity(false)
+        , d_total(0)
+        , d_numTrades(0)
+        {
+        }
+
+        // MANIPULATORS
+        int startObject()
+        {
+            ++d_depth;
+            return 0;
+        }
+
+        int endObject()
+        {
+            if (0 == --d_depth) {
+                ++d_numTrades;
+            }
+            return 0;
+        }
+
+        int key(const bslstl::StringRef& name)
+        {
+            d_isQuantity = 1 == d_depth && "qty" == name;
+            return 0;
+        }
+
+        int value(const baljsn::StreamingParserValue& value)
+        {
+            if (!d_isQuantity) {
+                return 0;                                             // RETURN
+            }
+
+            int quantity;
+            if (0 != value.getValue(&quantity)) {
+                return -1;                                            // RETURN
+            }
+            d_total += quantity;
+            return 0;
+        }
+
+        // ACCESSORS
+        int numTrades() const { return d_numTrades; }
+
+        bsls::Types::Int64 total() const { return d_total; }
+    };
+//..
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test        = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose     = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: No memory is ever allocated from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we create a parser and register the handlers of a 'TradeTotaler':
+//..
+    TradeTotaler totaler;
+
+    baljsn::StreamingParser parser;
+    parser.setStartObjectHandler(
+                        bdlf::BindUtil::bind(&TradeTotaler::startObject,
+                                             &totaler));
+    parser.setEndObjectHandler(
+                        bdlf::BindUtil::bind(&TradeTotaler::endObject,
+                                             &totaler));
+    parser.setKeyHandler(bdlf::BindUtil::bind(&TradeTotaler::key,
+                                              &totaler,
+                                              bdlf::PlaceHolders::_1));
+    parser.setValueHandler(bdlf::BindUtil::bind(&TradeTotaler::value,
+                                                &totaler,
+                                                bdlf::PlaceHolders::_1));
+//..
+// Next, we define the input, which we will supply in blocks of 7 characters,
+// splitting names, numbers, and records alike:
+//..
+    const char *INPUT =
+        "{\"sym\":\"IBM\",\"qty\":100,\"px\":143.5}\n"
+        "{\"sym\":\"AAPL\",\"qty\":2500,\"tags\":[\"odd\",\"lot\"]}\n"
+        "{\"sym\":\"MSFT\",\"qty\":-300,\"px\":{\"bid\":411.1}}\n";
+
+    const bsl::size_t LENGTH = bsl::strlen(INPUT);
+//..
+// Now, we feed the blocks to the parser, and tell it when the input ends:
+//..
+    for (bsl::size_t offset = 0; offset < LENGTH; offset += 7) {
+        const bsl::size_t size = bsl::min<bsl::size_t>(7, LENGTH - offset);
+
+        int rc = parser.feed(INPUT + offset, size);
+        ASSERT(0 == rc);
+    }
+
+    int rc = parser.finish();
+    ASSERT(0 == rc);
+//..
+// Finally, we verify the result:
+//..
+    ASSERT(3    == totaler.numTrades());
+    ASSERT(2300 == totaler.total());
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCERN: MEMORY USE IS INDEPENDENT OF THE SIZE OF THE INPUT
+        //
+        // Concerns:
+        //: 1 The memory used by the parser does not grow with the size of
+        //:   the input, but only with the length of its longest token.
+        //:
+        //: 2 Tokens longer than the chunks supplying them, and longer than the
+        //:   internal buffer of the tokenizer, are reported correctly.
+        //:
+        //: 3 All memory is supplied by the allocator of the parser.
+        //:
+        //: 4 Input having a long run of ':' or ',' is rejected as soon as the
+        //:   second separator of the run is supplied, without buffering the
+        //:   run.
+        //
+        // Plan:
+        //: 1 Parse JSON Lines inputs of 1,000 and 20,000 records, supplied in
+        //:   chunks of 4096 characters, using a parser supplied with a test
+        //:   allocator, and verify that the number of records reported is
+        //:   correct and that the maximum memory in use is the same for both.
+        //:   (C-1)
+        //:
+        //: 2 Parse an array holding string literals and a number of up to
+        //:   100,000 characters, supplied in chunks of several sizes, and
+        //:   verify the events reported.  Verify that the maximum memory in
+        //:   use is no more than a small multiple of the longest token.
+        //:   (C-2)
+        //:
+        //: 3 Install a test allocator as the default allocator, and verify
+        //:   that it is not used by the parser.  (C-3)
+        //:
+        //: 4 Supply, one character at a time, arrays and objects followed by
+        //:   100,000 separators, and verify that 'feed' fails at the second
+        //:   separator and that no memory is allocated once the run starts.
+        //:   (C-4)
+        //
+        // Testing:
+        //   CONCERN: MEMORY USE IS INDEPENDENT OF THE SIZE OF THE INPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+               << "CONCERN: MEMORY USE IS INDEPENDENT OF THE SIZE OF THE INPUT"
+               << endl
+               << "==========================================================="
+               << endl;
+
+        bslma::TestAllocator         da("default", veryVerbose);
+        bslma::TestAllocator         sa("scratch", veryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) cout << "\nParsing JSON Lines inputs." << endl;
+        {
+            const int NUM_RECORDS[] = { 1000, 20000 };
+
+            Int64 maxBytesInUse[2];
+
+            for (int ti = 0; ti < 2; ++ti) {
+                const bsl::string INPUT(makeJsonLines(NUM_RECORDS[ti]), &sa);
+
+                bslma::TestAllocator oa("object", veryVerbose);
+
+                const Int64 NUM_DEFAULT_BLOCKS = da.numBlocksTotal();
+
+                int numDocuments = 0;
+                int numKeys      = 0;
+                {
+                    Obj mX(&oa);
+                    mX.setEndDocumentHandler(
+                                       bdlf::BindUtil::bind(&countEvent,
+                                                            &numDocuments));
+                    mX.setKeyHandler(bdlf::BindUtil::bind(
+                                                      &countKey,
+                                                      &numKeys,
+                                                      bdlf::PlaceHolders::_1));
+
+                    ASSERTV(ti, 0 == feedInChunks(&mX, INPUT, 4096));
+                    ASSERTV(ti, mX.loggedMessages(),
+                            mX.loggedMessages().empty());
+                }
+
+                ASSERTV(ti, NUM_DEFAULT_BLOCKS == da.numBlocksTotal());
+                ASSERTV(ti, numDocuments, NUM_RECORDS[ti] == numDocuments);
+                ASSERTV(ti, numKeys, 7 * NUM_RECORDS[ti] == numKeys);
+
+                maxBytesInUse[ti] = oa.numBytesMax();
+                if (veryVerbose) { P_(ti) P(maxBytesInUse[ti]) }
+            }
+
+            ASSERTV(maxBytesInUse[0], maxBytesInUse[1],
+                    maxBytesInUse[0] == maxBytesInUse[1]);
+        }
+
+        if (verbose) cout << "\nParsing long tokens." << endl;
+        {
+            const bsl::size_t LENGTHS[] = { 5000, 8191, 8192, 8193, 100000 };
+            const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+            const bsl::size_t SIZES[] = { 1, 7, 4096, 8192, 1000000 };
+            const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+            for (int li = 0; li < NUM_LENGTHS; ++li) {
+                const bsl::size_t LENGTH = LENGTHS[li];
+
+                // A string of 'LENGTH' characters, with an escape sequence
+                // every 97 characters, and a number of 'LENGTH' digits.
+
+                bsl::string text;
+                for (bsl::size_t i = 0; text.length() < LENGTH; ++i) {
+                    if (0 == i % 97) {
+                        text += "\\\"";
+                    }
+                    else {
+                        text += static_cast<char>('a' + i % 26);
+                    }
+                }
+                const bsl::string STRING = '"' + text + '"';
+                const bsl::string NUMBER(LENGTH, '7');
+
+                const bsl::string INPUT("[" + STRING + ",{" + STRING + ":"
+                                        + NUMBER + "}]" + NUMBER,
+                                        &sa);
+
+                bsl::string key(text);
+                key.erase(bsl::remove(key.begin(), key.end(), '\\'),
+                          key.end());
+
+                const bsl::string EXPECTED = "[ s(" + STRING + ") { k(" + key
+                                           + ") n(" + NUMBER + ") } ] $ n("
+                                           + NUMBER + ") $";
+
+                for (int si = 0; si < NUM_SIZES; ++si) {
+                    const bsl::size_t SIZE = SIZES[si];
+
+                    if (1 == SIZE && LENGTH > 10000) {
+                        continue;
+                    }
+
+                    bslma::TestAllocator oa("object", veryVerbose);
+
+                    EventRecorder recorder(&sa);
+                    const Int64   NUM_DEFAULT_BLOCKS = da.numBlocksTotal();
+                    {
+                        Obj mX(&oa);
+                        setHandlers(&mX, &recorder);
+
+                        ASSERTV(LENGTH, SIZE,
+                                0 == feedInChunks(&mX, INPUT, SIZE));
+                    }
+                    ASSERTV(LENGTH, SIZE,
+                            NUM_DEFAULT_BLOCKS == da.numBlocksTotal());
+
+                    ASSERTV(LENGTH, SIZE, EXPECTED == recorder.events());
+                    ASSERTV(LENGTH, SIZE, oa.numBytesMax(),
+                            oa.numBytesMax() < 16 * Int64(LENGTH) + 65536);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nParsing runs of separators." << endl;
+        {
+            static const struct {
+                int         d_line;       // source line number
+                const char *d_prefix_p;   // input preceding the run
+                char        d_separator;  // separator repeated in the run
+            } DATA[] = {
+                //LINE  PREFIX         SEPARATOR
+                //----  ------         ---------
+                { L_,   "[1",          ','       },
+                { L_,   "[1",          ':'       },
+                { L_,   "{\"a\"",      ':'       },
+                { L_,   "{\"a\":1",    ','       },
+                { L_,   "",            ','       },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            const int RUN_LENGTH = 100000;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE      = DATA[ti].d_line;
+                const bsl::string PREFIX    = DATA[ti].d_prefix_p;
+                const char        SEPARATOR = DATA[ti].d_separator;
+
+                // The first separator of the run is valid only after a key
+                // (for ':') or a nested value (for ',').
+
+                const bool FIRST_VALID = !PREFIX.empty()
+                                      && (':' == SEPARATOR) ==
+                                               ('"' == PREFIX[PREFIX.length()
+                                                                        - 1]);
+
+                bslma::TestAllocator oa("object", veryVerbose);
+
+                Obj mX(&oa);  const Obj& X = mX;
+
+                ASSERTV(LINE, 0 == mX.feed(PREFIX.data(), PREFIX.length()));
+
+                const Int64 NUM_BLOCKS = oa.numBlocksTotal();
+
+                int numFed = 0;
+                while (numFed < RUN_LENGTH
+                    && 0 == mX.feed(&SEPARATOR, 1)) {
+                    ++numFed;
+                }
+
+                ASSERTV(LINE, numFed, (FIRST_VALID ? 1 : 0) == numFed);
+                ASSERTV(LINE, X.loggedMessages(),
+                        bsl::string::npos != X.loggedMessages().find(
+                                                              "Unexpected"));
+                ASSERTV(LINE, NUM_BLOCKS, oa.numBlocksTotal(),
+                        oa.numBlocksTotal() <= NUM_BLOCKS + 1);
+            }
+        }
+
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // MALFORMED INPUT, HANDLER FAILURE, AND NESTING LIMIT
+        //
+        // Concerns:
+        //: 1 Malformed input, including mismatched brackets, unexpected ':'
+        //:   and ',', and input ending within a value, causes 'feed' or
+        //:   'finish' to fail, and a description of the error to be logged.
+        //:
+        //: 2 A handler returning a non-zero value stops the parse: no further
+        //:   events are reported, and the call that invoked the handler fails.
+        //:
+        //: 3 Once failed, 'feed' and 'finish' continue to fail until 'reset'
+        //:   is called, which clears the log and allows a new input to be
+        //:   parsed.
+        //:
+        //: 4 Input nested more deeply than 'maxDepth' is rejected, and input
+        //:   nested exactly 'maxDepth' deep is accepted.
+        //:
+        //: 5 Invalid escape sequences in member names are rejected.
+        //
+        // Plan:
+        //: 1 For a table of malformed inputs, supply each input whole, and
+        //:   split at every position, and verify that 'feed' or 'finish'
+        //:   fails as expected and that a message is logged.  (C-1)
+        //:
+        //: 2 Register handlers that fail after a given number of events, and
+        //:   verify the events recorded and the return values.  (C-2)
+        //:
+        //: 3 After each failure, verify that 'feed' and 'finish' fail, then
+        //:   call 'reset' and parse a valid input.  (C-3)
+        //:
+        //: 4 Parse inputs nested to, and beyond, several limits.  (C-4)
+        //:
+        //: 5 Parse an object having a member name with an invalid escape
+        //:   sequence.  (C-5)
+        //
+        // Testing:
+        //   void reset();
+        //   void setMaxDepth(int value);
+        //   bsl::string loggedMessages() const;
+        //   int maxDepth() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                       << "MALFORMED INPUT, HANDLER FAILURE, AND NESTING LIMIT"
+                       << endl
+                       << "==================================================="
+                       << endl;
+
+        if (verbose) cout << "\nMalformed input." << endl;
+        {
+            static const struct {
+                int         d_line;     // source line number
+                const char *d_input_p;  // malformed JSON input
+                bool        d_inFeed;   // 'true' if 'feed' fails when the
+                                        // input is supplied whole
+            } DATA[] = {
+                //LINE  INPUT                        IN FEED
+                //----  -----                        -------
+                { L_,   "}",                         true    },
+                { L_,   "]",                         true    },
+                { L_,   "{]",                        true    },
+                { L_,   "[}",                        true    },
+                { L_,   "[1]]",                      true    },
+                { L_,   "{\"a\"}",                   true    },
+                { L_,   "{\"a\":}",                  true    },
+                { L_,   "{1:2}",                     true    },
+                { L_,   "[1 2]",                     true    },
+                { L_,   "{\"a\":1 \"b\":2}",         true    },
+                { L_,   "{\"a\":1},{}",              true    },
+                { L_,   ",",                         true    },
+                { L_,   ":",                         true    },
+                { L_,   "[,1]",                      true    },
+                { L_,   "[1,,2]",                    true    },
+                { L_,   "[1:2]",                     true    },
+                { L_,   "{,}",                       true    },
+                { L_,   "{\"a\"::1}",                true    },
+                { L_,   "{\"a\",1}",                 true    },
+                { L_,   "{\"a\":1,,\"b\":2}",        true    },
+                { L_,   "{\"a\":1:\"b\"}",           true    },
+                { L_,   "{}  ,",                     true    },
+                { L_,   "{",                         false   },
+                { L_,   "[1,2",                      false   },
+                { L_,   "{\"a\":1",                  false   },
+                { L_,   "\"abc",                     false   },
+                { L_,   "[\"a\\",                    false   },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE    = DATA[ti].d_line;
+                const bsl::string INPUT   = DATA[ti].d_input_p;
+                const bool        IN_FEED = DATA[ti].d_inFeed;
+
+                if (veryVerbose) { T_ P_(LINE) P(INPUT) }
+
+                EventRecorder recorder;
+                Obj           mX;  const Obj& X = mX;
+                setHandlers(&mX, &recorder);
+
+                const int feedRc = mX.feed(INPUT.data(), INPUT.length());
+                ASSERTV(LINE, feedRc, IN_FEED == (0 != feedRc));
+
+                ASSERTV(LINE, 0 != mX.finish());
+                ASSERTV(LINE, X.loggedMessages(),
+                        bsl::string::npos != X.loggedMessages().find(
+                                                                 "at offset"));
+
+                // Failure is sticky until 'reset'.
+
+                ASSERTV(LINE, 0 != mX.feed("{}", 2));
+                ASSERTV(LINE, 0 != mX.finish());
+
+                mX.reset();
+                ASSERTV(LINE, X.loggedMessages().empty());
+
+                recorder.clear();
+                ASSERTV(LINE, 0 == mX.feed("{}", 2));
+                ASSERTV(LINE, 0 == mX.finish());
+                ASSERTV(LINE, recorder.events(), "{ } $" == recorder.events());
+
+                // The input is rejected however it is split.
+
+                for (bsl::size_t i = 0; i <= INPUT.length(); ++i) {
+                    mX.reset();
+
+                    const int rc1 = mX.feed(INPUT.data(), i);
+                    const int rc2 = mX.feed(INPUT.data() + i,
+                                            INPUT.length() - i);
+                    const int rc3 = mX.finish();
+
+                    ASSERTV(LINE, i, 0 != rc1 || 0 != rc2 || 0 != rc3);
+                    ASSERTV(LINE, i, 0 == rc1 || 0 != rc2);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nHandler failure." << endl;
+        {
+            const bsl::string INPUT = "{\"a\":[1,2]}\n{\"b\":3}";
+
+            const char *EXPECTED[] = {
+                "",
+                "{",
+                "{ k(a)",
+                "{ k(a) [",
+                "{ k(a) [ n(1)",
+                "{ k(a) [ n(1) n(2)",
+                "{ k(a) [ n(1) n(2) ]",
+                "{ k(a) [ n(1) n(2) ] }",
+                "{ k(a) [ n(1) n(2) ] } $",
+                "{ k(a) [ n(1) n(2) ] } $ {",
+                "{ k(a) [ n(1) n(2) ] } $ { k(b)",
+                "{ k(a) [ n(1) n(2) ] } $ { k(b) n(3)",
+                "{ k(a) [ n(1) n(2) ] } $ { k(b) n(3) }",
+            };
+            const int NUM_EXPECTED = sizeof EXPECTED / sizeof *EXPECTED;
+
+            for (int ti = 0; ti < NUM_EXPECTED; ++ti) {
+                EventRecorder recorder;
+                recorder.failAfter(ti, 7);
+
+                Obj mX;  const Obj& X = mX;
+                setHandlers(&mX, &recorder);
+
+                ASSERTV(ti, 0 != feedInChunks(&mX, INPUT, 3));
+                ASSERTV(ti, recorder.events(),
+                        EXPECTED[ti] == recorder.events());
+                ASSERTV(ti, X.loggedMessages(),
+                        bsl::string::npos != X.loggedMessages().find(
+                                                       "Handler returned 7"));
+            }
+        }
+
+        if (verbose) cout << "\nNesting limit." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(Obj::k_DEFAULT_MAX_DEPTH == X.maxDepth());
+            ASSERT(32                       == X.maxDepth());
+
+            const int DEPTHS[] = { 1, 2, 5, 32, 100 };
+            const int NUM_DEPTHS = sizeof DEPTHS / sizeof *DEPTHS;
+
+            for (int ti = 0; ti < NUM_DEPTHS; ++ti) {
+                const int DEPTH = DEPTHS[ti];
+
+                mX.setMaxDepth(DEPTH);
+                ASSERTV(DEPTH, DEPTH == X.maxDepth());
+
+                for (int extra = 0; extra <= 1; ++extra) {
+                    const int   N = DEPTH + extra;
+                    bsl::string input;
+                    for (int i = 0; i < N; ++i) {
+                        input += i % 2 ? "[" : "{\"a\":";
+                    }
+                    input += '0';
+                    for (int i = N - 1; i >= 0; --i) {
+                        input += i % 2 ? "]" : "}";
+                    }
+
+                    mX.reset();
+                    const int rc = mX.feed(input.data(), input.length())
+                                 | mX.finish();
+
+                    ASSERTV(DEPTH, extra, rc, (0 == rc) == (0 == extra));
+                    if (extra) {
+                        ASSERTV(DEPTH, X.loggedMessages(),
+                                bsl::string::npos != X.loggedMessages().find(
+                                                           "nesting depth"));
+                    }
+                }
+            }
+
+            if (verbose) cout << "\tNegative Testing." << endl;
+            {
+                bsls::AssertTestHandlerGuard hG;
+
+                ASSERT_FAIL(mX.setMaxDepth(0));
+                ASSERT_PASS(mX.setMaxDepth(1));
+            }
+        }
+
+        if (verbose) cout << "\nInvalid escape sequences in names." << endl;
+        {
+            EventRecorder recorder;
+            Obj           mX;  const Obj& X = mX;
+            setHandlers(&mX, &recorder);
+
+            const char *INPUT = "{\"a\\qb\":1}";
+            ASSERT(0 != mX.feed(INPUT, bsl::strlen(INPUT)));
+            ASSERTV(recorder.events(), "{" == recorder.events());
+            ASSERTV(X.loggedMessages(),
+                    bsl::string::npos != X.loggedMessages().find("escape"));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: INPUT MAY BE SPLIT AT ANY CHARACTER
+        //
+        // Concerns:
+        //: 1 The events reported do not depend on how the input is split into
+        //:   chunks, including splits within tokens, escape sequences, and
+        //:   UTF-8 sequences, and empty chunks.
+        //:
+        //: 2 The characters of a chunk need not remain valid after 'feed'
+        //:   returns.
+        //
+        // Plan:
+        //: 1 For each input in the table of case 3, supply the input split
+        //:   into three chunks at every pair of positions, and one character
+        //:   at a time, each chunk being copied to a buffer that is
+        //:   overwritten after 'feed' returns, and verify that the events
+        //:   reported are those expected.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: INPUT MAY BE SPLIT AT ANY CHARACTER
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: INPUT MAY BE SPLIT AT ANY CHARACTER"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const bsl::string INPUT  = DATA[ti].d_input_p;
+            const bsl::string EVENTS = DATA[ti].d_events_p;
+            const bsl::size_t LENGTH = INPUT.length();
+
+            if (veryVerbose) { T_ P_(LINE) P(INPUT) }
+
+            EventRecorder recorder;
+            Obj           mX;
+            setHandlers(&mX, &recorder);
+
+            for (bsl::size_t i = 0; i <= LENGTH; ++i) {
+                for (bsl::size_t j = i; j <= LENGTH; ++j) {
+                    recorder.clear();
+
+                    const bsl::size_t BOUNDS[] = { 0, i, j, LENGTH };
+
+                    for (int ci = 0; ci < 3; ++ci) {
+                        bsl::string chunk(INPUT,
+                                          BOUNDS[ci],
+                                          BOUNDS[ci + 1] - BOUNDS[ci]);
+
+                        ASSERTV(LINE, i, j, ci,
+                                0 == mX.feed(chunk.data(), chunk.length()));
+
+                        chunk.assign(chunk.length(), '#');
+                    }
+                    ASSERTV(LINE, i, j, 0 == mX.finish());
+
+                    ASSERTV(LINE, i, j, recorder.events(),
+                            EVENTS == recorder.events());
+                }
+            }
+
+            recorder.clear();
+            ASSERTV(LINE, 0 == feedInChunks(&mX, INPUT, 1));
+            ASSERTV(LINE, recorder.events(), EVENTS == recorder.events());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // PARSING WHOLE INPUTS
+        //
+        // Concerns:
+        //: 1 Each event is reported to the corresponding handler, in the
+        //:   order of the input.
+        //:
+        //: 2 Member names are reported with their escape sequences replaced,
+        //:   and values with their JSON text.
+        //:
+        //: 3 A sequence of top-level values, including numbers and literals
+        //:   not followed by whitespace, is accepted, and the end of each is
+        //:   reported.
+        //:
+        //: 4 Events for which no handler is registered are ignored.
+        //:
+        //: 5 'numBytesFed' reports the number of characters supplied since
+        //:   construction or the last call to 'finish'.
+        //:
+        //: 6 The parser can be reused after 'finish'.
+        //
+        // Plan:
+        //: 1 For a table of inputs and the events they are expected to
+        //:   produce, supply each input in a single call to 'feed', call
+        //:   'finish', and verify the events reported.  Parse each input
+        //:   twice with the same parser.  (C-1..3, 5..6)
+        //:
+        //: 2 Parse each input with a parser having only an end document
+        //:   handler, and verify that the number of documents is as expected.
+        //:   (C-4)
+        //
+        // Testing:
+        //   explicit StreamingParser(bslma::Allocator *basicAllocator = 0);
+        //   ~StreamingParser();
+        //   int feed(const char *data, bsl::size_t length);
+        //   int finish();
+        //   void setEndArrayHandler(const EventHandler& handler);
+        //   void setEndDocumentHandler(const EventHandler& handler);
+        //   void setEndObjectHandler(const EventHandler& handler);
+        //   void setKeyHandler(const KeyHandler& handler);
+        //   void setStartArrayHandler(const EventHandler& handler);
+        //   void setStartObjectHandler(const EventHandler& handler);
+        //   void setValueHandler(const ValueHandler& handler);
+        //   bsls::Types::Uint64 numBytesFed() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PARSING WHOLE INPUTS" << endl
+                          << "====================" << endl;
+
+        bslma::TestAllocator         da("default", veryVerbose);
+        bslma::TestAllocator         sa("scratch", veryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const bsl::string INPUT(DATA[ti].d_input_p, &sa);
+            const bsl::string EVENTS(DATA[ti].d_events_p, &sa);
+
+            if (veryVerbose) { T_ P_(LINE) P(INPUT) }
+
+            bslma::TestAllocator oa("object", veryVerbose);
+
+            EventRecorder recorder(&sa);
+            {
+                Obj mX(&oa);  const Obj& X = mX;
+                setHandlers(&mX, &recorder);
+
+                for (int pass = 0; pass < 2; ++pass) {
+                    recorder.clear();
+
+                    ASSERTV(LINE, pass, 0 == X.numBytesFed());
+                    ASSERTV(LINE, pass,
+                            0 == mX.feed(INPUT.data(), INPUT.length()));
+                    ASSERTV(LINE, pass, INPUT.length() == X.numBytesFed());
+                    ASSERTV(LINE, pass, 0 == mX.finish());
+                    ASSERTV(LINE, pass, X.loggedMessages().empty());
+
+                    ASSERTV(LINE, pass, recorder.events(),
+                            EVENTS == recorder.events());
+                }
+            }
+
+            // Events without handlers are ignored.
+
+            int numDocuments = 0;
+            {
+                EventRecorder documents(&sa);
+
+                Obj mX(&oa);
+                mX.setEndDocumentHandler(
+                                   bdlf::BindUtil::bind(
+                                                   &EventRecorder::endDocument,
+                                                   &documents));
+
+                ASSERTV(LINE, 0 == mX.feed(INPUT.data(), INPUT.length()));
+                ASSERTV(LINE, 0 == mX.finish());
+
+                numDocuments = static_cast<int>(bsl::count(
+                                                    documents.events().begin(),
+                                                    documents.events().end(),
+                                                    '$'));
+            }
+            ASSERTV(LINE, numDocuments,
+                    bsl::count(EVENTS.begin(), EVENTS.end(), '$')
+                                                              == numDocuments);
+        }
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'StreamingParserValue'
+        //
+        // Concerns:
+        //: 1 The kind of a value is determined by its text: a string begins
+        //:   with '"', 'true' and 'false' are booleans, 'null' is null, and
+        //:   any other text is a number.
+        //:
+        //: 2 'text' returns the text supplied at construction.
+        //:
+        //: 3 'getValue' converts the text as 'baljsn::ParserUtil::getValue'
+        //:   does, and fails for text not representing a value of the
+        //:   requested type.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a table of texts, create a value and verify its kind, text,
+        //:   and 'isNull'.  (C-1..2)
+        //:
+        //: 2 Convert several texts to 'int', 'double', 'bool', and
+        //:   'bsl::string', and verify the results.  (C-3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   explicit StreamingParserValue(const bslstl::StringRef& text);
+        //   int getValue(TYPE *result) const;
+        //   bool isNull() const;
+        //   const bslstl::StringRef& text() const;
+        //   Type type() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'StreamingParserValue'" << endl
+                          << "======================" << endl;
+
+        {
+            static const struct {
+                int         d_line;   // source line number
+                const char *d_text;   // JSON text
+                Value::Type d_type;   // expected kind
+            } DATA[] = {
+                //LINE  TEXT              TYPE
+                //----  ----              ----
+                { L_,   "\"\"",           Value::e_STRING  },
+                { L_,   "\"true\"",       Value::e_STRING  },
+                { L_,   "\"a\\\"b\"",     Value::e_STRING  },
+                { L_,   "0",              Value::e_NUMBER  },
+                { L_,   "-1.5e+10",       Value::e_NUMBER  },
+                { L_,   "tru",            Value::e_NUMBER  },
+                { L_,   "nulls",          Value::e_NUMBER  },
+                { L_,   "true",           Value::e_BOOLEAN },
+                { L_,   "false",          Value::e_BOOLEAN },
+                { L_,   "null",           Value::e_NULL    },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE = DATA[ti].d_line;
+                const char       *TEXT = DATA[ti].d_text;
+                const Value::Type TYPE = DATA[ti].d_type;
+
+                const Value X(TEXT);
+
+                ASSERTV(LINE, TYPE == X.type());
+                ASSERTV(LINE, TEXT == X.text());
+                ASSERTV(LINE, TEXT == X.text().data());
+                ASSERTV(LINE, (Value::e_NULL == TYPE) == X.isNull());
+            }
+        }
+
+        {
+            int         i = 0;
+            double      d = 0;
+            bool        b = false;
+            bsl::string s;
+
+            ASSERT(0 == Value("-42").getValue(&i));
+            ASSERT(-42 == i);
+            ASSERT(0 != Value("4.5").getValue(&i));
+            ASSERT(-42 == i);
+
+            ASSERT(0 == Value("2.5e-3").getValue(&d));
+            ASSERT(2.5e-3 == d);
+
+            ASSERT(0 == Value("true").getValue(&b));
+            ASSERT(true == b);
+
+            ASSERT(0 == Value("\"a\\\"b\\u0041\"").getValue(&s));
+            ASSERT("a\"bA" == s);
+            ASSERT(0 != Value("12").getValue(&s));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(Value(""));
+            ASSERT_PASS(Value("1"));
+
+            const Value X("1");
+            int         i;
+
+            ASSERT_FAIL(X.getValue(static_cast<int *>(0)));
+            ASSERT_PASS(X.getValue(&i));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Parse a small document supplied in two chunks, and verify the
+        //:   events reported.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        EventRecorder recorder;
+        Obj           mX;
+        setHandlers(&mX, &recorder);
+
+        const char *INPUT = "{\"name\":\"Bob\",\"ids\":[1,22]}";
+
+        ASSERT(0 == mX.feed(INPUT, 12));
+        ASSERTV(recorder.events(), "{ k(name)" == recorder.events());
+
+        ASSERT(0 == mX.feed(INPUT + 12, bsl::strlen(INPUT) - 12));
+        ASSERT(0 == mX.finish());
+        ASSERTV(recorder.events(),
+                "{ k(name) s(\"Bob\") k(ids) [ n(1) n(22) ] } $"
+                                                        == recorder.events());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: PARSING JSON LINES
+        //
+        // Concerns:
+        //: 1 The throughput of the parser is not much affected by the size of
+        //:   the chunks supplying the input.
+        //
+        // Plan:
+        //: 1 Parse a JSON Lines input of 100,000 records, supplied in chunks
+        //:   of several sizes, with handlers counting the events, and report
+        //:   the throughput in megabytes per second.  An optional argument
+        //:   specifies the number of passes.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: PARSING JSON LINES
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: PARSING JSON LINES" << endl
+             << "===============================" << endl;
+
+        const int NUM_PASSES = argc > 2 ? atoi(argv[2]) : 10;
+
+        const bsl::string INPUT = makeJsonLines(100000);
+
+        const bsl::size_t SIZES[] = { 64, 4096, 65536, INPUT.length() };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        const double MEGABYTES = static_cast<double>(INPUT.length())
+                               * NUM_PASSES / (1024.0 * 1024.0);
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const bsl::size_t SIZE = SIZES[si];
+
+            EventRecorder recorder;
+            recorder.failAfter(0, 0);  // count nothing, succeed always
+
+            Obj mX;
+            setHandlers(&mX, &recorder);
+
+            int             numFailures = 0;
+            bsls::Stopwatch timer;
+            timer.start();
+
+            for (int pass = 0; pass < NUM_PASSES; ++pass) {
+                numFailures += 0 != feedInChunks(&mX, INPUT, SIZE);
+            }
+
+            timer.stop();
+            ASSERTV(SIZE, numFailures, 0 == numFailures);
+
+            cout << "chunks of " << SIZE << " bytes: "
+                 << MEGABYTES / timer.elapsedTime() << " MB/s" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: No memory is ever allocated from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------------------------------------------------------
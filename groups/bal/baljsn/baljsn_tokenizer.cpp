@@ -5,12 +5,12 @@
 BSLS_IDENT_RCSID(baljsn_tokenizer_cpp,"$Id$ $CSID$")
 
 #include <baljsn_parserutil.h>                 // for testing only
+#include <baljsn_scanutil.h>
 
-#include <bdlb_chartype.h>
 #include <bdlde_utf8util.h>
 #include <bdlsb_fixedmemoutstreambuf.h>
 
-#include <bsl_cstring.h>
+#include <bsl_climits.h>
 #include <bsl_ios.h>
 
 // IMPLEMENTATION NOTES
@@ -55,13 +55,6 @@ BSLS_IDENT_RCSID(baljsn_tokenizer_cpp,"$Id$ $CSID$")
 //..
 
 namespace BloombergLP {
-namespace {
-
-    static const char *WHITESPACE = " \n\t\v\f\r";
-    static const char *TOKENS     = "{}[]:,";
-
-}  // close unnamed namespace
-
 namespace baljsn {
 
                               // ----------------
@@ -69,8 +62,47 @@ namespace baljsn {
                               // ----------------
 
 // PRIVATE MANIPULATORS
+int Tokenizer::loadContiguousInput()
+{
+    BSLS_ASSERT(d_input_p);
+
+    bsl::size_t numRead = 0;
+    if (0 == d_readStatus && 0 == d_bufEndStatus) {
+        const char *begin = d_input_p + d_readOffset;
+
+        numRead = d_inputLength - static_cast<bsl::size_t>(d_readOffset);
+
+        if (!d_allowNonUtf8StringLiterals) {
+            int         sts = 0;
+            const char *validEnd;
+            bdlde::Utf8Util::advanceIfValid(&sts,
+                                            &validEnd,
+                                            begin,
+                                            numRead,
+                                            numRead);
+            if (sts < 0) {
+                d_bufEndStatus = sts;
+                numRead        = validEnd - begin;
+            }
+        }
+    }
+
+    if (0 == d_readStatus && 0 == numRead) {
+        d_readStatus = 0 == d_bufEndStatus
+                     ? k_EOF
+                     : d_bufEndStatus;
+    }
+
+    d_readOffset += numRead;
+    return numRead > INT_MAX ? INT_MAX : static_cast<int>(numRead);
+}
+
 int Tokenizer::reloadStringBuffer()
 {
+    if (d_input_p) {
+        return loadContiguousInput();                                 // RETURN
+    }
+
     d_stringBuffer.resize(k_MAX_STRING_SIZE);
 
     bsl::size_t numRead;
@@ -113,6 +145,10 @@ int Tokenizer::reloadStringBuffer()
 
 int Tokenizer::expandBufferForLargeValue()
 {
+    if (d_input_p) {
+        return loadContiguousInput() ? 0 : -1;                        // RETURN
+    }
+
     const bsl::string::size_type currLength = d_stringBuffer.length();
     d_stringBuffer.resize(currLength + k_MAX_STRING_SIZE);
 
@@ -154,6 +190,10 @@ int Tokenizer::expandBufferForLargeValue()
 
 int Tokenizer::moveValueCharsToStartAndReloadBuffer()
 {
+    if (d_input_p) {
+        return loadContiguousInput();                                 // RETURN
+    }
+
     d_stringBuffer.erase(d_stringBuffer.begin(),
                          d_stringBuffer.begin() + d_valueBegin);
     d_stringBuffer.resize(k_MAX_STRING_SIZE);
@@ -201,64 +241,68 @@ int Tokenizer::moveValueCharsToStartAndReloadBuffer()
 
 int Tokenizer::extractStringValue()
 {
-    bool firstTime    = true;
-    char previousChar = 0;
+    bool firstTime = true;
+    bool escaped   = false;  // 'true' if the character at 'd_valueIter' is
+                             // preceded by an unescaped '\\'
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length()
-            && '"' != d_stringBuffer[d_valueIter]) {
+        const char        *begin  = data();
+        const bsl::size_t  length = dataLength();
 
-            if ('\\' == d_stringBuffer[d_valueIter]
-             && '\\' == previousChar) {
-                previousChar = 0;
+        while (d_valueIter < length) {
+            if (escaped) {
+                // An escaped character never ends the string.
+
+                escaped = false;
             }
             else {
-                previousChar = d_stringBuffer[d_valueIter];
+                d_valueIter = ScanUtil::findQuoteOrBackslash(
+                                                          begin + d_valueIter,
+                                                          begin + length)
+                            - begin;
+
+                if (d_valueIter == length) {
+                    break;
+                }
+
+                if ('"' == begin[d_valueIter]) {
+                    d_valueEnd = d_valueIter;
+                    return 0;                                         // RETURN
+                }
+
+                escaped = true;
             }
 
             ++d_valueIter;
         }
 
-        if (d_valueIter >= d_stringBuffer.length()) {
+        // There isn't enough room in the internal buffer to hold the value.
+        // If this is the first time through the loop, we move the current
+        // sequence of characters being processed to the front of the internal
+        // buffer, otherwise we must expand the internal buffer to hold
+        // additional characters.  If we are at the beginning of the string
+        // buffer then we dont need to move any characters and we simply
+        // expand the string buffer.
 
-            // There isn't enough room in the internal buffer to hold the
-            // value.  If this is the first time through the loop, we move the
-            // current sequence of characters being processed to the front of
-            // the internal buffer, otherwise we must expand the internal
-            // buffer to hold additional characters.  If we are at the
-            // beginning of the string buffer then we dont need to move any
-            // characters and we simply expand the string buffer.
+        if (0 == d_valueBegin) {
+            firstTime = false;
+        }
 
-            if (0 == d_valueBegin) {
-                firstTime = false;
+        if (firstTime) {
+            const int numRead = moveValueCharsToStartAndReloadBuffer();
+            if (0 == numRead) {
+                return -1;                                            // RETURN
             }
 
-            if (firstTime) {
-                const int numRead = moveValueCharsToStartAndReloadBuffer();
-                if (0 == numRead) {
-                    return -1;                                        // RETURN
-                }
-
-                firstTime = false;
-            }
-            else {
-                const int rc = expandBufferForLargeValue();
-                if (rc) {
-                    return rc;                                        // RETURN
-                }
-            }
+            firstTime = false;
         }
         else {
-            if ('\\' == previousChar) {
-                ++d_valueIter;
-                previousChar = 0;
-                continue;
+            const int rc = expandBufferForLargeValue();
+            if (rc) {
+                return rc;                                            // RETURN
             }
-            d_valueEnd = d_valueIter;
-            return 0;                                                 // RETURN
         }
     }
-    return 0;
 }
 
 int Tokenizer::skipNonWhitespaceOrTillToken()
@@ -266,38 +310,35 @@ int Tokenizer::skipNonWhitespaceOrTillToken()
     bool firstTime = true;
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length()
-            && !bdlb::CharType::isSpace(d_stringBuffer[d_valueIter])
-            && !bsl::strchr(TOKENS, d_stringBuffer[d_valueIter])) {
-            ++d_valueIter;
-        }
+        const char        *begin  = data();
+        const bsl::size_t  length = dataLength();
+
+        d_valueIter = ScanUtil::findValueDelimiter(begin + d_valueIter,
+                                                   begin + length)
+                    - begin;
 
-        if (d_valueIter >= d_stringBuffer.length()) {
+        if (d_valueIter >= length) {
 
             // There isn't enough room in the internal buffer to hold the
-            // value.  If this is the first time through the loop, we move the
+            // value.  If this is the first time through the loop, and the
+            // value does not already begin the internal buffer, we move the
             // current sequence of characters being processed to the front of
             // the internal buffer, otherwise we must expand the internal
-            // buffer to hold additional characters.
-
-            if (firstTime) {
-                const int numRead = moveValueCharsToStartAndReloadBuffer();
-                if (0 == numRead) {
-                    if (d_readStatus < 0) {
-                        return -1;                                    // RETURN
-                    }
-
-                    d_valueEnd = d_valueIter;
-                    return 0;                                         // RETURN
-                }
-                firstTime = false;
-            }
-            else {
-                const int rc = expandBufferForLargeValue();
-                if (rc) {
-                    return rc;                                        // RETURN
+            // buffer to hold additional characters.  In either case, the
+            // value ends at the end of the input if no more can be read.
+
+            const bool extended = firstTime && 0 != d_valueBegin
+                                ? 0 != moveValueCharsToStartAndReloadBuffer()
+                                : 0 == expandBufferForLargeValue();
+            if (!extended) {
+                if (d_readStatus < 0) {
+                    return -1;                                        // RETURN
                 }
+
+                d_valueEnd = d_valueIter;
+                return 0;                                             // RETURN
             }
+            firstTime = false;
         }
         else {
             d_valueEnd = d_valueIter;
@@ -310,10 +351,22 @@ int Tokenizer::skipNonWhitespaceOrTillToken()
 int Tokenizer::skipWhitespace()
 {
     while (true) {
-        bsl::size_t pos = d_stringBuffer.find_first_not_of(WHITESPACE,
-                                                           d_cursor);
-        if (bsl::string::npos != pos) {
-            d_cursor = pos;
+        const char        *begin  = data();
+        const bsl::size_t  length = dataLength();
+
+        // Tokens are most often not preceded by whitespace, and no character
+        // greater than ' ' is whitespace.
+
+        if (d_cursor < length
+         && ' ' < static_cast<unsigned char>(begin[d_cursor])) {
+            break;
+        }
+
+        d_cursor = ScanUtil::findNonWhitespace(begin + d_cursor,
+                                               begin + length)
+                 - begin;
+
+        if (d_cursor < length) {
             break;
         }
 
@@ -332,7 +385,7 @@ int Tokenizer::advanceToNextToken()
         return -1;                                                    // RETURN
     }
 
-    if (d_cursor >= d_stringBuffer.size()) {
+    if (d_cursor >= dataLength()) {
         const int numRead = reloadStringBuffer();
         if (0 == numRead) {
             d_tokenType = e_ERROR;
@@ -351,7 +404,7 @@ int Tokenizer::advanceToNextToken()
             return -1;                                                // RETURN
         }
 
-        switch (d_stringBuffer[d_cursor]) {
+        switch (data()[d_cursor]) {
           case '{': {
             if ((e_ELEMENT_NAME == d_tokenType && ':' == previousChar)
              || e_START_ARRAY   == d_tokenType
@@ -671,6 +724,8 @@ int Tokenizer::advanceToNextToken()
 
 int Tokenizer::resetStreamBufGetPointer()
 {
+    BSLS_ASSERT(!d_input_p);
+
     if (d_cursor >= d_stringBuffer.size()) {
         return 0;                                                     // RETURN
     }
@@ -693,8 +748,8 @@ int Tokenizer::value(bslstl::StringRef *data) const
 {
     if ((e_ELEMENT_NAME == d_tokenType || e_ELEMENT_VALUE == d_tokenType) &&
         d_valueBegin != d_valueEnd) {
-        data->assign(&d_stringBuffer[d_valueBegin],
-                     &d_stringBuffer[d_valueEnd]);
+        data->assign(this->data() + d_valueBegin,
+                     this->data() + d_valueEnd);
         return 0;                                                     // RETURN
     }
     return -1;
@@ -23,6 +23,16 @@ BSLS_IDENT("$Id: $")
 // package and in most cases clients should use the 'baljsn_decoder' component
 // instead of using this 'class'.
 //
+// Alternatively, the 'reset' overload taking a range of characters associates
+// a tokenizer with JSON data that is already in contiguous memory.  Such data
+// is tokenized in place: it is not copied into the internal buffer of the
+// tokenizer, and the string references returned by 'value' refer directly into
+// the supplied range.
+//
+// The tokenizer locates whitespace, structural characters, and the ends of
+// string literals using the vectorized searches of 'baljsn_scanutil', which
+// examine up to 32 characters at a time.
+//
 // On malformed JSON, tokenization may fail before the end of input is reached,
 // but not all such errors are detected.  In particular, callers should check
 // that closing brackets and braces match opening ones.
@@ -260,6 +270,12 @@ class Tokenizer {
     bool                d_allowNonUtf8StringLiterals;
                                             // Disables UTF-8 validation
 
+    const char         *d_input_p;          // contiguous input (held, not
+                                            // owned), or 0 if reading from
+                                            // '*d_streambuf_p'
+
+    bsl::size_t         d_inputLength;      // length of '*d_input_p'
+
     // PRIVATE MANIPULATORS
     int extractStringValue();
         // Extract the string value starting at the current data cursor and
@@ -267,6 +283,15 @@ class Tokenizer {
         // end of the extracted string.  Return 0 on success and a non-zero
         // value otherwise.
 
+    int loadContiguousInput();
+        // Make the characters of the contiguous input that have not yet been
+        // made available, and that are valid UTF-8 if UTF-8 checking is set,
+        // available for tokenizing in place.  Return the number of characters
+        // made available, or 'INT_MAX' if that number exceeds 'INT_MAX'.  The
+        // behavior is undefined unless this tokenizer reads contiguous input.
+        // Note that, as all of the valid input is made available on the first
+        // call, subsequent calls return 0 and set the read status.
+
     int moveValueCharsToStartAndReloadBuffer();
         // Move the current sequence of characters being tokenized to the front
         // of the internal string buffer, 'd_stringBuffer', and then append
@@ -313,6 +338,15 @@ class Tokenizer {
         // return the top context from the 'd_contextStack' stack without
         // popping.
 
+    const char *data() const;
+        // Return the address of the characters being tokenized: the
+        // contiguous input if this tokenizer reads contiguous input, and the
+        // internal string buffer otherwise.
+
+    bsl::size_t dataLength() const;
+        // Return the number of characters at 'data()' that are available for
+        // tokenizing.
+
   private:
     // NOT IMPLEMENTED
     Tokenizer(const Tokenizer&);
@@ -336,6 +370,16 @@ class Tokenizer {
         // change the value of the 'allowStandAloneValues',
         // 'allowHeterogenousArrays', or 'allowNonUtf8StringLiterals' options.
 
+    void reset(const char *begin, const char *end);
+        // Reset this tokenizer to read the JSON data in the specified range
+        // '[begin .. end)' in place.  Note that the reader will not be on a
+        // valid node until 'advanceToNextToken' is called.  The behavior is
+        // undefined unless '[begin .. end)' is a valid range that remains
+        // unmodified, and valid, until this tokenizer is reset or destroyed.
+        // Note that this function does not change the value of the
+        // 'allowStandAloneValues', 'allowHeterogenousArrays', or
+        // 'allowNonUtf8StringLiterals' options.
+
     int advanceToNextToken();
         // Move to the next token in the data steam.  Return 0 on success and a
         // non-zero value otherwise.  Each call to 'advanceToNextToken'
@@ -354,7 +398,9 @@ class Tokenizer {
         // from where this object stopped.  Also note that this call implies
         // the end of processing for this object and any subsequent methods
         // invoked on this object should only be done after calling 'reset' and
-        // specifying a new 'streambuf'.
+        // specifying a new 'streambuf'.  The behavior is undefined if this
+        // tokenizer reads contiguous input (see the 'reset' overload taking a
+        // range of characters).
 
     void setAllowHeterogenousArrays(bool value);
         // Set the 'allowHeterogenousArrays' option to the specified 'value'.
@@ -421,7 +467,9 @@ class Tokenizer {
         // Load into the specified 'data' the value of the specified token if
         // the current token's type is 'e_ELEMENT_NAME' or 'e_ELEMENT_VALUE' or
         // leave 'data' unmodified otherwise.  Return 0 on success and a
-        // non-zero value otherwise.
+        // non-zero value otherwise.  Note that if this tokenizer reads
+        // contiguous input, 'data' refers into that input and remains valid
+        // for as long as the input does.
 };
 
 // ============================================================================
@@ -457,6 +505,19 @@ Tokenizer::ContextType Tokenizer::context() const
                : static_cast<ContextType>(d_contextStack.back());
 }
 
+inline
+const char *Tokenizer::data() const
+{
+    return d_input_p ? d_input_p : d_stringBuffer.data();
+}
+
+inline
+bsl::size_t Tokenizer::dataLength() const
+{
+    return d_input_p ? static_cast<bsl::size_t>(d_readOffset)
+                     : d_stringBuffer.length();
+}
+
 // CREATORS
 inline
 Tokenizer::Tokenizer(bslma::Allocator *basicAllocator)
@@ -476,6 +537,8 @@ Tokenizer::Tokenizer(bslma::Allocator *basicAllocator)
 , d_allowStandAloneValues(true)
 , d_allowHeterogenousArrays(true)
 , d_allowNonUtf8StringLiterals(true)
+, d_input_p(0)
+, d_inputLength(0)
 {
     d_stringBuffer.reserve(k_MAX_STRING_SIZE);
     d_contextStack.clear();
@@ -501,11 +564,25 @@ void Tokenizer::reset(bsl::streambuf *streambuf)
     d_tokenType    = e_BEGIN;
     d_readStatus   = 0;
     d_bufEndStatus = 0;
+    d_input_p      = 0;
+    d_inputLength  = 0;
 
     d_contextStack.clear();
     pushContext(e_OBJECT_CONTEXT);
 }
 
+inline
+void Tokenizer::reset(const char *begin, const char *end)
+{
+    BSLS_ASSERT(begin || begin == end);
+    BSLS_ASSERT(begin <= end);
+
+    reset(static_cast<bsl::streambuf *>(0));
+
+    d_input_p     = begin ? begin : "";
+    d_inputLength = end - begin;
+}
+
 inline
 void Tokenizer::setAllowStandAloneValues(bool value)
 {
@@ -2,6 +2,7 @@
 #include <baljsn_tokenizer.h>
 
 #include <baljsn_parserutil.h>
+#include <baljsn_scanutil.h>
 
 #include <bdlde_utf8util.h>
 #include <bdlsb_memoutstreambuf.h>            // for testing only
@@ -13,6 +14,9 @@
 #include <bslma_defaultallocatorguard.h>
 #include <bslma_testallocator.h>
 
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_cfloat.h>
 #include <bsl_climits.h>
@@ -50,6 +54,7 @@ using bsl::endl;
 //
 // MANIPULATORS
 // [ 9] void reset(bsl::streambuf &streamBuf);
+// [18] void reset(const char *begin, const char *end);
 // [12] void resetStreamBufGetPointer();
 // [13] void setAllowStandAloneValues(bool value);
 // [14] void setAllowHeterogenousArrays(bool value);
@@ -66,7 +71,9 @@ using bsl::endl;
 // [17] bool allowNonUtf8StringLiterals() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [18] USAGE EXAMPLE
+// [19] CONCERN: SCANNING IS INDEPENDENT OF THE INSTRUCTION SET
+// [20] USAGE EXAMPLE
+// [-1] PERFORMANCE: TOKENIZING THROUGHPUT
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -112,6 +119,13 @@ void aSsErT(bool condition, const char *message, int line)
 #define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
 #define L_           BSLIM_TESTUTIL_L_  // current Line number
 
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
 #define WS "   \t       \n      \v       \f       \r       "
 
 // ============================================================================
@@ -471,6 +485,152 @@ static const struct Utf8Data {
 };
 enum { k_NUM_UTF8_DATA = sizeof UTF8_DATA / sizeof *UTF8_DATA };
 
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+typedef baljsn::ScanUtil ScanUtil;
+
+const ScanUtil::InstructionSet INSTRUCTION_SETS[] = {
+    ScanUtil::e_SCALAR,
+    ScanUtil::e_SSE2,
+    ScanUtil::e_AVX2
+};
+const int NUM_INSTRUCTION_SETS = sizeof  INSTRUCTION_SETS
+                               / sizeof *INSTRUCTION_SETS;
+
+bsl::string describeTokens(Obj *tokenizer)
+    // Advance the specified 'tokenizer' through the remainder of its input and
+    // return a description of the tokens encountered: '{', '}', '[', and ']'
+    // for the start and end of objects and arrays, 'N(...)' and 'V(...)' for
+    // element names and values (showing the value), each followed by a space,
+    // and a final '!' if tokenization stopped for any reason other than the
+    // end of input.
+{
+    bsl::string result;
+
+    while (0 == tokenizer->advanceToNextToken()) {
+        bslstl::StringRef value;
+
+        switch (tokenizer->tokenType()) {
+          case Obj::e_START_OBJECT: result += '{'; break;
+          case Obj::e_END_OBJECT:   result += '}'; break;
+          case Obj::e_START_ARRAY:  result += '['; break;
+          case Obj::e_END_ARRAY:    result += ']'; break;
+          case Obj::e_ELEMENT_NAME: {
+            ASSERT(0 == tokenizer->value(&value));
+            result += "N(";
+            result.append(value.data(), value.length());
+            result += ')';
+          } break;
+          case Obj::e_ELEMENT_VALUE: {
+            ASSERT(0 == tokenizer->value(&value));
+            result += "V(";
+            result.append(value.data(), value.length());
+            result += ')';
+          } break;
+          default: {
+            result += '?';
+          }
+        }
+        result += ' ';
+    }
+
+    if (Obj::k_EOF != tokenizer->readStatus()) {
+        result += '!';
+    }
+    return result;
+}
+
+bool valuesReferInto(Obj *tokenizer, const char *begin, const char *end)
+    // Advance the specified 'tokenizer' through the remainder of its input and
+    // return 'true' if the value of every element name and element value
+    // refers into the specified range '[begin .. end)', and 'false'
+    // otherwise.
+{
+    bool result = true;
+
+    while (0 == tokenizer->advanceToNextToken()) {
+        bslstl::StringRef value;
+
+        if (0 == tokenizer->value(&value)) {
+            result = result
+                  && begin <= value.data()
+                  && value.data() + value.length() <= end;
+        }
+    }
+    return result;
+}
+
+void generateRecords(bsl::string *result, bsl::size_t size, bool pretty)
+    // Load into the specified 'result' a JSON array of at least the specified
+    // 'size' bytes whose elements are objects of a few fields of each type,
+    // with indentation and line breaks if the specified 'pretty' is 'true',
+    // and without any whitespace otherwise.
+{
+    const char *NL   = pretty ? "\n" : "";
+    const char *IND  = pretty ? "        " : "";
+    const char *SEP  = pretty ? ": " : ":";
+
+    result->assign("[");
+    for (int i = 0; result->size() < size; ++i) {
+        bsl::ostringstream os;
+        os << (i ? "," : "") << NL << (pretty ? "    " : "") << "{" << NL
+           << IND << "\"id\""       << SEP << 100000 + i         << "," << NL
+           << IND << "\"ticker\""   << SEP << "\"TCK" << i % 997 << " US "
+                                           << "Equity\""         << "," << NL
+           << IND << "\"price\""    << SEP << i % 5000 << ".25"  << "," << NL
+           << IND << "\"active\""   << SEP << (i % 3 ? "true" : "false")
+                                                                 << "," << NL
+           << IND << "\"venues\""   << SEP << "[\"XNYS\",\"XNAS\"]"
+                                                                 << "," << NL
+           << IND << "\"comment\""  << SEP << "\"Quote \\\"" << i
+                                           << "\\\" was updated\"" << NL
+           << (pretty ? "    " : "") << "}";
+        *result += os.str();
+    }
+    *result += NL;
+    *result += "]";
+}
+
+void generateStrings(bsl::string *result, bsl::size_t size)
+    // Load into the specified 'result' a JSON array of at least the specified
+    // 'size' bytes whose elements are string literals of a few hundred
+    // characters containing occasional escape sequences.
+{
+    result->assign("[");
+    for (int i = 0; result->size() < size; ++i) {
+        if (i) {
+            *result += ',';
+        }
+        *result += '"';
+        for (int j = 0; j < 8; ++j) {
+            *result += "The quick brown fox jumps over the lazy dog";
+        }
+        *result += (i % 4 ? "\\n" : "\\u00e9");
+        *result += '"';
+    }
+    *result += "]";
+}
+
+void generateNumbers(bsl::string *result, bsl::size_t size)
+    // Load into the specified 'result' a JSON array of at least the specified
+    // 'size' bytes whose elements are numbers.
+{
+    result->assign("[");
+    for (int i = 0; result->size() < size; ++i) {
+        bsl::ostringstream os;
+        os << (i ? "," : "") << (i * 7919) % 1000003 << '.' << i % 1000
+           << "e-" << i % 10;
+        *result += os.str();
+    }
+    *result += "]";
+}
+
+}  // close unnamed namespace
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -489,7 +649,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 18: {
+      case 20: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -611,6 +771,325 @@ int main(int argc, char *argv[])
     ASSERT(10022           == address.d_zipcode);
 //..
       } break;
+      case 19: {
+        // --------------------------------------------------------------------
+        // CONCERN: SCANNING IS INDEPENDENT OF THE INSTRUCTION SET
+        //
+        // Concerns:
+        //: 1 Tokens are found identically whichever instruction set is used
+        //:   by 'baljsn::ScanUtil'.
+        //:
+        //: 2 A string literal, number, or run of whitespace that straddles
+        //:   the boundary between two reads from the 'streambuf' (or several
+        //:   such boundaries) is tokenized correctly.
+        //:
+        //: 3 An escape sequence split by such a boundary (e.g., a '\\' that is
+        //:   the last character read) is honored.
+        //:
+        //: 4 A number longer than a read, including one that begins a read
+        //:   or ends the input, is tokenized whole.
+        //
+        // Plan:
+        //: 1 Generate documents in which string literals containing escaped
+        //:   quotes and backslashes end at every offset around the first and
+        //:   second read boundaries, and documents in which a number and a
+        //:   run of whitespace do so, and documents holding numbers longer
+        //:   than a read, nested and at the top level.  (C-2..4)
+        //:
+        //: 2 For each supported instruction set, tokenize each document from
+        //:   a 'streambuf' and in place, and verify that the tokens are as
+        //:   expected.  (C-1..4)
+        //
+        // Testing:
+        //   CONCERN: SCANNING IS INDEPENDENT OF THE INSTRUCTION SET
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+              << "CONCERN: SCANNING IS INDEPENDENT OF THE INSTRUCTION SET"
+              << endl
+              << "======================================================="
+              << endl;
+
+        const char        PATTERN[]  = "abc\\\"d\\\\e";  // 'abc\"d\\e'
+        const bsl::size_t PATTERN_LEN = sizeof PATTERN - 1;
+        const bsl::size_t BOUNDARIES[] = { 8191, 16382, 24573 };
+        const int         NUM_BOUNDARIES = sizeof  BOUNDARIES
+                                         / sizeof *BOUNDARIES;
+
+        bsl::vector<bsl::string> documents;
+        bsl::vector<bsl::string> expected;
+
+        for (int bi = 0; bi < NUM_BOUNDARIES; ++bi) {
+            const bsl::size_t BOUNDARY = BOUNDARIES[bi];
+
+            for (bsl::size_t pad = 0; pad < PATTERN_LEN + 2; ++pad) {
+                const bsl::size_t REPEAT = (BOUNDARY - pad) / PATTERN_LEN;
+
+                for (bsl::size_t r = REPEAT - 1; r <= REPEAT + 1; ++r) {
+                    bsl::string content;
+                    for (bsl::size_t i = 0; i < r; ++i) {
+                        content += PATTERN;
+                    }
+
+                    documents.push_back(bsl::string(pad, ' ')
+                                        + "[\"" + content + "\",\t-12.5e3 ]");
+                    expected.push_back("[ V(\"" + content
+                                       + "\") V(-12.5e3) ] ");
+                }
+            }
+
+            for (bsl::size_t pad = BOUNDARY - 12; pad < BOUNDARY + 4; ++pad) {
+                documents.push_back("[" + bsl::string(pad, ' ')
+                                    + "1234567890, \r\n true]");
+                expected.push_back("[ V(1234567890) V(true) ] ");
+
+                documents.push_back("{\"" + bsl::string(pad, 'k') + "\":"
+                                    + bsl::string(pad % 7, '\n') + "0}");
+                expected.push_back("{ N(" + bsl::string(pad, 'k')
+                                   + ") V(0) } ");
+            }
+
+            for (bsl::size_t len = BOUNDARY - 1; len <= BOUNDARY + 1; ++len) {
+                const bsl::string NUMBER(len, '7');
+
+                documents.push_back("[" + bsl::string(BOUNDARY - 1, ' ')
+                                    + NUMBER + "]");
+                expected.push_back("[ V(" + NUMBER + ") ] ");
+
+                documents.push_back(NUMBER);
+                expected.push_back("V(" + NUMBER + ") ");
+            }
+        }
+
+        const ScanUtil::InstructionSet saved = ScanUtil::instructionSet();
+
+        for (int ti = 0; ti < NUM_INSTRUCTION_SETS; ++ti) {
+            const ScanUtil::InstructionSet INSTRUCTION_SET =
+                                                          INSTRUCTION_SETS[ti];
+
+            if (!ScanUtil::isSupported(INSTRUCTION_SET)) {
+                continue;
+            }
+            if (verbose) { P(INSTRUCTION_SET) }
+
+            ScanUtil::setInstructionSet(INSTRUCTION_SET);
+
+            for (bsl::size_t di = 0; di < documents.size(); ++di) {
+                const bsl::string& DOC = documents[di];
+                const bsl::string& EXP = expected[di];
+
+                bslma::TestAllocator oa("object", veryVeryVerbose);
+
+                Obj mX(&oa);
+
+                bdlsb::FixedMemInStreamBuf isb(DOC.data(), DOC.length());
+                mX.reset(&isb);
+                ASSERTV(INSTRUCTION_SET, di, DOC.length(),
+                        EXP == describeTokens(&mX));
+
+                mX.reset(DOC.data(), DOC.data() + DOC.length());
+                ASSERTV(INSTRUCTION_SET, di, DOC.length(),
+                        EXP == describeTokens(&mX));
+            }
+        }
+
+        ScanUtil::setInstructionSet(saved);
+      } break;
+      case 18: {
+        // --------------------------------------------------------------------
+        // TESTING 'reset' FROM CONTIGUOUS INPUT
+        //
+        // Concerns:
+        //: 1 A tokenizer reset to a range of characters produces the same
+        //:   tokens, values, and errors as one reset to a 'streambuf' holding
+        //:   the same characters.
+        //:
+        //: 2 The values of element names and element values refer into the
+        //:   supplied range, and no memory is allocated.
+        //:
+        //: 3 Invalid UTF-8 is reported with the same status and offset as
+        //:   when reading from a 'streambuf', if UTF-8 checking is enabled.
+        //:
+        //: 4 An empty range, including one represented by two null pointers,
+        //:   is tokenized as an empty document.
+        //:
+        //: 5 A tokenizer can be reset from contiguous input to a 'streambuf',
+        //:   and vice versa.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a table of valid and invalid documents, tokenize each one
+        //:   from a 'streambuf' and in place, and verify that both produce
+        //:   the expected tokens.  Reuse the same object for both, in
+        //:   alternating order.  (C-1, 5)
+        //:
+        //: 2 Tokenize each document in place using an object created with a
+        //:   test allocator, and verify that every value refers into the
+        //:   document and that no memory is allocated by the object after
+        //:   construction.  (C-2)
+        //:
+        //: 3 For each invalid sequence in 'UTF8_DATA', tokenize a string
+        //:   literal containing it in both ways, with UTF-8 checking enabled,
+        //:   and compare 'readStatus' and 'readOffset'.  (C-3)
+        //:
+        //: 4 Tokenize empty ranges.  (C-4)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid ranges and for 'resetStreamBufGetPointer'
+        //:   on contiguous input (using the 'BSLS_ASSERTTEST_*' macros).
+        //:   (C-6)
+        //
+        // Testing:
+        //   void reset(const char *begin, const char *end);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'reset' FROM CONTIGUOUS INPUT" << endl
+                          << "=====================================" << endl;
+
+        static const struct {
+            int         d_line;      // source line number
+            const char *d_input_p;   // JSON document
+            const char *d_exp_p;     // expected result of 'describeTokens'
+        } DATA[] = {
+            //LINE  INPUT                      EXPECTED
+            //----  -----                      --------
+            { L_,   "",                        ""                           },
+            { L_,   "  \n ",                   ""                           },
+            { L_,   "{}",                      "{ } "                       },
+            { L_,   "[]",                      "[ ] "                       },
+            { L_,   " {\"a\":1} ",             "{ N(a) V(1) } "             },
+            { L_,   "\"text\"",                "V(\"text\") "               },
+            { L_,   "-0.5e-3",                 "V(-0.5e-3) "                },
+            { L_,   "[1,-2.5e3,true,null]",    "[ V(1) V(-2.5e3) V(true) "
+                                               "V(null) ] "                 },
+            { L_,   "{\"a\\\"b\":\"c\\\\\"}",  "{ N(a\\\"b) V(\"c\\\\\") } "},
+            { L_,   "{\"\\\\\":\"\\\\\\\"\"}", "{ N(\\\\) V(\"\\\\\\\"\") } "},
+            { L_,   "[[],{},[{\"k\":[]}]]",    "[ [ ] { } [ { N(k) [ ] } ] "
+                                               "] "                         },
+            { L_,   " \t\n\v\f\r{ \"x\"\r\n:\t-0 } ",
+                                               "{ N(x) V(-0) } "            },
+            { L_,   "{\"a\":[\"x\" , \"y\"]}", "{ N(a) [ V(\"x\") V(\"y\") ] "
+                                               "} "                         },
+            { L_,   "{\"a\" 1}",               "{ N(a) !"                   },
+            { L_,   "{,}",                     "{ !"                        },
+            { L_,   "[1 2]",                   "[ V(1) !"                   },
+            { L_,   "{\"abc",                  "{ "                         },
+            { L_,   "[\"abc\\",                "[ "                         },
+            { L_,   "[1",                      "[ V(1) "                    },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int          LINE  = DATA[ti].d_line;
+            const char        *INPUT = DATA[ti].d_input_p;
+            const char        *EXP   = DATA[ti].d_exp_p;
+            const bsl::size_t  LEN   = bsl::strlen(INPUT);
+
+            if (veryVerbose) { P_(LINE) P(INPUT) }
+
+            bdlsb::FixedMemInStreamBuf isb(INPUT, LEN);
+
+            for (int order = 0; order < 2; ++order) {
+                if (order) {
+                    mX.reset(INPUT, INPUT + LEN);
+                }
+                else {
+                    isb.pubseekpos(0);
+                    mX.reset(&isb);
+                }
+                const bsl::string result = describeTokens(&mX);
+                ASSERTV(LINE, order, result, EXP == result);
+
+                if (!order) {
+                    // Verify the offsets recorded by the two modes agree.
+
+                    const Uint64 OFFSET = X.readOffset();
+
+                    mX.reset(INPUT, INPUT + LEN);
+                    describeTokens(&mX);
+                    ASSERTV(LINE, OFFSET, X.readOffset(),
+                            OFFSET == X.readOffset());
+                }
+            }
+
+            const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+
+            mX.reset(INPUT, INPUT + LEN);
+            ASSERTV(LINE, valuesReferInto(&mX, INPUT, INPUT + LEN));
+            ASSERTV(LINE, NUM_BLOCKS == oa.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\nTesting UTF-8 checking." << endl;
+
+        for (int ti = 0; ti < k_NUM_UTF8_DATA; ++ti) {
+            const Utf8Data&  data   = UTF8_DATA[ti];
+            const int        LINE   = data.d_lineNum;
+            const int        STATUS = data.d_status;
+
+            for (int quoted = 0; quoted < 2; ++quoted) {
+                bsl::string str = "[\"";
+                str += data.d_utf8_p;
+                if (quoted) {
+                    str += "\"]";
+                }
+
+                bdlsb::FixedMemInStreamBuf isb(str.data(), str.length());
+
+                Obj mA;  const Obj& A = mA;
+                mA.reset(&isb);
+                mA.setAllowNonUtf8StringLiterals(false);
+
+                Obj mB;  const Obj& B = mB;
+                mB.reset(str.data(), str.data() + str.length());
+                mB.setAllowNonUtf8StringLiterals(false);
+
+                const bsl::string EXP    = describeTokens(&mA);
+                const bsl::string result = describeTokens(&mB);
+
+                ASSERTV(LINE, quoted, EXP, result, EXP == result);
+                ASSERTV(LINE, quoted, A.readStatus(), B.readStatus(),
+                        A.readStatus() == B.readStatus());
+                ASSERTV(LINE, quoted, A.readOffset(), B.readOffset(),
+                        A.readOffset() == B.readOffset());
+                if (STATUS < 0) {
+                    ASSERTV(LINE, quoted, B.readStatus(), 0 > B.readStatus());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting empty ranges." << endl;
+        {
+            const char *INPUT = "[1]";
+
+            mX.reset(INPUT, INPUT);
+            ASSERT(0 != mX.advanceToNextToken());
+            ASSERT(Obj::k_EOF == X.readStatus());
+
+            mX.reset(0, 0);
+            ASSERT(0 != mX.advanceToNextToken());
+            ASSERT(Obj::k_EOF == X.readStatus());
+            ASSERT(0 == X.readOffset());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const char *INPUT = "[1]";
+
+            ASSERT_PASS(mX.reset(INPUT, INPUT + 3));
+            ASSERT_FAIL(mX.resetStreamBufGetPointer());
+            ASSERT_FAIL(mX.reset(INPUT + 3, INPUT));
+            ASSERT_FAIL(mX.reset(0, INPUT));
+            ASSERT_PASS(mX.reset(0, 0));
+        }
+      } break;
       case 17: {
         // --------------------------------------------------------------------
         // TESTING UTF8
@@ -7268,6 +7747,98 @@ int main(int argc, char *argv[])
         Obj mX;  const Obj& X = mX;
         ASSERTV(X.tokenType(), Obj::e_BEGIN == X.tokenType());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: TOKENIZING THROUGHPUT
+        //
+        // Concerns:
+        //: 1 Report the throughput of tokenizing representative payloads, for
+        //:   each supported instruction set, from a 'streambuf' and in place.
+        //
+        // Plan:
+        //: 1 Generate payloads of about 4MB: compact records of mixed types,
+        //:   the same records pretty-printed, long string literals, and
+        //:   numbers.  Tokenize each payload repeatedly in each configuration
+        //:   and report the throughput in MB/s.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: TOKENIZING THROUGHPUT
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: TOKENIZING THROUGHPUT" << endl
+             << "==================================" << endl;
+
+        const bsl::size_t SIZE = 4 << 20;
+        const int         REPS = 20;
+
+        struct Payload {
+            const char  *d_name_p;
+            bsl::string  d_json;
+        } payloads[4];
+
+        payloads[0].d_name_p = "records";
+        generateRecords(&payloads[0].d_json, SIZE, false);
+        payloads[1].d_name_p = "pretty records";
+        generateRecords(&payloads[1].d_json, SIZE, true);
+        payloads[2].d_name_p = "strings";
+        generateStrings(&payloads[2].d_json, SIZE);
+        payloads[3].d_name_p = "numbers";
+        generateNumbers(&payloads[3].d_json, SIZE);
+
+        const char *NAMES[] = { "scalar", "SSE2", "AVX2" };
+
+        const ScanUtil::InstructionSet saved = ScanUtil::instructionSet();
+
+        for (int pi = 0; pi < 4; ++pi) {
+            const bsl::string& JSON = payloads[pi].d_json;
+
+            cout << payloads[pi].d_name_p << " (" << JSON.length()
+                 << " bytes), MB/s:" << endl;
+
+            for (int ti = 0; ti < NUM_INSTRUCTION_SETS; ++ti) {
+                if (!ScanUtil::isSupported(INSTRUCTION_SETS[ti])) {
+                    continue;
+                }
+                ScanUtil::setInstructionSet(INSTRUCTION_SETS[ti]);
+
+                for (int inPlace = 0; inPlace < 2; ++inPlace) {
+                    Obj            mX;
+                    bsls::Stopwatch timer;
+                    int            numTokens = 0;
+
+                    timer.start(true);
+                    for (int rep = 0; rep < REPS; ++rep) {
+                        bdlsb::FixedMemInStreamBuf isb(JSON.data(),
+                                                       JSON.length());
+                        if (inPlace) {
+                            mX.reset(JSON.data(),
+                                     JSON.data() + JSON.length());
+                        }
+                        else {
+                            mX.reset(&isb);
+                        }
+                        while (0 == mX.advanceToNextToken()) {
+                            ++numTokens;
+                        }
+                        ASSERT(Obj::k_EOF == mX.readStatus());
+                    }
+                    timer.stop();
+
+                    const double MB = static_cast<double>(JSON.length())
+                                    * REPS / (1 << 20);
+
+                    cout << "    " << NAMES[ti]
+                         << (inPlace ? " in place:  " : " streambuf: ")
+                         << MB / timer.accumulatedWallTime()
+                         << "    (" << numTokens / REPS << " tokens)"
+                         << endl;
+                }
+            }
+        }
+
+        ScanUtil::setInstructionSet(saved);
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -14,6 +14,8 @@ BSLS_IDENT_RCSID(ball_asyncfileobserver_cpp,"$Id$ $CSID$")
 #include <bdls_processutil.h>
 #include <bdlt_currenttime.h>
 
+#include <bslma_autodestructor.h>
+#include <bslma_deallocatorproctor.h>
 #include <bslma_default.h>
 #include <bslmt_lockguard.h>
 #include <bslmt_threadattributes.h>
@@ -34,6 +36,19 @@ BSLS_IDENT_RCSID(ball_asyncfileobserver_cpp,"$Id$ $CSID$")
 // thread is restarted, 'shutdownThread' clears the queue in order to simplify
 // the implementation.  Alternative designs are possible, but are not perceived
 // to be worth the added complexity.
+//
+// In 'e_COPY_RECORDS' mode the same protocol is followed using the
+// 'AsyncFileObserver_RecordRing'.  The ring is driven by two
+// 'bslmt::FastPostSemaphore' objects: 'd_freeSlots' counts the slots a
+// producer may reserve, and 'd_fullSlots' counts the filled slots the consumer
+// may acquire.  Because a producer holds a 'd_freeSlots' token before
+// incrementing 'd_pushIndex', and tokens are returned only after the consumer
+// has finished with a slot, the slot selected by 'd_pushIndex' is never in use
+// by the consumer.  Producers may, however, complete out of order, so the
+// consumer waits on the per-slot state of the slot at the front of the ring
+// rather than relying on 'd_fullSlots' alone.  The publication thread returns
+// each batch of slots with a single 'post', and, on seeing the 'e_END' entry,
+// returns any records acquired after it so that they remain queued.
 
 namespace BloombergLP {
 namespace ball {
@@ -42,7 +57,9 @@ namespace {
 
 enum {
     k_DEFAULT_FIXED_QUEUE_SIZE = 8192,
-    k_FORCE_WARN_THRESHOLD     = 5000
+    k_FORCE_WARN_THRESHOLD     = 5000,
+    k_MAX_RING_BATCH_SIZE      = 64    // maximum number of records published
+                                       // per batch in 'e_COPY_RECORDS' mode
 };
 
 static const char *const k_LOG_CATEGORY = "BALL.ASYNCFILEOBSERVER";
@@ -63,6 +80,116 @@ static void populateWarnRecord(ball::Record *record,
 
 }  // close unnamed namespace
 
+                    // ----------------------------------
+                    // class AsyncFileObserver_RecordRing
+                    // ----------------------------------
+
+// CREATORS
+AsyncFileObserver_RecordRing::Slot::Slot(bslma::Allocator *basicAllocator)
+: d_state(e_EMPTY)
+, d_record(basicAllocator)
+, d_context()
+{
+}
+
+// PRIVATE MANIPULATORS
+void AsyncFileObserver_RecordRing::fillSlot(const Record  *record,
+                                            const Context& context)
+{
+    const bsls::Types::Uint64 index = d_pushIndex.addAcqRel(1) - 1;
+
+    Slot& slot = d_slots_p[index % d_capacity];
+
+    BSLS_ASSERT(e_EMPTY == slot.d_state.loadAcquire());
+
+    if (record) {
+        slot.d_record = *record;
+    }
+    slot.d_context = context;
+
+    slot.d_state.storeRelease(e_FULL);
+    d_fullSlots.post();
+}
+
+// CREATORS
+AsyncFileObserver_RecordRing::AsyncFileObserver_RecordRing(
+                                              int               capacity,
+                                              bslma::Allocator *basicAllocator)
+: d_freeSlots(capacity)
+, d_pushIndex(0)
+, d_fullSlots(0)
+, d_popIndex(0)
+, d_slots_p(0)
+, d_capacity(capacity)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 <= capacity);
+
+    if (0 == capacity) {
+        return;                                                       // RETURN
+    }
+
+    d_slots_p = static_cast<Slot *>(
+                           d_allocator_p->allocate(capacity * sizeof(Slot)));
+
+    bslma::DeallocatorProctor<bslma::Allocator> deallocatorProctor(
+                                                                d_slots_p,
+                                                                d_allocator_p);
+    bslma::AutoDestructor<Slot> destructorGuard(d_slots_p, 0);
+
+    for (int i = 0; i < capacity; ++i) {
+        new (d_slots_p + i) Slot(d_allocator_p);
+        ++destructorGuard;
+    }
+
+    destructorGuard.release();
+    deallocatorProctor.release();
+}
+
+AsyncFileObserver_RecordRing::~AsyncFileObserver_RecordRing()
+{
+    for (int i = 0; i < d_capacity; ++i) {
+        d_slots_p[i].~Slot();
+    }
+    if (d_slots_p) {
+        d_allocator_p->deallocate(d_slots_p);
+    }
+}
+
+// MANIPULATORS
+int AsyncFileObserver_RecordRing::acquireRecords(int maxNumRecords)
+{
+    BSLS_ASSERT(0 < maxNumRecords);
+
+    d_fullSlots.wait();
+
+    return 1 + (1 < maxNumRecords ? d_fullSlots.take(maxNumRecords - 1) : 0);
+}
+
+void AsyncFileObserver_RecordRing::pushBack(const Context& context)
+{
+    d_freeSlots.wait();
+    fillSlot(0, context);
+}
+
+void AsyncFileObserver_RecordRing::pushBack(const Record&  record,
+                                            const Context& context)
+{
+    d_freeSlots.wait();
+    fillSlot(&record, context);
+}
+
+void AsyncFileObserver_RecordRing::removeAll()
+{
+    const int numRecords = d_fullSlots.takeAll();
+
+    for (int i = 0; i < numRecords; ++i) {
+        frontSlot();
+        popFront();
+    }
+    releaseSlots(numRecords);
+}
+
                        // -----------------------
                        // class AsyncFileObserver
                        // -----------------------
@@ -79,12 +206,84 @@ void AsyncFileObserver::logDroppedMessageWarning(int numDropped)
     d_fileObserver.publish(d_droppedRecordWarning, context);
 }
 
+void AsyncFileObserver::publishDroppedCountIfNeeded(int queueLength,
+                                                    int queueCapacity)
+{
+    // Publish the count of dropped records.  To avoid repeatedly publishing
+    // this information when the record queue is full, we publish the number
+    // of dropped records only when the queue becomes half empty or when a
+    // sufficient number of records have been dropped.  Finally, we publish the
+    // dropped record count if the observer is shutting down, so the
+    // information is not lost.
+
+    if (0 < d_dropCount.loadRelaxed()) {
+        if (queueLength <= queueCapacity / 2
+        ||  d_dropCount.loadRelaxed() >= k_FORCE_WARN_THRESHOLD
+        ||  d_shuttingDownFlag) {
+            int numDropped = d_dropCount.swap(0);
+            BSLS_ASSERT(0 < numDropped); // No other thread should have
+                                         // cleared the count.
+            logDroppedMessageWarning(numDropped);
+        }
+    }
+}
+
+void AsyncFileObserver::publishRingThreadEntryPoint()
+{
+    bool done = false;
+
+    while (!done) {
+        const int numRecords = d_recordRing.acquireRecords(
+                                                        k_MAX_RING_BATCH_SIZE);
+
+        // Gather the records preceding any 'e_END' entry, and publish them
+        // only if the observer is not shutting down.  The popped slots, and
+        // so the gathered records, are not reused before 'releaseSlots'.
+
+        const Record *batch[k_MAX_RING_BATCH_SIZE];
+        int           batchSize = 0;
+        int           numPopped = 0;
+
+        while (!done && numPopped < numRecords) {
+            const Context& context = d_recordRing.frontContext();
+
+            if (Transmission::e_END == context.transmissionCause()
+                || d_shuttingDownFlag) {
+                done = true;
+            }
+            else {
+                batch[batchSize++] = &d_recordRing.frontRecord();
+            }
+            d_recordRing.popFront();
+            ++numPopped;
+        }
+
+        if (0 < batchSize && !d_shuttingDownFlag) {
+            d_fileObserver.publishBatch(batch, batchSize);
+        }
+
+        // Records acquired after the 'e_END' entry remain on the ring for a
+        // subsequently started publication thread.
+
+        d_recordRing.returnRecords(numRecords - numPopped);
+        d_recordRing.releaseSlots(numPopped);
+
+        publishDroppedCountIfNeeded(d_recordRing.length(),
+                                    d_recordRing.capacity());
+    }
+}
+
 void AsyncFileObserver::publishThreadEntryPoint()
 {
     bool done = false;
     d_droppedRecordWarning.fixedFields().setThreadID(
                                           bslmt::ThreadUtil::selfIdAsUint64());
 
+    if (e_COPY_RECORDS == d_recordQueueMode) {
+        publishRingThreadEntryPoint();
+        return;                                                       // RETURN
+    }
+
     while (!done) {
         AsyncFileObserver_Record asyncRecord = d_recordQueue.popFront();
 
@@ -100,23 +299,9 @@ void AsyncFileObserver::publishThreadEntryPoint()
                                    asyncRecord.d_context);
         }
 
-        // Publish the count of dropped records.  To avoid repeatedly
-        // publishing this information when the record queue is full, we
-        // publish the number of dropped records only when the queue becomes
-        // half empty or when a sufficient number of records have been dropped.
-        // Finally, we publish the dropped record count if the observer is
-        // shutting down, so the information is not lost.
-
-        if (0 < d_dropCount.loadRelaxed()) {
-            if (d_recordQueue.length() <= d_recordQueue.size() / 2
-            ||  d_dropCount.loadRelaxed() >= k_FORCE_WARN_THRESHOLD
-            ||  d_shuttingDownFlag) {
-                int numDropped = d_dropCount.swap(0);
-                BSLS_ASSERT(0 < numDropped); // No other thread should have
-                                             // cleared the count.
-                logDroppedMessageWarning(numDropped);
-            }
-        }
+        publishDroppedCountIfNeeded(
+                                 d_recordQueue.length(),
+                                 static_cast<int>(d_recordQueue.size()));
     }
 }
 
@@ -134,6 +319,16 @@ int AsyncFileObserver::startThread()
 int AsyncFileObserver::stopThread()
 {
     if (bslmt::ThreadUtil::invalidHandle() != d_threadHandle) {
+        Context context(Transmission::e_END, 0, 1);
+
+        if (e_COPY_RECORDS == d_recordQueueMode) {
+            d_recordRing.pushBack(context);
+
+            int ret = bslmt::ThreadUtil::join(d_threadHandle);
+            d_threadHandle = bslmt::ThreadUtil::invalidHandle();
+            return ret;                                               // RETURN
+        }
+
         // Push an empty record with 'e_END' set in context.
 
         AsyncFileObserver_Record asyncRecord;
@@ -141,7 +336,6 @@ int AsyncFileObserver::stopThread()
                                     new (*d_allocator_p) Record(d_allocator_p),
                                     d_allocator_p);
 
-        Context context(Transmission::e_END, 0, 1);
         asyncRecord.d_record  = record;
         asyncRecord.d_context = context;
         d_recordQueue.pushBack(asyncRecord);
@@ -166,7 +360,12 @@ int AsyncFileObserver::shutdownThread()
     // We clear the queue to remove the bogus log record appended by
     // 'stopThread'.
 
-    d_recordQueue.removeAll();
+    if (e_COPY_RECORDS == d_recordQueueMode) {
+        d_recordRing.removeAll();
+    }
+    else {
+        d_recordQueue.removeAll();
+    }
     d_shuttingDownFlag = 0;
     return ret;
 }
@@ -193,6 +392,8 @@ void AsyncFileObserver::construct()
 AsyncFileObserver::AsyncFileObserver(bslma::Allocator *basicAllocator)
 : d_fileObserver(Severity::e_WARN, basicAllocator)
 , d_recordQueue(k_DEFAULT_FIXED_QUEUE_SIZE, basicAllocator)
+, d_recordRing(0, basicAllocator)
+, d_recordQueueMode(e_SHARE_RECORDS)
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
@@ -205,6 +406,8 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
                                      bslma::Allocator *basicAllocator)
 : d_fileObserver(stdoutThreshold, basicAllocator)
 , d_recordQueue(k_DEFAULT_FIXED_QUEUE_SIZE, basicAllocator)
+, d_recordRing(0, basicAllocator)
+, d_recordQueueMode(e_SHARE_RECORDS)
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
@@ -218,6 +421,8 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
                                      bslma::Allocator *basicAllocator)
 : d_fileObserver(stdoutThreshold, publishInLocalTime, basicAllocator)
 , d_recordQueue(k_DEFAULT_FIXED_QUEUE_SIZE, basicAllocator)
+, d_recordRing(0, basicAllocator)
+, d_recordQueueMode(e_SHARE_RECORDS)
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
@@ -232,6 +437,8 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
                                      bslma::Allocator *basicAllocator)
 : d_fileObserver(stdoutThreshold, publishInLocalTime, basicAllocator)
 , d_recordQueue(maxRecordQueueSize, basicAllocator)
+, d_recordRing(0, basicAllocator)
+, d_recordQueueMode(e_SHARE_RECORDS)
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
@@ -248,6 +455,8 @@ AsyncFileObserver::AsyncFileObserver(
                              bslma::Allocator *basicAllocator)
 : d_fileObserver(stdoutThreshold, publishInLocalTime, basicAllocator)
 , d_recordQueue(maxRecordQueueSize, basicAllocator)
+, d_recordRing(0, basicAllocator)
+, d_recordQueueMode(e_SHARE_RECORDS)
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(dropRecordsOnFullQueueThreshold)
 , d_droppedRecordWarning(basicAllocator)
@@ -256,6 +465,29 @@ AsyncFileObserver::AsyncFileObserver(
     construct();
 }
 
+AsyncFileObserver::AsyncFileObserver(
+                             Severity::Level   stdoutThreshold,
+                             bool              publishInLocalTime,
+                             int               maxRecordQueueSize,
+                             Severity::Level   dropRecordsOnFullQueueThreshold,
+                             RecordQueueMode   recordQueueMode,
+                             bslma::Allocator *basicAllocator)
+: d_fileObserver(stdoutThreshold, publishInLocalTime, basicAllocator)
+, d_recordQueue(e_COPY_RECORDS == recordQueueMode ? 1 : maxRecordQueueSize,
+                basicAllocator)
+, d_recordRing(e_COPY_RECORDS == recordQueueMode ? maxRecordQueueSize : 0,
+               basicAllocator)
+, d_recordQueueMode(recordQueueMode)
+, d_shuttingDownFlag(0)
+, d_dropRecordsOnFullQueueThreshold(dropRecordsOnFullQueueThreshold)
+, d_droppedRecordWarning(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < maxRecordQueueSize);
+
+    construct();
+}
+
 AsyncFileObserver::~AsyncFileObserver()
 {
     stopPublicationThread();
@@ -267,6 +499,19 @@ void AsyncFileObserver::publish(const bsl::shared_ptr<const Record>& record,
 {
     BSLS_ASSERT(record);
 
+    if (e_COPY_RECORDS == d_recordQueueMode) {
+        if (record->fixedFields().severity() >
+                                           d_dropRecordsOnFullQueueThreshold) {
+            if (0 != d_recordRing.tryPushBack(*record, context)) {
+                d_dropCount.addRelaxed(1);
+            }
+        }
+        else {
+            d_recordRing.pushBack(*record, context);
+        }
+        return;                                                       // RETURN
+    }
+
     AsyncFileObserver_Record asyncRecord;
 
     asyncRecord.d_record  = record;
@@ -289,6 +534,9 @@ void AsyncFileObserver::releaseRecords()
         shutdownThread();
         startThread();
     }
+    else if (e_COPY_RECORDS == d_recordQueueMode) {
+        d_recordRing.removeAll();
+    }
     else {
         d_recordQueue.removeAll();
     }
@@ -96,6 +96,7 @@ BSLS_IDENT("$Id: $")
 // +-----------------------+---------------------------------+
 // | Log Record Queue      | maxRecordQueueSize              |
 // |                       | dropRecordsOnFullQueueThreshold |
+// |                       | recordQueueMode                 |
 // +-----------------------+---------------------------------+
 //
 // +-------------+-----------------------------+------------------------------+
@@ -164,6 +165,30 @@ BSLS_IDENT("$Id: $")
 // record count is reset to 0 after each such warning is published, so each
 // dropped record is counted only once.
 //
+///Record Queue Mode
+///- - - - - - - - -
+// By default ('e_SHARE_RECORDS'), each queued entry holds a
+// 'bsl::shared_ptr' to the record supplied to 'publish', so the record (and
+// whatever memory the logger manager allocated for it) is kept alive until
+// the publication thread has written it.  Supplying 'e_COPY_RECORDS' for the
+// 'recordQueueMode' constructor argument selects an alternative queue in
+// which each of the 'maxRecordQueueSize' slots holds a 'ball::Record' that is
+// created once, on construction of the observer.  'publish' then claims a
+// free slot with a single atomic operation and *copies* the record into it,
+// reusing the memory already held by the slot; no shared reference to the
+// published record is retained, and, once every slot has held a record at
+// least as large as the one being published, 'publish' does not allocate.
+// The publication thread drains the slots in batches, writing each batch of
+// records to the log file with a single call (see
+// 'ball::FileObserver2::publishBatch') and returning each batch of slots to
+// producers with a single atomic operation.
+//
+// The copying mode is intended for applications that log at high rates and
+// are sensitive to the latency of 'publish'.  Note that the memory held by
+// the observer in this mode is proportional to 'maxRecordQueueSize' times the
+// size of the largest records logged, and is not released until the observer
+// is destroyed.
+//
 ///Log Record Formatting
 ///---------------------
 // By default, the output format of published log records (whether to 'stdout'
@@ -480,9 +505,12 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bslmt_fastpostsemaphore.h>
+#include <bslmt_platform.h>
 #include <bslmt_threadutil.h>
 
 #include <bsls_atomic.h>
+#include <bsls_types.h>
 
 #include <bsl_functional.h>
 #include <bsl_memory.h>
@@ -504,6 +532,164 @@ struct AsyncFileObserver_Record {
     Context                       d_context;  // context of log record
 };
 
+                    // ==================================
+                    // class AsyncFileObserver_RecordRing
+                    // ==================================
+
+class AsyncFileObserver_RecordRing {
+    // PRIVATE CLASS.  For use by the 'ball::AsyncFileObserver' implementation
+    // only.  This class provides a fixed-capacity ring of preallocated record
+    // slots that may be filled concurrently by multiple producers and is
+    // drained by a single consumer.  A producer reserves a free slot, copies a
+    // record and its context into the slot (reusing the memory the slot
+    // already holds), and then marks the slot full; the consumer acquires a
+    // batch of full slots, processes them in order, and returns the whole
+    // batch to the producers at once.
+
+    // PRIVATE TYPES
+    enum SlotState { e_EMPTY = 0, e_FULL = 1 };
+
+    struct Slot {
+        // This 'struct' holds a copy of a published record and its context.
+
+        // DATA
+        bsls::AtomicInt d_state;    // 'e_FULL' once 'd_record' and
+                                    // 'd_context' may be consumed
+
+        Record          d_record;   // copy of the published record
+
+        Context         d_context;  // context of the published record
+
+        // CREATORS
+        explicit Slot(bslma::Allocator *basicAllocator);
+            // Create an empty slot.  Use the specified 'basicAllocator' to
+            // supply memory for the held record.
+    };
+
+    // DATA
+    bslmt::FastPostSemaphore  d_freeSlots;  // number of slots that may be
+                                            // reserved by producers
+
+    bsls::AtomicUint64        d_pushIndex;  // index of the next slot to be
+                                            // reserved by a producer
+
+    char                      d_pushPad[bslmt::Platform::e_CACHE_LINE_SIZE
+                                                 - sizeof(bsls::AtomicUint64)];
+                                            // padding to avoid false sharing
+                                            // with the consumer
+
+    bslmt::FastPostSemaphore  d_fullSlots;  // number of slots that are full
+                                            // and not yet acquired by the
+                                            // consumer
+
+    bsls::Types::Uint64       d_popIndex;   // index of the next slot to be
+                                            // consumed (consumer only)
+
+    Slot                     *d_slots_p;    // array of 'd_capacity' slots
+
+    int                       d_capacity;   // number of slots
+
+    bslma::Allocator         *d_allocator_p;
+                                            // memory allocator (held, not
+                                            // owned)
+
+    // PRIVATE MANIPULATORS
+    void fillSlot(const Record *record, const Context& context);
+        // Copy the optionally specified 'record', and the specified
+        // 'context', into the next slot, and mark that slot full.  The
+        // behavior is undefined unless the calling thread has reserved a free
+        // slot.
+
+    Slot& frontSlot();
+        // Return a reference providing modifiable access to the slot at the
+        // front of this ring, waiting until that slot is full.  The behavior
+        // is undefined unless called by the consumer holding at least one
+        // acquired slot.
+
+  private:
+    // NOT IMPLEMENTED
+    AsyncFileObserver_RecordRing(const AsyncFileObserver_RecordRing&);
+    AsyncFileObserver_RecordRing& operator=(
+                                          const AsyncFileObserver_RecordRing&);
+
+  public:
+    // CREATORS
+    explicit AsyncFileObserver_RecordRing(int               capacity,
+                                          bslma::Allocator *basicAllocator);
+        // Create a ring having the specified 'capacity' slots, each holding a
+        // default-constructed record.  Use the specified 'basicAllocator' to
+        // supply memory.  The behavior is undefined unless '0 <= capacity'.
+        // Note that a ring having 0 capacity allocates no memory, and must
+        // not be used.
+
+    ~AsyncFileObserver_RecordRing();
+        // Destroy this ring.
+
+    // MANIPULATORS
+    int acquireRecords(int maxNumRecords);
+        // Block until at least one record is available on this ring, then
+        // acquire at most the specified 'maxNumRecords' records.  Return the
+        // number of records acquired.  The behavior is undefined unless
+        // '0 < maxNumRecords' and this method is called by the (single)
+        // consumer of this ring.
+
+    const Context& frontContext();
+        // Return a reference providing non-modifiable access to the context
+        // held in the slot at the front of this ring.  The behavior is
+        // undefined unless called by the consumer holding at least one
+        // acquired record.
+
+    const Record& frontRecord();
+        // Return a reference providing non-modifiable access to the record
+        // held in the slot at the front of this ring.  The behavior is
+        // undefined unless called by the consumer holding at least one
+        // acquired record.
+
+    void popFront();
+        // Mark the slot at the front of this ring empty and advance to the
+        // next slot.  Note that the emptied slot is not available to
+        // producers, and the record it holds remains valid, until
+        // 'releaseSlots' is called.  The behavior is
+        // undefined unless called by the consumer holding at least one
+        // acquired record.
+
+    void pushBack(const Context& context);
+    void pushBack(const Record& record, const Context& context);
+        // Append a copy of the optionally specified 'record', and of the
+        // specified 'context', to this ring, blocking until a slot is free.
+        // If 'record' is not specified, the record held in the slot is left
+        // unspecified (which is useful for control entries such as
+        // 'Transmission::e_END').
+
+    void releaseSlots(int numSlots);
+        // Make the specified 'numSlots' slots, most recently emptied by
+        // 'popFront', available to producers.
+
+    void removeAll();
+        // Remove all records that are full and not yet acquired from this
+        // ring.  The behavior is undefined unless called by the consumer
+        // holding no acquired records.
+
+    void returnRecords(int numRecords);
+        // Return the specified 'numRecords' acquired (but not popped) records
+        // to this ring, making them available to a subsequent call to
+        // 'acquireRecords'.
+
+    int tryPushBack(const Record& record, const Context& context);
+        // Append a copy of the specified 'record' and 'context' to this ring
+        // if a slot is free.  Return 0 on success, and a non-zero value (with
+        // no effect) if this ring is full.
+
+    // ACCESSORS
+    int capacity() const;
+        // Return the number of slots in this ring.
+
+    int length() const;
+        // Return a snapshot of the number of slots in this ring that are not
+        // free (i.e., those that are reserved, full, or not yet released by
+        // the consumer).
+};
+
                           // =======================
                           // class AsyncFileObserver
                           // =======================
@@ -515,6 +701,18 @@ class AsyncFileObserver : public Observer {
     // can operate on an object concurrently.  This class is exception-neutral
     // with no guarantee of rollback.  In no event is memory leaked.
 
+  public:
+    // TYPES
+    enum RecordQueueMode {
+        // Enumerate the ways in which published records are held on the
+        // record queue (see {Record Queue Mode}).
+
+        e_SHARE_RECORDS,  // hold a shared pointer to each published record
+        e_COPY_RECORDS    // copy each published record into a preallocated
+                          // queue slot
+    };
+
+  private:
     // DATA
     FileObserver                   d_fileObserver;   // forward most public
                                                      // method calls to this
@@ -528,6 +726,16 @@ class AsyncFileObserver : public Observer {
                                    d_recordQueue;    // fixed-size queue of
                                                      // records processed by
                                                      // the publication thread
+                                                     // in 'e_SHARE_RECORDS'
+                                                     // mode
+
+    AsyncFileObserver_RecordRing   d_recordRing;     // ring of preallocated
+                                                     // record slots used in
+                                                     // 'e_COPY_RECORDS' mode
+
+    RecordQueueMode                d_recordQueueMode;
+                                                     // how published records
+                                                     // are queued
 
     bsls::AtomicInt                d_shuttingDownFlag;
                                                      // flag that indicates the
@@ -578,6 +786,15 @@ class AsyncFileObserver : public Observer {
         // is undefined if this method is invoked concurrently from multiple
         // threads, i.e., it is *not* thread-safe.
 
+    void publishDroppedCountIfNeeded(int queueLength, int queueCapacity);
+        // Publish, to the underlying file observer, the number of records
+        // dropped since the last such warning if that number is positive and
+        // either the specified 'queueLength' is at most half of the specified
+        // 'queueCapacity', a sufficient number of records have been dropped,
+        // or the publication thread is shutting down.  The behavior is
+        // undefined if this method is invoked concurrently from multiple
+        // threads, i.e., it is *not* thread-safe.
+
     void publishThreadEntryPoint();
         // Publish records from the record queue, to the log file and 'stdout',
         // until signaled to stop.  The behavior is undefined if this method is
@@ -585,6 +802,14 @@ class AsyncFileObserver : public Observer {
         // thread-safe.  Note that this function is the entry point for the
         // publication thread.
 
+    void publishRingThreadEntryPoint();
+        // Publish records, in batches, from the ring of preallocated record
+        // slots, to the log file and 'stdout', until signaled to stop.  The
+        // behavior is undefined if this method is invoked concurrently from
+        // multiple threads, i.e., it is *not* thread-safe.  Note that this
+        // function is the entry point for the publication thread in
+        // 'e_COPY_RECORDS' mode.
+
     int shutdownThread();
         // Stop the publication thread and discard all currently queued log
         // records.  Return 0 on success, and a non-zero value if there is an
@@ -695,6 +920,20 @@ class AsyncFileObserver : public Observer {
         // used.  Note that independent default record formats are in effect
         // for 'stdout' and file logging (see 'setLogFormat').
 
+    AsyncFileObserver(Severity::Level   stdoutThreshold,
+                      bool              publishInLocalTime,
+                      int               maxRecordQueueSize,
+                      Severity::Level   dropRecordsOnFullQueueThreshold,
+                      RecordQueueMode   recordQueueMode,
+                      bslma::Allocator *basicAllocator = 0);
+        // Create an async file observer configured as for the previous
+        // constructor, except that published records are held on the record
+        // queue as specified by 'recordQueueMode'.  If 'recordQueueMode' is
+        // 'e_COPY_RECORDS', 'maxRecordQueueSize' record slots are created on
+        // construction and each record received by 'publish' is copied into
+        // a free slot, rather than shared with the caller (see {Record Queue
+        // Mode}).  The behavior is undefined unless '0 < maxRecordQueueSize'.
+
     ~AsyncFileObserver();
         // Publish all records that were on the record queue upon entry if a
         // publication thread is running, stop the publication thread (if any),
@@ -959,6 +1198,10 @@ class AsyncFileObserver : public Observer {
         // Return the number of log records currently on the record queue of
         // this async file observer.
 
+    RecordQueueMode recordQueueMode() const;
+        // Return the mode in which this async file observer holds published
+        // records on its record queue.
+
     bdlt::DatetimeInterval rotationLifetime() const;
         // Return the log file lifetime that will trigger a file rotation by
         // this async file observer if rotation-on-lifetime is in effect, and a
@@ -980,6 +1223,85 @@ class AsyncFileObserver : public Observer {
 //                              INLINE DEFINITIONS
 // ============================================================================
 
+                    // ----------------------------------
+                    // class AsyncFileObserver_RecordRing
+                    // ----------------------------------
+
+// PRIVATE MANIPULATORS
+inline
+AsyncFileObserver_RecordRing::Slot& AsyncFileObserver_RecordRing::frontSlot()
+{
+    Slot& slot = d_slots_p[d_popIndex % d_capacity];
+
+    // The slot was reserved before 'd_fullSlots' was posted for it, but the
+    // producer that filled another slot may have posted first.
+
+    while (e_FULL != slot.d_state.loadAcquire()) {
+        bslmt::ThreadUtil::yield();
+    }
+    return slot;
+}
+
+// MANIPULATORS
+inline
+const Context& AsyncFileObserver_RecordRing::frontContext()
+{
+    return frontSlot().d_context;
+}
+
+inline
+const Record& AsyncFileObserver_RecordRing::frontRecord()
+{
+    return frontSlot().d_record;
+}
+
+inline
+void AsyncFileObserver_RecordRing::popFront()
+{
+    d_slots_p[d_popIndex % d_capacity].d_state.storeRelaxed(e_EMPTY);
+    ++d_popIndex;
+}
+
+inline
+void AsyncFileObserver_RecordRing::releaseSlots(int numSlots)
+{
+    if (0 < numSlots) {
+        d_freeSlots.post(numSlots);
+    }
+}
+
+inline
+void AsyncFileObserver_RecordRing::returnRecords(int numRecords)
+{
+    if (0 < numRecords) {
+        d_fullSlots.post(numRecords);
+    }
+}
+
+inline
+int AsyncFileObserver_RecordRing::tryPushBack(const Record&  record,
+                                              const Context& context)
+{
+    if (0 != d_freeSlots.tryWait()) {
+        return 1;                                                     // RETURN
+    }
+    fillSlot(&record, context);
+    return 0;
+}
+
+// ACCESSORS
+inline
+int AsyncFileObserver_RecordRing::capacity() const
+{
+    return d_capacity;
+}
+
+inline
+int AsyncFileObserver_RecordRing::length() const
+{
+    return d_capacity - d_freeSlots.getValue();
+}
+
                           // -----------------------
                           // class AsyncFileObserver
                           // -----------------------
@@ -1135,7 +1457,15 @@ bdlt::DatetimeInterval AsyncFileObserver::localTimeOffset() const
 inline
 int AsyncFileObserver::recordQueueLength() const
 {
-    return d_recordQueue.length();
+    return e_COPY_RECORDS == d_recordQueueMode
+           ? d_recordRing.length()
+           : d_recordQueue.length();
+}
+
+inline
+AsyncFileObserver::RecordQueueMode AsyncFileObserver::recordQueueMode() const
+{
+    return d_recordQueueMode;
 }
 
 inline
@@ -28,6 +28,8 @@
 #include <bsls_assert.h>
 #include <bsls_platform.h>
 #include <bsls_stopwatch.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
 
 #include <bsl_climits.h>
 #include <bsl_cmath.h>
@@ -39,6 +41,7 @@
 #include <bsl_iomanip.h>     // 'setfill'
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 
 #include <bsl_c_stdlib.h>    // 'unsetenv'
 
@@ -84,6 +87,7 @@ using bsl::flush;
 // [ X] AsyncFileObserver(ball::Severity::Level, bool, bslma::Allocator *);
 // [ 5] AsyncFileObserver(Severity::Level, bool, int, bslma::Allocator *);
 // [ 5] AsyncFileObserver(Severity, bool, int, Severity, Allocator *);
+// [12] AsyncFileObserver(Severity, bool, int, Severity, Mode, Alloc *);
 // [ 2] ~AsyncFileObserver();
 //
 // MANIPULATORS
@@ -119,6 +123,7 @@ using bsl::flush;
 // [ 1] bool isStdoutLoggingPrefixEnabled() const;
 // [ 1] bool isUserFieldsLoggingEnabled() const;
 // [11] int recordQueueLength() const;
+// [12] RecordQueueMode recordQueueMode() const;
 // [ 6] bdlt::DatetimeInterval rotationLifetime() const;
 // [ 6] int rotationSize() const;
 // [ 1] ball::Severity::Level stdoutThreshold() const;
@@ -128,7 +133,9 @@ using bsl::flush;
 // [ 7] CONCERN: LOGGING TO A FAILING STREAM
 // [ 5] CONCERN: LOG MESSAGE DROP
 // [ 9] CONCERN: ROTATION
-// [12] USAGE EXAMPLE
+// [12] CONCERN: COPIED-RECORD QUEUE MODE
+// [13] USAGE EXAMPLE
+// [-1] PERFORMANCE: PUBLISH LATENCY
 
 // Note assert and debug macros all output to 'cerr' instead of cout, unlike
 // most other test drivers.  This is necessary because test case 2 plays tricks
@@ -605,6 +612,129 @@ extern "C" void *workerThread2(void *arg)
 
 }  // close namespace BALL_ASYNCFILEOBSERVER_TEST_CONCURRENCY
 
+namespace BALL_ASYNCFILEOBSERVER_TEST_COPY_MODE {
+
+class PublishJob {
+    // This class provides a functor that publishes a record to an async file
+    // observer a fixed number of times, recording the total time spent in
+    // 'publish'.
+
+    // DATA
+    Obj                                 *d_observer_p;    // held, not owned
+    bsl::shared_ptr<const ball::Record>  d_record;        // record to publish
+    int                                  d_numRecords;    // number to publish
+    bsls::Types::Int64                  *d_elapsedNs_p;   // time spent in
+                                                          // 'publish' (held,
+                                                          // not owned)
+
+  public:
+    // CREATORS
+    PublishJob(Obj                                        *observer,
+               const bsl::shared_ptr<const ball::Record>&  record,
+               int                                         numRecords,
+               bsls::Types::Int64                         *elapsedNs)
+        // Create a functor that publishes the specified 'record' to the
+        // specified 'observer' the specified 'numRecords' times, and loads
+        // into the specified 'elapsedNs' the time spent doing so.
+    : d_observer_p(observer)
+    , d_record(record)
+    , d_numRecords(numRecords)
+    , d_elapsedNs_p(elapsedNs)
+    {
+    }
+
+    // ACCESSORS
+    void operator()() const
+        // Publish the record supplied at construction.
+    {
+        ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+        bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+        for (int i = 0; i < d_numRecords; ++i) {
+            d_observer_p->publish(d_record, context);
+        }
+        *d_elapsedNs_p = bsls::TimeUtil::getTimer() - start;
+    }
+};
+
+bsl::shared_ptr<ball::Record> makeRecord(const char       *message,
+                                         bslma::Allocator *basicAllocator)
+    // Return a shared pointer to a new 'e_TRACE' record having the specified
+    // 'message'.  Use the specified 'basicAllocator' to supply memory.
+{
+    bsl::shared_ptr<ball::Record> record;
+    record.createInplace(basicAllocator, basicAllocator);
+
+    ball::RecordAttributes& attributes = record->fixedFields();
+    attributes.setSeverity(ball::Severity::e_TRACE);
+    attributes.setCategory("TestCategory");
+    attributes.setFileName(__FILE__);
+    attributes.setTimestamp(bdlt::CurrentTime::utc());
+    attributes.setMessage(message);
+    return record;
+}
+
+double publishLatency(Obj::RecordQueueMode  mode,
+                      int                   numThreads,
+                      int                   numRecords,
+                      const bsl::string&    fileName,
+                      double               *recordsPerSecond)
+    // Publish, from the specified 'numThreads' threads, the specified
+    // 'numRecords' records each to an async file observer using the specified
+    // queue 'mode' and logging to the specified 'fileName'.  Return the
+    // average latency of 'publish' in nanoseconds, and load into the specified
+    // 'recordsPerSecond' the rate at which records were written.
+{
+    enum { k_QUEUE_SIZE = 8192 };
+
+    bslma::TestAllocator ta;
+
+    Obj mX(ball::Severity::e_OFF,
+           false,
+           k_QUEUE_SIZE,
+           ball::Severity::e_TRACE,  // block rather than drop
+           mode,
+           &ta);
+
+    mX.enableFileLogging(fileName.c_str());
+    mX.startPublicationThread();
+
+    bsl::shared_ptr<ball::Record> record = makeRecord(
+                      "ball::AsyncFileObserver publish latency benchmark.",
+                      &ta);
+
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads, &ta);
+    bsl::vector<bsls::Types::Int64>        elapsedNs(numThreads, 0, &ta);
+
+    bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+    for (int i = 0; i < numThreads; ++i) {
+        ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                              PublishJob(&mX,
+                                                         record,
+                                                         numRecords,
+                                                         &elapsedNs[i])));
+    }
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+    mX.stopPublicationThread();
+    bsls::Types::Int64 total = bsls::TimeUtil::getTimer() - start;
+
+    mX.disableFileLogging();
+
+    bsls::Types::Int64 publishNs = 0;
+    for (int i = 0; i < numThreads; ++i) {
+        publishNs += elapsedNs[i];
+    }
+
+    const double numPublished = static_cast<double>(numThreads) * numRecords;
+
+    *recordsPerSecond = numPublished * 1.0e9 / static_cast<double>(total);
+    return static_cast<double>(publishNs) / numPublished;
+}
+
+}  // close namespace BALL_ASYNCFILEOBSERVER_TEST_COPY_MODE
+
 //=============================================================================
 //                                 MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -623,7 +753,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocator *Z = &allocator;
 
     switch (test) { case 0:
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -775,6 +905,322 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING COPIED-RECORD QUEUE MODE
+        //
+        // Concerns:
+        //:  1 Observers created without a 'recordQueueMode' use
+        //:    'e_SHARE_RECORDS', and the mode supplied at construction is
+        //:    reported by 'recordQueueMode'.
+        //:
+        //:  2 In 'e_COPY_RECORDS' mode 'publish' does not retain a reference
+        //:    to the published record, and later changes to that record do
+        //:    not affect the logged output.
+        //:
+        //:  3 Once each slot has held a record, publishing records of no
+        //:    greater size does not allocate memory.
+        //:
+        //:  4 Records received while the queue is full are dropped (and
+        //:    reported) or block the caller according to
+        //:    'dropRecordsOnFullQueueThreshold'.
+        //:
+        //:  5 Records remain queued while no publication thread is running,
+        //:    'stopPublicationThread' publishes queued records, and
+        //:    'releaseRecords' and 'shutdownPublicationThread' discard them.
+        //:
+        //:  6 Records published concurrently from multiple threads are all
+        //:    logged exactly once.
+        //
+        // Plan:
+        //:  1 Create observers with each constructor and verify
+        //:    'recordQueueMode'.  (C-1)
+        //:
+        //:  2 Publish a record in each mode and compare its 'use_count'; then
+        //:    modify the record, publish to a file, and verify the file
+        //:    content.  (C-2)
+        //:
+        //:  3 Fill and drain the queue once, then, using a test allocator,
+        //:    verify that filling the queue again allocates no memory.  (C-3)
+        //:
+        //:  4 Overfill the queue with no publication thread running and
+        //:    verify the queue length and the number of records (including
+        //:    the drop warning) written to file.  (C-4)
+        //:
+        //:  5 Exercise 'releaseRecords', 'shutdownPublicationThread', and
+        //:    'stopPublicationThread' and verify 'recordQueueLength'.  (C-5)
+        //:
+        //:  6 Publish from several threads to an observer with a small,
+        //:    blocking queue and count the records written to file.  (C-6)
+        //
+        // Testing:
+        //   AsyncFileObserver(Severity, bool, int, Severity, Mode, Alloc *);
+        //   RecordQueueMode recordQueueMode() const;
+        //   CONCERN: COPIED-RECORD QUEUE MODE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING COPIED-RECORD QUEUE MODE"
+                          << "\n================================" << endl;
+
+        using namespace BALL_ASYNCFILEOBSERVER_TEST_COPY_MODE;
+
+        ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+        if (veryVerbose) cout << "\tTesting 'recordQueueMode'." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            Obj mA(&ta);
+            Obj mB(ball::Severity::e_WARN, false, 16, &ta);
+            Obj mC(ball::Severity::e_WARN,
+                   false,
+                   16,
+                   ball::Severity::e_OFF,
+                   Obj::e_SHARE_RECORDS,
+                   &ta);
+            Obj mD(ball::Severity::e_WARN,
+                   false,
+                   16,
+                   ball::Severity::e_OFF,
+                   Obj::e_COPY_RECORDS,
+                   &ta);
+
+            ASSERT(Obj::e_SHARE_RECORDS == mA.recordQueueMode());
+            ASSERT(Obj::e_SHARE_RECORDS == mB.recordQueueMode());
+            ASSERT(Obj::e_SHARE_RECORDS == mC.recordQueueMode());
+            ASSERT(Obj::e_COPY_RECORDS  == mD.recordQueueMode());
+
+            ASSERT(0 == mD.recordQueueLength());
+        }
+
+        if (veryVerbose) cout << "\tTesting record copy semantics." << endl;
+        {
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            Obj mS(ball::Severity::e_OFF,
+                   false,
+                   16,
+                   ball::Severity::e_OFF,
+                   Obj::e_SHARE_RECORDS,
+                   &ta);
+            Obj mX(ball::Severity::e_OFF,
+                   false,
+                   16,
+                   ball::Severity::e_OFF,
+                   Obj::e_COPY_RECORDS,
+                   &ta);
+
+            bsl::shared_ptr<ball::Record> record = makeRecord("original",
+                                                              &ta);
+
+            mS.publish(record, context);
+            ASSERTV(record.use_count(), 2 == record.use_count());
+
+            mX.publish(record, context);
+            ASSERTV(record.use_count(), 2 == record.use_count());
+            ASSERT(1 == mX.recordQueueLength());
+
+            mS.releaseRecords();
+            ASSERTV(record.use_count(), 1 == record.use_count());
+
+            record->fixedFields().setMessage("modified");
+
+            mX.enableFileLogging(fileName.c_str());
+            mX.startPublicationThread();
+            mX.stopPublicationThread();
+            mX.disableFileLogging();
+
+            ASSERT(0 == mX.recordQueueLength());
+
+            bsl::string content = readPartialFile(fileName, 0);
+            ASSERTV(content, bsl::string::npos != content.find("original"));
+            ASSERTV(content, bsl::string::npos == content.find("modified"));
+        }
+
+        if (veryVerbose) cout << "\tTesting allocation-free 'publish'."
+                              << endl;
+        {
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+            bslma::TestAllocator ra(veryVeryVeryVerbose);
+
+            enum { k_QUEUE_SIZE = 64 };
+
+            Obj mX(ball::Severity::e_OFF,
+                   false,
+                   k_QUEUE_SIZE,
+                   ball::Severity::e_OFF,
+                   Obj::e_COPY_RECORDS,
+                   &ta);
+
+            bsl::shared_ptr<ball::Record> record = makeRecord(
+                          "a message that does not fit in a small buffer ...",
+                          &ra);
+
+            for (int i = 0; i < k_QUEUE_SIZE; ++i) {
+                mX.publish(record, context);
+            }
+            ASSERT(k_QUEUE_SIZE == mX.recordQueueLength());
+
+            mX.enableFileLogging(fileName.c_str());
+            mX.startPublicationThread();
+            mX.stopPublicationThread();
+            ASSERT(0 == mX.recordQueueLength());
+
+            const bsls::Types::Int64 numAllocations = ta.numAllocations();
+
+            for (int i = 0; i < k_QUEUE_SIZE; ++i) {
+                mX.publish(record, context);
+            }
+            ASSERT(k_QUEUE_SIZE == mX.recordQueueLength());
+
+            ASSERTV(numAllocations,
+                    ta.numAllocations(),
+                    numAllocations == ta.numAllocations());
+
+            mX.disableFileLogging();
+        }
+
+        if (veryVerbose) cout << "\tTesting dropped records." << endl;
+        {
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            enum { k_QUEUE_SIZE = 100, k_NUM_EXTRA = 10 };
+
+            Obj mX(ball::Severity::e_OFF,
+                   false,
+                   k_QUEUE_SIZE,
+                   ball::Severity::e_OFF,
+                   Obj::e_COPY_RECORDS,
+                   &ta);
+
+            bsl::shared_ptr<ball::Record> record = makeRecord("drop", &ta);
+
+            for (int i = 0; i < k_QUEUE_SIZE + k_NUM_EXTRA; ++i) {
+                mX.publish(record, context);
+            }
+            ASSERTV(mX.recordQueueLength(),
+                    k_QUEUE_SIZE == mX.recordQueueLength());
+
+            mX.enableFileLogging(fileName.c_str());
+            mX.startPublicationThread();
+            mX.stopPublicationThread();
+            mX.disableFileLogging();
+
+            // One additional record reports the number of dropped records.
+
+            ASSERTV(countLoggedRecords(fileName),
+                    k_QUEUE_SIZE + 1 == countLoggedRecords(fileName));
+
+            bsl::string content = readPartialFile(fileName, 0);
+            ASSERTV(content,
+                    bsl::string::npos != content.find("Dropped 10 log"));
+        }
+
+        if (veryVerbose) cout << "\tTesting thread control." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            Obj mX(ball::Severity::e_OFF,
+                   false,
+                   16,
+                   ball::Severity::e_OFF,
+                   Obj::e_COPY_RECORDS,
+                   &ta);
+
+            bsl::shared_ptr<ball::Record> record = makeRecord("control", &ta);
+
+            for (int i = 0; i < 5; ++i) {
+                mX.publish(record, context);
+            }
+            ASSERT(5 == mX.recordQueueLength());
+
+            mX.releaseRecords();
+            ASSERT(0 == mX.recordQueueLength());
+
+            for (int i = 0; i < 5; ++i) {
+                mX.publish(record, context);
+            }
+            ASSERT(0 == mX.startPublicationThread());
+            ASSERT(0 == mX.stopPublicationThread());
+            ASSERT(0 == mX.recordQueueLength());
+
+            for (int i = 0; i < 5; ++i) {
+                mX.publish(record, context);
+            }
+            ASSERT(5 == mX.recordQueueLength());
+            ASSERT(0 == mX.shutdownPublicationThread());
+            ASSERT(0 == mX.recordQueueLength());
+
+            for (int i = 0; i < 5; ++i) {
+                mX.publish(record, context);
+            }
+            ASSERT(0 == mX.startPublicationThread());
+            ASSERT(0 == mX.shutdownPublicationThread());
+            ASSERT(0 == mX.recordQueueLength());
+            ASSERT(false == mX.isPublicationThreadRunning());
+        }
+
+        if (veryVerbose) cout << "\tTesting concurrent publication." << endl;
+        {
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            enum { k_NUM_THREADS = 4, k_NUM_RECORDS = 5000 };
+
+            Obj mX(ball::Severity::e_OFF,
+                   false,
+                   32,
+                   ball::Severity::e_TRACE,
+                   Obj::e_COPY_RECORDS,
+                   &ta);
+
+            mX.enableFileLogging(fileName.c_str());
+            mX.startPublicationThread();
+
+            bsl::shared_ptr<ball::Record> record = makeRecord("concurrent",
+                                                              &ta);
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            bsls::Types::Int64        elapsedNs[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                                   &handles[i],
+                                                   PublishJob(&mX,
+                                                              record,
+                                                              k_NUM_RECORDS,
+                                                              &elapsedNs[i])));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                bslmt::ThreadUtil::join(handles[i]);
+            }
+            mX.stopPublicationThread();
+            mX.disableFileLogging();
+
+            ASSERTV(countLoggedRecords(fileName),
+                    k_NUM_THREADS * k_NUM_RECORDS ==
+                                                countLoggedRecords(fileName));
+        }
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // TESTING 'recordQueueLength'
@@ -3513,6 +3959,62 @@ int main(int argc, char *argv[])
         }
         fclose(stdout);
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: PUBLISH LATENCY
+        //
+        // Concerns:
+        //:  1 Report the average latency of 'publish', and the sustained
+        //:    record rate, in both record queue modes.
+        //
+        // Plan:
+        //:  1 For each mode, publish a fixed number of records from each of
+        //:    a number of threads to an observer logging to a file, with a
+        //:    blocking queue, and report the average time spent in
+        //:    'publish' and the overall record rate.  The number of threads
+        //:    and the number of records per thread may be supplied as the
+        //:    second and third command-line arguments.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: PUBLISH LATENCY
+        // --------------------------------------------------------------------
+
+        cout << "\nPERFORMANCE: PUBLISH LATENCY"
+             << "\n============================" << endl;
+
+        using namespace BALL_ASYNCFILEOBSERVER_TEST_COPY_MODE;
+
+        const int numThreads = argc > 2 ? atoi(argv[2]) : 4;
+        const int numRecords = argc > 3 ? atoi(argv[3]) : 250000;
+
+        TempDirectoryGuard tempDirGuard;
+
+        bsl::string fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+        cout << "Mode,Threads,RecordsPerThread,PublishNs,Records/s" << endl;
+
+        for (int mode = 0; mode < 2; ++mode) {
+            const Obj::RecordQueueMode MODE = 0 == mode
+                                              ? Obj::e_SHARE_RECORDS
+                                              : Obj::e_COPY_RECORDS;
+
+            double recordsPerSecond = 0;
+            double latency          = publishLatency(MODE,
+                                                     numThreads,
+                                                     numRecords,
+                                                     fileName,
+                                                     &recordsPerSecond);
+
+            cout << (0 == mode ? "share" : "copy") << ','
+                 << numThreads                     << ','
+                 << numRecords                     << ','
+                 << latency                        << ','
+                 << recordsPerSecond               << endl;
+
+            FsUtil::remove(fileName);
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
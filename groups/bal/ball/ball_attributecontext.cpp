@@ -330,13 +330,11 @@ AttributeContext::determineThresholdLevels(ThresholdAggregate *levels,
     BSLS_ASSERT(levels);
     BSLS_ASSERT(category);
 
-    // Set the default levels for 'category'.
-    levels->setLevels(category->recordLevel(),
-                      category->passLevel(),
-                      category->triggerLevel(),
-                      category->triggerAllLevel());
+    // Set the default levels for 'category', taking them and the mask of
+    // relevant rules from the same snapshot of the category.
 
-    RuleSet::MaskType relevantRulesMask = category->relevantRuleMask();
+    RuleSet::MaskType relevantRulesMask =
+                                         category->loadThresholdLevels(levels);
 
     if (!relevantRulesMask) {
         return;                                                       // RETURN
@@ -31,14 +31,9 @@ Category::Category(const char       *categoryName,
     // threshold level values does not need to be repeated here.  They are
     // validated in 'CategoryManager::addCategory', prior to creating an
     // instance of this class.
-: d_thresholdLevels(recordLevel, passLevel, triggerLevel, triggerAllLevel)
-, d_threshold(ThresholdAggregate::maxLevel(recordLevel,
-                                           passLevel,
-                                           triggerLevel,
-                                           triggerAllLevel))
+: d_state(packLevels(recordLevel, passLevel, triggerLevel, triggerAllLevel))
 , d_categoryName(categoryName, basicAllocator)
 , d_categoryHolder(0)
-, d_relevantRuleMask(0)
 , d_ruleThreshold(0)
 {
     BSLS_ASSERT(categoryName);
@@ -51,7 +46,7 @@ Category::linkCategoryHolder(CategoryHolder *categoryHolder)
     BSLS_ASSERT(categoryHolder);
 
     if (!categoryHolder->category()) {
-        categoryHolder->setThreshold(bsl::max(d_threshold, d_ruleThreshold));
+        categoryHolder->setThreshold(bsl::max(threshold(), ruleThreshold()));
         categoryHolder->setCategory(this);
         categoryHolder->setNext(d_categoryHolder);
         d_categoryHolder = categoryHolder;
@@ -74,16 +69,37 @@ void Category::updateThresholdForHolders()
 {
     if (d_categoryHolder) {
         CategoryHolder *holder = d_categoryHolder;
-        const int threshold = bsl::max(d_threshold, d_ruleThreshold);
-        if (threshold != holder->threshold()) {
+        const int maxThreshold = bsl::max(threshold(), ruleThreshold());
+        if (maxThreshold != holder->threshold()) {
             do {
-                holder->setThreshold(threshold);
+                holder->setThreshold(maxThreshold);
                 holder = holder->next();
             } while (holder);
         }
     }
 }
 
+void Category::updateRelevantRuleMask(RuleSet::MaskType setBits,
+                                      RuleSet::MaskType clearedBits)
+{
+    typedef bsls::Types::Uint64 Uint64;
+
+    const Uint64 clearMask = static_cast<Uint64>(clearedBits)
+                                                          << k_RULE_MASK_SHIFT;
+    const Uint64 setMask   = static_cast<Uint64>(setBits) << k_RULE_MASK_SHIFT;
+
+    Uint64 state = d_state.loadRelaxed();
+    for (;;) {
+        const Uint64 oldState = d_state.testAndSwapAcqRel(
+                                             state,
+                                             (state & ~clearMask) | setMask);
+        if (oldState == state) {
+            return;                                                   // RETURN
+        }
+        state = oldState;
+    }
+}
+
 // MANIPULATORS
 int Category::setLevels(int recordLevel,
                         int passLevel,
@@ -95,15 +111,28 @@ int Category::setLevels(int recordLevel,
                                           triggerLevel,
                                           triggerAllLevel)) {
 
-        d_thresholdLevels.setLevels(recordLevel,
-                                    passLevel,
-                                    triggerLevel,
-                                    triggerAllLevel);
-
-        d_threshold = ThresholdAggregate::maxLevel(recordLevel,
-                                                   passLevel,
-                                                   triggerLevel,
-                                                   triggerAllLevel);
+        typedef bsls::Types::Uint64 Uint64;
+
+        const Uint64 levels     = packLevels(recordLevel,
+                                             passLevel,
+                                             triggerLevel,
+                                             triggerAllLevel);
+        const Uint64 levelsMask =
+                          (static_cast<Uint64>(1) << k_RULE_MASK_SHIFT) - 1;
+
+        // Publish the new levels without disturbing a concurrent update of
+        // the relevant rule mask.
+
+        Uint64 state = d_state.loadRelaxed();
+        for (;;) {
+            const Uint64 oldState = d_state.testAndSwapAcqRel(
+                                           state,
+                                           (state & ~levelsMask) | levels);
+            if (oldState == state) {
+                break;
+            }
+            state = oldState;
+        }
 
         updateThresholdForHolders();
         return 0;                                                     // RETURN
@@ -54,6 +54,18 @@ BSLS_IDENT("$Id: $")
 //:   evaluation of the logging rules and current 'ball::AttributeContext' must
 //:   be performed).
 //
+///Thread Safety
+///-------------
+// The four threshold levels of a 'ball::Category' and its mask of relevant
+// rules are kept together in a single atomic 64-bit word.  A modification
+// (by 'setLevels', or by the category manager as rules are added and removed)
+// computes the new word from the current one and publishes it with a single
+// compare-and-swap, and every accessor reads the word with a single
+// acquire-load.  Hence, the threshold levels and rule mask observed by a
+// thread are always a consistent snapshot, and checking whether a category is
+// enabled never takes a lock, even while the thresholds or the rules of the
+// category are being modified by another thread.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -107,10 +119,14 @@ BSLS_IDENT("$Id: $")
 #include <bslmf_nestedtraitdeclaration.h>
 
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
 #include <bsls_atomicoperations.h>
 #include <bsls_review.h>
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
+#include <bsl_string.h>
+
 namespace BloombergLP {
 namespace ball {
 
@@ -126,29 +142,39 @@ class Category {
     // 'CategoryManager'.  All threshold levels are integral values in the
     // range '[0 .. 255]'.
     //
-    // Implementation Note: The 'd_ruleThreshold' and 'd_relevantRuleMask'
-    // serve as a cache for logging rule evaluation (see
+    // Implementation Note: The 'd_ruleThreshold' and the rule mask held in
+    // 'd_state' serve as a cache for logging rule evaluation (see
     // 'ball_attributecontext').  They are not meant to be modified by users
     // of the logging system, and may be modified by 'const' operations of the
-    // logging system.
+    // logging system.  The record, pass, trigger, and trigger-all levels are
+    // held, in that order, in the four low-order bytes of 'd_state', and the
+    // relevant rule mask in its four high-order bytes.
 
-    // DATA
-    ThresholdAggregate  d_thresholdLevels;  // record, pass, trigger, and
-                                            // trigger-all levels
+    // PRIVATE TYPES
+    enum {
+        k_BITS_PER_LEVEL = 8,   // number of bits used to store a level
+
+        k_LEVEL_MASK     = 0xff,
+                                // mask of the bits of a level
 
-    int                 d_threshold;        // numerical maximum of the four
-                                            // levels
+        k_RULE_MASK_SHIFT = 4 * k_BITS_PER_LEVEL
+                                // offset of the relevant rule mask in
+                                // 'd_state'
+    };
+
+    // DATA
+    bsls::AtomicUint64  d_state;            // threshold levels and relevant
+                                            // rule mask (i.e., the rules that
+                                            // have been attached to this
+                                            // category)
 
     bsl::string         d_categoryName;     // category name
 
     CategoryHolder     *d_categoryHolder;   // linked list of holders of this
                                             // category
-    mutable RuleSet::MaskType
-                        d_relevantRuleMask; // the mask indicating which rules
-                                            // are relevant (i.e., have been
-                                            // attached to this category)
 
-    mutable int         d_ruleThreshold;    // numerical maximum of all four
+    mutable bsls::AtomicInt
+                        d_ruleThreshold;    // numerical maximum of all four
                                             // levels for all relevant rules
 
     // FRIENDS
@@ -159,6 +185,25 @@ class Category {
     Category& operator=(const Category&);
 
   private:
+    // PRIVATE CLASS METHODS
+    static int levelFromState(bsls::Types::Uint64 state, int index);
+        // Return the threshold level at the specified 'index' (0 for the
+        // record level, through 3 for the trigger-all level) in the specified
+        // 'state'.
+
+    static int maxLevelFromState(bsls::Types::Uint64 state);
+        // Return the numerical maximum of the four threshold levels in the
+        // specified 'state'.
+
+    static bsls::Types::Uint64 packLevels(int recordLevel,
+                                          int passLevel,
+                                          int triggerLevel,
+                                          int triggerAllLevel);
+        // Return the state having the specified 'recordLevel', 'passLevel',
+        // 'triggerLevel', and 'triggerAllLevel' threshold levels and an empty
+        // relevant rule mask.  The behavior is undefined unless each level is
+        // in the range '[0 .. 255]'.
+
     // PRIVATE MANIPULATORS
     void linkCategoryHolder(CategoryHolder *categoryHolder);
         // Load this category and its corresponding 'maxLevel()' into the
@@ -173,9 +218,16 @@ class Category {
 
     void updateThresholdForHolders();
         // Update the threshold of all category holders that hold the address
-        // of this object to the maximum of 'd_threshold' and
+        // of this object to the maximum of 'threshold()' and
         // 'd_ruleThreshold'.
 
+    void updateRelevantRuleMask(RuleSet::MaskType setBits,
+                                RuleSet::MaskType clearedBits);
+        // Atomically set the bits of the relevant rule mask of this category
+        // that are set in the specified 'setBits', and clear those that are
+        // set in the specified 'clearedBits' (but not in 'setBits'), leaving
+        // the threshold levels unchanged.
+
   public:
     // CLASS METHODS
     static bool areValidThresholdLevels(int recordLevel,
@@ -244,9 +296,17 @@ class Category {
     int triggerAllLevel() const;
         // Return the trigger-all level of this category.
 
-    const ThresholdAggregate& thresholdLevels() const;
+    ThresholdAggregate thresholdLevels() const;
         // Return the aggregate threshold levels of this category.
 
+    RuleSet::MaskType loadThresholdLevels(ThresholdAggregate *levels) const;
+        // Load into the specified 'levels' the aggregate threshold levels of
+        // this category, and return the relevant rule mask of this category
+        // (see 'relevantRuleMask'), both taken from the same snapshot of the
+        // state of this category.  Note that, unlike a sequence of calls to
+        // the other accessors, this method cannot observe a modification of
+        // this category made by another thread only in part.
+
     int threshold() const;
         // Return the current maximum threshold (i.e., the lowest severity)
         // between the 'recordLevel', 'passLevel', 'triggerLevel', and
@@ -423,6 +483,37 @@ bool Category::areValidThresholdLevels(int recordLevel,
              >> k_BITS_PER_CHAR);
 }
 
+// PRIVATE CLASS METHODS
+inline
+int Category::levelFromState(bsls::Types::Uint64 state, int index)
+{
+    return static_cast<int>(state >> (index * k_BITS_PER_LEVEL))
+         & k_LEVEL_MASK;
+}
+
+inline
+int Category::maxLevelFromState(bsls::Types::Uint64 state)
+{
+    const int a = bsl::max(levelFromState(state, 0), levelFromState(state, 1));
+    const int b = bsl::max(levelFromState(state, 2), levelFromState(state, 3));
+
+    return bsl::max(a, b);
+}
+
+inline
+bsls::Types::Uint64 Category::packLevels(int recordLevel,
+                                         int passLevel,
+                                         int triggerLevel,
+                                         int triggerAllLevel)
+{
+    typedef bsls::Types::Uint64 Uint64;
+
+    return static_cast<Uint64>(recordLevel)
+         | static_cast<Uint64>(passLevel)       << k_BITS_PER_LEVEL
+         | static_cast<Uint64>(triggerLevel)    << 2 * k_BITS_PER_LEVEL
+         | static_cast<Uint64>(triggerAllLevel) << 3 * k_BITS_PER_LEVEL;
+}
+
 // ACCESSORS
 inline
 const char *Category::categoryName() const
@@ -433,61 +524,83 @@ const char *Category::categoryName() const
 inline
 bool Category::isEnabled(int level) const
 {
-    return d_threshold >= level;
+    return maxLevelFromState(d_state.loadAcquire()) >= level;
 }
 
 inline
 int Category::maxLevel() const
 {
-    return d_threshold;
+    return maxLevelFromState(d_state.loadAcquire());
 }
 
 inline
 int Category::recordLevel() const
 {
-    return d_thresholdLevels.recordLevel();
+    return levelFromState(d_state.loadAcquire(), 0);
 }
 
 inline
 int Category::passLevel() const
 {
-    return d_thresholdLevels.passLevel();
+    return levelFromState(d_state.loadAcquire(), 1);
 }
 
 inline
 int Category::triggerLevel() const
 {
-    return d_thresholdLevels.triggerLevel();
+    return levelFromState(d_state.loadAcquire(), 2);
 }
 
 inline
 int Category::triggerAllLevel() const
 {
-    return d_thresholdLevels.triggerAllLevel();
+    return levelFromState(d_state.loadAcquire(), 3);
+}
+
+inline
+ThresholdAggregate Category::thresholdLevels() const
+{
+    const bsls::Types::Uint64 state = d_state.loadAcquire();
+
+    return ThresholdAggregate(levelFromState(state, 0),
+                              levelFromState(state, 1),
+                              levelFromState(state, 2),
+                              levelFromState(state, 3));
 }
 
 inline
-const ThresholdAggregate& Category::thresholdLevels() const
+RuleSet::MaskType
+Category::loadThresholdLevels(ThresholdAggregate *levels) const
 {
-    return d_thresholdLevels;
+    BSLS_ASSERT(levels);
+
+    const bsls::Types::Uint64 state = d_state.loadAcquire();
+
+    levels->setLevels(levelFromState(state, 0),
+                      levelFromState(state, 1),
+                      levelFromState(state, 2),
+                      levelFromState(state, 3));
+
+    return static_cast<RuleSet::MaskType>(state >> k_RULE_MASK_SHIFT);
 }
 
 inline
 int Category::threshold() const
 {
-    return d_threshold;
+    return maxLevelFromState(d_state.loadAcquire());
 }
 
 inline
 int Category::ruleThreshold() const
 {
-    return d_ruleThreshold;
+    return d_ruleThreshold.loadAcquire();
 }
 
 inline
 RuleSet::MaskType Category::relevantRuleMask() const
 {
-    return d_relevantRuleMask;
+    return static_cast<RuleSet::MaskType>(d_state.loadAcquire()
+                                                        >> k_RULE_MASK_SHIFT);
 }
 
                         // --------------------
@@ -504,7 +617,7 @@ void CategoryHolder::setCategory(const Category *category)
 inline
 void CategoryHolder::setThreshold(int threshold)
 {
-    AtomicOps::setIntRelaxed(&d_threshold, threshold);
+    AtomicOps::setIntRelease(&d_threshold, threshold);
 }
 
 inline
@@ -524,7 +637,7 @@ const Category *CategoryHolder::category() const
 inline
 int CategoryHolder::threshold() const
 {
-    return AtomicOps::getIntRelaxed(&d_threshold);
+    return AtomicOps::getIntAcquire(&d_threshold);
 }
 
 inline
@@ -569,28 +682,40 @@ inline
 void CategoryManagerImpUtil::setRuleThreshold(Category *category,
                                               int       ruleThreshold)
 {
-    category->d_ruleThreshold = ruleThreshold;
+    BSLS_ASSERT(category);
+
+    category->d_ruleThreshold.storeRelease(ruleThreshold);
 }
 
 inline
 void CategoryManagerImpUtil::enableRule(Category *category, int ruleIndex)
 {
-    category->d_relevantRuleMask =
-        bdlb::BitUtil::withBitSet(category->d_relevantRuleMask, ruleIndex);
+    BSLS_ASSERT(category);
+
+    category->updateRelevantRuleMask(
+                         bdlb::BitUtil::withBitSet(RuleSet::MaskType(0),
+                                                   ruleIndex),
+                         0);
 }
 
 inline
 void CategoryManagerImpUtil::disableRule(Category *category, int ruleIndex)
 {
-    category->d_relevantRuleMask =
-        bdlb::BitUtil::withBitCleared(category->d_relevantRuleMask, ruleIndex);
+    BSLS_ASSERT(category);
+
+    category->updateRelevantRuleMask(
+                         0,
+                         bdlb::BitUtil::withBitSet(RuleSet::MaskType(0),
+                                                   ruleIndex));
 }
 
 inline
 void CategoryManagerImpUtil::setRelevantRuleMask(Category          *category,
                                                  RuleSet::MaskType  mask)
 {
-    category->d_relevantRuleMask = mask;
+    BSLS_ASSERT(category);
+
+    category->updateRelevantRuleMask(mask, ~mask);
 }
 
 }  // close package namespace
@@ -11,8 +11,11 @@
 
 #include <bslmf_assert.h>
 
+#include <bslmt_threadutil.h>
+
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_atomic.h>
 #include <bsls_platform.h>
 #include <bsls_review.h>
 #include <bsls_types.h>
@@ -48,9 +51,24 @@ using namespace bsl;
 // CREATORS
 // [  ] Category();
 //
+// MANIPULATORS
+// [ 2] int setLevels(int, int, int, int);
+//
+// ACCESSORS
+// [ 2] ThresholdAggregate thresholdLevels() const;
+// [ 2] MaskType loadThresholdLevels(ThresholdAggregate *levels) const;
+// [ 2] RuleSet::MaskType relevantRuleMask() const;
+// [ 2] int maxLevel() const;
+// [ 2] bool isEnabled(int level) const;
+//
+// 'ball::CategoryManagerImpUtil'
+// [ 2] static void enableRule(Category *category, int ruleIndex);
+// [ 2] static void disableRule(Category *category, int ruleIndex);
+// [ 2] static void setRelevantRuleMask(Category *, RuleSet::MaskType);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [  ] USAGE EXAMPLE
+// [ 3] USAGE EXAMPLE
+// [ 2] CONCERN: LEVELS AND RULE MASK ARE READ AS ONE SNAPSHOT
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -111,7 +129,45 @@ void aSsErT(bool condition, const char *message, int line)
 //                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
 //-----------------------------------------------------------------------------
 
-typedef ball::Category Obj;
+typedef ball::Category               Obj;
+typedef ball::CategoryManagerImpUtil Util;
+
+// ============================================================================
+//                    GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct SnapshotThreadArgs {
+    // This 'struct' holds the arguments of 'snapshotWriterThread'.
+
+    Obj             *d_category_p;   // category to modify
+    bsls::AtomicInt *d_done_p;       // set by the reader when it is done
+};
+
+extern "C" void *snapshotWriterThread(void *args)
+    // Until '*d_done_p' is set, alternately set all four threshold levels of
+    // the category specified by 'args' to 10 and to 200, while setting and
+    // clearing rule 3 of its relevant rule mask.
+{
+    SnapshotThreadArgs *p = static_cast<SnapshotThreadArgs *>(args);
+
+    int i = 0;
+    while (!*p->d_done_p) {
+        const int level = (i & 1) ? 200 : 10;
+        p->d_category_p->setLevels(level, level, level, level);
+        if (i & 2) {
+            Util::enableRule(p->d_category_p, 3);
+        }
+        else {
+            Util::disableRule(p->d_category_p, 3);
+        }
+        ++i;
+    }
+    return 0;
+}
+
+}  // close unnamed namespace
 
 // ============================================================================
 //                                 TYPE TRAITS
@@ -152,7 +208,7 @@ int main(int argc, char *argv[])
     bslma::DefaultAllocatorGuard defaultAllocatorGuard(&defaultAllocator);
 
     switch (test) { case 0:
-      case 2: {
+      case 3: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -210,6 +266,143 @@ int main(int argc, char *argv[])
     }
 //..
       } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONCERN: LEVELS AND RULE MASK ARE READ AS ONE SNAPSHOT
+        //
+        // Concerns:
+        //: 1 'setLevels' modifies the four threshold levels, and leaves the
+        //:   relevant rule mask unchanged.
+        //:
+        //: 2 'enableRule', 'disableRule', and 'setRelevantRuleMask' modify
+        //:   the relevant rule mask, and leave the threshold levels unchanged.
+        //:
+        //: 3 'thresholdLevels' and 'loadThresholdLevels' report the levels
+        //:   held by the category, and 'loadThresholdLevels' returns the
+        //:   relevant rule mask.
+        //:
+        //: 4 A thread reading the levels of a category never observes a
+        //:   combination of levels, or of levels and rule mask, that was not
+        //:   set by another thread modifying that category concurrently.
+        //
+        // Plan:
+        //: 1 Modify the levels and the rule mask of a category in turn, and
+        //:   verify all accessors after each modification.  (C-1..3)
+        //:
+        //: 2 Run a thread that alternately sets all levels of a category to
+        //:   10 and to 200, and enables and disables a rule, while this thread
+        //:   repeatedly calls 'loadThresholdLevels' and verifies that the four
+        //:   levels are equal and that the rule mask is either empty or has
+        //:   only the expected bit set.  (C-4)
+        //
+        // Testing:
+        //   int setLevels(int, int, int, int);
+        //   ThresholdAggregate thresholdLevels() const;
+        //   MaskType loadThresholdLevels(ThresholdAggregate *levels) const;
+        //   RuleSet::MaskType relevantRuleMask() const;
+        //   int maxLevel() const;
+        //   bool isEnabled(int level) const;
+        //   static void enableRule(Category *category, int ruleIndex);
+        //   static void disableRule(Category *category, int ruleIndex);
+        //   static void setRelevantRuleMask(Category *, RuleSet::MaskType);
+        //   CONCERN: LEVELS AND RULE MASK ARE READ AS ONE SNAPSHOT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "CONCERN: LEVELS AND RULE MASK ARE READ AS ONE SNAPSHOT"
+                 << endl
+                 << "======================================================"
+                 << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tModifying levels and rule mask." << endl;
+        {
+            Obj mX("example", 1, 2, 3, 4, &oa);  const Obj& X = mX;
+
+            ASSERTV(X.relevantRuleMask(), 0 == X.relevantRuleMask());
+            ASSERTV(X.maxLevel(), 4 == X.maxLevel());
+            ASSERT( X.isEnabled(4));
+            ASSERT(!X.isEnabled(5));
+
+            Util::enableRule(&mX, 0);
+            Util::enableRule(&mX, 31);
+
+            const ball::RuleSet::MaskType MASK = 0x80000001u;
+
+            ASSERTV(X.relevantRuleMask(), MASK == X.relevantRuleMask());
+            ASSERTV(X.recordLevel(),     1 == X.recordLevel());
+            ASSERTV(X.passLevel(),       2 == X.passLevel());
+            ASSERTV(X.triggerLevel(),    3 == X.triggerLevel());
+            ASSERTV(X.triggerAllLevel(), 4 == X.triggerAllLevel());
+
+            ASSERT(0 == mX.setLevels(255, 6, 7, 0));
+
+            ASSERTV(X.relevantRuleMask(), MASK == X.relevantRuleMask());
+            ASSERTV(X.maxLevel(), 255 == X.maxLevel());
+            ASSERT(X.isEnabled(255));
+
+            ball::ThresholdAggregate levels(0, 0, 0, 0);
+            ASSERT(MASK == X.loadThresholdLevels(&levels));
+            ASSERT(ball::ThresholdAggregate(255, 6, 7, 0) == levels);
+            ASSERT(ball::ThresholdAggregate(255, 6, 7, 0) ==
+                                                         X.thresholdLevels());
+
+            ASSERT(0 != mX.setLevels(256, 6, 7, 0));
+            ASSERT(ball::ThresholdAggregate(255, 6, 7, 0) ==
+                                                         X.thresholdLevels());
+
+            Util::disableRule(&mX, 0);
+            ASSERTV(X.relevantRuleMask(),
+                    0x80000000u == X.relevantRuleMask());
+
+            Util::setRelevantRuleMask(&mX, 0x0000ff00u);
+            ASSERTV(X.relevantRuleMask(),
+                    0x0000ff00u == X.relevantRuleMask());
+            ASSERT(ball::ThresholdAggregate(255, 6, 7, 0) ==
+                                                         X.thresholdLevels());
+
+            Util::setRelevantRuleMask(&mX, 0);
+            ASSERT(0 == X.loadThresholdLevels(&levels));
+            ASSERT(ball::ThresholdAggregate(255, 6, 7, 0) == levels);
+        }
+
+        if (verbose) cout << "\tReading while another thread writes." << endl;
+        {
+            enum { k_NUM_READS = 200000 };
+
+            Obj mX("example", 10, 10, 10, 10, &oa);  const Obj& X = mX;
+
+            bsls::AtomicInt    done(0);
+            SnapshotThreadArgs args = { &mX, &done };
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                  snapshotWriterThread,
+                                                  &args));
+
+            int numTorn = 0;
+            for (int i = 0; i < k_NUM_READS; ++i) {
+                ball::ThresholdAggregate levels;
+
+                const ball::RuleSet::MaskType mask =
+                                                X.loadThresholdLevels(&levels);
+
+                const int level = levels.recordLevel();
+                if ((10 != level && 200 != level)
+                 || level != levels.passLevel()
+                 || level != levels.triggerLevel()
+                 || level != levels.triggerAllLevel()
+                 || (0 != mask && 0x8 != mask)) {
+                    ++numTorn;
+                }
+            }
+            done = 1;
+            bslmt::ThreadUtil::join(handle);
+
+            ASSERTV(numTorn, 0 == numTorn);
+        }
+      } break;
       case 1: {
         // --------------------------------------------------------------------
         // BREATHING TEST
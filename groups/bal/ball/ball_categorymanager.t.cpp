@@ -73,7 +73,7 @@ using namespace bsl;
 // [ 4] bool isEnabled(int) const;
 // [ 3] int recordLevel() const;
 // [ 3] int passLevel() const;
-// [ 3] const ball::ThresholdAggregate& thresholdLevels() const;
+// [ 3] ball::ThresholdAggregate thresholdLevels() const;
 // [ 3] int triggerLevel() const;
 // [ 3] int triggerAllLevel() const;
 //
@@ -2299,7 +2299,7 @@ int main(int argc, char *argv[])
         //   const char *categoryName() const;
         //   int recordLevel() const;
         //   int passLevel() const;
-        //   const ball::ThresholdAggregate& thresholdLevels() const;
+        //   ball::ThresholdAggregate thresholdLevels() const;
         //   int triggerLevel() const;
         //   int triggerAllLevel() const;
         //
@@ -30,6 +30,7 @@ BSLS_IDENT("$Id: $")
 //                         |              enableStdoutLoggingPrefix
 //                         |              enablePublishInLocalTime
 //                         |              forceRotation
+//                         |              publishBatch
 //                         |              rotateOnSize
 //                         |              rotateOnTimeInterval
 //                         |              setOnFileRotationCallback
@@ -625,6 +626,15 @@ class FileObserver : public Observer {
         // 'record' is at least as severe as the value returned by
         // 'stdoutThreshold'.
 
+    void publishBatch(const Record *const *records, int numRecords);
+        // Process the specified 'numRecords' log records addressed by the
+        // specified 'records' array, in order, by writing each record to
+        // 'stdout' if its severity is at least as severe as the value
+        // returned by 'stdoutThreshold', and, if file logging is enabled, to
+        // the current log file as if by 'FileObserver2::publishBatch' (i.e.,
+        // with a single write unless buffered logging is enabled).  The
+        // behavior is undefined unless '0 <= numRecords'.
+
     void releaseRecords();
         // Discard any shared references to 'Record' objects that were supplied
         // to the 'publish' method, and are held by this observer.  Note that
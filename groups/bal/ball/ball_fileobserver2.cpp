@@ -43,6 +43,8 @@ BSLS_IDENT_RCSID(ball_fileobserver2_cpp,"$Id$ $CSID$")
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
 #include <bsl_sstream.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
 
 #include <bsl_c_errno.h>
 #include <bsl_c_time.h>
@@ -399,6 +401,54 @@ static bdlt::Datetime computeNextRotationTime(
                           // -------------------
 
 // PRIVATE MANIPULATORS
+void FileObserver2::checkLogStream()
+{
+    if (!d_logOutStream) {
+        char errorBuffer[k_ERROR_BUFFER_SIZE];
+
+        snprintf(errorBuffer,
+                 sizeof errorBuffer,
+                 "Error on file stream for %s: %s.",
+                 d_logFileName.c_str(),
+                 bsl::strerror(getErrorCode()));
+        bsls::Log::platformDefaultMessageHandler(bsls::LogSeverity::e_ERROR,
+                                                 __FILE__,
+                                                 __LINE__,
+                                                 errorBuffer);
+
+        d_logStreamBuf.clear();
+    }
+}
+
+void FileObserver2::flushExpiredRecords()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (0 != d_recordBuffer.length()
+     && 0 != d_flushInterval.totalMilliseconds()
+     && bdlt::CurrentTime::utc() - d_oldestBufferedTimeUtc >=
+                                                             d_flushInterval) {
+        flushRecordBuffer();
+    }
+}
+
+void FileObserver2::flushRecordBuffer()
+{
+    if (0 == d_recordBuffer.length()) {
+        return;                                                       // RETURN
+    }
+
+    if (d_logStreamBuf.isOpened()) {
+        d_logOutStream.write(d_recordBuffer.data(),
+                             static_cast<bsl::streamsize>(
+                                                     d_recordBuffer.length()));
+        d_logOutStream.flush();
+        checkLogStream();
+    }
+
+    d_recordBuffer.pubseekpos(0);
+}
+
 void FileObserver2::logRecordDefault(bsl::ostream& stream,
                                      const Record& record)
 
@@ -454,6 +504,68 @@ void FileObserver2::logRecordDefault(bsl::ostream& stream,
     stream.flush();
 }
 
+int FileObserver2::publishRecord(bsl::string   *rotatedLogFileName,
+                                 const Record&  record,
+                                 bool           deferWrite)
+{
+    const bdlt::Datetime& timestamp = record.fixedFields().timestamp();
+
+    const int rotationStatus = rotateIfNecessary(rotatedLogFileName,
+                                                 timestamp);
+
+    if (!d_logStreamBuf.isOpened()) {
+        return rotationStatus;                                        // RETURN
+    }
+
+    if (0 == d_bufferSize && !deferWrite) {
+        d_logFileFunctor(d_logOutStream, record);
+        checkLogStream();
+        return rotationStatus;                                        // RETURN
+    }
+
+    if (0 == d_recordBuffer.length()) {
+        d_oldestBufferedTimeUtc = timestamp;
+    }
+
+    d_logFileFunctor(d_recordBufferStream, record);
+
+    if (0 != d_bufferSize
+     && (d_recordBuffer.length() >= static_cast<bsl::size_t>(d_bufferSize)
+      || record.fixedFields().severity() <= d_flushSeverityThreshold
+      || (0 != d_flushInterval.totalMilliseconds()
+       && timestamp - d_oldestBufferedTimeUtc >= d_flushInterval))) {
+        flushRecordBuffer();
+    }
+
+    return rotationStatus;
+}
+
+void FileObserver2::rescheduleFlushEvent()
+{
+    if (!d_flushScheduler_p) {
+        return;                                                       // RETURN
+    }
+
+    // Canceling with 'd_mutex' unlocked lets a running callback complete.
+
+    d_flushScheduler_p->cancelEventAndWait(&d_flushEvent);
+
+    bdlt::DatetimeInterval interval;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        interval = d_flushInterval;
+    }
+
+    if (0 != interval.totalMilliseconds()) {
+        d_flushScheduler_p->scheduleRecurringEvent(
+                 &d_flushEvent,
+                 bdlt::IntervalConversionUtil::convertToTimeInterval(interval),
+                 bdlf::MemFnUtil::memFn(&FileObserver2::flushExpiredRecords,
+                                        this));
+    }
+}
+
 int FileObserver2::rotateFile(bsl::string *rotatedLogFileName)
 {
     BSLS_ASSERT(rotatedLogFileName);
@@ -466,6 +578,8 @@ int FileObserver2::rotateFile(bsl::string *rotatedLogFileName)
 
     int returnStatus = k_ROTATE_SUCCESS;
 
+    flushRecordBuffer();
+
     if (0 != d_logStreamBuf.clear()) {
         char errorBuffer[k_ERROR_BUFFER_SIZE];
 
@@ -560,10 +674,14 @@ int FileObserver2::rotateIfNecessary(bsl::string           *rotatedLogFileName,
 
     if (d_rotationSize) {
         // 'tellp' returns -1 on failure.  Rotate the log file if either
-        // 'tellp' fails, or the rotation size is exceeded.
+        // 'tellp' fails, or the rotation size is exceeded.  Buffered records
+        // are counted as if they had already been written.
+
+        const bsl::streamoff offset = d_logOutStream.tellp();
 
-        if (static_cast<bsls::Types::Uint64>(d_logOutStream.tellp()) >
-            static_cast<bsls::Types::Uint64>(d_rotationSize) * 1024) {
+        if (0 > offset
+         || static_cast<bsls::Types::Uint64>(offset) + d_recordBuffer.length()
+                  > static_cast<bsls::Types::Uint64>(d_rotationSize) * 1024) {
 
             return rotateFile(rotatedLogFileName);                    // RETURN
         }
@@ -585,6 +703,12 @@ FileObserver2::FileObserver2(bslma::Allocator *basicAllocator)
                  false,
                  basicAllocator)
 , d_logOutStream(&d_logStreamBuf)
+, d_recordBuffer(basicAllocator)
+, d_recordBufferStream(&d_recordBuffer)
+, d_bufferSize(0)
+, d_flushSeverityThreshold(Severity::e_ERROR)
+, d_flushInterval(0)
+, d_flushScheduler_p(0)
 , d_logFilePattern(basicAllocator)
 , d_logFileName(basicAllocator)
 , d_logFileFunctor(
@@ -603,17 +727,39 @@ FileObserver2::FileObserver2(bslma::Allocator *basicAllocator)
 
 FileObserver2::~FileObserver2()
 {
+    disableScheduledFlush();
+
     if (d_logStreamBuf.isOpened()) {
+        flushRecordBuffer();
         d_logStreamBuf.clear();
     }
 }
 
 // MANIPULATORS
+void FileObserver2::disableBufferedLogging()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    flushRecordBuffer();
+    d_bufferSize = 0;
+}
+
+void FileObserver2::disableScheduledFlush()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_flushSchedulerMutex);
+
+    if (d_flushScheduler_p) {
+        d_flushScheduler_p->cancelEventAndWait(&d_flushEvent);
+        d_flushScheduler_p = 0;
+    }
+}
+
 void FileObserver2::disableFileLogging()
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
 
     if (d_logStreamBuf.isOpened()) {
+        flushRecordBuffer();
         d_logStreamBuf.clear();
     }
 }
@@ -713,12 +859,50 @@ void FileObserver2::forceRotation()
     }
 }
 
+void FileObserver2::enableBufferedLogging(int bufferSize)
+{
+    BSLS_ASSERT(0 < bufferSize);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (d_recordBuffer.length() >= static_cast<bsl::size_t>(bufferSize)) {
+        flushRecordBuffer();
+    }
+    d_bufferSize = bufferSize;
+
+    // Reserve room for a full buffer plus a record preamble, so that the
+    // record that triggers a size-based flush rarely causes a reallocation.
+
+    d_recordBuffer.reserveCapacity(bufferSize + k_BUFFER_SIZE);
+}
+
 void FileObserver2::enablePublishInLocalTime()
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
     d_publishInLocalTime = true;
 }
 
+void FileObserver2::enableScheduledFlush(bdlmt::EventScheduler *scheduler)
+{
+    BSLS_ASSERT(scheduler);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_flushSchedulerMutex);
+
+    if (d_flushScheduler_p) {
+        d_flushScheduler_p->cancelEventAndWait(&d_flushEvent);
+    }
+    d_flushScheduler_p = scheduler;
+
+    rescheduleFlushEvent();
+}
+
+void FileObserver2::flush()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    flushRecordBuffer();
+}
+
 void FileObserver2::publish(const Record& record, const Context&)
 {
     bsl::string rotatedFileName;
@@ -726,29 +910,8 @@ void FileObserver2::publish(const Record& record, const Context&)
 
     {
         bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-        rotationStatus = rotateIfNecessary(&rotatedFileName,
-                                           record.fixedFields().timestamp());
-
-        if (d_logStreamBuf.isOpened()) {
-            d_logFileFunctor(d_logOutStream, record);
-
-            if (!d_logOutStream) {
-                char errorBuffer[k_ERROR_BUFFER_SIZE];
-
-                snprintf(errorBuffer,
-                         sizeof errorBuffer,
-                         "Error on file stream for %s: %s.",
-                         d_logFileName.c_str(),
-                         bsl::strerror(getErrorCode()));
-                bsls::Log::platformDefaultMessageHandler(
-                                                    bsls::LogSeverity::e_ERROR,
-                                                    __FILE__,
-                                                    __LINE__,
-                                                    errorBuffer);
-
-                d_logStreamBuf.clear();
-            }
-        }
+
+        rotationStatus = publishRecord(&rotatedFileName, record, false);
     }
 
     if (0 >= rotationStatus) {
@@ -760,6 +923,50 @@ void FileObserver2::publish(const Record& record, const Context&)
     }
 }
 
+void FileObserver2::publishBatch(const Record *const *records, int numRecords)
+{
+    BSLS_ASSERT(records || 0 == numRecords);
+    BSLS_ASSERT(0 <= numRecords);
+
+    typedef bsl::pair<int, bsl::string> Rotation;
+
+    bsl::vector<Rotation> rotations;
+    bsl::string           rotatedFileName;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        // The records are staged in the record buffer even if buffered
+        // logging is disabled, so that they reach the log file with a single
+        // write.  A rotation within the batch flushes the records staged so
+        // far to the file being rotated (see 'rotateFile').
+
+        for (int i = 0; i < numRecords; ++i) {
+            const int rotationStatus = publishRecord(&rotatedFileName,
+                                                     *records[i],
+                                                     true);
+            if (0 >= rotationStatus) {
+                rotations.push_back(Rotation(rotationStatus,
+                                             rotatedFileName));
+            }
+        }
+
+        if (0 == d_bufferSize) {
+            flushRecordBuffer();
+        }
+    }
+
+    if (!rotations.empty()) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_rotationCbMutex);
+
+        if (d_onRotationCb) {
+            for (bsl::size_t i = 0; i < rotations.size(); ++i) {
+                d_onRotationCb(rotations[i].first, rotations[i].second);
+            }
+        }
+    }
+}
+
 void FileObserver2::rotateOnLifetime(
                                     const bdlt::DatetimeInterval& timeInterval)
 {
@@ -811,6 +1018,26 @@ void FileObserver2::setLogFileFunctor(const LogRecordFunctor& logFileFunctor)
     d_logFileFunctor = logFileFunctor;
 }
 
+void FileObserver2::setFlushInterval(const bdlt::DatetimeInterval& interval)
+{
+    BSLS_ASSERT(bdlt::DatetimeInterval() <= interval);
+
+    bslmt::LockGuard<bslmt::Mutex> schedulerGuard(&d_flushSchedulerMutex);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        d_flushInterval = interval;
+    }
+
+    rescheduleFlushEvent();
+}
+
+void FileObserver2::setFlushSeverityThreshold(Severity::Level threshold)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    d_flushSeverityThreshold = threshold;
+}
+
 void FileObserver2::setOnFileRotationCallback(
                               const OnFileRotationCallback& onRotationCallback)
 {
@@ -819,6 +1046,34 @@ void FileObserver2::setOnFileRotationCallback(
 }
 
 // ACCESSORS
+int FileObserver2::bufferSize() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_bufferSize;
+}
+
+bdlt::DatetimeInterval FileObserver2::flushInterval() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_flushInterval;
+}
+
+Severity::Level FileObserver2::flushSeverityThreshold() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_flushSeverityThreshold;
+}
+
+bool FileObserver2::isBufferedLoggingEnabled() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return 0 != d_bufferSize;
+}
+
 bool FileObserver2::isFileLoggingEnabled() const
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
@@ -847,6 +1102,13 @@ bool FileObserver2::isPublishInLocalTimeEnabled() const
     return d_publishInLocalTime;
 }
 
+bool FileObserver2::isScheduledFlushEnabled() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_flushSchedulerMutex);
+
+    return 0 != d_flushScheduler_p;
+}
+
 bdlt::DatetimeInterval FileObserver2::localTimeOffset() const
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
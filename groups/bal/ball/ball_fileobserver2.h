@@ -27,15 +27,28 @@ BSLS_IDENT("$Id: $")
 //                         |              disableTimeIntervalRotation
 //                         |              disableSizeRotation
 //                         |              disablePublishInLocalTime
+//                         |              disableBufferedLogging
+//                         |              disableScheduledFlush
 //                         |              enableFileLogging
+//                         |              enableBufferedLogging
+//                         |              enableScheduledFlush
 //                         |              enablePublishInLocalTime
+//                         |              flush
 //                         |              forceRotation
+//                         |              publishBatch
 //                         |              rotateOnSize
 //                         |              rotateOnTimeInterval
 //                         |              setLogFileFunctor
 //                         |              setOnFileRotationCallback
+//                         |              setFlushInterval
+//                         |              setFlushSeverityThreshold
+//                         |              bufferSize
+//                         |              flushInterval
+//                         |              flushSeverityThreshold
+//                         |              isBufferedLoggingEnabled
 //                         |              isFileLoggingEnabled
 //                         |              isPublishInLocalTimeEnabled
+//                         |              isScheduledFlushEnabled
 //                         |              rotationLifetime
 //                         |              rotationSize
 //                         V
@@ -80,6 +93,12 @@ BSLS_IDENT("$Id: $")
 // |             | disableTimeIntervalRotation |                              |
 // |             | setOnFileRotationCallback   |                              |
 // +-------------+-----------------------------+------------------------------+
+// | Buffered    | enableBufferedLogging       | isBufferedLoggingEnabled     |
+// | Logging     | disableBufferedLogging      | bufferSize                   |
+// |             | setFlushSeverityThreshold   | flushSeverityThreshold       |
+// |             | setFlushInterval            | flushInterval                |
+// |             | flush                       |                              |
+// +-------------+-----------------------------+------------------------------+
 //..
 // In general, a 'ball::FileObserver2' object can be dynamically configured
 // throughout its lifetime (in particular, before or after being registered
@@ -238,6 +257,52 @@ BSLS_IDENT("$Id: $")
 // in the filename.  In any case, logging resumes to a new, initially empty,
 // file.
 //
+///Buffered Logging
+///----------------
+// By default, each record received by 'publish' is formatted directly to the
+// log file and flushed, so every record costs at least one 'write' system
+// call.  Calling 'enableBufferedLogging' with a buffer size (in bytes) causes
+// formatted records to be accumulated in an in-memory buffer instead, which is
+// written to the log file with a single call when any of the following flush
+// conditions applies to a newly published record:
+//
+//: o The buffer holds at least 'bufferSize' bytes.
+//:
+//: o The severity of the record is at least as severe as
+//:   'flushSeverityThreshold' ('Severity::e_ERROR' by default), so that
+//:   errors are not held back in memory.
+//:
+//: o 'flushInterval' is non-zero and the timestamp of the record is at least
+//:   'flushInterval' later than that of the oldest buffered record.
+//
+// Buffered records are also written when 'flush' is called, when the log
+// file is rotated or closed, when buffered logging is disabled, and when the
+// observer is destroyed.
+//
+// The time condition above is evaluated only when a record is published, so,
+// by itself, it does not bound how long records stay buffered if the
+// application stops logging.  Calling 'enableScheduledFlush' with a
+// 'bdlmt::EventScheduler' supplied by the application adds a recurring event,
+// dispatched every 'flushInterval', that writes the buffered records once the
+// oldest of them is at least 'flushInterval' old (according to the current
+// UTC time), so that no record stays buffered for much longer than twice the
+// flush interval.  The event is rescheduled when the flush interval changes,
+// and is not scheduled while the flush interval is 0.
+//
+// Independently of buffered logging, 'publishBatch' formats a sequence of
+// records into the in-memory buffer and writes them to the log file with a
+// single call (one per log file, if the file is rotated within the sequence),
+// rather than with one call per record as 'publish' does.  It is intended for
+// observers, such as 'ball::AsyncFileObserver', that receive records in
+// batches.  If buffered logging is enabled, the records are buffered as if
+// each was published by 'publish'.
+//
+// Log file rotation is unaffected by buffering: the size of the log file used
+// by a rotation-on-size rule includes the buffered bytes, and buffered records
+// are written to the log file being rotated before it is closed, so each
+// record ends up in the same file it would have been written to without
+// buffering.
+//
 ///Thread Safety
 ///-------------
 // All methods of 'ball::FileObserver2' are thread-safe, and can be called
@@ -305,8 +370,12 @@ BSLS_IDENT("$Id: $")
 #include <ball_observer.h>
 #include <ball_severity.h>
 
+#include <bdlmt_eventscheduler.h>
+
 #include <bdls_fdstreambuf.h>
 
+#include <bdlsb_memoutstreambuf.h>
+
 #include <bdlt_datetime.h>
 #include <bdlt_datetimeinterval.h>
 
@@ -369,6 +438,54 @@ class FileObserver2 : public Observer {
                                                        // file logging (refers
                                                        // to 'd_logStreamBuf')
 
+    bdlsb::MemOutStreamBuf d_recordBuffer;             // formatted records not
+                                                       // yet written to the
+                                                       // log file (buffered
+                                                       // logging only)
+
+    bsl::ostream           d_recordBufferStream;       // output stream for
+                                                       // buffered logging
+                                                       // (refers to
+                                                       // 'd_recordBuffer')
+
+    int                    d_bufferSize;               // size (in bytes) of
+                                                       // the record buffer
+                                                       // that triggers a
+                                                       // flush, or 0 if
+                                                       // buffered logging is
+                                                       // disabled
+
+    Severity::Level        d_flushSeverityThreshold;   // records at least as
+                                                       // severe as this
+                                                       // trigger a flush
+
+    bdlt::DatetimeInterval d_flushInterval;            // maximum time span of
+                                                       // buffered records, or
+                                                       // 0 if there is no
+                                                       // time-based flush
+
+    bdlt::Datetime         d_oldestBufferedTimeUtc;    // timestamp of the
+                                                       // oldest record in
+                                                       // 'd_recordBuffer'
+
+    bdlmt::EventScheduler *d_flushScheduler_p;         // scheduler of the
+                                                       // periodic flush, or 0
+                                                       // if there is none
+                                                       // (held, not owned)
+
+    bdlmt::EventScheduler::RecurringEventHandle
+                           d_flushEvent;               // periodic flush event
+                                                       // (valid only while
+                                                       // scheduled)
+
+    mutable bslmt::Mutex   d_flushSchedulerMutex;      // serialize access to
+                                                       // 'd_flushScheduler_p'
+                                                       // and 'd_flushEvent';
+                                                       // required because the
+                                                       // event must be
+                                                       // canceled with
+                                                       // 'd_mutex' unlocked
+
     bsl::string            d_logFilePattern;           // log filename pattern
 
     bsl::string            d_logFileName;              // current log filename
@@ -426,10 +543,49 @@ class FileObserver2 : public Observer {
 
   private:
     // PRIVATE MANIPULATORS
+    void checkLogStream();
+        // Report an error, and close the log file, if the log file stream of
+        // this file observer is in a failed state.  The behavior is undefined
+        // unless the caller acquired the lock for this object.
+
+    void flushExpiredRecords();
+        // Write all records held in the record buffer of this file observer
+        // to the log file if the oldest of them was published at least the
+        // flush interval ago, according to the current UTC time.  Note that
+        // this method is the callback of the periodic flush event.
+
+    void flushRecordBuffer();
+        // Write all records held in the record buffer of this file observer
+        // to the log file (if file logging is enabled), and empty the buffer.
+        // The behavior is undefined unless the caller acquired the lock for
+        // this object.
+
     void logRecordDefault(bsl::ostream& stream, const Record& record);
         // Write the specified log 'record' to the specified output 'stream'
         // using the default record format of this file observer.
 
+    int publishRecord(bsl::string   *rotatedLogFileName,
+                      const Record&  record,
+                      bool           deferWrite);
+        // Rotate the log file if necessary (see 'rotateIfNecessary'), loading
+        // into the specified 'rotatedLogFileName' the name of the rotated log
+        // file if a rotation is performed, then, if file logging is enabled,
+        // format the specified 'record' to the log file, or to the record
+        // buffer if buffered logging is enabled or the specified 'deferWrite'
+        // is 'true'.  If buffered logging is enabled, flush the record buffer
+        // if a flush condition applies (see {Buffered Logging}).  Return the
+        // value returned by 'rotateIfNecessary'.  The behavior is undefined
+        // unless the caller acquired the lock for this object.
+
+    void rescheduleFlushEvent();
+        // Cancel the periodic flush event of this file observer, if any, and,
+        // if a scheduler was supplied to 'enableScheduledFlush' and the flush
+        // interval is not 0, schedule it anew to recur every flush interval.
+        // The behavior is undefined unless the caller acquired the lock
+        // serializing access to the scheduler, and not the lock for this
+        // object, and the method is not invoked from the dispatcher thread of
+        // the scheduler.
+
     int rotateFile(bsl::string *rotatedLogFileName);
         // Perform a log file rotation by closing the current log file of this
         // file observer, renaming the closed log file if necessary, and
@@ -439,19 +595,22 @@ class FileObserver2 : public Observer {
         // value otherwise.  The existing log file is renamed if the new log
         // filename, as determined by the 'logFilenamePattern' of the latest
         // call to 'enableFileLogging', is the same as the old log filename.
+        // Any buffered records are written to the current log file before it
+        // is closed.
 
     int rotateIfNecessary(bsl::string           *rotatedLogFileName,
                           const bdlt::Datetime&  currentLogTimeUtc);
         // Perform log file rotation if the specified 'currentLogTimeUtc' is
         // later than the scheduled rotation time of the current log file, or
-        // if the log file is larger than the allowable size, and if a rotation
-        // is performed, load into the specified 'rotatedLogFileName' the name
-        // of the rotated file.  Return 0 if the log file is rotated
-        // successfully, a positive value if a rotation was determined to be
-        // unnecessary, and a negative value otherwise.  The rotation schedule
-        // and the allowable file size are set by the 'rotateOnTimeInterval'
-        // and the 'rotateOnSize' methods, respectively.  The behavior is
-        // undefined unless the caller acquired the lock for this object.
+        // if the log file (including any buffered records) is larger than the
+        // allowable size, and if a rotation is performed, load into the
+        // specified 'rotatedLogFileName' the name of the rotated file.  Return
+        // 0 if the log file is rotated successfully, a positive value if a
+        // rotation was determined to be unnecessary, and a negative value
+        // otherwise.  The rotation schedule and the allowable file size are
+        // set by the 'rotateOnTimeInterval' and the 'rotateOnSize' methods,
+        // respectively.  The behavior is undefined unless the caller acquired
+        // the lock for this object.
 
   public:
     // TRAITS
@@ -469,13 +628,31 @@ class FileObserver2 : public Observer {
         // is in effect for file logging (see 'setLogFileFunctor').
 
     ~FileObserver2();
-        // Close the log file of this file observer if file logging is enabled,
-        // and destroy this file observer.
+        // Cancel the periodic flush event of this file observer, if any, write
+        // any buffered records to, and close, the log file of this file
+        // observer if file logging is enabled, and destroy this file observer.
+        // The behavior is undefined if scheduled flushing is enabled and this
+        // object is destroyed from the dispatcher thread of the scheduler.
 
     // MANIPULATORS
+    void disableBufferedLogging();
+        // Write any buffered records to the log file and disable buffered
+        // logging for this file observer; henceforth, each published record is
+        // written to the log file as it is received.  This method has no
+        // effect if buffered logging is not enabled.
+
+    void disableScheduledFlush();
+        // Cancel the periodic flush event of this file observer, waiting for
+        // its callback to complete if it is running, and stop using the
+        // scheduler supplied to 'enableScheduledFlush'.  This method has no
+        // effect if scheduled flushing is not enabled.  The behavior is
+        // undefined if this method is invoked from the dispatcher thread of
+        // the scheduler.
+
     void disableFileLogging();
         // Disable file logging for this file observer.  This method has no
-        // effect if file logging is not enabled.  Note that records
+        // effect if file logging is not enabled.  Any buffered records are
+        // written to the log file before it is closed.  Note that records
         // subsequently received through the 'publish' method will be dropped
         // until file logging is reenabled.
 
@@ -544,12 +721,39 @@ class FileObserver2 : public Observer {
         // (use the ".%T" pattern to replicate 'true == appendTimestampFlag'
         // behavior).
 
+    void enableBufferedLogging(int bufferSize);
+        // Enable buffered logging for this file observer, writing formatted
+        // records to the log file once the specified 'bufferSize' bytes have
+        // accumulated (or another flush condition applies; see {Buffered
+        // Logging}).  If buffered logging is already enabled, replace the
+        // buffer size in effect, first writing any buffered records if they
+        // amount to at least 'bufferSize' bytes.  The behavior is undefined
+        // unless '0 < bufferSize'.
+
     void enablePublishInLocalTime();
         // Enable publishing of the timestamp attribute of records in local
         // time by this file observer.  This method has no effect if publishing
         // in local time is already enabled.  Note that this method also
         // affects log filenames (see {Log Filename Patterns}).
 
+    void enableScheduledFlush(bdlmt::EventScheduler *scheduler);
+        // Use the specified 'scheduler' to write buffered records to the log
+        // file, every flush interval, once the oldest of them is at least the
+        // flush interval old, whether or not further records are published
+        // (see {Buffered Logging}).  If scheduled flushing is already
+        // enabled, the scheduler in use is replaced.  The behavior is
+        // undefined unless 'scheduler' is started (so that it dispatches
+        // events) and remains valid until 'disableScheduledFlush' is called
+        // or this object is destroyed, and this method is not invoked from
+        // the dispatcher thread of the scheduler.  Note that this setting has
+        // no effect while the flush interval is 0 or buffered logging is not
+        // enabled.
+
+    void flush();
+        // Write any records held in the record buffer of this file observer
+        // to the log file.  This method has no effect if buffered logging is
+        // not enabled or no records are buffered.
+
     void publish(const Record& record, const Context& context);
         // Process the specified log 'record' having the specified publishing
         // 'context' by writing 'record' and 'context' to the current log file
@@ -565,6 +769,14 @@ class FileObserver2 : public Observer {
         // enabled for this file observer.  The method has no effect if file
         // logging is not enabled, in which case 'record' is dropped.
 
+    void publishBatch(const Record *const *records, int numRecords);
+        // Process the specified 'numRecords' log records addressed by the
+        // specified 'records' array, in order, as if by calling 'publish' for
+        // each, except that, if buffered logging is not enabled, the records
+        // are written to the log file with a single call (one per log file if
+        // the log file is rotated between two of them) before this method
+        // returns.  The behavior is undefined unless '0 <= numRecords'.
+
     void releaseRecords();
         // Discard any shared references to 'Record' objects that were supplied
         // to the 'publish' method, and are held by this observer.  Note that
@@ -617,6 +829,23 @@ class FileObserver2 : public Observer {
         // behavior.
 
 
+    void setFlushInterval(const bdlt::DatetimeInterval& interval);
+        // Set the maximum span between the timestamps of the oldest buffered
+        // record and a newly published record, beyond which this file
+        // observer flushes its record buffer, to the specified 'interval'.  A
+        // 0 'interval' disables the time-based flush condition (the default).
+        // The behavior is undefined unless '0 <= interval', and this method is
+        // not invoked from the dispatcher thread of the scheduler supplied to
+        // 'enableScheduledFlush' (if any).  Note that this setting has no
+        // effect unless buffered logging is enabled.
+
+    void setFlushSeverityThreshold(Severity::Level threshold);
+        // Set this file observer to flush its record buffer upon publishing a
+        // record at least as severe as the specified 'threshold'.  Note that
+        // 'Severity::e_OFF' disables the severity-based flush condition.
+        // Also note that this setting has no effect unless buffered logging
+        // is enabled.
+
     void setOnFileRotationCallback(
                              const OnFileRotationCallback& onRotationCallback);
         // Set the specified 'onRotationCallback' to be invoked after each time
@@ -627,6 +856,24 @@ class FileObserver2 : public Observer {
         // write to the 'ball' log).
 
     // ACCESSORS
+    int bufferSize() const;
+        // Return the size (in bytes) of buffered records that will trigger a
+        // flush by this file observer if buffered logging is enabled, and 0
+        // otherwise.
+
+    bdlt::DatetimeInterval flushInterval() const;
+        // Return the time span of buffered records that will trigger a flush
+        // by this file observer, or a 0 time interval if there is no
+        // time-based flush condition.
+
+    Severity::Level flushSeverityThreshold() const;
+        // Return the severity at or above which a published record triggers a
+        // flush by this file observer.
+
+    bool isBufferedLoggingEnabled() const;
+        // Return 'true' if buffered logging is enabled for this file observer,
+        // and 'false' otherwise.
+
     bool isFileLoggingEnabled() const;
     bool isFileLoggingEnabled(bsl::string *result) const;
         // Return 'true' if file logging is enabled for this file observer, and
@@ -643,6 +890,10 @@ class FileObserver2 : public Observer {
         // value returned by this method also affects log filenames (see {Log
         // Filename Patterns}).
 
+    bool isScheduledFlushEnabled() const;
+        // Return 'true' if this file observer uses a scheduler to flush its
+        // record buffer periodically, and 'false' otherwise.
+
     bdlt::DatetimeInterval rotationLifetime() const;
         // Return the lifetime of the log file that will trigger a file
         // rotation by this file observer if rotation-on-lifetime is in effect,
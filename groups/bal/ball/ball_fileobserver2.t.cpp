@@ -12,6 +12,7 @@
 #include <ball_userfieldvalue.h>
 
 #include <bdlb_tokenizer.h>
+#include <bdlmt_eventscheduler.h>
 
 #include <bdls_filesystemutil.h>
 #include <bdls_pathutil.h>
@@ -52,6 +53,7 @@
 #include <bsl_iomanip.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 
 #ifdef BSLS_PLATFORM_OS_UNIX
 #include <glob.h>
@@ -91,6 +93,8 @@ using bsl::flush;
 // [ 1] ~FileObserver2();
 //
 // MANIPULATORS
+// [14] void disableBufferedLogging();
+// [16] void disableScheduledFlush();
 // [ 1] void disableFileLogging();
 // [ 2] void disableLifetimeRotation();
 // [ 1] void disablePublishInLocalTime();
@@ -98,25 +102,40 @@ using bsl::flush;
 // [ 8] void disableTimeIntervalRotation();
 // [ 1] int  enableFileLogging(const char *fileName);
 // [ 1] int  enableFileLogging(const char *fileName, bool timestampFlag);
+// [14] void enableBufferedLogging(int bufferSize);
+// [16] void enableScheduledFlush(bdlmt::EventScheduler *scheduler);
 // [ 1] void enablePublishInLocalTime();
+// [14] void flush();
 // [ 1] void publish(const Record& record, const Context& context);
 // [ 1] void publish(const shared_ptr<Record>&, const Context&);
+// [15] void publishBatch(const Record *const *records, int numRecords);
 // [ 2] void forceRotation();
 // [ 2] void rotateOnSize(int size);
 // [ 2] void rotateOnLifetime(DatetimeInterval& interval);
 // [ 8] void rotateOnTimeInterval(const DatetimeInterval& interval);
 // [ 9] void rotateOnTimeInterval(const DtInterval& i, const Datetime& s);
+// [14] void setFlushInterval(const DatetimeInterval& interval);
+// [14] void setFlushSeverityThreshold(Severity::Level threshold);
 // [ 1] void setLogFileFunctor(const logRecordFunctor& logFileFunctor);
 // [ 5] void setOnFileRotationCallback(const OnFileRotationCallback&);
 //
 // ACCESSORS
+// [14] int bufferSize() const;
+// [14] DatetimeInterval flushInterval() const;
+// [14] Severity::Level flushSeverityThreshold() const;
+// [14] bool isBufferedLoggingEnabled() const;
 // [ 1] bool isFileLoggingEnabled() const;
 // [ 1] bool isFileLoggingEnabled(bsl::string *result) const;
 // [ 1] bool isPublishInLocalTimeEnabled() const;
+// [16] bool isScheduledFlushEnabled() const;
 // [ 2] DatetimeInterval rotationLifetime() const;
 // [ 2] int rotationSize() const;
 // ----------------------------------------------------------------------------
-// [13] USAGE EXAMPLE
+// [17] USAGE EXAMPLE
+// [16] CONCERN: SCHEDULED FLUSH WRITES EXPIRED RECORDS
+// [15] CONCERN: A BATCH IS WRITTEN WITH A SINGLE WRITE
+// [14] CONCERN: BUFFERED RECORDS ARE FLUSHED AS CONFIGURED
+// [14] CONCERN: BUFFERING DOES NOT AFFECT ROTATION-ON-SIZE
 // [12] CONCERN: CURRENT LOCAL-TIME OFFSET IN TIMESTAMP
 // [11] CONCERN: TIME CALLBACKS ARE CALLED
 // [10] CONCERN: ROTATION CAN BE ENABLED AFTER FILE LOGGING
@@ -556,6 +575,75 @@ void publishRecord(Obj *observer, const char *message)
     observer->publish(record, context);
 }
 
+void publishRecord(Obj                   *observer,
+                   const char            *message,
+                   ball::Severity::Level  severity,
+                   const bdlt::Datetime&  timestamp)
+    // Publish the specified 'message' having the specified 'severity' and
+    // 'timestamp' to the specified 'observer' object.
+{
+    ball::RecordAttributes attr(timestamp,
+                               1,
+                               2,
+                               "FILENAME",
+                               3,
+                               "CATEGORY",
+                               severity,
+                               message);
+
+    ball::Record  record(attr, ball::UserFields());
+    ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+    observer->publish(record, context);
+}
+
+Int64 getFileSize(const bsl::string& fileName)
+    // Return the size of the file having the specified 'fileName', or 0 if
+    // the file does not exist.
+{
+    const Int64 size = FsUtil::getFileSize(fileName);
+    return 0 > size ? 0 : size;
+}
+
+class FileSizeRecorder {
+    // This class can be used as a functor matching the signature of
+    // 'ball::FileObserver2::LogRecordFunctor'.  Each invocation of the
+    // function-call operator appends the size of the file having the name
+    // supplied at construction to the vector supplied at construction, then
+    // formats the record as a line of 'k_LINE_LENGTH' characters.  This class
+    // is intended to observe when the formatted records reach the log file.
+
+    // DATA
+    const bsl::string  *d_fileName_p;  // name of the observed file
+    bsl::vector<Int64> *d_sizes_p;     // size of the file at each invocation
+
+  public:
+    // PUBLIC CONSTANTS
+    enum { k_LINE_LENGTH = 100 };
+
+    // CREATORS
+    FileSizeRecorder(const bsl::string *fileName, bsl::vector<Int64> *sizes)
+        // Create a formatter that records the size of the file having the
+        // specified 'fileName' into the specified 'sizes' on each invocation.
+    : d_fileName_p(fileName)
+    , d_sizes_p(sizes)
+    {
+    }
+
+    // ACCESSORS
+    void operator()(bsl::ostream& stream, const ball::Record&) const
+        // Append the current size of the observed file to the vector supplied
+        // at construction, and write a line of 'k_LINE_LENGTH' characters,
+        // including the terminating newline, to the specified 'stream'.
+    {
+        d_sizes_p->push_back(getFileSize(*d_fileName_p));
+
+        for (int i = 1; i < k_LINE_LENGTH; ++i) {
+            stream.put('x');
+        }
+        stream.put('\n');
+    }
+};
 
 int getNumLines(const char *fileName)
     // Return the number of lines in the file with the specified 'fileName'.
@@ -712,7 +800,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 14: {
+      case 17: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -787,6 +875,788 @@ int main(int argc, char *argv[])
         ASSERT(0 == rc);
 //..
 
+      } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING SCHEDULED FLUSH
+        //
+        // Concerns:
+        //: 1 Scheduled flushing is disabled by default, and is enabled and
+        //:   disabled by 'enableScheduledFlush' and 'disableScheduledFlush'.
+        //:
+        //: 2 Once scheduled flushing is enabled, buffered records are written
+        //:   to the log file when the oldest of them is at least the flush
+        //:   interval old, without further records being published.
+        //:
+        //: 3 Records younger than the flush interval remain buffered.
+        //:
+        //: 4 No flush is scheduled while the flush interval is 0, and setting
+        //:   a non-zero interval schedules it.
+        //:
+        //: 5 After 'disableScheduledFlush', records remain buffered.
+        //:
+        //: 6 The observer can be destroyed while scheduled flushing is
+        //:   enabled.
+        //
+        // Plan:
+        //: 1 Verify 'isScheduledFlushEnabled' after construction, and after
+        //:   each call to 'enableScheduledFlush' and 'disableScheduledFlush'.
+        //:   (C-1)
+        //:
+        //: 2 Enable buffered and scheduled flushing with a short flush
+        //:   interval, publish a record having the current time, and verify
+        //:   that the log file is written within a few seconds.  (C-2)
+        //:
+        //: 3 Publish a record having a timestamp in the future, wait for
+        //:   several flush intervals, and verify that the log file is
+        //:   unchanged.  (C-3)
+        //:
+        //: 4 Publish a record with a flush interval of 0, wait, and verify
+        //:   the log file is unchanged; then set a short interval and verify
+        //:   that the record is written.  (C-4)
+        //:
+        //: 5 Disable scheduled flushing, publish a record, wait, and verify
+        //:   the log file is unchanged.  (C-5)
+        //:
+        //: 6 Let an observer having scheduled flushing enabled go out of
+        //:   scope before the scheduler is stopped.  (C-6)
+        //
+        // Testing:
+        //   void disableScheduledFlush();
+        //   void enableScheduledFlush(bdlmt::EventScheduler *scheduler);
+        //   bool isScheduledFlushEnabled() const;
+        //   CONCERN: SCHEDULED FLUSH WRITES EXPIRED RECORDS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING SCHEDULED FLUSH"
+                          << "\n=======================" << endl;
+
+        typedef ball::Severity Sev;
+
+        // Records are expected to be flushed within two 'INTERVAL's; waiting
+        // for 'WAIT_US' microseconds shows that they are not, and waiting for
+        // 'MAX_WAIT_US' accommodates a loaded test machine.
+
+        const bdlt::DatetimeInterval INTERVAL(0, 0, 0, 0, 100);
+        const int                    WAIT_US     =  5 * 100 * 1000;
+        const int                    MAX_WAIT_US = 10 * 1000 * 1000;
+
+        bslma::TestAllocator ta("ta", veryVeryVeryVerbose);
+
+        bdlmt::EventScheduler scheduler(&ta);
+        ASSERT(0 == scheduler.start());
+
+        if (veryVerbose) cout << "\tTesting enable and disable." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(false == X.isScheduledFlushEnabled());
+
+            mX.enableScheduledFlush(&scheduler);
+            ASSERT(true  == X.isScheduledFlushEnabled());
+
+            mX.enableScheduledFlush(&scheduler);
+            ASSERT(true  == X.isScheduledFlushEnabled());
+
+            mX.disableScheduledFlush();
+            ASSERT(false == X.isScheduledFlushEnabled());
+
+            mX.disableScheduledFlush();
+            ASSERT(false == X.isScheduledFlushEnabled());
+        }
+
+        if (veryVerbose) cout << "\tTesting flush of expired records."
+                              << endl;
+        {
+            TempDirectoryGuard tempDirGuard(&ta);
+            bsl::string        fileName(tempDirGuard.getTempDirName(), &ta);
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            Obj mX(&ta);
+
+            mX.enableBufferedLogging(1024 * 1024);
+            mX.setFlushSeverityThreshold(Sev::e_OFF);
+            mX.setFlushInterval(INTERVAL);
+            mX.enableScheduledFlush(&scheduler);
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            // A record timestamped in the future is not old enough to be
+            // flushed.
+
+            const bdlt::Datetime future = bdlt::CurrentTime::utc() +
+                                                bdlt::DatetimeInterval(0, 1);
+
+            publishRecord(&mX, "future", Sev::e_INFO, future);
+
+            bslmt::ThreadUtil::microSleep(WAIT_US);
+
+            ASSERT(0 == getFileSize(fileName));
+
+            mX.flush();
+
+            const Int64 SIZE = getFileSize(fileName);
+            ASSERT(0 < SIZE);
+
+            // A record timestamped now is flushed after one interval.
+
+            publishRecord(&mX, "now", Sev::e_INFO, bdlt::CurrentTime::utc());
+
+            for (int waited = 0;
+                 waited < MAX_WAIT_US && SIZE == getFileSize(fileName);
+                 waited += 10 * 1000) {
+                bslmt::ThreadUtil::microSleep(10 * 1000);
+            }
+
+            ASSERTV(getFileSize(fileName), SIZE < getFileSize(fileName));
+            ASSERT(2 * 2 == getNumLines(fileName.c_str()));
+
+            // The observer is destroyed with scheduled flushing enabled.
+        }
+
+        if (veryVerbose) cout << "\tTesting changes of the flush interval."
+                              << endl;
+        {
+            TempDirectoryGuard tempDirGuard(&ta);
+            bsl::string        fileName(tempDirGuard.getTempDirName(), &ta);
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            Obj mX(&ta);
+
+            mX.enableBufferedLogging(1024 * 1024);
+            mX.setFlushSeverityThreshold(Sev::e_OFF);
+            mX.enableScheduledFlush(&scheduler);
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            publishRecord(&mX, "first", Sev::e_INFO, bdlt::CurrentTime::utc());
+
+            bslmt::ThreadUtil::microSleep(WAIT_US);
+
+            ASSERT(0 == getFileSize(fileName));
+
+            mX.setFlushInterval(INTERVAL);
+
+            for (int waited = 0;
+                 waited < MAX_WAIT_US && 0 == getFileSize(fileName);
+                 waited += 10 * 1000) {
+                bslmt::ThreadUtil::microSleep(10 * 1000);
+            }
+
+            ASSERT(0 < getFileSize(fileName));
+
+            const Int64 SIZE = getFileSize(fileName);
+
+            mX.disableScheduledFlush();
+
+            publishRecord(&mX,
+                          "second",
+                          Sev::e_INFO,
+                          bdlt::CurrentTime::utc());
+
+            bslmt::ThreadUtil::microSleep(WAIT_US);
+
+            ASSERT(SIZE == getFileSize(fileName));
+
+            mX.flush();
+
+            ASSERT(SIZE <  getFileSize(fileName));
+            ASSERT(2 * 2 == getNumLines(fileName.c_str()));
+        }
+
+        scheduler.stop();
+      } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING 'publishBatch'
+        //
+        // Concerns:
+        //: 1 If buffered logging is disabled, the records of a batch are
+        //:   written to the log file, in order, with a single write after all
+        //:   of them are formatted.
+        //:
+        //: 2 If the log file is rotated within a batch, the records preceding
+        //:   the rotation are written to the rotated file, the following
+        //:   records to the new file, and the rotation callback is invoked.
+        //:
+        //: 3 If buffered logging is enabled, the records of a batch are
+        //:   buffered as if published one at a time.
+        //:
+        //: 4 An empty batch has no effect.
+        //
+        // Plan:
+        //: 1 Install a log file functor that records the size of the log file
+        //:   each time it formats a record.  Publish a batch of records and
+        //:   verify that the size of the file did not change while the batch
+        //:   was formatted, and that every record is in the file afterwards.
+        //:   (C-1)
+        //:
+        //: 2 Rotate on size such that a rotation occurs in the middle of a
+        //:   batch, publish the batch, and verify the number of records in
+        //:   the rotated and the new log files, and the callback status.
+        //:   (C-2)
+        //:
+        //: 3 Enable buffered logging with a large buffer, publish a batch, and
+        //:   verify that the records reach the file only on 'flush'.  (C-3)
+        //:
+        //: 4 Publish an empty batch and verify the file is unchanged.  (C-4)
+        //
+        // Testing:
+        //   void publishBatch(const Record *const *records, int numRecords);
+        //   CONCERN: A BATCH IS WRITTEN WITH A SINGLE WRITE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'publishBatch'"
+                          << "\n======================" << endl;
+
+        const Int64 LINE = FileSizeRecorder::k_LINE_LENGTH;
+
+        enum { k_NUM_RECORDS = 15 };
+
+        bslma::TestAllocator ta("ta", veryVeryVeryVerbose);
+
+        bsl::vector<ball::Record> records(&ta);
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            ball::RecordAttributes attr(bdlt::CurrentTime::utc(),
+                                        1,
+                                        2,
+                                        "FILENAME",
+                                        3,
+                                        "CATEGORY",
+                                        ball::Severity::e_INFO,
+                                        "message",
+                                        &ta);
+
+            records.push_back(ball::Record(attr, ball::UserFields(), &ta));
+        }
+
+        const ball::Record *BATCH[k_NUM_RECORDS];
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            BATCH[i] = &records[i];
+        }
+
+        if (veryVerbose) cout << "\tTesting a single write." << endl;
+        {
+            TempDirectoryGuard tempDirGuard(&ta);
+            bsl::string        fileName(tempDirGuard.getTempDirName(), &ta);
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            bsl::vector<Int64> sizes(&ta);
+
+            Obj mX(&ta);
+
+            mX.setLogFileFunctor(FileSizeRecorder(&fileName, &sizes));
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            mX.publishBatch(BATCH, k_NUM_RECORDS);
+
+            ASSERTV(sizes.size(), k_NUM_RECORDS == sizes.size());
+            for (bsl::size_t i = 0; i < sizes.size(); ++i) {
+                ASSERTV(i, sizes[i], 0 == sizes[i]);
+            }
+            ASSERTV(getFileSize(fileName),
+                    k_NUM_RECORDS * LINE == getFileSize(fileName));
+            ASSERT(k_NUM_RECORDS == getNumLines(fileName.c_str()));
+
+            if (veryVerbose) cout << "\tTesting an empty batch." << endl;
+
+            sizes.clear();
+
+            mX.publishBatch(BATCH, 0);
+
+            ASSERT(0 == sizes.size());
+            ASSERT(k_NUM_RECORDS * LINE == getFileSize(fileName));
+
+            mX.disableFileLogging();
+        }
+
+        if (veryVerbose) cout << "\tTesting rotation within a batch."
+                              << endl;
+        {
+            TempDirectoryGuard tempDirGuard(&ta);
+            bsl::string        fileName(tempDirGuard.getTempDirName(), &ta);
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            bsl::vector<Int64> sizes(&ta);
+            RotCb              cb(&ta);
+
+            Obj mX(&ta);
+
+            mX.setLogFileFunctor(FileSizeRecorder(&fileName, &sizes));
+            mX.setOnFileRotationCallback(cb);
+            mX.rotateOnSize(1);
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            // The file is rotated before formatting the first record that
+            // finds more than 1K in the file and the record buffer.
+
+            const int NUM_BEFORE = static_cast<int>(1024 / LINE) + 1;
+
+            mX.publishBatch(BATCH, k_NUM_RECORDS);
+
+            ASSERTV(cb.numInvocations(), 1 == cb.numInvocations());
+            ASSERTV(cb.status(),         0 == cb.status());
+
+            const bsl::string& rotatedFileName = cb.rotatedFileName();
+
+            ASSERTV(rotatedFileName, rotatedFileName != fileName);
+            ASSERTV(getNumLines(rotatedFileName.c_str()),
+                    NUM_BEFORE == getNumLines(rotatedFileName.c_str()));
+            ASSERTV(getNumLines(fileName.c_str()),
+                    k_NUM_RECORDS - NUM_BEFORE ==
+                                              getNumLines(fileName.c_str()));
+
+            mX.disableFileLogging();
+        }
+
+        if (veryVerbose) cout << "\tTesting buffered logging." << endl;
+        {
+            TempDirectoryGuard tempDirGuard(&ta);
+            bsl::string        fileName(tempDirGuard.getTempDirName(), &ta);
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            bsl::vector<Int64> sizes(&ta);
+
+            Obj mX(&ta);
+
+            mX.setLogFileFunctor(FileSizeRecorder(&fileName, &sizes));
+            mX.enableBufferedLogging(1024 * 1024);
+            mX.setFlushSeverityThreshold(ball::Severity::e_OFF);
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            mX.publishBatch(BATCH, k_NUM_RECORDS);
+
+            ASSERT(k_NUM_RECORDS == sizes.size());
+            ASSERT(0             == getFileSize(fileName));
+
+            mX.flush();
+
+            ASSERT(k_NUM_RECORDS * LINE == getFileSize(fileName));
+
+            mX.disableFileLogging();
+        }
+      } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING BUFFERED LOGGING
+        //
+        // Concerns:
+        //: 1 Buffered logging is disabled by default, the default flush
+        //:   severity threshold is 'e_ERROR', and there is no time-based
+        //:   flush by default.
+        //:
+        //: 2 The buffered logging attributes can be set and are reported by
+        //:   the corresponding accessors.
+        //:
+        //: 3 When buffered logging is enabled, records are not written to the
+        //:   log file until a flush condition applies, and are then written
+        //:   in full.
+        //:
+        //: 4 Each flush condition (buffer size, severity, time span of
+        //:   buffered records) triggers a flush.
+        //:
+        //: 5 'flush', 'disableBufferedLogging', 'disableFileLogging',
+        //:   'forceRotation', and the destructor write all buffered records.
+        //:
+        //: 6 A log file rotated on size contains the same records whether or
+        //:   not buffered logging is enabled.
+        //
+        // Plan:
+        //: 1 Create an observer and verify the default values of the buffered
+        //:   logging attributes.  Set each attribute and verify the result
+        //:   using the accessors.  (C-1..2)
+        //:
+        //: 2 Enable buffered logging with a flush severity threshold of
+        //:   'e_OFF', publish records, and verify that the log file remains
+        //:   empty until the buffer size is reached.  (C-3..4)
+        //:
+        //: 3 Publish records having a severity less and more severe than the
+        //:   flush threshold, and verify that only the latter flush the
+        //:   buffer.  (C-4)
+        //:
+        //: 4 Set a flush interval and publish records having explicit
+        //:   timestamps, and verify that a flush occurs once the span of
+        //:   buffered timestamps reaches the interval.  (C-4)
+        //:
+        //: 5 Buffer records, invoke each of the methods in C-5, and verify
+        //:   that the log file contains all buffered records.  (C-5)
+        //:
+        //: 6 Publish the same sequence of records to two observers rotating
+        //:   on size, one buffered and one not, and verify that both rotate
+        //:   the same number of times and produce log files of the same size.
+        //:   (C-6)
+        //
+        // Testing:
+        //   void disableBufferedLogging();
+        //   void enableBufferedLogging(int bufferSize);
+        //   void flush();
+        //   void setFlushInterval(const DatetimeInterval& interval);
+        //   void setFlushSeverityThreshold(Severity::Level threshold);
+        //   int bufferSize() const;
+        //   DatetimeInterval flushInterval() const;
+        //   Severity::Level flushSeverityThreshold() const;
+        //   bool isBufferedLoggingEnabled() const;
+        //   CONCERN: BUFFERED RECORDS ARE FLUSHED AS CONFIGURED
+        //   CONCERN: BUFFERING DOES NOT AFFECT ROTATION-ON-SIZE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING BUFFERED LOGGING"
+                          << "\n========================" << endl;
+
+        typedef ball::Severity Sev;
+
+        // Note that the default record format begins and ends each record
+        // with a newline, so that each record spans two lines of the log
+        // file.
+
+        if (veryVerbose) cout << "\tTesting default values and accessors."
+                              << endl;
+        {
+            bslma::TestAllocator ta("ta", veryVeryVeryVerbose);
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(false                    == X.isBufferedLoggingEnabled());
+            ASSERT(0                        == X.bufferSize());
+            ASSERT(Sev::e_ERROR             == X.flushSeverityThreshold());
+            ASSERT(bdlt::DatetimeInterval() == X.flushInterval());
+
+            mX.enableBufferedLogging(4096);
+
+            ASSERT(true                     == X.isBufferedLoggingEnabled());
+            ASSERT(4096                     == X.bufferSize());
+
+            mX.enableBufferedLogging(100);
+
+            ASSERT(true                     == X.isBufferedLoggingEnabled());
+            ASSERT(100                      == X.bufferSize());
+
+            mX.setFlushSeverityThreshold(Sev::e_WARN);
+            ASSERT(Sev::e_WARN              == X.flushSeverityThreshold());
+
+            mX.setFlushInterval(bdlt::DatetimeInterval(0, 0, 0, 5));
+            ASSERT(bdlt::DatetimeInterval(0, 0, 0, 5) == X.flushInterval());
+
+            mX.setFlushInterval(bdlt::DatetimeInterval());
+            ASSERT(bdlt::DatetimeInterval() == X.flushInterval());
+
+            mX.disableBufferedLogging();
+
+            ASSERT(false                    == X.isBufferedLoggingEnabled());
+            ASSERT(0                        == X.bufferSize());
+            ASSERT(Sev::e_WARN              == X.flushSeverityThreshold());
+        }
+
+        const bdlt::Datetime now = bdlt::CurrentTime::utc();
+
+        if (veryVerbose) cout << "\tTesting size-based flush." << endl;
+        {
+            bslma::TestAllocator ta("ta", veryVeryVeryVerbose);
+
+            TempDirectoryGuard tempDirGuard(&ta);
+            bsl::string        fileName(tempDirGuard.getTempDirName(), &ta);
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            Obj mX(&ta);
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            // Determine the size of a formatted record.
+
+            publishRecord(&mX, "message", Sev::e_INFO, now);
+
+            const Int64 RECORD_SIZE = getFileSize(fileName);
+            ASSERTV(RECORD_SIZE, 0 < RECORD_SIZE);
+
+            const int NUM_RECORDS = 10;
+
+            mX.enableBufferedLogging(static_cast<int>(RECORD_SIZE) *
+                                                                  NUM_RECORDS);
+            mX.setFlushSeverityThreshold(Sev::e_OFF);
+
+            for (int i = 1; i < NUM_RECORDS; ++i) {
+                publishRecord(&mX, "message", Sev::e_INFO, now);
+
+                ASSERTV(i, RECORD_SIZE == getFileSize(fileName));
+            }
+
+            publishRecord(&mX, "message", Sev::e_INFO, now);
+
+            ASSERTV(getFileSize(fileName),
+                    RECORD_SIZE * (NUM_RECORDS + 1) == getFileSize(fileName));
+            ASSERT(2 * (NUM_RECORDS + 1) == getNumLines(fileName.c_str()));
+
+            // Reducing the buffer size below the amount buffered flushes.
+
+            publishRecord(&mX, "message", Sev::e_INFO, now);
+            publishRecord(&mX, "message", Sev::e_INFO, now);
+
+            ASSERT(RECORD_SIZE * (NUM_RECORDS + 1) == getFileSize(fileName));
+
+            mX.enableBufferedLogging(static_cast<int>(RECORD_SIZE));
+
+            ASSERT(RECORD_SIZE * (NUM_RECORDS + 3) == getFileSize(fileName));
+
+            mX.disableFileLogging();
+        }
+
+        if (veryVerbose) cout << "\tTesting severity-based flush." << endl;
+        {
+            bslma::TestAllocator ta("ta", veryVeryVeryVerbose);
+
+            TempDirectoryGuard tempDirGuard(&ta);
+            bsl::string        fileName(tempDirGuard.getTempDirName(), &ta);
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            Obj mX(&ta);
+
+            mX.enableBufferedLogging(1024 * 1024);
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            publishRecord(&mX, "info",  Sev::e_INFO, now);
+            publishRecord(&mX, "warn",  Sev::e_WARN, now);
+
+            ASSERT(0 == getFileSize(fileName));
+
+            publishRecord(&mX, "error", Sev::e_ERROR, now);
+
+            ASSERT(2 * 3 == getNumLines(fileName.c_str()));
+
+            publishRecord(&mX, "fatal", Sev::e_FATAL, now);
+
+            ASSERT(2 * 4 == getNumLines(fileName.c_str()));
+
+            mX.setFlushSeverityThreshold(Sev::e_WARN);
+
+            publishRecord(&mX, "info",  Sev::e_INFO, now);
+
+            ASSERT(2 * 4 == getNumLines(fileName.c_str()));
+
+            publishRecord(&mX, "warn",  Sev::e_WARN, now);
+
+            ASSERT(2 * 6 == getNumLines(fileName.c_str()));
+
+            mX.setFlushSeverityThreshold(Sev::e_OFF);
+
+            publishRecord(&mX, "fatal", Sev::e_FATAL, now);
+
+            ASSERT(2 * 6 == getNumLines(fileName.c_str()));
+
+            mX.flush();
+
+            ASSERT(2 * 7 == getNumLines(fileName.c_str()));
+
+            mX.disableFileLogging();
+        }
+
+        if (veryVerbose) cout << "\tTesting time-based flush." << endl;
+        {
+            bslma::TestAllocator ta("ta", veryVeryVeryVerbose);
+
+            TempDirectoryGuard tempDirGuard(&ta);
+            bsl::string        fileName(tempDirGuard.getTempDirName(), &ta);
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            Obj mX(&ta);
+
+            mX.enableBufferedLogging(1024 * 1024);
+            mX.setFlushSeverityThreshold(Sev::e_OFF);
+            mX.setFlushInterval(bdlt::DatetimeInterval(0, 0, 0, 1));
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            bdlt::Datetime timestamp(now);
+
+            const bdlt::DatetimeInterval HALF_SECOND(0, 0, 0, 0, 500);
+
+            publishRecord(&mX, "first", Sev::e_INFO, timestamp);
+            timestamp += HALF_SECOND;
+            publishRecord(&mX, "second", Sev::e_INFO, timestamp);
+
+            ASSERT(0 == getFileSize(fileName));
+
+            timestamp += HALF_SECOND;
+            publishRecord(&mX, "third", Sev::e_INFO, timestamp);
+
+            ASSERT(2 * 3 == getNumLines(fileName.c_str()));
+
+            // The span is measured from the oldest record buffered since the
+            // last flush.
+
+            timestamp += HALF_SECOND;
+            publishRecord(&mX, "fourth", Sev::e_INFO, timestamp);
+
+            ASSERT(2 * 3 == getNumLines(fileName.c_str()));
+
+            timestamp += HALF_SECOND;
+            publishRecord(&mX, "fifth", Sev::e_INFO, timestamp);
+
+            ASSERT(2 * 3 == getNumLines(fileName.c_str()));
+
+            timestamp += HALF_SECOND;
+            publishRecord(&mX, "sixth", Sev::e_INFO, timestamp);
+
+            ASSERT(2 * 6 == getNumLines(fileName.c_str()));
+
+            mX.disableFileLogging();
+        }
+
+        if (veryVerbose) cout << "\tTesting explicit flushes." << endl;
+        {
+            bslma::TestAllocator ta("ta", veryVeryVeryVerbose);
+
+            TempDirectoryGuard tempDirGuard(&ta);
+            bsl::string        fileName(tempDirGuard.getTempDirName(), &ta);
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            {
+                Obj mX(&ta);
+
+                mX.enableBufferedLogging(1024 * 1024);
+                mX.setFlushSeverityThreshold(Sev::e_OFF);
+
+                ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+                publishRecord(&mX, "flush", Sev::e_INFO, now);
+                ASSERT(0 == getFileSize(fileName));
+
+                mX.flush();
+                ASSERT(2 * 1 == getNumLines(fileName.c_str()));
+
+                mX.flush();
+                ASSERT(2 * 1 == getNumLines(fileName.c_str()));
+
+                publishRecord(&mX, "disable", Sev::e_INFO, now);
+                ASSERT(2 * 1 == getNumLines(fileName.c_str()));
+
+                mX.disableBufferedLogging();
+                ASSERT(2 * 2 == getNumLines(fileName.c_str()));
+
+                // Records are written immediately once buffering is disabled.
+
+                publishRecord(&mX, "unbuffered", Sev::e_INFO, now);
+                ASSERT(2 * 3 == getNumLines(fileName.c_str()));
+
+                mX.enableBufferedLogging(1024 * 1024);
+
+                publishRecord(&mX, "close", Sev::e_INFO, now);
+                ASSERT(2 * 3 == getNumLines(fileName.c_str()));
+
+                mX.disableFileLogging();
+                ASSERT(2 * 4 == getNumLines(fileName.c_str()));
+
+                // Records published while file logging is disabled are
+                // dropped.
+
+                publishRecord(&mX, "dropped", Sev::e_INFO, now);
+                mX.flush();
+                ASSERT(2 * 4 == getNumLines(fileName.c_str()));
+
+                ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+                publishRecord(&mX, "destroy", Sev::e_INFO, now);
+                ASSERT(2 * 4 == getNumLines(fileName.c_str()));
+            }
+            ASSERT(2 * 5 == getNumLines(fileName.c_str()));
+
+            {
+                Obj mX(&ta);
+
+                RotCb cb(&ta);
+                mX.setOnFileRotationCallback(cb);
+
+                mX.enableBufferedLogging(1024 * 1024);
+                mX.setFlushSeverityThreshold(Sev::e_OFF);
+
+                ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+                publishRecord(&mX, "rotate", Sev::e_INFO, now);
+
+                mX.forceRotation();
+
+                ASSERTV(cb.numInvocations(), 1 == cb.numInvocations());
+                ASSERTV(cb.status(), 0 == cb.status());
+
+                ASSERT(0 == getFileSize(fileName));
+                ASSERT(2 * 6 == getNumLines(cb.rotatedFileName().c_str()));
+
+                mX.disableFileLogging();
+            }
+        }
+
+        if (veryVerbose) cout << "\tTesting rotation-on-size." << endl;
+        {
+            bslma::TestAllocator ta("ta", veryVeryVeryVerbose);
+
+            TempDirectoryGuard tempDirGuard(&ta);
+
+            bsl::string unbufferedName(tempDirGuard.getTempDirName(), &ta);
+            bdls::PathUtil::appendRaw(&unbufferedName, "unbuffered");
+
+            bsl::string bufferedName(tempDirGuard.getTempDirName(), &ta);
+            bdls::PathUtil::appendRaw(&bufferedName, "buffered");
+
+            Obj mU(&ta);
+            Obj mB(&ta);
+
+            RotCb cbU(&ta);
+            RotCb cbB(&ta);
+
+            mU.setOnFileRotationCallback(cbU);
+            mB.setOnFileRotationCallback(cbB);
+
+            // Rotate every kilobyte.
+
+            mU.rotateOnSize(1);
+            mB.rotateOnSize(1);
+
+            mB.enableBufferedLogging(400);
+            mB.setFlushSeverityThreshold(Sev::e_FATAL);
+
+            ASSERT(0 == mU.enableFileLogging(unbufferedName.c_str()));
+            ASSERT(0 == mB.enableFileLogging(bufferedName.c_str()));
+
+            bsl::string message(&ta);
+
+            for (int i = 0; i < 200; ++i) {
+                // Vary both the record length and the severity, so that
+                // flushes happen at varying positions in the log file.
+
+                message.assign(i % 37, 'x');
+
+                const Sev::Level severity = 0 == i % 11
+                                            ? Sev::e_FATAL
+                                            : Sev::e_INFO;
+
+                publishRecord(&mU, message.c_str(), severity, now);
+                publishRecord(&mB, message.c_str(), severity, now);
+
+                ASSERTV(i, cbU.numInvocations(), cbB.numInvocations(),
+                        cbU.numInvocations() == cbB.numInvocations());
+
+                if (0 != cbB.numInvocations()) {
+                    // The rotated file of the buffered observer must contain
+                    // exactly the records of the unbuffered one.
+
+                    ASSERTV(i,
+                            getFileSize(cbU.rotatedFileName()) ==
+                                          getFileSize(cbB.rotatedFileName()));
+
+                    cbU.reset();
+                    cbB.reset();
+                }
+            }
+
+            mB.flush();
+
+            ASSERTV(getFileSize(unbufferedName), getFileSize(bufferedName),
+                    getFileSize(unbufferedName) == getFileSize(bufferedName));
+
+            mU.disableFileLogging();
+            mB.disableFileLogging();
+        }
+
       } break;
       case 13: {
         // --------------------------------------------------------------------
@@ -24,7 +24,9 @@ BSLS_IDENT_RCSID(ball_loggermanager_cpp,"$Id$ $CSID$")
 
 #include <bslma_default.h>
 #include <bslma_managedptr.h>
+#include <bslma_newdeleteallocator.h>
 
+#include <bslmt_lockguard.h>
 #include <bslmt_mutex.h>
 #include <bslmt_once.h>
 #include <bslmt_qlock.h>
@@ -33,6 +35,7 @@ BSLS_IDENT_RCSID(ball_loggermanager_cpp,"$Id$ $CSID$")
 #include <bslmt_writelockguard.h>
 
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
 #include <bsls_log.h>
 #include <bsls_objectbuffer.h>
 #include <bsls_platform.h>
@@ -97,6 +100,53 @@ BSLS_IDENT_RCSID(ball_loggermanager_cpp,"$Id$ $CSID$")
 //      // ...
 //  }
 //..
+//
+///Per-Thread Record and Buffer Caches
+///-----------------------------------
+// Both 'd_recordPool' and 'd_bufferPool' are thread-safe, but every
+// allocation from, and release to, either of them is an atomic operation on
+// state shared by all of the threads logging through a 'Logger', and the
+// scratch buffer used by the 'BALL_LOGVA' macros was, historically, guarded by
+// a single mutex.  To keep threads that log concurrently from contending, each
+// 'Logger' associates a 'Logger::ThreadCache' with every thread that uses it.
+// A cache holds:
+//
+//: o up to 'k_NUM_CACHED_RECORDS' cleared records, which 'getRecord' hands out
+//:   before falling back to 'd_recordPool', and to which 'releaseRecord'
+//:   returns the records released (by 'RecordDeleter') on that thread,
+//:
+//: o one spare message buffer, reused by 'obtainMessageBuffer(int *)', and
+//:
+//: o a private scratch buffer and mutex, handed out by
+//:   'obtainMessageBuffer(bslmt::Mutex **, int *)'; the mutex is kept only to
+//:   preserve the contract of that method and is never contended.
+//
+// Thread-specific storage keys are a limited, process-wide resource, so a
+// single key, created on first use and never deleted, is shared by all loggers
+// (of all logger managers).  Its value in each thread is the list of the
+// caches of that thread, one for each logger the thread has used, linked
+// through 'd_nextInThread_p'.  As the key is never deleted, its destructor
+// ('destroyThreadCaches') is invoked for every thread that has a cache, and
+// the memory of a cache is always freed by its own thread: by
+// 'destroyThreadCaches' when the thread exits, or by 'threadCache' once the
+// logger owning the cache has been destroyed.  Caches are allocated from the
+// 'bslma::NewDeleteAllocator', as they may outlive the allocator of their
+// logger.
+//
+// The caches of a 'Logger' are also linked, through 'd_next_p' and
+// 'd_prev_p', into a 'Logger::ThreadCacheList', so that the logger can account
+// for cached records in 'numRecordsInUse', and can reclaim the records and
+// buffers held by the caches of threads that are still running when it is
+// destroyed.  The list is shared, through a 'bsl::shared_ptr' held by the
+// logger and by each of its caches, so that its mutex remains valid for a
+// thread exiting while, or after, the logger is destroyed.  The destructor of
+// the logger, holding the mutex, drains each cache in the list and marks it
+// 'd_orphaned'; 'destroyThreadCaches', holding the same mutex, drains and
+// unlinks a cache only if it is not orphaned.  So each cache is drained
+// exactly once, and neither the logger nor an exiting thread accesses memory
+// that the other has freed.  Should the key not be available, all requests go
+// directly to the shared pools and the shared scratch buffer, as they did
+// before the caches were introduced.
 // ----------------------------------------------------------------------------
 
 namespace BloombergLP {
@@ -153,14 +203,11 @@ bool isCategoryEnabled(ball::ThresholdAggregate *levels,
     // threshold levels of 'category', and 'false' otherwise.
 
 {
-    if (category.relevantRuleMask()) {
+    if (category.loadThresholdLevels(levels)) {
         ball::AttributeContext *context = ball::AttributeContext::getContext();
         context->determineThresholdLevels(levels, &category);
-        int threshold = ball::ThresholdAggregate::maxLevel(*levels);
-        return threshold >= severity;                                 // RETURN
     }
-    *levels = category.thresholdLevels();
-    return category.maxLevel() >= severity;
+    return ball::ThresholdAggregate::maxLevel(*levels) >= severity;
 }
 
 inline static
@@ -269,8 +316,92 @@ void copyAttributesWithoutMessage(ball::Record                  *record,
 
 const char *const k_INTERNAL_OBSERVER_NAME = "__oBsErVeR__";
 
+enum {
+    k_NUM_CACHED_RECORDS = 8  // maximum number of records held by the cache
+                              // of one thread
+};
+
+bslma::Allocator *threadCacheAllocator()
+    // Return the allocator supplying the memory of the per-thread caches of
+    // all loggers.
+{
+    return &bslma::NewDeleteAllocator::singleton();
+}
+
 }  // close unnamed namespace
 
+                         // ==========================
+                         // struct Logger::ThreadCache
+                         // ==========================
+
+struct Logger::ThreadCacheList {
+    // This 'struct' holds the list of the caches of one 'Logger', and outlives
+    // the logger for as long as any of those caches exists.
+
+    // DATA
+    bslmt::Mutex  d_mutex;    // guards 'd_head_p', the links of the caches
+                              // in the list, and their 'd_orphaned' flags
+
+    ThreadCache  *d_head_p;   // first cache of the logger, or 0
+
+    // CREATORS
+    ThreadCacheList()
+    : d_head_p(0)
+    {
+    }
+};
+
+                         // ==========================
+                         // struct Logger::ThreadCache
+                         // ==========================
+
+struct Logger::ThreadCache {
+    // This 'struct' holds the records and message buffers cached by a 'Logger'
+    // for one thread.  Apart from the links and 'd_orphaned' flag guarded by
+    // 'd_list->d_mutex', and 'd_numRecords' (which is read by
+    // 'numRecordsInUse'), it is accessed only by the thread owning it.
+
+    // DATA
+    Logger          *d_logger_p;       // logger owning this cache, valid
+                                       // unless 'd_orphaned'
+
+    bsl::shared_ptr<ThreadCacheList>
+                     d_list;           // list of the caches of 'd_logger_p'
+
+    ThreadCache     *d_next_p;         // next cache of 'd_logger_p'
+
+    ThreadCache     *d_prev_p;         // previous cache of 'd_logger_p'
+
+    ThreadCache     *d_nextInThread_p; // next cache of the same thread
+
+    bsls::AtomicBool d_orphaned;       // 'true' once 'd_logger_p' has been
+                                       // destroyed
+
+    bslmt::Mutex     d_scratchBufferMutex;
+                                       // handed out with 'd_scratchBuffer_p'
+
+    char            *d_scratchBuffer_p;
+                                       // scratch buffer of this thread, from
+                                       // 'd_logger_p->d_bufferPool', or 0
+
+    char            *d_spareBuffer_p;  // released message buffer, or 0
+
+    bsls::AtomicInt  d_numRecords;     // number of records in 'd_records'
+
+    Record          *d_records[k_NUM_CACHED_RECORDS];
+                                       // cleared records ready for reuse
+};
+
+                        // ----------------------------
+                        // struct Logger::RecordDeleter
+                        // ----------------------------
+
+// ACCESSORS
+void Logger::RecordDeleter::operator()(Record *record) const
+{
+    d_logger_p->releaseRecord(record);
+}
+
                            // ------------
                            // class Logger
                            // ------------
@@ -303,6 +434,10 @@ Logger::Logger(const bsl::shared_ptr<Observer>&            observer,
 
     d_scratchBuffer_p = (char *)d_allocator_p->allocate(d_scratchBufferSize);
     d_bufferPool.reserveCapacity(4);
+
+    if (threadCacheKey()) {
+        d_threadCaches.createInplace(threadCacheAllocator());
+    }
 }
 
 Logger::~Logger()
@@ -315,10 +450,111 @@ Logger::~Logger()
 
     d_observer->releaseRecords();
     d_recordBuffer_p->removeAll();
+
+    if (d_threadCaches) {
+        // Reclaim the contents of the caches of the threads that are still
+        // running.  Each such thread frees the memory of its cache when it
+        // exits (or uses another logger), and must not access this logger
+        // then.
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_threadCaches->d_mutex);
+
+        while (d_threadCaches->d_head_p) {
+            ThreadCache *cache         = d_threadCaches->d_head_p;
+            d_threadCaches->d_head_p = cache->d_next_p;
+
+            drainThreadCache(cache);
+            cache->d_orphaned.store(true);
+        }
+    }
+
     d_allocator_p->deallocate(d_scratchBuffer_p);
 }
 
+// PRIVATE CLASS METHODS
+const bslmt::ThreadUtil::Key *Logger::threadCacheKey()
+{
+    static bslmt::ThreadUtil::Key s_threadCacheKey;
+    static bool                   s_isValid = false;
+
+    BSLMT_ONCE_DO {
+        s_isValid = 0 == bslmt::ThreadUtil::createKey(
+                                         &s_threadCacheKey,
+                                         (bslmt::ThreadUtil::Destructor)
+                                         &Logger::destroyThreadCaches);
+    }
+    return s_isValid ? &s_threadCacheKey : 0;
+}
+
+void Logger::destroyThreadCaches(void *caches)
+{
+    ThreadCache *cache = static_cast<ThreadCache *>(caches);
+
+    while (cache) {
+        ThreadCache *next = cache->d_nextInThread_p;
+
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&cache->d_list->d_mutex);
+
+            if (!cache->d_orphaned.load()) {
+                Logger *logger = cache->d_logger_p;
+
+                if (cache->d_prev_p) {
+                    cache->d_prev_p->d_next_p = cache->d_next_p;
+                }
+                else {
+                    cache->d_list->d_head_p = cache->d_next_p;
+                }
+                if (cache->d_next_p) {
+                    cache->d_next_p->d_prev_p = cache->d_prev_p;
+                }
+
+                logger->drainThreadCache(cache);
+            }
+        }
+
+        threadCacheAllocator()->deleteObjectRaw(cache);
+        cache = next;
+    }
+}
+
+void Logger::releaseMessageBuffer(void *buffer, void *logger)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(logger);
+
+    Logger      *self  = static_cast<Logger *>(logger);
+    ThreadCache *cache = self->threadCache();
+
+    if (cache && !cache->d_spareBuffer_p) {
+        cache->d_spareBuffer_p = static_cast<char *>(buffer);
+    }
+    else {
+        self->d_bufferPool.deallocate(buffer);
+    }
+}
+
 // PRIVATE MANIPULATORS
+void Logger::drainThreadCache(ThreadCache *cache)
+{
+    BSLS_ASSERT(cache);
+
+    const int numRecords = cache->d_numRecords.loadRelaxed();
+    for (int i = 0; i < numRecords; ++i) {
+        d_recordPool.deleteObject(cache->d_records[i]);
+    }
+    cache->d_numRecords.storeRelaxed(0);
+
+    if (cache->d_scratchBuffer_p) {
+        d_bufferPool.deallocate(cache->d_scratchBuffer_p);
+        cache->d_scratchBuffer_p = 0;
+    }
+    if (cache->d_spareBuffer_p) {
+        d_bufferPool.deallocate(cache->d_spareBuffer_p);
+        cache->d_spareBuffer_p = 0;
+    }
+}
+
 void Logger::logMessage(const Category&            category,
                         int                        severity,
                         Record                    *record,
@@ -338,7 +574,8 @@ void Logger::logMessage(const Category&            category,
         d_populator(&record->customFields());
     }
 
-    bsl::shared_ptr<Record> handle(record, &d_recordPool, d_allocator_p);
+    RecordDeleter           deleter = { this };
+    bsl::shared_ptr<Record> handle(record, deleter, d_allocator_p);
 
     if (levels.recordLevel() >= severity) {
         d_recordBuffer_p->pushBack(handle);
@@ -366,9 +603,8 @@ void Logger::logMessage(const Category&            category,
             Record *marker = getRecord(record->fixedFields().fileName(),
                                        record->fixedFields().lineNumber());
 
-            bsl::shared_ptr<Record> handle(marker,
-                                           &d_recordPool,
-                                           d_allocator_p);
+            RecordDeleter           deleter = { this };
+            bsl::shared_ptr<Record> handle(marker, deleter, d_allocator_p);
 
             copyAttributesWithoutMessage(handle.get(), record->fixedFields());
 
@@ -400,9 +636,8 @@ void Logger::logMessage(const Category&            category,
             Record *marker = getRecord(record->fixedFields().fileName(),
                                        record->fixedFields().lineNumber());
 
-            bsl::shared_ptr<Record> handle(marker,
-                                           &d_recordPool,
-                                           d_allocator_p);
+            RecordDeleter           deleter = { this };
+            bsl::shared_ptr<Record> handle(marker, deleter, d_allocator_p);
 
             copyAttributesWithoutMessage(handle.get(), record->fixedFields());
 
@@ -457,14 +692,103 @@ void Logger::publish(Transmission::Cause cause)
     d_recordBuffer_p->endSequence();
 }
 
+void Logger::releaseRecord(Record *record)
+{
+    BSLS_ASSERT(record);
+
+    ThreadCache *cache = threadCache();
+
+    if (cache) {
+        const int numRecords = cache->d_numRecords.loadRelaxed();
+        if (numRecords < k_NUM_CACHED_RECORDS) {
+            record->clear();
+            cache->d_records[numRecords] = record;
+            cache->d_numRecords.storeRelaxed(numRecords + 1);
+            return;                                                   // RETURN
+        }
+    }
+    d_recordPool.deleteObject(record);
+}
+
+Logger::ThreadCache *Logger::threadCache()
+{
+    if (!d_threadCaches) {
+        return 0;                                                     // RETURN
+    }
+
+    const bslmt::ThreadUtil::Key& key = *threadCacheKey();
+
+    ThreadCache *head = static_cast<ThreadCache *>(
+                                          bslmt::ThreadUtil::getSpecific(key));
+
+    // Look for the cache of this logger, freeing the caches (other than the
+    // first, which is replaced below) of the loggers that have been destroyed.
+
+    for (ThreadCache *prev = 0, *cache = head; cache; ) {
+        if (!cache->d_orphaned.load()) {
+            if (cache->d_list == d_threadCaches) {
+                return cache;                                         // RETURN
+            }
+        }
+        else if (prev) {
+            prev->d_nextInThread_p = cache->d_nextInThread_p;
+            threadCacheAllocator()->deleteObjectRaw(cache);
+            cache = prev->d_nextInThread_p;
+            continue;                                               // CONTINUE
+        }
+        prev  = cache;
+        cache = cache->d_nextInThread_p;
+    }
+
+    const bool isHeadOrphaned = head && head->d_orphaned.load();
+
+    ThreadCache *cache = new (*threadCacheAllocator()) ThreadCache();
+    cache->d_logger_p        = this;
+    cache->d_list            = d_threadCaches;
+    cache->d_prev_p          = 0;
+    cache->d_nextInThread_p  = isHeadOrphaned ? head->d_nextInThread_p : head;
+    cache->d_scratchBuffer_p = 0;
+    cache->d_spareBuffer_p   = 0;
+
+    if (0 != bslmt::ThreadUtil::setSpecific(key, cache)) {
+        threadCacheAllocator()->deleteObjectRaw(cache);
+        return 0;                                                     // RETURN
+    }
+
+    if (isHeadOrphaned) {
+        threadCacheAllocator()->deleteObjectRaw(head);
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_threadCaches->d_mutex);
+
+    cache->d_next_p = d_threadCaches->d_head_p;
+    if (d_threadCaches->d_head_p) {
+        d_threadCaches->d_head_p->d_prev_p = cache;
+    }
+    d_threadCaches->d_head_p = cache;
+
+    return cache;
+}
+
 // MANIPULATORS
 Record *Logger::getRecord(const char *file, int line)
 {
-    Record *record = d_recordPool.getObject();
+    Record      *record = 0;
+    ThreadCache *cache  = threadCache();
+
+    if (cache && 0 < cache->d_numRecords.loadRelaxed()) {
+        const int numRecords = cache->d_numRecords.loadRelaxed() - 1;
+        record = cache->d_records[numRecords];
+        cache->d_numRecords.storeRelaxed(numRecords);
+    }
+    else {
+        record = d_recordPool.getObject();
+    }
 
-    // Note that the records obtained from the record pool are guaranteed to
-    // have all custom fields removed and the message stream cleared.  So only
-    // the filename and line number fields are initialized here.
+    // Note that the records obtained from the record pool (or the thread
+    // cache) are guaranteed to have all custom fields removed and the message
+    // stream cleared.  So only the filename and line number fields are
+    // initialized here.
 
     record->fixedFields().setFileName(file);
     record->fixedFields().setLineNumber(line);
@@ -496,7 +820,7 @@ void Logger::logMessage(const Category&  category,
 {
     ThresholdAggregate thresholds;
     if (!isCategoryEnabled(&thresholds, category, severity)) {
-        d_recordPool.deleteObject(record);
+        releaseRecord(record);
         return;                                                       // RETURN
     }
     logMessage(category, severity, record, thresholds);
@@ -504,24 +828,64 @@ void Logger::logMessage(const Category&  category,
 
 char *Logger::obtainMessageBuffer(bslmt::Mutex **mutex, int *bufferSize)
 {
-    d_scratchBufferMutex.lock();
-    *mutex      = &d_scratchBufferMutex;
     *bufferSize = d_scratchBufferSize;
+
+    ThreadCache *cache = threadCache();
+
+    if (cache) {
+        if (!cache->d_scratchBuffer_p) {
+            cache->d_scratchBuffer_p =
+                                  static_cast<char *>(d_bufferPool.allocate());
+        }
+        cache->d_scratchBufferMutex.lock();
+        *mutex = &cache->d_scratchBufferMutex;
+        return cache->d_scratchBuffer_p;                              // RETURN
+    }
+
+    d_scratchBufferMutex.lock();
+    *mutex = &d_scratchBufferMutex;
     return d_scratchBuffer_p;
 }
 
 bslma::ManagedPtr<char> Logger::obtainMessageBuffer(int *bufferSize)
 {
     *bufferSize = d_scratchBufferSize;
-    char *buffer = static_cast<char *>(d_bufferPool.allocate());
 
-    bslma::ManagedPtr<char> bufferManagedPtr(
-                                      buffer,
-                                      static_cast<void *>(&d_bufferPool),
-                                      bufferPoolDeleter);
+    ThreadCache *cache  = threadCache();
+    char        *buffer = 0;
+
+    if (cache && cache->d_spareBuffer_p) {
+        buffer                 = cache->d_spareBuffer_p;
+        cache->d_spareBuffer_p = 0;
+    }
+    else {
+        buffer = static_cast<char *>(d_bufferPool.allocate());
+    }
+
+    bslma::ManagedPtr<char> bufferManagedPtr(buffer,
+                                             static_cast<void *>(this),
+                                             &Logger::releaseMessageBuffer);
     return bufferManagedPtr;
 }
 
+// ACCESSORS
+int Logger::numRecordsInUse() const
+{
+    int numCached = 0;
+    if (d_threadCaches) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_threadCaches->d_mutex);
+
+        for (const ThreadCache *cache = d_threadCaches->d_head_p;
+             cache;
+             cache = cache->d_next_p) {
+            numCached += cache->d_numRecords.loadRelaxed();
+        }
+    }
+    return d_recordPool.numObjects()
+         - d_recordPool.numAvailableObjects()
+         - numCached;
+}
+
                            // -------------------
                            // class LoggerManager
                            // -------------------
@@ -1424,14 +1788,12 @@ void LoggerManager::setDefaultThresholdLevelsCallback(
 bool LoggerManager::isCategoryEnabled(const Category *category,
                                       int             severity) const
 {
-    if (category->relevantRuleMask()) {
+    ThresholdAggregate levels;
+    if (category->loadThresholdLevels(&levels)) {
         AttributeContext *context = AttributeContext::getContext();
-        ThresholdAggregate levels;
         context->determineThresholdLevels(&levels, category);
-        int threshold = ThresholdAggregate::maxLevel(levels);
-        return threshold >= severity;                                 // RETURN
     }
-    return category->maxLevel() >= severity;
+    return ThresholdAggregate::maxLevel(levels) >= severity;
 }
 
 const Category *LoggerManager::lookupCategory(const char *categoryName) const
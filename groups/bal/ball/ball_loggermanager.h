@@ -333,6 +333,13 @@ BSLS_IDENT("$Id: $")
 // have them share a common logger so that the trace-back log *does* include
 // all relevant records.
 //
+// A logger shared by many threads does not serialize them: each logger keeps,
+// for each thread that uses it, a small cache of the log records and message
+// buffers most recently released by that thread.  'getRecord' and
+// 'obtainMessageBuffer' are satisfied from the cache of the calling thread
+// when possible, and records and buffers are returned to the shared pools of
+// the logger only when a cache overflows or its thread exits.
+//
 ///'bsls::Log' Logging Redirection
 ///-------------------------------
 // The 'ball::LoggerManager' singleton, on construction, redirects 'bsls::Log'
@@ -886,6 +893,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmt_mutex.h>
 #include <bslmt_readerwritermutex.h>
+#include <bslmt_threadutil.h>
 
 #include <bsls_compilerfeatures.h>
 
@@ -925,6 +933,29 @@ class Logger {
         // all loggers that are allocated by the logger manager.
 
   private:
+    // PRIVATE TYPES
+    struct ThreadCache;
+        // Records and message buffers cached for one thread using this logger
+        // (defined in the implementation file).
+
+    struct ThreadCacheList;
+        // List of the caches of this logger, shared with those caches
+        // (defined in the implementation file).
+
+    struct RecordDeleter {
+        // This 'struct' provides a deleter, for the shared pointers to records
+        // published by this logger, that releases records to the cache of the
+        // calling thread.
+
+        // DATA
+        Logger *d_logger_p;  // logger owning the record (held, not owned)
+
+        // ACCESSORS
+        void operator()(Record *record) const;
+            // Release the specified 'record' to the logger supplied at
+            // construction.
+    };
+
     // DATA
     bdlcc::ObjectPool<Record,
                       bdlcc::ObjectPoolFunctors::DefaultCreator,
@@ -957,6 +988,11 @@ class Logger {
 
     int           d_scratchBufferSize;          // message buffer size (bytes)
 
+    bsl::shared_ptr<ThreadCacheList>
+                  d_threadCaches;               // caches of all threads, or
+                                                // empty if per-thread caching
+                                                // is not available
+
     LoggerManagerConfiguration::LogOrder
                   d_logOrder;                   // logging order
 
@@ -1001,7 +1037,31 @@ class Logger {
     ~Logger();
         // Destroy this logger.
 
+    // PRIVATE CLASS METHODS
+    static void destroyThreadCaches(void *caches);
+        // Return the records and buffers held by each cache in the specified
+        // 'caches' list of the calling thread to the logger owning it, unless
+        // that logger has been destroyed, and destroy the caches.  The
+        // behavior is undefined unless 'caches' is 0 or refers to the first
+        // 'ThreadCache' of the calling thread.  Note that this function is
+        // invoked by the threading library when a thread that used a logger
+        // exits.
+
+    static const bslmt::ThreadUtil::Key *threadCacheKey();
+        // Return the address of the thread-specific storage key, shared by all
+        // loggers, holding the list of caches of each thread, or 0 if the key
+        // could not be created.
+
+    static void releaseMessageBuffer(void *buffer, void *logger);
+        // Release the specified 'buffer' to the specified 'logger'.  The
+        // behavior is undefined unless 'logger' refers to a 'Logger' and
+        // 'buffer' was obtained from 'logger' by 'obtainMessageBuffer'.
+
     // PRIVATE MANIPULATORS
+    void drainThreadCache(ThreadCache *cache);
+        // Return the records and buffers held by the specified 'cache' to the
+        // pools of this logger.
+
     void logMessage(const Category&            category,
                     int                        severity,
                     Record                    *record,
@@ -1033,6 +1093,16 @@ class Logger {
         // the record buffer of this logger and indicate to the observer the
         // specified publication 'cause'.
 
+    void releaseRecord(Record *record);
+        // Return the specified 'record' to the cache of the calling thread,
+        // or to the record pool of this logger if that cache is full.  The
+        // behavior is undefined unless 'record' was obtained from this logger
+        // by 'getRecord'.
+
+    ThreadCache *threadCache();
+        // Return the address of the cache of the calling thread, creating it
+        // if necessary, or 0 if per-thread caching is not available.
+
   public:
     // MANIPULATORS
     Record *getRecord(const char *file, int line);
@@ -1109,8 +1179,9 @@ class Logger {
         // thread calls 'mutex->unlock()'.  The behavior is undefined if this
         // thread of execution currently holds a lock on the buffer.  Note that
         // the buffer is intended to be used *only* for formatting log messages
-        // immediately before calling 'logMessage'; other use may adversely
-        // affect performance for the entire program.
+        // immediately before calling 'logMessage'.  Also note that each thread
+        // is normally given a buffer (and mutex) of its own, so that threads
+        // do not wait on one another.
 
     bslma::ManagedPtr<char> obtainMessageBuffer(int *bufferSize);
         // Return a managed pointer that refers to the memory block to which
@@ -1134,7 +1205,8 @@ class Logger {
     int numRecordsInUse() const;
         // Return a *snapshot* of number of records that have been dispensed by
         // 'getRecord' but have not yet been supplied (returned) using
-        // 'logRecord'.
+        // 'logRecord'.  Note that records held in the per-thread caches of
+        // this logger are not in use.
 };
 
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED
@@ -2109,12 +2181,6 @@ int Logger::messageBufferSize() const
     return d_scratchBufferSize;
 }
 
-inline
-int Logger::numRecordsInUse() const
-{
-    return d_recordPool.numObjects() - d_recordPool.numAvailableObjects();
-}
-
                         // -------------------
                         // class LoggerManager
                         // -------------------
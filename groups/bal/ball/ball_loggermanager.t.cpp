@@ -115,6 +115,9 @@ using namespace bdlf::PlaceHolders;
 // [16] void removeAll();
 // [16] int messageBufferSize() const;
 // [35] int numRecordsInUse() const;
+// [44] ball::Record *getRecord(const char *file, int line);
+// [44] char *obtainMessageBuffer(bslmt::Mutex **mutex, int *bufferSize);
+// [44] ManagedPtr<char> obtainMessageBuffer(int *bufferSize);
 //
 // 'ball::LoggerManager' private interface (tested indirectly):
 // [16] void publishAllImp(ball::Transmission::Cause cause);
@@ -198,6 +201,8 @@ using namespace bdlf::PlaceHolders;
 // [20] TESTING CONCURRENT ACCESS TO 'd_loggers'
 // [21] TESTING CONCURRENT ACCESS TO 'd_defaultLoggers'
 // [22] TESTING CONCURRENT ACCESS TO 'setCategory'
+// [44] TESTING PER-THREAD RECORD AND BUFFER CACHES
+// [-3] CONCERN: CONTENTION AMONG LOGGING THREADS
 // [23] TESTING CONCURRENT ACCESS TO 'initSingleton'
 // [24] TESTING CONCURRENT ACCESS TO 'lookupCategory'
 // [25] TBD
@@ -1650,6 +1655,198 @@ class TestObserverVisitor {
 
 }  // close namespace TEST_CASE_OBSERVER_VISITOR
 
+namespace BALL_LOGGERMANAGER_TEST_THREAD_CACHE {
+
+class NullObserver : public ball::Observer {
+    // This concrete implementation of 'ball::Observer' ignores the records
+    // published to it, and holds no state, so that any number of threads can
+    // publish to it without contending.
+
+  public:
+    // MANIPULATORS
+    using Observer::publish;   // Avoid hiding base class method.
+
+    void publish(const bsl::shared_ptr<const ball::Record>&,
+                 const ball::Context&)
+        // Do nothing.
+    {
+    }
+
+    void releaseRecords()
+        // Do nothing.
+    {
+    }
+};
+
+struct ThreadArgs {
+    // This 'struct' holds the arguments of the thread functions of this
+    // namespace.
+
+    ball::Logger          *d_logger_p;      // logger to use
+    const ball::Category  *d_category_p;    // category to log to
+    ball::Record         **d_records_p;     // records to obtain or release
+    int                    d_numRecords;    // number of records in
+                                            // 'd_records_p', or to log
+    bslmt::Barrier        *d_barrier_p;     // barrier to wait on, or 0
+    char                  *d_buffer_p;      // buffer obtained by the thread
+    bslmt::Mutex          *d_mutex_p;       // mutex obtained by the thread
+};
+
+extern "C" {
+
+    void *obtainRecordsThread(void *args)
+        // Obtain 'd_numRecords' records from the logger specified by 'args',
+        // loading their addresses into 'd_records_p'.
+    {
+        ThreadArgs *p = static_cast<ThreadArgs *>(args);
+
+        for (int i = 0; i < p->d_numRecords; ++i) {
+            p->d_records_p[i] = p->d_logger_p->getRecord(__FILE__, __LINE__);
+        }
+        return 0;
+    }
+
+    void *obtainScratchBufferThread(void *args)
+        // Obtain (and release) the scratch buffer of the logger specified by
+        // 'args', loading its address, and the address of its mutex, into
+        // 'd_buffer_p' and 'd_mutex_p'.
+    {
+        ThreadArgs *p = static_cast<ThreadArgs *>(args);
+
+        int bufferSize;
+        p->d_buffer_p = p->d_logger_p->obtainMessageBuffer(&p->d_mutex_p,
+                                                           &bufferSize);
+        p->d_mutex_p->unlock();
+        return 0;
+    }
+
+    void *logThread(void *args)
+        // Log 'd_numRecords' messages to the logger and category specified by
+        // 'args', using both kinds of message buffer, and then, if
+        // 'd_barrier_p' is not 0, wait on that barrier twice.
+    {
+        ThreadArgs *p = static_cast<ThreadArgs *>(args);
+
+        for (int i = 0; i < p->d_numRecords; ++i) {
+            int bufferSize;
+            {
+                bslma::ManagedPtr<char> buffer =
+                               p->d_logger_p->obtainMessageBuffer(&bufferSize);
+                bsl::snprintf(buffer.get(), bufferSize, "message %d", i);
+                p->d_logger_p->logMessage(*p->d_category_p,
+                                          ball::Severity::e_ERROR,
+                                          __FILE__,
+                                          __LINE__,
+                                          buffer.get());
+            }
+
+            bslmt::Mutex *mutex;
+            char *buffer = p->d_logger_p->obtainMessageBuffer(&mutex,
+                                                              &bufferSize);
+            bsl::snprintf(buffer, bufferSize, "message %d", i);
+            p->d_logger_p->logMessage(*p->d_category_p,
+                                      ball::Severity::e_ERROR,
+                                      __FILE__,
+                                      __LINE__,
+                                      buffer);
+            mutex->unlock();
+        }
+
+        // 'args' may be destroyed once the first wait returns.
+
+        bslmt::Barrier *barrier = p->d_barrier_p;
+        if (barrier) {
+            barrier->wait();
+            barrier->wait();
+        }
+        return 0;
+    }
+
+    void *benchmarkStreamThread(void *args)
+        // Log 'd_numRecords' records to the logger and category specified by
+        // 'args' as the 'BALL_LOG_*' stream macros do, after waiting on
+        // 'd_barrier_p'.
+    {
+        ThreadArgs *p = static_cast<ThreadArgs *>(args);
+
+        p->d_barrier_p->wait();
+        for (int i = 0; i < p->d_numRecords; ++i) {
+            ball::Record *record = p->d_logger_p->getRecord(__FILE__,
+                                                            __LINE__);
+            bsl::ostream os(&record->fixedFields().messageStreamBuf());
+            os << "message " << i;
+            p->d_logger_p->logMessage(*p->d_category_p,
+                                      ball::Severity::e_ERROR,
+                                      record);
+        }
+        return 0;
+    }
+
+    void *benchmarkFormatThread(void *args)
+        // Log 'd_numRecords' records to the logger and category specified by
+        // 'args' as the 'BALL_LOGVA_*' macros do, after waiting on
+        // 'd_barrier_p'.
+    {
+        ThreadArgs *p = static_cast<ThreadArgs *>(args);
+
+        p->d_barrier_p->wait();
+        for (int i = 0; i < p->d_numRecords; ++i) {
+            int           bufferSize;
+            bslmt::Mutex *mutex;
+            char *buffer = p->d_logger_p->obtainMessageBuffer(&mutex,
+                                                              &bufferSize);
+            bsl::snprintf(buffer, bufferSize, "message %d", i);
+            p->d_logger_p->logMessage(*p->d_category_p,
+                                      ball::Severity::e_ERROR,
+                                      __FILE__,
+                                      __LINE__,
+                                      buffer);
+            mutex->unlock();
+        }
+        return 0;
+    }
+}  // extern "C"
+
+double runContentionBenchmark(ball::Logger          *logger,
+                              const ball::Category  *category,
+                              int                    numThreads,
+                              int                    numRecords,
+                              bslmt_ThreadFunction   function)
+    // Log the specified 'numRecords' records from each of the specified
+    // 'numThreads' threads, all running the specified 'function', to the
+    // specified 'logger' and 'category', and return the number of records
+    // logged per second.
+{
+    bslmt::Barrier barrier(numThreads + 1);
+
+    bsl::vector<ThreadArgs>                 args(numThreads);
+    bsl::vector<bslmt::ThreadUtil::Handle>  handles(numThreads);
+
+    for (int i = 0; i < numThreads; ++i) {
+        ThreadArgs& a = args[i];
+        a.d_logger_p   = logger;
+        a.d_category_p = category;
+        a.d_records_p  = 0;
+        a.d_numRecords = numRecords;
+        a.d_barrier_p  = &barrier;
+        a.d_buffer_p   = 0;
+        a.d_mutex_p    = 0;
+        ASSERT(0 == bslmt::ThreadUtil::create(&handles[i], function, &a));
+    }
+
+    bsls::Stopwatch timer;
+    timer.start();
+    barrier.wait();
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+    timer.stop();
+
+    return static_cast<double>(numThreads) * numRecords / timer.elapsedTime();
+}
+
+}  // close namespace BALL_LOGGERMANAGER_TEST_THREAD_CACHE
+
 // ============================================================================
 //                  GLOBAL HELPER FUNCTIONS FOR TESTING
 // ----------------------------------------------------------------------------
@@ -1767,6 +1964,322 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 44: {
+        // --------------------------------------------------------------------
+        // TESTING PER-THREAD RECORD AND BUFFER CACHES
+        //
+        // Concerns:
+        //: 1 A record released on a thread is reused by the next call to
+        //:   'getRecord' on that thread, and is returned cleared, whether it
+        //:   was published or discarded because its category is disabled.
+        //:
+        //: 2 Records held in the caches are not counted by 'numRecordsInUse',
+        //:   including when more records are released than a cache holds, and
+        //:   when records are released on a thread other than the one that
+        //:   obtained them.
+        //:
+        //: 3 A message buffer released by a thread is reused by the next call
+        //:   to 'obtainMessageBuffer(int *)' on that thread.
+        //:
+        //: 4 'obtainMessageBuffer(bslmt::Mutex **, int *)' gives each thread a
+        //:   distinct buffer and mutex, so that one thread holding its buffer
+        //:   does not block another.
+        //:
+        //: 5 The cache of a thread is released when the thread exits.
+        //:
+        //: 6 The caches of threads that are still running when the logger is
+        //:   destroyed are released by the logger, and are not accessed when
+        //:   those threads later exit.
+        //:
+        //: 7 Threads may exit while their logger is being destroyed.
+        //:
+        //: 8 All loggers share one thread-specific storage key, so that
+        //:   caching works for more loggers than the platform has keys.
+        //
+        // Plan:
+        //: 1 Log records with both an enabled and a disabled category, and
+        //:   verify that 'getRecord' then returns the same records, cleared.
+        //:   (C-1)
+        //:
+        //: 2 Obtain more records than a cache can hold, on this thread and on
+        //:   another thread, release them on this thread, and verify
+        //:   'numRecordsInUse' after each step.  (C-2)
+        //:
+        //: 3 Obtain and release a message buffer twice and verify that the
+        //:   same buffer is returned.  (C-3)
+        //:
+        //: 4 While holding the scratch buffer of this thread, obtain and
+        //:   release the scratch buffer of another thread, and verify that
+        //:   both the buffer and the mutex differ.  (C-4)
+        //:
+        //: 5 Using a test allocator for the logger manager, run a thread that
+        //:   logs (populating its cache), and verify that the number of blocks
+        //:   in use is the same after the thread is joined as before it was
+        //:   created.  (C-5)
+        //:
+        //: 6 Destroy a logger manager while a thread that logged to it is
+        //:   blocked on a barrier, then let the thread exit, and verify that
+        //:   all memory is returned to the test allocator.  (C-6)
+        //:
+        //: 7 Repeatedly, let several threads that logged to a logger manager
+        //:   exit while the manager is destroyed, and verify that all memory
+        //:   is returned to the test allocator.  (C-7)
+        //:
+        //: 8 Allocate 2000 loggers, log through each, and verify that a record
+        //:   released to each is reused by the next 'getRecord'.  (C-8)
+        //
+        // Testing:
+        //   ball::Record *getRecord(const char *file, int line);
+        //   char *obtainMessageBuffer(bslmt::Mutex **mutex, int *bufferSize);
+        //   ManagedPtr<char> obtainMessageBuffer(int *bufferSize);
+        //   TESTING PER-THREAD RECORD AND BUFFER CACHES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING PER-THREAD RECORD AND BUFFER CACHES"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        using namespace BALL_LOGGERMANAGER_TEST_THREAD_CACHE;
+
+        enum { k_NUM_RECORDS = 32 };
+
+        bslma::TestAllocator ga("global", veryVeryVerbose);
+
+        {
+            ball::LoggerManagerConfiguration mXC;
+            Obj                              mX(mXC, &ga);
+
+            ball::Logger&         logger   = mX.getLogger();
+            const ball::Category& category = mX.defaultCategory();
+
+            if (verbose) cout << "\tRecords are reused and cleared." << endl;
+            {
+                ball::Record *r1 = logger.getRecord("a.cpp", 1);
+                r1->fixedFields().setMessage("published");
+                r1->customFields().appendInt64(1);
+                logger.logMessage(category, ball::Severity::e_ERROR, r1);
+
+                ball::Record *r2 = logger.getRecord("b.cpp", 2);
+                ASSERT(r1 == r2);
+                ASSERT(0 == bsl::strcmp("b.cpp",
+                                        r2->fixedFields().fileName()));
+                ASSERT(2 == r2->fixedFields().lineNumber());
+                ASSERT(0 == bsl::strlen(r2->fixedFields().message()));
+                ASSERT(0 == r2->customFields().length());
+
+                r2->fixedFields().setMessage("discarded");
+                logger.logMessage(category, ball::Severity::e_TRACE, r2);
+
+                ball::Record *r3 = logger.getRecord("c.cpp", 3);
+                ASSERT(r1 == r3);
+                ASSERT(0 == bsl::strlen(r3->fixedFields().message()));
+
+                logger.logMessage(category, ball::Severity::e_ERROR, r3);
+                ASSERT(0 == logger.numRecordsInUse());
+            }
+
+            if (verbose) cout << "\tCached records are not in use." << endl;
+            {
+                ball::Record *records[2 * k_NUM_RECORDS];
+
+                for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                    records[i] = logger.getRecord(__FILE__, __LINE__);
+                    ASSERTV(i, i + 1 == logger.numRecordsInUse());
+                }
+
+                ThreadArgs args = { &logger,
+                                    &category,
+                                    records + k_NUM_RECORDS,
+                                    k_NUM_RECORDS,
+                                    0,
+                                    0,
+                                    0 };
+
+                bslmt::ThreadUtil::Handle handle;
+                ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                      obtainRecordsThread,
+                                                      &args));
+                bslmt::ThreadUtil::join(handle);
+
+                ASSERT(2 * k_NUM_RECORDS == logger.numRecordsInUse());
+
+                for (int i = 0; i < 2 * k_NUM_RECORDS; ++i) {
+                    logger.logMessage(category,
+                                      ball::Severity::e_ERROR,
+                                      records[i]);
+                    ASSERTV(i,
+                            2 * k_NUM_RECORDS - i - 1 ==
+                                                  logger.numRecordsInUse());
+                }
+            }
+
+            if (verbose) cout << "\tMessage buffers are reused." << endl;
+            {
+                int   bufferSize = 0;
+                char *address    = 0;
+                {
+                    bslma::ManagedPtr<char> buffer =
+                                       logger.obtainMessageBuffer(&bufferSize);
+                    ASSERT(0 != buffer.get());
+                    ASSERT(0 <  bufferSize);
+                    address = buffer.get();
+                }
+                bslma::ManagedPtr<char> buffer =
+                                       logger.obtainMessageBuffer(&bufferSize);
+                ASSERT(address == buffer.get());
+            }
+
+            if (verbose) cout << "\tScratch buffers are per thread." << endl;
+            {
+                int           bufferSize;
+                bslmt::Mutex *mutex;
+                char         *buffer = logger.obtainMessageBuffer(&mutex,
+                                                                  &bufferSize);
+
+                ThreadArgs args = { &logger, &category, 0, 0, 0, 0, 0 };
+
+                bslmt::ThreadUtil::Handle handle;
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                                    &handle,
+                                                    obtainScratchBufferThread,
+                                                    &args));
+                bslmt::ThreadUtil::join(handle);
+
+                ASSERT(0      != args.d_buffer_p);
+                ASSERT(buffer != args.d_buffer_p);
+                ASSERT(mutex  != args.d_mutex_p);
+
+                mutex->unlock();
+            }
+
+            if (verbose) cout << "\tCaches are released on thread exit."
+                              << endl;
+            {
+                ThreadArgs args = { &logger, &category, 0, 1, 0, 0, 0 };
+
+                // Run the thread once so that the pools are grown to their
+                // steady-state size.
+
+                bslmt::ThreadUtil::Handle handle;
+                ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                      logThread,
+                                                      &args));
+                bslmt::ThreadUtil::join(handle);
+
+                const bsls::Types::Int64 NUM_BLOCKS = ga.numBlocksInUse();
+
+                args.d_numRecords = k_NUM_RECORDS;
+                ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                      logThread,
+                                                      &args));
+                bslmt::ThreadUtil::join(handle);
+
+                ASSERTV(NUM_BLOCKS, ga.numBlocksInUse(),
+                        NUM_BLOCKS == ga.numBlocksInUse());
+                ASSERT(0 == logger.numRecordsInUse());
+            }
+        }
+        ASSERTV(ga.numBlocksInUse(), 0 == ga.numBlocksInUse());
+
+        if (verbose) cout << "\tCaches outliving their logger." << endl;
+        {
+            bslmt::Barrier            barrier(2);
+            bslmt::ThreadUtil::Handle handle;
+            {
+                ball::LoggerManagerConfiguration mXC;
+                Obj                              mX(mXC, &ga);
+
+                ThreadArgs args = { &mX.getLogger(),
+                                    &mX.defaultCategory(),
+                                    0,
+                                    k_NUM_RECORDS,
+                                    &barrier,
+                                    0,
+                                    0 };
+
+                ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                      logThread,
+                                                      &args));
+                barrier.wait();
+            }
+            ASSERTV(ga.numBlocksInUse(), 0 == ga.numBlocksInUse());
+
+            barrier.wait();
+            bslmt::ThreadUtil::join(handle);
+        }
+        ASSERTV(ga.numBlocksInUse(), 0 == ga.numBlocksInUse());
+
+        if (verbose) cout << "\tThreads exiting during destruction." << endl;
+        {
+            enum { k_NUM_THREADS = 8, k_NUM_ITERATIONS = 50 };
+
+            for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+                bslmt::Barrier            barrier(k_NUM_THREADS + 1);
+                bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+                {
+                    ball::LoggerManagerConfiguration mXC;
+                    Obj                              mX(mXC, &ga);
+
+                    ThreadArgs args = { &mX.getLogger(),
+                                        &mX.defaultCategory(),
+                                        0,
+                                        2,
+                                        &barrier,
+                                        0,
+                                        0 };
+
+                    for (int j = 0; j < k_NUM_THREADS; ++j) {
+                        ASSERT(0 == bslmt::ThreadUtil::create(&handles[j],
+                                                              logThread,
+                                                              &args));
+                    }
+                    barrier.wait();
+                    barrier.wait();
+                }
+                for (int j = 0; j < k_NUM_THREADS; ++j) {
+                    bslmt::ThreadUtil::join(handles[j]);
+                }
+                ASSERTV(i, ga.numBlocksInUse(), 0 == ga.numBlocksInUse());
+            }
+        }
+
+        if (verbose) cout << "\tMore loggers than keys." << endl;
+        {
+            enum { k_NUM_LOGGERS = 2000 };
+
+            ball::LoggerManagerConfiguration mXC;
+            Obj                              mX(mXC, &ga);
+
+            const ball::Category& category = mX.defaultCategory();
+
+            ball::FixedSizeRecordBuffer buffer(1024, &ga);
+
+            bsl::vector<ball::Logger *> loggers(&ga);
+            for (int i = 0; i < k_NUM_LOGGERS; ++i) {
+                loggers.push_back(mX.allocateLogger(&buffer));
+            }
+
+            for (int i = 0; i < k_NUM_LOGGERS; ++i) {
+                ball::Logger *logger = loggers[i];
+
+                ball::Record *r1 = logger->getRecord(__FILE__, __LINE__);
+                logger->logMessage(category, ball::Severity::e_TRACE, r1);
+
+                ball::Record *r2 = logger->getRecord(__FILE__, __LINE__);
+                ASSERTV(i, r1 == r2);
+                logger->logMessage(category, ball::Severity::e_TRACE, r2);
+
+                ASSERTV(i, 0 == logger->numRecordsInUse());
+            }
+
+            for (int i = 0; i < k_NUM_LOGGERS; ++i) {
+                mX.deallocateLogger(loggers[i]);
+            }
+        }
+        ASSERTV(ga.numBlocksInUse(), 0 == ga.numBlocksInUse());
+      } break;
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED
       case 43: {
         // --------------------------------------------------------------------
@@ -6743,6 +7256,79 @@ int main(int argc, char *argv[])
         if (verbose) cout << "-----------------------------\n\n" << endl;
 
       } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // CONCERN: CONTENTION AMONG LOGGING THREADS
+        //
+        // Concerns:
+        //: 1 The throughput of a logger shared by many threads scales with
+        //:   the number of threads, rather than collapsing on the record pool
+        //:   or the scratch buffer mutex.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, ..., 64 threads (or up to the maximum specified by
+        //:   'argv[2]'), have every thread log a number of records (1000, or
+        //:   as specified by 'argv[3]') to a logger publishing to an observer
+        //:   that does nothing, first as the 'BALL_LOG_*' stream macros do,
+        //:   then as the 'BALL_LOGVA_*' macros do, and report the number of
+        //:   records logged per second.
+        //
+        // Testing:
+        //   CONCERN: CONTENTION AMONG LOGGING THREADS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: CONTENTION AMONG LOGGING THREADS"
+                          << endl
+                          << "========================================="
+                          << endl;
+
+        using namespace BALL_LOGGERMANAGER_TEST_THREAD_CACHE;
+
+        const int maxNumThreads = argc > 2 && atoi(argv[2]) > 0
+                                ? atoi(argv[2])
+                                : 64;
+        const int numRecords    = argc > 3 && atoi(argv[3]) > 0
+                                ? atoi(argv[3])
+                                : 1000;
+
+        ball::LoggerManagerConfiguration mXC;
+        Obj                              mX(mXC);
+
+        bsl::shared_ptr<NullObserver> observer(new NullObserver());
+        ASSERT(0 == mX.registerObserver(observer, "null"));
+
+        const ball::Category *category = mX.addCategory("Contention",
+                                                        0,
+                                                        255,
+                                                        0,
+                                                        0);
+        ASSERT(category);
+
+        ball::Logger *logger = &mX.getLogger();
+
+        cout << "threads\tstream (rec/s)\tformat (rec/s)" << endl;
+
+        for (int numThreads = 1;
+             numThreads <= maxNumThreads;
+             numThreads *= 2) {
+            const double streamRate = runContentionBenchmark(
+                                                        logger,
+                                                        category,
+                                                        numThreads,
+                                                        numRecords,
+                                                        benchmarkStreamThread);
+            const double formatRate = runContentionBenchmark(
+                                                        logger,
+                                                        category,
+                                                        numThreads,
+                                                        numRecords,
+                                                        benchmarkFormatThread);
+
+            cout << numThreads << '\t' << streamRate << '\t' << formatRate
+                 << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -13,6 +13,20 @@
 // significant performance overhead.  For this reason, the 'operator()' method
 // is implemented by writing the formatted string to a buffer before inserting
 // to a stream.
+//
+// The format specification is parsed once, when it is supplied, into a vector
+// of 'Op' objects: each maximal run of verbatim text (with '\'-escapes already
+// interpolated) becomes a single 'e_LITERAL' operation referring to a slice of
+// 'd_literals', and each recognized '%'-conversion becomes an operation of its
+// own.  Formatting a record is then a single pass over that vector.
+//
+// Formatting a timestamp is dominated by rendering the date and the time of
+// day, which changes at most once per second, so the rendering (without
+// fractional seconds) is kept in a 'RecordStringFormatter_TimestampCache' and
+// only the fractional seconds are rendered for each record.  The cache is
+// guarded by a spin lock that is only ever *tried*: a thread that fails to
+// acquire it renders the timestamp into a cache of its own, so that
+// formatting never waits on another thread.
 
 #include <ball_recordstringformatter.h>
 
@@ -27,26 +41,26 @@ BSLS_IDENT_RCSID(ball_recordstringformatter_cpp,"$Id$ $CSID$")
 
 #include <bdlb_print.h>
 
-#include <bdlma_bufferedsequentialallocator.h>
-
 #include <bdlt_datetime.h>
 #include <bdlt_currenttime.h>
 #include <bdlt_localtimeoffset.h>
 #include <bdlt_iso8601util.h>
 #include <bdlt_iso8601utilconfiguration.h>
 
+#include <bslalg_numericformatterutil.h>
+
+#include <bslmf_assert.h>
+
 #include <bsls_annotation.h>
+#include <bsls_assert.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
 #include <bslstl_stringref.h>
 
 #include <bsl_climits.h>   // for 'INT_MAX'
-#include <bsl_cstring.h>   // for 'bsl::strcmp'
-#include <bsl_c_stdlib.h>
-#include <bsl_c_stdio.h>   // for 'snprintf'
+#include <bsl_cstring.h>   // for 'bsl::strcmp', 'bsl::memcpy'
 
-#include <bsl_iomanip.h>
 #include <bsl_ostream.h>
 #include <bsl_sstream.h>
 
@@ -58,65 +72,235 @@ const char *const DEFAULT_FORMAT_SPEC = "\n%d %p:%t %s %f:%l %c %m %u\n";
 
 namespace BloombergLP {
 
+namespace {
+
+                            // ==================
+                            // class OutputBuffer
+                            // ==================
+
+class OutputBuffer {
+    // This class accumulates formatted output in a fixed-size buffer.  If a
+    // stream is supplied at construction, the contents of the buffer are
+    // written to that stream whenever the buffer becomes full, and upon
+    // 'flush'; otherwise, output that does not fit in the buffer is counted,
+    // but discarded.
+
+    // DATA
+    char         *d_buffer_p;   // buffer (held, not owned)
+    int           d_capacity;   // size of 'd_buffer_p'
+    int           d_length;     // number of characters in 'd_buffer_p'
+    int           d_total;      // number of characters appended
+    bsl::ostream *d_stream_p;   // destination of the output, or 0
+
+  private:
+    // NOT IMPLEMENTED
+    OutputBuffer(const OutputBuffer&);
+    OutputBuffer& operator=(const OutputBuffer&);
+
+  public:
+    // CREATORS
+    OutputBuffer(char *buffer, int capacity, bsl::ostream *stream)
+        // Create an output buffer that accumulates output in the specified
+        // 'buffer' of the specified 'capacity', and writes it to the specified
+        // 'stream' (if not 0).
+    : d_buffer_p(buffer)
+    , d_capacity(capacity)
+    , d_length(0)
+    , d_total(0)
+    , d_stream_p(stream)
+    {
+    }
+
+    // MANIPULATORS
+    void append(const char *data, int length)
+        // Append the specified 'length' characters starting at the specified
+        // 'data' to this buffer.
+    {
+        d_total += length;
+
+        if (length <= d_capacity - d_length) {
+            bsl::memcpy(d_buffer_p + d_length, data, length);
+            d_length += length;
+            return;                                                   // RETURN
+        }
+
+        if (d_stream_p) {
+            flush();
+
+            if (length <= d_capacity) {
+                bsl::memcpy(d_buffer_p, data, length);
+                d_length = length;
+            }
+            else {
+                d_stream_p->write(data, length);
+            }
+        }
+        else {
+            bsl::memcpy(d_buffer_p + d_length, data, d_capacity - d_length);
+            d_length = d_capacity;
+        }
+    }
+
+    void append(const char *string)
+        // Append the specified null-terminated 'string' to this buffer.
+    {
+        append(string, static_cast<int>(bsl::strlen(string)));
+    }
+
+    void append(const bsl::string& string)
+        // Append the specified 'string' to this buffer.
+    {
+        append(string.data(), static_cast<int>(string.length()));
+    }
+
+    void flush()
+        // Write the contents of this buffer to the stream supplied at
+        // construction, and empty this buffer.  The behavior is undefined
+        // unless a stream was supplied at construction.
+    {
+        BSLS_ASSERT(d_stream_p);
+
+        d_stream_p->write(d_buffer_p, d_length);
+        d_length = 0;
+    }
+
+    // ACCESSORS
+    int totalLength() const
+        // Return the number of characters appended to this buffer since its
+        // construction, including any written to the stream or discarded.
+    {
+        return d_total;
+    }
+};
+
 // STATIC HELPER FUNCTIONS
-static void appendToString(bsl::string *result, int value)
-    // Convert the specified 'value' into ASCII characters and append it to the
-    // specified 'result.
+template <class INTEGRAL_TYPE>
+void appendDecimal(OutputBuffer *output, INTEGRAL_TYPE value)
+    // Append the decimal representation of the specified 'value' to the
+    // specified 'output'.
 {
-    char buffer[16];
+    char buffer[32];
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
+    const char *end = bslalg::NumericFormatterUtil::toChars(
+                                                       buffer,
+                                                       buffer + sizeof buffer,
+                                                       value);
+    output->append(buffer, static_cast<int>(end - buffer));
+}
+
+void appendHex(OutputBuffer *output, bsls::Types::Uint64 value)
+    // Append the (upper-case) hexadecimal representation of the specified
+    // 'value' to the specified 'output'.
+{
+    static const char k_DIGITS[] = "0123456789ABCDEF";
 
-    snprintf(buffer, sizeof buffer, "%d", value);
+    char  buffer[16];
+    char *begin = buffer + sizeof buffer;
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
+    do {
+        *--begin = k_DIGITS[value & 0xF];
+        value >>= 4;
+    } while (value);
 
-    *result += buffer;
+    output->append(begin, static_cast<int>(buffer + sizeof buffer - begin));
 }
 
-static void appendToString(bsl::string *result, bsls::Types::Uint64 value)
-    // Convert the specified 'value' into ASCII characters and append it to the
-    // specified 'result.
+void appendFraction(OutputBuffer *output, int value, int numDigits)
+    // Append to the specified 'output' a '.' followed by the specified
+    // 'numDigits' least significant decimal digits of the specified 'value',
+    // padded with leading zeros.  The behavior is undefined unless
+    // '0 <= value' and '0 < numDigits <= 6'.
 {
-    char buffer[32];
+    char buffer[8];
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
+    buffer[0] = '.';
 
-    snprintf(buffer, sizeof buffer, "%llu", value);
+    for (int i = numDigits; 0 < i; --i) {
+        buffer[i] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
+    output->append(buffer, numDigits + 1);
+}
+
+}  // close unnamed namespace
+
+namespace ball {
+
+                 // ------------------------------------------
+                 // class RecordStringFormatter_TimestampCache
+                 // ------------------------------------------
 
-    *result += buffer;
+// PRIVATE MANIPULATORS
+void RecordStringFormatter_TimestampCache::setTimestamp(
+                                           const bdlt::DatetimeTz& timestamp)
+{
+    const bsls::Types::Int64 seconds =
+          (timestamp.localDatetime() - bdlt::Datetime(1, 1, 1)).totalSeconds();
+
+    if (seconds != d_seconds || timestamp.offset() != d_offsetMinutes) {
+        d_seconds        = seconds;
+        d_offsetMinutes  = timestamp.offset();
+        d_datetimeLength = -1;
+        d_iso8601Length  = -1;
+    }
 }
 
-static void appendToStringAsHex(bsl::string *result, bsls::Types::Uint64 value)
-    // Convert the specified 'value' into hexadecimal and append it to the
-    // specified 'result'.
+// CREATORS
+RecordStringFormatter_TimestampCache::RecordStringFormatter_TimestampCache()
+: d_seconds(-1)
+, d_offsetMinutes(0)
+, d_datetimeLength(-1)
+, d_iso8601Length(-1)
 {
-    char buffer[32];
+}
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
+// MANIPULATORS
+int RecordStringFormatter_TimestampCache::loadDatetime(
+                                           char                    *result,
+                                           const bdlt::DatetimeTz&  timestamp)
+{
+    BSLS_ASSERT(result);
 
-    snprintf(buffer, sizeof(buffer), "%llX", value);
+    setTimestamp(timestamp);
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
+    if (0 > d_datetimeLength) {
+        d_datetimeLength = timestamp.localDatetime().printToBuffer(
+                                                            d_datetime,
+                                                            sizeof d_datetime,
+                                                            0);
+    }
 
-    *result += buffer;
+    bsl::memcpy(result, d_datetime, d_datetimeLength + 1);
+
+    return d_datetimeLength;
 }
 
-namespace ball {
+int RecordStringFormatter_TimestampCache::loadIso8601(
+                                           char                    *result,
+                                           const bdlt::DatetimeTz&  timestamp)
+{
+    BSLMF_ASSERT(static_cast<int>(bdlt::Iso8601Util::k_DATETIMETZ_STRLEN) <
+                                                                k_BUFFER_SIZE);
+    BSLS_ASSERT(result);
+
+    setTimestamp(timestamp);
+
+    if (0 > d_iso8601Length) {
+        bdlt::Iso8601UtilConfiguration config;
+        config.setFractionalSecondPrecision(0);
+        config.setUseZAbbreviationForUtc(true);
+
+        d_iso8601Length = bdlt::Iso8601Util::generateRaw(d_iso8601,
+                                                         timestamp,
+                                                         config);
+        d_iso8601[d_iso8601Length] = '\0';
+    }
+
+    bsl::memcpy(result, d_iso8601, d_iso8601Length + 1);
+
+    return d_iso8601Length;
+}
 
                         // ---------------------------
                         // class RecordStringFormatter
@@ -130,18 +314,312 @@ const int RecordStringFormatter::k_DISABLE_PUBLISH_IN_LOCALTIME = INT_MIN;
 // appear in practice.  Real values are (always?) less than one day (plus or
 // minus).
 
+// PRIVATE MANIPULATORS
+void RecordStringFormatter::compileFormat()
+{
+    bsl::vector<Op> ops(d_ops.get_allocator());
+    bsl::string     literals(d_literals.get_allocator());
+
+    const char *iter = d_formatSpec.data();
+    const char *end  = iter + d_formatSpec.length();
+
+    int literalOffset = 0;  // start of the literal run being accumulated
+
+    while (iter != end) {
+        OpCode code = e_LITERAL;
+
+        switch (*iter) {
+          case '%': {
+            if (++iter == end) {
+                break;
+            }
+            switch (*iter) {
+              case '%': literals += '%';                    break;
+              case 'd': code = e_DATETIME_MILLI;            break;
+              case 'D': code = e_DATETIME_MICRO;            break;
+              case 'i': code = e_ISO8601;                   break;
+              case 'I': code = e_ISO8601_MILLI;             break;
+              case 'O': code = e_ISO8601_MICRO;             break;
+              case 'p': code = e_PROCESS_ID;                break;
+              case 't': code = e_THREAD_ID;                 break;
+              case 'T': code = e_THREAD_ID_HEX;             break;
+              case 's': code = e_SEVERITY;                  break;
+              case 'f': code = e_FILENAME;                  break;
+              case 'F': code = e_FILENAME_BASE;             break;
+              case 'l': code = e_LINE_NUMBER;               break;
+              case 'c': code = e_CATEGORY;                  break;
+              case 'm': code = e_MESSAGE;                   break;
+              case 'x': code = e_MESSAGE_PRINTABLE;         break;
+              case 'X': code = e_MESSAGE_HEX;               break;
+              case 'u': code = e_USER_FIELDS;               break;
+              default: {
+                // Undefined: we just output the verbatim characters.
+
+                literals += '%';
+                literals += *iter;
+              }
+            }
+            ++iter;
+          } break;
+          case '\\': {
+            if (++iter == end) {
+                break;
+            }
+            switch (*iter) {
+              case 'n':  literals += '\n';                  break;
+              case 't':  literals += '\t';                  break;
+              case '\\': literals += '\\';                  break;
+              default: {
+                // Undefined: we just output the verbatim characters.
+
+                literals += '\\';
+                literals += *iter;
+              }
+            }
+            ++iter;
+          } break;
+          default: {
+            literals += *iter;
+            ++iter;
+          }
+        }
+
+        if (e_LITERAL != code) {
+            const int literalLength = static_cast<int>(literals.length()) -
+                                                                 literalOffset;
+            if (literalLength) {
+                const Op literal = { e_LITERAL, literalOffset, literalLength };
+                ops.push_back(literal);
+                literalOffset += literalLength;
+            }
+
+            const Op field = { code, 0, 0 };
+            ops.push_back(field);
+        }
+    }
+
+    const int literalLength = static_cast<int>(literals.length()) -
+                                                                 literalOffset;
+    if (literalLength) {
+        const Op literal = { e_LITERAL, literalOffset, literalLength };
+        ops.push_back(literal);
+    }
+
+    d_ops.swap(ops);
+    d_literals.swap(literals);
+}
+
+// PRIVATE ACCESSORS
+int RecordStringFormatter::formatImp(char          *buffer,
+                                     int            bufferSize,
+                                     bsl::ostream  *stream,
+                                     const Record&  record) const
+{
+    const RecordAttributes& fixedFields = record.fixedFields();
+    bdlt::DatetimeInterval  offset;
+
+    if (k_ENABLE_PUBLISH_IN_LOCALTIME ==
+                                       d_timestampOffset.totalMilliseconds()) {
+        bsls::Types::Int64 localTimeOffsetInSeconds =
+            bdlt::LocalTimeOffset::localTimeOffset(
+                                       fixedFields.timestamp()).totalSeconds();
+        offset.setTotalSeconds(localTimeOffsetInSeconds);
+    } else if (k_DISABLE_PUBLISH_IN_LOCALTIME !=
+                                       d_timestampOffset.totalMilliseconds()) {
+        offset = d_timestampOffset;
+    }
+
+    bdlt::DatetimeTz timestamp(fixedFields.timestamp() + offset,
+                               static_cast<int>(offset.totalMinutes()));
+
+    OutputBuffer output(buffer, bufferSize, stream);
+
+    const Op *const opsEnd = d_ops.data() + d_ops.size();
+
+    for (const Op *op = d_ops.data(); op != opsEnd; ++op) {
+        switch (op->d_code) {
+          case e_LITERAL: {
+            output.append(d_literals.data() + op->d_offset, op->d_length);
+          } break;
+          case e_DATETIME_MILLI: BSLS_ANNOTATION_FALLTHROUGH;
+          case e_DATETIME_MICRO: {
+            char text[RecordStringFormatter_TimestampCache::k_BUFFER_SIZE];
+            int  length;
+
+            if (0 == d_cacheLock.tryLock()) {
+                length = d_timestampCache.loadDatetime(text, timestamp);
+                d_cacheLock.unlock();
+            }
+            else {
+                RecordStringFormatter_TimestampCache cache;
+                length = cache.loadDatetime(text, timestamp);
+            }
+            output.append(text, length);
+
+            const bdlt::Datetime& datetime = timestamp.localDatetime();
+
+            if (e_DATETIME_MILLI == op->d_code) {
+                appendFraction(&output, datetime.millisecond(), 3);
+            }
+            else {
+                appendFraction(&output,
+                               datetime.millisecond() * 1000 +
+                                                        datetime.microsecond(),
+                               6);
+            }
+          } break;
+          case e_ISO8601:       BSLS_ANNOTATION_FALLTHROUGH;
+          case e_ISO8601_MILLI: BSLS_ANNOTATION_FALLTHROUGH;
+          case e_ISO8601_MICRO: {
+            char text[RecordStringFormatter_TimestampCache::k_BUFFER_SIZE];
+            int  length;
+
+            if (0 == d_cacheLock.tryLock()) {
+                length = d_timestampCache.loadIso8601(text, timestamp);
+                d_cacheLock.unlock();
+            }
+            else {
+                RecordStringFormatter_TimestampCache cache;
+                length = cache.loadIso8601(text, timestamp);
+            }
+
+            if (e_ISO8601 == op->d_code) {
+                output.append(text, length);
+                break;
+            }
+
+            // Splice the fractional seconds between the time of day and the
+            // offset from UTC.
+
+            enum { k_DECIMAL_SIGN_OFFSET = 19 };
+
+            const bdlt::Datetime& datetime = timestamp.localDatetime();
+
+            output.append(text, k_DECIMAL_SIGN_OFFSET);
+
+            if (e_ISO8601_MILLI == op->d_code) {
+                appendFraction(&output, datetime.millisecond(), 3);
+            }
+            else {
+                appendFraction(&output,
+                               datetime.millisecond() * 1000 +
+                                                        datetime.microsecond(),
+                               6);
+            }
+
+            output.append(text + k_DECIMAL_SIGN_OFFSET,
+                          length - k_DECIMAL_SIGN_OFFSET);
+          } break;
+          case e_PROCESS_ID: {
+            appendDecimal(&output, fixedFields.processID());
+          } break;
+          case e_THREAD_ID: {
+            appendDecimal(&output, fixedFields.threadID());
+          } break;
+          case e_THREAD_ID_HEX: {
+            appendHex(&output, fixedFields.threadID());
+          } break;
+          case e_SEVERITY: {
+            output.append(Severity::toAscii(
+                                    (Severity::Level)fixedFields.severity()));
+          } break;
+          case e_FILENAME: {
+            output.append(fixedFields.fileName());
+          } break;
+          case e_FILENAME_BASE: {
+            const bsl::string& filename = fixedFields.fileName();
+            bsl::string::size_type rightmostSlashIndex =
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+                filename.rfind('\\');
+#else
+                filename.rfind('/');
+#endif
+            if (bsl::string::npos == rightmostSlashIndex) {
+                output.append(filename);
+            }
+            else {
+                output.append(
+                       filename.data() + rightmostSlashIndex + 1,
+                       static_cast<int>(filename.length() -
+                                                     rightmostSlashIndex - 1));
+            }
+          } break;
+          case e_LINE_NUMBER: {
+            appendDecimal(&output, fixedFields.lineNumber());
+          } break;
+          case e_CATEGORY: {
+            output.append(fixedFields.category());
+          } break;
+          case e_MESSAGE: {
+            bslstl::StringRef message = fixedFields.messageRef();
+            output.append(message.data(),
+                          static_cast<int>(message.length()));
+          } break;
+          case e_MESSAGE_PRINTABLE: {
+            bsl::stringstream ss;
+            int length = static_cast<int>(
+                                      fixedFields.messageStreamBuf().length());
+            bdlb::Print::printString(ss,
+                                    fixedFields.message(),
+                                    length,
+                                    false);
+            output.append(ss.str());
+          } break;
+          case e_MESSAGE_HEX: {
+            bsl::stringstream ss;
+            int length = static_cast<int>(
+                                      fixedFields.messageStreamBuf().length());
+            bdlb::Print::singleLineHexDump(ss,
+                                          fixedFields.message(),
+                                          length);
+            output.append(ss.str());
+          } break;
+          case e_USER_FIELDS: {
+            typedef ball::UserFields Values;
+            const Values& customFields = record.customFields();
+            const int numCustomFields  = customFields.length();
+
+            if (numCustomFields > 0) {
+                bsl::stringstream ss;
+                Values::ConstIterator it = customFields.begin();
+                ss << *it;
+                ++it;
+                for (; it != customFields.end(); ++it) {
+                    ss << " " << *it;
+                }
+                output.append(ss.str());
+            }
+          } break;
+        }
+    }
+
+    if (stream) {
+        output.flush();
+    }
+
+    return output.totalLength();
+}
+
 // CREATORS
 RecordStringFormatter::RecordStringFormatter(bslma::Allocator *basicAllocator)
 : d_formatSpec(DEFAULT_FORMAT_SPEC, basicAllocator)
 , d_timestampOffset(0)
+, d_ops(basicAllocator)
+, d_literals(basicAllocator)
+, d_cacheLock(bsls::SpinLock::s_unlocked)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(const char       *format,
                                              bslma::Allocator *basicAllocator)
 : d_formatSpec(format, basicAllocator)
 , d_timestampOffset(0)
+, d_ops(basicAllocator)
+, d_literals(basicAllocator)
+, d_cacheLock(bsls::SpinLock::s_unlocked)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -149,7 +627,11 @@ RecordStringFormatter::RecordStringFormatter(
                                  bslma::Allocator              *basicAllocator)
 : d_formatSpec(DEFAULT_FORMAT_SPEC, basicAllocator)
 , d_timestampOffset(offset)
+, d_ops(basicAllocator)
+, d_literals(basicAllocator)
+, d_cacheLock(bsls::SpinLock::s_unlocked)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -163,7 +645,11 @@ RecordStringFormatter::RecordStringFormatter(
                     publishInLocalTime
                     ?  k_ENABLE_PUBLISH_IN_LOCALTIME
                     : k_DISABLE_PUBLISH_IN_LOCALTIME)
+, d_ops(basicAllocator)
+, d_literals(basicAllocator)
+, d_cacheLock(bsls::SpinLock::s_unlocked)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -172,7 +658,11 @@ RecordStringFormatter::RecordStringFormatter(
                                  bslma::Allocator              *basicAllocator)
 : d_formatSpec(format, basicAllocator)
 , d_timestampOffset(offset)
+, d_ops(basicAllocator)
+, d_literals(basicAllocator)
+, d_cacheLock(bsls::SpinLock::s_unlocked)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -187,7 +677,11 @@ RecordStringFormatter::RecordStringFormatter(
                     publishInLocalTime
                     ?  k_ENABLE_PUBLISH_IN_LOCALTIME
                     : k_DISABLE_PUBLISH_IN_LOCALTIME)
+, d_ops(basicAllocator)
+, d_literals(basicAllocator)
+, d_cacheLock(bsls::SpinLock::s_unlocked)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -195,6 +689,9 @@ RecordStringFormatter::RecordStringFormatter(
                                   bslma::Allocator             *basicAllocator)
 : d_formatSpec(original.d_formatSpec, basicAllocator)
 , d_timestampOffset(original.d_timestampOffset)
+, d_ops(original.d_ops, basicAllocator)
+, d_literals(original.d_literals, basicAllocator)
+, d_cacheLock(bsls::SpinLock::s_unlocked)
 {
 }
 
@@ -205,224 +702,50 @@ RecordStringFormatter& RecordStringFormatter::operator=(
     if (this != &rhs) {
         d_formatSpec      = rhs.d_formatSpec;
         d_timestampOffset = rhs.d_timestampOffset;
+        d_ops             = rhs.d_ops;
+        d_literals        = rhs.d_literals;
     }
 
     return *this;
 }
 
+void RecordStringFormatter::setFormat(const char *format)
+{
+    d_formatSpec = format;
+    compileFormat();
+}
+
 // ACCESSORS
 void RecordStringFormatter::operator()(bsl::ostream& stream,
                                        const Record& record) const
-
 {
-    const RecordAttributes& fixedFields = record.fixedFields();
-    bdlt::DatetimeInterval  offset;
-
-    if (k_ENABLE_PUBLISH_IN_LOCALTIME ==
-                                       d_timestampOffset.totalMilliseconds()) {
-        bsls::Types::Int64 localTimeOffsetInSeconds =
-            bdlt::LocalTimeOffset::localTimeOffset(
-                                       fixedFields.timestamp()).totalSeconds();
-        offset.setTotalSeconds(localTimeOffsetInSeconds);
-    } else if (k_DISABLE_PUBLISH_IN_LOCALTIME !=
-                                       d_timestampOffset.totalMilliseconds()) {
-        offset = d_timestampOffset;
-    }
-
-    bdlt::DatetimeTz timestamp(fixedFields.timestamp() + offset,
-                               static_cast<int>(offset.totalMinutes()));
-
-    // Step through the format string, outputting the required elements.
-
-    const char* iter = d_formatSpec.data();
-    const char* end  = iter + d_formatSpec.length();
-
-    // Create a buffer on the stack for formatting the record.  Note that the
-    // size of the buffer should be slightly larger than the amount we reserve
-    // in order to ensure only a single allocation occurs.
-
-    const int BUFFER_SIZE        = 512;
-    const int STRING_RESERVATION = BUFFER_SIZE -
-                                   bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
-
-    char fixedBuffer[BUFFER_SIZE];
-    bdlma::BufferedSequentialAllocator stringAllocator(fixedBuffer,
-                                                      BUFFER_SIZE);
-    bsl::string output(&stringAllocator);
-    output.reserve(STRING_RESERVATION);
-
-    while (iter != end) {
-        switch (*iter) {
-          case '%': {
-            if (++iter == end) {
-                break;
-            }
-            switch (*iter) {
-              case '%': {
-                output += '%';
-              } break;
-              case 'd': BSLS_ANNOTATION_FALLTHROUGH;
-              case 'D': {
-                const int fractionalSecondPrecision = 'd' == *iter ? 3 : 6;
-
-                char buffer[32];
-                timestamp.localDatetime().printToBuffer(
-                                                    buffer,
-                                                    sizeof buffer,
-                                                    fractionalSecondPrecision);
-
-                output += buffer;
-              } break;
-              case 'I': BSLS_ANNOTATION_FALLTHROUGH;
-              case 'O': BSLS_ANNOTATION_FALLTHROUGH;
-              case 'i': {
-                // Use ISO8601 "extended" format.
-
-                const int fractionalSecondPrecision = 'O' == *iter ? 6 : 3;
-
-                bdlt::Iso8601UtilConfiguration config;
-                config.setFractionalSecondPrecision(fractionalSecondPrecision);
-                config.setUseZAbbreviationForUtc(true);
+    // Records longer than the buffer are written to 'stream' in pieces
+    // rather than through a larger (allocated) buffer.
 
-                char buffer[bdlt::Iso8601Util::k_DATETIMETZ_STRLEN + 1];
+    char buffer[512];
 
-                int outputLength = bdlt::Iso8601Util::generateRaw(buffer,
-                                                                  timestamp,
-                                                                  config);
+    formatImp(buffer, static_cast<int>(sizeof buffer), &stream, record);
 
-                if ('i' == *iter) {
-                    // Remove milliseconds part.
-
-                    enum { k_DECIMAL_SIGN_OFFSET = 19,
-                           k_TZINFO_OFFSET       = k_DECIMAL_SIGN_OFFSET + 4 };
-                    bslstl::StringRef head(buffer, k_DECIMAL_SIGN_OFFSET);
+    stream.flush();
+}
 
-                    bslstl::StringRef tail(buffer + k_TZINFO_OFFSET,
-                                           outputLength - k_TZINFO_OFFSET);
+int RecordStringFormatter::printToBuffer(char          *result,
+                                         int            numBytes,
+                                         const Record&  record) const
+{
+    BSLS_ASSERT(result || 0 == numBytes);
+    BSLS_ASSERT(0 <= numBytes);
 
-                    output += head + tail;
-                }
-                else {
-                    output.append(buffer, outputLength);
-                }
-              } break;
-              case 'p': {
-                appendToString(&output, fixedFields.processID());
-              } break;
-              case 't': {
-                appendToString(&output, fixedFields.threadID());
-              } break;
-              case 'T': {
-                appendToStringAsHex(&output, fixedFields.threadID());
-              } break;
-              case 's': {
-                output += Severity::toAscii(
-                                 (Severity::Level)fixedFields.severity());
-              } break;
-              case 'f': {
-                output += fixedFields.fileName();
-              } break;
-              case 'F': {
-                const bsl::string& filename = fixedFields.fileName();
-                bsl::string::size_type rightmostSlashIndex =
-#ifdef BSLS_PLATFORM_OS_WINDOWS
-                    filename.rfind('\\');
-#else
-                    filename.rfind('/');
-#endif
-                if (bsl::string::npos == rightmostSlashIndex) {
-                    output += filename;
-                }
-                else {
-                    output += filename.substr(rightmostSlashIndex + 1);
-                }
-              } break;
-              case 'l': {
-                appendToString(&output, fixedFields.lineNumber());
-              } break;
-              case 'c': {
-                output += fixedFields.category();
-              } break;
-              case 'm': {
-                bslstl::StringRef message = fixedFields.messageRef();
-                output.append(message.data(), message.length());
-              } break;
-              case 'x': {
-                bsl::stringstream ss;
-                int length = static_cast<int>(
-                                      fixedFields.messageStreamBuf().length());
-                bdlb::Print::printString(ss,
-                                        fixedFields.message(),
-                                        length,
-                                        false);
-                output += ss.str();
-              } break;
-              case 'X': {
-                bsl::stringstream ss;
-                int length = static_cast<int>(
-                                      fixedFields.messageStreamBuf().length());
-                bdlb::Print::singleLineHexDump(ss,
-                                              fixedFields.message(),
-                                              length);
-                output += ss.str();
-              } break;
-              case 'u': {
-                typedef ball::UserFields Values;
-                const Values& customFields = record.customFields();
-                const int numCustomFields  = customFields.length();
-
-                if (numCustomFields > 0) {
-                    bsl::stringstream ss;
-                    Values::ConstIterator it = customFields.begin();
-                    ss << *it;
-                    ++it;
-                    for (; it != customFields.end(); ++it) {
-                        ss << " " << *it;
-                    }
-                    output += ss.str();
-                }
-              } break;
-              default: {
-                // Undefined: we just output the verbatim characters.
+    if (0 == numBytes) {
+        char dummy;
+        return formatImp(&dummy, 0, 0, record);                       // RETURN
+    }
 
-                output += '%';
-                output += *iter;
-              }
-            }
-            ++iter;
-          } break;
-          case '\\': {
-            if (++iter == end) {
-                break;
-            }
-            switch (*iter) {
-              case 'n': {
-                output += '\n';
-              } break;
-              case 't': {
-                output += '\t';
-              } break;
-              case '\\': {
-                output += '\\';
-              } break;
-              default: {
-                // Undefined: we just output the verbatim characters.
+    const int length = formatImp(result, numBytes - 1, 0, record);
 
-                output += '\\';
-                output += *iter;
-              }
-            }
-            ++iter;
-          } break;
-          default: {
-            output += *iter;
-            ++iter;
-          }
-        }
-    }
+    result[length < numBytes ? length : numBytes - 1] = '\0';
 
-    stream.write(output.c_str(), output.size());
-    stream.flush();
+    return length;
 }
 
 }  // close package namespace
@@ -93,6 +93,30 @@ BSLS_IDENT("$Id: $")
 // 27AUG2007_16:09:46.161 2040:1 WARN subdir/process.cpp:542 FOO.BAR.BAZ <text>
 //..
 //
+///Formatting to a Buffer
+///----------------------
+// In addition to the stream-based 'operator()', the 'printToBuffer' method
+// formats a record directly into a character buffer supplied by the caller,
+// following the conventions of 'bdlt::Datetime::printToBuffer': the output is
+// truncated (and null-terminated) to fit the buffer, and the length of the
+// complete formatted record is returned so that the caller can detect
+// truncation and retry with a larger buffer.  Neither method allocates memory
+// unless the format specification includes '%x', '%X', or '%u'.
+//
+///Performance
+///-----------
+// A record formatter translates its format specification into a sequence of
+// formatting operations when the specification is supplied (on construction,
+// assignment, or 'setFormat'), rather than each time a record is formatted.
+//
+// In addition, the date and time (to the second) of the most recently
+// formatted timestamp is retained by the formatter, so that records having
+// timestamps within the same second (the common case for a busy log) only
+// render the fractional seconds.  Concurrent calls to 'operator()' or
+// 'printToBuffer' on the same formatter are safe; a call that finds the
+// retained timestamp in use by another thread renders its timestamp without
+// it rather than waiting.
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate how to use an instance of
@@ -130,14 +154,19 @@ BSLS_IDENT("$Id: $")
 #include <balscm_version.h>
 
 #include <bdlt_datetimeinterval.h>
+#include <bdlt_datetimetz.h>
 
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
 
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bsls_spinlock.h>
+#include <bsls_types.h>
+
 #include <bsl_iosfwd.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #ifndef BDE_DONT_ALLOW_TRANSITIVE_INCLUDES
 #include <bslalg_typetraits.h>
@@ -148,6 +177,81 @@ namespace ball {
 
 class Record;
 
+                 // ==========================================
+                 // class RecordStringFormatter_TimestampCache
+                 // ==========================================
+
+class RecordStringFormatter_TimestampCache {
+    // This is an implementation type of 'RecordStringFormatter' and should not
+    // be used by clients of this package.  A timestamp cache retains the
+    // textual representations, truncated to whole seconds, of the most
+    // recently supplied timestamp in the two styles supported by
+    // 'RecordStringFormatter' (i.e., that of 'bdlt::Datetime::printToBuffer'
+    // and ISO 8601), rendering each one only when it is first requested for a
+    // given second.
+
+  public:
+    // PUBLIC TYPES
+    enum { k_BUFFER_SIZE = 40 };  // minimum size of a buffer to be loaded
+                                  // by this cache (including the null
+                                  // terminator)
+
+  private:
+    // DATA
+    bsls::Types::Int64 d_seconds;                 // seconds from 0001/01/01
+                                                  // of the local datetime of
+                                                  // the cached timestamp
+
+    int                d_offsetMinutes;           // offset from UTC of the
+                                                  // cached timestamp
+
+    int                d_datetimeLength;          // length of 'd_datetime',
+                                                  // or -1 if not rendered
+
+    int                d_iso8601Length;           // length of 'd_iso8601',
+                                                  // or -1 if not rendered
+
+    char               d_datetime[k_BUFFER_SIZE]; // 'DDMonYYYY_HH:MM:SS'
+
+    char               d_iso8601[k_BUFFER_SIZE];  // 'YYYY-MM-DDThh:mm:ss'
+                                                  // followed by the offset
+
+    // PRIVATE MANIPULATORS
+    void setTimestamp(const bdlt::DatetimeTz& timestamp);
+        // Discard the cached representations if the specified 'timestamp'
+        // does not denote the same second and offset from UTC as the cached
+        // timestamp, and make 'timestamp' the cached timestamp.
+
+    // NOT IMPLEMENTED
+    RecordStringFormatter_TimestampCache(
+                                  const RecordStringFormatter_TimestampCache&);
+    RecordStringFormatter_TimestampCache& operator=(
+                                  const RecordStringFormatter_TimestampCache&);
+
+  public:
+    // CREATORS
+    RecordStringFormatter_TimestampCache();
+        // Create an empty timestamp cache.
+
+    //! ~RecordStringFormatter_TimestampCache() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    int loadDatetime(char *result, const bdlt::DatetimeTz& timestamp);
+        // Load into the specified 'result' buffer the null-terminated
+        // 'DDMonYYYY_HH:MM:SS' representation of the local datetime of the
+        // specified 'timestamp', and return its length.  The behavior is
+        // undefined unless 'result' refers to at least 'k_BUFFER_SIZE'
+        // contiguous bytes.
+
+    int loadIso8601(char *result, const bdlt::DatetimeTz& timestamp);
+        // Load into the specified 'result' buffer the null-terminated ISO 8601
+        // representation (without fractional seconds) of the specified
+        // 'timestamp', and return its length.  The behavior is undefined
+        // unless 'result' refers to at least 'k_BUFFER_SIZE' contiguous bytes.
+        // Note that the offset from UTC is rendered as 'Z' if it is 0.
+};
+
                         // ===========================
                         // class RecordStringFormatter
                         // ===========================
@@ -177,10 +281,79 @@ class RecordStringFormatter {
                                               // adjusted to the current local
                                               // time.
 
+    // PRIVATE TYPES
+    enum OpCode {
+        // Enumerates the formatting operations to which a format
+        // specification is compiled.  Each enumerator other than 'e_LITERAL'
+        // corresponds to one '%'-conversion.
+
+        e_LITERAL,                // verbatim text (including '\'-escapes)
+        e_DATETIME_MILLI,         // %d
+        e_DATETIME_MICRO,         // %D
+        e_ISO8601,                // %i
+        e_ISO8601_MILLI,          // %I
+        e_ISO8601_MICRO,          // %O
+        e_PROCESS_ID,             // %p
+        e_THREAD_ID,              // %t
+        e_THREAD_ID_HEX,          // %T
+        e_SEVERITY,               // %s
+        e_FILENAME,               // %f
+        e_FILENAME_BASE,          // %F
+        e_LINE_NUMBER,            // %l
+        e_CATEGORY,               // %c
+        e_MESSAGE,                // %m
+        e_MESSAGE_PRINTABLE,      // %x
+        e_MESSAGE_HEX,            // %X
+        e_USER_FIELDS             // %u
+    };
+
+    struct Op {
+        // This 'struct' describes one formatting operation.
+
+        OpCode d_code;            // operation to perform
+
+        int    d_offset;          // offset of the literal text in
+                                  // 'd_literals' ('e_LITERAL' only)
+
+        int    d_length;          // length of the literal text
+                                  // ('e_LITERAL' only)
+    };
+
     // DATA
     bsl::string            d_formatSpec;       // 'printf'-style format spec.
     bdlt::DatetimeInterval d_timestampOffset;  // offset added to timestamps
 
+    bsl::vector<Op>        d_ops;              // 'd_formatSpec' compiled to
+                                               // formatting operations
+
+    bsl::string            d_literals;         // text of all 'e_LITERAL'
+                                               // operations in 'd_ops'
+
+    mutable bsls::SpinLock d_cacheLock;        // guards 'd_timestampCache'
+
+    mutable RecordStringFormatter_TimestampCache
+                           d_timestampCache;   // most recently formatted
+                                               // timestamp
+
+    // PRIVATE MANIPULATORS
+    void compileFormat();
+        // Compile the format specification of this record formatter into the
+        // sequence of formatting operations applied by 'operator()' and
+        // 'printToBuffer'.
+
+    // PRIVATE ACCESSORS
+    int formatImp(char          *buffer,
+                  int            bufferSize,
+                  bsl::ostream  *stream,
+                  const Record&  record) const;
+        // Format the specified 'record' according to the format specification
+        // of this record formatter, accumulating the output in the specified
+        // 'buffer' of the specified 'bufferSize'.  If the specified 'stream'
+        // is not 0, write the output to 'stream' each time 'buffer' becomes
+        // full and upon completion; otherwise, discard any output that does
+        // not fit in 'buffer'.  Return the length of the complete formatted
+        // record.
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(RecordStringFormatter,
@@ -302,6 +475,21 @@ class RecordStringFormatter {
     const char *format() const;
         // Return the format specification of this record formatter.
 
+    int printToBuffer(char          *result,
+                      int            numBytes,
+                      const Record&  record) const;
+        // Format the specified 'record' according to the format specification
+        // of this record formatter and write no more than the specified
+        // 'numBytes' of the result to the specified 'result' buffer.  Return
+        // the number of characters (not including the null character) that
+        // would have been written if the limit due to 'numBytes' were not
+        // imposed.  'result' is null-terminated unless 'numBytes' is 0.  The
+        // timestamp offset of this record formatter is added to each timestamp
+        // that is written.  The behavior is undefined unless '0 <= numBytes'
+        // and 'result' refers to at least 'numBytes' contiguous bytes.  Note
+        // that the return value is greater than or equal to 'numBytes' if the
+        // output was truncated to avoid 'result' overrun.
+
     bool isPublishInLocalTimeEnabled() const;
         // Return 'true' if this formatter adjusts the timestamp attribute to
         // the current local time, and 'false' otherwise.
@@ -355,12 +543,6 @@ void RecordStringFormatter::enablePublishInLocalTime()
     d_timestampOffset.setTotalMilliseconds(k_ENABLE_PUBLISH_IN_LOCALTIME);
 }
 
-inline
-void RecordStringFormatter::setFormat(const char *format)
-{
-    d_formatSpec = format;
-}
-
 inline
 void RecordStringFormatter::setTimestampOffset(
                                           const bdlt::DatetimeInterval& offset)
@@ -6,9 +6,13 @@
 #include <ball_severity.h>
 #include <ball_userfields.h>
 
+#include <bdlsb_memoutstreambuf.h>
+
 #include <bdlt_currenttime.h>
 #include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
 #include <bdlt_iso8601util.h>
+#include <bdlt_iso8601utilconfiguration.h>
 #include <bdlt_localtimeoffset.h>
 
 #include <bslim_testutil.h>
@@ -21,6 +25,7 @@
 #include <bslmt_threadutil.h>
 
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_iostream.h>
@@ -28,7 +33,9 @@
 #include <bsl_ostream.h>
 #include <bsl_string.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>                  // for 'strcmp'
 
@@ -82,6 +89,7 @@ using bsl::uppercase;
 // [13] bool isPublishInLocalTimeEnabled() const;
 // [ 2] const bdlt::DatetimeInterval& timestampOffset() const;
 // [11] void operator()(bsl::ostream&, const ball::Record&) const;
+// [14] int printToBuffer(char *, int, const ball::Record&) const;
 // FREE OPERATORS
 // [ 6] bool operator==(const ball::RSF& lhs, const ball::RSF& rhs);
 // [ 6] bool operator!=(const ball::RSF& lhs, const ball::RSF& rhs);
@@ -89,6 +97,8 @@ using bsl::uppercase;
 // ----------------------------------------------------------------------------
 // [ 1] breathing test
 // [12] USAGE example
+// [14] CONCERN: TIMESTAMPS WITHIN A SECOND ARE RENDERED CORRECTLY
+// [-1] PERFORMANCE: FORMATTING THROUGHPUT
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -263,6 +273,305 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING 'printToBuffer'
+        //
+        // Concerns:
+        //: 1 'printToBuffer' produces the same output as 'operator()' for any
+        //:   format specification, including ones containing unrecognized or
+        //:   incomplete '%'-conversions and '\'-escapes.
+        //:
+        //: 2 'printToBuffer' truncates its output to fit the supplied buffer,
+        //:   null-terminates it unless the buffer size is 0, and returns the
+        //:   length of the complete output regardless of truncation.
+        //:
+        //: 3 'operator()' formats records longer than its internal buffer
+        //:   correctly.
+        //:
+        //: 4 Timestamps are rendered correctly in each format, for successive
+        //:   records within the same second, across second boundaries, and
+        //:   when the timestamp offset changes between records.
+        //:
+        //: 5 The compiled form of the format specification follows
+        //:   'setFormat', copy construction, and assignment.
+        //:
+        //: 6 'printToBuffer' allocates no memory for formats that do not
+        //:   include '%x', '%X', or '%u'.
+        //
+        // Plan:
+        //: 1 For a table of format specifications, compare the output of
+        //:   'printToBuffer' to that of 'operator()', for every buffer size
+        //:   from 0 to 2 beyond the length of the output.  (C-1..2)
+        //:
+        //: 2 Format a record whose message is several times larger than the
+        //:   internal buffer of 'operator()', and compare the output to that
+        //:   of 'printToBuffer'.  (C-3)
+        //:
+        //: 3 Format a sequence of records having increasing timestamps with a
+        //:   formatter having a format specification with every timestamp
+        //:   conversion, and compare the output to the one expected from
+        //:   'bdlt::Datetime::printToBuffer' and 'bdlt::Iso8601Util'.  Vary
+        //:   the timestamp offset of the formatter between records.  (C-4)
+        //:
+        //: 4 Change the format specification of an object with 'setFormat',
+        //:   then copy and assign it, and verify that the output of each
+        //:   object reflects the new format specification.  (C-5)
+        //:
+        //: 5 Use test allocators installed as the default and object
+        //:   allocators to verify that 'printToBuffer' does not allocate.
+        //:   (C-6)
+        //
+        // Testing:
+        //   int printToBuffer(char *, int, const ball::Record&) const;
+        //   CONCERN: TIMESTAMPS WITHIN A SECOND ARE RENDERED CORRECTLY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'printToBuffer'"
+                          << "\n=======================" << endl;
+
+        ball::RecordAttributes fixedFields(
+                                      bdlt::Datetime(2020, 3, 4, 5, 6, 7, 89),
+                                      1234,
+                                      0xABCDEF,
+                                      "subdir/process.cpp",
+                                      542,
+                                      "FOO.BAR.BAZ",
+                                      ball::Severity::e_WARN,
+                                      "Hello world!");
+
+        ball::UserFields userFields;
+        userFields.appendString("string");
+        userFields.appendInt64(1000000);
+
+        const ball::Record record(fixedFields, userFields);
+
+        if (veryVerbose) cout << "\tCompare with 'operator()'." << endl;
+        {
+            static const struct {
+                int         d_line;      // source line number
+                const char *d_format_p;  // format specification
+            } DATA[] = {
+                //LINE  FORMAT
+                //----  -----------------------------------------------------
+                { L_,   ""                                                   },
+                { L_,   "plain text"                                         },
+                { L_,   "%d"                                                 },
+                { L_,   "%D"                                                 },
+                { L_,   "%i"                                                 },
+                { L_,   "%I"                                                 },
+                { L_,   "%O"                                                 },
+                { L_,   "%p %t %T %s %l"                                     },
+                { L_,   "%f %F %c"                                           },
+                { L_,   "%m %x %X"                                           },
+                { L_,   "%u"                                                 },
+                { L_,   "%%%%"                                               },
+                { L_,   "\\n\\t\\\\"                                         },
+                { L_,   "%z %Q \\q"                                          },
+                { L_,   "trailing %"                                         },
+                { L_,   "trailing \\"                                        },
+                { L_,   "%m%m%m"                                             },
+                { L_,   "[%d] [%i] [%D] [%I] [%O]"                           },
+                { L_,   "\n%d %p:%t %s %f:%l %c %m %u\n"                     },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE   = DATA[ti].d_line;
+                const char *FORMAT = DATA[ti].d_format_p;
+
+                const Obj X(FORMAT);
+
+                ostringstream oss;
+                X(oss, record);
+
+                const string EXPECTED = oss.str();
+                const int    LENGTH   = static_cast<int>(EXPECTED.length());
+
+                if (veryVeryVerbose) { T_ P_(LINE) P(EXPECTED) }
+
+                for (int numBytes = 0; numBytes <= LENGTH + 2; ++numBytes) {
+                    char buffer[1024];
+                    bsl::memset(buffer, 'Z', sizeof buffer);
+
+                    const int rc = X.printToBuffer(buffer, numBytes, record);
+
+                    ASSERTV(LINE, numBytes, rc, LENGTH == rc);
+
+                    if (0 == numBytes) {
+                        ASSERTV(LINE, 'Z' == buffer[0]);
+                        continue;
+                    }
+
+                    const int written = bsl::min(LENGTH, numBytes - 1);
+
+                    ASSERTV(LINE, numBytes,
+                            0 == bsl::memcmp(buffer,
+                                             EXPECTED.data(),
+                                             written));
+                    ASSERTV(LINE, numBytes, '\0' == buffer[written]);
+                    ASSERTV(LINE, numBytes, 'Z'  == buffer[written + 1]);
+                }
+            }
+        }
+
+        if (veryVerbose) cout << "\tTesting long records." << endl;
+        {
+            const string MESSAGE(5000, 'x');
+
+            ball::Record longRecord(record);
+            longRecord.fixedFields().setMessage(MESSAGE.c_str());
+
+            const Obj X("<%m|%m>");
+
+            ostringstream oss;
+            X(oss, longRecord);
+
+            const string EXPECTED = "<" + MESSAGE + "|" + MESSAGE + ">";
+
+            ASSERT(EXPECTED == oss.str());
+
+            bsl::vector<char> buffer(EXPECTED.length() + 1);
+
+            ASSERT(static_cast<int>(EXPECTED.length()) ==
+                          X.printToBuffer(buffer.data(),
+                                          static_cast<int>(buffer.size()),
+                                          longRecord));
+            ASSERT(EXPECTED == buffer.data());
+        }
+
+        if (veryVerbose) cout << "\tTesting timestamps." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            bdlt::Iso8601UtilConfiguration config;
+            config.setUseZAbbreviationForUtc(true);
+
+            const bdlt::DatetimeInterval OFFSETS[] = {
+                bdlt::DatetimeInterval(0),
+                bdlt::DatetimeInterval(0, 0, 0, 0, 0, 1),
+                bdlt::DatetimeInterval(0, 3, 30),
+                bdlt::DatetimeInterval(0, -5),
+            };
+            const int NUM_OFFSETS = sizeof OFFSETS / sizeof *OFFSETS;
+
+            bdlt::Datetime timestamp(2020, 12, 31, 23, 59, 58, 999, 990);
+
+            ball::Record mR(record);
+
+            for (int i = 0; i < 100; ++i) {
+                // Advance the timestamp by a little less than a third of a
+                // second, and change the offset every seven records, so that
+                // records both share and cross seconds (and days).
+
+                timestamp.addMicroseconds(333331);
+
+                const bdlt::DatetimeInterval& OFFSET =
+                                                OFFSETS[(i / 7) % NUM_OFFSETS];
+
+                // The offset must be whole minutes to be represented in
+                // ISO 8601 format; the microsecond offset is exercised with
+                // the '%d' and '%D' conversions only.
+
+                const bool ISO_OK = 0 == OFFSET.microseconds();
+
+                mX.setFormat(ISO_OK ? "%d|%D|%i|%I|%O" : "%d|%D");
+                mX.setTimestampOffset(OFFSET);
+                mR.fixedFields().setTimestamp(timestamp);
+
+                const bdlt::Datetime local = timestamp + OFFSET;
+
+                char expected[256];
+                int  length = local.printToBuffer(expected,
+                                                  sizeof expected,
+                                                  3);
+                expected[length++] = '|';
+                length += local.printToBuffer(expected + length,
+                                              sizeof expected - length,
+                                              6);
+
+                if (ISO_OK) {
+                    const bdlt::DatetimeTz localTz(
+                                     local,
+                                     static_cast<int>(OFFSET.totalMinutes()));
+
+                    for (int precision = 0; precision <= 6; precision += 3) {
+                        config.setFractionalSecondPrecision(precision);
+
+                        expected[length++] = '|';
+                        length += bdlt::Iso8601Util::generateRaw(
+                                                             expected + length,
+                                                             localTz,
+                                                             config);
+                    }
+                }
+                expected[length] = '\0';
+
+                char actual[256];
+                X.printToBuffer(actual, sizeof actual, mR);
+
+                if (veryVeryVerbose) { T_ P_(expected) P(actual) }
+
+                ASSERTV(i, expected, actual, 0 == strcmp(expected, actual));
+            }
+        }
+
+        if (veryVerbose) cout << "\tTesting 'setFormat', copy, and assign."
+                              << endl;
+        {
+            Obj mX("%c");  const Obj& X = mX;
+
+            char buffer[64];
+
+            X.printToBuffer(buffer, sizeof buffer, record);
+            ASSERT(0 == strcmp("FOO.BAR.BAZ", buffer));
+
+            mX.setFormat("<%l>");
+
+            X.printToBuffer(buffer, sizeof buffer, record);
+            ASSERT(0 == strcmp("<542>", buffer));
+
+            const Obj Y(X);
+
+            Y.printToBuffer(buffer, sizeof buffer, record);
+            ASSERT(0 == strcmp("<542>", buffer));
+
+            Obj mZ("%p");  const Obj& Z = mZ;
+
+            mZ = X;
+
+            Z.printToBuffer(buffer, sizeof buffer, record);
+            ASSERT(0 == strcmp("<542>", buffer));
+
+            mX.setFormat("%s");
+
+            X.printToBuffer(buffer, sizeof buffer, record);
+            ASSERT(0 == strcmp("WARN", buffer));
+
+            Z.printToBuffer(buffer, sizeof buffer, record);
+            ASSERT(0 == strcmp("<542>", buffer));
+        }
+
+        if (veryVerbose) cout << "\tTesting allocation." << endl;
+        {
+            bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+            bslma::TestAllocator da("default", veryVeryVeryVerbose);
+
+            const Obj X("\n%d %D %i %I %O %p:%t %T %s %f %F:%l %c %m\n", &oa);
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = oa.numAllocations();
+
+            bslma::DefaultAllocatorGuard guard(&da);
+
+            char buffer[512];
+
+            X.printToBuffer(buffer, sizeof buffer, record);
+            X.printToBuffer(buffer, 16, record);
+
+            ASSERT(0               == da.numAllocations());
+            ASSERT(NUM_ALLOCATIONS == oa.numAllocations());
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // TESTING: Records Show Calculated Local-Time Offset
@@ -1057,12 +1366,14 @@ int main(int argc, char *argv[])
 
                 X(stream, record);
 
-                bool expectIncrease = MSG_LEN > 500;
+                // Output that does not fit in the internal buffer is written
+                // to 'stream' in pieces, so that no message length requires
+                // an allocation.
 
                 ASSERT(oam.isInUseSame());
                 ASSERT(oam.isMaxSame());
                 ASSERT(dam.isInUseSame());
-                ASSERT(expectIncrease == dam.isMaxUp());
+                ASSERTV(MSG_LEN, dam.isMaxSame());
 
                 if (veryVeryVerbose) {
                     P_(oam.isInUseSame());
@@ -1771,6 +2082,90 @@ int main(int argc, char *argv[])
         ASSERT( 1 == (X1 == X4));        ASSERT(0 == (X1 != X4));
       } break;
 
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: FORMATTING THROUGHPUT
+        //
+        // Concerns:
+        //: 1 Report the rate at which records are formatted with the default
+        //:   format specification, both to a stream and to a buffer.
+        //
+        // Plan:
+        //: 1 Format a record (with a timestamp advancing by one microsecond
+        //:   per record) a large number of times using 'operator()' with a
+        //:   stream writing to memory, and using 'printToBuffer', and report
+        //:   the elapsed time of each.  The number of records may be supplied
+        //:   as the second command-line argument.
+        //
+        // Testing:
+        //   PERFORMANCE: FORMATTING THROUGHPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE: FORMATTING THROUGHPUT"
+                          << "\n==================================" << endl;
+
+        const int NUM_RECORDS = argc > 2 && 0 < bsl::atoi(argv[2])
+                                ? bsl::atoi(argv[2])
+                                : 1000000;
+
+        ball::RecordAttributes fixedFields(bdlt::CurrentTime::utc(),
+                                          1234,
+                                          bslmt::ThreadUtil::selfIdAsUint64(),
+                                          "subdir/process.cpp",
+                                          542,
+                                          "FOO.BAR.BAZ",
+                                          ball::Severity::e_WARN,
+                                          "A typical log message of moderate "
+                                          "length");
+
+        ball::Record mR(fixedFields, ball::UserFields());
+
+        const Obj X;
+
+        bdlt::Datetime timestamp = mR.fixedFields().timestamp();
+
+        bdlsb::MemOutStreamBuf streamBuf;
+        bsl::ostream           stream(&streamBuf);
+
+        bsls::Stopwatch timer;
+        timer.start();
+
+        for (int i = 0; i < NUM_RECORDS; ++i) {
+            timestamp.addMicroseconds(1);
+            mR.fixedFields().setTimestamp(timestamp);
+
+            X(stream, mR);
+            streamBuf.pubseekpos(0);
+        }
+
+        timer.stop();
+
+        const double streamTime = timer.elapsedTime();
+
+        char               buffer[512];
+        bsls::Types::Int64 totalLength = 0;
+
+        timer.reset();
+        timer.start();
+
+        for (int i = 0; i < NUM_RECORDS; ++i) {
+            timestamp.addMicroseconds(1);
+            mR.fixedFields().setTimestamp(timestamp);
+
+            totalLength += X.printToBuffer(buffer, sizeof buffer, mR);
+        }
+
+        timer.stop();
+
+        const double bufferTime = timer.elapsedTime();
+
+        cout << "Records: " << NUM_RECORDS << "  (" << totalLength
+             << " bytes to buffer)\n"
+             << "  operator():    " << streamTime << "s, "
+             << NUM_RECORDS / streamTime << " records/s\n"
+             << "  printToBuffer: " << bufferTime << "s, "
+             << NUM_RECORDS / bufferTime << " records/s" << endl;
+      } break;
       default:
         {
             cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
@@ -12,12 +12,119 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(balm_collector_cpp,"$Id$ $CSID$")
 
+#include <bsl_algorithm.h>
+
 namespace BloombergLP {
+namespace balm {
+
+                           // ----------------------
+                           // struct Collector_Shard
+                           // ----------------------
+
+// CREATORS
+Collector_Shard::Collector_Shard()
+: d_lock(bsls::SpinLock::s_unlocked)
+, d_count(0)
+, d_total(0.0)
+, d_min(MetricRecord::k_DEFAULT_MIN)
+, d_max(MetricRecord::k_DEFAULT_MAX)
+{
+}
+
+// MANIPULATORS
+void Collector_Shard::reset()
+{
+    d_count = 0;
+    d_total = 0.0;
+    d_min   = MetricRecord::k_DEFAULT_MIN;
+    d_max   = MetricRecord::k_DEFAULT_MAX;
+}
 
                               // ---------------
                               // class Collector
                               // ---------------
 
+// PRIVATE ACCESSORS
+void Collector::lockAll() const
+{
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        d_shards[i].d_lock.lock();
+    }
+}
+
+void Collector::unlockAll() const
+{
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        d_shards[i].d_lock.unlock();
+    }
+}
+
+void Collector::loadAggregates(MetricRecord *record, bool reset) const
+{
+    int    count = 0;
+    double total = 0.0;
+    double min   = MetricRecord::k_DEFAULT_MIN;
+    double max   = MetricRecord::k_DEFAULT_MAX;
+
+    lockAll();
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        Collector_Shard& shard = d_shards[i];
+
+        count += shard.d_count;
+        total += shard.d_total;
+        min   =  bsl::min(min, shard.d_min);
+        max   =  bsl::max(max, shard.d_max);
+        if (reset) {
+            shard.reset();
+        }
+    }
+    unlockAll();
+
+    record->metricId() = d_metricId;
+    record->count()    = count;
+    record->total()    = total;
+    record->min()      = min;
+    record->max()      = max;
+}
+
+// MANIPULATORS
+void Collector::reset()
+{
+    lockAll();
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        d_shards[i].reset();
+    }
+    unlockAll();
+}
+
+void Collector::loadAndReset(MetricRecord *record)
+{
+    loadAggregates(record, true);
+}
+
+void Collector::setCountTotalMinMax(int    count,
+                                    double total,
+                                    double min,
+                                    double max)
+{
+    lockAll();
+    for (int i = 1; i < k_NUM_SHARDS; ++i) {
+        d_shards[i].reset();
+    }
+    d_shards[0].d_count = count;
+    d_shards[0].d_total = total;
+    d_shards[0].d_min   = min;
+    d_shards[0].d_max   = max;
+    unlockAll();
+}
+
+// ACCESSORS
+void Collector::load(MetricRecord *record) const
+{
+    loadAggregates(record, false);
+}
+
+}  // close package namespace
 }  // close enterprise namespace
 
 // ----------------------------------------------------------------------------
@@ -17,6 +17,7 @@ BSLS_IDENT("$Id: balm_collector.h,v 1.7 2008/04/16 20:00:49 hversche Exp $")
 //
 //@CLASSES:
 //   balm::Collector: a container for collecting and aggregating metric values
+//   balm::Collector_Shard: *private* one stripe of a 'balm::Collector'
 //
 //@SEE_ALSO: balm_collectorrepository, balm_metric
 //
@@ -45,6 +46,23 @@ BSLS_IDENT("$Id: balm_collector.h,v 1.7 2008/04/16 20:00:49 hversche Exp $")
 // operations on a given instance can be safely invoked simultaneously from
 // multiple threads.
 //
+///Performance
+///-----------
+// A 'balm::Collector' is typically updated far more often than it is read,
+// and often by many threads at once (e.g., a latency metric updated on every
+// request).  To keep those updates from serializing on a single lock, a
+// collector is divided into a fixed number of shards, each padded to the size
+// of a cache line and holding its own count, total, minimum, and maximum
+// guarded by its own spin lock.  'update' and 'accumulateCountTotalMinMax'
+// modify only the shard selected by the identifier of the calling thread, so
+// that threads updating the same collector rarely share a cache line and
+// normally acquire an uncontended lock -- a single atomic operation.  The
+// operations that read or replace the whole value ('load', 'loadAndReset',
+// 'reset', and 'setCountTotalMinMax') lock every shard, in order, and combine
+// (or reset) their values, so they are atomic with respect to updates but are
+// more expensive than they would be on an unsharded collector.  They are
+// expected to be called only once per publication interval.
+//
 ///Usage
 ///-----
 // The following example creates a 'balm::Collector', modifies its values, then
@@ -85,8 +103,11 @@ BSLS_IDENT("$Id: balm_collector.h,v 1.7 2008/04/16 20:00:49 hversche Exp $")
 #include <balm_metricrecord.h>
 #include <balm_metricid.h>
 
-#include <bslmt_mutex.h>
-#include <bslmt_lockguard.h>
+#include <bslmt_platform.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_spinlock.h>
+#include <bsls_types.h>
 
 #include <bsl_algorithm.h>
 
@@ -95,28 +116,98 @@ namespace BloombergLP {
 
 namespace balm {
 
+                           // ======================
+                           // struct Collector_Shard
+                           // ======================
+
+struct Collector_Shard {
+    // This 'struct' holds the count, total, minimum, and maximum accumulated
+    // in one shard of a 'Collector', and the lock guarding them.  This is an
+    // implementation type of 'Collector' and should not be used by clients of
+    // this package.
+
+    // DATA
+    bsls::SpinLock d_lock;   // guards the other members of this shard
+    int            d_count;  // aggregated count of events
+    double         d_total;  // total of values across events
+    double         d_min;    // minimum value across events
+    double         d_max;    // maximum value across events
+
+    // CREATORS
+    Collector_Shard();
+        // Create a shard having a count of 0, a total of 0.0, a minimum of
+        // 'MetricRecord::k_DEFAULT_MIN', and a maximum of
+        // 'MetricRecord::k_DEFAULT_MAX'.
+
+    // MANIPULATORS
+    void reset();
+        // Reset the count, total, minimum, and maximum of this shard to their
+        // default values.  The behavior is undefined unless 'd_lock' is held
+        // by the calling thread.
+};
+
                               // ===============
                               // class Collector
                               // ===============
 
 class Collector {
     // This class provides a mechanism for collecting and aggregating the
-    // value of a metric over a period of time.  The collector contains a
-    // 'MetricRecord' object that holds the identity of the metric being
-    // collected, the number of times an event occurred, and the total,
-    // minimum, and maximum aggregates of the associated measurement value.
-    // The default value for the count is 0, the default value for the total
-    // is 0.0, the default minimum value is 'MetricRecord::k_DEFAULT_MIN', and
-    // the default maximum value is 'MetricRecord::k_DEFAULT_MAX'.
+    // value of a metric over a period of time.  The collector holds the
+    // identity of the metric being collected, the number of times an event
+    // occurred, and the total, minimum, and maximum aggregates of the
+    // associated measurement value, spread over a fixed number of shards (see
+    // {Performance}).  The default value for the count is 0, the default
+    // value for the total is 0.0, the default minimum value is
+    // 'MetricRecord::k_DEFAULT_MIN', and the default maximum value is
+    // 'MetricRecord::k_DEFAULT_MAX'.
+
+    // PRIVATE TYPES
+    enum {
+        k_SHARD_BITS = 3,                 // log2 of the number of shards
+
+        k_NUM_SHARDS = 1 << k_SHARD_BITS  // number of shards
+    };
+
+    struct PaddedShard : Collector_Shard {
+        // This 'struct' pads a shard to the size of a cache line, so that the
+        // data of two shards are never less than a cache line apart and
+        // threads updating different shards rarely contend for the same cache
+        // line.  Note that a shard is deliberately not over-aligned: a
+        // collector is created by an allocator that guarantees only the
+        // maximal fundamental alignment.
+
+        // DATA
+        char d_pad[bslmt::Platform::e_CACHE_LINE_SIZE
+                                                   - sizeof(Collector_Shard)];
+                                       // padding to the size of a cache line
+    };
 
     // DATA
-    MetricRecord         d_record;  // the recorded metric information
-    mutable bslmt::Mutex d_lock;    // record synchronization mechanism
+    MetricId            d_metricId;              // metric identifier
+
+    mutable PaddedShard d_shards[k_NUM_SHARDS];  // accumulated values
 
     // NOT IMPLEMENTED
     Collector(const Collector&);
     Collector& operator=(const Collector&);
 
+    // PRIVATE CLASS METHODS
+    static int shardIndex();
+        // Return the index of the shard updated by the calling thread.
+
+    // PRIVATE ACCESSORS
+    void lockAll() const;
+        // Acquire the locks of all shards of this collector, in order.
+
+    void unlockAll() const;
+        // Release the locks of all shards of this collector.
+
+    void loadAggregates(MetricRecord *record, bool reset) const;
+        // Load into the specified 'record' the id of the metric being
+        // collected and the aggregated values of all shards of this
+        // collector, and if the specified 'reset' is 'true', reset every
+        // shard to its default values, all in a single atomic operation.
+
   public:
      // CREATORS
     Collector(const MetricId& metricId);
@@ -190,8 +281,7 @@ class Collector {
 // CREATORS
 inline
 Collector::Collector(const MetricId& metricId)
-: d_record(metricId)
-, d_lock()
+: d_metricId(metricId)
 {
 }
 
@@ -200,36 +290,31 @@ Collector::~Collector()
 {
 }
 
-// MANIPULATORS
+// PRIVATE CLASS METHODS
 inline
-void Collector::reset()
+int Collector::shardIndex()
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    d_record.count() = 0;
-    d_record.total() = 0.0;
-    d_record.min()   = MetricRecord::k_DEFAULT_MIN;
-    d_record.max()   = MetricRecord::k_DEFAULT_MAX;
-}
+    // Spread the (often aligned) thread identifiers over the shards using the
+    // high-order bits of a multiplicative hash.
 
-inline
-void Collector::loadAndReset(MetricRecord *record)
-{
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    *record          = d_record;
-    d_record.count() = 0;
-    d_record.total() = 0.0;
-    d_record.min()   = MetricRecord::k_DEFAULT_MIN;
-    d_record.max()   = MetricRecord::k_DEFAULT_MAX;
+    const bsls::Types::Uint64 k_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+
+    return static_cast<int>((bslmt::ThreadUtil::selfIdAsUint64()
+                                                              * k_MULTIPLIER)
+                            >> (64 - k_SHARD_BITS));
 }
 
+// MANIPULATORS
 inline
 void Collector::update(double value)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    ++d_record.count();
-    d_record.total() += value;
-    d_record.min()   =  bsl::min(d_record.min(), value);
-    d_record.max()   =  bsl::max(d_record.max(), value);
+    Collector_Shard&    shard = d_shards[shardIndex()];
+    bsls::SpinLockGuard guard(&shard.d_lock);
+
+    ++shard.d_count;
+    shard.d_total += value;
+    shard.d_min   =  bsl::min(shard.d_min, value);
+    shard.d_max   =  bsl::max(shard.d_max, value);
 }
 
 inline
@@ -238,39 +323,22 @@ void Collector::accumulateCountTotalMinMax(int    count,
                                            double min,
                                            double max)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    d_record.count() += count;
-    d_record.total() += total;
-    d_record.min()   =  bsl::min(d_record.min(), min);
-    d_record.max()   =  bsl::max(d_record.max(), max);
-}
+    Collector_Shard&    shard = d_shards[shardIndex()];
+    bsls::SpinLockGuard guard(&shard.d_lock);
 
-inline
-void Collector::setCountTotalMinMax(int    count,
-                                    double total,
-                                    double min,
-                                    double max)
-{
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    d_record.count() = count;
-    d_record.total() = total;
-    d_record.min()   = min;
-    d_record.max()   = max;
+    shard.d_count += count;
+    shard.d_total += total;
+    shard.d_min   =  bsl::min(shard.d_min, min);
+    shard.d_max   =  bsl::max(shard.d_max, max);
 }
 
 // ACCESSORS
 inline
 const MetricId& Collector::metricId() const
 {
-    return d_record.metricId();
+    return d_metricId;
 }
 
-inline
-void Collector::load(MetricRecord *record) const
-{
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    *record = d_record;
-}
 }  // close package namespace
 
 }  // close enterprise namespace
@@ -15,10 +15,12 @@
 #include <bslma_testallocator.h>
 
 #include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
 #include <bdlmt_fixedthreadpool.h>
 
 #include <bdlf_bind.h>
 
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_cstring.h>
@@ -68,6 +70,7 @@ using bsl::flush;
 // [ 1] BREATHING TEST
 // [ 8] CONCURRENCY TEST
 // [ 9] USAGE EXAMPLE
+// [-1] CONCERN: PERFORMANCE OF CONCURRENT UPDATES
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -113,6 +116,8 @@ typedef balm::MetricRecord      Rec;
 typedef balm::MetricId          Id;
 typedef balm::MetricDescription Desc;
 
+const int k_NUM_UPDATES = 1000;  // updates per thread in 'ConcurrencyTest'
+
 // ============================================================================
 //                      GLOBAL STUB CLASSES FOR TESTING
 // ----------------------------------------------------------------------------
@@ -207,6 +212,26 @@ void ConcurrencyTest::execute()
         ASSERT(result == r1 || result == empty);
     }
     d_barrier.wait();
+
+    mX->reset();
+
+    // Test simultaneous updates, verify that no update is lost when the
+    // values accumulated by the different threads are combined (checked by
+    // the caller once all threads are done).
+    d_barrier.wait();
+    for (int i = 1; i <= k_NUM_UPDATES; ++i) {
+        mX->update(i);
+    }
+}
+
+void updateLoop(Obj *collector, int numUpdates, bslmt::Barrier *barrier)
+    // Wait on the specified 'barrier', then update the specified 'collector'
+    // the specified 'numUpdates' times.
+{
+    barrier->wait();
+    for (int i = 0; i < numUpdates; ++i) {
+        collector->update(i);
+    }
 }
 
 void ConcurrencyTest::runTest()
@@ -323,6 +348,16 @@ int main(int argc, char *argv[])
             ConcurrencyTest tester(10, &mX, &defaultAllocator);
             tester.runTest();
         }
+
+        balm::MetricRecord record;
+        mX.load(&record);
+
+        const int N = k_NUM_UPDATES;
+
+        ASSERTV(record.count(), 10 * N == record.count());
+        ASSERTV(record.total(), 10 * (N * (N + 1) / 2) == record.total());
+        ASSERTV(record.min(),   1 == record.min());
+        ASSERTV(record.max(),   N == record.max());
       } break;
       case 7: {
         // --------------------------------------------------------------------
@@ -782,6 +817,67 @@ int main(int argc, char *argv[])
         ASSERT(Rec::k_DEFAULT_MAX == r1.max());
 
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // CONCERN: PERFORMANCE OF CONCURRENT UPDATES
+        //
+        // Concerns:
+        //: 1 The cost of 'update' does not grow sharply with the number of
+        //:   threads updating the same collector.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, 8, and 16 threads (or up to the maximum specified by
+        //:   'argv[2]'), have every thread call 'update' a number of times
+        //:   (1000000, or as specified by 'argv[3]') on the same collector,
+        //:   and report the number of updates per second.
+        //
+        // Testing:
+        //   CONCERN: PERFORMANCE OF CONCURRENT UPDATES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: PERFORMANCE OF CONCURRENT UPDATES"
+                          << endl
+                          << "=========================================="
+                          << endl;
+
+        const int maxNumThreads = argc > 2 && bsl::atoi(argv[2]) > 0
+                                ? bsl::atoi(argv[2])
+                                : 16;
+        const int numUpdates    = argc > 3 && bsl::atoi(argv[3]) > 0
+                                ? bsl::atoi(argv[3])
+                                : 1000000;
+
+        cout << "threads\tupdates/s" << endl;
+        for (int numThreads = 1;
+             numThreads <= maxNumThreads;
+             numThreads *= 2) {
+            balm::Collector mX(METRIC_A);
+
+            bslmt::Barrier     barrier(numThreads + 1);
+            bslmt::ThreadGroup threads;
+            threads.addThreads(bdlf::BindUtil::bind(&updateLoop,
+                                                    &mX,
+                                                    numUpdates,
+                                                    &barrier),
+                               numThreads);
+
+            bsls::Stopwatch timer;
+            timer.start();
+            barrier.wait();
+            threads.joinAll();
+            timer.stop();
+
+            balm::MetricRecord record;
+            mX.load(&record);
+            ASSERTV(record.count(), numThreads * numUpdates == record.count());
+
+            cout << numThreads << '\t'
+                 << numThreads * static_cast<double>(numUpdates)
+                                                          / timer.elapsedTime()
+                 << endl;
+        }
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
         testStatus = -1;
@@ -41,6 +41,14 @@ void combine(balm::MetricRecord *record, const balm::MetricRecord& value)
     record->total()   += value.total();
     record->min()      = bsl::min(record->min(), value.min());
     record->max()      = bsl::max(record->max(), value.max());
+
+    if (value.hasQuantiles()) {
+        for (int i = 0; i < balm::MetricRecord::k_NUM_QUANTILES; ++i) {
+            const balm::MetricRecord::Quantile quantile =
+                                 static_cast<balm::MetricRecord::Quantile>(i);
+            record->setQuantile(quantile, value.quantile(quantile));
+        }
+    }
 }
 
 }  // close unnamed namespace
@@ -262,7 +270,9 @@ class CollectorRepository_MetricCollectors {
     // 'IntegerCollector' objects, respectively.   The 'collectAndReset' method
     // obtains the aggregate value of all the owned collectors and integer
     // collectors, and then resets those collectors and integer collectors to
-    // their default state.
+    // their default state.  A 'HistogramCollector' for the metric is created
+    // only on demand (by 'createHistogramCollector'), so that metrics whose
+    // distribution is not tracked do not pay for its buckets.
 
     // PRIVATE TYPES
     typedef CollectorRepository_Collectors<Collector>
@@ -271,8 +281,18 @@ class CollectorRepository_MetricCollectors {
                                                         IntCollectors;
 
     // DATA
-    Collectors    d_collectors;     // collector objects
-    IntCollectors d_intCollectors;  // integer collector objects
+    Collectors                          d_collectors;     // collector objects
+
+    IntCollectors                       d_intCollectors;  // integer collector
+                                                          // objects
+
+    bsl::shared_ptr<HistogramCollector> d_histogramCollector;
+                                                          // histogram
+                                                          // collector, or 0 if
+                                                          // not yet created
+
+    bslma::Allocator                   *d_allocator_p;    // allocator (held,
+                                                          // not owned)
 
     // NOT IMPLEMENTED
     CollectorRepository_MetricCollectors(
@@ -306,12 +326,24 @@ class CollectorRepository_MetricCollectors {
         // Return a reference to the modifiable container of
         // 'IntegerCollector' objects.
 
+    HistogramCollector *histogramCollector();
+        // Return the address of the modifiable histogram collector for this
+        // metric, or 0 if 'createHistogramCollector' has not been called.
+
+    HistogramCollector *createHistogramCollector();
+        // Return the address of the modifiable histogram collector for this
+        // metric, creating it if it does not already exist.  Note that the
+        // caller must hold a lock excluding concurrent calls to any method of
+        // this object.
+
     void collectAndReset(MetricRecord *record);
         // Load into the specified 'record' the aggregate value of all the
         // records collected by the collectors owned by this object; then
         // reset those collectors to their default values.  Note that all
         // collectors within this object record values for the same metric id,
-        // so they can be aggregated into a single record.
+        // so they can be aggregated into a single record.  Also note that the
+        // quantiles of 'record', if any, are those of the values recorded by
+        // the histogram collector.
 
     void collect(MetricRecord *record);
         // Load into the specified 'record' the aggregate value of all the
@@ -349,6 +381,8 @@ CollectorRepository_MetricCollectors(const MetricId&   id,
                                      bslma::Allocator *basicAllocator)
 : d_collectors(id, basicAllocator)
 , d_intCollectors(id, basicAllocator)
+, d_histogramCollector()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
 
@@ -373,6 +407,23 @@ CollectorRepository_MetricCollectors::intCollectors()
     return d_intCollectors;
 }
 
+inline
+HistogramCollector *CollectorRepository_MetricCollectors::histogramCollector()
+{
+    return d_histogramCollector.get();
+}
+
+HistogramCollector *
+CollectorRepository_MetricCollectors::createHistogramCollector()
+{
+    if (!d_histogramCollector) {
+        d_histogramCollector.reset(
+              new (*d_allocator_p) HistogramCollector(d_collectors.metricId()),
+              d_allocator_p);
+    }
+    return d_histogramCollector.get();
+}
+
 void CollectorRepository_MetricCollectors::collectAndReset(
                                                           MetricRecord *record)
 {
@@ -380,6 +431,10 @@ void CollectorRepository_MetricCollectors::collectAndReset(
     MetricRecord tempRecord;
     d_intCollectors.collectAndReset(&tempRecord);
     combine(record, tempRecord);
+    if (d_histogramCollector) {
+        d_histogramCollector->loadAndReset(&tempRecord);
+        combine(record, tempRecord);
+    }
 }
 
 void CollectorRepository_MetricCollectors::collect(MetricRecord *record)
@@ -388,6 +443,10 @@ void CollectorRepository_MetricCollectors::collect(MetricRecord *record)
     MetricRecord tempRecord;
     d_intCollectors.collect(&tempRecord);
     combine(record, tempRecord);
+    if (d_histogramCollector) {
+        d_histogramCollector->load(&tempRecord);
+        combine(record, tempRecord);
+    }
 }
 
 // ACCESSORS
@@ -531,6 +590,28 @@ IntegerCollector *CollectorRepository::getDefaultIntegerCollector(
     return getMetricCollectors(metricId).intCollectors().defaultCollector();
 }
 
+HistogramCollector *CollectorRepository::getDefaultHistogramCollector(
+                                                      const MetricId& metricId)
+{
+    // First, obtain a read-lock, and test if the histogram collector for
+    // 'metricId' already exists.
+    {
+        bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+        Collectors::iterator it = d_collectors.find(metricId);
+        if (it != d_collectors.end()) {
+            HistogramCollector *collector = it->second->histogramCollector();
+            if (collector) {
+                return collector;                                     // RETURN
+            }
+        }
+    }
+
+    // The histogram collector is created under the write-lock, which excludes
+    // 'collect' and 'collectAndReset' from reading it concurrently.
+    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+    return getMetricCollectors(metricId).createHistogramCollector();
+}
+
 bsl::shared_ptr<Collector> CollectorRepository::addCollector(
                                                       const MetricId& metricId)
 {
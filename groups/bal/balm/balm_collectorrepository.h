@@ -18,7 +18,8 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //   balm::CollectorRepository: a repository for collectors
 //
-//@SEE_ALSO: balm_collector, balm_integercollector, balm_metricsmanager
+//@SEE_ALSO: balm_collector, balm_integercollector, balm_histogramcollector,
+//           balm_metricsmanager
 //
 //@DESCRIPTION: This component defines a class, 'balm::CollectorRepository',
 // that serves as a repository for 'balm::Collector' and
@@ -38,6 +39,13 @@ BSLS_IDENT("$Id: $")
 // collects and returns metric records from each of the collectors in the
 // repository.
 //
+// In addition, a metric may have a single 'balm::HistogramCollector',
+// obtained using 'getDefaultHistogramCollector', which records the
+// distribution of the metric's values without locking.  A histogram collector
+// is created the first time it is requested for a metric; once created, the
+// record collected for the metric includes the values recorded by the
+// histogram collector, as well as their quantiles (see 'balm_metricrecord').
+//
 ///Alternative Systems for Telemetry
 ///---------------------------------
 // Bloomberg software may alternatively use the GUTS telemetry API, which is
@@ -109,6 +117,7 @@ BSLS_IDENT("$Id: $")
 #include <balscm_version.h>
 
 #include <balm_collector.h>
+#include <balm_histogramcollector.h>
 #include <balm_integercollector.h>
 #include <balm_metricid.h>
 #include <balm_metricrecord.h>
@@ -261,6 +270,29 @@ class CollectorRepository {
         // repository, create one, add it to the repository, and return its
         // address.
 
+    HistogramCollector *getDefaultHistogramCollector(const char *category,
+                                                     const char *metricName);
+        // Return the address of the modifiable histogram collector identified
+        // by the specified null-terminated strings 'category' and
+        // 'metricName'.  If a histogram collector for the identified metric
+        // does not already exist in the repository, create one, add it to
+        // the repository, and return its address.  In addition, if the
+        // identified metric has not already been registered, add the
+        // identified metric to the 'metricRegistry' supplied at
+        // construction.  Note that this operation is logically equivalent to:
+        //..
+        //  getDefaultHistogramCollector(registry().getId(category,
+        //                                                metricName))
+        //..
+
+    HistogramCollector *getDefaultHistogramCollector(const MetricId& metricId);
+        // Return the address of the modifiable histogram collector identified
+        // by the specified 'metricId'.  If a histogram collector for the
+        // identified metric does not already exist in the repository, create
+        // one, add it to the repository, and return its address.  Note that
+        // the values recorded by the returned collector, and their quantiles,
+        // are included in the record collected for the metric.
+
     bsl::shared_ptr<Collector> addCollector(const char *category,
                                             const char *metricName);
         // Return a shared pointer to a newly-created modifiable collector
@@ -366,6 +398,15 @@ IntegerCollector *CollectorRepository::getDefaultIntegerCollector(
                                                           metricName));
 }
 
+inline
+HistogramCollector *CollectorRepository::getDefaultHistogramCollector(
+                                                        const char *category,
+                                                        const char *metricName)
+{
+    return getDefaultHistogramCollector(d_registry_p->getId(category,
+                                                            metricName));
+}
+
 inline
 bsl::shared_ptr<Collector> CollectorRepository::addCollector(
                                                         const char *category,
@@ -9,6 +9,8 @@
 
 #include <balm_collectorrepository.h>
 
+#include <balm_histogram.h>
+
 #include <bslma_testallocator.h>
 #include <bslmt_barrier.h>
 #include <bdlmt_fixedthreadpool.h>
@@ -61,6 +63,8 @@ using bsl::flush;
 // [ 3] getDefaultCollector(const MetricId&);
 // [ 6] getDefaultIntegerCollector(const StringRef&, const StringRef&);
 // [ 3] IntegerCollector *getDefaultIntegerCollector(const MetricId&);
+// [ 9] getDefaultHistogramCollector(const char *, const char *);
+// [ 9] HistogramCollector *getDefaultHistogramCollector(const MetricId&);
 // [ 5] addCollector(const StringRef&, const StringRef&);
 // [ 2] addCollector(const MetricId& metricId);
 // [ 5] addIntegerCollector(const StringRef&, const StringRef&);
@@ -74,7 +78,7 @@ using bsl::flush;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 8] CONCURRENCY TEST
-// [ 9] USAGE EXAMPLE
+// [10] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -399,7 +403,7 @@ int main(int argc, char *argv[])
     bslma::DefaultAllocatorGuard guard(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -476,6 +480,154 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING: 'getDefaultHistogramCollector'
+        //
+        // Concerns:
+        //: 1 'getDefaultHistogramCollector' returns the same collector for a
+        //:   given metric on each invocation, and distinct collectors for
+        //:   distinct metrics.
+        //:
+        //: 2 The returned collector has the supplied metric id, and the
+        //:   metric is registered if it was not already.
+        //:
+        //: 3 The values recorded by the histogram collector are combined with
+        //:   those of the other collectors for the metric, and the collected
+        //:   record holds the quantiles of the histogram collector.
+        //:
+        //: 4 'collect' does not reset the histogram collector, and
+        //:   'collectAndReset' does.
+        //:
+        //: 5 The record of a metric without a histogram collector has no
+        //:   quantiles.
+        //
+        // Plan:
+        //: 1 Obtain histogram collectors for several metrics, using both
+        //:   overloads, and verify their identity and metric id.  (C-1..2)
+        //:
+        //: 2 Update the histogram collector and the default collector of a
+        //:   metric, and verify the records returned by 'collect' and
+        //:   'collectAndReset' against a 'balm::Histogram' holding the
+        //:   values of the histogram collector.  (C-3..5)
+        //
+        // Testing:
+        //   getDefaultHistogramCollector(const char *, const char *);
+        //   HistogramCollector *getDefaultHistogramCollector(const MetricId&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING: 'getDefaultHistogramCollector'" << endl
+                          << "=======================================" << endl;
+
+        bslma::TestAllocator testAllocator;
+        Registry             registry(&testAllocator);
+        Obj                  mX(&registry, &testAllocator);
+
+        if (veryVerbose) cout << "\tVerify identity of the collectors.\n";
+        {
+            balm::HistogramCollector *hA =
+                                 mX.getDefaultHistogramCollector("H", "A");
+            balm::HistogramCollector *hB =
+                                 mX.getDefaultHistogramCollector("H", "B");
+
+            ASSERT(0  != hA);
+            ASSERT(0  != hB);
+            ASSERT(hA != hB);
+
+            const Id idA = registry.getId("H", "A");
+            const Id idB = registry.getId("H", "B");
+
+            ASSERT(idA.isValid());
+            ASSERT(idA == hA->metricId());
+            ASSERT(idB == hB->metricId());
+
+            ASSERT(hA == mX.getDefaultHistogramCollector("H", "A"));
+            ASSERT(hA == mX.getDefaultHistogramCollector(idA));
+            ASSERT(hB == mX.getDefaultHistogramCollector(idB));
+
+            // A metric whose default collector already exists.
+
+            const Id idC = registry.getId("H", "C");
+            Col *cC = mX.getDefaultCollector(idC);
+            balm::HistogramCollector *hC =
+                                          mX.getDefaultHistogramCollector(idC);
+            ASSERT(0   != hC);
+            ASSERT(idC == hC->metricId());
+            ASSERT(cC  == mX.getDefaultCollector(idC));
+            ASSERT(hC  == mX.getDefaultHistogramCollector(idC));
+        }
+
+        if (veryVerbose) cout << "\tVerify collected records.\n";
+        {
+            const Id idA = registry.getId("H", "A");
+            const Id idD = registry.getId("H", "D");
+
+            balm::HistogramCollector *hA =
+                                          mX.getDefaultHistogramCollector(idA);
+            Col *cA = mX.getDefaultCollector(idA);
+            Col *cD = mX.getDefaultCollector(idD);
+
+            balm::Histogram expected;
+            for (int i = 1; i <= 100; ++i) {
+                hA->update(i);
+                expected.add(i);
+            }
+            cA->update(1000.0);
+            cD->update(7.0);
+
+            const balm::Category *CATEGORY = registry.getCategory("H");
+
+            for (int reset = 0; reset < 2; ++reset) {
+                bsl::vector<Rec> records(&testAllocator);
+                if (reset) {
+                    mX.collectAndReset(&records, CATEGORY);
+                }
+                else {
+                    mX.collect(&records, CATEGORY);
+                }
+
+                ASSERTV(reset, records.size(), 4 == records.size());
+
+                for (bsl::size_t i = 0; i < records.size(); ++i) {
+                    const Rec& R = records[i];
+                    if (veryVerbose) { T_ P(R) }
+
+                    if (idA == R.metricId()) {
+                        ASSERTV(reset, R, 101    == R.count());
+                        ASSERTV(reset, R, 6050.0 == R.total());
+                        ASSERTV(reset, R, 1.0    == R.min());
+                        ASSERTV(reset, R, 1000.0 == R.max());
+                        ASSERTV(reset, R, R.hasQuantiles());
+
+                        for (int q = 0; q < Rec::k_NUM_QUANTILES; ++q) {
+                            const Rec::Quantile QUANTILE =
+                                                 static_cast<Rec::Quantile>(q);
+                            ASSERTV(reset, q,
+                                    expected.quantile(
+                                                Rec::quantileLevel(QUANTILE))
+                                                   == R.quantile(QUANTILE));
+                        }
+                    }
+                    else if (idD == R.metricId()) {
+                        ASSERTV(reset, R, 1 == R.count());
+                        ASSERTV(reset, R, !R.hasQuantiles());
+                    }
+                    else {
+                        ASSERTV(reset, R, 0 == R.count());
+                        ASSERTV(reset, R, !R.hasQuantiles());
+                    }
+                }
+            }
+
+            bsl::vector<Rec> records(&testAllocator);
+            mX.collect(&records, CATEGORY);
+            for (bsl::size_t i = 0; i < records.size(); ++i) {
+                ASSERTV(records[i], 0 == records[i].count());
+                ASSERTV(records[i], !records[i].hasQuantiles());
+            }
+        }
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // CONCURRENCY TEST
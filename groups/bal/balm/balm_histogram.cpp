@@ -0,0 +1,184 @@
+// balm_histogram.cpp                                                 -*-C++-*-
+#include <balm_histogram.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_histogram_cpp,"$Id$ $CSID$")
+
+#include <balm_metricrecord.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bsl_limits.h>
+#include <bsl_ostream.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                              // ---------------
+                              // class Histogram
+                              // ---------------
+
+// CLASS METHODS
+double Histogram::bucketLowerBound(int index)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < k_NUM_BUCKETS);
+
+    if (0 == index) {
+        return -bsl::numeric_limits<double>::infinity();              // RETURN
+    }
+    if (k_NUM_BUCKETS - 1 == index) {
+        return bsl::ldexp(1.0, k_MAX_EXPONENT);                       // RETURN
+    }
+
+    const int offset = index - 1;
+    return bsl::ldexp(1.0 + static_cast<double>(offset % k_NUM_SUB_BUCKETS)
+                                                           / k_NUM_SUB_BUCKETS,
+                      k_MIN_EXPONENT + offset / k_NUM_SUB_BUCKETS);
+}
+
+double Histogram::bucketUpperBound(int index)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < k_NUM_BUCKETS);
+
+    if (k_NUM_BUCKETS - 1 == index) {
+        return bsl::numeric_limits<double>::infinity();               // RETURN
+    }
+
+    // The upper bound of a bucket is the lower bound of the next one (the
+    // lower bound of the overflow bucket is '2^k_MAX_EXPONENT').
+
+    return bucketLowerBound(index + 1);
+}
+
+// CREATORS
+Histogram::Histogram()
+{
+    reset();
+}
+
+// MANIPULATORS
+void Histogram::merge(const Histogram& other)
+{
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        d_buckets[i] += other.d_buckets[i];
+    }
+    d_count += other.d_count;
+    accumulateTotalMinMax(other.d_total, other.d_min, other.d_max);
+}
+
+void Histogram::reset()
+{
+    bsl::fill(d_buckets, d_buckets + k_NUM_BUCKETS, 0);
+    d_count = 0;
+    d_total = 0.0;
+    d_min   = MetricRecord::k_DEFAULT_MIN;
+    d_max   = MetricRecord::k_DEFAULT_MAX;
+}
+
+// ACCESSORS
+double Histogram::quantile(double level) const
+{
+    BSLS_ASSERT(0.0 <= level);
+    BSLS_ASSERT(level <= 1.0);
+
+    if (0 == d_count) {
+        return 0.0;                                                   // RETURN
+    }
+
+    // Find the bucket holding the value of rank 'ceil(level * d_count)'
+    // (counting from 1).
+
+    const double        count = static_cast<double>(d_count);
+    bsls::Types::Uint64 rank  = static_cast<bsls::Types::Uint64>(
+                                                     bsl::ceil(level * count));
+    rank = bsl::max<bsls::Types::Uint64>(rank, 1);
+    rank = bsl::min(rank, d_count);
+
+    // The smallest and largest values are known exactly.
+
+    if (1 == rank) {
+        return d_min;                                                 // RETURN
+    }
+    if (d_count == rank) {
+        return d_max;                                                 // RETURN
+    }
+
+    bsls::Types::Uint64 cumulative = 0;
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        cumulative += d_buckets[i];
+        if (cumulative >= rank) {
+            double value;
+            if (0 == i) {
+                value = d_min;
+            }
+            else if (k_NUM_BUCKETS - 1 == i) {
+                value = d_max;
+            }
+            else {
+                value = (bucketLowerBound(i) + bucketUpperBound(i)) / 2;
+            }
+            return bsl::min(bsl::max(value, d_min), d_max);           // RETURN
+        }
+    }
+
+    // The bucket counts add up to less than 'd_count', which is possible only
+    // if they were loaded inconsistently (e.g., by 'addBucketCount').
+
+    return d_max;
+}
+
+bsl::ostream& Histogram::print(bsl::ostream& stream) const
+{
+    stream << "[ " << d_count
+           << " " << d_total
+           << " " << d_min
+           << " " << d_max;
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        if (0 != d_buckets[i]) {
+            stream << " [" << bucketLowerBound(i)
+                   << ", " << bucketUpperBound(i)
+                   << "): " << d_buckets[i];
+        }
+    }
+    stream << " ]";
+    return stream;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+bool balm::operator==(const Histogram& lhs, const Histogram& rhs)
+{
+    if (lhs.count() != rhs.count()
+     || lhs.total() != rhs.total()
+     || lhs.min()   != rhs.min()
+     || lhs.max()   != rhs.max()) {
+        return false;                                                 // RETURN
+    }
+    for (int i = 0; i < Histogram::k_NUM_BUCKETS; ++i) {
+        if (lhs.bucketCount(i) != rhs.bucketCount(i)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,408 @@
+// balm_histogram.h                                                   -*-C++-*-
+#ifndef INCLUDED_BALM_HISTOGRAM
+#define INCLUDED_BALM_HISTOGRAM
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fixed-size log-linear histogram of metric values.
+//
+//@CLASSES:
+//   balm::Histogram: fixed-size, mergeable, log-linear histogram of values
+//
+//@SEE_ALSO: balm_histogramcollector, balm_metricrecord
+//
+//@DESCRIPTION: This component provides a value-semantic class,
+// 'balm::Histogram', that records the distribution of a set of 'double'
+// values in a fixed amount of memory, and from which quantiles (e.g., the
+// median or the 99th percentile) of the recorded values can be estimated.  In
+// addition to the distribution, a histogram maintains the count, total,
+// minimum, and maximum of the recorded values (with the same defaults as
+// 'balm::MetricRecord').
+//
+///Bucket Layout
+///-------------
+// Values are counted in buckets whose width grows with the magnitude of the
+// values they hold ("log-linear" bucketing, as used by HDR histograms): each
+// power-of-two interval '[2^e, 2^(e+1))' is divided into 'k_NUM_SUB_BUCKETS'
+// (32) equal-width buckets, for binary exponents 'e' in the range
+// '[k_MIN_EXPONENT, k_MAX_EXPONENT)' (i.e., values from approximately 2.3e-10
+// to 4.3e+9).  The bucket for a value is computed directly from the exponent
+// and the high-order mantissa bits of its IEEE-754 representation, so
+// recording a value requires neither a search nor a floating-point
+// logarithm.  Two additional buckets hold the values below (including zero
+// and negative values) and above the tracked range.
+//
+// Each bucket spans 1/32 of the power-of-two interval containing it, so a
+// quantile reported as the midpoint of a bucket is within 1/64 (about 1.6%)
+// of any value in that bucket.  Quantiles falling in the underflow or overflow
+// buckets are reported as the recorded minimum or maximum, respectively, and
+// all reported quantiles are clamped to '[min(), max()]'.  The quantiles
+// selecting the smallest and the largest recorded value are reported exactly.
+//
+// A 'balm::Histogram' occupies a little over 16KB and never allocates memory.
+// Since all histograms share the same bucket layout, two histograms can be
+// combined (see 'merge') by adding their bucket counts.
+//
+///Thread Safety
+///-------------
+// 'balm::Histogram' is *const* *thread-safe*, meaning that accessors may be
+// invoked concurrently from different threads, but it is not safe to access or
+// modify a 'balm::Histogram' in one thread while another thread modifies the
+// same object.  See 'balm_histogramcollector' for a mechanism to which values
+// may be recorded concurrently.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Estimating Latency Quantiles
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we have measured the latencies, in milliseconds, of a series of
+// requests, and want to report the median and 99th percentile latencies.
+//
+// First, we create a histogram and record 1000 latencies, most of them
+// between 1 and 2 milliseconds, with a few slow outliers:
+//..
+//  balm::Histogram latencies;
+//  for (int i = 0; i < 1000; ++i) {
+//      latencies.add(0 == i % 100 ? 50.0 + i / 100 : 1.0 + i / 1000.0);
+//  }
+//
+//  assert(1000 == latencies.count());
+//  assert(1.0  <  latencies.min() && latencies.min() < 1.01);
+//  assert(59.0 == latencies.max());
+//..
+// Then, we estimate the median, which is within 1.6% of the actual median of
+// approximately 1.5 milliseconds:
+//..
+//  const double median = latencies.quantile(0.5);
+//  assert(1.47 < median && median < 1.53);
+//..
+// Next, we estimate the 99.9th percentile, which falls among the outliers:
+//..
+//  const double p999 = latencies.quantile(0.999);
+//  assert(58.0 < p999 && p999 <= 59.0);
+//..
+// Finally, we combine the latencies with those measured by another process
+// (all of which are 10 milliseconds), and verify that the median of the
+// combined distribution has moved accordingly:
+//..
+//  balm::Histogram other;
+//  for (int i = 0; i < 3000; ++i) {
+//      other.add(10.0);
+//  }
+//  latencies.merge(other);
+//
+//  assert(4000 == latencies.count());
+//  assert(9.8 < latencies.quantile(0.5) && latencies.quantile(0.5) < 10.2);
+//..
+
+#include <balscm_version.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_cstring.h>
+#include <bsl_iosfwd.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                              // ===============
+                              // class Histogram
+                              // ===============
+
+class Histogram {
+    // This class provides a value-semantic type recording the distribution of
+    // a set of 'double' values in a fixed number of log-linear buckets (see
+    // {Bucket Layout}), along with their count, total, minimum, and maximum.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_SUB_BUCKET_BITS = 5,   // number of mantissa bits selecting a bucket
+                                 // within a power-of-two interval
+
+        k_NUM_SUB_BUCKETS = 1 << k_SUB_BUCKET_BITS,
+                                 // number of buckets per power-of-two interval
+
+        k_MIN_EXPONENT    = -32, // binary exponent of the smallest value
+                                 // not counted in the underflow bucket
+
+        k_MAX_EXPONENT    = 32,  // binary exponent of the smallest value
+                                 // counted in the overflow bucket
+
+        k_NUM_BUCKETS     = (k_MAX_EXPONENT - k_MIN_EXPONENT)
+                                                       * k_NUM_SUB_BUCKETS + 2
+                                 // total number of buckets, including the
+                                 // underflow and overflow buckets
+    };
+
+  private:
+    // DATA
+    bsls::Types::Uint64 d_buckets[k_NUM_BUCKETS];  // count of values per
+                                                   // bucket
+
+    bsls::Types::Uint64 d_count;                   // number of values
+
+    double              d_total;                   // sum of values
+
+    double              d_min;                     // minimum value
+
+    double              d_max;                     // maximum value
+
+  public:
+    // CLASS METHODS
+    static int bucketIndex(double value);
+        // Return the index of the bucket in which the specified 'value' is
+        // counted.  The returned index is in the range '[0, k_NUM_BUCKETS)',
+        // where index 0 is the underflow bucket (values less than
+        // '2^k_MIN_EXPONENT', including 0 and negative values) and index
+        // 'k_NUM_BUCKETS - 1' is the overflow bucket (values greater than or
+        // equal to '2^k_MAX_EXPONENT').  The behavior is undefined if 'value'
+        // is NaN.
+
+    static double bucketLowerBound(int index);
+        // Return the smallest value counted in the bucket at the specified
+        // 'index', or negative infinity if 'index' is 0.  The behavior is
+        // undefined unless '0 <= index < k_NUM_BUCKETS'.
+
+    static double bucketUpperBound(int index);
+        // Return the (exclusive) upper bound of the values counted in the
+        // bucket at the specified 'index', or positive infinity if 'index' is
+        // 'k_NUM_BUCKETS - 1'.  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    // CREATORS
+    Histogram();
+        // Create an empty histogram: the 'count' is 0, the 'total' is 0.0,
+        // the 'min' is 'MetricRecord::k_DEFAULT_MIN', the 'max' is
+        // 'MetricRecord::k_DEFAULT_MAX', and every bucket count is 0.
+
+    // Histogram(const Histogram& original) = default;
+    // ~Histogram() = default;
+
+    // MANIPULATORS
+    // Histogram& operator=(const Histogram& rhs) = default;
+
+    void add(double value);
+        // Record the specified 'value' in this histogram.  The behavior is
+        // undefined if 'value' is NaN.
+
+    void addBucketCount(int index, bsls::Types::Uint64 count);
+        // Add the specified 'count' to both the count of the bucket at the
+        // specified 'index' and the 'count' of this histogram.  Note that this
+        // operation does not modify 'total', 'min', or 'max' (see
+        // 'accumulateTotalMinMax').  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    void accumulateTotalMinMax(double total, double min, double max);
+        // Add the specified 'total' to the total of this histogram, and set
+        // its minimum and maximum to the lesser of the current minimum and the
+        // specified 'min', and the greater of the current maximum and the
+        // specified 'max', respectively.  Note that this operation does not
+        // modify 'count' or any bucket count (see 'addBucketCount').
+
+    void merge(const Histogram& other);
+        // Add the values recorded in the specified 'other' histogram to this
+        // histogram.
+
+    void reset();
+        // Reset this histogram to its default (empty) state.
+
+    // ACCESSORS
+    bsls::Types::Uint64 bucketCount(int index) const;
+        // Return the number of values counted in the bucket at the specified
+        // 'index'.  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    bsls::Types::Uint64 count() const;
+        // Return the number of values recorded in this histogram.
+
+    double total() const;
+        // Return the sum of the values recorded in this histogram.
+
+    double min() const;
+        // Return the minimum value recorded in this histogram, or
+        // 'MetricRecord::k_DEFAULT_MIN' if no values have been recorded.
+
+    double max() const;
+        // Return the maximum value recorded in this histogram, or
+        // 'MetricRecord::k_DEFAULT_MAX' if no values have been recorded.
+
+    double quantile(double level) const;
+        // Return an estimate of the value below which the specified 'level'
+        // fraction of the recorded values fall (e.g., the 99th percentile for
+        // a 'level' of 0.99), or 0.0 if 'count()' is 0.  The returned value
+        // is the midpoint of the bucket holding the 'ceil(level * count())'th
+        // smallest recorded value, clamped to '[min(), max()]' (see
+        // {Bucket Layout}), except that 'min()' and 'max()' are returned
+        // exactly for the smallest and largest values, respectively.  The
+        // behavior is undefined unless '0.0 <= level <= 1.0'.
+
+    bsl::ostream& print(bsl::ostream& stream) const;
+        // Write a description of this histogram (its count, total, minimum,
+        // maximum, and the bounds and counts of its non-empty buckets) to the
+        // specified 'stream', and return a reference to 'stream'.
+};
+
+// FREE OPERATORS
+bool operator==(const Histogram& lhs, const Histogram& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' histograms have the same
+    // value, and 'false' otherwise.  Two histograms have the same value if
+    // they have the same 'count', 'total', 'min', and 'max', and the same
+    // count in each bucket.
+
+inline
+bool operator!=(const Histogram& lhs, const Histogram& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' histograms do not have
+    // the same value, and 'false' otherwise.  Two histograms do not have the
+    // same value if they differ in 'count', 'total', 'min', or 'max', or in
+    // the count of any bucket.
+
+inline
+bsl::ostream& operator<<(bsl::ostream& stream, const Histogram& histogram);
+    // Write a description of the specified 'histogram' to the specified
+    // 'stream', and return a reference to 'stream'.
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                              // ---------------
+                              // class Histogram
+                              // ---------------
+
+// CLASS METHODS
+inline
+int Histogram::bucketIndex(double value)
+{
+    // The bounds of the tracked range are '2^k_MIN_EXPONENT' and
+    // '2^k_MAX_EXPONENT', written as literals so that they are compile-time
+    // constants.
+
+    if (!(value >= 1.0 / 4294967296.0)) {
+        return 0;                                                     // RETURN
+    }
+    if (value >= 4294967296.0) {
+        return k_NUM_BUCKETS - 1;                                     // RETURN
+    }
+
+    bsls::Types::Uint64 bits;
+    bsl::memcpy(&bits, &value, sizeof bits);
+
+    const int exponent  = static_cast<int>((bits >> 52) & 0x7ff) - 1023;
+    const int subBucket = static_cast<int>(
+                                  (bits >> (52 - k_SUB_BUCKET_BITS))
+                                & (k_NUM_SUB_BUCKETS - 1));
+
+    return 1 + (exponent - k_MIN_EXPONENT) * k_NUM_SUB_BUCKETS + subBucket;
+}
+
+// MANIPULATORS
+inline
+void Histogram::add(double value)
+{
+    ++d_buckets[bucketIndex(value)];
+    ++d_count;
+    d_total += value;
+    if (value < d_min) {
+        d_min = value;
+    }
+    if (value > d_max) {
+        d_max = value;
+    }
+}
+
+inline
+void Histogram::addBucketCount(int index, bsls::Types::Uint64 count)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < k_NUM_BUCKETS);
+
+    d_buckets[index] += count;
+    d_count          += count;
+}
+
+inline
+void Histogram::accumulateTotalMinMax(double total, double min, double max)
+{
+    d_total += total;
+    if (min < d_min) {
+        d_min = min;
+    }
+    if (max > d_max) {
+        d_max = max;
+    }
+}
+
+// ACCESSORS
+inline
+bsls::Types::Uint64 Histogram::bucketCount(int index) const
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < k_NUM_BUCKETS);
+
+    return d_buckets[index];
+}
+
+inline
+bsls::Types::Uint64 Histogram::count() const
+{
+    return d_count;
+}
+
+inline
+double Histogram::total() const
+{
+    return d_total;
+}
+
+inline
+double Histogram::min() const
+{
+    return d_min;
+}
+
+inline
+double Histogram::max() const
+{
+    return d_max;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool balm::operator!=(const Histogram& lhs, const Histogram& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline
+bsl::ostream& balm::operator<<(bsl::ostream&    stream,
+                               const Histogram& histogram)
+{
+    return histogram.print(stream);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,855 @@
+// balm_histogram.t.cpp                                               -*-C++-*-
+#include <balm_histogram.h>
+
+#include <balm_metricrecord.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_sstream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'balm::Histogram' is a value-semantic type whose value is a set of bucket
+// counts together with a count, total, minimum, and maximum.  We first verify
+// the bucket layout (the class methods), then the primary manipulator 'add'
+// and the basic accessors, and then the quantile estimation against the exact
+// quantiles of a sorted sample.  Finally we verify the remaining manipulators
+// (in particular that 'merge' is equivalent to adding the merged values), and
+// the value-semantic operations.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int bucketIndex(double value);
+// [ 2] double bucketLowerBound(int index);
+// [ 2] double bucketUpperBound(int index);
+//
+// CREATORS
+// [ 3] Histogram();
+//
+// MANIPULATORS
+// [ 3] void add(double value);
+// [ 5] void addBucketCount(int index, bsls::Types::Uint64 count);
+// [ 5] void accumulateTotalMinMax(double total, double min, double max);
+// [ 5] void merge(const Histogram& other);
+// [ 3] void reset();
+//
+// ACCESSORS
+// [ 3] bsls::Types::Uint64 bucketCount(int index) const;
+// [ 3] bsls::Types::Uint64 count() const;
+// [ 3] double total() const;
+// [ 3] double min() const;
+// [ 3] double max() const;
+// [ 4] double quantile(double level) const;
+// [ 6] bsl::ostream& print(bsl::ostream& stream) const;
+//
+// FREE OPERATORS
+// [ 6] bool operator==(const Histogram& lhs, const Histogram& rhs);
+// [ 6] bool operator!=(const Histogram& lhs, const Histogram& rhs);
+// [ 6] bsl::ostream& operator<<(bsl::ostream&, const Histogram&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [-1] CONCERN: PERFORMANCE OF 'add'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::Histogram     Obj;
+typedef bsls::Types::Uint64 Uint64;
+
+const double k_MAX_RELATIVE_ERROR = 1.0 / (2 * Obj::k_NUM_SUB_BUCKETS);
+    // The maximum relative difference between a value in a (non-overflow and
+    // non-underflow) bucket and the midpoint of that bucket.
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+unsigned int nextRandom(unsigned int *seed)
+    // Return the next value of a simple (deterministic) pseudo-random sequence
+    // whose state is held in the specified 'seed'.
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return (*seed >> 8) & 0xffffff;
+}
+
+double exactQuantile(const bsl::vector<double>& sortedValues, double level)
+    // Return the 'ceil(level * sortedValues.size())'th smallest value in the
+    // specified 'sortedValues' (counting from 1, and clamped to the range of
+    // valid ranks) for the specified 'level'.
+{
+    const double count = static_cast<double>(sortedValues.size());
+    bsl::size_t  rank  = static_cast<bsl::size_t>(bsl::ceil(level * count));
+    rank = bsl::max<bsl::size_t>(rank, 1);
+    rank = bsl::min(rank, sortedValues.size());
+    return sortedValues[rank - 1];
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test        = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    const bool verbose     = argc > 2;
+    const bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Estimating Latency Quantiles
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we have measured the latencies, in milliseconds, of a series of
+// requests, and want to report the median and 99th percentile latencies.
+//
+// First, we create a histogram and record 1000 latencies, most of them
+// between 1 and 2 milliseconds, with a few slow outliers:
+//..
+    balm::Histogram latencies;
+    for (int i = 0; i < 1000; ++i) {
+        latencies.add(0 == i % 100 ? 50.0 + i / 100 : 1.0 + i / 1000.0);
+    }
+
+    ASSERT(1000 == latencies.count());
+    ASSERT(1.0  <  latencies.min() && latencies.min() < 1.01);
+    ASSERT(59.0 == latencies.max());
+//..
+// Then, we estimate the median, which is within 1.6% of the actual median of
+// approximately 1.5 milliseconds:
+//..
+    const double median = latencies.quantile(0.5);
+    ASSERT(1.47 < median && median < 1.53);
+//..
+// Next, we estimate the 99.9th percentile, which falls among the outliers:
+//..
+    const double p999 = latencies.quantile(0.999);
+    ASSERT(58.0 < p999 && p999 <= 59.0);
+//..
+// Finally, we combine the latencies with those measured by another process
+// (all of which are 10 milliseconds), and verify that the median of the
+// combined distribution has moved accordingly:
+//..
+    balm::Histogram other;
+    for (int i = 0; i < 3000; ++i) {
+        other.add(10.0);
+    }
+    latencies.merge(other);
+
+    ASSERT(4000 == latencies.count());
+    ASSERT(9.8 < latencies.quantile(0.5) && latencies.quantile(0.5) < 10.2);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // VALUE-SEMANTIC OPERATIONS
+        //
+        // Concerns:
+        //: 1 Two histograms compare equal if and only if their count, total,
+        //:   minimum, maximum, and all bucket counts are equal.
+        //:
+        //: 2 Copy construction and copy assignment produce an equal object.
+        //:
+        //: 3 'print' and 'operator<<' write the count, total, minimum,
+        //:   maximum, and the non-empty buckets.
+        //
+        // Plan:
+        //: 1 Compare histograms differing in a single bucket, or in a single
+        //:   aggregate.  (C-1)
+        //:
+        //: 2 Copy and assign histograms and compare the results.  (C-2)
+        //:
+        //: 3 Print a histogram and compare against the expected string.  (C-3)
+        //
+        // Testing:
+        //   bool operator==(const Histogram& lhs, const Histogram& rhs);
+        //   bool operator!=(const Histogram& lhs, const Histogram& rhs);
+        //   bsl::ostream& print(bsl::ostream& stream) const;
+        //   bsl::ostream& operator<<(bsl::ostream&, const Histogram&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "VALUE-SEMANTIC OPERATIONS" << endl
+                          << "=========================" << endl;
+
+        Obj mX; const Obj& X = mX;
+        Obj mY; const Obj& Y = mY;
+
+        ASSERT(X == Y);
+
+        mX.add(1.0);
+        ASSERT(X != Y);
+
+        mY.add(1.0);
+        ASSERT(X == Y);
+
+        // Same aggregates, different buckets.
+
+        mX.addBucketCount(Obj::bucketIndex(2.0), 1);
+        mY.addBucketCount(Obj::bucketIndex(3.0), 1);
+        ASSERT(X != Y);
+
+        mX.reset();
+        mY.reset();
+
+        // Same buckets, different aggregates.
+
+        mX.add(1.0);
+        mY.add(1.0);
+        mY.accumulateTotalMinMax(0.0, 0.5, 1.0);
+        ASSERT(X != Y);
+
+        mY.reset();
+        mY.add(1.0);
+
+        const Obj Z(X);
+        ASSERT(Z == X);
+
+        Obj mW; const Obj& W = mW;
+        mW.add(7.0);
+        ASSERT(W != X);
+        mW = X;
+        ASSERT(W == X);
+
+        if (veryVerbose) cout << "\tTesting 'print'." << endl;
+        {
+            mX.add(1.0);
+            mX.add(3.0);
+
+            bsl::ostringstream buf1, buf2;
+            X.print(buf1);
+            buf2 << X;
+
+            const char *EXPECTED =
+                          "[ 3 5 1 3 [1, 1.03125): 2 [3, 3.0625): 1 ]";
+            ASSERTV(buf1.str(), EXPECTED == buf1.str());
+            ASSERTV(buf2.str(), EXPECTED == buf2.str());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'addBucketCount', 'accumulateTotalMinMax', AND 'merge'
+        //
+        // Concerns:
+        //: 1 'addBucketCount' adds to the bucket and to 'count', and has no
+        //:   effect on 'total', 'min', and 'max'.
+        //:
+        //: 2 'accumulateTotalMinMax' adds to 'total', combines 'min' and
+        //:   'max', and has no effect on 'count' and the buckets.
+        //:
+        //: 3 Merging two histograms yields the same value as adding the values
+        //:   of both to a single histogram.
+        //:
+        //: 4 Merging an empty histogram has no effect.
+        //
+        // Plan:
+        //: 1 Apply 'addBucketCount' and 'accumulateTotalMinMax' and verify all
+        //:   the accessors.  (C-1..2)
+        //:
+        //: 2 Add a pseudo-random sequence of values to two histograms, and to
+        //:   a third histogram, then merge the first two and compare with the
+        //:   third.  (C-3)
+        //:
+        //: 3 Merge an empty histogram into a non-empty one.  (C-4)
+        //
+        // Testing:
+        //   void addBucketCount(int index, bsls::Types::Uint64 count);
+        //   void accumulateTotalMinMax(double total, double min, double max);
+        //   void merge(const Histogram& other);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                << "'addBucketCount', 'accumulateTotalMinMax', AND 'merge'"
+                << endl
+                << "======================================================"
+                << endl;
+
+        {
+            Obj mX; const Obj& X = mX;
+
+            mX.addBucketCount(10, 5);
+            mX.addBucketCount(10, 2);
+            mX.addBucketCount(Obj::k_NUM_BUCKETS - 1, 1);
+
+            ASSERT(8   == X.count());
+            ASSERT(7   == X.bucketCount(10));
+            ASSERT(1   == X.bucketCount(Obj::k_NUM_BUCKETS - 1));
+            ASSERT(0.0 == X.total());
+            ASSERT(balm::MetricRecord::k_DEFAULT_MIN == X.min());
+            ASSERT(balm::MetricRecord::k_DEFAULT_MAX == X.max());
+
+            mX.accumulateTotalMinMax(10.0, 2.0, 4.0);
+            mX.accumulateTotalMinMax( 5.0, 3.0, 6.0);
+
+            ASSERT(8    == X.count());
+            ASSERT(7    == X.bucketCount(10));
+            ASSERT(15.0 == X.total());
+            ASSERT(2.0  == X.min());
+            ASSERT(6.0  == X.max());
+        }
+
+        {
+            Obj mA; const Obj& A = mA;
+            Obj mB; const Obj& B = mB;
+            Obj mC; const Obj& C = mC;
+
+            unsigned int seed = 7;
+            for (int i = 0; i < 10000; ++i) {
+                // Integral values (so that the totals are computed exactly,
+                // regardless of the order of the additions).
+
+                const double value = nextRandom(&seed) % 100000;
+                if (i % 3) {
+                    mA.add(value);
+                }
+                else {
+                    mB.add(value);
+                }
+                mC.add(value);
+            }
+
+            ASSERT(A != C);
+            mA.merge(B);
+            ASSERTV(A.count(), C.count(), A == C);
+
+            const Obj EMPTY;
+            mA.merge(EMPTY);
+            ASSERT(A == C);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'quantile'
+        //
+        // Concerns:
+        //: 1 The quantile of an empty histogram is 0.0.
+        //:
+        //: 2 The estimated quantile of values in the tracked range is within
+        //:   1/64 (relative) of the exact quantile, for values spanning many
+        //:   orders of magnitude.
+        //:
+        //: 3 Level 0.0 returns (an estimate of) the minimum and level 1.0
+        //:   returns the maximum.
+        //:
+        //: 4 The result is clamped to '[min(), max()]'; in particular a
+        //:   histogram holding a single value reports that value exactly.
+        //:
+        //: 5 Quantiles falling in the underflow (or overflow) bucket are
+        //:   reported as the minimum (or maximum).
+        //
+        // Plan:
+        //: 1 Verify an empty histogram.  (C-1)
+        //:
+        //: 2 For several pseudo-random distributions, add values to a
+        //:   histogram and to a vector, sort the vector, and compare the
+        //:   estimated and exact quantiles for a range of levels.  (C-2..3)
+        //:
+        //: 3 Verify histograms holding a single value, and holding values
+        //:   outside the tracked range.  (C-4..5)
+        //
+        // Testing:
+        //   double quantile(double level) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'quantile'" << endl
+                          << "==========" << endl;
+
+        {
+            const Obj X;
+            ASSERT(0.0 == X.quantile(0.0));
+            ASSERT(0.0 == X.quantile(0.5));
+            ASSERT(0.0 == X.quantile(1.0));
+        }
+
+        const double LEVELS[] = {
+            0.0, 0.001, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999, 1.0
+        };
+        const int NUM_LEVELS = sizeof LEVELS / sizeof *LEVELS;
+
+        // The values are in '[SCALE, 1e6 * SCALE]', so each scale keeps the
+        // values within the tracked range.
+
+        const double SCALES[] = { 1e-9, 1e-6, 1e-3, 1.0, 1e3 };
+        const int    NUM_SCALES = sizeof SCALES / sizeof *SCALES;
+
+        for (int si = 0; si < NUM_SCALES; ++si) {
+            const double SCALE = SCALES[si];
+
+            Obj                 mX; const Obj& X = mX;
+            bsl::vector<double> values;
+
+            unsigned int seed = 12345 + si;
+            for (int i = 0; i < 20000; ++i) {
+                // A long-tailed distribution: the product of two uniform
+                // variables.
+
+                const double u1 = 1 + nextRandom(&seed) % 1000;
+                const double u2 = 1 + nextRandom(&seed) % 1000;
+                const double value = u1 * u2 * SCALE;
+
+                mX.add(value);
+                values.push_back(value);
+            }
+            bsl::sort(values.begin(), values.end());
+
+            ASSERTV(si, values.front() == X.min());
+            ASSERTV(si, values.back()  == X.max());
+
+            for (int li = 0; li < NUM_LEVELS; ++li) {
+                const double LEVEL    = LEVELS[li];
+                const double EXPECTED = exactQuantile(values, LEVEL);
+                const double ACTUAL   = X.quantile(LEVEL);
+
+                if (veryVerbose) {
+                    T_ P_(SCALE) P_(LEVEL) P_(EXPECTED) P(ACTUAL)
+                }
+
+                ASSERTV(SCALE, LEVEL, EXPECTED, ACTUAL,
+                        bsl::fabs(ACTUAL - EXPECTED)
+                                     <= EXPECTED * k_MAX_RELATIVE_ERROR);
+                ASSERTV(SCALE, LEVEL, ACTUAL,
+                        X.min() <= ACTUAL && ACTUAL <= X.max());
+            }
+            ASSERTV(si, X.min() == X.quantile(0.0));
+            ASSERTV(si, X.max() == X.quantile(1.0));
+        }
+
+        {
+            Obj mX; const Obj& X = mX;
+            mX.add(3.14159);
+            ASSERT(3.14159 == X.quantile(0.0));
+            ASSERT(3.14159 == X.quantile(0.5));
+            ASSERT(3.14159 == X.quantile(1.0));
+        }
+
+        {
+            Obj mX; const Obj& X = mX;
+            mX.add(-5.0);
+            mX.add(0.0);
+            mX.add(1.0);
+            mX.add(1e12);
+
+            ASSERT(-5.0 == X.quantile(0.25));
+            ASSERT(-5.0 == X.quantile(0.5));
+            ASSERT(1.0  <= X.quantile(0.75) && X.quantile(0.75) < 1.04);
+            ASSERT(1e12 == X.quantile(1.0));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // DEFAULT CONSTRUCTOR, 'add', 'reset', AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default constructed histogram is empty, with the default
+        //:   minimum and maximum of 'balm::MetricRecord'.
+        //:
+        //: 2 'add' increments the count of the bucket identified by
+        //:   'bucketIndex', and updates 'count', 'total', 'min', and 'max'.
+        //:
+        //: 3 'reset' restores the default state.
+        //
+        // Plan:
+        //: 1 Verify all the accessors of a default constructed object.  (C-1)
+        //:
+        //: 2 Add a sequence of values, verifying all the accessors after each
+        //:   addition.  (C-2)
+        //:
+        //: 3 Reset the histogram and verify it has the default value.  (C-3)
+        //
+        // Testing:
+        //   Histogram();
+        //   void add(double value);
+        //   void reset();
+        //   bsls::Types::Uint64 bucketCount(int index) const;
+        //   bsls::Types::Uint64 count() const;
+        //   double total() const;
+        //   double min() const;
+        //   double max() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                << "DEFAULT CONSTRUCTOR, 'add', 'reset', AND BASIC ACCESSORS"
+                << endl
+                << "========================================================"
+                << endl;
+
+        Obj mX; const Obj& X = mX;
+
+        ASSERT(0   == X.count());
+        ASSERT(0.0 == X.total());
+        ASSERT(balm::MetricRecord::k_DEFAULT_MIN == X.min());
+        ASSERT(balm::MetricRecord::k_DEFAULT_MAX == X.max());
+        for (int i = 0; i < Obj::k_NUM_BUCKETS; ++i) {
+            ASSERTV(i, 0 == X.bucketCount(i));
+        }
+
+        const struct {
+            int    d_line;
+            double d_value;
+            double d_expTotal;
+            double d_expMin;
+            double d_expMax;
+        } DATA[] = {
+            //LINE  VALUE     TOTAL      MIN     MAX
+            //----  -----     -----      ---     ---
+            { L_,     5.0,      5.0,     5.0,    5.0 },
+            { L_,     5.0,     10.0,     5.0,    5.0 },
+            { L_,     2.0,     12.0,     2.0,    5.0 },
+            { L_,    10.0,     22.0,     2.0,   10.0 },
+            { L_,     0.0,     22.0,     0.0,   10.0 },
+            { L_,    -3.0,     19.0,    -3.0,   10.0 },
+            { L_,     1e10,  1e10 + 19, -3.0,   1e10 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int    LINE  = DATA[ti].d_line;
+            const double VALUE = DATA[ti].d_value;
+            const int    INDEX = Obj::bucketIndex(VALUE);
+
+            const Uint64 bucketBefore = X.bucketCount(INDEX);
+
+            mX.add(VALUE);
+
+            ASSERTV(LINE, static_cast<Uint64>(ti + 1) == X.count());
+            ASSERTV(LINE, bucketBefore + 1 == X.bucketCount(INDEX));
+            ASSERTV(LINE, DATA[ti].d_expTotal == X.total());
+            ASSERTV(LINE, DATA[ti].d_expMin   == X.min());
+            ASSERTV(LINE, DATA[ti].d_expMax   == X.max());
+        }
+
+        ASSERT(2 == X.bucketCount(Obj::bucketIndex(5.0)));
+        ASSERT(2 == X.bucketCount(0));
+        ASSERT(1 == X.bucketCount(Obj::k_NUM_BUCKETS - 1));
+
+        mX.reset();
+
+        ASSERT(Obj() == X);
+        ASSERT(0     == X.count());
+        ASSERT(0.0   == X.total());
+        ASSERT(balm::MetricRecord::k_DEFAULT_MIN == X.min());
+        ASSERT(balm::MetricRecord::k_DEFAULT_MAX == X.max());
+        for (int i = 0; i < Obj::k_NUM_BUCKETS; ++i) {
+            ASSERTV(i, 0 == X.bucketCount(i));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // BUCKET LAYOUT
+        //
+        // Concerns:
+        //: 1 Every value is counted in a bucket whose bounds contain it.
+        //:
+        //: 2 Bucket bounds are contiguous and strictly increasing, and each
+        //:   (tracked) bucket spans 1/32 of its power-of-two interval.
+        //:
+        //: 3 Values below '2^k_MIN_EXPONENT' (including 0, negative values,
+        //:   and negative infinity) are counted in the underflow bucket, and
+        //:   values at or above '2^k_MAX_EXPONENT' (including positive
+        //:   infinity) in the overflow bucket.
+        //:
+        //: 4 The lower bound of each bucket is counted in that bucket.
+        //
+        // Plan:
+        //: 1 Iterate over all buckets verifying the bounds.  (C-2, C-4)
+        //:
+        //: 2 Verify 'bucketIndex' for a table of values, including boundary
+        //:   values, and for a pseudo-random sequence of values.  (C-1, C-3)
+        //
+        // Testing:
+        //   int bucketIndex(double value);
+        //   double bucketLowerBound(int index);
+        //   double bucketUpperBound(int index);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BUCKET LAYOUT" << endl
+                          << "=============" << endl;
+
+        const double INF    = bsl::numeric_limits<double>::infinity();
+        const double LOWEST = bsl::ldexp(1.0, Obj::k_MIN_EXPONENT);
+        const double HIGHEST = bsl::ldexp(1.0, Obj::k_MAX_EXPONENT);
+        const int    LAST   = Obj::k_NUM_BUCKETS - 1;
+
+        ASSERT(-INF    == Obj::bucketLowerBound(0));
+        ASSERT(LOWEST  == Obj::bucketUpperBound(0));
+        ASSERT(HIGHEST == Obj::bucketLowerBound(LAST));
+        ASSERT(INF     == Obj::bucketUpperBound(LAST));
+
+        for (int i = 1; i < LAST; ++i) {
+            const double LOWER = Obj::bucketLowerBound(i);
+            const double UPPER = Obj::bucketUpperBound(i);
+
+            ASSERTV(i, LOWER < UPPER);
+            ASSERTV(i, UPPER == Obj::bucketLowerBound(i + 1));
+            ASSERTV(i, i == Obj::bucketIndex(LOWER));
+
+            // The width of the bucket is 1/32 of the power of two at or below
+            // 'LOWER'.
+
+            int exponent;
+            bsl::frexp(LOWER, &exponent);
+            const int SHIFT = exponent - 1 - Obj::k_SUB_BUCKET_BITS;
+            ASSERTV(i, UPPER - LOWER == bsl::ldexp(1.0, SHIFT));
+        }
+
+        const struct {
+            int    d_line;
+            double d_value;
+            int    d_expIndex;
+        } DATA[] = {
+            //LINE  VALUE                 INDEX
+            //----  -----                 -----
+            { L_,   -INF,                 0                               },
+            { L_,   -1.0,                 0                               },
+            { L_,    0.0,                 0                               },
+            { L_,    LOWEST * 0.999,      0                               },
+            { L_,    LOWEST,              1                               },
+            { L_,    1.0,                 1 + 32 * Obj::k_NUM_SUB_BUCKETS },
+            { L_,    1.5,                 1 + 32 * Obj::k_NUM_SUB_BUCKETS
+                                            + Obj::k_NUM_SUB_BUCKETS / 2  },
+            { L_,    2.0,                 1 + 33 * Obj::k_NUM_SUB_BUCKETS },
+            { L_,    HIGHEST * 0.9999999, LAST - 1                        },
+            { L_,    HIGHEST,             LAST                            },
+            { L_,    INF,                 LAST                            },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int    LINE  = DATA[ti].d_line;
+            const double VALUE = DATA[ti].d_value;
+            const int    EXP   = DATA[ti].d_expIndex;
+
+            if (veryVerbose) { T_ P_(LINE) P_(VALUE) P(EXP) }
+
+            ASSERTV(LINE, EXP, Obj::bucketIndex(VALUE),
+                    EXP == Obj::bucketIndex(VALUE));
+        }
+
+        unsigned int seed = 1;
+        for (int i = 0; i < 100000; ++i) {
+            const double mantissa = 1.0 + nextRandom(&seed) / 16777216.0;
+            const int    exponent = static_cast<int>(nextRandom(&seed) % 80)
+                                                                         - 40;
+            const double VALUE    = bsl::ldexp(mantissa, exponent);
+            const int    INDEX    = Obj::bucketIndex(VALUE);
+
+            ASSERTV(VALUE, 0 <= INDEX && INDEX <= LAST);
+            ASSERTV(VALUE, INDEX, Obj::bucketLowerBound(INDEX) <= VALUE);
+            ASSERTV(VALUE, INDEX, VALUE <  Obj::bucketUpperBound(INDEX));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Add a few values, and verify the aggregates and a quantile.
+        //:   Merge and reset histograms.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX; const Obj& X = mX;
+
+        for (int i = 1; i <= 100; ++i) {
+            mX.add(i);
+        }
+
+        ASSERT(100    == X.count());
+        ASSERT(5050.0 == X.total());
+        ASSERT(1.0    == X.min());
+        ASSERT(100.0  == X.max());
+
+        const double P50 = X.quantile(0.5);
+        ASSERTV(P50, 49.0 < P50 && P50 < 51.0);
+
+        Obj mY(X); const Obj& Y = mY;
+        ASSERT(Y == X);
+
+        mY.merge(X);
+        ASSERT(200 == Y.count());
+        ASSERT(Y   != X);
+
+        mY.reset();
+        ASSERT(0   == Y.count());
+        ASSERT(Obj() == Y);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // CONCERN: PERFORMANCE OF 'add'
+        //
+        // Concerns:
+        //: 1 Recording a value does not depend on the magnitude of the value
+        //:   and costs a small number of nanoseconds.
+        //
+        // Plan:
+        //: 1 Time a large number (10000000, or as specified by 'argv[2]') of
+        //:   'add' calls for values spread over the tracked range, and report
+        //:   the average time per call.
+        //
+        // Testing:
+        //   CONCERN: PERFORMANCE OF 'add'
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "CONCERN: PERFORMANCE OF 'add'" << endl
+             << "=============================" << endl;
+
+        const int numValues = argc > 2 && bsl::atoi(argv[2]) > 0
+                            ? bsl::atoi(argv[2])
+                            : 10000000;
+
+        bsl::vector<double> values;
+        unsigned int        seed = 3;
+        for (int i = 0; i < 4096; ++i) {
+            values.push_back(bsl::ldexp(1.0 + nextRandom(&seed) / 16777216.0,
+                                        nextRandom(&seed) % 64 - 32));
+        }
+
+        Obj mX; const Obj& X = mX;
+
+        bsls::Stopwatch timer;
+        timer.start();
+        for (int i = 0; i < numValues; ++i) {
+            mX.add(values[i & 4095]);
+        }
+        timer.stop();
+
+        ASSERT(static_cast<Uint64>(numValues) == X.count());
+
+        cout << "ns per 'add': "
+             << timer.elapsedTime() * 1e9 / numValues << endl
+             << "p50 = " << X.quantile(0.5)
+             << ", p99 = " << X.quantile(0.99) << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
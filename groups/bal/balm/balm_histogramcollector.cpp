@@ -0,0 +1,177 @@
+// balm_histogramcollector.cpp                                        -*-C++-*-
+#include <balm_histogramcollector.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_histogramcollector_cpp,"$Id$ $CSID$")
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                         // -------------------------------
+                         // struct HistogramCollector::Shard
+                         // -------------------------------
+
+// CREATORS
+HistogramCollector::Shard::Shard()
+: d_lock(bsls::SpinLock::s_unlocked)
+, d_total(0.0)
+, d_min(MetricRecord::k_DEFAULT_MIN)
+, d_max(MetricRecord::k_DEFAULT_MAX)
+{
+}
+
+// MANIPULATORS
+void HistogramCollector::Shard::reset()
+{
+    d_total = 0.0;
+    d_min   = MetricRecord::k_DEFAULT_MIN;
+    d_max   = MetricRecord::k_DEFAULT_MAX;
+}
+
+                         // ------------------------
+                         // class HistogramCollector
+                         // ------------------------
+
+// PRIVATE CLASS METHODS
+void HistogramCollector::loadRecord(MetricRecord     *record,
+                                    const MetricId&   metricId,
+                                    const Histogram&  histogram)
+{
+    // 'MetricRecord::count' is an 'int'; saturate rather than wrap.
+
+    const bsls::Types::Uint64 count = histogram.count();
+
+    record->metricId() = metricId;
+    record->count()    = count > INT_MAX ? INT_MAX : static_cast<int>(count);
+    record->total()    = histogram.total();
+    record->min()      = histogram.min();
+    record->max()      = histogram.max();
+
+    record->clearQuantiles();
+    if (0 != count) {
+        for (int i = 0; i < MetricRecord::k_NUM_QUANTILES; ++i) {
+            const MetricRecord::Quantile quantile =
+                                       static_cast<MetricRecord::Quantile>(i);
+            record->setQuantile(
+                   quantile,
+                   histogram.quantile(MetricRecord::quantileLevel(quantile)));
+        }
+    }
+}
+
+// PRIVATE ACCESSORS
+void HistogramCollector::lockAll() const
+{
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        d_shards[i].d_lock.lock();
+    }
+}
+
+void HistogramCollector::unlockAll() const
+{
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        d_shards[i].d_lock.unlock();
+    }
+}
+
+void HistogramCollector::loadShards(Histogram *histogram, bool reset) const
+{
+    histogram->reset();
+
+    double total = 0.0;
+    double min   = MetricRecord::k_DEFAULT_MIN;
+    double max   = MetricRecord::k_DEFAULT_MAX;
+
+    // Holding every shard lock excludes all concurrent updates (which
+    // increment the bucket counters while holding the lock of their shard),
+    // so that the bucket counts and the total, minimum, and maximum are
+    // consistent.
+
+    lockAll();
+    for (int i = 0; i < Histogram::k_NUM_BUCKETS; ++i) {
+        const bsls::Types::Uint64 count = d_buckets[i].loadRelaxed();
+        if (0 != count) {
+            histogram->addBucketCount(i, count);
+            if (reset) {
+                d_buckets[i].storeRelaxed(0);
+            }
+        }
+    }
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        Shard& shard = d_shards[i];
+
+        total += shard.d_total;
+        min   =  bsl::min(min, shard.d_min);
+        max   =  bsl::max(max, shard.d_max);
+        if (reset) {
+            shard.reset();
+        }
+    }
+    unlockAll();
+
+    histogram->accumulateTotalMinMax(total, min, max);
+}
+
+// CREATORS
+HistogramCollector::HistogramCollector(const MetricId& metricId)
+: d_metricId(metricId)
+{
+}
+
+HistogramCollector::~HistogramCollector()
+{
+}
+
+// MANIPULATORS
+void HistogramCollector::reset()
+{
+    Histogram discarded;
+    loadShards(&discarded, true);
+}
+
+void HistogramCollector::loadAndReset(MetricRecord *record)
+{
+    Histogram histogram;
+    loadShards(&histogram, true);
+    loadRecord(record, d_metricId, histogram);
+}
+
+void HistogramCollector::loadAndResetHistogram(Histogram *histogram)
+{
+    loadShards(histogram, true);
+}
+
+// ACCESSORS
+void HistogramCollector::load(MetricRecord *record) const
+{
+    Histogram histogram;
+    loadShards(&histogram, false);
+    loadRecord(record, d_metricId, histogram);
+}
+
+void HistogramCollector::loadHistogram(Histogram *histogram) const
+{
+    loadShards(histogram, false);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,325 @@
+// balm_histogramcollector.h                                          -*-C++-*-
+#ifndef INCLUDED_BALM_HISTOGRAMCOLLECTOR
+#define INCLUDED_BALM_HISTOGRAMCOLLECTOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a striped collector of the distribution of metric values.
+//
+//@CLASSES:
+//   balm::HistogramCollector: striped collector of a metric's distribution
+//
+//@SEE_ALSO: balm_histogram, balm_collector, balm_collectorrepository,
+//           balm_metrics
+//
+//@DESCRIPTION: This component provides a class, 'balm::HistogramCollector',
+// that collects the values of a metric in a fixed-size log-linear histogram
+// (see 'balm_histogram'), so that, in addition to the count, total, minimum,
+// and maximum maintained by a 'balm::Collector', the quantiles of the
+// recorded values (e.g., the 99th percentile of a latency) can be published.
+// The 'load' and 'loadAndReset' operations populate a 'balm::MetricRecord'
+// with the aggregated values and with the quantiles identified by
+// 'balm::MetricRecord::Quantile' (see 'balm_metricrecord'); the
+// 'loadHistogram' and 'loadAndResetHistogram' operations provide the full
+// distribution.
+//
+// Histogram collectors are normally obtained from a
+// 'balm::CollectorRepository' (see 'getDefaultHistogramCollector'), which
+// includes their records in those published by a 'balm::MetricsManager', and
+// updated using the 'BALM_METRICS_HISTOGRAM_UPDATE' macros (see
+// 'balm_metrics').
+//
+///Thread Safety
+///-------------
+// 'balm::HistogramCollector' is fully *thread-safe*, meaning that all
+// non-creator operations on a given instance can be safely invoked
+// simultaneously from multiple threads.
+//
+///Performance
+///-----------
+// As with 'balm::Collector' (see 'balm_collector'), the total, minimum, and
+// maximum are spread over a fixed number of shards, each guarded by its own
+// spin lock and padded to the size of a cache line, and each thread updates
+// the shard selected by a hash of its thread id.  'update' holds the lock of
+// that shard while it increments the counter of the bucket holding the value
+// and updates the total, minimum, and maximum, so threads updating the same
+// collector contend only when they map to the same shard.  The bucket is
+// computed from the binary representation of the value, without a search or a
+// floating-point logarithm.
+//
+// The collector holds one atomic counter per bucket (about 16KB), shared by
+// all shards.  'load' and 'loadAndReset' acquire the locks of all shards, then
+// copy (or, respectively, exchange with 0) each counter into a
+// 'balm::Histogram' on the stack, from which the quantiles are computed, so
+// publishing a histogram collector does not allocate memory.  Since they hold
+// every shard lock, each concurrent update is reflected entirely (in its
+// bucket count and in the total, minimum, and maximum) either in a loaded
+// histogram or in the next one, never split between the two.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Collecting Request Latencies
+///- - - - - - - - - - - - - - - - - - - -
+// We start by creating a 'balm::MetricId' object by hand, but in practice, an
+// id should be obtained from a 'balm::MetricRegistry' object (such as the one
+// owned by a 'balm::MetricsManager'):
+//..
+//  balm::Category           myCategory("MyCategory");
+//  balm::MetricDescription  description(&myCategory, "RequestLatency");
+//  balm::MetricId           latencyId(&description);
+//..
+// Now we create a 'balm::HistogramCollector' for 'latencyId', and record the
+// latencies, in microseconds, of 100 requests; one request in 20 is slow:
+//..
+//  balm::HistogramCollector collector(latencyId);
+//
+//  for (int i = 0; i < 100; ++i) {
+//      collector.update(0 == i % 20 ? 5000.0 : 100.0 + i);
+//  }
+//..
+// Finally, we load the collected values into a 'balm::MetricRecord'.  In
+// addition to the count, total, minimum, and maximum, the record holds the
+// quantiles of the latencies.  Note that the estimated quantiles are within
+// 1.6% of the exact ones:
+//..
+//  balm::MetricRecord record;
+//  collector.loadAndReset(&record);
+//
+//  assert(latencyId == record.metricId());
+//  assert(100       == record.count());
+//  assert(101.0     == record.min());
+//  assert(5000.0    == record.max());
+//  assert(true      == record.hasQuantiles());
+//
+//  const double p50 = record.quantile(balm::MetricRecord::e_P50);
+//  const double p99 = record.quantile(balm::MetricRecord::e_P99);
+//
+//  assert(145.0 < p50 && p50 < 155.0);
+//  assert(5000.0 == p99);
+//..
+
+#include <balscm_version.h>
+
+#include <balm_histogram.h>
+#include <balm_metricid.h>
+#include <balm_metricrecord.h>
+
+#include <bslmt_platform.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_spinlock.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+
+
+namespace BloombergLP {
+namespace balm {
+
+                         // ========================
+                         // class HistogramCollector
+                         // ========================
+
+class HistogramCollector {
+    // This class provides a mechanism for collecting the distribution of the
+    // values of a metric, in addition to their count, total, minimum, and
+    // maximum.  Values are counted in atomic counters following the bucket
+    // layout of 'Histogram', and their total, minimum, and maximum are spread
+    // over a fixed number of shards (see {Performance}).
+
+    // PRIVATE TYPES
+    enum {
+        k_SHARD_BITS = 3,                 // log2 of the number of shards
+
+        k_NUM_SHARDS = 1 << k_SHARD_BITS  // number of shards
+    };
+
+    struct Shard {
+        // This 'struct' holds the total, minimum, and maximum accumulated in
+        // one shard, and the lock guarding them and the updates of the bucket
+        // counters by the threads using this shard.
+
+        // DATA
+        bsls::SpinLock d_lock;   // guards the other members of this shard
+        double         d_total;  // total of values across events
+        double         d_min;    // minimum value across events
+        double         d_max;    // maximum value across events
+
+        // CREATORS
+        Shard();
+            // Create a shard having a total of 0.0, a minimum of
+            // 'MetricRecord::k_DEFAULT_MIN', and a maximum of
+            // 'MetricRecord::k_DEFAULT_MAX'.
+
+        // MANIPULATORS
+        void reset();
+            // Reset the total, minimum, and maximum of this shard to their
+            // default values.  The behavior is undefined unless 'd_lock' is
+            // held by the calling thread.
+    };
+
+    struct PaddedShard : Shard {
+        // This 'struct' pads a shard to the size of a cache line, so that the
+        // data of two shards are never less than a cache line apart.  Note
+        // that a shard is deliberately not over-aligned: a collector is
+        // created by an allocator that guarantees only the maximal
+        // fundamental alignment.
+
+        // DATA
+        char d_pad[bslmt::Platform::e_CACHE_LINE_SIZE - sizeof(Shard)];
+                                       // padding to the size of a cache line
+    };
+
+    // DATA
+    MetricId            d_metricId;              // metric identifier
+
+    mutable bsls::AtomicUint64
+                        d_buckets[Histogram::k_NUM_BUCKETS];
+                                                 // count of values per bucket
+
+    mutable PaddedShard d_shards[k_NUM_SHARDS];  // accumulated total, min,
+                                                 // and max
+
+    // NOT IMPLEMENTED
+    HistogramCollector(const HistogramCollector&);
+    HistogramCollector& operator=(const HistogramCollector&);
+
+    // PRIVATE CLASS METHODS
+    static int shardIndex();
+        // Return the index of the shard updated by the calling thread.
+
+    static void loadRecord(MetricRecord     *record,
+                           const MetricId&   metricId,
+                           const Histogram&  histogram);
+        // Load into the specified 'record' the specified 'metricId', and the
+        // count, total, minimum, maximum, and (if 'histogram' is not empty)
+        // quantiles of the specified 'histogram'.
+
+    // PRIVATE ACCESSORS
+    void lockAll() const;
+        // Acquire the locks of all shards of this collector, in order.
+
+    void unlockAll() const;
+        // Release the locks of all shards of this collector.
+
+    void loadShards(Histogram *histogram, bool reset) const;
+        // Load into the specified 'histogram' the values recorded in this
+        // collector, and if the specified 'reset' is 'true', remove those
+        // values from this collector, all in a single atomic operation.
+
+  public:
+    // CREATORS
+    explicit HistogramCollector(const MetricId& metricId);
+        // Create a histogram collector for the specified 'metricId', having
+        // no recorded values (i.e., a 'count' of 0, a 'total' of 0.0, a 'min'
+        // of 'MetricRecord::k_DEFAULT_MIN', and a 'max' of
+        // 'MetricRecord::k_DEFAULT_MAX').
+
+    ~HistogramCollector();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void update(double value);
+        // Record the specified 'value' in this collector.  This operation
+        // acquires only the lock of the shard used by the calling thread.
+        // The behavior is undefined if 'value' is NaN.
+
+    void reset();
+        // Remove all the values recorded in this collector.
+
+    void loadAndReset(MetricRecord *record);
+        // Load into the specified 'record' the metric id, count, total,
+        // minimum, and maximum of the values recorded in this collector and,
+        // if at least one value was recorded, their quantiles (otherwise
+        // 'record' has no quantiles); then remove those values from this
+        // collector.  This operation does not allocate memory.
+
+    void loadAndResetHistogram(Histogram *histogram);
+        // Load into the specified 'histogram' the values recorded in this
+        // collector, then remove those values from this collector, in a
+        // single atomic operation.
+
+    // ACCESSORS
+    void load(MetricRecord *record) const;
+        // Load into the specified 'record' the metric id, count, total,
+        // minimum, and maximum of the values recorded in this collector and,
+        // if at least one value was recorded, their quantiles (otherwise
+        // 'record' has no quantiles).  This operation does not allocate
+        // memory.
+
+    void loadHistogram(Histogram *histogram) const;
+        // Load into the specified 'histogram' the values recorded in this
+        // collector.
+
+    const MetricId& metricId() const;
+        // Return a reference to the non-modifiable metric identifier for this
+        // collector.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                         // ------------------------
+                         // class HistogramCollector
+                         // ------------------------
+
+// PRIVATE CLASS METHODS
+inline
+int HistogramCollector::shardIndex()
+{
+    // Spread the (often aligned) thread identifiers over the shards using the
+    // high-order bits of a multiplicative hash.
+
+    const bsls::Types::Uint64 k_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+
+    return static_cast<int>((bslmt::ThreadUtil::selfIdAsUint64()
+                                                              * k_MULTIPLIER)
+                            >> (64 - k_SHARD_BITS));
+}
+
+// MANIPULATORS
+inline
+void HistogramCollector::update(double value)
+{
+    Shard&              shard = d_shards[shardIndex()];
+    bsls::SpinLockGuard guard(&shard.d_lock);
+
+    d_buckets[Histogram::bucketIndex(value)].addRelaxed(1);
+
+    shard.d_total += value;
+    shard.d_min   =  bsl::min(shard.d_min, value);
+    shard.d_max   =  bsl::max(shard.d_max, value);
+}
+
+// ACCESSORS
+inline
+const MetricId& HistogramCollector::metricId() const
+{
+    return d_metricId;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
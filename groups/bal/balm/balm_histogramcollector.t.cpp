@@ -0,0 +1,731 @@
+// balm_histogramcollector.t.cpp                                      -*-C++-*-
+#include <balm_histogramcollector.h>
+
+#include <balm_category.h>
+#include <balm_collector.h>
+#include <balm_histogram.h>
+#include <balm_metricdescription.h>
+#include <balm_metricid.h>
+#include <balm_metricrecord.h>
+
+#include <bdlf_bind.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'balm::HistogramCollector' is a mechanism recording values in atomic
+// counters laid out as the buckets of a 'balm::Histogram'.  We verify that
+// the values recorded with 'update' are loaded exactly as a 'balm::Histogram'
+// to which the same values were added, that the records loaded from the
+// collector carry the quantiles of that histogram, and that the reset
+// operations remove the loaded values.  Finally we verify that no update is
+// lost, or counted twice, when updates and 'loadAndReset' are invoked
+// concurrently.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit HistogramCollector(const MetricId& metricId);
+// [ 2] ~HistogramCollector();
+//
+// MANIPULATORS
+// [ 2] void update(double value);
+// [ 3] void reset();
+// [ 3] void loadAndReset(MetricRecord *record);
+// [ 3] void loadAndResetHistogram(Histogram *histogram);
+//
+// ACCESSORS
+// [ 2] void load(MetricRecord *record) const;
+// [ 2] void loadHistogram(Histogram *histogram) const;
+// [ 2] const MetricId& metricId() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCURRENCY TEST
+// [ 5] USAGE EXAMPLE
+// [-1] CONCERN: PERFORMANCE OF CONCURRENT UPDATES
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::HistogramCollector Obj;
+typedef balm::Histogram          Histogram;
+typedef balm::MetricRecord       Rec;
+typedef balm::MetricId           Id;
+typedef balm::MetricDescription  Desc;
+typedef bsls::Types::Uint64      Uint64;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void verifyRecord(int              line,
+                  const Rec&       record,
+                  const Id&        metricId,
+                  const Histogram& histogram)
+    // Verify that the specified 'record' has the specified 'metricId' and
+    // the aggregates and quantiles of the specified 'histogram', reporting
+    // failures using the specified 'line'.
+{
+    ASSERTV(line, metricId == record.metricId());
+    ASSERTV(line, static_cast<int>(histogram.count()) == record.count());
+    ASSERTV(line, histogram.total() == record.total());
+    ASSERTV(line, histogram.min()   == record.min());
+    ASSERTV(line, histogram.max()   == record.max());
+    ASSERTV(line, (0 != histogram.count()) == record.hasQuantiles());
+
+    if (record.hasQuantiles()) {
+        for (int i = 0; i < Rec::k_NUM_QUANTILES; ++i) {
+            const Rec::Quantile QUANTILE = static_cast<Rec::Quantile>(i);
+            ASSERTV(line, i,
+                    histogram.quantile(Rec::quantileLevel(QUANTILE))
+                                                == record.quantile(QUANTILE));
+        }
+    }
+}
+
+                           // ======================
+                           // struct ConcurrencyTest
+                           // ======================
+
+struct ConcurrencyTest {
+    // This 'struct' holds the state shared by the threads of the concurrency
+    // test (case 4).
+
+    // DATA
+    Obj                *d_collector_p;   // collector under test
+    bslmt::Barrier     *d_barrier_p;     // start barrier
+    bsls::AtomicInt     d_numRunning;    // number of updating threads running
+    bsls::AtomicUint64  d_numCollected;  // number of values collected
+    double              d_totalCollected;
+                                         // total of values collected (only
+                                         // modified by the collecting thread)
+    double              d_value;         // value to update with, or 0 to
+                                         // update with '1 .. numUpdates'
+    bsls::AtomicInt     d_numInconsistent;
+                                         // number of collected histograms
+                                         // whose total is not 'd_value' times
+                                         // their count
+};
+
+void updateThread(ConcurrencyTest *state, int numUpdates)
+    // Update the collector of the specified 'state' the specified
+    // 'numUpdates' times, with the values 1 to 'numUpdates' if the value of
+    // 'state' is 0, and with that value otherwise, after waiting on the
+    // barrier of 'state'.
+{
+    state->d_barrier_p->wait();
+    for (int i = 1; i <= numUpdates; ++i) {
+        state->d_collector_p->update(0 == state->d_value ? i
+                                                         : state->d_value);
+    }
+    --state->d_numRunning;
+}
+
+void collectThread(ConcurrencyTest *state)
+    // Repeatedly collect (and reset) the collector of the specified 'state',
+    // accumulating the count and total of the collected values in 'state',
+    // and, if the value of 'state' is not 0, counting the collected
+    // histograms whose total is not that value times their count, until all
+    // the updating threads are done, after waiting on the barrier of 'state'.
+{
+    state->d_barrier_p->wait();
+
+    bool done = false;
+    while (!done) {
+        done = 0 == state->d_numRunning;
+
+        Histogram histogram;
+        state->d_collector_p->loadAndResetHistogram(&histogram);
+
+        state->d_numCollected   += histogram.count();
+        state->d_totalCollected += histogram.total();
+
+        if (0 != state->d_value
+         && histogram.total() !=
+                    state->d_value * static_cast<double>(histogram.count())) {
+            ++state->d_numInconsistent;
+        }
+    }
+}
+
+void benchmarkThread(Obj            *histogramCollector,
+                     balm::Collector *collector,
+                     int              numUpdates,
+                     bslmt::Barrier  *barrier)
+    // Wait on the specified 'barrier', then update whichever of the specified
+    // 'histogramCollector' and 'collector' is not 0 the specified
+    // 'numUpdates' times.
+{
+    barrier->wait();
+    if (histogramCollector) {
+        for (int i = 0; i < numUpdates; ++i) {
+            histogramCollector->update(i & 1023);
+        }
+    }
+    else {
+        for (int i = 0; i < numUpdates; ++i) {
+            collector->update(i & 1023);
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test        = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    const bool verbose     = argc > 2;
+    const bool veryVerbose = argc > 3;
+    const bool veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    balm::Category cA("A", true);
+    Desc           mA(&cA, "A");
+    Desc           mB(&cA, "B");
+
+    const Id METRIC_A(&mA);
+    const Id METRIC_B(&mB);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Collecting Request Latencies
+///- - - - - - - - - - - - - - - - - - - -
+// We start by creating a 'balm::MetricId' object by hand, but in practice, an
+// id should be obtained from a 'balm::MetricRegistry' object (such as the one
+// owned by a 'balm::MetricsManager'):
+//..
+    balm::Category           myCategory("MyCategory");
+    balm::MetricDescription  description(&myCategory, "RequestLatency");
+    balm::MetricId           latencyId(&description);
+//..
+// Now we create a 'balm::HistogramCollector' for 'latencyId', and record the
+// latencies, in microseconds, of 100 requests; one request in 20 is slow:
+//..
+    balm::HistogramCollector collector(latencyId);
+
+    for (int i = 0; i < 100; ++i) {
+        collector.update(0 == i % 20 ? 5000.0 : 100.0 + i);
+    }
+//..
+// Finally, we load the collected values into a 'balm::MetricRecord'.  In
+// addition to the count, total, minimum, and maximum, the record holds the
+// quantiles of the latencies.  Note that the estimated quantiles are within
+// 1.6% of the exact ones:
+//..
+    balm::MetricRecord record;
+    collector.loadAndReset(&record);
+
+    ASSERT(latencyId == record.metricId());
+    ASSERT(100       == record.count());
+    ASSERT(101.0     == record.min());
+    ASSERT(5000.0    == record.max());
+    ASSERT(true      == record.hasQuantiles());
+
+    const double p50 = record.quantile(balm::MetricRecord::e_P50);
+    const double p99 = record.quantile(balm::MetricRecord::e_P99);
+
+    ASSERT(145.0 < p50 && p50 < 155.0);
+    ASSERT(5000.0 == p99);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Concurrent updates from multiple threads are all recorded.
+        //:
+        //: 2 An update performed concurrently with 'loadAndResetHistogram' is
+        //:   collected exactly once.
+        //:
+        //: 3 An update performed concurrently with 'loadAndResetHistogram' is
+        //:   collected entirely in one histogram: its bucket count, total,
+        //:   minimum, and maximum are not split between two histograms.
+        //
+        // Plan:
+        //: 1 Update a collector from several threads with a known set of
+        //:   values, while another thread repeatedly calls
+        //:   'loadAndResetHistogram' and accumulates the collected count and
+        //:   total.  Once all threads are done, verify that the accumulated
+        //:   count and total (plus those remaining in the collector) are those
+        //:   of the updated values.  (C-1..2)
+        //:
+        //: 2 Repeat P-1 with every thread updating the same value, and verify
+        //:   that the total of every collected histogram is that value times
+        //:   its count.  (C-3)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST" << endl
+                          << "================" << endl;
+
+        const int NUM_THREADS = 6;
+        const int NUM_UPDATES = 20000;
+
+        const double VALUES[] = { 0, 2.0 };  // 0 means '1 .. NUM_UPDATES'
+        const int    NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+        for (int vi = 0; vi < NUM_VALUES; ++vi) {
+            const double VALUE = VALUES[vi];
+
+            if (veryVerbose) { T_ P(VALUE) }
+
+            Obj mX(METRIC_A);
+
+            bslmt::Barrier  barrier(NUM_THREADS + 1);
+            ConcurrencyTest state;
+            state.d_collector_p     = &mX;
+            state.d_barrier_p       = &barrier;
+            state.d_numRunning      = NUM_THREADS;
+            state.d_numCollected    = 0;
+            state.d_totalCollected  = 0;
+            state.d_value           = VALUE;
+            state.d_numInconsistent = 0;
+
+            bslmt::ThreadGroup threads;
+            threads.addThreads(bdlf::BindUtil::bind(&updateThread,
+                                                    &state,
+                                                    NUM_UPDATES),
+                               NUM_THREADS);
+            threads.addThread(bdlf::BindUtil::bind(&collectThread, &state));
+            threads.joinAll();
+
+            Histogram remaining;
+            mX.loadAndResetHistogram(&remaining);
+
+            const Uint64 EXP_COUNT = static_cast<Uint64>(NUM_THREADS)
+                                                                 * NUM_UPDATES;
+            const double EXP_TOTAL = 0 == VALUE
+                                   ? NUM_THREADS
+                                     * (static_cast<double>(NUM_UPDATES)
+                                                     * (NUM_UPDATES + 1) / 2)
+                                   : VALUE * static_cast<double>(EXP_COUNT);
+
+            ASSERTV(VALUE, state.d_numCollected, remaining.count(),
+                    EXP_COUNT == state.d_numCollected + remaining.count());
+            ASSERTV(VALUE, state.d_totalCollected, remaining.total(),
+                    EXP_TOTAL == state.d_totalCollected + remaining.total());
+            ASSERTV(VALUE, state.d_numInconsistent,
+                    0 == state.d_numInconsistent);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'reset', 'loadAndReset', AND 'loadAndResetHistogram'
+        //
+        // Concerns:
+        //: 1 'loadAndReset' and 'loadAndResetHistogram' load the same values
+        //:   as 'load' and 'loadHistogram', respectively, and then leave the
+        //:   collector in its default (empty) state.
+        //:
+        //: 2 'reset' leaves the collector in its default state.
+        //:
+        //: 3 Values recorded after a reset are loaded, and values recorded
+        //:   before are not.
+        //:
+        //: 4 Loading a record (with or without reset) does not allocate
+        //:   memory.
+        //
+        // Plan:
+        //: 1 Record values, load and reset using each of the operations, and
+        //:   verify the loaded values and the subsequent state.  (C-1..3)
+        //:
+        //: 2 Verify that the default allocator is not used.  (C-4)
+        //
+        // Testing:
+        //   void reset();
+        //   void loadAndReset(MetricRecord *record);
+        //   void loadAndResetHistogram(Histogram *histogram);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "'reset', 'loadAndReset', AND 'loadAndResetHistogram'"
+                 << endl
+                 << "===================================================="
+                 << endl;
+
+        Obj mX(METRIC_A); const Obj& X = mX;
+
+        const Histogram EMPTY;
+        const Rec       EMPTY_RECORD(METRIC_A);
+
+        for (int i = 1; i <= 3; ++i) {
+            Histogram expected;
+            for (int j = 0; j < 100 * i; ++j) {
+                const double VALUE = (j % 7) * 1.25 * i + 0.5;
+                mX.update(VALUE);
+                expected.add(VALUE);
+            }
+
+            Rec       loaded, reset;
+            Histogram loadedHistogram;
+
+            X.load(&loaded);
+            X.loadHistogram(&loadedHistogram);
+
+            switch (i) {
+              case 1: {
+                mX.loadAndReset(&reset);
+                ASSERTV(i, loaded == reset);
+              } break;
+              case 2: {
+                Histogram resetHistogram;
+                mX.loadAndResetHistogram(&resetHistogram);
+                ASSERTV(i, loadedHistogram == resetHistogram);
+              } break;
+              case 3: {
+                mX.reset();
+              } break;
+            }
+
+            ASSERTV(i, expected == loadedHistogram);
+            verifyRecord(i, loaded, METRIC_A, expected);
+
+            Rec       after;
+            Histogram afterHistogram;
+            X.load(&after);
+            X.loadHistogram(&afterHistogram);
+
+            ASSERTV(i, after,          EMPTY_RECORD == after);
+            ASSERTV(i, afterHistogram, EMPTY        == afterHistogram);
+        }
+
+        ASSERT(0 == defaultAllocator.numAllocations());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, 'update', AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 A newly created collector is empty, and loads a record having the
+        //:   collector's metric id, the default aggregates, and no quantiles.
+        //:
+        //: 2 'update' records the value in the same bucket as
+        //:   'Histogram::add', and updates the count, total, minimum, and
+        //:   maximum.
+        //:
+        //: 3 'load' populates a record with the aggregates of the recorded
+        //:   values, and the quantiles (identified by
+        //:   'MetricRecord::Quantile') of the distribution loaded by
+        //:   'loadHistogram'.
+        //:
+        //: 4 'load' and 'loadHistogram' do not modify the collector.
+        //
+        // Plan:
+        //: 1 Create collectors for two metric ids, and verify the loaded
+        //:   values.  (C-1)
+        //:
+        //: 2 For a sequence of values (including values outside the tracked
+        //:   range), update a collector and add the value to a 'Histogram',
+        //:   then verify that the histogram loaded from the collector is
+        //:   equal to that histogram, and that the loaded record has the
+        //:   aggregates and quantiles of that histogram.  Load twice to verify
+        //:   the collector is not modified.  (C-2..4)
+        //
+        // Testing:
+        //   explicit HistogramCollector(const MetricId& metricId);
+        //   ~HistogramCollector();
+        //   void update(double value);
+        //   void load(MetricRecord *record) const;
+        //   void loadHistogram(Histogram *histogram) const;
+        //   const MetricId& metricId() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS, 'update', AND ACCESSORS" << endl
+                          << "=================================" << endl;
+
+        {
+            const Obj X(METRIC_A);
+            const Obj Y(METRIC_B);
+
+            ASSERT(METRIC_A == X.metricId());
+            ASSERT(METRIC_B == Y.metricId());
+
+            Rec       record;
+            Histogram histogram;
+
+            record.setQuantile(Rec::e_P50, 1.0);
+            histogram.add(5.0);
+
+            X.load(&record);
+            X.loadHistogram(&histogram);
+
+            ASSERT(Rec(METRIC_A) == record);
+            ASSERT(Histogram()   == histogram);
+
+            Y.load(&record);
+            ASSERT(Rec(METRIC_B) == record);
+        }
+
+        const double DATA[] = {
+            10.0, 1.0, 100.0, 2.5, 2.5, 1e-12, -4.0, 7e10, 0.0, 1000.0, 33.3
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        Obj       mX(METRIC_A); const Obj& X = mX;
+        Histogram expected;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const double VALUE = DATA[ti];
+
+            mX.update(VALUE);
+            expected.add(VALUE);
+
+            if (veryVerbose) { T_ P_(ti) P(VALUE) }
+
+            for (int rep = 0; rep < 2; ++rep) {
+                Histogram histogram;
+                Rec       record;
+
+                X.loadHistogram(&histogram);
+                X.load(&record);
+
+                ASSERTV(ti, rep, expected == histogram);
+                verifyRecord(ti, record, METRIC_A, expected);
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Update a collector, and load and reset it.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX(METRIC_A); const Obj& X = mX;
+
+        for (int i = 1; i <= 1000; ++i) {
+            mX.update(i);
+        }
+
+        Rec record;
+        X.load(&record);
+
+        ASSERT(METRIC_A == record.metricId());
+        ASSERT(1000     == record.count());
+        ASSERT(500500.0 == record.total());
+        ASSERT(1.0      == record.min());
+        ASSERT(1000.0   == record.max());
+        ASSERT(record.hasQuantiles());
+
+        const double P50 = record.quantile(Rec::e_P50);
+        const double P99 = record.quantile(Rec::e_P99);
+        ASSERTV(P50, 490.0 < P50 && P50 < 510.0);
+        ASSERTV(P99, 975.0 < P99 && P99 < 1000.0);
+
+        mX.loadAndReset(&record);
+        ASSERT(1000 == record.count());
+
+        X.load(&record);
+        ASSERT(0     == record.count());
+        ASSERT(false == record.hasQuantiles());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // CONCERN: PERFORMANCE OF CONCURRENT UPDATES
+        //
+        // Concerns:
+        //: 1 The cost of 'update' is comparable to that of
+        //:   'balm::Collector::update', for any number of threads.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, 8, and 16 threads (or up to the maximum specified by
+        //:   'argv[2]'), have every thread update the same histogram
+        //:   collector a number of times (1000000, or as specified by
+        //:   'argv[3]'), and report the number of updates per second; repeat
+        //:   with a 'balm::Collector'.
+        //
+        // Testing:
+        //   CONCERN: PERFORMANCE OF CONCURRENT UPDATES
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "CONCERN: PERFORMANCE OF CONCURRENT UPDATES" << endl
+             << "==========================================" << endl;
+
+        const int maxNumThreads = argc > 2 && bsl::atoi(argv[2]) > 0
+                                ? bsl::atoi(argv[2])
+                                : 16;
+        const int numUpdates    = argc > 3 && bsl::atoi(argv[3]) > 0
+                                ? bsl::atoi(argv[3])
+                                : 1000000;
+
+        cout << "threads\thistogram updates/s\tcollector updates/s" << endl;
+        for (int numThreads = 1;
+             numThreads <= maxNumThreads;
+             numThreads *= 2) {
+            cout << numThreads;
+            for (int useHistogram = 1; useHistogram >= 0; --useHistogram) {
+                Obj             histogramCollector(METRIC_A);
+                balm::Collector collector(METRIC_A);
+
+                bslmt::Barrier     barrier(numThreads + 1);
+                bslmt::ThreadGroup threads;
+                threads.addThreads(
+                     bdlf::BindUtil::bind(&benchmarkThread,
+                                          useHistogram ? &histogramCollector
+                                                       : 0,
+                                          &collector,
+                                          numUpdates,
+                                          &barrier),
+                     numThreads);
+
+                bsls::Stopwatch timer;
+                timer.start();
+                barrier.wait();
+                threads.joinAll();
+                timer.stop();
+
+                cout << '\t'
+                     << numThreads * static_cast<double>(numUpdates)
+                                                         / timer.elapsedTime();
+            }
+            cout << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -14,6 +14,7 @@ BSLS_IDENT_RCSID(balm_integercollector_cpp,"$Id$ $CSID$")
 
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_climits.h>
 
 namespace BloombergLP {
@@ -31,25 +32,94 @@ const int balm::IntegerCollector::DEFAULT_MAX = INT_MIN;
 #endif
 
 namespace balm {
+
+                       // ----------------------------
+                       // struct IntegerCollector_Shard
+                       // ----------------------------
+
+// CREATORS
+IntegerCollector_Shard::IntegerCollector_Shard()
+: d_lock(bsls::SpinLock::s_unlocked)
+, d_count(0)
+, d_total(0)
+, d_min(IntegerCollector::k_DEFAULT_MIN)
+, d_max(IntegerCollector::k_DEFAULT_MAX)
+{
+}
+
+// MANIPULATORS
+void IntegerCollector_Shard::reset()
+{
+    d_count = 0;
+    d_total = 0;
+    d_min   = IntegerCollector::k_DEFAULT_MIN;
+    d_max   = IntegerCollector::k_DEFAULT_MAX;
+}
+
+                          // ----------------------
+                          // class IntegerCollector
+                          // ----------------------
+
+// PRIVATE ACCESSORS
+void IntegerCollector::lockAll() const
+{
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        d_shards[i].d_lock.lock();
+    }
+}
+
+void IntegerCollector::unlockAll() const
+{
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        d_shards[i].d_lock.unlock();
+    }
+}
+
+void IntegerCollector::loadAggregates(int                *count,
+                                      bsls::Types::Int64 *total,
+                                      int                *min,
+                                      int                *max,
+                                      bool                reset) const
+{
+    *count = 0;
+    *total = 0;
+    *min   = k_DEFAULT_MIN;
+    *max   = k_DEFAULT_MAX;
+
+    lockAll();
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        IntegerCollector_Shard& shard = d_shards[i];
+
+        *count += shard.d_count;
+        *total += shard.d_total;
+        *min   =  bsl::min(*min, shard.d_min);
+        *max   =  bsl::max(*max, shard.d_max);
+        if (reset) {
+            shard.reset();
+        }
+    }
+    unlockAll();
+}
+
 // MANIPULATORS
+void IntegerCollector::reset()
+{
+    lockAll();
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        d_shards[i].reset();
+    }
+    unlockAll();
+}
+
 void IntegerCollector::loadAndReset(MetricRecord *records)
 {
     int                count;
     bsls::Types::Int64 total;
     int                min;
     int                max;
-    {
-        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-        count = d_count;
-        total = d_total;
-        min   = d_min;
-        max   = d_max;
-
-        d_count = 0;
-        d_total = 0;
-        d_min   = k_DEFAULT_MIN;
-        d_max   = k_DEFAULT_MAX;
-    }
+
+    loadAggregates(&count, &total, &min, &max, true);
+
     // Perform the conversion to double values outside of the lock.
     records->metricId() = d_metricId;
     records->count()    = count;
@@ -62,6 +132,22 @@ void IntegerCollector::loadAndReset(MetricRecord *records)
                         : max;
 }
 
+void IntegerCollector::setCountTotalMinMax(int count,
+                                           int total,
+                                           int min,
+                                           int max)
+{
+    lockAll();
+    for (int i = 1; i < k_NUM_SHARDS; ++i) {
+        d_shards[i].reset();
+    }
+    d_shards[0].d_count = count;
+    d_shards[0].d_total = total;
+    d_shards[0].d_min   = min;
+    d_shards[0].d_max   = max;
+    unlockAll();
+}
+
 // ACCESSORS
 void IntegerCollector::load(MetricRecord *record) const
 {
@@ -70,13 +156,7 @@ void IntegerCollector::load(MetricRecord *record) const
     int                min;
     int                max;
 
-    {
-        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-        count = d_count;
-        total = d_total;
-        min   = d_min;
-        max   = d_max;
-    }
+    loadAggregates(&count, &total, &min, &max, false);
 
     // Perform the conversion to double values outside of the lock.
     record->metricId() = d_metricId;
@@ -17,6 +17,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //   balm::IntegerCollector: a container for collecting integral values
+//   balm::IntegerCollector_Shard: *private* one stripe of an integer collector
 //
 //@SEE_ALSO:
 //
@@ -44,6 +45,16 @@ BSLS_IDENT("$Id: $")
 // non-creator operations on a given instance can be safely invoked
 // simultaneously from multiple threads.
 //
+///Performance
+///-----------
+// As for 'balm::Collector' (see {'balm_collector'}), the aggregated values of
+// a 'balm::IntegerCollector' are spread over a fixed number of shards, each
+// padded to the size of a cache line and guarded by its own spin lock.
+// 'update' and 'accumulateCountTotalMinMax' lock only the shard selected by
+// the calling thread, so concurrent updates rarely contend; 'load',
+// 'loadAndReset', 'reset', and 'setCountTotalMinMax' lock all shards and are
+// correspondingly more expensive.
+//
 ///Usage
 ///-----
 // The following example creates a 'balm::IntegerCollector', modifies its
@@ -86,14 +97,48 @@ BSLS_IDENT("$Id: $")
 #include <balm_metricid.h>
 #include <balm_metricrecord.h>
 
-#include <bslmt_mutex.h>
-#include <bslmt_lockguard.h>
+#include <bslmt_platform.h>
+#include <bslmt_threadutil.h>
 
+#include <bsls_spinlock.h>
 #include <bsls_types.h>
 
 namespace BloombergLP {
 namespace balm {
 
+                       // ============================
+                       // struct IntegerCollector_Shard
+                       // ============================
+
+struct IntegerCollector_Shard {
+    // This 'struct' holds the count, total, minimum, and maximum accumulated
+    // in one shard of an 'IntegerCollector', and the lock guarding them,
+    // padded to the size of a cache line.  This is an implementation type of
+    // 'IntegerCollector' and should not be used by clients of this package.
+
+    // DATA
+    bsls::SpinLock     d_lock;   // guards the other members of this shard
+    int                d_count;  // aggregated count of events
+    bsls::Types::Int64 d_total;  // total of values across events
+    int                d_min;    // minimum value across events
+    int                d_max;    // maximum value across events
+    char               d_pad[bslmt::Platform::e_CACHE_LINE_SIZE
+                             - 3 * sizeof(bsls::Types::Int64)];
+                                 // padding to the size of a cache line
+
+    // CREATORS
+    IntegerCollector_Shard();
+        // Create a shard having a count of 0, a total of 0, a minimum of
+        // 'IntegerCollector::k_DEFAULT_MIN', and a maximum of
+        // 'IntegerCollector::k_DEFAULT_MAX'.
+
+    // MANIPULATORS
+    void reset();
+        // Reset the count, total, minimum, and maximum of this shard to their
+        // default values.  The behavior is undefined unless 'd_lock' is held
+        // by the calling thread.
+};
+
                            // ======================
                            // class IntegerCollector
                            // ======================
@@ -103,23 +148,50 @@ class IntegerCollector {
     // value of an integer metric over a period of time.  The collector
     // contains a 'MetricId' object identifying the metric being collected,
     // the number of times an event occurred, and the total, minimum, and
-    // maximum aggregates of the associated measurement value.  The default
-    // value for the count is 0, the default value for the total is 0, the
-    // default value for the minimum is 'k_DEFAULT_MIN', and the default value
-    // for the maximum is 'k_DEFAULT_MAX'.
+    // maximum aggregates of the associated measurement value, spread over a
+    // fixed number of shards (see {Performance}).  The default value for the
+    // count is 0, the default value for the total is 0, the default value
+    // for the minimum is 'k_DEFAULT_MIN', and the default value for the
+    // maximum is 'k_DEFAULT_MAX'.
+
+    // PRIVATE TYPES
+    enum {
+        k_SHARD_BITS = 3,                 // log2 of the number of shards
+
+        k_NUM_SHARDS = 1 << k_SHARD_BITS  // number of shards
+    };
 
     // DATA
-    MetricId             d_metricId;  // metric identifier
-    int                  d_count;     // aggregated count of events
-    bsls::Types::Int64   d_total;     // total of values across events
-    int                  d_min;       // minimum value across events
-    int                  d_max;       // maximum value across events
-    mutable bslmt::Mutex d_mutex;     // synchronizes access to data
+    MetricId                       d_metricId;  // metric identifier
+
+    mutable IntegerCollector_Shard d_shards[k_NUM_SHARDS];
+                                                // accumulated values
 
     // NOT IMPLEMENTED
     IntegerCollector(const IntegerCollector&);
     IntegerCollector& operator=(const IntegerCollector&);
 
+    // PRIVATE CLASS METHODS
+    static int shardIndex();
+        // Return the index of the shard updated by the calling thread.
+
+    // PRIVATE ACCESSORS
+    void lockAll() const;
+        // Acquire the locks of all shards of this collector, in order.
+
+    void unlockAll() const;
+        // Release the locks of all shards of this collector.
+
+    void loadAggregates(int                *count,
+                        bsls::Types::Int64 *total,
+                        int                *min,
+                        int                *max,
+                        bool                reset) const;
+        // Load into the specified 'count', 'total', 'min', and 'max' the
+        // aggregated values of all shards of this collector, and if the
+        // specified 'reset' is 'true', reset every shard to its default
+        // values, all in a single atomic operation.
+
   public:
     // PUBLIC CONSTANTS
     static const int k_DEFAULT_MIN;  // default minimum value (INT_MAX)
@@ -209,11 +281,6 @@ class IntegerCollector {
 inline
 IntegerCollector::IntegerCollector(const MetricId& metricId)
 : d_metricId(metricId)
-, d_count(0)
-, d_total(0)
-, d_min(k_DEFAULT_MIN)
-, d_max(k_DEFAULT_MAX)
-, d_mutex()
 {
 }
 
@@ -222,25 +289,28 @@ IntegerCollector::~IntegerCollector()
 {
 }
 
-// MANIPULATORS
+// PRIVATE CLASS METHODS
 inline
-void IntegerCollector::reset()
+int IntegerCollector::shardIndex()
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    d_count = 0;
-    d_total = 0;
-    d_min   = k_DEFAULT_MIN;
-    d_max   = k_DEFAULT_MAX;
+    const bsls::Types::Uint64 k_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+
+    return static_cast<int>((bslmt::ThreadUtil::selfIdAsUint64()
+                                                              * k_MULTIPLIER)
+                            >> (64 - k_SHARD_BITS));
 }
 
+// MANIPULATORS
 inline
 void IntegerCollector::update(int value)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    ++d_count;
-    d_total += value;
-    d_min = bsl::min(value, d_min);
-    d_max = bsl::max(value, d_max);
+    IntegerCollector_Shard& shard = d_shards[shardIndex()];
+    bsls::SpinLockGuard     guard(&shard.d_lock);
+
+    ++shard.d_count;
+    shard.d_total += value;
+    shard.d_min   =  bsl::min(value, shard.d_min);
+    shard.d_max   =  bsl::max(value, shard.d_max);
 }
 
 inline
@@ -249,24 +319,13 @@ void IntegerCollector::accumulateCountTotalMinMax(int count,
                                                   int min,
                                                   int max)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    d_count += count;
-    d_total += total;
-    d_min   = bsl::min(min, d_min);
-    d_max   = bsl::max(max, d_max);
-}
+    IntegerCollector_Shard& shard = d_shards[shardIndex()];
+    bsls::SpinLockGuard     guard(&shard.d_lock);
 
-inline
-void IntegerCollector::setCountTotalMinMax(int count,
-                                           int total,
-                                           int min,
-                                           int max)
-{
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    d_count = count;
-    d_total = total;
-    d_min   = min;
-    d_max   = max;
+    shard.d_count += count;
+    shard.d_total += total;
+    shard.d_min   =  bsl::min(min, shard.d_min);
+    shard.d_max   =  bsl::max(max, shard.d_max);
 }
 
 // ACCESSORS
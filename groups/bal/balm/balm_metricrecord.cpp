@@ -12,6 +12,8 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(balm_metricrecord_cpp,"$Id$ $CSID$")
 
+#include <bsls_assert.h>
+
 #include <bsl_cfloat.h>  // DBL_MAX
 #include <bsl_ostream.h>
 
@@ -43,14 +45,45 @@ const double balm::MetricRecord::DEFAULT_MAX =
 #endif
 
 namespace balm {
+// CLASS METHODS
+double MetricRecord::quantileLevel(Quantile quantile)
+{
+    switch (quantile) {
+      case e_P50:  return 0.5;                                        // RETURN
+      case e_P90:  return 0.9;                                        // RETURN
+      case e_P99:  return 0.99;                                       // RETURN
+      case e_P999: return 0.999;                                      // RETURN
+    }
+    BSLS_ASSERT(false && "Invalid quantile");
+    return 0.0;
+}
+
+const char *MetricRecord::quantileName(Quantile quantile)
+{
+    switch (quantile) {
+      case e_P50:  return "p50";                                      // RETURN
+      case e_P90:  return "p90";                                      // RETURN
+      case e_P99:  return "p99";                                      // RETURN
+      case e_P999: return "p999";                                     // RETURN
+    }
+    BSLS_ASSERT(false && "Invalid quantile");
+    return "(* UNKNOWN *)";
+}
+
 // ACCESSORS
 bsl::ostream& MetricRecord::print(bsl::ostream& stream) const
 {
     stream << "[ " << d_metricId << ": " << d_count
            << " " << d_total
            << " " << d_min
-           << " " << d_max
-           << " ]";
+           << " " << d_max;
+    if (d_hasQuantiles) {
+        for (int i = 0; i < k_NUM_QUANTILES; ++i) {
+            stream << " " << quantileName(static_cast<Quantile>(i))
+                   << "=" << d_quantiles[i];
+        }
+    }
+    stream << " ]";
     return stream;
 }
 
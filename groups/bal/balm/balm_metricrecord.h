@@ -33,8 +33,18 @@ BSLS_IDENT("$Id: balm_metricrecord.h,v 1.8 2008/04/16 20:00:49 hversche Exp $")
 //   total        double           total of metric values           0.0
 //   min          double           minimum metric value             Infinity
 //   max          double           maximum metric value             -Infinity
+//   quantiles    double[4]        p50, p90, p99, and p99.9 values  (none)
 //..
 //
+///Quantiles
+///---------
+// A record may optionally carry an estimate of the 50th, 90th, 99th, and
+// 99.9th percentiles of the recorded values (see 'Quantile').  Quantiles are
+// supplied by collectors that retain the distribution of the recorded values
+// (e.g., 'balm::HistogramCollector'); records populated by other collectors
+// have no quantiles (i.e., 'hasQuantiles()' is 'false').  Quantiles are set
+// using 'setQuantile', and removed using 'clearQuantiles'.
+//
 ///Alternative Systems for Telemetry
 ///---------------------------------
 // Bloomberg software may alternatively use the GUTS telemetry API, which is
@@ -168,14 +178,36 @@ class MetricRecord {
     // defined 'k_DEFAULT_MIN' constant (the representation for positive
     // default 'total' is 0.0, the default 'min' is the infinity), and the
     // default 'max' is the defined 'k_DEFAULT_MAX' constant (the
-    // representation for negative infinity).
+    // representation for negative infinity).  A record optionally holds
+    // the quantiles of the measured value (see 'Quantile'); by default a
+    // record has no quantiles.
+
+  public:
+    // PUBLIC TYPES
+    enum Quantile {
+        // Enumeration of the quantiles that may be held by a record.
+
+        e_P50  = 0,  // 50th percentile (median)
+        e_P90  = 1,  // 90th percentile
+        e_P99  = 2,  // 99th percentile
+        e_P999 = 3   // 99.9th percentile
+    };
 
+    enum { k_NUM_QUANTILES = 4 };  // number of enumerators in 'Quantile'
+
+  private:
     // DATA
     MetricId d_metricId;  // id for the metric
     int           d_count;     // aggregated count of events
     double        d_total;     // total of values across events
     double        d_min;       // minimum value across events
     double        d_max;       // maximum value across events
+    double        d_quantiles[k_NUM_QUANTILES];
+                               // quantiles of values across events (0.0 if
+                               // not set)
+
+    bool          d_hasQuantiles;
+                               // 'true' if the quantiles have been set
 
   public:
     // PUBLIC CONSTANTS
@@ -186,6 +218,16 @@ class MetricRecord {
     static const double DEFAULT_MAX;
 #endif
 
+    // CLASS METHODS
+    static double quantileLevel(Quantile quantile);
+        // Return the fraction of recorded values, in the range '(0.0, 1.0)',
+        // that are less than or equal to the specified 'quantile' (e.g., 0.99
+        // for 'e_P99').
+
+    static const char *quantileName(Quantile quantile);
+        // Return the non-modifiable, null-terminated name of the specified
+        // 'quantile' (e.g., "p99" for 'e_P99').
+
     // CREATORS
     MetricRecord();
         // Create a metric record having default values for its metric
@@ -210,7 +252,7 @@ class MetricRecord {
                  double          min,
                  double          max);
         // Create a metric record having the specified 'metricId', 'count',
-        // 'total', 'min', and 'max' attribute values.
+        // 'total', 'min', and 'max' attribute values, and no quantiles.
 
     MetricRecord(const MetricRecord& original);
         // Create a metric record having the value of the specified 'original'
@@ -245,6 +287,15 @@ class MetricRecord {
         // Return a reference to the modifiable 'min' attribute representing
         // the minimum of the individually recorded values.
 
+    void setQuantile(Quantile quantile, double value);
+        // Set the specified 'quantile' of this record to the specified
+        // 'value'.  After this operation 'hasQuantiles()' is 'true'; note
+        // that any quantile not explicitly set has the value 0.0.
+
+    void clearQuantiles();
+        // Remove the quantiles from this record, so that 'hasQuantiles()' is
+        // 'false'.
+
     // ACCESSORS
     const MetricId& metricId() const;
         // Return a reference to the non-modifiable 'metricId' attribute
@@ -266,6 +317,14 @@ class MetricRecord {
         // Return a reference to the non-modifiable 'min' attribute
         // representing the minimum of the individually recorded values.
 
+    bool hasQuantiles() const;
+        // Return 'true' if this record holds quantiles of the recorded values,
+        // and 'false' otherwise.
+
+    double quantile(Quantile quantile) const;
+        // Return the value of the specified 'quantile' of the individually
+        // recorded values, or 0.0 if 'hasQuantiles()' is 'false'.
+
     bsl::ostream& print(bsl::ostream& stream) const;
         // Write a description of this record to the specified 'stream' and
         // return a reference to the modifiable 'stream'.
@@ -281,14 +340,14 @@ bool operator==(const MetricRecord& lhs, const MetricRecord& rhs);
     // Return 'true' if the specified 'lhs' and 'rhs' metric records have the
     // same value and 'false' otherwise.  Two records have the same value if
     // they have the same values for their 'metricId', 'count', 'total',
-    // 'min', and 'max' attributes, respectively.
+    // 'min', 'max', and 'quantiles' attributes, respectively.
 
 inline
 bool operator!=(const MetricRecord& lhs, const MetricRecord& rhs);
     // Return 'true' if the specified 'lhs' and 'rhs' metric records do not
     // have the same value and 'false' otherwise.  Two records do not have
     // same value if they differ in their respective values for 'metricId',
-    // 'count', 'total', 'min', or 'max' attributes.
+    // 'count', 'total', 'min', 'max', or 'quantiles' attributes.
 
 inline
 bsl::ostream& operator<<(bsl::ostream&       stream,
@@ -313,7 +372,9 @@ MetricRecord::MetricRecord()
 , d_total(0.0)
 , d_min(k_DEFAULT_MIN)
 , d_max(k_DEFAULT_MAX)
+, d_hasQuantiles(false)
 {
+    clearQuantiles();
 }
 
 inline
@@ -323,7 +384,9 @@ MetricRecord::MetricRecord(const MetricId& metricId)
 , d_total(0.0)
 , d_min(k_DEFAULT_MIN)
 , d_max(k_DEFAULT_MAX)
+, d_hasQuantiles(false)
 {
+    clearQuantiles();
 }
 
 inline
@@ -337,7 +400,9 @@ MetricRecord::MetricRecord(const MetricId& metricId,
 , d_total(total)
 , d_min(min)
 , d_max(max)
+, d_hasQuantiles(false)
 {
+    clearQuantiles();
 }
 
 inline
@@ -347,7 +412,11 @@ MetricRecord::MetricRecord(const MetricRecord& original)
 , d_total(original.d_total)
 , d_min(original.d_min)
 , d_max(original.d_max)
+, d_hasQuantiles(original.d_hasQuantiles)
 {
+    for (int i = 0; i < k_NUM_QUANTILES; ++i) {
+        d_quantiles[i] = original.d_quantiles[i];
+    }
 }
 
 // MANIPULATORS
@@ -359,6 +428,10 @@ MetricRecord& MetricRecord::operator=(const MetricRecord& rhs)
     d_total    = rhs.d_total;
     d_min      = rhs.d_min;
     d_max      = rhs.d_max;
+    for (int i = 0; i < k_NUM_QUANTILES; ++i) {
+        d_quantiles[i] = rhs.d_quantiles[i];
+    }
+    d_hasQuantiles = rhs.d_hasQuantiles;
     return *this;
 }
 
@@ -392,6 +465,22 @@ double& MetricRecord::min()
     return d_min;
 }
 
+inline
+void MetricRecord::setQuantile(Quantile quantile, double value)
+{
+    d_quantiles[quantile] = value;
+    d_hasQuantiles        = true;
+}
+
+inline
+void MetricRecord::clearQuantiles()
+{
+    for (int i = 0; i < k_NUM_QUANTILES; ++i) {
+        d_quantiles[i] = 0.0;
+    }
+    d_hasQuantiles = false;
+}
+
 // ACCESSORS
 inline
 const MetricId& MetricRecord::metricId() const
@@ -423,17 +512,40 @@ const double& MetricRecord::min() const
     return d_min;
 }
 
+inline
+bool MetricRecord::hasQuantiles() const
+{
+    return d_hasQuantiles;
+}
+
+inline
+double MetricRecord::quantile(Quantile quantile) const
+{
+    return d_quantiles[quantile];
+}
+
 }  // close package namespace
 
 // FREE OPERATORS
 inline
 bool balm::operator==(const MetricRecord& lhs, const MetricRecord& rhs)
 {
-    return lhs.metricId() == rhs.metricId()
-        && lhs.count()    == rhs.count()
-        && lhs.total()    == rhs.total()
-        && lhs.min()      == rhs.min()
-        && lhs.max()      == rhs.max();
+    if (lhs.metricId()     != rhs.metricId()
+     || lhs.count()        != rhs.count()
+     || lhs.total()        != rhs.total()
+     || lhs.min()          != rhs.min()
+     || lhs.max()          != rhs.max()
+     || lhs.hasQuantiles() != rhs.hasQuantiles()) {
+        return false;                                                 // RETURN
+    }
+    for (int i = 0; i < MetricRecord::k_NUM_QUANTILES; ++i) {
+        const MetricRecord::Quantile quantile =
+                                       static_cast<MetricRecord::Quantile>(i);
+        if (lhs.quantile(quantile) != rhs.quantile(quantile)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
 }
 
 inline
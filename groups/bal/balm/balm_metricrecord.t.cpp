@@ -36,6 +36,10 @@ using bsl::flush;
 // constraints placed up their values.
 //
 // ----------------------------------------------------------------------------
+// CLASS METHODS
+// [10]  double quantileLevel(Quantile quantile);
+// [10]  const char *quantileName(Quantile quantile);
+//
 // CREATORS
 // [ 3]  balm::MetricRecord();
 // [ 5]  balm::MetricRecord(const balm::MetricRecord&  original);
@@ -54,6 +58,8 @@ using bsl::flush;
 // [ 2]  double& total();
 // [ 2]  double& max();
 // [ 2]  double& min();
+// [10]  void setQuantile(Quantile quantile, double value);
+// [10]  void clearQuantiles();
 //
 // ACCESSORS
 // [ 2]  const balm::MetricId& metric() const;
@@ -61,6 +67,8 @@ using bsl::flush;
 // [ 2]  const double& total() const;
 // [ 2]  const double& max() const;
 // [ 2]  const double& min() const;
+// [10]  bool hasQuantiles() const;
+// [10]  double quantile(Quantile quantile) const;
 // [ 7]  bsl::ostream& print(bsl::ostream &stream) const;
 //
 // FREE OPERATORS
@@ -73,6 +81,8 @@ using bsl::flush;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 8] USAGE EXAMPLE
+// [ 9] CONCERN: DEFAULT VALUES
+// [10] CONCERN: QUANTILES
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -206,6 +216,109 @@ int main(int argc, char *argv[])
     Desc mE(&cA, "E"); const Desc *ME = &mE;
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING QUANTILES
+        //
+        // Concerns:
+        //: 1 A default constructed record, or a record constructed from
+        //:   explicit 'count', 'total', 'min', and 'max' values, has no
+        //:   quantiles.
+        //:
+        //: 2 'setQuantile' sets exactly the specified quantile, and marks the
+        //:   record as having quantiles.
+        //:
+        //: 3 'clearQuantiles' restores the default (absent) quantiles.
+        //:
+        //: 4 Quantiles participate in copy construction, assignment,
+        //:   equality, and 'print'.
+        //:
+        //: 5 'quantileLevel' and 'quantileName' return the documented values.
+        //
+        // Plan:
+        //: 1 Set the quantiles of a record one at a time and verify the
+        //:   observable state after each step.  (C-1..3)
+        //:
+        //: 2 Copy, assign, compare, and print records with and without
+        //:   quantiles.  (C-4)
+        //:
+        //: 3 Verify the class methods for each enumerator.  (C-5)
+        //
+        // Testing:
+        //   double quantileLevel(Quantile quantile);
+        //   const char *quantileName(Quantile quantile);
+        //   void setQuantile(Quantile quantile, double value);
+        //   void clearQuantiles();
+        //   bool hasQuantiles() const;
+        //   double quantile(Quantile quantile) const;
+        //   CONCERN: QUANTILES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting Quantiles"
+                          << "\n=================" << endl;
+
+        ASSERT(0.5   == Obj::quantileLevel(Obj::e_P50));
+        ASSERT(0.9   == Obj::quantileLevel(Obj::e_P90));
+        ASSERT(0.99  == Obj::quantileLevel(Obj::e_P99));
+        ASSERT(0.999 == Obj::quantileLevel(Obj::e_P999));
+
+        ASSERT(0 == bsl::strcmp("p50",  Obj::quantileName(Obj::e_P50)));
+        ASSERT(0 == bsl::strcmp("p90",  Obj::quantileName(Obj::e_P90)));
+        ASSERT(0 == bsl::strcmp("p99",  Obj::quantileName(Obj::e_P99)));
+        ASSERT(0 == bsl::strcmp("p999", Obj::quantileName(Obj::e_P999)));
+
+        Obj mX(Id(MA), 4, 10.0, 1.0, 4.0); const Obj& X = mX;
+        const Obj Y(X);
+
+        ASSERT(false == X.hasQuantiles());
+        ASSERT(false == Obj().hasQuantiles());
+        for (int i = 0; i < Obj::k_NUM_QUANTILES; ++i) {
+            ASSERTV(i, 0.0 == X.quantile(static_cast<Obj::Quantile>(i)));
+        }
+
+        for (int i = 0; i < Obj::k_NUM_QUANTILES; ++i) {
+            const Obj::Quantile QUANTILE = static_cast<Obj::Quantile>(i);
+            mX.setQuantile(QUANTILE, i + 1.5);
+
+            ASSERTV(i, true    == X.hasQuantiles());
+            ASSERTV(i, i + 1.5 == X.quantile(QUANTILE));
+            for (int j = i + 1; j < Obj::k_NUM_QUANTILES; ++j) {
+                const Obj::Quantile OTHER = static_cast<Obj::Quantile>(j);
+                ASSERTV(i, j, 0.0 == X.quantile(OTHER));
+            }
+            ASSERTV(i, Y != X);
+        }
+
+        const Obj Z(X);
+        ASSERT(Z == X);
+        ASSERT(Z.hasQuantiles());
+        ASSERT(4.5 == Z.quantile(Obj::e_P999));
+
+        Obj mW; const Obj& W = mW;
+        mW = X;
+        ASSERT(W == X);
+
+        mW.setQuantile(Obj::e_P99, 100.0);
+        ASSERT(W != X);
+
+        {
+            bsl::ostringstream buffer;
+            buffer << X;
+            ASSERTV(buffer.str(),
+                    "[ A.A: 4 10 1 4 p50=1.5 p90=2.5 p99=3.5 p999=4.5 ]"
+                                                             == buffer.str());
+        }
+
+        mX.clearQuantiles();
+        ASSERT(false == X.hasQuantiles());
+        ASSERT(Y     == X);
+
+        {
+            bsl::ostringstream buffer;
+            buffer << X;
+            ASSERTV(buffer.str(), "[ A.A: 4 10 1 4 ]" == buffer.str());
+        }
+      } break;
       case 9: {
         // --------------------------------------------------------------------
         // TESTING DEFAULT VALUES
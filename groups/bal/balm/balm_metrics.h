@@ -92,6 +92,13 @@ BSLS_IDENT("$Id: $")
 //       lookup on 'CATEGORY' and 'METRIC' on each invocation, so those values
 //       need *not* be runtime constants.
 //
+//   BALM_METRICS_HISTOGRAM_UPDATE(CATEGORY, METRIC, VALUE)
+//   BALM_METRICS_DYNAMIC_HISTOGRAM_UPDATE(CATEGORY, METRIC, VALUE)
+//       Record 'VALUE' in the distribution of the identified metric, so that
+//       the metric's quantiles (e.g., its 99th percentile) are published in
+//       addition to its aggregates.  The dynamic variant performs a lookup on
+//       'CATEGORY' and 'METRIC' on each invocation.
+//
 //   BALM_METRICS_TIME_BLOCK(CATEGORY, METRIC, TIME_UNITS)
 //   BALM_METRICS_TIME_BLOCK_SECONDS(CATEGORY, METRIC)
 //   BALM_METRICS_TIME_BLOCK_MILLISECONDS(CATEGORY, METRIC)
@@ -277,6 +284,31 @@ BSLS_IDENT("$Id: $")
 //       The behavior of this macro is logically equivalent to
 //       'BALM_METRICS_DYNAMIC_INT_UPDATE(CATEGORY, METRIC, 1)'.
 //..
+// The following macros update the indicated metric's count, total, minimum,
+// and maximum like 'BALM_METRICS_UPDATE', and, in addition, record the
+// supplied value in the metric's 'balm::HistogramCollector' (see
+// 'balm_histogramcollector').  The records published for such a metric carry
+// the quantiles of the recorded values (see 'balm::MetricRecord::Quantile').
+// Recording a value is lock-free:
+//..
+//   BALM_METRICS_HISTOGRAM_UPDATE(CATEGORY, METRIC, VALUE)
+//       Record the specified 'VALUE' in the distribution of the indicated
+//       metric, identified by the specified 'CATEGORY' and 'METRIC' names.
+//       'CATEGORY' and 'METRIC' must be null-terminated strings of a type
+//       convertible to 'const char *', and 'VALUE' is assumed to be of a type
+//       convertible to 'double'.  This macro maintains a (function-scope
+//       static) cache containing the identity of the metric being updated,
+//       which in practice means that 'CATEGORY' and 'METRIC' must be
+//       *runtime* *constants*.  If the default metrics manager has not been
+//       initialized, or if the indicated 'CATEGORY' is currently disabled,
+//       this macro has no effect.
+//
+//   BALM_METRICS_DYNAMIC_HISTOGRAM_UPDATE(CATEGORY, METRIC, VALUE)
+//       The behavior of this macro is logically equivalent to
+//       'BALM_METRICS_HISTOGRAM_UPDATE(CATEGORY, METRIC, VALUE)', except that
+//       it looks up the 'CATEGORY' and 'METRIC' on *each* application, so
+//       those values need *not* be runtime constants.
+//..
 // The following macro, 'BALM_METRICS_IF_CATEGORY_ENABLED', allows clients to
 // (efficiently) determine if a (*runtime* *constant*) category is enabled:
 //..
@@ -505,6 +537,7 @@ BSLS_IDENT("$Id: $")
 #include <balm_collector.h>
 #include <balm_collectorrepository.h>
 #include <balm_defaultmetricsmanager.h>
+#include <balm_histogramcollector.h>
 #include <balm_integercollector.h>
 #include <balm_metricid.h>
 #include <balm_metricregistry.h>
@@ -996,6 +1029,39 @@ do {                                                                          \
 #define BALM_METRICS_DYNAMIC_INCREMENT(CATEGORY, METRIC)                      \
     BALM_METRICS_DYNAMIC_INT_UPDATE(CATEGORY, METRIC, 1)
 
+                        // =============================
+                        // BALM_METRICS_HISTOGRAM_UPDATE
+                        // =============================
+
+#define BALM_METRICS_HISTOGRAM_UPDATE(CATEGORY, METRIC, VALUE) do {           \
+   using namespace BloombergLP;                                               \
+   typedef balm::Metrics_Helper Helper;                                       \
+   static balm::CategoryHolder holder = { false, 0, 0 };                      \
+   static balm::HistogramCollector *collector1 = 0;                           \
+   if (0 == holder.category() && balm::DefaultMetricsManager::instance()) {   \
+     Helper::logEmptyName(CATEGORY,Helper::e_TYPE_CATEGORY,__FILE__,__LINE__);\
+     Helper::logEmptyName(METRIC, Helper::e_TYPE_METRIC, __FILE__, __LINE__); \
+       collector1 = Helper::getHistogramCollector(CATEGORY, METRIC);          \
+       Helper::initializeCategoryHolder(&holder, CATEGORY);                   \
+   }                                                                          \
+   if (holder.enabled()) {                                                    \
+       collector1->update(VALUE);                                             \
+   }                                                                          \
+ } while (0)
+
+#define BALM_METRICS_DYNAMIC_HISTOGRAM_UPDATE(CATEGORY, METRIC, VALUE) do {   \
+    using namespace BloombergLP;                                              \
+    if (balm::DefaultMetricsManager::instance()) {                            \
+        balm::CollectorRepository& repository =                               \
+             balm::DefaultMetricsManager::instance()->collectorRepository();  \
+        balm::HistogramCollector *collector =                                 \
+             repository.getDefaultHistogramCollector((CATEGORY), (METRIC));   \
+        if (collector->metricId().category()->enabled()) {                    \
+            collector->update((VALUE));                                       \
+        }                                                                     \
+    }                                                                         \
+  } while (0)
+
                         // =======================
                         // BALM_METRICS_TIME_BLOCK
                         // =======================
@@ -1202,6 +1268,13 @@ struct Metrics_Helper {
         // The behavior is undefined unless the 'balm' metrics manager
         // singleton is valid.
 
+    static HistogramCollector *getHistogramCollector(const char *category,
+                                                     const char *metric);
+        // Return the address of the histogram collector for the metric
+        // identified by the specified 'category' and 'metric' names.  The
+        // behavior is undefined unless the 'balm' metrics manager singleton is
+        // valid.
+
     static void setPublicationType(const MetricId&        id,
                                    PublicationType::Value type);
         // Set the publication type for the metric identified by the specified
@@ -1256,6 +1329,17 @@ IntegerCollector *Metrics_Helper::getIntegerCollector(const char *category,
                                                                      metric);
 }
 
+inline
+HistogramCollector *Metrics_Helper::getHistogramCollector(
+                                                        const char *category,
+                                                        const char *metric)
+{
+    MetricsManager *manager = DefaultMetricsManager::instance();
+    return manager->collectorRepository().getDefaultHistogramCollector(
+                                                                     category,
+                                                                     metric);
+}
+
 inline
 void Metrics_Helper::setPublicationType(const MetricId&        id,
                                         PublicationType::Value type)
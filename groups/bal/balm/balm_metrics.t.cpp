@@ -9,6 +9,7 @@
 
 #include <balm_metrics.h>
 
+#include <balm_histogram.h>
 #include <balm_metricregistry.h>
 #include <balm_metricsample.h>
 #include <balm_publisher.h>
@@ -88,6 +89,8 @@ using bsl::flush;
 // [ 9] BALM_METRICS_DYNAMIC_TIME_BLOCK_MILLISECONDS(CATEGORY, METRIC)
 // [ 9] BALM_METRICS_DYNAMIC_TIME_BLOCK_MICROSECONDS(CATEGORY, METRIC)
 // [ 9] BALM_METRICS_DYNAMIC_TIME_BLOCK_NANOSECONDS(CATEGORY, METRIC)
+// [19] BALM_METRICS_HISTOGRAM_UPDATE(CATEGORY, NAME, VALUE)
+// [19] BALM_METRICS_DYNAMIC_HISTOGRAM_UPDATE(CATEGORY, NAME, VALUE)
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [11] CONCURRENCY TEST: STANDARD MACROS
@@ -101,7 +104,7 @@ using bsl::flush;
 //                                             const char *file,
 //                                             int         line);
 // [18] WARNING LOG TEST: ALL MACROS
-// [19] USAGE EXAMPLE
+// [20] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -1385,7 +1388,7 @@ int main(int argc, char *argv[])
     Corp::bslma::DefaultAllocatorGuard guard(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 19: {
+      case 20: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -1443,6 +1446,101 @@ int main(int argc, char *argv[])
 
     }
     } break;
+      case 19: {
+        // --------------------------------------------------------------------
+        // TESTING: 'BALM_METRICS_HISTOGRAM_UPDATE',
+        // 'BALM_METRICS_DYNAMIC_HISTOGRAM_UPDATE'
+        //
+        // Concerns:
+        //: 1 The macros are a no-op without a default metrics manager.
+        //:
+        //: 2 The macros record the supplied value in the histogram collector
+        //:   of the identified metric.
+        //:
+        //: 3 The macros respect the 'enabled' property of the category.
+        //:
+        //: 4 The records published for the metric carry its quantiles.
+        //
+        // Plan:
+        //: 1 Invoke the macros without a default metrics manager.  (C-1)
+        //:
+        //: 2 Invoke the macros with a sequence of values, alternately
+        //:   enabling and disabling the category, and add the values recorded
+        //:   while the category is enabled to an "oracle" 'balm::Histogram'.
+        //:   Verify the histogram loaded from the metric's histogram collector
+        //:   equals the oracle.  (C-2..3)
+        //:
+        //: 3 Collect the records of the metrics' category, and verify they
+        //:   have quantiles.  (C-4)
+        //
+        // Testing:
+        //   BALM_METRICS_HISTOGRAM_UPDATE(CATEGORY, NAME, VALUE)
+        //   BALM_METRICS_DYNAMIC_HISTOGRAM_UPDATE(CATEGORY, NAME, VALUE)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING: HISTOGRAM MACROS\n"
+                          << "=========================\n";
+
+        const double UPDATES[] = { 0.0, 12.0, -1321123, 2131241, 1321.5,
+                                   43145.1, .0001, -1.00001, -.002342};
+        const int NUM_UPDATES = sizeof(UPDATES)/sizeof(*UPDATES);
+
+        if (veryVerbose)
+            cout << "\tverify macros are a no-op without a metrics manager.\n";
+        {
+            for (int i = 0; i < NUM_UPDATES; ++i) {
+                BALM_METRICS_DYNAMIC_HISTOGRAM_UPDATE("H", "dyn", UPDATES[i]);
+            }
+        }
+
+        if (veryVerbose)
+            cout << "\tverify macros are applied correctly.\n";
+        {
+            BALM::DefaultMetricsManagerScopedGuard guard(Z);
+            BALM::MetricsManager& mgr = *DefaultManager::instance();
+            Registry&   registry   = mgr.metricRegistry();
+            Repository& repository = mgr.collectorRepository();
+
+            const BALM::MetricId staticId  = registry.getId("H", "static");
+            const BALM::MetricId dynamicId = registry.getId("H", "dyn");
+
+            BALM::Histogram expStatic, expDynamic;
+            for (int j = 0; j < NUM_UPDATES; ++j) {
+                const bool enabled = 0 != j % 3;
+                registry.setCategoryEnabled(staticId.category(), enabled);
+
+                BALM_METRICS_HISTOGRAM_UPDATE("H", "static", UPDATES[j]);
+                BALM_METRICS_DYNAMIC_HISTOGRAM_UPDATE("H", "dyn", UPDATES[j]);
+
+                if (enabled) {
+                    expStatic.add(UPDATES[j]);
+                    expDynamic.add(UPDATES[j]);
+                }
+
+                BALM::Histogram hStatic, hDynamic;
+                repository.getDefaultHistogramCollector(staticId)->
+                                                     loadHistogram(&hStatic);
+                repository.getDefaultHistogramCollector(dynamicId)->
+                                                    loadHistogram(&hDynamic);
+
+                ASSERTV(j, expStatic  == hStatic);
+                ASSERTV(j, expDynamic == hDynamic);
+            }
+            registry.setCategoryEnabled(staticId.category(), true);
+
+            bsl::vector<BALM::MetricRecord> records(Z);
+            repository.collectAndReset(&records, staticId.category());
+
+            ASSERTV(records.size(), 2 == records.size());
+            for (bsl::size_t i = 0; i < records.size(); ++i) {
+                ASSERTV(records[i], records[i].hasQuantiles());
+                ASSERTV(records[i],
+                        static_cast<int>(expStatic.count())
+                                                       == records[i].count());
+            }
+        }
+      } break;
       case 18: {
         // --------------------------------------------------------------------
         // Testing:
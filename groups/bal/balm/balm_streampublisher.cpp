@@ -169,6 +169,23 @@ void publishRecord(bsl::ostream&             stream,
         }
     }
 
+    if (record.hasQuantiles()) {
+        // Quantiles are values of the metric, like its extremes, so they are
+        // formatted using the format specification for 'e_MAX'.
+
+        const balm::MetricFormatSpec *quantileSpec =
+                      format ? format->formatSpec(balm::PublicationType::e_MAX)
+                             : 0;
+
+        for (int i = 0; i < balm::MetricRecord::k_NUM_QUANTILES; ++i) {
+            const balm::MetricRecord::Quantile quantile =
+                                 static_cast<balm::MetricRecord::Quantile>(i);
+            stream << ", " << balm::MetricRecord::quantileName(quantile)
+                   << " = ";
+            formatValue(stream, record.quantile(quantile), quantileSpec);
+        }
+    }
+
     stream << " ]\n";
 }
 
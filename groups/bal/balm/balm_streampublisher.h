@@ -33,7 +33,10 @@ BSLS_IDENT("$Id: $")
 //                                          publish
 //..
 // This implementation of the publisher protocol publishes records to an output
-// stream that is supplied at construction.
+// stream that is supplied at construction.  A record having quantiles (e.g.,
+// one collected from a 'balm::HistogramCollector') is published with its
+// quantiles following its other aggregates, e.g.,
+// '..., max = 5000, p50 = 150, p90 = 191, p99 = 5000, p999 = 5000 ]'.
 //
 ///Alternative Systems for Telemetry
 ///---------------------------------
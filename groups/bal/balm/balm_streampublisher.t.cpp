@@ -21,6 +21,7 @@
 #include <bsl_iostream.h>
 #include <bsl_ostream.h>
 #include <bsl_sstream.h>
+#include <bsl_string.h>
 
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
@@ -40,6 +41,9 @@ using bsl::flush;
 //                                 --------
 // ----------------------------------------------------------------------------
 // ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] CONCERN: PUBLISHING QUANTILES
+// [ 3] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -48,6 +52,26 @@ using bsl::flush;
 
 static int testStatus = 0;
 
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        bsl::cout << "Error " << __FILE__ << "(" << i << "): " << s
+                  << "    (failed)" << bsl::endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
 // ============================================================================
 //                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
 // ----------------------------------------------------------------------------
@@ -70,7 +94,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 2: {
+      case 3: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -138,6 +162,97 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONCERN: PUBLISHING QUANTILES
+        //
+        // Concerns:
+        //: 1 A record without quantiles is published without them.
+        //:
+        //: 2 The quantiles of a record having quantiles are published, in
+        //:   order, after its other aggregates, whether or not the metric has
+        //:   a preferred publication type.
+        //
+        // Plan:
+        //: 1 Publish a sample holding a record without quantiles, and one
+        //:   holding the same record with quantiles, to a string stream, and
+        //:   verify the published text.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: PUBLISHING QUANTILES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: PUBLISHING QUANTILES" << endl
+                          << "=============================" << endl;
+
+        balm::Category          category("C");
+        balm::MetricDescription description(&category, "M");
+        balm::MetricId          metricId(&description);
+
+        balm::MetricRecord plain(metricId, 4, 10.0, 1.0, 4.0);
+        balm::MetricRecord withQuantiles(plain);
+        withQuantiles.setQuantile(balm::MetricRecord::e_P50,  2.0);
+        withQuantiles.setQuantile(balm::MetricRecord::e_P90,  3.5);
+        withQuantiles.setQuantile(balm::MetricRecord::e_P99,  4.0);
+        withQuantiles.setQuantile(balm::MetricRecord::e_P999, 4.0);
+
+        const struct {
+            int         d_line;
+            bool        d_quantiles;
+            bool        d_typed;
+            const char *d_expected;
+        } DATA[] = {
+            { L_, false, false,
+                     "C.M[ count = 4, total = 10, min = 1, max = 4 ]\n" },
+            { L_, true,  false,
+                     "C.M[ count = 4, total = 10, min = 1, max = 4, "
+                     "p50 = 2, p90 = 3.5, p99 = 4, p999 = 4 ]\n"        },
+            { L_, false, true,
+                     "C.M[ total = 10 ]\n"                              },
+            { L_, true,  true,
+                     "C.M[ total = 10, "
+                     "p50 = 2, p90 = 3.5, p99 = 4, p999 = 4 ]\n"        },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE     = DATA[ti].d_line;
+            const char *EXPECTED = DATA[ti].d_expected;
+
+            description.setPreferredPublicationType(
+                                   DATA[ti].d_typed
+                                   ? balm::PublicationType::e_TOTAL
+                                   : balm::PublicationType::e_UNSPECIFIED);
+
+            balm::MetricSample sample;
+            sample.setTimeStamp(bdlt::DatetimeTz(bdlt::CurrentTime::utc(),
+                                                 0));
+            sample.appendGroup(DATA[ti].d_quantiles ? &withQuantiles : &plain,
+                               1,
+                               bsls::TimeInterval(1, 0));
+
+            bsl::ostringstream stream;
+            Obj                mX(stream);
+            mX.publish(sample);
+
+            // Only the last line of the output holds the record.
+
+            const bsl::string output = stream.str();
+            const bsl::string::size_type pos =
+                                         output.rfind('\n', output.size() - 2);
+            ASSERTV(LINE, bsl::string::npos != pos);
+
+            const bsl::string recordLine = output.substr(pos + 1);
+            const bsl::string::size_type start = recordLine.find("C.M");
+
+            if (verbose) { T_ P(recordLine) }
+
+            ASSERTV(LINE, recordLine, bsl::string::npos != start);
+            ASSERTV(LINE, recordLine, EXPECTED,
+                    EXPECTED == recordLine.substr(start));
+        }
+      } break;
       case 1: {
         // --------------------------------------------------------------------
         // BREATHING TEST:
@@ -20,6 +20,7 @@ BSLS_IDENT_RCSID(balxml_typesprintutil_cpp,"$Id$ $CSID$")
 #include <bsls_assert.h>
 #include <bsls_platform.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cctype.h>
 #include <bsl_cfloat.h>
 #include <bsl_cstdio.h>
@@ -33,6 +34,27 @@ namespace u {
 
 // HELPER FUNCTIONS
 
+#if defined(BSLS_PLATFORM_CMP_MSVC) && BSLS_PLATFORM_CMP_VERSION < 1900
+char *padExponent(char *first, char *last)
+    // Insert a '0' before the exponent in the number in the specified range
+    // '[ first, last )' if it is written in scientific notation and its
+    // exponent has fewer than three digits, and return the new end of the
+    // number.  The behavior is undefined unless 'last' is writable.  Note
+    // that 'sprintf' on these platforms writes at least three exponent
+    // digits, and this component has always written the same.
+{
+    char *exponent = bsl::find(first, last, 'e');
+    if (last - exponent != 4) {  // no exponent, or three digits already
+        return last;                                                  // RETURN
+    }
+    exponent += 2;  // skip 'e' and the sign
+    bsl::memmove(exponent + 1, exponent, 2);
+    *exponent = '0';
+    return last + 1;
+}
+#endif
+
+
 template <class INPUT_ITERATOR>
 bsl::ostream& encodeBase64(bsl::ostream&  stream,
                            INPUT_ITERATOR begin,
@@ -986,26 +1008,20 @@ bsl::ostream& TypesPrintUtil_Imp::printDefault(
       default: {
         // not a NaN and not +/- INFINITY
 
-        // On Sun, formatting a 'double' using 'ostream' is 60% slower than
-        // 'sprintf', even though the former calls the latter.  Also, note that
-        // 'snprintf' is 15% slower than 'sprintf' on Sun.
-
-        char buffer[FLT_DIG + 20];  // buffer with headroom
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(push)
-#pragma warning(disable:4996)     // suppress 'sprintf' deprecation warning
-#endif
+        // Write the shortest decimal that reads back as 'object'.
 
-        const int len =
-                    bsl::sprintf(buffer, "%.*g", FLT_DIG + 1, (double) object);
-        BSLS_ASSERT(len < (int) sizeof buffer);
+        char        buffer[24];  // "-1.17549435e-38", with headroom
+        char       *end = bslalg::NumericFormatterUtil::toChars(
+                                                        buffer,
+                                                        buffer + sizeof buffer,
+                                                        object);
+        BSLS_ASSERT(end);
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(pop)
+#if defined(BSLS_PLATFORM_CMP_MSVC) && BSLS_PLATFORM_CMP_VERSION < 1900
+        end = u::padExponent(buffer, end);
 #endif
 
-        stream.write(buffer, len);
+        stream.write(buffer, end - buffer);
       } break;
     }
 
@@ -1032,25 +1048,20 @@ bsl::ostream& TypesPrintUtil_Imp::printDefault(
       default: {
         // not a NaN and not +/- INFINITY
 
-        // On Sun, formatting a 'double' using 'ostream' is 60% slower than
-        // 'sprintf', even though the former calls the latter.  Also, note that
-        // 'snprintf' is 15% slower than 'sprintf' on Sun.
+        // Write the shortest decimal that reads back as 'object'.
 
-        char buffer[DBL_DIG + 20];  // buffer with headroom
+        char        buffer[32];  // "-2.2250738585072014e-308", with headroom
+        char       *end = bslalg::NumericFormatterUtil::toChars(
+                                                        buffer,
+                                                        buffer + sizeof buffer,
+                                                        object);
+        BSLS_ASSERT(end);
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(push)
-#pragma warning(disable:4996)     // suppress 'sprintf' deprecation warning
-#endif
-
-        const int len = bsl::sprintf(buffer, "%.*g", DBL_DIG + 1, object);
-        BSLS_ASSERT(len < (int) sizeof buffer);
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(pop)
+#if defined(BSLS_PLATFORM_CMP_MSVC) && BSLS_PLATFORM_CMP_VERSION < 1900
+        end = u::padExponent(buffer, end);
 #endif
 
-        stream.write(buffer, len);
+        stream.write(buffer, end - buffer);
       } break;
     }
 
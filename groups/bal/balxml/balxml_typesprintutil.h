@@ -199,6 +199,8 @@ BSLS_IDENT("$Id: $")
 #include <bdlt_time.h>
 #include <bdlt_timetz.h>
 
+#include <bslalg_numericformatterutil.h>
+
 #include <bslmf_enableif.h>
 #include <bslmf_isclass.h>
 #include <bslmf_isconvertible.h>
@@ -322,6 +324,12 @@ struct TypesPrintUtil_Imp {
         // output the result to the specified 'stream' using the specified
         // 'encoderOptions'.
 
+    template <class TYPE>
+    static bsl::ostream& printInteger(bsl::ostream& stream, TYPE value);
+        // Output the specified integral 'value' in decimal to the specified
+        // 'stream', without regard to the formatting flags or locale of
+        // 'stream', and return 'stream'.
+
                             // BASE64 FUNCTIONS
 
     template <class TYPE>
@@ -1201,6 +1209,20 @@ bsl::ostream& TypesPrintUtil::printText(bsl::ostream&         stream,
                          // struct TypesPrintUtil_Imp
                          // -------------------------
 
+// CLASS METHODS
+template <class TYPE>
+inline
+bsl::ostream& TypesPrintUtil_Imp::printInteger(bsl::ostream& stream,
+                                               TYPE          value)
+{
+    char        buffer[21];  // "-9223372036854775808", the longest 'Int64'
+    const char *end = bslalg::NumericFormatterUtil::toChars(
+                                                        buffer,
+                                                        buffer + sizeof buffer,
+                                                        value);
+    return stream.write(buffer, end - buffer);
+}
+
 // BASE64 FUNCTIONS
 
 template <class TYPE>
@@ -1312,7 +1334,7 @@ bsl::ostream& TypesPrintUtil_Imp::printDecimal(
 {
     signed char temp(object);  // Note that 'char' is unsigned on IBM.
 
-    return stream << int(temp);
+    return printInteger(stream, int(temp));
 }
 
 inline
@@ -1322,7 +1344,7 @@ bsl::ostream& TypesPrintUtil_Imp::printDecimal(
                                             const EncoderOptions       *,
                                             bdlat_TypeCategory::Simple)
 {
-    return stream << object;
+    return printInteger(stream, object);
 }
 
 inline
@@ -1332,7 +1354,7 @@ bsl::ostream& TypesPrintUtil_Imp::printDecimal(
                                             const EncoderOptions       *,
                                             bdlat_TypeCategory::Simple)
 {
-    return stream << object;
+    return printInteger(stream, object);
 }
 
 inline
@@ -1342,7 +1364,7 @@ bsl::ostream& TypesPrintUtil_Imp::printDecimal(
                                             const EncoderOptions       *,
                                             bdlat_TypeCategory::Simple)
 {
-    return stream << object;
+    return printInteger(stream, object);
 }
 
 inline
@@ -1352,7 +1374,7 @@ bsl::ostream& TypesPrintUtil_Imp::printDecimal(
                                             const EncoderOptions       *,
                                             bdlat_TypeCategory::Simple)
 {
-    return stream << object;
+    return printInteger(stream, object);
 }
 
 inline
@@ -1363,7 +1385,7 @@ bsl::ostream& TypesPrintUtil_Imp::printDecimal(
                                             bdlat_TypeCategory::Simple)
 {
     unsigned short us = object;
-    return stream << us;
+    return printInteger(stream, us);
 }
 
 inline
@@ -1373,7 +1395,7 @@ bsl::ostream& TypesPrintUtil_Imp::printDecimal(
                                             const EncoderOptions       *,
                                             bdlat_TypeCategory::Simple)
 {
-    return stream << object;
+    return printInteger(stream, object);
 }
 
 inline
@@ -1383,7 +1405,7 @@ bsl::ostream& TypesPrintUtil_Imp::printDecimal(
                                             const EncoderOptions       *,
                                             bdlat_TypeCategory::Simple)
 {
-    return stream << object;
+    return printInteger(stream, object);
 }
 
 inline
@@ -1393,7 +1415,7 @@ bsl::ostream& TypesPrintUtil_Imp::printDecimal(
                                             const EncoderOptions       *,
                                             bdlat_TypeCategory::Simple)
 {
-    return stream << object;
+    return printInteger(stream, object);
 }
 
 inline
@@ -1403,7 +1425,7 @@ bsl::ostream& TypesPrintUtil_Imp::printDecimal(
                                             const EncoderOptions       *,
                                             bdlat_TypeCategory::Simple)
 {
-    return stream << object;
+    return printInteger(stream, object);
 }
 
 // DEFAULT FUNCTIONS
@@ -1201,6 +1201,8 @@ int main(int argc, char *argv[])
                 { L_,     1.0f,           "1"                             },
                 { L_,     1234567.0f,     "1234567"                       },
                 { L_,     1.234567e35f,   "1.234567e+" ZERO "35"          },
+                { L_,     16777216.0f,    "16777216"                      },
+                { L_,     3.4028235e38f,  "3.4028235e+" ZERO "38"         },
                 { L_,     bsl::numeric_limits<float>::infinity(),
                                           "+INF"                          },
                 { L_,    -bsl::numeric_limits<float>::infinity(),
@@ -1244,6 +1246,9 @@ int main(int argc, char *argv[])
                 { L_,     1.0,        "1"              },
                 { L_,123456789012345.0, "123456789012345"},
                 { L_,1.23456789012345e105,"1.23456789012345e+105"  },
+                { L_,0.30000000000000004,"0.30000000000000004"   },
+                { L_,     1e16,       "10000000000000000"},
+                { L_,1.7976931348623157e308,"1.7976931348623157e+308"  },
                 { L_,  bsl::numeric_limits<double>::infinity(), "+INF"},
                 { L_, -bsl::numeric_limits<double>::infinity(), "-INF"},
                 { L_,  bsl::numeric_limits<double>::signaling_NaN(), "NaN"},
@@ -1346,6 +1351,31 @@ int main(int argc, char *argv[])
 #undef DFP
         }
 
+        if (verbose) cout << "\nIgnoring the state of the stream." << endl;
+        {
+            // Integral values are written in decimal, and floating-point
+            // values in their shortest round-trip form, whatever the format
+            // flags and precision of the stream.
+
+            bsl::stringstream ss;
+            ss << bsl::hex << bsl::showpos << bsl::uppercase;
+            ss.precision(3);
+
+            Util::printDefault(ss, 255);
+            ss << ' ';
+            Util::printDefault(ss, static_cast<bsls::Types::Int64>(-4096));
+            ss << ' ';
+            Util::printDefault(ss, static_cast<unsigned short>(65535));
+            ss << ' ';
+            Util::printDefault(ss, 0.1 + 0.2);
+            ss << ' ';
+            Util::printDefault(ss, 1.0f / 3);
+
+            ASSERTV(ss.str(),
+                    "255 -4096 65535 0.30000000000000004 0.33333334" ==
+                                                                     ss.str());
+        }
+
         // TBD: Currently this test case is commented out till the
         // implementation uses the encoderOptions that are passed in.
 #if 0
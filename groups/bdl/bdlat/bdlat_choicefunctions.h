@@ -18,7 +18,7 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  bdlat_ChoiceFunctions: namespace for calling choice functions
 //
-//@SEE_ALSO: bdlat_selectioninfo
+//@SEE_ALSO: bdlat_selectioninfo, bdlat_nameindex
 //
 // TBD: update this documentation to reflect the new overloaded functions
 //
@@ -41,6 +41,10 @@ BSLS_IDENT("$Id: $")
 //
 // This component specializes all of these functions for types that have the
 // 'bdlat_TypeTraitBasicChoice' trait.
+// The functions finding a selection by name find it using a precomputed
+// perfect-hash index of the selection names for types that also have the
+// 'bdlat_UsesNameIndex' trait (see 'bdlat_nameindex'), rather than calling the
+// 'makeSelection' or 'lookupSelectionInfo' member function taking a name.
 //
 // Types that do not have the 'bdlat_TypeTraitBasicChoice' trait can be plugged
 // into the 'bdlat' framework.  This is done by overloading the 'bdlat_choice*'
@@ -453,12 +457,14 @@ BSLS_IDENT("$Id: $")
 #include <bdlscm_version.h>
 
 #include <bdlat_bdeatoverrides.h>
+#include <bdlat_nameindex.h>
 #include <bdlat_selectioninfo.h>
 #include <bdlat_typetraits.h>
 
 #include <bslalg_hastrait.h>
 
 #include <bslmf_assert.h>
+#include <bslmf_integralconstant.h>
 #include <bslmf_metaint.h>
 
 #include <bsls_assert.h>
@@ -613,6 +619,51 @@ namespace bdlat_ChoiceFunctions {
 
 }  // close namespace bdlat_ChoiceFunctions
 
+                     // ================================
+                     // struct bdlat_ChoiceFunctions_Imp
+                     // ================================
+
+struct bdlat_ChoiceFunctions_Imp {
+    // This 'struct' provides the default implementations of the functions
+    // finding the selections of 'bas_codegen.pl'-generated "choice" types by
+    // name.  The overloads taking 'bsl::true_type' find the selection using
+    // the 'bdlat_NameIndex' of the type, and are used for types having the
+    // 'bdlat_UsesNameIndex' trait; the overloads taking 'bsl::false_type' call
+    // the name-based member functions of the type.
+
+    // CLASS METHODS
+    template <class TYPE>
+    static int makeSelection(TYPE           *object,
+                             const char     *selectionName,
+                             int             selectionNameLength,
+                             bsl::true_type  usesNameIndex);
+    template <class TYPE>
+    static int makeSelection(TYPE            *object,
+                             const char      *selectionName,
+                             int              selectionNameLength,
+                             bsl::false_type  usesNameIndex);
+        // Set the value of the specified 'object' to be the default for the
+        // selection indicated by the specified 'selectionName' of the
+        // specified 'selectionNameLength'.  Return 0 on success, and a
+        // non-zero value otherwise (i.e., the selection is not found).  The
+        // specified 'usesNameIndex' tag selects the implementation.
+
+    template <class TYPE>
+    static bool hasSelection(const TYPE&     object,
+                             const char     *selectionName,
+                             int             selectionNameLength,
+                             bsl::true_type  usesNameIndex);
+    template <class TYPE>
+    static bool hasSelection(const TYPE&      object,
+                             const char      *selectionName,
+                             int              selectionNameLength,
+                             bsl::false_type  usesNameIndex);
+        // Return 'true' if the specified 'object' has a selection with the
+        // specified 'selectionName' of the specified 'selectionNameLength',
+        // and 'false' otherwise.  The specified 'usesNameIndex' tag selects
+        // the implementation.
+};
+
 // ============================================================================
 //                        INLINE FUNCTION DEFINITIONS
 // ============================================================================
@@ -750,7 +801,11 @@ int bdlat_ChoiceFunctions::bdlat_choiceMakeSelection(
 {
     BSLMF_ASSERT((bslalg::HasTrait<TYPE, bdlat_TypeTraitBasicChoice>::VALUE));
 
-    return object->makeSelection(selectionName, selectionNameLength);
+    return bdlat_ChoiceFunctions_Imp::makeSelection(
+                                   object,
+                                   selectionName,
+                                   selectionNameLength,
+                                   typename bdlat_UsesNameIndex<TYPE>::type());
 }
 
 template <class TYPE, class MANIPULATOR>
@@ -791,7 +846,11 @@ bool bdlat_ChoiceFunctions::bdlat_choiceHasSelection(
 {
     BSLMF_ASSERT((bslalg::HasTrait<TYPE, bdlat_TypeTraitBasicChoice>::VALUE));
 
-    return 0 != object.lookupSelectionInfo(selectionName, selectionNameLength);
+    return bdlat_ChoiceFunctions_Imp::hasSelection(
+                                   object,
+                                   selectionName,
+                                   selectionNameLength,
+                                   typename bdlat_UsesNameIndex<TYPE>::type());
 }
 
 template <class TYPE>
@@ -808,6 +867,65 @@ bool bdlat_ChoiceFunctions::bdlat_choiceHasSelection(const TYPE& object,
 #pragma warning( pop )
 #endif
 
+                     // --------------------------------
+                     // struct bdlat_ChoiceFunctions_Imp
+                     // --------------------------------
+
+// CLASS METHODS
+template <class TYPE>
+inline
+int bdlat_ChoiceFunctions_Imp::makeSelection(
+                                           TYPE           *object,
+                                           const char     *selectionName,
+                                           int             selectionNameLength,
+                                           bsl::true_type)
+{
+    const bdlat_SelectionInfo *selectionInfo =
+                          bdlat_NameIndexUtil::lookupSelectionInfo<TYPE>(
+                                                         selectionName,
+                                                         selectionNameLength);
+    if (0 == selectionInfo) {
+        return -1;                                                    // RETURN
+    }
+
+    return object->makeSelection(selectionInfo->d_id);
+}
+
+template <class TYPE>
+inline
+int bdlat_ChoiceFunctions_Imp::makeSelection(
+                                          TYPE            *object,
+                                          const char      *selectionName,
+                                          int              selectionNameLength,
+                                          bsl::false_type)
+{
+    return object->makeSelection(selectionName, selectionNameLength);
+}
+
+template <class TYPE>
+inline
+bool bdlat_ChoiceFunctions_Imp::hasSelection(
+                                           const TYPE&,
+                                           const char     *selectionName,
+                                           int             selectionNameLength,
+                                           bsl::true_type)
+{
+    return 0 != bdlat_NameIndexUtil::lookupSelectionInfo<TYPE>(
+                                                          selectionName,
+                                                          selectionNameLength);
+}
+
+template <class TYPE>
+inline
+bool bdlat_ChoiceFunctions_Imp::hasSelection(
+                                          const TYPE&      object,
+                                          const char      *selectionName,
+                                          int              selectionNameLength,
+                                          bsl::false_type)
+{
+    return 0 != object.lookupSelectionInfo(selectionName, selectionNameLength);
+}
+
 template <class TYPE>
 inline
 int bdlat_ChoiceFunctions::bdlat_choiceSelectionId(const TYPE& object)
@@ -0,0 +1,284 @@
+// bdlat_nameindex.cpp                                                -*-C++-*-
+#include <bdlat_nameindex.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlat_nameindex_cpp,"$Id$ $CSID$")
+
+#include <bsl_algorithm.h>
+
+// IMPLEMENTATION NOTES
+// --------------------
+// The index is built using the "hash, displace, and compress" scheme: each
+// name is hashed once, and the hash is split into a bucket number and two
+// values, 'f1' and 'f2', from which the slot of the name is computed as
+// '(f1 + d * f2) mod m', where 'm' is the (power of 2) size of the table and
+// 'd' is the displacement chosen for the bucket of the name.  Buckets are
+// placed largest first, each taking the smallest displacement for which every
+// name of the bucket falls in a distinct empty slot.  Since 'f2' is odd, the
+// displacements '0 .. m - 1' take each name of a bucket to every slot of the
+// table in turn, so only the names sharing a bucket constrain one another.
+//
+// The table has at least twice as many slots as names, and there is one
+// bucket for every four slots, so that a bucket holds two names on average.
+// If some bucket cannot be placed, the index is rebuilt with another seed, and
+// after several such failures the table is doubled in size; neither happens
+// for the name sets of generated types in practice.
+
+namespace BloombergLP {
+namespace {
+
+typedef bsls::Types::Uint64 Uint64;
+
+enum {
+    k_SEEDS_PER_SIZE = 16  // seeds tried before the table is grown
+};
+
+const Uint64 k_GOLDEN_RATIO = 0x9E3779B97F4A7C15ULL;
+
+struct BucketSizeGreater {
+    // This 'struct' orders buckets by decreasing number of names, and by
+    // increasing bucket number among buckets having the same number of names.
+
+    // DATA
+    const bsl::vector<int> *d_offsets_p;  // bucket 'i' holds the names
+                                          // '[(*d_offsets_p)[i] ..
+                                          //   (*d_offsets_p)[i + 1])'
+
+    // ACCESSORS
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' bucket is to be placed before
+        // the specified 'rhs' bucket, and 'false' otherwise.
+    {
+        const bsl::vector<int>& offsets = *d_offsets_p;
+
+        const int lhsSize = offsets[lhs + 1] - offsets[lhs];
+        const int rhsSize = offsets[rhs + 1] - offsets[rhs];
+
+        return lhsSize != rhsSize ? lhsSize > rhsSize : lhs < rhs;
+    }
+};
+
+}  // close unnamed namespace
+
+                           // ---------------------
+                           // class bdlat_NameIndex
+                           // ---------------------
+
+// PRIVATE CLASS METHODS
+Uint64 bdlat_NameIndex::hash(const char *name, int nameLength, Uint64 seed)
+{
+    // The name is read in 8-byte words, the last of which overlaps the one
+    // before it if the length is not a multiple of 8; shorter names are read
+    // in two overlapping 4-byte words, or as up to 3 bytes.  Mixing in the
+    // length makes the overlapping reads unambiguous.  Fixed-size 'memcpy'
+    // calls compile to single (unaligned) loads.
+
+    const Uint64 k_MUL1 = 0xBF58476D1CE4E5B9ULL;
+    const Uint64 k_MUL2 = 0x94D049BB133111EBULL;
+
+    const char *end = name + nameLength;
+    Uint64      h   = seed
+                    ^ (static_cast<Uint64>(nameLength) * k_GOLDEN_RATIO);
+
+    if (8 <= nameLength) {
+        Uint64 word;
+        while (end - name > 8) {
+            bsl::memcpy(&word, name, 8);
+            h  = (h ^ word) * k_MUL1;
+            h ^= h >> 29;
+            name += 8;
+        }
+        bsl::memcpy(&word, end - 8, 8);
+        h  = (h ^ word) * k_MUL1;
+        h ^= h >> 29;
+    }
+    else if (4 <= nameLength) {
+        unsigned int first;
+        unsigned int last;
+        bsl::memcpy(&first, name,    4);
+        bsl::memcpy(&last,  end - 4, 4);
+        h  = (h ^ ((static_cast<Uint64>(first) << 32) | last)) * k_MUL1;
+        h ^= h >> 29;
+    }
+    else if (0 < nameLength) {
+        const Uint64 word =
+             (static_cast<Uint64>(static_cast<unsigned char>(name[0])) << 16)
+           | (static_cast<Uint64>(static_cast<unsigned char>(
+                                                   name[nameLength / 2])) << 8)
+           |  static_cast<Uint64>(static_cast<unsigned char>(end[-1]));
+        h  = (h ^ word) * k_MUL1;
+        h ^= h >> 29;
+    }
+
+    h ^= h >> 32;
+    h *= k_MUL2;
+    h ^= h >> 29;
+
+    return h;
+}
+
+// PRIVATE MANIPULATORS
+void bdlat_NameIndex::build()
+{
+    bslma::Allocator *allocator = d_slots.get_allocator().mechanism();
+
+    const bsl::vector<Slot> names(d_slots, allocator);
+
+    const int numNames = static_cast<int>(names.size());
+
+    Slot emptySlot;
+    emptySlot.d_name_p     = 0;
+    emptySlot.d_nameLength = -1;
+    emptySlot.d_position   = -1;
+
+    unsigned int tableSize = 2;
+    while (tableSize < 2u * static_cast<unsigned int>(numNames)) {
+        tableSize *= 2;
+    }
+
+    bsl::vector<Uint64> hashes(numNames, 0, allocator);
+    bsl::vector<int>    buckets(allocator);
+    bsl::vector<int>    offsets(allocator);
+    bsl::vector<int>    next(allocator);
+    bsl::vector<int>    members(numNames, 0, allocator);
+    bsl::vector<int>    order(allocator);
+    bsl::vector<int>    placed(allocator);
+
+    for (Uint64 attempt = 1; ; ++attempt) {
+        if (0 == attempt % k_SEEDS_PER_SIZE) {
+            tableSize *= 2;
+        }
+
+        const unsigned int numBuckets = tableSize >= 4 ? tableSize / 4 : 1;
+        const unsigned int slotMask   = tableSize - 1;
+        const unsigned int bucketMask = numBuckets - 1;
+
+        d_seed = attempt * k_GOLDEN_RATIO;
+
+        // Group the names by bucket, recording in 'members' the names of
+        // bucket 'i' at '[offsets[i] .. offsets[i + 1])'.
+
+        offsets.assign(numBuckets + 1, 0);
+        buckets.resize(numNames);
+        for (int i = 0; i < numNames; ++i) {
+            hashes[i]  = hash(names[i].d_name_p,
+                              names[i].d_nameLength,
+                              d_seed);
+            buckets[i] = static_cast<int>(
+                              static_cast<unsigned int>(hashes[i] >> 32)
+                            & bucketMask);
+            ++offsets[buckets[i] + 1];
+        }
+        for (unsigned int b = 0; b < numBuckets; ++b) {
+            offsets[b + 1] += offsets[b];
+        }
+        next.assign(offsets.begin(), offsets.end() - 1);
+        for (int i = 0; i < numNames; ++i) {
+            members[next[buckets[i]]++] = i;
+        }
+
+        order.resize(numBuckets);
+        for (unsigned int b = 0; b < numBuckets; ++b) {
+            order[b] = static_cast<int>(b);
+        }
+        BucketSizeGreater comparator = { &offsets };
+        bsl::sort(order.begin(), order.end(), comparator);
+
+        // Place the buckets, largest first.
+
+        d_slots.assign(tableSize, emptySlot);
+        d_displacements.assign(numBuckets, 0);
+
+        bool failed = false;
+        for (unsigned int k = 0; k < numBuckets && !failed; ++k) {
+            const int b     = order[k];
+            const int begin = offsets[b];
+            const int end   = offsets[b + 1];
+
+            if (begin == end) {
+                break;                                                 // BREAK
+            }
+
+            unsigned int d = 0;
+            for (; d < tableSize; ++d) {
+                placed.clear();
+
+                bool fits = true;
+                for (int j = begin; j < end && fits; ++j) {
+                    const Uint64       h    = hashes[members[j]];
+                    const unsigned int step = static_cast<unsigned int>(
+                                                                  h >> 20) | 1;
+                    const unsigned int slot = (static_cast<unsigned int>(h)
+                                                + d * step) & slotMask;
+
+                    if (-1 != d_slots[slot].d_nameLength) {
+                        fits = false;
+                        break;                                         // BREAK
+                    }
+
+                    bool duplicate = false;
+                    for (bsl::size_t p = 0; p < placed.size(); ++p) {
+                        if (static_cast<unsigned int>(placed[p]) != slot) {
+                            continue;                               // CONTINUE
+                        }
+
+                        const Slot& lhs = names[members[j]];
+                        const Slot& rhs = names[members[begin + p]];
+
+                        duplicate = lhs.d_nameLength == rhs.d_nameLength
+                                 && (0 == lhs.d_nameLength
+                                  || 0 == bsl::memcmp(lhs.d_name_p,
+                                                      rhs.d_name_p,
+                                                      lhs.d_nameLength));
+                        fits      = duplicate;
+                        break;                                         // BREAK
+                    }
+
+                    // A name equal to an earlier name of its bucket (and so
+                    // having the same hash) is not placed, so that 'find'
+                    // returns the first of equal names.
+
+                    placed.push_back(duplicate ? -1 : static_cast<int>(slot));
+                }
+
+                if (fits) {
+                    break;                                             // BREAK
+                }
+            }
+
+            if (d == tableSize) {
+                failed = true;
+                break;                                                 // BREAK
+            }
+
+            d_displacements[b] = d;
+            for (int j = begin; j < end; ++j) {
+                if (0 <= placed[j - begin]) {
+                    d_slots[placed[j - begin]] = names[members[j]];
+                }
+            }
+        }
+
+        if (!failed) {
+            return;                                                   // RETURN
+        }
+    }
+}
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
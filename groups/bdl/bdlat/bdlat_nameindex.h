@@ -0,0 +1,433 @@
+// bdlat_nameindex.h                                                  -*-C++-*-
+#ifndef INCLUDED_BDLAT_NAMEINDEX
+#define INCLUDED_BDLAT_NAMEINDEX
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide perfect-hash lookup of attribute and selection names.
+//
+//@CLASSES:
+//  bdlat_NameIndex: perfect-hash index of the names in an info array
+//  bdlat_UsesNameIndex: trait opting a generated type into name indexing
+//  bdlat_NameIndexUtil: per-type name indexes built on first use
+//
+//@MACROS:
+//  BDLAT_DECL_NAME_INDEX_TRAITS(ClassName): opt a generated type into indexing
+//
+//@SEE_ALSO: bdlat_sequencefunctions, bdlat_choicefunctions
+//
+//@DESCRIPTION: This component provides a class, 'bdlat_NameIndex', that maps
+// each of the names in an array of information structures (such as
+// 'bdlat_AttributeInfo' or 'bdlat_SelectionInfo') to its position in that
+// array.  The mapping is a minimal-collision ("perfect") hash table built
+// when the index is constructed: looking up a name computes one hash of the
+// name and compares the name with exactly one candidate, regardless of the
+// number of names in the index.
+//
+// This component also provides a trait, 'bdlat_UsesNameIndex', with which a
+// 'bas_codegen.pl'-generated "sequence" or "choice" type opts into looking up
+// its attributes or selections by name using such an index, and a utility,
+// 'bdlat_NameIndexUtil', that provides one index per such type, built on its
+// first use.  The name-based functions of 'bdlat_SequenceFunctions' and
+// 'bdlat_ChoiceFunctions' (e.g., 'manipulateAttribute' and 'makeSelection'
+// taking a name) consult the index of a type having the trait rather than
+// calling the type's own name lookup, which is generated as a linear search
+// comparing the name against each attribute or selection name in turn.
+// Decoders (e.g., 'baljsn::Decoder' and 'balxml::Decoder') find each element
+// of a document using these functions, so decoding into types having many
+// attributes benefits without change to the decoders.
+//
+///Opting In
+///---------
+// A type 'TYPE' may have the 'bdlat_UsesNameIndex' trait only if it is a
+// "sequence" type having the 'bdlat_TypeTraitBasicSequence' trait and
+// providing:
+//..
+//  enum { NUM_ATTRIBUTES = /* number of attributes */ };
+//  static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
+//..
+// or a "choice" type having the 'bdlat_TypeTraitBasicChoice' trait and
+// providing:
+//..
+//  enum { NUM_SELECTIONS = /* number of selections */ };
+//  static const bdlat_SelectionInfo SELECTION_INFO_ARRAY[];
+//..
+// and only if looking up an attribute (selection) by name is equivalent to
+// finding the element of the array having that name and looking up the
+// attribute (selection) by the 'd_id' of that element.  All types generated
+// by 'bas_codegen.pl' meet these requirements except sequences having no
+// attributes (which have no 'ATTRIBUTE_INFO_ARRAY') and sequences having
+// anonymous (untagged) choice attributes (whose lookup by name also finds the
+// selections of those choices).  The trait is declared at 'BloombergLP'
+// namespace scope, next to the 'bdlat_typetraits' macro declaring the
+// category of the type, using the 'BDLAT_DECL_NAME_INDEX_TRAITS' macro:
+//..
+//  BDLAT_DECL_SEQUENCE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(mine::MySequence)
+//  BDLAT_DECL_NAME_INDEX_TRAITS(mine::MySequence)
+//..
+// or within the class definition:
+//..
+//  BSLMF_NESTED_TRAIT_DECLARATION(MySequence, bdlat_UsesNameIndex);
+//..
+//
+///Thread Safety
+///-------------
+// 'bdlat_NameIndex' is *const* *thread-safe*.  The indexes provided by
+// 'bdlat_NameIndexUtil' are built exactly once, and may be used concurrently
+// from multiple threads.  The memory of those indexes is supplied by
+// 'bslma::NewDeleteAllocator' and is never released.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Indexing the Attributes of a Sequence
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have the attribute information of a sequence type, as generated
+// by 'bas_codegen.pl', and we want to find attributes by name.
+//
+// First, we define the attribute information:
+//..
+//  const bdlat_AttributeInfo ATTRIBUTES[] = {
+//      { 1, "name",        4, "", bdlat_FormattingMode::e_TEXT },
+//      { 2, "homeAddress", 11, "", bdlat_FormattingMode::e_DEFAULT },
+//      { 3, "age",         3, "", bdlat_FormattingMode::e_DEC }
+//  };
+//..
+// Then, we create an index of the names of the attributes:
+//..
+//  const bdlat_NameIndex index(ATTRIBUTES, 3);
+//  assert(3 == index.numNames());
+//..
+// Finally, we look up names, obtaining the position of the attribute having
+// the name in 'ATTRIBUTES', or -1 if there is no such attribute:
+//..
+//  assert( 2 == index.find("age",         3));
+//  assert( 1 == index.find("homeAddress", 11));
+//  assert( 0 == index.find("name",        4));
+//  assert(-1 == index.find("nam",         3));
+//  assert(-1 == index.find("salary",      6));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlat_attributeinfo.h>
+#include <bdlat_selectioninfo.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_detectnestedtrait.h>
+#include <bslmf_integralconstant.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_once.h>
+
+#include <bsls_assert.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_types.h>
+
+#include <bsl_cstring.h>
+#include <bsl_vector.h>
+
+                               // =============
+                               // Macro Support
+                               // =============
+
+#define BDLAT_DECL_NAME_INDEX_TRAITS(ClassName)                               \
+    template <>                                                               \
+    struct bdlat_UsesNameIndex<ClassName> : bsl::true_type { };
+    // Declare that the specified 'ClassName' has the 'bdlat_UsesNameIndex'
+    // trait.  This macro shall be used at 'BloombergLP' namespace scope.
+
+namespace BloombergLP {
+
+                           // =====================
+                           // class bdlat_NameIndex
+                           // =====================
+
+class bdlat_NameIndex {
+    // This class provides a perfect-hash index mapping each of a set of
+    // distinct names to its position in the array of information structures
+    // from which the index was built.  The names themselves are not copied;
+    // the array must outlive the index.
+
+    // PRIVATE TYPES
+    struct Slot {
+        // A 'Slot' holds one entry of the hash table.
+
+        const char *d_name_p;      // name, or 0 if the slot is empty
+        int         d_nameLength;  // length of the name, or -1 if empty
+        int         d_position;    // position of the name in the info array
+    };
+
+    // DATA
+    bsl::vector<Slot>         d_slots;          // hash table, a power of 2
+                                                // in size
+
+    bsl::vector<unsigned int> d_displacements;  // per-bucket displacement,
+                                                // a power of 2 in size
+
+    bsls::Types::Uint64       d_seed;           // seed of the hash function
+
+    int                       d_numNames;       // number of indexed names
+
+    // PRIVATE CLASS METHODS
+    static bsls::Types::Uint64 hash(const char          *name,
+                                    int                  nameLength,
+                                    bsls::Types::Uint64  seed);
+        // Return the hash of the specified 'name' having the specified
+        // 'nameLength', computed using the specified 'seed'.
+
+    // PRIVATE MANIPULATORS
+    void build();
+        // Build the hash table from the names in 'd_slots', which holds
+        // 'd_numNames' names in the order of their positions.
+
+    // NOT IMPLEMENTED
+    bdlat_NameIndex(const bdlat_NameIndex&);
+    bdlat_NameIndex& operator=(const bdlat_NameIndex&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(bdlat_NameIndex, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    template <class INFO>
+    bdlat_NameIndex(const INFO       *infoArray,
+                    int               numInfos,
+                    bslma::Allocator *basicAllocator = 0);
+        // Create an index of the names of the specified 'numInfos' elements of
+        // the specified 'infoArray'.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.  'INFO' shall have the data
+        // members 'const char *d_name_p' and 'int d_nameLength' (e.g.,
+        // 'bdlat_AttributeInfo' and 'bdlat_SelectionInfo').  If several
+        // elements have the same name, the index maps that name to the first
+        // of them.  The behavior is undefined unless '0 <= numInfos',
+        // 'infoArray' has at least 'numInfos' elements, and 'infoArray'
+        // outlives this object.
+
+    //! ~bdlat_NameIndex() = default;
+        // Destroy this object.
+
+    // ACCESSORS
+    int find(const char *name, int nameLength) const;
+        // Return the position, in the array from which this index was built,
+        // of the element having the specified 'name' of the specified
+        // 'nameLength', or -1 if there is no such element.  The behavior is
+        // undefined unless '0 <= nameLength' and 'name' refers to at least
+        // 'nameLength' characters.
+
+    int numNames() const;
+        // Return the number of names in this index.
+
+    int tableSize() const;
+        // Return the number of slots in the hash table of this index.  Note
+        // that this method is provided for testing.
+};
+
+                         // ==========================
+                         // struct bdlat_UsesNameIndex
+                         // ==========================
+
+template <class TYPE>
+struct bdlat_UsesNameIndex
+: bslmf::DetectNestedTrait<TYPE, bdlat_UsesNameIndex>::type {
+    // This trait is 'true' for "sequence" and "choice" types whose attributes
+    // or selections are to be looked up by name using a 'bdlat_NameIndex'.
+    // See {Opting In} for the requirements on such types.
+};
+
+                         // ==========================
+                         // struct bdlat_NameIndexUtil
+                         // ==========================
+
+struct bdlat_NameIndexUtil {
+    // This 'struct' provides a namespace for functions providing the name
+    // indexes of types having the 'bdlat_UsesNameIndex' trait.
+
+    // CLASS METHODS
+    template <class TYPE>
+    static const bdlat_NameIndex& attributeIndex();
+        // Return a reference to the index of the attribute names of the
+        // (template parameter) 'TYPE', building the index if this is the
+        // first call for 'TYPE'.  'TYPE' shall be a "sequence" type meeting
+        // the requirements described in {Opting In}.
+
+    template <class TYPE>
+    static const bdlat_NameIndex& selectionIndex();
+        // Return a reference to the index of the selection names of the
+        // (template parameter) 'TYPE', building the index if this is the
+        // first call for 'TYPE'.  'TYPE' shall be a "choice" type meeting the
+        // requirements described in {Opting In}.
+
+    template <class TYPE>
+    static const bdlat_AttributeInfo *lookupAttributeInfo(
+                                                      const char *name,
+                                                      int         nameLength);
+        // Return the address of the information of the attribute of the
+        // (template parameter) 'TYPE' having the specified 'name' of the
+        // specified 'nameLength', or 0 if there is no such attribute.  'TYPE'
+        // shall be a "sequence" type meeting the requirements described in
+        // {Opting In}.
+
+    template <class TYPE>
+    static const bdlat_SelectionInfo *lookupSelectionInfo(
+                                                      const char *name,
+                                                      int         nameLength);
+        // Return the address of the information of the selection of the
+        // (template parameter) 'TYPE' having the specified 'name' of the
+        // specified 'nameLength', or 0 if there is no such selection.  'TYPE'
+        // shall be a "choice" type meeting the requirements described in
+        // {Opting In}.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                           // ---------------------
+                           // class bdlat_NameIndex
+                           // ---------------------
+
+// CREATORS
+template <class INFO>
+bdlat_NameIndex::bdlat_NameIndex(const INFO       *infoArray,
+                                 int               numInfos,
+                                 bslma::Allocator *basicAllocator)
+: d_slots(basicAllocator)
+, d_displacements(basicAllocator)
+, d_seed(0)
+, d_numNames(numInfos)
+{
+    BSLS_ASSERT(0 <= numInfos);
+    BSLS_ASSERT(infoArray || 0 == numInfos);
+
+    d_slots.resize(numInfos);
+    for (int i = 0; i < numInfos; ++i) {
+        d_slots[i].d_name_p     = infoArray[i].d_name_p;
+        d_slots[i].d_nameLength = infoArray[i].d_nameLength;
+        d_slots[i].d_position   = i;
+    }
+
+    build();
+}
+
+// ACCESSORS
+inline
+int bdlat_NameIndex::find(const char *name, int nameLength) const
+{
+    BSLS_ASSERT_SAFE(0 <= nameLength);
+    BSLS_ASSERT_SAFE(name || 0 == nameLength);
+
+    const bsls::Types::Uint64 h = hash(name, nameLength, d_seed);
+
+    const unsigned int bucket = static_cast<unsigned int>(h >> 32)
+                              & static_cast<unsigned int>(
+                                                  d_displacements.size() - 1);
+    const unsigned int step   = static_cast<unsigned int>(h >> 20) | 1;
+    const unsigned int index  = (static_cast<unsigned int>(h)
+                                 + d_displacements[bucket] * step)
+                              & static_cast<unsigned int>(d_slots.size() - 1);
+
+    const Slot& slot = d_slots[index];
+
+    return nameLength == slot.d_nameLength
+        && (0 == nameLength
+         || 0 == bsl::memcmp(name, slot.d_name_p, nameLength))
+           ? slot.d_position
+           : -1;
+}
+
+inline
+int bdlat_NameIndex::numNames() const
+{
+    return d_numNames;
+}
+
+inline
+int bdlat_NameIndex::tableSize() const
+{
+    return static_cast<int>(d_slots.size());
+}
+
+                         // --------------------------
+                         // struct bdlat_NameIndexUtil
+                         // --------------------------
+
+// CLASS METHODS
+template <class TYPE>
+const bdlat_NameIndex& bdlat_NameIndexUtil::attributeIndex()
+{
+    static bsls::ObjectBuffer<bdlat_NameIndex> s_index;
+
+    BSLMT_ONCE_DO {
+        bslma::ConstructionUtil::construct(
+                                      s_index.address(),
+                                      &bslma::NewDeleteAllocator::singleton(),
+                                      TYPE::ATTRIBUTE_INFO_ARRAY,
+                                      static_cast<int>(TYPE::NUM_ATTRIBUTES));
+    }
+
+    return s_index.object();
+}
+
+template <class TYPE>
+const bdlat_NameIndex& bdlat_NameIndexUtil::selectionIndex()
+{
+    static bsls::ObjectBuffer<bdlat_NameIndex> s_index;
+
+    BSLMT_ONCE_DO {
+        bslma::ConstructionUtil::construct(
+                                      s_index.address(),
+                                      &bslma::NewDeleteAllocator::singleton(),
+                                      TYPE::SELECTION_INFO_ARRAY,
+                                      static_cast<int>(TYPE::NUM_SELECTIONS));
+    }
+
+    return s_index.object();
+}
+
+template <class TYPE>
+inline
+const bdlat_AttributeInfo *bdlat_NameIndexUtil::lookupAttributeInfo(
+                                                       const char *name,
+                                                       int         nameLength)
+{
+    const int position = attributeIndex<TYPE>().find(name, nameLength);
+    return 0 <= position ? TYPE::ATTRIBUTE_INFO_ARRAY + position : 0;
+}
+
+template <class TYPE>
+inline
+const bdlat_SelectionInfo *bdlat_NameIndexUtil::lookupSelectionInfo(
+                                                       const char *name,
+                                                       int         nameLength)
+{
+    const int position = selectionIndex<TYPE>().find(name, nameLength);
+    return 0 <= position ? TYPE::SELECTION_INFO_ARRAY + position : 0;
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
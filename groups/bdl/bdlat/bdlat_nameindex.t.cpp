@@ -0,0 +1,1320 @@
+// bdlat_nameindex.t.cpp                                              -*-C++-*-
+#include <bdlat_nameindex.h>
+
+#include <bdlat_attributeinfo.h>
+#include <bdlat_choicefunctions.h>
+#include <bdlat_formattingmode.h>
+#include <bdlat_selectioninfo.h>
+#include <bdlat_sequencefunctions.h>
+#include <bdlat_typetraits.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides a perfect-hash index of names, a trait,
+// and a utility providing one index per type having the trait.  The index is
+// tested by building it from tables of names chosen to exercise the hash
+// (empty names, names sharing long prefixes, names differing only in their
+// last character or in case) and from sets of random names of every size up
+// to several hundred, and checking that every name is found at its position
+// and that names not in the set are not found.  The utility is tested through
+// 'bdlat_SequenceFunctions' and 'bdlat_ChoiceFunctions', using test types that
+// count calls to their own name lookup to verify which implementation is used.
+// ----------------------------------------------------------------------------
+// bdlat_NameIndex
+// [ 2] bdlat_NameIndex(const INFO *, int, bslma::Allocator * = 0);
+// [ 2] int find(const char *name, int nameLength) const;
+// [ 2] int numNames() const;
+// [ 2] int tableSize() const;
+//
+// bdlat_UsesNameIndex
+// [ 4] bdlat_UsesNameIndex<TYPE>
+// [ 4] BDLAT_DECL_NAME_INDEX_TRAITS(ClassName)
+//
+// bdlat_NameIndexUtil
+// [ 4] const bdlat_NameIndex& attributeIndex<TYPE>();
+// [ 4] const bdlat_NameIndex& selectionIndex<TYPE>();
+// [ 4] const bdlat_AttributeInfo *lookupAttributeInfo<TYPE>(const char *,int);
+// [ 4] const bdlat_SelectionInfo *lookupSelectionInfo<TYPE>(const char *,int);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] RANDOM NAME SETS
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE: INDEXED VS. LINEAR LOOKUP
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlat_NameIndex Obj;
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct NameInfo {
+    // This 'struct' provides the members of an information structure that are
+    // used by 'bdlat_NameIndex'.
+
+    const char *d_name_p;
+    int         d_nameLength;
+};
+
+int linearFind(const bsl::vector<NameInfo>&  infos,
+               const char                   *name,
+               int                           nameLength)
+    // Return the position of the first element of the specified 'infos'
+    // having the specified 'name' of the specified 'nameLength', or -1 if
+    // there is no such element.
+{
+    for (int i = 0; i < static_cast<int>(infos.size()); ++i) {
+        if (nameLength == infos[i].d_nameLength
+         && 0 == bsl::memcmp(name, infos[i].d_name_p, nameLength)) {
+            return i;                                                 // RETURN
+        }
+    }
+    return -1;
+}
+
+bool isPowerOfTwo(int value)
+    // Return 'true' if the specified 'value' is a positive power of 2, and
+    // 'false' otherwise.
+{
+    return 0 < value && 0 == (value & (value - 1));
+}
+
+unsigned int nextRandom(unsigned int *state)
+    // Advance the specified linear congruential generator 'state', and return
+    // its new value.
+{
+    *state = *state * 1103515245u + 12345u;
+    return *state >> 8;
+}
+
+void makeRandomNames(bsl::vector<bsl::string> *names,
+                     int                       numNames,
+                     unsigned int             *state)
+    // Load into the specified 'names' the specified 'numNames' distinct names
+    // of lengths from 0 to 24 drawn from a small alphabet, using the specified
+    // random 'state'.
+{
+    static const char ALPHABET[] = "abcdeABC_1";
+
+    names->clear();
+    while (static_cast<int>(names->size()) < numNames) {
+        const int   length = static_cast<int>(nextRandom(state) % 25);
+        bsl::string name;
+        for (int i = 0; i < length; ++i) {
+            name.push_back(ALPHABET[nextRandom(state) % 10]);
+        }
+        if (names->end() == bsl::find(names->begin(), names->end(), name)) {
+            names->push_back(name);
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                         TEST TYPES
+// ----------------------------------------------------------------------------
+
+namespace test {
+
+                              // ===========
+                              // class Point
+                              // ===========
+
+class Point {
+    // This class is a "sequence" type in the form generated by
+    // 'bas_codegen.pl', having three attributes.  It counts the calls to its
+    // own name-based lookup.
+
+    // DATA
+    int d_x;
+    int d_y;
+    int d_z;
+
+  public:
+    // TYPES
+    enum {
+        ATTRIBUTE_ID_X = 10,
+        ATTRIBUTE_ID_Y = 20,
+        ATTRIBUTE_ID_Z = 30
+    };
+
+    enum { NUM_ATTRIBUTES = 3 };
+
+    // CONSTANTS
+    static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
+
+    // CLASS DATA
+    static int s_numNameLookups;  // calls to 'lookupAttributeInfo' by name
+
+    // CLASS METHODS
+    static const bdlat_AttributeInfo *lookupAttributeInfo(int id)
+        // Return attribute information for the attribute indicated by the
+        // specified 'id' if the attribute exists, and 0 otherwise.
+    {
+        switch (id) {
+          case ATTRIBUTE_ID_X: return &ATTRIBUTE_INFO_ARRAY[0];
+          case ATTRIBUTE_ID_Y: return &ATTRIBUTE_INFO_ARRAY[1];
+          case ATTRIBUTE_ID_Z: return &ATTRIBUTE_INFO_ARRAY[2];
+        }
+        return 0;
+    }
+
+    static const bdlat_AttributeInfo *lookupAttributeInfo(
+                                                       const char *name,
+                                                       int         nameLength)
+        // Return attribute information for the attribute indicated by the
+        // specified 'name' of the specified 'nameLength' if the attribute
+        // exists, and 0 otherwise.
+    {
+        ++s_numNameLookups;
+        for (int i = 0; i < NUM_ATTRIBUTES; ++i) {
+            const bdlat_AttributeInfo& info = ATTRIBUTE_INFO_ARRAY[i];
+            if (nameLength == info.d_nameLength
+             && 0 == bsl::memcmp(info.d_name_p, name, nameLength)) {
+                return &info;                                         // RETURN
+            }
+        }
+        return 0;
+    }
+
+    // CREATORS
+    Point() : d_x(0), d_y(0), d_z(0) {}
+        // Create a 'Point' having all attributes 0.
+
+    // MANIPULATORS
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR& manipulator, int id)
+        // Invoke the specified 'manipulator' on the attribute indicated by
+        // the specified 'id', and return the value returned by the
+        // invocation, or -1 if there is no such attribute.
+    {
+        switch (id) {
+          case ATTRIBUTE_ID_X:
+            return manipulator(&d_x, ATTRIBUTE_INFO_ARRAY[0]);        // RETURN
+          case ATTRIBUTE_ID_Y:
+            return manipulator(&d_y, ATTRIBUTE_INFO_ARRAY[1]);        // RETURN
+          case ATTRIBUTE_ID_Z:
+            return manipulator(&d_z, ATTRIBUTE_INFO_ARRAY[2]);        // RETURN
+        }
+        return -1;
+    }
+
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR&  manipulator,
+                            const char   *name,
+                            int           nameLength)
+        // Invoke the specified 'manipulator' on the attribute indicated by
+        // the specified 'name' of the specified 'nameLength', and return the
+        // value returned by the invocation, or -1 if there is no such
+        // attribute.
+    {
+        const bdlat_AttributeInfo *info = lookupAttributeInfo(name,
+                                                              nameLength);
+        return info ? manipulateAttribute(manipulator, info->d_id) : -1;
+    }
+
+    template <class MANIPULATOR>
+    int manipulateAttributes(MANIPULATOR& manipulator);
+        // Not implemented.
+
+    // ACCESSORS
+    template <class ACCESSOR>
+    int accessAttribute(ACCESSOR& accessor, int id) const
+        // Invoke the specified 'accessor' on the attribute indicated by the
+        // specified 'id', and return the value returned by the invocation, or
+        // -1 if there is no such attribute.
+    {
+        switch (id) {
+          case ATTRIBUTE_ID_X:
+            return accessor(d_x, ATTRIBUTE_INFO_ARRAY[0]);            // RETURN
+          case ATTRIBUTE_ID_Y:
+            return accessor(d_y, ATTRIBUTE_INFO_ARRAY[1]);            // RETURN
+          case ATTRIBUTE_ID_Z:
+            return accessor(d_z, ATTRIBUTE_INFO_ARRAY[2]);            // RETURN
+        }
+        return -1;
+    }
+
+    template <class ACCESSOR>
+    int accessAttribute(ACCESSOR&   accessor,
+                        const char *name,
+                        int         nameLength) const
+        // Invoke the specified 'accessor' on the attribute indicated by the
+        // specified 'name' of the specified 'nameLength', and return the
+        // value returned by the invocation, or -1 if there is no such
+        // attribute.
+    {
+        const bdlat_AttributeInfo *info = lookupAttributeInfo(name,
+                                                              nameLength);
+        return info ? accessAttribute(accessor, info->d_id) : -1;
+    }
+
+    template <class ACCESSOR>
+    int accessAttributes(ACCESSOR& accessor) const;
+        // Not implemented.
+};
+
+const bdlat_AttributeInfo Point::ATTRIBUTE_INFO_ARRAY[] = {
+    { ATTRIBUTE_ID_X, "x",      1, "", bdlat_FormattingMode::e_DEC },
+    { ATTRIBUTE_ID_Y, "y",      1, "", bdlat_FormattingMode::e_DEC },
+    { ATTRIBUTE_ID_Z, "height", 6, "", bdlat_FormattingMode::e_DEC }
+};
+
+int Point::s_numNameLookups = 0;
+
+                           // ==================
+                           // class IndexedPoint
+                           // ==================
+
+class IndexedPoint : public Point {
+    // This class is a 'Point' having the 'bdlat_UsesNameIndex' trait,
+    // declared within the class.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(IndexedPoint, bdlat_IsBasicSequence);
+    BSLMF_NESTED_TRAIT_DECLARATION(IndexedPoint, bdlat_UsesNameIndex);
+};
+
+                            // ================
+                            // class PlainPoint
+                            // ================
+
+class PlainPoint : public Point {
+    // This class is a 'Point' not having the 'bdlat_UsesNameIndex' trait.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(PlainPoint, bdlat_IsBasicSequence);
+};
+
+                              // ============
+                              // class Choice
+                              // ============
+
+class Choice {
+    // This class is a "choice" type in the form generated by
+    // 'bas_codegen.pl', having two selections.  It counts the calls to its
+    // own name-based lookup.
+
+    // DATA
+    int d_selectionId;
+
+  public:
+    // TYPES
+    enum {
+        SELECTION_ID_UNDEFINED = -1,
+        SELECTION_ID_NUMBER    = 0,
+        SELECTION_ID_TEXT      = 1
+    };
+
+    enum { NUM_SELECTIONS = 2 };
+
+    // CONSTANTS
+    static const bdlat_SelectionInfo SELECTION_INFO_ARRAY[];
+
+    // CLASS DATA
+    static int s_numNameLookups;  // calls to 'lookupSelectionInfo' by name
+
+    // CLASS METHODS
+    static const bdlat_SelectionInfo *lookupSelectionInfo(int id)
+        // Return selection information for the selection indicated by the
+        // specified 'id' if the selection exists, and 0 otherwise.
+    {
+        return 0 <= id && id < NUM_SELECTIONS ? &SELECTION_INFO_ARRAY[id] : 0;
+    }
+
+    static const bdlat_SelectionInfo *lookupSelectionInfo(
+                                                       const char *name,
+                                                       int         nameLength)
+        // Return selection information for the selection indicated by the
+        // specified 'name' of the specified 'nameLength' if the selection
+        // exists, and 0 otherwise.
+    {
+        ++s_numNameLookups;
+        for (int i = 0; i < NUM_SELECTIONS; ++i) {
+            const bdlat_SelectionInfo& info = SELECTION_INFO_ARRAY[i];
+            if (nameLength == info.d_nameLength
+             && 0 == bsl::memcmp(info.d_name_p, name, nameLength)) {
+                return &info;                                         // RETURN
+            }
+        }
+        return 0;
+    }
+
+    // CREATORS
+    Choice() : d_selectionId(SELECTION_ID_UNDEFINED) {}
+        // Create a 'Choice' having no selection.
+
+    // MANIPULATORS
+    int makeSelection(int selectionId)
+        // Make the selection indicated by the specified 'selectionId'.
+        // Return 0 on success, and -1 if there is no such selection.
+    {
+        if (0 == lookupSelectionInfo(selectionId)) {
+            return -1;                                                // RETURN
+        }
+        d_selectionId = selectionId;
+        return 0;
+    }
+
+    int makeSelection(const char *name, int nameLength)
+        // Make the selection indicated by the specified 'name' of the
+        // specified 'nameLength'.  Return 0 on success, and -1 if there is no
+        // such selection.
+    {
+        const bdlat_SelectionInfo *info = lookupSelectionInfo(name,
+                                                              nameLength);
+        return info ? makeSelection(info->d_id) : -1;
+    }
+
+    // ACCESSORS
+    int selectionId() const
+        // Return the id of the current selection.
+    {
+        return d_selectionId;
+    }
+};
+
+const bdlat_SelectionInfo Choice::SELECTION_INFO_ARRAY[] = {
+    { SELECTION_ID_NUMBER, "number", 6, "", bdlat_FormattingMode::e_DEC },
+    { SELECTION_ID_TEXT,   "text",   4, "", bdlat_FormattingMode::e_TEXT }
+};
+
+int Choice::s_numNameLookups = 0;
+
+                           // ===================
+                           // class IndexedChoice
+                           // ===================
+
+class IndexedChoice : public Choice {
+    // This class is a 'Choice' having the 'bdlat_UsesNameIndex' trait,
+    // declared using 'BDLAT_DECL_NAME_INDEX_TRAITS'.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(IndexedChoice, bdlat_IsBasicChoice);
+};
+
+                            // =================
+                            // class PlainChoice
+                            // =================
+
+class PlainChoice : public Choice {
+    // This class is a 'Choice' not having the 'bdlat_UsesNameIndex' trait.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(PlainChoice, bdlat_IsBasicChoice);
+};
+
+                          // =====================
+                          // struct SetManipulator
+                          // =====================
+
+struct SetManipulator {
+    // This manipulator sets an 'int' attribute to a value.
+
+    // DATA
+    int d_value;  // value to set
+
+    // MANIPULATORS
+    int operator()(int *attribute, const bdlat_AttributeInfo&)
+        // Set the specified 'attribute' to 'd_value', and return 0.
+    {
+        *attribute = d_value;
+        return 0;
+    }
+};
+
+                           // ==================
+                           // struct GetAccessor
+                           // ==================
+
+struct GetAccessor {
+    // This accessor loads the value of an 'int' attribute.
+
+    // DATA
+    int d_value;  // value loaded
+
+    // MANIPULATORS
+    int operator()(const int& attribute, const bdlat_AttributeInfo&)
+        // Load the specified 'attribute' into 'd_value', and return 0.
+    {
+        d_value = attribute;
+        return 0;
+    }
+};
+
+}  // close namespace test
+
+namespace BloombergLP {
+
+BDLAT_DECL_NAME_INDEX_TRAITS(test::IndexedChoice)
+
+}  // close enterprise namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose             = argc > 2;
+    const bool veryVerbose         = argc > 3;
+    const bool veryVeryVerbose     = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         defaultAllocator("default",
+                                                  veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, replace 'assert' with
+        //:   'ASSERT', and insert 'if (veryVerbose)' before all output
+        //:   operations.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Indexing the Attributes of a Sequence
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have the attribute information of a sequence type, as generated
+// by 'bas_codegen.pl', and we want to find attributes by name.
+//
+// First, we define the attribute information:
+//..
+    const bdlat_AttributeInfo ATTRIBUTES[] = {
+        { 1, "name",        4, "", bdlat_FormattingMode::e_TEXT },
+        { 2, "homeAddress", 11, "", bdlat_FormattingMode::e_DEFAULT },
+        { 3, "age",         3, "", bdlat_FormattingMode::e_DEC }
+    };
+//..
+// Then, we create an index of the names of the attributes:
+//..
+    const bdlat_NameIndex index(ATTRIBUTES, 3);
+    ASSERT(3 == index.numNames());
+//..
+// Finally, we look up names, obtaining the position of the attribute having
+// the name in 'ATTRIBUTES', or -1 if there is no such attribute:
+//..
+    ASSERT( 2 == index.find("age",         3));
+    ASSERT( 1 == index.find("homeAddress", 11));
+    ASSERT( 0 == index.find("name",        4));
+    ASSERT(-1 == index.find("nam",         3));
+    ASSERT(-1 == index.find("salary",      6));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING THE TRAIT AND THE PER-TYPE INDEXES
+        //
+        // Concerns:
+        //: 1 'bdlat_UsesNameIndex' is 'false' by default, and 'true' for a
+        //:   type declaring it within the class or using
+        //:   'BDLAT_DECL_NAME_INDEX_TRAITS'.
+        //:
+        //: 2 'attributeIndex' and 'selectionIndex' return the same index on
+        //:   every call for a type, built from the info array of the type.
+        //:
+        //: 3 'lookupAttributeInfo' and 'lookupSelectionInfo' return the
+        //:   address of the info array element having the name, or 0.
+        //:
+        //: 4 The name-based functions of 'bdlat_SequenceFunctions' and
+        //:   'bdlat_ChoiceFunctions' use the index for types having the trait,
+        //:   and the name lookup of the type otherwise, with identical
+        //:   results.
+        //:
+        //: 5 The indexes do not use the default allocator.
+        //
+        // Plan:
+        //: 1 Check the trait for the test types.  (C-1)
+        //:
+        //: 2 Compare the addresses of the indexes returned by repeated calls,
+        //:   and look up every name and several absent names.  (C-2..3)
+        //:
+        //: 3 Manipulate, access, and test for the attributes of sequences,
+        //:   and make and test for the selections of choices, by name, using
+        //:   one type of each kind with and one without the trait, and check
+        //:   the results and the number of calls to the lookup of the type.
+        //:   (C-4)
+        //:
+        //: 4 Check that the default allocator is not used.  (C-5)
+        //
+        // Testing:
+        //   bdlat_UsesNameIndex<TYPE>
+        //   BDLAT_DECL_NAME_INDEX_TRAITS(ClassName)
+        //   const bdlat_NameIndex& attributeIndex<TYPE>();
+        //   const bdlat_NameIndex& selectionIndex<TYPE>();
+        //   const bdlat_AttributeInfo *lookupAttributeInfo<TYPE>(...);
+        //   const bdlat_SelectionInfo *lookupSelectionInfo<TYPE>(...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING THE TRAIT AND THE PER-TYPE INDEXES"
+                          << endl
+                          << "=========================================="
+                          << endl;
+
+        using namespace test;
+
+        typedef bdlat_NameIndexUtil Util;
+
+        if (verbose) cout << "\nTesting the trait." << endl;
+        {
+            BSLMF_ASSERT(!bdlat_UsesNameIndex<int>::value);
+            BSLMF_ASSERT(!bdlat_UsesNameIndex<Point>::value);
+            BSLMF_ASSERT(!bdlat_UsesNameIndex<PlainPoint>::value);
+            BSLMF_ASSERT(!bdlat_UsesNameIndex<Choice>::value);
+            BSLMF_ASSERT(!bdlat_UsesNameIndex<PlainChoice>::value);
+            BSLMF_ASSERT( bdlat_UsesNameIndex<IndexedPoint>::value);
+            BSLMF_ASSERT( bdlat_UsesNameIndex<IndexedChoice>::value);
+        }
+
+        if (verbose) cout << "\nTesting the per-type indexes." << endl;
+        {
+            const bdlat_NameIndex& X = Util::attributeIndex<IndexedPoint>();
+            ASSERT(&X == &Util::attributeIndex<IndexedPoint>());
+            ASSERT(3  == X.numNames());
+
+            const bdlat_NameIndex& Y = Util::selectionIndex<IndexedChoice>();
+            ASSERT(&Y == &Util::selectionIndex<IndexedChoice>());
+            ASSERT(2  == Y.numNames());
+            ASSERT(&X != &Y);
+
+            const bdlat_AttributeInfo *ATTRS = Point::ATTRIBUTE_INFO_ARRAY;
+
+            ASSERT(ATTRS + 0 ==
+                     Util::lookupAttributeInfo<IndexedPoint>("x",      1));
+            ASSERT(ATTRS + 1 ==
+                     Util::lookupAttributeInfo<IndexedPoint>("y",      1));
+            ASSERT(ATTRS + 2 ==
+                     Util::lookupAttributeInfo<IndexedPoint>("height", 6));
+            ASSERT(0 == Util::lookupAttributeInfo<IndexedPoint>("z",   1));
+            ASSERT(0 == Util::lookupAttributeInfo<IndexedPoint>("",    0));
+            ASSERT(0 == Util::lookupAttributeInfo<IndexedPoint>("xy",  2));
+
+            const bdlat_SelectionInfo *SELS = Choice::SELECTION_INFO_ARRAY;
+
+            ASSERT(SELS + 0 ==
+                     Util::lookupSelectionInfo<IndexedChoice>("number", 6));
+            ASSERT(SELS + 1 ==
+                     Util::lookupSelectionInfo<IndexedChoice>("text",   4));
+            ASSERT(0 == Util::lookupSelectionInfo<IndexedChoice>("tex", 3));
+        }
+
+        if (verbose) cout << "\nTesting 'bdlat_SequenceFunctions'." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_name_p;
+                int         d_expected;  // -1 if not an attribute
+            } DATA[] = {
+                //LINE  NAME       EXP
+                //----  ---------  ---
+                { L_,   "x",         0 },
+                { L_,   "y",         1 },
+                { L_,   "height",    2 },
+                { L_,   "z",        -1 },
+                { L_,   "X",        -1 },
+                { L_,   "",         -1 },
+                { L_,   "heigh",    -1 },
+                { L_,   "heights",  -1 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE     = DATA[ti].d_line;
+                const char *NAME     = DATA[ti].d_name_p;
+                const int   LENGTH   = static_cast<int>(bsl::strlen(NAME));
+                const int   EXPECTED = DATA[ti].d_expected;
+
+                if (veryVerbose) { T_ P_(LINE) P(NAME) }
+
+                for (int indexed = 0; indexed < 2; ++indexed) {
+                    IndexedPoint mI;  const IndexedPoint& I = mI;
+                    PlainPoint   mP;  const PlainPoint&   P = mP;
+
+                    Point& mX = indexed ? static_cast<Point&>(mI) : mP;
+
+                    SetManipulator setter = { 7 };
+                    GetAccessor    getter = { -9 };
+
+                    Point::s_numNameLookups = 0;
+
+                    const int rcM = indexed
+                            ? bdlat_SequenceFunctions::manipulateAttribute(
+                                                                      &mI,
+                                                                      setter,
+                                                                      NAME,
+                                                                      LENGTH)
+                            : bdlat_SequenceFunctions::manipulateAttribute(
+                                                                      &mP,
+                                                                      setter,
+                                                                      NAME,
+                                                                      LENGTH);
+                    const int rcA = indexed
+                            ? bdlat_SequenceFunctions::accessAttribute(I,
+                                                                       getter,
+                                                                       NAME,
+                                                                       LENGTH)
+                            : bdlat_SequenceFunctions::accessAttribute(P,
+                                                                       getter,
+                                                                       NAME,
+                                                                       LENGTH);
+                    const bool has = indexed
+                            ? bdlat_SequenceFunctions::hasAttribute(I,
+                                                                    NAME,
+                                                                    LENGTH)
+                            : bdlat_SequenceFunctions::hasAttribute(P,
+                                                                    NAME,
+                                                                    LENGTH);
+
+                    ASSERTV(LINE, indexed, rcM, (0 <= EXPECTED) == (0 == rcM));
+                    ASSERTV(LINE, indexed, rcA, (0 <= EXPECTED) == (0 == rcA));
+                    ASSERTV(LINE, indexed, has, (0 <= EXPECTED) == has);
+                    ASSERTV(LINE, indexed, getter.d_value,
+                            (0 <= EXPECTED ? 7 : -9) == getter.d_value);
+                    ASSERTV(LINE, indexed, Point::s_numNameLookups,
+                            (indexed ? 0 : 3) == Point::s_numNameLookups);
+
+                    if (0 <= EXPECTED) {
+                        GetAccessor check = { -1 };
+                        mX.accessAttribute(check,
+                                 Point::ATTRIBUTE_INFO_ARRAY[EXPECTED].d_id);
+                        ASSERTV(LINE, indexed, 7 == check.d_value);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'bdlat_ChoiceFunctions'." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_name_p;
+                int         d_expected;  // -1 if not a selection
+            } DATA[] = {
+                //LINE  NAME       EXP
+                //----  ---------  ---
+                { L_,   "number",    0 },
+                { L_,   "text",      1 },
+                { L_,   "Text",     -1 },
+                { L_,   "",         -1 },
+                { L_,   "numbers",  -1 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE     = DATA[ti].d_line;
+                const char *NAME     = DATA[ti].d_name_p;
+                const int   LENGTH   = static_cast<int>(bsl::strlen(NAME));
+                const int   EXPECTED = DATA[ti].d_expected;
+
+                if (veryVerbose) { T_ P_(LINE) P(NAME) }
+
+                for (int indexed = 0; indexed < 2; ++indexed) {
+                    IndexedChoice mI;  const IndexedChoice& I = mI;
+                    PlainChoice   mP;  const PlainChoice&   P = mP;
+
+                    Choice::s_numNameLookups = 0;
+
+                    const int rc = indexed
+                            ? bdlat_ChoiceFunctions::makeSelection(&mI,
+                                                                   NAME,
+                                                                   LENGTH)
+                            : bdlat_ChoiceFunctions::makeSelection(&mP,
+                                                                   NAME,
+                                                                   LENGTH);
+                    const bool has = indexed
+                            ? bdlat_ChoiceFunctions::hasSelection(I,
+                                                                  NAME,
+                                                                  LENGTH)
+                            : bdlat_ChoiceFunctions::hasSelection(P,
+                                                                  NAME,
+                                                                  LENGTH);
+                    const int id = indexed ? I.selectionId()
+                                           : P.selectionId();
+
+                    ASSERTV(LINE, indexed, rc, (0 <= EXPECTED) == (0 == rc));
+                    ASSERTV(LINE, indexed, has, (0 <= EXPECTED) == has);
+                    ASSERTV(LINE, indexed, id,
+                            (0 <= EXPECTED ? EXPECTED
+                                           : Choice::SELECTION_ID_UNDEFINED)
+                                                                       == id);
+                    ASSERTV(LINE, indexed, Choice::s_numNameLookups,
+                            (indexed ? 0 : 2) == Choice::s_numNameLookups);
+                }
+            }
+        }
+
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // RANDOM NAME SETS
+        //
+        // Concerns:
+        //: 1 An index can be built for any set of distinct names, and finds
+        //:   every name of the set at its position.
+        //:
+        //: 2 Names not in the set are not found.
+        //:
+        //: 3 The table has between twice and (typically) four times as many
+        //:   slots as there are names.
+        //
+        // Plan:
+        //: 1 For every number of names up to 64, and for several larger
+        //:   numbers, build indexes of sets of random names drawn from a
+        //:   small alphabet, so that names often share prefixes and lengths.
+        //:   Look up every name, and random names, comparing the results with
+        //:   a linear search.  (C-1..2)
+        //:
+        //: 2 Build indexes of the names generated for numbered elements
+        //:   (e.g., "selection1" .. "selection500"), which differ in few
+        //:   characters.  (C-1..2)
+        //:
+        //: 3 Check the size of each table.  (C-3)
+        //
+        // Testing:
+        //   RANDOM NAME SETS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "RANDOM NAME SETS" << endl
+                          << "================" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        unsigned int state = 12345;
+
+        bsl::vector<int> sizes;
+        for (int n = 1; n <= 64; ++n) {
+            sizes.push_back(n);
+        }
+        sizes.push_back(100);
+        sizes.push_back(127);
+        sizes.push_back(128);
+        sizes.push_back(129);
+        sizes.push_back(300);
+        sizes.push_back(1000);
+
+        if (verbose) cout << "\nTesting sets of random names." << endl;
+
+        for (bsl::size_t si = 0; si < sizes.size(); ++si) {
+            const int NUM_NAMES = sizes[si];
+
+            for (int trial = 0; trial < 4; ++trial) {
+                bsl::vector<bsl::string> names;
+                makeRandomNames(&names, NUM_NAMES, &state);
+
+                bsl::vector<NameInfo> infos(NUM_NAMES);
+                for (int i = 0; i < NUM_NAMES; ++i) {
+                    infos[i].d_name_p     = names[i].data();
+                    infos[i].d_nameLength = static_cast<int>(
+                                                            names[i].size());
+                }
+
+                const Obj X(infos.data(), NUM_NAMES, &sa);
+
+                ASSERTV(NUM_NAMES, NUM_NAMES == X.numNames());
+                ASSERTV(NUM_NAMES, X.tableSize(),
+                        isPowerOfTwo(X.tableSize()));
+                ASSERTV(NUM_NAMES, X.tableSize(),
+                        2 * NUM_NAMES <= X.tableSize());
+                ASSERTV(NUM_NAMES, X.tableSize(),
+                        X.tableSize() <= 8 * NUM_NAMES);
+
+                for (int i = 0; i < NUM_NAMES; ++i) {
+                    ASSERTV(NUM_NAMES, names[i], i,
+                            i == X.find(names[i].data(),
+                                        static_cast<int>(names[i].size())));
+                }
+
+                bsl::vector<bsl::string> others;
+                makeRandomNames(&others, 50, &state);
+                for (bsl::size_t i = 0; i < others.size(); ++i) {
+                    const int LENGTH = static_cast<int>(others[i].size());
+                    ASSERTV(NUM_NAMES, others[i],
+                            linearFind(infos, others[i].data(), LENGTH) ==
+                                           X.find(others[i].data(), LENGTH));
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting sets of numbered names." << endl;
+
+        for (bsl::size_t si = 0; si < sizes.size(); ++si) {
+            const int NUM_NAMES = sizes[si];
+
+            bsl::vector<bsl::string> names;
+            for (int i = 0; i <= NUM_NAMES; ++i) {
+                char buffer[32];
+                bsl::sprintf(buffer, "selection%d", i + 1);
+                names.push_back(buffer);
+            }
+
+            bsl::vector<NameInfo> infos(NUM_NAMES);
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                infos[i].d_name_p     = names[i].data();
+                infos[i].d_nameLength = static_cast<int>(names[i].size());
+            }
+
+            const Obj X(infos.data(), NUM_NAMES, &sa);
+
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                ASSERTV(NUM_NAMES, names[i], i,
+                        i == X.find(names[i].data(),
+                                    static_cast<int>(names[i].size())));
+            }
+
+            // The name following the last one is not in the index.
+
+            const bsl::string& ABSENT = names[NUM_NAMES];
+            ASSERTV(NUM_NAMES, ABSENT,
+                    -1 == X.find(ABSENT.data(),
+                                 static_cast<int>(ABSENT.size())));
+        }
+
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'bdlat_NameIndex'
+        //
+        // Concerns:
+        //: 1 An index of no names finds no name.
+        //:
+        //: 2 Every name is found at its position, including the empty name,
+        //:   names longer than 8 characters, and names differing from
+        //:   another only in their last character or in case.
+        //:
+        //: 3 Prefixes and extensions of names, and names differing in case,
+        //:   are not found.
+        //:
+        //: 4 Of equal names, the first is found.
+        //:
+        //: 5 Memory is supplied by the supplied allocator, or by the default
+        //:   allocator if none is supplied, and is released on destruction.
+        //:
+        //: 6 'numNames' returns the number of names and 'tableSize' a power
+        //:   of 2 at least twice as large.
+        //:
+        //: 7 'find' does not read a name past its length.
+        //:
+        //: 8 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, build indexes of several sets
+        //:   of names, and look up every name and a set of names not in the
+        //:   set.  (C-1..4, 6)
+        //:
+        //: 2 Build the indexes using a test allocator and the default
+        //:   allocator, and check the allocators.  (C-5)
+        //:
+        //: 3 Look up names held in buffers of exactly their length, followed
+        //:   by unrelated characters, and check the results.  (C-7)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for argument values.  (C-8)
+        //
+        // Testing:
+        //   bdlat_NameIndex(const INFO *, int, bslma::Allocator * = 0);
+        //   int find(const char *name, int nameLength) const;
+        //   int numNames() const;
+        //   int tableSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'bdlat_NameIndex'" << endl
+                          << "=========================" << endl;
+
+        static const char *const SET_EMPTY[] = { 0 };
+        static const char *const SET_ONE[] = { "a", 0 };
+        static const char *const SET_BLANK[] = { "", 0 };
+        static const char *const SET_MIXED[] = {
+            "", "a", "b", "ab", "ba", "abc", "Abc", "aBC", 0
+        };
+        static const char *const SET_LONG[] = {
+            "abcdefgh", "abcdefghi", "abcdefghij", "abcdefgh0",
+            "abcdefghabcdefgh", "abcdefghabcdefgi", "bbcdefghabcdefgh",
+            "theQuickBrownFoxJumpsOverTheLazyDog", 0
+        };
+        static const char *const SET_DUPLICATE[] = {
+            "one", "two", "one", "three", "two", 0
+        };
+
+        static const struct {
+            int                d_line;
+            const char *const *d_names_p;
+        } DATA[] = {
+            { L_, SET_EMPTY     },
+            { L_, SET_ONE       },
+            { L_, SET_BLANK     },
+            { L_, SET_MIXED     },
+            { L_, SET_LONG      },
+            { L_, SET_DUPLICATE },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        static const char *const ABSENT[] = {
+            "", "A", "c", "aa", "abcd", "ABC", "abcdefg", "abcdefgH",
+            "abcdefghabcdefg", "abcdefghabcdefghi", "theQuickBrownFox",
+            "on", "ones", "four"
+        };
+        const int NUM_ABSENT = sizeof ABSENT / sizeof *ABSENT;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int          LINE  = DATA[ti].d_line;
+            const char *const *NAMES = DATA[ti].d_names_p;
+
+            bsl::vector<NameInfo> infos;
+            for (const char *const *name = NAMES; *name; ++name) {
+                NameInfo info = { *name,
+                                  static_cast<int>(bsl::strlen(*name)) };
+                infos.push_back(info);
+            }
+            const int NUM_NAMES = static_cast<int>(infos.size());
+
+            if (veryVerbose) { T_ P_(LINE) P(NUM_NAMES) }
+
+            for (char cfg = 'a'; cfg <= 'b'; ++cfg) {
+                const char CONFIG = cfg;
+
+                bslma::TestAllocator da("default",   veryVeryVeryVerbose);
+                bslma::TestAllocator fa("footprint", veryVeryVeryVerbose);
+                bslma::TestAllocator sa("supplied",  veryVeryVeryVerbose);
+
+                bslma::DefaultAllocatorGuard dag(&da);
+
+                bslma::TestAllocator& oa = 'a' == CONFIG ? da : sa;
+                bslma::TestAllocator& noa = 'a' == CONFIG ? sa : da;
+
+                {
+                    Obj *objPtr = 'a' == CONFIG
+                                ? new (fa) Obj(infos.data(), NUM_NAMES)
+                                : new (fa) Obj(infos.data(), NUM_NAMES, &sa);
+                    const Obj& X = *objPtr;
+
+                    ASSERTV(LINE, CONFIG, NUM_NAMES == X.numNames());
+                    ASSERTV(LINE, CONFIG, X.tableSize(),
+                            isPowerOfTwo(X.tableSize()));
+                    ASSERTV(LINE, CONFIG, X.tableSize(),
+                            2 * NUM_NAMES <= X.tableSize());
+
+                    ASSERTV(LINE, CONFIG, 0 < oa.numBlocksInUse());
+                    ASSERTV(LINE, CONFIG, 0 == noa.numBlocksTotal());
+
+                    for (int i = 0; i < NUM_NAMES; ++i) {
+                        const int LENGTH = infos[i].d_nameLength;
+
+                        // Copy the name to a buffer of exactly its length,
+                        // and to a buffer followed by more characters.
+
+                        bsl::vector<char> exact(infos[i].d_name_p,
+                                                infos[i].d_name_p + LENGTH);
+                        bsl::string       longer(infos[i].d_name_p, LENGTH);
+                        longer += "xyz";
+
+                        const int EXP = linearFind(infos,
+                                                   infos[i].d_name_p,
+                                                   LENGTH);
+                        ASSERTV(LINE, CONFIG, i, EXP <= i);
+                        ASSERTV(LINE, CONFIG, i, EXP,
+                                EXP == X.find(exact.data(), LENGTH));
+                        ASSERTV(LINE, CONFIG, i, EXP,
+                                EXP == X.find(longer.data(), LENGTH));
+                    }
+
+                    for (int i = 0; i < NUM_ABSENT; ++i) {
+                        const int LENGTH = static_cast<int>(
+                                                       bsl::strlen(ABSENT[i]));
+                        const int EXP    = linearFind(infos,
+                                                      ABSENT[i],
+                                                      LENGTH);
+                        ASSERTV(LINE, CONFIG, ABSENT[i], EXP,
+                                EXP == X.find(ABSENT[i], LENGTH));
+                    }
+
+                    fa.deleteObject(objPtr);
+                }
+
+                ASSERTV(LINE, CONFIG, 0 == fa.numBlocksInUse());
+                ASSERTV(LINE, CONFIG, 0 == da.numBlocksInUse());
+                ASSERTV(LINE, CONFIG, 0 == sa.numBlocksInUse());
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const NameInfo INFOS[] = { { "a", 1 } };
+
+            ASSERT_PASS(Obj(INFOS, 1));
+            ASSERT_PASS(Obj(INFOS, 0));
+            ASSERT_PASS(Obj(static_cast<const NameInfo *>(0), 0));
+            ASSERT_FAIL(Obj(INFOS, -1));
+            ASSERT_FAIL(Obj(static_cast<const NameInfo *>(0), 1));
+
+            const Obj X(INFOS, 1);
+
+            ASSERT_SAFE_PASS(X.find("a", 1));
+            ASSERT_SAFE_PASS(X.find("a", 0));
+            ASSERT_SAFE_PASS(X.find(0,   0));
+            ASSERT_SAFE_FAIL(X.find("a", -1));
+            ASSERT_SAFE_FAIL(X.find(0,   1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Build an index of a few names, and look up those names and a few
+        //:   others.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const bdlat_SelectionInfo SELECTIONS[] = {
+            { 5, "red",   3, "", bdlat_FormattingMode::e_DEFAULT },
+            { 6, "green", 5, "", bdlat_FormattingMode::e_DEFAULT },
+            { 7, "blue",  4, "", bdlat_FormattingMode::e_DEFAULT }
+        };
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        const Obj X(SELECTIONS, 3, &sa);
+
+        ASSERT(3 == X.numNames());
+        ASSERT(0 == X.find("red",   3));
+        ASSERT(1 == X.find("green", 5));
+        ASSERT(2 == X.find("blue",  4));
+
+        ASSERT(-1 == X.find("Red",  3));
+        ASSERT(-1 == X.find("gree", 4));
+        ASSERT(-1 == X.find("",     0));
+
+        const Obj Y(SELECTIONS, 0, &sa);
+
+        ASSERT( 0 == Y.numNames());
+        ASSERT(-1 == Y.find("red",  3));
+        ASSERT(-1 == Y.find("",     0));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: INDEXED VS. LINEAR LOOKUP
+        //
+        // Concerns:
+        //: 1 Looking up a name in an index is faster than the linear search
+        //:   of generated types for all but the smallest sets of names.
+        //
+        // Plan:
+        //: 1 For sets of numbered names of several sizes, time looking up
+        //:   every name repeatedly using an index and using a linear search,
+        //:   and report the time per lookup.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: INDEXED VS. LINEAR LOOKUP
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: INDEXED VS. LINEAR LOOKUP" << endl
+                          << "======================================" << endl;
+
+        static const int SIZES[] = { 2, 5, 10, 20, 50, 100, 200 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        const int NUM_LOOKUPS = argc > 2 ? atoi(argv[2]) : 10000000;
+
+        cout << "  names   linear (ns)   indexed (ns)" << endl;
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const int NUM_NAMES = SIZES[si];
+
+            bsl::vector<bsl::string> names;
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                char buffer[32];
+                bsl::sprintf(buffer, "attributeName%d", i + 1);
+                names.push_back(buffer);
+            }
+
+            bsl::vector<NameInfo> infos(NUM_NAMES);
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                infos[i].d_name_p     = names[i].data();
+                infos[i].d_nameLength = static_cast<int>(names[i].size());
+            }
+
+            const Obj X(infos.data(), NUM_NAMES);
+
+            bsls::Stopwatch timer;
+            long            sum = 0;
+
+            timer.start();
+            for (int i = 0; i < NUM_LOOKUPS; ++i) {
+                const bsl::string& NAME = names[i % NUM_NAMES];
+                sum += linearFind(infos,
+                                  NAME.data(),
+                                  static_cast<int>(NAME.size()));
+            }
+            timer.stop();
+            const double linear = timer.accumulatedWallTime();
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_LOOKUPS; ++i) {
+                const bsl::string& NAME = names[i % NUM_NAMES];
+                sum -= X.find(NAME.data(), static_cast<int>(NAME.size()));
+            }
+            timer.stop();
+            const double indexed = timer.accumulatedWallTime();
+
+            ASSERTV(sum, 0 == sum);
+
+            bsl::printf("  %5d   %11.1f   %12.1f\n",
+                        NUM_NAMES,
+                        linear  * 1e9 / NUM_LOOKUPS,
+                        indexed * 1e9 / NUM_LOOKUPS);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -18,7 +18,7 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  bdlat_SequenceFunctions: namespace for calling sequence functions
 //
-//@SEE_ALSO: bdlat_attributeinfo
+//@SEE_ALSO: bdlat_attributeinfo, bdlat_nameindex
 //
 //@DESCRIPTION: The 'bdlat_SequenceFunctions' 'namespace' provided in this
 // component defines parameterized functions that expose "sequence" behavior
@@ -41,6 +41,11 @@ BSLS_IDENT("$Id: $")
 //
 // This component specializes all of these functions for types that have the
 // 'bdlat_TypeTraitBasicSequence' trait.
+// The functions finding an attribute by name find it using a precomputed
+// perfect-hash index of the attribute names for types that also have the
+// 'bdlat_UsesNameIndex' trait (see 'bdlat_nameindex'), rather than calling the
+// 'manipulateAttribute', 'accessAttribute', or 'lookupAttributeInfo' member
+// function taking a name.
 //
 // Types that do not have the 'bdlat_TypeTraitBasicSequence' trait can be
 // plugged into the 'bdlat' framework.  This is done by overloading the
@@ -582,12 +587,15 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlscm_version.h>
 
+#include <bdlat_attributeinfo.h>
 #include <bdlat_bdeatoverrides.h>
+#include <bdlat_nameindex.h>
 #include <bdlat_typetraits.h>
 
 #include <bslalg_hastrait.h>
 
 #include <bslmf_assert.h>
+#include <bslmf_integralconstant.h>
 #include <bslmf_matchanytype.h>
 #include <bslmf_metaint.h>
 
@@ -772,6 +780,77 @@ namespace bdlat_SequenceFunctions {
 
 }  // close namespace bdlat_SequenceFunctions
 
+                    // ==================================
+                    // struct bdlat_SequenceFunctions_Imp
+                    // ==================================
+
+struct bdlat_SequenceFunctions_Imp {
+    // This 'struct' provides the default implementations of the functions
+    // finding the attributes of 'bas_codegen.pl'-generated "sequence" types by
+    // name.  The overloads taking 'bsl::true_type' find the attribute using
+    // the 'bdlat_NameIndex' of the type, and are used for types having the
+    // 'bdlat_UsesNameIndex' trait; the overloads taking 'bsl::false_type' call
+    // the name-based member functions of the type.
+
+    // CLASS METHODS
+    template <class TYPE, class MANIPULATOR>
+    static int manipulateAttribute(TYPE           *object,
+                                   MANIPULATOR&    manipulator,
+                                   const char     *attributeName,
+                                   int             attributeNameLength,
+                                   bsl::true_type  usesNameIndex);
+    template <class TYPE, class MANIPULATOR>
+    static int manipulateAttribute(TYPE            *object,
+                                   MANIPULATOR&     manipulator,
+                                   const char      *attributeName,
+                                   int              attributeNameLength,
+                                   bsl::false_type  usesNameIndex);
+        // Invoke the specified 'manipulator' on the address of the
+        // (modifiable) attribute indicated by the specified 'attributeName'
+        // of the specified 'attributeNameLength' of the specified 'object',
+        // supplying 'manipulator' with the corresponding attribute
+        // information structure.  Return the value returned from the
+        // invocation of 'manipulator' if 'attributeName' identifies an
+        // attribute of 'object', and a non-zero value otherwise.  The
+        // specified 'usesNameIndex' tag selects the implementation.
+
+    template <class TYPE, class ACCESSOR>
+    static int accessAttribute(const TYPE&     object,
+                               ACCESSOR&       accessor,
+                               const char     *attributeName,
+                               int             attributeNameLength,
+                               bsl::true_type  usesNameIndex);
+    template <class TYPE, class ACCESSOR>
+    static int accessAttribute(const TYPE&      object,
+                               ACCESSOR&        accessor,
+                               const char      *attributeName,
+                               int              attributeNameLength,
+                               bsl::false_type  usesNameIndex);
+        // Invoke the specified 'accessor' on the (non-modifiable) attribute
+        // of the specified 'object' indicated by the specified
+        // 'attributeName' of the specified 'attributeNameLength', supplying
+        // 'accessor' with the corresponding attribute information structure.
+        // Return the value returned from the invocation of 'accessor' if
+        // 'attributeName' identifies an attribute of 'object', and a non-zero
+        // value otherwise.  The specified 'usesNameIndex' tag selects the
+        // implementation.
+
+    template <class TYPE>
+    static bool hasAttribute(const TYPE&     object,
+                             const char     *attributeName,
+                             int             attributeNameLength,
+                             bsl::true_type  usesNameIndex);
+    template <class TYPE>
+    static bool hasAttribute(const TYPE&      object,
+                             const char      *attributeName,
+                             int              attributeNameLength,
+                             bsl::false_type  usesNameIndex);
+        // Return 'true' if the specified 'object' has an attribute with the
+        // specified 'attributeName' of the specified 'attributeNameLength',
+        // and 'false' otherwise.  The specified 'usesNameIndex' tag selects
+        // the implementation.
+};
+
 // ============================================================================
 //                        INLINE FUNCTION DEFINITIONS
 // ============================================================================
@@ -933,9 +1012,12 @@ int bdlat_SequenceFunctions::bdlat_sequenceManipulateAttribute(
     BSLMF_ASSERT(
                 (bslalg::HasTrait<TYPE, bdlat_TypeTraitBasicSequence>::VALUE));
 
-    return object->manipulateAttribute(manipulator,
-                                       attributeName,
-                                       attributeNameLength);
+    return bdlat_SequenceFunctions_Imp::manipulateAttribute(
+                                   object,
+                                   manipulator,
+                                   attributeName,
+                                   attributeNameLength,
+                                   typename bdlat_UsesNameIndex<TYPE>::type());
 }
 
 template <class TYPE, class MANIPULATOR>
@@ -976,9 +1058,12 @@ int bdlat_SequenceFunctions::bdlat_sequenceAccessAttribute(
     BSLMF_ASSERT(
                 (bslalg::HasTrait<TYPE, bdlat_TypeTraitBasicSequence>::VALUE));
 
-    return object.accessAttribute(accessor,
-                                  attributeName,
-                                  attributeNameLength);
+    return bdlat_SequenceFunctions_Imp::accessAttribute(
+                                   object,
+                                   accessor,
+                                   attributeName,
+                                   attributeNameLength,
+                                   typename bdlat_UsesNameIndex<TYPE>::type());
 }
 
 template <class TYPE, class ACCESSOR>
@@ -1020,7 +1105,11 @@ bool bdlat_SequenceFunctions::bdlat_sequenceHasAttribute(
     BSLMF_ASSERT(
                 (bslalg::HasTrait<TYPE, bdlat_TypeTraitBasicSequence>::VALUE));
 
-    return 0 != object.lookupAttributeInfo(attributeName, attributeNameLength);
+    return bdlat_SequenceFunctions_Imp::hasAttribute(
+                                   object,
+                                   attributeName,
+                                   attributeNameLength,
+                                   typename bdlat_UsesNameIndex<TYPE>::type());
 }
 
 template <class TYPE>
@@ -1038,6 +1127,103 @@ bool bdlat_SequenceFunctions::bdlat_sequenceHasAttribute(
 #pragma warning( pop )
 #endif
 
+                    // ----------------------------------
+                    // struct bdlat_SequenceFunctions_Imp
+                    // ----------------------------------
+
+// CLASS METHODS
+template <class TYPE, class MANIPULATOR>
+inline
+int bdlat_SequenceFunctions_Imp::manipulateAttribute(
+                                           TYPE           *object,
+                                           MANIPULATOR&    manipulator,
+                                           const char     *attributeName,
+                                           int             attributeNameLength,
+                                           bsl::true_type)
+{
+    const bdlat_AttributeInfo *attributeInfo =
+                          bdlat_NameIndexUtil::lookupAttributeInfo<TYPE>(
+                                                         attributeName,
+                                                         attributeNameLength);
+    if (0 == attributeInfo) {
+        return -1;                                                    // RETURN
+    }
+
+    return object->manipulateAttribute(manipulator, attributeInfo->d_id);
+}
+
+template <class TYPE, class MANIPULATOR>
+inline
+int bdlat_SequenceFunctions_Imp::manipulateAttribute(
+                                          TYPE            *object,
+                                          MANIPULATOR&     manipulator,
+                                          const char      *attributeName,
+                                          int              attributeNameLength,
+                                          bsl::false_type)
+{
+    return object->manipulateAttribute(manipulator,
+                                       attributeName,
+                                       attributeNameLength);
+}
+
+template <class TYPE, class ACCESSOR>
+inline
+int bdlat_SequenceFunctions_Imp::accessAttribute(
+                                           const TYPE&     object,
+                                           ACCESSOR&       accessor,
+                                           const char     *attributeName,
+                                           int             attributeNameLength,
+                                           bsl::true_type)
+{
+    const bdlat_AttributeInfo *attributeInfo =
+                          bdlat_NameIndexUtil::lookupAttributeInfo<TYPE>(
+                                                         attributeName,
+                                                         attributeNameLength);
+    if (0 == attributeInfo) {
+        return -1;                                                    // RETURN
+    }
+
+    return object.accessAttribute(accessor, attributeInfo->d_id);
+}
+
+template <class TYPE, class ACCESSOR>
+inline
+int bdlat_SequenceFunctions_Imp::accessAttribute(
+                                          const TYPE&      object,
+                                          ACCESSOR&        accessor,
+                                          const char      *attributeName,
+                                          int              attributeNameLength,
+                                          bsl::false_type)
+{
+    return object.accessAttribute(accessor,
+                                  attributeName,
+                                  attributeNameLength);
+}
+
+template <class TYPE>
+inline
+bool bdlat_SequenceFunctions_Imp::hasAttribute(
+                                           const TYPE&,
+                                           const char     *attributeName,
+                                           int             attributeNameLength,
+                                           bsl::true_type)
+{
+    return 0 != bdlat_NameIndexUtil::lookupAttributeInfo<TYPE>(
+                                                          attributeName,
+                                                          attributeNameLength);
+}
+
+template <class TYPE>
+inline
+bool bdlat_SequenceFunctions_Imp::hasAttribute(
+                                          const TYPE&      object,
+                                          const char      *attributeName,
+                                          int              attributeNameLength,
+                                          bsl::false_type)
+{
+    return 0 != object.lookupAttributeInfo(attributeName, attributeNameLength);
+}
+
 }  // close enterprise namespace
 
 #endif
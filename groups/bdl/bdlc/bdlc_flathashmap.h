@@ -0,0 +1,1336 @@
+// bdlc_flathashmap.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHMAP
+#define INCLUDED_BDLC_FLATHASHMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed unordered map container.
+//
+//@CLASSES:
+//  bdlc::FlatHashMap: open-addressed unordered map container
+//  bdlc::FlatHashMap_EntryUtil: 'bdlc::FlatHashTable' entry utility for maps
+//
+//@SEE_ALSO: bdlc_flathashtable, bdlc_flathashset, bslstl_unorderedmap
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::FlatHashMap', that implements an open-addressed unordered map of
+// items with unique keys.
+//
+// Unordered maps are useful in situations when there is no meaningful way to
+// order key values, when the order of the values is irrelevant to the problem
+// domain, or (even if there is a meaningful ordering) the value of ordering
+// the results is outweighed by the higher performance provided by unordered
+// maps (compared to ordered maps).
+//
+// The implementation of 'bdlc::FlatHashMap' stores its entries in a single
+// contiguous array of slots, and inspects the control bytes of a group of 16
+// slots at once (using SSE2 instructions where available) to locate the slot
+// of a key (see 'bdlc_flathashtable').  Compared to 'bsl::unordered_map',
+// which allocates a node for each element and chains the nodes of a bucket,
+// 'bdlc::FlatHashMap' performs no allocation on insertion unless it must
+// grow, and a lookup typically reads a single group of control bytes and a
+// single entry.  The trade-offs are weaker guarantees: every change in
+// capacity invalidates all iterators, pointers, and references to entries,
+// and the maximum load factor (7/8) is not configurable.  'bdlc::FlatHashMap'
+// is therefore a drop-in choice for hot lookup tables whose entries are not
+// referred to across insertions.
+//
+// The default hash functor of 'bdlc::FlatHashMap' is 'bslh::Hash<>', whose
+// results have well-distributed bits, as required by the table (see
+// 'bdlc_flathashtable').  A client supplying a 'HASH' whose results lack
+// that property (e.g., 'bsl::hash<int>') should wrap it in a
+// 'bslh::FibonacciBadHashWrapper'.
+//
+// The 'value_type' of 'bdlc::FlatHashMap' is 'bsl::pair<KEY, VALUE>', and not
+// 'bsl::pair<const KEY, VALUE>' as for 'bsl::unordered_map', since the entries
+// of the map are moved when the map grows.  The behavior is undefined if the
+// key of an entry is modified through an iterator or reference.
+//
+///Requirements on 'KEY' and 'VALUE'
+///---------------------------------
+// The (template parameter) types 'KEY' and 'VALUE' must be copy or move
+// constructible, and, if they are allocator-aware, must use 'bslma'
+// allocators.  'VALUE' must be default constructible to use 'operator[]'.
+// The 'KEY' and 'VALUE' types must be equality comparable to use the
+// equality operators of 'bdlc::FlatHashMap'.
+//
+///Exception Safety
+///----------------
+// A 'bdlc::FlatHashMap' is exception neutral, and all of the methods of
+// 'bdlc::FlatHashMap' provide the basic exception safety guarantee (see
+// {'bsldoc_glossary'|Basic Guarantee}).
+//
+///Performance
+///-----------
+// Test case -1 of the test driver of this component compares the time taken
+// by 'bdlc::FlatHashMap' and 'bsl::unordered_map' to insert, find (with and
+// without success), and erase a set of integer and string keys.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Gathering Document Statistics
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose one wished to gather statistics on the words appearing in a large
+// set of documents on disk or in a database.  Gathering those statistics is
+// intrusive (as one is competing for access to the documents with the regular
+// users) and must be done as quickly as possible.  Moreover, the set of unique
+// words appearing in those documents may be high.  The English language has
+// in excess of a million words (albeit many appear infrequently), and, if the
+// documents contain serial numbers, or Social Security numbers, or chemical
+// formulas, etc., then the 'O[log(n)]' insertion time of ordered maps may
+// well be inadequate.  An unordered map, having an 'O[1]' typical access
+// cost, is a much better choice, and an open-addressed map that does not
+// allocate per entry is better still.
+//
+// First, we define the type of map used to count the words:
+//..
+//  typedef bdlc::FlatHashMap<bsl::string, int> WordTally;
+//..
+// Next, we define the documents to be processed (with the most common words
+// of the English language elided):
+//..
+//  const char *documents[] = {
+//      " fast decent efficient  allocators  ...",
+//      " map ordered  unordered map  value type ...",
+//      " fast map lookups require fast hashing ...",
+//  };
+//  const int numDocuments = sizeof documents / sizeof *documents;
+//..
+// Then, we create the map, and, by calling 'operator[]', which
+// default-constructs (to 0) the count of a word not yet seen, we tally the
+// occurrences of each word:
+//..
+//  WordTally tally;
+//
+//  for (int i = 0; i < numDocuments; ++i) {
+//      bsl::istringstream in(documents[i]);
+//      bsl::string        word;
+//
+//      while (in >> word) {
+//          if ("..." != word) {
+//              ++tally[word];
+//          }
+//      }
+//  }
+//..
+// Finally, we verify the counts of a few words, and confirm that the map
+// contains the expected number of unique words:
+//..
+//  assert(3  == tally["fast"]);
+//  assert(3  == tally["map"]);
+//  assert(1  == tally["hashing"]);
+//  assert(0  == tally.count("elided"));
+//  assert(12 == tally.size());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlc_flathashtable.h>
+
+#include <bslh_hash.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_destructorguard.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslstl_stdexceptutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_objectbuffer.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_utility.h>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+#include <bsl_initializer_list.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                        // ============================
+                        // struct FlatHashMap_EntryUtil
+                        // ============================
+
+template <class KEY, class VALUE, class ENTRY>
+struct FlatHashMap_EntryUtil {
+    // This templated utility provides methods to construct an 'ENTRY' and a
+    // method to extract the key from an 'ENTRY', as required by
+    // 'bdlc::FlatHashTable'.  'ENTRY' must be 'bsl::pair<KEY, VALUE>'.
+
+    // CLASS METHODS
+    static void constructFromKey(ENTRY            *entry,
+                                 bslma::Allocator *allocator,
+                                 const KEY&        key);
+    static void constructFromKey(ENTRY                  *entry,
+                                 bslma::Allocator       *allocator,
+                                 bslmf::MovableRef<KEY>  key);
+        // Load into the specified 'entry' the 'ENTRY' value comprised of the
+        // specified 'key' and a default constructed 'VALUE', using the
+        // specified 'allocator' to supply memory.  'allocator' is ignored if
+        // the (template parameter) type 'ENTRY' is not allocator aware.
+
+    static const KEY& key(const ENTRY& entry);
+        // Return the key of the specified 'entry'.
+};
+
+                            // =================
+                            // class FlatHashMap
+                            // =================
+
+template <class KEY,
+          class VALUE,
+          class HASH  = bslh::Hash<>,
+          class EQUAL = bsl::equal_to<KEY> >
+class FlatHashMap {
+    // This class template implements a value-semantic container type holding
+    // an unordered map of 'KEY' to 'VALUE' entries having unique keys,
+    // stored in an open-addressed hash table.  The (template parameter)
+    // types 'HASH' and 'EQUAL' are the hash and key-equality functors.
+
+    // PRIVATE TYPES
+    typedef FlatHashTable<KEY,
+                          bsl::pair<KEY, VALUE>,
+                          FlatHashMap_EntryUtil<KEY,
+                                                VALUE,
+                                                bsl::pair<KEY, VALUE> >,
+                          HASH,
+                          EQUAL> ImplType;
+        // This is the underlying implementation class.
+
+    typedef bslmf::MovableRefUtil MoveUtil;
+
+    // FRIENDS
+    template <class K, class V, class H, class E>
+    friend bool operator==(const FlatHashMap<K, V, H, E>&,
+                           const FlatHashMap<K, V, H, E>&);
+
+    // DATA
+    ImplType d_impl;  // underlying flat hash table used by this flat hash map
+
+  public:
+    // TYPES
+    typedef bsl::pair<KEY, VALUE>                 value_type;
+    typedef KEY                                   key_type;
+    typedef VALUE                                 mapped_type;
+    typedef bsl::size_t                           size_type;
+    typedef bsl::ptrdiff_t                        difference_type;
+    typedef EQUAL                                 key_compare;
+    typedef HASH                                  hasher;
+    typedef value_type&                           reference;
+    typedef const value_type&                     const_reference;
+    typedef value_type                           *pointer;
+    typedef const value_type                     *const_pointer;
+    typedef typename ImplType::iterator           iterator;
+    typedef typename ImplType::const_iterator     const_iterator;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatHashMap, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    FlatHashMap();
+    explicit FlatHashMap(bslma::Allocator *basicAllocator);
+    explicit FlatHashMap(bsl::size_t capacity);
+    FlatHashMap(bsl::size_t capacity, bslma::Allocator *basicAllocator);
+    FlatHashMap(bsl::size_t       capacity,
+                const HASH&       hash,
+                bslma::Allocator *basicAllocator = 0);
+    FlatHashMap(bsl::size_t       capacity,
+                const HASH&       hash,
+                const EQUAL&      equal,
+                bslma::Allocator *basicAllocator = 0);
+        // Create an empty 'FlatHashMap' object.  Optionally specify a
+        // 'capacity' indicating the minimum initial size of the underlying
+        // array of entries of this container.  If 'capacity' is not supplied
+        // or is 0, no memory is allocated.  Optionally specify a 'hash'
+        // functor used to generate the hash values associated with the keys
+        // of elements in this container.  If 'hash' is not supplied, a
+        // default-constructed object of the (template parameter) type 'HASH'
+        // is used.  Optionally specify an equality functor 'equal' used to
+        // determine whether the keys of two elements are equivalent.  If
+        // 'equal' is not supplied, a default-constructed object of the
+        // (template parameter) type 'EQUAL' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // supplied or is 0, the currently installed default allocator is
+        // used.
+
+    template <class INPUT_ITERATOR>
+    FlatHashMap(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    FlatHashMap(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bsl::size_t       capacity,
+                bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    FlatHashMap(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bsl::size_t       capacity,
+                const HASH&       hash,
+                bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    FlatHashMap(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bsl::size_t       capacity,
+                const HASH&       hash,
+                const EQUAL&      equal,
+                bslma::Allocator *basicAllocator = 0);
+        // Create a 'FlatHashMap' object initialized by insertion of the values
+        // from the input iterator range specified by 'first' through 'last'
+        // (including 'first', excluding 'last').  Optionally specify a
+        // 'capacity' indicating the minimum initial size of the underlying
+        // array of entries of this container.  If 'capacity' is not supplied
+        // or is 0, no memory is allocated by this constructor (but it may be
+        // by the insertions).  Optionally specify a 'hash' functor used to
+        // generate hash values associated with the keys of the elements in
+        // this container.  If 'hash' is not supplied, a default-constructed
+        // object of the (template parameter) type 'HASH' is used.  Optionally
+        // specify an equality functor 'equal' used to determine whether the
+        // keys of two elements are equivalent.  If 'equal' is not supplied, a
+        // default-constructed object of the (template parameter) type 'EQUAL'
+        // is used.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is not supplied or is 0, the currently
+        // installed default allocator is used.  The behavior is undefined
+        // unless 'first' and 'last' refer to a sequence of valid values where
+        // 'first' is at a position at or before 'last'.  Note that if a member
+        // of the input sequence has an equivalent key to an earlier member,
+        // the later member will not be inserted.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    FlatHashMap(bsl::initializer_list<value_type>  values,
+                bslma::Allocator                  *basicAllocator = 0);
+    FlatHashMap(bsl::initializer_list<value_type>  values,
+                bsl::size_t                        capacity,
+                bslma::Allocator                  *basicAllocator = 0);
+    FlatHashMap(bsl::initializer_list<value_type>  values,
+                bsl::size_t                        capacity,
+                const HASH&                        hash,
+                bslma::Allocator                  *basicAllocator = 0);
+    FlatHashMap(bsl::initializer_list<value_type>  values,
+                bsl::size_t                        capacity,
+                const HASH&                        hash,
+                const EQUAL&                       equal,
+                bslma::Allocator                  *basicAllocator = 0);
+        // Create a 'FlatHashMap' object initialized by insertion of the
+        // specified 'values'.  Optionally specify a 'capacity' indicating the
+        // minimum initial size of the underlying array of entries of this
+        // container.  If 'capacity' is not supplied or is 0, no memory is
+        // allocated by this constructor (but it may be by the insertions).
+        // Optionally specify a 'hash' functor used to generate hash values
+        // associated with the keys of elements in this container.  If 'hash'
+        // is not supplied, a default-constructed object of the (template
+        // parameter) type 'HASH' is used.  Optionally specify an equality
+        // functor 'equal' used to determine whether the keys of two elements
+        // are equivalent.  If 'equal' is not supplied, a default-constructed
+        // object of the (template parameter) type 'EQUAL' is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is not supplied or is 0, the currently installed
+        // default allocator is used.  Note that if a member of 'values' has
+        // an equivalent key to an earlier member, the later member will not
+        // be inserted.
+#endif
+
+    FlatHashMap(const FlatHashMap&  original,
+                bslma::Allocator   *basicAllocator = 0);
+        // Create a 'FlatHashMap' object having the same value, hasher, and
+        // equality comparator as the specified 'original' object.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is not specified or is 0, the currently installed
+        // default allocator is used.
+
+    FlatHashMap(bslmf::MovableRef<FlatHashMap> original);
+        // Create a 'FlatHashMap' object having the same value, hasher,
+        // equality comparator, and allocator as the specified 'original'
+        // object.  The contents of 'original' are moved (in constant time) to
+        // this object, 'original' is left in a (valid) unspecified state, and
+        // no exceptions will be thrown.
+
+    FlatHashMap(bslmf::MovableRef<FlatHashMap>  original,
+                bslma::Allocator               *basicAllocator);
+        // Create a 'FlatHashMap' object having the same value, hasher, and
+        // equality comparator as the specified 'original' object, using the
+        // specified 'basicAllocator' to supply memory.  If 'basicAllocator'
+        // is 0, the currently installed default allocator is used.  The
+        // contents of 'original' are moved (in constant time) to this object
+        // if 'basicAllocator == original.allocator()', and are move-inserted
+        // (in linear time) using 'basicAllocator' otherwise.  'original' is
+        // left in a (valid) unspecified state.
+
+    //! ~FlatHashMap() = default;
+        // Destroy this object and each of its elements.
+
+    // MANIPULATORS
+    FlatHashMap& operator=(const FlatHashMap& rhs);
+        // Assign to this object the value, hasher, and equality functor of
+        // the specified 'rhs' object, and return a reference providing
+        // modifiable access to this object.
+
+    FlatHashMap& operator=(bslmf::MovableRef<FlatHashMap> rhs);
+        // Assign to this object the value, hasher, and equality comparator of
+        // the specified 'rhs' object, and return a reference providing
+        // modifiable access to this object.  The contents of 'rhs' are moved
+        // (in constant time) to this object if
+        // 'rhs.allocator() == allocator()', and are move-inserted (in linear
+        // time) using 'allocator()' otherwise.  'rhs' is left in a (valid)
+        // unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    FlatHashMap& operator=(bsl::initializer_list<value_type> values);
+        // Assign to this object the value resulting from first clearing this
+        // map and then inserting each object in the specified 'values'
+        // initializer list, ignoring those objects having a key equivalent to
+        // that which appears earlier in the list; return a reference
+        // providing modifiable access to this object.  This method requires
+        // that the (template parameter) type 'KEY' be copy-insertable into
+        // this map.
+#endif
+
+    VALUE& operator[](const KEY& key);
+    VALUE& operator[](bslmf::MovableRef<KEY> key);
+        // Return a reference providing modifiable access to the mapped value
+        // associated with the specified 'key' in this map.  If this map does
+        // not already contain an element having 'key', insert an element
+        // with the 'key' and a default-constructed 'VALUE', and return a
+        // reference to the newly mapped value.  If 'key' is moved, 'key' is
+        // left in a valid but unspecified state.
+
+    VALUE& at(const KEY& key);
+        // Return a reference providing modifiable access to the mapped value
+        // associated with the specified 'key' in this map, if such an entry
+        // exists; otherwise, throw a 'std::out_of_range' exception.  Note
+        // that this method is not exception-neutral.
+
+    void clear();
+        // Remove all elements from this map.  Note that this map will be
+        // empty after calling this method, but allocated memory may be
+        // retained for future use.  See the 'capacity' method.
+
+    bsl::pair<iterator, iterator> equal_range(const KEY& key);
+        // Return a pair of iterators defining the sequence of modifiable
+        // elements in this map having the specified 'key', where the first
+        // iterator is positioned at the start of the sequence and the second
+        // iterator is positioned one past the end of the sequence.  If this
+        // map contains no elements having a key equivalent to 'key', then the
+        // two returned iterators will have the same value.  Note that since a
+        // map maintains unique keys, the range will contain at most one
+        // element.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove from this map the element whose key is equal to the
+        // specified 'key', if it exists, and return 1; otherwise (there is no
+        // element having 'key' in this map), return 0 with no other effect.
+
+    iterator erase(const_iterator position);
+    iterator erase(iterator position);
+        // Remove from this map the element at the specified 'position', and
+        // return an iterator referring to the element immediately following
+        // the removed element, or to the past-the-end position if the removed
+        // element was the last element in the sequence of elements maintained
+        // by this map.  The behavior is undefined unless 'position' refers to
+        // an element in this map.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this map the elements starting at the specified 'first'
+        // position up to, but not including, the specified 'last' position,
+        // and return 'last'.  The behavior is undefined unless 'first' and
+        // 'last' either refer to elements in this map or are the 'end'
+        // iterator, and the 'first' position is at or before the 'last'
+        // position in the iteration sequence provided by this container.
+
+    iterator find(const KEY& key);
+        // Return an iterator referring to the element in this map having the
+        // specified 'key', or 'end()' if no such entry exists in this map.
+
+    bsl::pair<iterator, bool> insert(const value_type& value);
+    bsl::pair<iterator, bool> insert(bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' into this map if the key of 'value'
+        // does not already exist in this map; otherwise, this method has no
+        // effect.  Return a 'pair' whose 'first' member is an iterator
+        // referring to the (possibly newly inserted) object in this map whose
+        // key is equivalent to that of the object to be inserted, and whose
+        // 'second' member is 'true' if a new value was inserted, and 'false'
+        // if the key was already present.  If 'value' is moved, 'value' is
+        // left in a valid but unspecified state.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Create a 'value_type' object from each 'value_type' object in the
+        // range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, whose key is not
+        // already contained in this map, and insert it into this map.  The
+        // behavior is undefined unless 'first' and 'last' refer to a
+        // sequence of valid values where 'first' is at a position at or
+        // before 'last'.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(bsl::initializer_list<value_type> values);
+        // Insert into this map the value of each 'value_type' object in the
+        // specified 'values' initializer list if a key equivalent to the
+        // object's key is not already contained in this map.
+#endif
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Change the capacity of this map to at least the specified
+        // 'minimumCapacity', and redistribute all the contained elements into
+        // a new sequence of entries, according to their hash values.  If
+        // '0 == minimumCapacity' and '0 == size()', the map is returned to
+        // the zero-capacity state.  On return, 'load_factor()' is less than
+        // or equal to 'max_load_factor()' and all iterators, pointers, and
+        // references to elements of this map are invalidated.
+
+    void reserve(bsl::size_t numEntries);
+        // Change the capacity of this map to at least a capacity that can
+        // accommodate the specified 'numEntries' (accounting for the load
+        // factor invariant), and redistribute all the contained elements
+        // into a new sequence of entries, according to their hash values.  If
+        // '0 == numEntries' and '0 == size()', the map is returned to the
+        // zero-capacity state.  Note that this method is effectively
+        // equivalent to:
+        //..
+        //    rehash(bsl::ceil(numEntries / max_load_factor()))
+        //..
+
+    void reset();
+        // Remove all elements from this map and release all memory from this
+        // map, returning the map to the zero-capacity state.
+
+    bsl::pair<iterator, bool> try_emplace(const KEY& key);
+    bsl::pair<iterator, bool> try_emplace(bslmf::MovableRef<KEY> key);
+        // If this map does not already contain an element having the
+        // specified 'key', insert an element with the 'key' and a
+        // default-constructed 'VALUE'.  Return a 'pair' whose 'first' member
+        // is an iterator referring to the (possibly newly inserted) element
+        // having 'key', and whose 'second' member is 'true' if a new element
+        // was inserted, and 'false' otherwise.
+
+                          // Iterators
+
+    iterator begin();
+        // Return an iterator representing the beginning of the sequence of
+        // modifiable elements held by this map.
+
+    iterator end();
+        // Return an iterator representing the end of the sequence of
+        // modifiable elements held by this map.
+
+                             // Aspects
+
+    void swap(FlatHashMap& other);
+        // Efficiently exchange the value, hasher, and equality functor of
+        // this object with those of the specified 'other' object.  This
+        // method provides the no-throw exception-safety guarantee if 'HASH'
+        // and 'EQUAL' can be swapped without throwing.  The behavior is
+        // undefined unless this object was created with the same allocator as
+        // 'other'.
+
+    // ACCESSORS
+    const VALUE& at(const KEY& key) const;
+        // Return a 'const' reference to the mapped value associated with the
+        // specified 'key' in this map, if such an entry exists; otherwise,
+        // throw a 'std::out_of_range' exception.  Note that this method is
+        // not exception-neutral.
+
+    bsl::size_t capacity() const;
+        // Return the number of elements this map could hold if the load factor
+        // were 1.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this map contains an element having the specified
+        // 'key', and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements in this map having the specified
+        // 'key'.  Note that since a flat hash map maintains unique keys, the
+        // returned value will be either 0 or 1.
+
+    bool empty() const;
+        // Return 'true' if this map contains no elements, and 'false'
+        // otherwise.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(
+                                                         const KEY& key) const;
+        // Return a pair of 'const_iterator's defining the sequence of elements
+        // in this map having the specified 'key', where the first iterator is
+        // positioned at the start of the sequence and the second iterator is
+        // positioned one past the end of the sequence.  If this map contains
+        // no elements having a key equivalent to 'key', then the two returned
+        // iterators will have the same value.  Note that since a map
+        // maintains unique keys, the range will contain at most one element.
+
+    const_iterator find(const KEY& key) const;
+        // Return a 'const_iterator' referring to the element in this map
+        // having the specified 'key', or 'end()' if no such entry exists in
+        // this map.
+
+    HASH hash_function() const;
+        // Return (a copy of) the unary hash functor used by this map to
+        // generate a hash value (of type 'bsl::size_t') for a 'KEY' object.
+
+    EQUAL key_eq() const;
+        // Return (a copy of) the binary key-equality functor that returns
+        // 'true' if the value of two 'KEY' objects are equivalent, and 'false'
+        // otherwise.
+
+    float load_factor() const;
+        // Return the current ratio between the number of elements in this
+        // container and its capacity.
+
+    float max_load_factor() const;
+        // Return the maximum load factor allowed for this map, which is
+        // 0.875.  Note that if an insert operation would cause the load factor
+        // to exceed the 'max_load_factor', that same insert operation will
+        // increase the capacity and rehash the entries of the container (see
+        // {'insert'} and {'rehash'}).
+
+    bsl::size_t size() const;
+        // Return the number of elements in this map.
+
+                          // Iterators
+
+    const_iterator begin() const;
+        // Return a 'const_iterator' representing the beginning of the sequence
+        // of elements held by this map.
+
+    const_iterator cbegin() const;
+        // Return a 'const_iterator' representing the beginning of the sequence
+        // of elements held by this map.
+
+    const_iterator cend() const;
+        // Return a 'const_iterator' representing the end of the sequence of
+        // elements held by this map.
+
+    const_iterator end() const;
+        // Return a 'const_iterator' representing the end of the sequence of
+        // elements held by this map.
+
+                           // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this flat hash map to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator==(const FlatHashMap<KEY, VALUE, HASH, EQUAL> &lhs,
+                const FlatHashMap<KEY, VALUE, HASH, EQUAL> &rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'FlatHashMap' objects have the same
+    // value if their sizes are the same and each element contained in one is
+    // equal to an element of the other.  The hash and equality functors are
+    // not involved in the comparison.
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator!=(const FlatHashMap<KEY, VALUE, HASH, EQUAL> &lhs,
+                const FlatHashMap<KEY, VALUE, HASH, EQUAL> &rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'FlatHashMap' objects do not
+    // have the same value if their sizes are different or one contains an
+    // element equal to no element of the other.  The hash and equality
+    // functors are not involved in the comparison.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void swap(FlatHashMap<KEY, VALUE, HASH, EQUAL>& a,
+          FlatHashMap<KEY, VALUE, HASH, EQUAL>& b);
+    // Exchange the value, the hasher, and the key-equality functor of the
+    // specified 'a' and 'b' objects.  This function provides the no-throw
+    // exception-safety guarantee if the two objects were created with the
+    // same allocator and the basic guarantee otherwise.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // ----------------------------
+                        // struct FlatHashMap_EntryUtil
+                        // ----------------------------
+
+// CLASS METHODS
+template <class KEY, class VALUE, class ENTRY>
+void FlatHashMap_EntryUtil<KEY, VALUE, ENTRY>::constructFromKey(
+                                                  ENTRY            *entry,
+                                                  bslma::Allocator *allocator,
+                                                  const KEY&        key)
+{
+    BSLS_ASSERT_SAFE(entry);
+
+    bsls::ObjectBuffer<VALUE> defaultValue;
+    bslma::ConstructionUtil::construct(defaultValue.address(), allocator);
+    bslma::DestructorGuard<VALUE> valueGuard(defaultValue.address());
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+    bslma::ConstructionUtil::construct(
+                         entry,
+                         allocator,
+                         key,
+                         bslmf::MovableRefUtil::move(defaultValue.object()));
+#else
+    bslma::ConstructionUtil::construct(entry,
+                                       allocator,
+                                       key,
+                                       defaultValue.object());
+#endif
+}
+
+template <class KEY, class VALUE, class ENTRY>
+void FlatHashMap_EntryUtil<KEY, VALUE, ENTRY>::constructFromKey(
+                                            ENTRY                  *entry,
+                                            bslma::Allocator       *allocator,
+                                            bslmf::MovableRef<KEY>  key)
+{
+    BSLS_ASSERT_SAFE(entry);
+
+    bsls::ObjectBuffer<VALUE> defaultValue;
+    bslma::ConstructionUtil::construct(defaultValue.address(), allocator);
+    bslma::DestructorGuard<VALUE> valueGuard(defaultValue.address());
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+    bslma::ConstructionUtil::construct(
+                         entry,
+                         allocator,
+                         bslmf::MovableRefUtil::move(key),
+                         bslmf::MovableRefUtil::move(defaultValue.object()));
+#else
+    bslma::ConstructionUtil::construct(entry,
+                                       allocator,
+                                       bslmf::MovableRefUtil::access(key),
+                                       defaultValue.object());
+#endif
+}
+
+template <class KEY, class VALUE, class ENTRY>
+inline
+const KEY& FlatHashMap_EntryUtil<KEY, VALUE, ENTRY>::key(const ENTRY& entry)
+{
+    return entry.first;
+}
+
+                            // -----------------
+                            // class FlatHashMap
+                            // -----------------
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap()
+: d_impl(0, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(bsl::size_t capacity)
+: d_impl(capacity, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bsl::size_t       capacity,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              const EQUAL&      equal,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              bsl::size_t       capacity,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, EQUAL(), basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              const EQUAL&      equal,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+    insert(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                             bsl::initializer_list<value_type>  values,
+                             bslma::Allocator                  *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    insert(values.begin(), values.end());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                             bsl::initializer_list<value_type>  values,
+                             bsl::size_t                        capacity,
+                             bslma::Allocator                  *basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator)
+{
+    insert(values.begin(), values.end());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                             bsl::initializer_list<value_type>  values,
+                             bsl::size_t                        capacity,
+                             const HASH&                        hash,
+                             bslma::Allocator                  *basicAllocator)
+: d_impl(capacity, hash, EQUAL(), basicAllocator)
+{
+    insert(values.begin(), values.end());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                             bsl::initializer_list<value_type>  values,
+                             bsl::size_t                        capacity,
+                             const HASH&                        hash,
+                             const EQUAL&                       equal,
+                             bslma::Allocator                  *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+    insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                          const FlatHashMap&  original,
+                                          bslma::Allocator   *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                       bslmf::MovableRef<FlatHashMap> original)
+: d_impl(MoveUtil::move(MoveUtil::access(original).d_impl))
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                              bslmf::MovableRef<FlatHashMap>  original,
+                              bslma::Allocator               *basicAllocator)
+: d_impl(MoveUtil::move(MoveUtil::access(original).d_impl), basicAllocator)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>&
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::operator=(const FlatHashMap& rhs)
+{
+    d_impl = rhs.d_impl;
+
+    return *this;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>&
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::operator=(
+                                            bslmf::MovableRef<FlatHashMap> rhs)
+{
+    FlatHashMap& lvalue = rhs;
+
+    d_impl = MoveUtil::move(lvalue.d_impl);
+
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>&
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::operator=(
+                                      bsl::initializer_list<value_type> values)
+{
+    FlatHashMap tmp(values.begin(),
+                    values.end(),
+                    0,
+                    d_impl.hash_function(),
+                    d_impl.key_eq(),
+                    d_impl.allocator());
+
+    this->swap(tmp);
+
+    return *this;
+}
+#endif
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::operator[](const KEY& key)
+{
+    return d_impl.tryEmplace(key).first->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::operator[](
+                                                    bslmf::MovableRef<KEY> key)
+{
+    return d_impl.tryEmplace(MoveUtil::move(key)).first->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::at(const KEY& key)
+{
+    iterator it = d_impl.find(key);
+
+    if (it == d_impl.end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                                         "FlatHashMap<...>::at(key_type): "
+                                         "invalid key value");
+    }
+
+    return it->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator,
+          typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::equal_range(const KEY& key)
+{
+    return d_impl.equal_range(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_impl.erase(position);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_impl.erase(position);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const_iterator first,
+                                            const_iterator last)
+{
+    return d_impl.erase(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key)
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(const value_type& value)
+{
+    return d_impl.insert(value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(
+                                           bslmf::MovableRef<value_type> value)
+{
+    return d_impl.insert(MoveUtil::move(value));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(INPUT_ITERATOR first,
+                                                  INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        d_impl.insert(*first);
+    }
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(
+                                      bsl::initializer_list<value_type> values)
+{
+    insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::rehash(bsl::size_t minimumCapacity)
+{
+    d_impl.rehash(minimumCapacity);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::reserve(bsl::size_t numEntries)
+{
+    d_impl.reserve(numEntries);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::reset()
+{
+    d_impl.reset();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::try_emplace(const KEY& key)
+{
+    return d_impl.tryEmplace(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::try_emplace(bslmf::MovableRef<KEY> key)
+{
+    return d_impl.tryEmplace(MoveUtil::move(key));
+}
+
+                          // Iterators
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::begin()
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::end()
+{
+    return d_impl.end();
+}
+
+                             // Aspects
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::swap(FlatHashMap& other)
+{
+    BSLS_ASSERT_SAFE(allocator() == other.allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+const VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::at(const KEY& key) const
+{
+    const_iterator it = d_impl.find(key);
+
+    if (it == d_impl.end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                                   "FlatHashMap<...>::at(key_type): "
+                                   "invalid key value");
+    }
+
+    return it->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool FlatHashMap<KEY, VALUE, HASH, EQUAL>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::count(const KEY& key) const
+{
+    return d_impl.count(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool FlatHashMap<KEY, VALUE, HASH, EQUAL>::empty() const
+{
+    return d_impl.empty();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator,
+          typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::equal_range(const KEY& key) const
+{
+    return d_impl.equal_range(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH FlatHashMap<KEY, VALUE, HASH, EQUAL>::hash_function() const
+{
+    return d_impl.hash_function();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL FlatHashMap<KEY, VALUE, HASH, EQUAL>::key_eq() const
+{
+    return d_impl.key_eq();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+float FlatHashMap<KEY, VALUE, HASH, EQUAL>::load_factor() const
+{
+    return d_impl.load_factor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+float FlatHashMap<KEY, VALUE, HASH, EQUAL>::max_load_factor() const
+{
+    return d_impl.max_load_factor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    return d_impl.size();
+}
+
+                          // Iterators
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::cbegin() const
+{
+    return d_impl.cbegin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::cend() const
+{
+    return d_impl.cend();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::end() const
+{
+    return d_impl.end();
+}
+
+                           // Aspects
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bslma::Allocator *FlatHashMap<KEY, VALUE, HASH, EQUAL>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool bdlc::operator==(const FlatHashMap<KEY, VALUE, HASH, EQUAL> &lhs,
+                      const FlatHashMap<KEY, VALUE, HASH, EQUAL> &rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(const FlatHashMap<KEY, VALUE, HASH, EQUAL> &lhs,
+                      const FlatHashMap<KEY, VALUE, HASH, EQUAL> &rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void bdlc::swap(FlatHashMap<KEY, VALUE, HASH, EQUAL>& a,
+                FlatHashMap<KEY, VALUE, HASH, EQUAL>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+
+        return;                                                       // RETURN
+    }
+
+    typedef FlatHashMap<KEY, VALUE, HASH, EQUAL> Map;
+
+    Map futureA(b, a.allocator());
+    Map futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1156 @@
+// bdlc_flathashmap.t.cpp                                             -*-C++-*-
+#include <bdlc_flathashmap.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_stdexcept.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bdlc::FlatHashMap' is a thin wrapper over 'bdlc::FlatHashTable', which is
+// tested thoroughly in its own test driver.  This test driver verifies that
+// each method of the map forwards to the table, and tests the methods that
+// add behavior: the construction of entries having a default value
+// ('operator[]', 'try_emplace'), 'at', the range and initializer list
+// constructors, and the free 'swap'.  Test case -1 compares the performance
+// of the map with that of 'bsl::unordered_map'.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatHashMap();
+// [ 2] FlatHashMap(bslma::Allocator *);
+// [ 2] FlatHashMap(size_t);
+// [ 2] FlatHashMap(size_t, bslma::Allocator *);
+// [ 2] FlatHashMap(size_t, const HASH&, bslma::Allocator *);
+// [ 2] FlatHashMap(size_t, const HASH&, const EQUAL&, Allocator *);
+// [ 3] FlatHashMap(INPUT_ITER, INPUT_ITER, bslma::Allocator *);
+// [ 3] FlatHashMap(INPUT_ITER, INPUT_ITER, size_t, bslma::Allocator *);
+// [ 3] FlatHashMap(INPUT_ITER, INPUT_ITER, size_t, const HASH&, Alloc *);
+// [ 3] FlatHashMap(INPUT_ITER, INPUT_ITER, size_t, HASH, EQUAL, Alloc *);
+// [ 3] FlatHashMap(initializer_list, bslma::Allocator *);
+// [ 3] FlatHashMap(initializer_list, size_t, bslma::Allocator *);
+// [ 3] FlatHashMap(initializer_list, size_t, const HASH&, Alloc *);
+// [ 3] FlatHashMap(initializer_list, size_t, HASH, EQUAL, Alloc *);
+// [ 5] FlatHashMap(const FlatHashMap&, bslma::Allocator *);
+// [ 5] FlatHashMap(MovableRef<FlatHashMap>);
+// [ 5] FlatHashMap(MovableRef<FlatHashMap>, bslma::Allocator *);
+// [ 2] ~FlatHashMap();
+//
+// MANIPULATORS
+// [ 5] FlatHashMap& operator=(const FlatHashMap&);
+// [ 5] FlatHashMap& operator=(MovableRef<FlatHashMap>);
+// [ 3] FlatHashMap& operator=(initializer_list);
+// [ 4] VALUE& operator[](const KEY&);
+// [ 4] VALUE& operator[](MovableRef<KEY>);
+// [ 4] VALUE& at(const KEY&);
+// [ 6] void clear();
+// [ 6] pair<iterator, iterator> equal_range(const KEY&);
+// [ 6] size_t erase(const KEY&);
+// [ 6] iterator erase(const_iterator);
+// [ 6] iterator erase(iterator);
+// [ 6] iterator erase(const_iterator, const_iterator);
+// [ 2] iterator find(const KEY&);
+// [ 2] pair<iterator, bool> insert(const value_type&);
+// [ 2] pair<iterator, bool> insert(MovableRef<value_type>);
+// [ 3] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] void insert(initializer_list);
+// [ 6] void rehash(size_t);
+// [ 6] void reserve(size_t);
+// [ 6] void reset();
+// [ 4] pair<iterator, bool> try_emplace(const KEY&);
+// [ 4] pair<iterator, bool> try_emplace(MovableRef<KEY>);
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 5] void swap(FlatHashMap&);
+//
+// ACCESSORS
+// [ 4] const VALUE& at(const KEY&) const;
+// [ 2] size_t capacity() const;
+// [ 2] bool contains(const KEY&) const;
+// [ 2] size_t count(const KEY&) const;
+// [ 2] bool empty() const;
+// [ 6] pair<const_iter, const_iter> equal_range(const KEY&) const;
+// [ 2] const_iterator find(const KEY&) const;
+// [ 2] HASH hash_function() const;
+// [ 2] EQUAL key_eq() const;
+// [ 6] float load_factor() const;
+// [ 6] float max_load_factor() const;
+// [ 2] size_t size() const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator cbegin() const;
+// [ 2] const_iterator cend() const;
+// [ 2] const_iterator end() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const FlatHashMap&, const FlatHashMap&);
+// [ 5] bool operator!=(const FlatHashMap&, const FlatHashMap&);
+// [ 5] void swap(FlatHashMap&, FlatHashMap&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE COMPARISON WITH 'bsl::unordered_map'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatHashMap<int, bsl::string>  Obj;
+typedef Obj::value_type                      Entry;
+
+struct SeededHash {
+    // This functor hashes an 'int', modulo 1000 (consistently with
+    // 'ModEqual'), with a seed, so that the hash functor of a map can be
+    // identified.
+
+    int d_seed;
+
+    explicit SeededHash(int seed = 0)
+    : d_seed(seed)
+    {
+    }
+
+    bsl::size_t operator()(int key) const
+        // Return the hash value of the specified 'key'.
+    {
+        return bslh::Hash<>()(key % 1000 ^ d_seed);
+    }
+};
+
+struct ModEqual {
+    // This functor compares two 'int' keys modulo 1000, so that the equality
+    // functor of a map can be identified.
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' and 'rhs' are equal modulo
+        // 1000, and 'false' otherwise.
+    {
+        return lhs % 1000 == rhs % 1000;
+    }
+};
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bsl::string makeString(int value)
+    // Return a string, too long for the short-string optimization, that is
+    // unique to the specified 'value'.
+{
+    bsl::ostringstream out;
+    out << "a string long enough to allocate memory: " << value;
+    return out.str();
+}
+
+static Entry makeEntry(int key)
+    // Return an entry having the specified 'key' and a value derived from
+    // 'key'.
+{
+    return Entry(key, makeString(key));
+}
+
+template <class MAP>
+static bool hasEntries(const MAP& map, int numEntries)
+    // Return 'true' if the specified 'map' holds exactly the entries
+    // 'makeEntry(i)' for 'i' in '[0 .. numEntries)', and 'false' otherwise.
+{
+    if (map.size() != static_cast<bsl::size_t>(numEntries)) {
+        return false;                                                 // RETURN
+    }
+    for (int i = 0; i < numEntries; ++i) {
+        typename MAP::const_iterator it = map.find(i);
+        if (it == map.end() || *it != makeEntry(i)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+                         // =======================
+                         // struct PerformanceUtil
+                         // =======================
+
+struct PerformanceUtil {
+    // This 'struct' provides a namespace for functions timing the basic
+    // operations of a map.
+
+    template <class MAP, class KEY>
+    static void run(const char              *name,
+                    const bsl::vector<KEY>&  keys,
+                    const bsl::vector<KEY>&  missingKeys,
+                    int                      numRepetitions);
+        // Insert the specified 'keys' into a map of the (template parameter)
+        // type 'MAP', then find each of 'keys', then find each of the
+        // specified 'missingKeys', then erase each of 'keys', repeating each
+        // operation the specified 'numRepetitions' times, and print the
+        // average time per operation, labeled with the specified 'name'.
+};
+
+template <class MAP, class KEY>
+void PerformanceUtil::run(const char              *name,
+                          const bsl::vector<KEY>&  keys,
+                          const bsl::vector<KEY>&  missingKeys,
+                          int                      numRepetitions)
+{
+    const double numOps = static_cast<double>(keys.size()) * numRepetitions;
+
+    double insertTime = 0;
+    double hitTime    = 0;
+    double missTime   = 0;
+    double eraseTime  = 0;
+    int    found      = 0;
+
+    for (int r = 0; r < numRepetitions; ++r) {
+        MAP            map;
+        bsls::Stopwatch sw;
+
+        sw.start();
+        for (bsl::size_t i = 0; i < keys.size(); ++i) {
+            map[keys[i]] = static_cast<int>(i);
+        }
+        sw.stop();
+        insertTime += sw.elapsedTime();
+
+        sw.reset();
+        sw.start();
+        for (bsl::size_t i = 0; i < keys.size(); ++i) {
+            found += static_cast<int>(map.count(keys[i]));
+        }
+        sw.stop();
+        hitTime += sw.elapsedTime();
+
+        sw.reset();
+        sw.start();
+        for (bsl::size_t i = 0; i < missingKeys.size(); ++i) {
+            found += static_cast<int>(map.count(missingKeys[i]));
+        }
+        sw.stop();
+        missTime += sw.elapsedTime();
+
+        sw.reset();
+        sw.start();
+        for (bsl::size_t i = 0; i < keys.size(); ++i) {
+            map.erase(keys[i]);
+        }
+        sw.stop();
+        eraseTime += sw.elapsedTime();
+
+        ASSERT(map.empty());
+    }
+
+    ASSERTV(name, found,
+            static_cast<int>(keys.size()) * numRepetitions == found);
+
+    cout << name
+         << ": insert "   << insertTime / numOps * 1e9
+         << "ns, hit "    << hitTime    / numOps * 1e9
+         << "ns, miss "   << missTime   / numOps * 1e9
+         << "ns, erase "  << eraseTime  / numOps * 1e9
+         << "ns" << endl;
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Gathering Document Statistics
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose one wished to gather statistics on the words appearing in a large
+// set of documents on disk or in a database.  Gathering those statistics is
+// intrusive (as one is competing for access to the documents with the regular
+// users) and must be done as quickly as possible.  Moreover, the set of unique
+// words appearing in those documents may be high.  The English language has
+// in excess of a million words (albeit many appear infrequently), and, if the
+// documents contain serial numbers, or Social Security numbers, or chemical
+// formulas, etc., then the 'O[log(n)]' insertion time of ordered maps may
+// well be inadequate.  An unordered map, having an 'O[1]' typical access
+// cost, is a much better choice, and an open-addressed map that does not
+// allocate per entry is better still.
+//
+// First, we define the type of map used to count the words:
+//..
+    typedef bdlc::FlatHashMap<bsl::string, int> WordTally;
+//..
+// Next, we define the documents to be processed (with the most common words
+// of the English language elided):
+//..
+    const char *documents[] = {
+        " fast decent efficient  allocators  ...",
+        " map ordered  unordered map  value type ...",
+        " fast map lookups require fast hashing ...",
+    };
+    const int numDocuments = sizeof documents / sizeof *documents;
+//..
+// Then, we create the map, and, by calling 'operator[]', which
+// default-constructs (to 0) the count of a word not yet seen, we tally the
+// occurrences of each word:
+//..
+    WordTally tally;
+
+    for (int i = 0; i < numDocuments; ++i) {
+        bsl::istringstream in(documents[i]);
+        bsl::string        word;
+
+        while (in >> word) {
+            if ("..." != word) {
+                ++tally[word];
+            }
+        }
+    }
+//..
+// Finally, we verify the counts of a few words, and confirm that the map
+// contains the expected number of unique words:
+//..
+    ASSERT(3  == tally["fast"]);
+    ASSERT(3  == tally["map"]);
+    ASSERT(1  == tally["hashing"]);
+    ASSERT(0  == tally.count("elided"));
+    ASSERT(12 == tally.size());
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // FORWARDING MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 'erase', 'equal_range', 'clear', 'rehash', 'reserve', 'reset',
+        //:   'load_factor', and 'max_load_factor' forward to the table.
+        //
+        // Plan:
+        //: 1 Call each method on a populated map and verify the result and the
+        //:   state of the map.  (C-1)
+        //
+        // Testing:
+        //   void clear();
+        //   pair<iterator, iterator> equal_range(const KEY&);
+        //   size_t erase(const KEY&);
+        //   iterator erase(const_iterator);
+        //   iterator erase(iterator);
+        //   iterator erase(const_iterator, const_iterator);
+        //   void rehash(size_t);
+        //   void reserve(size_t);
+        //   void reset();
+        //   pair<const_iter, const_iter> equal_range(const KEY&) const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                         << "FORWARDING MANIPULATORS AND ACCESSORS" << endl
+                         << "=====================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(0.875f == X.max_load_factor());
+
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(makeEntry(i));
+            }
+            ASSERT(X.load_factor() <= X.max_load_factor());
+            ASSERT(0.5f < X.load_factor());
+
+            bsl::pair<Obj::iterator, Obj::iterator> r = mX.equal_range(10);
+            ASSERT(makeEntry(10) == *r.first);
+            ++r.first;
+            ASSERT(r.first == r.second);
+
+            bsl::pair<Obj::const_iterator, Obj::const_iterator> cr =
+                                                           X.equal_range(100);
+            ASSERT(cr.first == cr.second);
+
+            ASSERT(1 == mX.erase(10));
+            ASSERT(0 == mX.erase(10));
+            ASSERT(99 == X.size());
+
+            Obj::const_iterator cit  = X.find(20);
+            Obj::const_iterator next = cit;
+            ++next;
+            ASSERT(next == mX.erase(cit));
+
+            Obj::iterator it = mX.find(30);
+            next = it;
+            ++next;
+            ASSERT(next == mX.erase(it));
+            ASSERT(97 == X.size());
+
+            mX.erase(X.begin(), X.end());
+            ASSERT(X.empty());
+
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(makeEntry(i));
+            }
+
+            const bsl::size_t capacity = X.capacity();
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(capacity == X.capacity());
+
+            mX.rehash(1000);
+            ASSERT(1024 == X.capacity());
+
+            mX.reserve(1000);
+            ASSERT(2048 == X.capacity());
+
+            mX.reset();
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 Copy and move construction and assignment, 'swap', and the
+        //:   equality operators forward to the table, and propagate the
+        //:   allocator as for the table.
+        //:
+        //: 2 The free 'swap' exchanges the values of maps having different
+        //:   allocators, and the allocators are unchanged.
+        //:
+        //: 3 Two maps having the same keys are not equal if a value differs.
+        //
+        // Plan:
+        //: 1 Perform each operation on maps of various sizes and verify the
+        //:   values and allocators.  (C-1..3)
+        //
+        // Testing:
+        //   FlatHashMap(const FlatHashMap&, bslma::Allocator *);
+        //   FlatHashMap(MovableRef<FlatHashMap>);
+        //   FlatHashMap(MovableRef<FlatHashMap>, bslma::Allocator *);
+        //   FlatHashMap& operator=(const FlatHashMap&);
+        //   FlatHashMap& operator=(MovableRef<FlatHashMap>);
+        //   void swap(FlatHashMap&);
+        //   bool operator==(const FlatHashMap&, const FlatHashMap&);
+        //   bool operator!=(const FlatHashMap&, const FlatHashMap&);
+        //   void swap(FlatHashMap&, FlatHashMap&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                   << "COPY, MOVE, ASSIGNMENT, SWAP, AND EQUALITY" << endl
+                   << "==========================================" << endl;
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        for (int n = 0; n < 40; n += 13) {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < n; ++i) {
+                mX.insert(makeEntry(i));
+            }
+
+            {
+                Obj mY(X, &za);  const Obj& Y = mY;
+
+                ASSERTV(n, X == Y);
+                ASSERTV(n, !(X != Y));
+                ASSERTV(n, &za == Y.allocator());
+                ASSERTV(n, hasEntries(Y, n));
+
+                mY[0] = "different";
+                ASSERTV(n, X != Y);
+            }
+            {
+                Obj mY(X, &oa);
+
+                const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+
+                Obj mZ(MoveUtil::move(mY));
+                ASSERTV(n, hasEntries(mZ, n));
+                ASSERTV(n, NUM_BLOCKS == oa.numBlocksTotal());
+
+                Obj mW(MoveUtil::move(mZ), &za);
+                ASSERTV(n, hasEntries(mW, n));
+                ASSERTV(n, &za == mW.allocator());
+            }
+            {
+                Obj mY(&za);
+                mY[1000] = "value";
+
+                mY = X;
+                ASSERTV(n, hasEntries(mY, n));
+                ASSERTV(n, &za == mY.allocator());
+
+                Obj mZ(&oa);
+                mZ = MoveUtil::move(mY);
+                ASSERTV(n, hasEntries(mZ, n));
+                ASSERTV(n, &oa == mZ.allocator());
+            }
+            {
+                Obj mY(&oa);
+                mY[1000] = "value";
+                const Obj YY(mY, &za);
+
+                Obj mZ(X, &oa);
+                mZ.swap(mY);
+                ASSERTV(n, X  == mY);
+                ASSERTV(n, YY == mZ);
+
+                Obj mW(X, &za);
+                swap(mZ, mW);
+                ASSERTV(n, X  == mZ);
+                ASSERTV(n, YY == mW);
+                ASSERTV(n, &oa == mZ.allocator());
+                ASSERTV(n, &za == mW.allocator());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&oa);
+            Obj mY(&oa);
+            Obj mZ(&za);
+
+            ASSERT_SAFE_PASS(mX.swap(mY));
+            ASSERT_SAFE_FAIL(mX.swap(mZ));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'operator[]', 'at', AND 'try_emplace'
+        //
+        // Concerns:
+        //: 1 'operator[]' and 'try_emplace' insert an entry having a default
+        //:   constructed value, using the allocator of the map, if the key is
+        //:   absent, and otherwise leave the map unchanged.
+        //:
+        //: 2 'operator[]' returns a reference to the value, which can be
+        //:   modified.
+        //:
+        //: 3 'at' returns a reference to the value of a present key, and
+        //:   throws 'bsl::out_of_range' for an absent key.
+        //:
+        //: 4 'operator[]' is exception neutral.
+        //
+        // Plan:
+        //: 1 Call each method, with lvalue and movable keys, and verify the
+        //:   return values and the state of the map.  (C-1..3)
+        //:
+        //: 2 Call 'operator[]' with allocating keys in the loop of the
+        //:   'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros.  (C-4)
+        //
+        // Testing:
+        //   VALUE& operator[](const KEY&);
+        //   VALUE& operator[](MovableRef<KEY>);
+        //   VALUE& at(const KEY&);
+        //   pair<iterator, bool> try_emplace(const KEY&);
+        //   pair<iterator, bool> try_emplace(MovableRef<KEY>);
+        //   const VALUE& at(const KEY&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'operator[]', 'at', AND 'try_emplace'" << endl
+                          << "=====================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            bsl::string& v = mX[1];
+            ASSERT(v.empty());
+            ASSERT(&oa == v.get_allocator().mechanism());
+            ASSERT(1 == X.size());
+
+            v = makeString(1);
+            ASSERT(makeString(1) == mX[1]);
+            ASSERT(1 == X.size());
+
+            int key = 2;
+            mX[bslmf::MovableRefUtil::move(key)] = makeString(2);
+            ASSERT(2 == X.size());
+            ASSERT(makeString(2) == X.at(2));
+
+            bsl::pair<Obj::iterator, bool> rv = mX.try_emplace(3);
+            ASSERT(true == rv.second);
+            ASSERT(3 == rv.first->first);
+            ASSERT(rv.first->second.empty());
+
+            rv = mX.try_emplace(1);
+            ASSERT(false == rv.second);
+            ASSERT(makeString(1) == rv.first->second);
+
+            key = 4;
+            rv = mX.try_emplace(bslmf::MovableRefUtil::move(key));
+            ASSERT(true == rv.second);
+            ASSERT(4 == X.size());
+
+            mX.at(4) = "four";
+            ASSERT("four" == X.at(4));
+
+#if defined(BDE_BUILD_TARGET_EXC)
+            bool caught = false;
+            try {
+                mX.at(5);
+            }
+            catch (const bsl::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            caught = false;
+            try {
+                X.at(5);
+            }
+            catch (const bsl::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(4 == X.size());
+#endif
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        {
+            typedef bdlc::FlatHashMap<bsl::string, bsl::string> StringMap;
+
+            StringMap mX(&oa);  const StringMap& X = mX;
+
+            for (int i = 0; i < 40; ++i) {
+                const bsl::string KEY = makeString(i);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    mX[KEY] = KEY;
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(i, static_cast<bsl::size_t>(i + 1) == X.size());
+                ASSERTV(i, KEY == X.at(KEY));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // RANGE AND INITIALIZER LIST CONSTRUCTORS
+        //
+        // Concerns:
+        //: 1 The range constructors insert each entry of the range, ignoring
+        //:   entries whose keys are already present, and use the supplied
+        //:   capacity, functors, and allocator.
+        //:
+        //: 2 The range 'insert' inserts each entry of the range.
+        //:
+        //: 3 The initializer list constructors, assignment, and 'insert'
+        //:   behave as the corresponding range methods.
+        //
+        // Plan:
+        //: 1 Create maps from ranges and initializer lists, having duplicate
+        //:   keys, with each constructor and verify the entries, capacity,
+        //:   functors, and allocator.  (C-1..3)
+        //
+        // Testing:
+        //   FlatHashMap(INPUT_ITER, INPUT_ITER, bslma::Allocator *);
+        //   FlatHashMap(INPUT_ITER, INPUT_ITER, size_t, bslma::Allocator *);
+        //   FlatHashMap(INPUT_ITER, INPUT_ITER, size_t, const HASH&, Alloc *);
+        //   FlatHashMap(INPUT_ITER, INPUT_ITER, size_t, HASH, EQUAL, Alloc *);
+        //   FlatHashMap(initializer_list, bslma::Allocator *);
+        //   FlatHashMap(initializer_list, size_t, bslma::Allocator *);
+        //   FlatHashMap(initializer_list, size_t, const HASH&, Alloc *);
+        //   FlatHashMap(initializer_list, size_t, HASH, EQUAL, Alloc *);
+        //   FlatHashMap& operator=(initializer_list);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(initializer_list);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                       << "RANGE AND INITIALIZER LIST CONSTRUCTORS" << endl
+                       << "=======================================" << endl;
+
+        typedef bdlc::FlatHashMap<int, bsl::string, SeededHash, ModEqual>
+                                                                   CustomMap;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        bsl::vector<Entry> entries;
+        for (int i = 0; i < 50; ++i) {
+            entries.push_back(makeEntry(i));
+        }
+        entries.push_back(Entry(7, "ignored duplicate"));
+
+        {
+            const Obj X(entries.begin(), entries.end(), &oa);
+            ASSERT(hasEntries(X, 50));
+            ASSERT(&oa == X.allocator());
+
+            const Obj Y(entries.begin(), entries.end(), 512, &oa);
+            ASSERT(hasEntries(Y, 50));
+            ASSERT(512 == Y.capacity());
+
+            const CustomMap Z(entries.begin(),
+                              entries.end(),
+                              0,
+                              SeededHash(5),
+                              &oa);
+            ASSERT(hasEntries(Z, 50));
+            ASSERT(5 == Z.hash_function().d_seed);
+
+            const CustomMap W(entries.begin(),
+                              entries.end(),
+                              0,
+                              SeededHash(6),
+                              ModEqual(),
+                              &oa);
+            ASSERT(hasEntries(W, 50));
+            ASSERT(6 == W.hash_function().d_seed);
+            ASSERT(W.contains(1007));
+
+            Obj mV(&oa);
+            mV.insert(entries.begin(), entries.end());
+            ASSERT(hasEntries(mV, 50));
+            ASSERT(X == mV);
+        }
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        {
+            const Obj X({ makeEntry(0), makeEntry(1), makeEntry(0) }, &oa);
+            ASSERT(hasEntries(X, 2));
+
+            const Obj Y({ makeEntry(0), makeEntry(1) }, 64, &oa);
+            ASSERT(hasEntries(Y, 2));
+            ASSERT(64 == Y.capacity());
+
+            const CustomMap Z({ makeEntry(0) }, 0, SeededHash(3), &oa);
+            ASSERT(hasEntries(Z, 1));
+            ASSERT(3 == Z.hash_function().d_seed);
+
+            const CustomMap W({ makeEntry(0), makeEntry(1) },
+                              0,
+                              SeededHash(4),
+                              ModEqual(),
+                              &oa);
+            ASSERT(hasEntries(W, 2));
+            ASSERT(W.contains(1001));
+
+            Obj mV(&oa);
+            mV.insert(makeEntry(7));
+            mV = { makeEntry(0), makeEntry(1), makeEntry(2) };
+            ASSERT(hasEntries(mV, 3));
+
+            mV.insert({ makeEntry(3), makeEntry(0) });
+            ASSERT(hasEntries(mV, 4));
+        }
+#endif
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS, INSERTION, AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor taking a capacity creates an empty map having
+        //:   the supplied capacity, functors, and allocator, and the default
+        //:   allocator if none is supplied.
+        //:
+        //: 2 'insert' inserts an entry if and only if its key is absent, and
+        //:   the accessors forward to the table.
+        //:
+        //: 3 The destructor releases all memory.
+        //
+        // Plan:
+        //: 1 Create maps with each constructor and verify their state.  (C-1)
+        //:
+        //: 2 Insert entries by copy and by move and verify the results of
+        //:   each accessor and the memory in use.  (C-2,3)
+        //
+        // Testing:
+        //   FlatHashMap();
+        //   FlatHashMap(bslma::Allocator *);
+        //   FlatHashMap(size_t);
+        //   FlatHashMap(size_t, bslma::Allocator *);
+        //   FlatHashMap(size_t, const HASH&, bslma::Allocator *);
+        //   FlatHashMap(size_t, const HASH&, const EQUAL&, Allocator *);
+        //   ~FlatHashMap();
+        //   iterator find(const KEY&);
+        //   pair<iterator, bool> insert(const value_type&);
+        //   pair<iterator, bool> insert(MovableRef<value_type>);
+        //   iterator begin();
+        //   iterator end();
+        //   size_t capacity() const;
+        //   bool contains(const KEY&) const;
+        //   size_t count(const KEY&) const;
+        //   bool empty() const;
+        //   const_iterator find(const KEY&) const;
+        //   HASH hash_function() const;
+        //   EQUAL key_eq() const;
+        //   size_t size() const;
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator cend() const;
+        //   const_iterator end() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                  << "CONSTRUCTORS, INSERTION, AND BASIC ACCESSORS" << endl
+                  << "============================================" << endl;
+
+        typedef bdlc::FlatHashMap<int, bsl::string, SeededHash, ModEqual>
+                                                                   CustomMap;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            const Obj A;
+            const Obj B(&oa);
+            const Obj C(20);
+            const Obj D(20, &oa);
+            const CustomMap E(0, SeededHash(7), &oa);
+            const CustomMap F(100, SeededHash(8), ModEqual(), &oa);
+
+            ASSERT(&defaultAllocator == A.allocator());
+            ASSERT(&oa               == B.allocator());
+            ASSERT(&defaultAllocator == C.allocator());
+            ASSERT(&oa               == D.allocator());
+            ASSERT(&oa               == E.allocator());
+            ASSERT(&oa               == F.allocator());
+
+            ASSERT(  0 == A.capacity());
+            ASSERT(  0 == B.capacity());
+            ASSERT( 32 == C.capacity());
+            ASSERT( 32 == D.capacity());
+            ASSERT(  0 == E.capacity());
+            ASSERT(128 == F.capacity());
+
+            ASSERT(7 == E.hash_function().d_seed);
+            ASSERT(8 == F.hash_function().d_seed);
+            ASSERT(true == F.key_eq()(1, 1001));
+
+            ASSERT(A.empty());
+            ASSERT(F.empty());
+            ASSERT(0 == F.size());
+            ASSERT(F.begin()  == F.end());
+            ASSERT(F.cbegin() == F.cend());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int i = 0; i < 100; ++i) {
+                Entry entry = makeEntry(i);
+
+                bsl::pair<Obj::iterator, bool> rv =
+                         i % 2 ? mX.insert(entry)
+                               : mX.insert(bslmf::MovableRefUtil::move(entry));
+                ASSERTV(i, rv.second);
+                ASSERTV(i, makeEntry(i) == *rv.first);
+                ASSERTV(i,
+                        &oa == rv.first->second.get_allocator().mechanism());
+
+                rv = mX.insert(Entry(i, "duplicate"));
+                ASSERTV(i, !rv.second);
+                ASSERTV(i, makeEntry(i) == *rv.first);
+
+                ASSERTV(i, hasEntries(X, i + 1));
+                ASSERTV(i, X.contains(i));
+                ASSERTV(i, 1 == X.count(i));
+                ASSERTV(i, !X.contains(i + 1));
+                ASSERTV(i, X.end() == X.find(i + 1));
+                ASSERTV(i, mX.find(i) == X.find(i));
+            }
+
+            int count = 0;
+            for (Obj::iterator it = mX.begin(); it != mX.end(); ++it) {
+                ASSERTV(it->first, makeString(it->first) == it->second);
+                ++count;
+            }
+            ASSERT(100 == count);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a map, insert, find, and erase a few entries, and copy
+        //:   the map.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX[1] = "one";
+            mX[2] = "two";
+            mX.insert(Entry(3, "three"));
+
+            ASSERT(3 == X.size());
+            ASSERT("two" == X.at(2));
+            ASSERT(X.contains(3));
+            ASSERT(!X.contains(4));
+
+            ASSERT(1 == mX.erase(2));
+            ASSERT(2 == X.size());
+
+            Obj mY(X, &oa);  const Obj& Y = mY;
+            ASSERT(X == Y);
+
+            mY[1] = "uno";
+            ASSERT(X != Y);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE COMPARISON WITH 'bsl::unordered_map'
+        //   Compare the time taken by 'bdlc::FlatHashMap' and
+        //   'bsl::unordered_map' for the basic operations.  Command line
+        //   parameters:
+        //   2nd parameter: number of keys (defaults to 100000).
+        //   3rd parameter: number of repetitions (defaults to 10).
+        //
+        // Concerns:
+        //: 1 Report the average time to insert, find with and without
+        //:   success, and erase, for 'int' and 'bsl::string' keys.
+        //
+        // Plan:
+        //: 1 Generate pseudo-random present and missing keys, and time each
+        //:   operation on each map type using 'bsls::Stopwatch'.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE COMPARISON WITH 'bsl::unordered_map'
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE COMPARISON WITH 'bsl::unordered_map'" << endl
+             << "================================================" << endl;
+
+        const int numKeys        = argc > 2 ? atoi(argv[2]) : 100000;
+        const int numRepetitions = argc > 3 ? atoi(argv[3]) : 10;
+
+        bsl::vector<int>         intKeys;
+        bsl::vector<int>         missingIntKeys;
+        bsl::vector<bsl::string> stringKeys;
+        bsl::vector<bsl::string> missingStringKeys;
+
+        {
+            bsl::unordered_map<int, int> unique;
+
+            unsigned int seed = 12345;
+            while (intKeys.size() < static_cast<bsl::size_t>(numKeys)) {
+                seed = seed * 1103515245u + 12345u;
+                const int key = static_cast<int>(seed >> 1);
+                if (unique.insert(bsl::make_pair(key, 0)).second) {
+                    intKeys.push_back(key);
+                }
+            }
+            while (missingIntKeys.size() < static_cast<bsl::size_t>(numKeys)) {
+                seed = seed * 1103515245u + 12345u;
+                const int key = static_cast<int>(seed >> 1);
+                if (unique.insert(bsl::make_pair(key, 0)).second) {
+                    missingIntKeys.push_back(key);
+                }
+            }
+        }
+        for (int i = 0; i < numKeys; ++i) {
+            stringKeys.push_back(makeString(intKeys[i]));
+            missingStringKeys.push_back(makeString(missingIntKeys[i]));
+        }
+
+        PerformanceUtil::run<bsl::unordered_map<int, int> >(
+                                                    "bsl::unordered_map<int>",
+                                                    intKeys,
+                                                    missingIntKeys,
+                                                    numRepetitions);
+        PerformanceUtil::run<bdlc::FlatHashMap<int, int> >(
+                                                    "bdlc::FlatHashMap<int>",
+                                                    intKeys,
+                                                    missingIntKeys,
+                                                    numRepetitions);
+        PerformanceUtil::run<bsl::unordered_map<bsl::string, int> >(
+                                                 "bsl::unordered_map<string>",
+                                                 stringKeys,
+                                                 missingStringKeys,
+                                                 numRepetitions);
+        PerformanceUtil::run<bdlc::FlatHashMap<bsl::string, int> >(
+                                                 "bdlc::FlatHashMap<string>",
+                                                 stringKeys,
+                                                 missingStringKeys,
+                                                 numRepetitions);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
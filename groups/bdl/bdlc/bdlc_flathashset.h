@@ -0,0 +1,1123 @@
+// bdlc_flathashset.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHSET
+#define INCLUDED_BDLC_FLATHASHSET
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed unordered set container.
+//
+//@CLASSES:
+//  bdlc::FlatHashSet: open-addressed unordered set container
+//  bdlc::FlatHashSet_EntryUtil: 'bdlc::FlatHashTable' entry utility for sets
+//
+//@SEE_ALSO: bdlc_flathashtable, bdlc_flathashmap, bslstl_unorderedset
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::FlatHashSet', that implements an open-addressed unordered set of
+// unique keys.
+//
+// Unordered sets are useful in situations when there is no meaningful way to
+// order key values, when the order of the values is irrelevant to the problem
+// domain, or (even if there is a meaningful ordering) the value of ordering
+// the results is outweighed by the higher performance provided by unordered
+// sets (compared to ordered sets).
+//
+// The implementation of 'bdlc::FlatHashSet' stores its keys in a single
+// contiguous array of slots, and inspects the control bytes of a group of 16
+// slots at once (using SSE2 instructions where available) to locate the slot
+// of a key (see 'bdlc_flathashtable').  Compared to 'bsl::unordered_set',
+// 'bdlc::FlatHashSet' performs no allocation on insertion unless it must grow,
+// but every change in capacity invalidates all iterators, pointers, and
+// references to elements, and the maximum load factor (7/8) is not
+// configurable.
+//
+// The default hash functor of 'bdlc::FlatHashSet' is 'bslh::Hash<>', whose
+// results have well-distributed bits, as required by the table (see
+// 'bdlc_flathashtable').  A client supplying a 'HASH' whose results lack
+// that property (e.g., 'bsl::hash<int>') should wrap it in a
+// 'bslh::FibonacciBadHashWrapper'.
+//
+///Requirements on 'KEY'
+///---------------------
+// The (template parameter) type 'KEY' must be copy or move constructible,
+// and, if it is allocator-aware, must use 'bslma' allocators.  'KEY' must be
+// equality comparable to use the equality operators of 'bdlc::FlatHashSet'.
+//
+///Exception Safety
+///----------------
+// A 'bdlc::FlatHashSet' is exception neutral, and all of the methods of
+// 'bdlc::FlatHashSet' provide the basic exception safety guarantee (see
+// {'bsldoc_glossary'|Basic Guarantee}).
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Categorizing Data
+/// - - - - - - - - - - - - - -
+// Suppose one is analyzing data on a set of customers, and each customer is
+// categorized by several attributes: customer type, geographic area, and
+// (internal) project code; and that each attribute takes on one of a limited
+// set of values.  Moreover, suppose one wishes to know the set of attribute
+// combinations that occur, without regard to how often each occurs.
+//
+// First, we define an integer encoding of the attribute combinations, and
+// the type of set used to collect them:
+//..
+//  int encode(int customerType, int geographicArea, int projectCode)
+//      // Return the integer encoding of the specified 'customerType',
+//      // 'geographicArea', and 'projectCode'.
+//  {
+//      return (customerType * 100 + geographicArea) * 100 + projectCode;
+//  }
+//
+//  typedef bdlc::FlatHashSet<int> CombinationSet;
+//..
+// Then, we define the data to be analyzed:
+//..
+//  struct CustomerProfile {
+//      int d_customerType;
+//      int d_geographicArea;
+//      int d_projectCode;
+//  } const customerProfiles[] = {
+//      { 2, 1, 5 },
+//      { 1, 4, 3 },
+//      { 2, 1, 5 },
+//      { 3, 2, 1 },
+//      { 1, 4, 3 },
+//      { 2, 1, 4 },
+//  };
+//  const int numCustomerProfiles = sizeof  customerProfiles
+//                                / sizeof *customerProfiles;
+//..
+// Next, we insert the encoding of each profile into the set, noting that the
+// insertion of an encoding already in the set has no effect:
+//..
+//  CombinationSet combinations;
+//
+//  for (int i = 0; i < numCustomerProfiles; ++i) {
+//      const CustomerProfile& p = customerProfiles[i];
+//
+//      combinations.insert(encode(p.d_customerType,
+//                                 p.d_geographicArea,
+//                                 p.d_projectCode));
+//  }
+//..
+// Finally, we verify the number of distinct combinations, and inquire about
+// some of them:
+//..
+//  assert(4    == combinations.size());
+//  assert(true == combinations.contains(encode(2, 1, 5)));
+//  assert(0    == combinations.count(encode(3, 1, 5)));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlc_flathashtable.h>
+
+#include <bslh_hash.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_utility.h>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+#include <bsl_initializer_list.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                        // ============================
+                        // struct FlatHashSet_EntryUtil
+                        // ============================
+
+template <class ENTRY>
+struct FlatHashSet_EntryUtil {
+    // This templated utility provides methods to construct an 'ENTRY' and a
+    // method to extract the key from an 'ENTRY', as required by
+    // 'bdlc::FlatHashTable'.  The key of an 'ENTRY' is the entry itself.
+
+    // CLASS METHODS
+    static void constructFromKey(ENTRY            *entry,
+                                 bslma::Allocator *allocator,
+                                 const ENTRY&      key);
+    static void constructFromKey(ENTRY                    *entry,
+                                 bslma::Allocator         *allocator,
+                                 bslmf::MovableRef<ENTRY>  key);
+        // Load into the specified 'entry' the specified 'key', using the
+        // specified 'allocator' to supply memory.  'allocator' is ignored if
+        // the (template parameter) type 'ENTRY' is not allocator aware.
+
+    static const ENTRY& key(const ENTRY& entry);
+        // Return the specified 'entry'.
+};
+
+                            // =================
+                            // class FlatHashSet
+                            // =================
+
+template <class KEY,
+          class HASH  = bslh::Hash<>,
+          class EQUAL = bsl::equal_to<KEY> >
+class FlatHashSet {
+    // This class template implements a value-semantic container type holding
+    // an unordered set of unique values of (template parameter) type 'KEY',
+    // stored in an open-addressed hash table.  The (template parameter)
+    // types 'HASH' and 'EQUAL' are the hash and key-equality functors.
+
+    // PRIVATE TYPES
+    typedef FlatHashTable<KEY,
+                          KEY,
+                          FlatHashSet_EntryUtil<KEY>,
+                          HASH,
+                          EQUAL> ImplType;
+        // This is the underlying implementation class.
+
+    typedef bslmf::MovableRefUtil MoveUtil;
+
+    // FRIENDS
+    template <class K, class H, class E>
+    friend bool operator==(const FlatHashSet<K, H, E>&,
+                           const FlatHashSet<K, H, E>&);
+
+    // DATA
+    ImplType d_impl;  // underlying flat hash table used by this flat hash set
+
+  public:
+    // TYPES
+    typedef KEY                                   key_type;
+    typedef KEY                                   value_type;
+    typedef bsl::size_t                           size_type;
+    typedef bsl::ptrdiff_t                        difference_type;
+    typedef EQUAL                                 key_compare;
+    typedef HASH                                  hasher;
+    typedef value_type&                           reference;
+    typedef const value_type&                     const_reference;
+    typedef value_type                           *pointer;
+    typedef const value_type                     *const_pointer;
+    typedef typename ImplType::const_iterator     iterator;
+    typedef typename ImplType::const_iterator     const_iterator;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatHashSet, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    FlatHashSet();
+    explicit FlatHashSet(bslma::Allocator *basicAllocator);
+    explicit FlatHashSet(bsl::size_t capacity);
+    FlatHashSet(bsl::size_t capacity, bslma::Allocator *basicAllocator);
+    FlatHashSet(bsl::size_t       capacity,
+                const HASH&       hash,
+                bslma::Allocator *basicAllocator = 0);
+    FlatHashSet(bsl::size_t       capacity,
+                const HASH&       hash,
+                const EQUAL&      equal,
+                bslma::Allocator *basicAllocator = 0);
+        // Create an empty 'FlatHashSet' object.  Optionally specify a
+        // 'capacity' indicating the minimum initial size of the underlying
+        // array of entries of this container.  If 'capacity' is not supplied
+        // or is 0, no memory is allocated.  Optionally specify a 'hash'
+        // functor used to generate the hash values associated with the
+        // elements in this container.  If 'hash' is not supplied, a
+        // default-constructed object of the (template parameter) type 'HASH'
+        // is used.  Optionally specify an equality functor 'equal' used to
+        // determine whether two elements are equivalent.  If 'equal' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'EQUAL' is used.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is not supplied or is 0, the
+        // currently installed default allocator is used.
+
+    template <class INPUT_ITERATOR>
+    FlatHashSet(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    FlatHashSet(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bsl::size_t       capacity,
+                bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    FlatHashSet(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bsl::size_t       capacity,
+                const HASH&       hash,
+                bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    FlatHashSet(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bsl::size_t       capacity,
+                const HASH&       hash,
+                const EQUAL&      equal,
+                bslma::Allocator *basicAllocator = 0);
+        // Create a 'FlatHashSet' object initialized by insertion of the values
+        // from the input iterator range specified by 'first' through 'last'
+        // (including 'first', excluding 'last').  Optionally specify a
+        // 'capacity' indicating the minimum initial size of the underlying
+        // array of entries of this container.  If 'capacity' is not supplied
+        // or is 0, no memory is allocated by this constructor (but it may be
+        // by the insertions).  Optionally specify a 'hash' functor used to
+        // generate hash values associated with the elements in this
+        // container.  If 'hash' is not supplied, a default-constructed object
+        // of the (template parameter) type 'HASH' is used.  Optionally specify
+        // an equality functor 'equal' used to determine whether two elements
+        // are equivalent.  If 'equal' is not supplied, a default-constructed
+        // object of the (template parameter) type 'EQUAL' is used.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is not supplied or is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless 'first'
+        // and 'last' refer to a sequence of valid values where 'first' is at
+        // a position at or before 'last'.  Note that if a member of the input
+        // sequence is equivalent to an earlier member, the later member will
+        // not be inserted.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    FlatHashSet(bsl::initializer_list<KEY>  values,
+                bslma::Allocator           *basicAllocator = 0);
+    FlatHashSet(bsl::initializer_list<KEY>  values,
+                bsl::size_t                 capacity,
+                bslma::Allocator           *basicAllocator = 0);
+    FlatHashSet(bsl::initializer_list<KEY>  values,
+                bsl::size_t                 capacity,
+                const HASH&                 hash,
+                bslma::Allocator           *basicAllocator = 0);
+    FlatHashSet(bsl::initializer_list<KEY>  values,
+                bsl::size_t                 capacity,
+                const HASH&                 hash,
+                const EQUAL&                equal,
+                bslma::Allocator           *basicAllocator = 0);
+        // Create a 'FlatHashSet' object initialized by insertion of the
+        // specified 'values'.  Optionally specify a 'capacity' indicating the
+        // minimum initial size of the underlying array of entries of this
+        // container.  If 'capacity' is not supplied or is 0, no memory is
+        // allocated by this constructor (but it may be by the insertions).
+        // Optionally specify a 'hash' functor used to generate hash values
+        // associated with the elements in this container.  If 'hash' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'HASH' is used.  Optionally specify an equality functor 'equal'
+        // used to determine whether two elements are equivalent.  If 'equal'
+        // is not supplied, a default-constructed object of the (template
+        // parameter) type 'EQUAL' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // supplied or is 0, the currently installed default allocator is used.
+        // Note that if a member of 'values' is equivalent to an earlier
+        // member, the later member will not be inserted.
+#endif
+
+    FlatHashSet(const FlatHashSet&  original,
+                bslma::Allocator   *basicAllocator = 0);
+        // Create a 'FlatHashSet' object having the same value, hasher, and
+        // equality comparator as the specified 'original' object.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is not specified or is 0, the currently installed
+        // default allocator is used.
+
+    FlatHashSet(bslmf::MovableRef<FlatHashSet> original);
+        // Create a 'FlatHashSet' object having the same value, hasher,
+        // equality comparator, and allocator as the specified 'original'
+        // object.  The contents of 'original' are moved (in constant time) to
+        // this object, 'original' is left in a (valid) unspecified state, and
+        // no exceptions will be thrown.
+
+    FlatHashSet(bslmf::MovableRef<FlatHashSet>  original,
+                bslma::Allocator               *basicAllocator);
+        // Create a 'FlatHashSet' object having the same value, hasher, and
+        // equality comparator as the specified 'original' object, using the
+        // specified 'basicAllocator' to supply memory.  If 'basicAllocator'
+        // is 0, the currently installed default allocator is used.  The
+        // contents of 'original' are moved (in constant time) to this object
+        // if 'basicAllocator == original.allocator()', and are move-inserted
+        // (in linear time) using 'basicAllocator' otherwise.  'original' is
+        // left in a (valid) unspecified state.
+
+    //! ~FlatHashSet() = default;
+        // Destroy this object and each of its elements.
+
+    // MANIPULATORS
+    FlatHashSet& operator=(const FlatHashSet& rhs);
+        // Assign to this object the value, hasher, and equality functor of
+        // the specified 'rhs' object, and return a reference providing
+        // modifiable access to this object.
+
+    FlatHashSet& operator=(bslmf::MovableRef<FlatHashSet> rhs);
+        // Assign to this object the value, hasher, and equality comparator of
+        // the specified 'rhs' object, and return a reference providing
+        // modifiable access to this object.  The contents of 'rhs' are moved
+        // (in constant time) to this object if
+        // 'rhs.allocator() == allocator()', and are move-inserted (in linear
+        // time) using 'allocator()' otherwise.  'rhs' is left in a (valid)
+        // unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    FlatHashSet& operator=(bsl::initializer_list<KEY> values);
+        // Assign to this object the value resulting from first clearing this
+        // set and then inserting each object in the specified 'values'
+        // initializer list, ignoring those objects equivalent to one that
+        // appears earlier in the list; return a reference providing
+        // modifiable access to this object.
+#endif
+
+    void clear();
+        // Remove all elements from this set.  Note that this set will be
+        // empty after calling this method, but allocated memory may be
+        // retained for future use.  See the 'capacity' method.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(const KEY& key);
+        // Return a pair of iterators defining the sequence of elements in
+        // this set equal to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence and the second iterator is
+        // positioned one past the end of the sequence.  If this set contains
+        // no elements equal to 'key', then the two returned iterators will
+        // have the same value.  Note that since a set maintains unique keys,
+        // the range will contain at most one element.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove from this set the element equal to the specified 'key', if
+        // it exists, and return 1; otherwise (there is no element equal to
+        // 'key' in this set), return 0 with no other effect.
+
+    const_iterator erase(const_iterator position);
+        // Remove from this set the element at the specified 'position', and
+        // return an iterator referring to the element immediately following
+        // the removed element, or to the past-the-end position if the removed
+        // element was the last element in the sequence of elements maintained
+        // by this set.  The behavior is undefined unless 'position' refers to
+        // an element in this set.
+
+    const_iterator erase(const_iterator first, const_iterator last);
+        // Remove from this set the elements starting at the specified 'first'
+        // position up to, but not including, the specified 'last' position,
+        // and return 'last'.  The behavior is undefined unless 'first' and
+        // 'last' either refer to elements in this set or are the 'end'
+        // iterator, and the 'first' position is at or before the 'last'
+        // position in the iteration sequence provided by this container.
+
+    bsl::pair<const_iterator, bool> insert(const KEY& value);
+    bsl::pair<const_iterator, bool> insert(bslmf::MovableRef<KEY> value);
+        // Insert the specified 'value' into this set if 'value' does not
+        // already exist in this set; otherwise, this method has no effect.
+        // Return a 'pair' whose 'first' member is an iterator referring to the
+        // (possibly newly inserted) element in this set that is equal to
+        // 'value', and whose 'second' member is 'true' if a new value was
+        // inserted, and 'false' if the value was already present.  If 'value'
+        // is moved, 'value' is left in a valid but unspecified state.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this set the value of each element in the range
+        // starting at the specified 'first' iterator and ending immediately
+        // before the specified 'last' iterator that is not already contained
+        // in this set.  The behavior is undefined unless 'first' and 'last'
+        // refer to a sequence of valid values where 'first' is at a position
+        // at or before 'last'.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(bsl::initializer_list<KEY> values);
+        // Insert into this set the value of each element in the specified
+        // 'values' initializer list that is not already contained in this
+        // set.
+#endif
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Change the capacity of this set to at least the specified
+        // 'minimumCapacity', and redistribute all the contained elements into
+        // a new sequence of entries, according to their hash values.  If
+        // '0 == minimumCapacity' and '0 == size()', the set is returned to
+        // the zero-capacity state.  On return, 'load_factor()' is less than
+        // or equal to 'max_load_factor()' and all iterators, pointers, and
+        // references to elements of this set are invalidated.
+
+    void reserve(bsl::size_t numEntries);
+        // Change the capacity of this set to at least a capacity that can
+        // accommodate the specified 'numEntries' (accounting for the load
+        // factor invariant), and redistribute all the contained elements
+        // into a new sequence of entries, according to their hash values.  If
+        // '0 == numEntries' and '0 == size()', the set is returned to the
+        // zero-capacity state.
+
+    void reset();
+        // Remove all elements from this set and release all memory from this
+        // set, returning the set to the zero-capacity state.
+
+                             // Aspects
+
+    void swap(FlatHashSet& other);
+        // Efficiently exchange the value, hasher, and equality functor of
+        // this object with those of the specified 'other' object.  This
+        // method provides the no-throw exception-safety guarantee if 'HASH'
+        // and 'EQUAL' can be swapped without throwing.  The behavior is
+        // undefined unless this object was created with the same allocator as
+        // 'other'.
+
+    // ACCESSORS
+    bsl::size_t capacity() const;
+        // Return the number of elements this set could hold if the load factor
+        // were 1.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this set contains an element equal to the
+        // specified 'key', and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements in this set equal to the specified
+        // 'key'.  Note that since a flat hash set maintains unique keys, the
+        // returned value will be either 0 or 1.
+
+    bool empty() const;
+        // Return 'true' if this set contains no elements, and 'false'
+        // otherwise.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(
+                                                         const KEY& key) const;
+        // Return a pair of iterators defining the sequence of elements in
+        // this set equal to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence and the second iterator is
+        // positioned one past the end of the sequence.  If this set contains
+        // no elements equal to 'key', then the two returned iterators will
+        // have the same value.  Note that since a set maintains unique keys,
+        // the range will contain at most one element.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator referring to the element in this set equal to
+        // the specified 'key', or 'end()' if no such element exists in this
+        // set.
+
+    HASH hash_function() const;
+        // Return (a copy of) the unary hash functor used by this set to
+        // generate a hash value (of type 'bsl::size_t') for a 'KEY' object.
+
+    EQUAL key_eq() const;
+        // Return (a copy of) the binary key-equality functor that returns
+        // 'true' if the value of two 'KEY' objects are equivalent, and 'false'
+        // otherwise.
+
+    float load_factor() const;
+        // Return the current ratio between the number of elements in this
+        // container and its capacity.
+
+    float max_load_factor() const;
+        // Return the maximum load factor allowed for this set, which is
+        // 0.875.  Note that if an insert operation would cause the load factor
+        // to exceed the 'max_load_factor', that same insert operation will
+        // increase the capacity and rehash the entries of the container (see
+        // {'insert'} and {'rehash'}).
+
+    bsl::size_t size() const;
+        // Return the number of elements in this set.
+
+                          // Iterators
+
+    const_iterator begin() const;
+        // Return an iterator representing the beginning of the sequence of
+        // elements held by this set.
+
+    const_iterator cbegin() const;
+        // Return an iterator representing the beginning of the sequence of
+        // elements held by this set.
+
+    const_iterator cend() const;
+        // Return an iterator representing the end of the sequence of elements
+        // held by this set.
+
+    const_iterator end() const;
+        // Return an iterator representing the end of the sequence of elements
+        // held by this set.
+
+                           // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this flat hash set to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class HASH, class EQUAL>
+bool operator==(const FlatHashSet<KEY, HASH, EQUAL> &lhs,
+                const FlatHashSet<KEY, HASH, EQUAL> &rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'FlatHashSet' objects have the same
+    // value if their sizes are the same and each element contained in one is
+    // equal to an element of the other.  The hash and equality functors are
+    // not involved in the comparison.
+
+template <class KEY, class HASH, class EQUAL>
+bool operator!=(const FlatHashSet<KEY, HASH, EQUAL> &lhs,
+                const FlatHashSet<KEY, HASH, EQUAL> &rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'FlatHashSet' objects do not
+    // have the same value if their sizes are different or one contains an
+    // element equal to no element of the other.  The hash and equality
+    // functors are not involved in the comparison.
+
+// FREE FUNCTIONS
+template <class KEY, class HASH, class EQUAL>
+void swap(FlatHashSet<KEY, HASH, EQUAL>& a, FlatHashSet<KEY, HASH, EQUAL>& b);
+    // Exchange the value, the hasher, and the key-equality functor of the
+    // specified 'a' and 'b' objects.  This function provides the no-throw
+    // exception-safety guarantee if the two objects were created with the
+    // same allocator and the basic guarantee otherwise.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // ----------------------------
+                        // struct FlatHashSet_EntryUtil
+                        // ----------------------------
+
+// CLASS METHODS
+template <class ENTRY>
+inline
+void FlatHashSet_EntryUtil<ENTRY>::constructFromKey(
+                                                  ENTRY            *entry,
+                                                  bslma::Allocator *allocator,
+                                                  const ENTRY&      key)
+{
+    BSLS_ASSERT_SAFE(entry);
+
+    bslma::ConstructionUtil::construct(entry, allocator, key);
+}
+
+template <class ENTRY>
+inline
+void FlatHashSet_EntryUtil<ENTRY>::constructFromKey(
+                                          ENTRY                    *entry,
+                                          bslma::Allocator         *allocator,
+                                          bslmf::MovableRef<ENTRY>  key)
+{
+    BSLS_ASSERT_SAFE(entry);
+
+    bslma::ConstructionUtil::construct(entry,
+                                       allocator,
+                                       bslmf::MovableRefUtil::move(key));
+}
+
+template <class ENTRY>
+inline
+const ENTRY& FlatHashSet_EntryUtil<ENTRY>::key(const ENTRY& entry)
+{
+    return entry;
+}
+
+                            // -----------------
+                            // class FlatHashSet
+                            // -----------------
+
+// CREATORS
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet()
+: d_impl(0, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t capacity)
+: d_impl(capacity, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t       capacity,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t       capacity,
+                                           const HASH&       hash,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t       capacity,
+                                           const HASH&       hash,
+                                           const EQUAL&      equal,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(INPUT_ITERATOR    first,
+                                           INPUT_ITERATOR    last,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(INPUT_ITERATOR    first,
+                                           INPUT_ITERATOR    last,
+                                           bsl::size_t       capacity,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(INPUT_ITERATOR    first,
+                                           INPUT_ITERATOR    last,
+                                           bsl::size_t       capacity,
+                                           const HASH&       hash,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, EQUAL(), basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(INPUT_ITERATOR    first,
+                                           INPUT_ITERATOR    last,
+                                           bsl::size_t       capacity,
+                                           const HASH&       hash,
+                                           const EQUAL&      equal,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+    insert(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(
+                                    bsl::initializer_list<KEY>  values,
+                                    bslma::Allocator           *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    insert(values.begin(), values.end());
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(
+                                    bsl::initializer_list<KEY>  values,
+                                    bsl::size_t                 capacity,
+                                    bslma::Allocator           *basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator)
+{
+    insert(values.begin(), values.end());
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(
+                                    bsl::initializer_list<KEY>  values,
+                                    bsl::size_t                 capacity,
+                                    const HASH&                 hash,
+                                    bslma::Allocator           *basicAllocator)
+: d_impl(capacity, hash, EQUAL(), basicAllocator)
+{
+    insert(values.begin(), values.end());
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(
+                                    bsl::initializer_list<KEY>  values,
+                                    bsl::size_t                 capacity,
+                                    const HASH&                 hash,
+                                    const EQUAL&                equal,
+                                    bslma::Allocator           *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+    insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(
+                                          const FlatHashSet&  original,
+                                          bslma::Allocator   *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(
+                                       bslmf::MovableRef<FlatHashSet> original)
+: d_impl(MoveUtil::move(MoveUtil::access(original).d_impl))
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(
+                              bslmf::MovableRef<FlatHashSet>  original,
+                              bslma::Allocator               *basicAllocator)
+: d_impl(MoveUtil::move(MoveUtil::access(original).d_impl), basicAllocator)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>&
+FlatHashSet<KEY, HASH, EQUAL>::operator=(const FlatHashSet& rhs)
+{
+    d_impl = rhs.d_impl;
+
+    return *this;
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>&
+FlatHashSet<KEY, HASH, EQUAL>::operator=(bslmf::MovableRef<FlatHashSet> rhs)
+{
+    FlatHashSet& lvalue = rhs;
+
+    d_impl = MoveUtil::move(lvalue.d_impl);
+
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>&
+FlatHashSet<KEY, HASH, EQUAL>::operator=(bsl::initializer_list<KEY> values)
+{
+    FlatHashSet tmp(values.begin(),
+                    values.end(),
+                    0,
+                    d_impl.hash_function(),
+                    d_impl.key_eq(),
+                    d_impl.allocator());
+
+    this->swap(tmp);
+
+    return *this;
+}
+#endif
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator,
+          typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator>
+FlatHashSet<KEY, HASH, EQUAL>::equal_range(const KEY& key)
+{
+    return static_cast<const ImplType&>(d_impl).equal_range(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::erase(const KEY& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_impl.erase(position);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::erase(const_iterator first,
+                                     const_iterator last)
+{
+    return d_impl.erase(first, last);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator, bool>
+FlatHashSet<KEY, HASH, EQUAL>::insert(const KEY& value)
+{
+    return d_impl.tryEmplace(value);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator, bool>
+FlatHashSet<KEY, HASH, EQUAL>::insert(bslmf::MovableRef<KEY> value)
+{
+    return d_impl.tryEmplace(MoveUtil::move(value));
+}
+
+template <class KEY, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::insert(INPUT_ITERATOR first,
+                                           INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        d_impl.tryEmplace(*first);
+    }
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::insert(bsl::initializer_list<KEY> values)
+{
+    insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::rehash(bsl::size_t minimumCapacity)
+{
+    d_impl.rehash(minimumCapacity);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::reserve(bsl::size_t numEntries)
+{
+    d_impl.reserve(numEntries);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::reset()
+{
+    d_impl.reset();
+}
+
+                             // Aspects
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::swap(FlatHashSet& other)
+{
+    BSLS_ASSERT_SAFE(allocator() == other.allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bool FlatHashSet<KEY, HASH, EQUAL>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::count(const KEY& key) const
+{
+    return d_impl.count(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bool FlatHashSet<KEY, HASH, EQUAL>::empty() const
+{
+    return d_impl.empty();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator,
+          typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator>
+FlatHashSet<KEY, HASH, EQUAL>::equal_range(const KEY& key) const
+{
+    return d_impl.equal_range(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::find(const KEY& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+HASH FlatHashSet<KEY, HASH, EQUAL>::hash_function() const
+{
+    return d_impl.hash_function();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+EQUAL FlatHashSet<KEY, HASH, EQUAL>::key_eq() const
+{
+    return d_impl.key_eq();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+float FlatHashSet<KEY, HASH, EQUAL>::load_factor() const
+{
+    return d_impl.load_factor();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+float FlatHashSet<KEY, HASH, EQUAL>::max_load_factor() const
+{
+    return d_impl.max_load_factor();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::size() const
+{
+    return d_impl.size();
+}
+
+                          // Iterators
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::cbegin() const
+{
+    return d_impl.cbegin();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::cend() const
+{
+    return d_impl.cend();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::end() const
+{
+    return d_impl.end();
+}
+
+                           // Aspects
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bslma::Allocator *FlatHashSet<KEY, HASH, EQUAL>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class HASH, class EQUAL>
+inline
+bool bdlc::operator==(const FlatHashSet<KEY, HASH, EQUAL> &lhs,
+                      const FlatHashSet<KEY, HASH, EQUAL> &rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(const FlatHashSet<KEY, HASH, EQUAL> &lhs,
+                      const FlatHashSet<KEY, HASH, EQUAL> &rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class HASH, class EQUAL>
+inline
+void bdlc::swap(FlatHashSet<KEY, HASH, EQUAL>& a,
+                FlatHashSet<KEY, HASH, EQUAL>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+
+        return;                                                       // RETURN
+    }
+
+    typedef FlatHashSet<KEY, HASH, EQUAL> Set;
+
+    Set futureA(b, a.allocator());
+    Set futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,844 @@
+// bdlc_flathashset.t.cpp                                             -*-C++-*-
+#include <bdlc_flathashset.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_review.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bdlc::FlatHashSet' is a thin wrapper over 'bdlc::FlatHashTable', which is
+// tested thoroughly in its own test driver.  This test driver verifies that
+// each method of the set forwards to the table, and tests the methods that
+// add behavior: the range and initializer list constructors, and the free
+// 'swap'.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatHashSet();
+// [ 2] FlatHashSet(bslma::Allocator *);
+// [ 2] FlatHashSet(size_t);
+// [ 2] FlatHashSet(size_t, bslma::Allocator *);
+// [ 2] FlatHashSet(size_t, const HASH&, bslma::Allocator *);
+// [ 2] FlatHashSet(size_t, const HASH&, const EQUAL&, Allocator *);
+// [ 3] FlatHashSet(INPUT_ITER, INPUT_ITER, bslma::Allocator *);
+// [ 3] FlatHashSet(INPUT_ITER, INPUT_ITER, size_t, bslma::Allocator *);
+// [ 3] FlatHashSet(INPUT_ITER, INPUT_ITER, size_t, const HASH&, Alloc *);
+// [ 3] FlatHashSet(INPUT_ITER, INPUT_ITER, size_t, HASH, EQUAL, Alloc *);
+// [ 3] FlatHashSet(initializer_list, bslma::Allocator *);
+// [ 3] FlatHashSet(initializer_list, size_t, bslma::Allocator *);
+// [ 3] FlatHashSet(initializer_list, size_t, const HASH&, Alloc *);
+// [ 3] FlatHashSet(initializer_list, size_t, HASH, EQUAL, Alloc *);
+// [ 4] FlatHashSet(const FlatHashSet&, bslma::Allocator *);
+// [ 4] FlatHashSet(MovableRef<FlatHashSet>);
+// [ 4] FlatHashSet(MovableRef<FlatHashSet>, bslma::Allocator *);
+// [ 2] ~FlatHashSet();
+//
+// MANIPULATORS
+// [ 4] FlatHashSet& operator=(const FlatHashSet&);
+// [ 4] FlatHashSet& operator=(MovableRef<FlatHashSet>);
+// [ 3] FlatHashSet& operator=(initializer_list);
+// [ 5] void clear();
+// [ 5] pair<const_iterator, const_iterator> equal_range(const KEY&);
+// [ 5] size_t erase(const KEY&);
+// [ 5] const_iterator erase(const_iterator);
+// [ 5] const_iterator erase(const_iterator, const_iterator);
+// [ 2] pair<const_iterator, bool> insert(const KEY&);
+// [ 2] pair<const_iterator, bool> insert(MovableRef<KEY>);
+// [ 3] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] void insert(initializer_list);
+// [ 5] void rehash(size_t);
+// [ 5] void reserve(size_t);
+// [ 5] void reset();
+// [ 4] void swap(FlatHashSet&);
+//
+// ACCESSORS
+// [ 2] size_t capacity() const;
+// [ 2] bool contains(const KEY&) const;
+// [ 2] size_t count(const KEY&) const;
+// [ 2] bool empty() const;
+// [ 5] pair<const_iter, const_iter> equal_range(const KEY&) const;
+// [ 2] const_iterator find(const KEY&) const;
+// [ 2] HASH hash_function() const;
+// [ 2] EQUAL key_eq() const;
+// [ 5] float load_factor() const;
+// [ 5] float max_load_factor() const;
+// [ 2] size_t size() const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator cbegin() const;
+// [ 2] const_iterator cend() const;
+// [ 2] const_iterator end() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const FlatHashSet&, const FlatHashSet&);
+// [ 4] bool operator!=(const FlatHashSet&, const FlatHashSet&);
+// [ 4] void swap(FlatHashSet&, FlatHashSet&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatHashSet<bsl::string> Obj;
+
+struct SeededHash {
+    // This functor hashes an 'int', modulo 1000 (consistently with
+    // 'ModEqual'), with a seed, so that the hash functor of a set can be
+    // identified.
+
+    int d_seed;
+
+    explicit SeededHash(int seed = 0)
+    : d_seed(seed)
+    {
+    }
+
+    bsl::size_t operator()(int key) const
+        // Return the hash value of the specified 'key'.
+    {
+        return bslh::Hash<>()(key % 1000 ^ d_seed);
+    }
+};
+
+struct ModEqual {
+    // This functor compares two 'int' keys modulo 1000, so that the equality
+    // functor of a set can be identified.
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' and 'rhs' are equal modulo
+        // 1000, and 'false' otherwise.
+    {
+        return lhs % 1000 == rhs % 1000;
+    }
+};
+
+typedef bdlc::FlatHashSet<int, SeededHash, ModEqual> CustomSet;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bsl::string makeString(int value)
+    // Return a string, too long for the short-string optimization, that is
+    // unique to the specified 'value'.
+{
+    bsl::ostringstream out;
+    out << "a string long enough to allocate memory: " << value;
+    return out.str();
+}
+
+template <class SET>
+static bool hasKeys(const SET& set, int numKeys)
+    // Return 'true' if the specified 'set' holds exactly the keys
+    // 'makeString(i)' for 'i' in '[0 .. numKeys)', and 'false' otherwise.
+{
+    if (set.size() != static_cast<bsl::size_t>(numKeys)) {
+        return false;                                                 // RETURN
+    }
+    for (int i = 0; i < numKeys; ++i) {
+        if (!set.contains(makeString(i))) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+int encode(int customerType, int geographicArea, int projectCode)
+    // Return the integer encoding of the specified 'customerType',
+    // 'geographicArea', and 'projectCode'.
+{
+    return (customerType * 100 + geographicArea) * 100 + projectCode;
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Categorizing Data
+/// - - - - - - - - - - - - - -
+// Suppose one is analyzing data on a set of customers, and each customer is
+// categorized by several attributes: customer type, geographic area, and
+// (internal) project code; and that each attribute takes on one of a limited
+// set of values.  Moreover, suppose one wishes to know the set of attribute
+// combinations that occur, without regard to how often each occurs.
+//
+// First, we define an integer encoding of the attribute combinations (see
+// 'encode' above), and the type of set used to collect them:
+//..
+    typedef bdlc::FlatHashSet<int> CombinationSet;
+//..
+// Then, we define the data to be analyzed:
+//..
+    struct CustomerProfile {
+        int d_customerType;
+        int d_geographicArea;
+        int d_projectCode;
+    } const customerProfiles[] = {
+        { 2, 1, 5 },
+        { 1, 4, 3 },
+        { 2, 1, 5 },
+        { 3, 2, 1 },
+        { 1, 4, 3 },
+        { 2, 1, 4 },
+    };
+    const int numCustomerProfiles = sizeof  customerProfiles
+                                  / sizeof *customerProfiles;
+//..
+// Next, we insert the encoding of each profile into the set, noting that the
+// insertion of an encoding already in the set has no effect:
+//..
+    CombinationSet combinations;
+
+    for (int i = 0; i < numCustomerProfiles; ++i) {
+        const CustomerProfile& p = customerProfiles[i];
+
+        combinations.insert(encode(p.d_customerType,
+                                   p.d_geographicArea,
+                                   p.d_projectCode));
+    }
+//..
+// Finally, we verify the number of distinct combinations, and inquire about
+// some of them:
+//..
+    ASSERT(4    == combinations.size());
+    ASSERT(true == combinations.contains(encode(2, 1, 5)));
+    ASSERT(0    == combinations.count(encode(3, 1, 5)));
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // FORWARDING MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 'erase', 'equal_range', 'clear', 'rehash', 'reserve', 'reset',
+        //:   'load_factor', and 'max_load_factor' forward to the table.
+        //
+        // Plan:
+        //: 1 Call each method on a populated set and verify the result and the
+        //:   state of the set.  (C-1)
+        //
+        // Testing:
+        //   void clear();
+        //   pair<const_iterator, const_iterator> equal_range(const KEY&);
+        //   size_t erase(const KEY&);
+        //   const_iterator erase(const_iterator);
+        //   const_iterator erase(const_iterator, const_iterator);
+        //   void rehash(size_t);
+        //   void reserve(size_t);
+        //   void reset();
+        //   pair<const_iter, const_iter> equal_range(const KEY&) const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                         << "FORWARDING MANIPULATORS AND ACCESSORS" << endl
+                         << "=====================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(0.875f == X.max_load_factor());
+
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(makeString(i));
+            }
+            ASSERT(X.load_factor() <= X.max_load_factor());
+            ASSERT(0.5f < X.load_factor());
+
+            bsl::pair<Obj::const_iterator, Obj::const_iterator> r =
+                                                mX.equal_range(makeString(10));
+            ASSERT(makeString(10) == *r.first);
+            ++r.first;
+            ASSERT(r.first == r.second);
+
+            r = X.equal_range(makeString(100));
+            ASSERT(r.first == r.second);
+
+            ASSERT(1 == mX.erase(makeString(10)));
+            ASSERT(0 == mX.erase(makeString(10)));
+            ASSERT(99 == X.size());
+
+            Obj::const_iterator it   = X.find(makeString(20));
+            Obj::const_iterator next = it;
+            ++next;
+            ASSERT(next == mX.erase(it));
+            ASSERT(98 == X.size());
+
+            mX.erase(X.begin(), X.end());
+            ASSERT(X.empty());
+
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(makeString(i));
+            }
+
+            const bsl::size_t capacity = X.capacity();
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(capacity == X.capacity());
+
+            mX.rehash(1000);
+            ASSERT(1024 == X.capacity());
+
+            mX.reserve(1000);
+            ASSERT(2048 == X.capacity());
+
+            mX.reset();
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 Copy and move construction and assignment, 'swap', and the
+        //:   equality operators forward to the table, and propagate the
+        //:   allocator as for the table.
+        //:
+        //: 2 The free 'swap' exchanges the values of sets having different
+        //:   allocators, and the allocators are unchanged.
+        //
+        // Plan:
+        //: 1 Perform each operation on sets of various sizes and verify the
+        //:   values and allocators.  (C-1,2)
+        //
+        // Testing:
+        //   FlatHashSet(const FlatHashSet&, bslma::Allocator *);
+        //   FlatHashSet(MovableRef<FlatHashSet>);
+        //   FlatHashSet(MovableRef<FlatHashSet>, bslma::Allocator *);
+        //   FlatHashSet& operator=(const FlatHashSet&);
+        //   FlatHashSet& operator=(MovableRef<FlatHashSet>);
+        //   void swap(FlatHashSet&);
+        //   bool operator==(const FlatHashSet&, const FlatHashSet&);
+        //   bool operator!=(const FlatHashSet&, const FlatHashSet&);
+        //   void swap(FlatHashSet&, FlatHashSet&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                   << "COPY, MOVE, ASSIGNMENT, SWAP, AND EQUALITY" << endl
+                   << "==========================================" << endl;
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        for (int n = 0; n < 40; n += 13) {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < n; ++i) {
+                mX.insert(makeString(i));
+            }
+
+            {
+                Obj mY(X, &za);  const Obj& Y = mY;
+
+                ASSERTV(n, X == Y);
+                ASSERTV(n, !(X != Y));
+                ASSERTV(n, &za == Y.allocator());
+                ASSERTV(n, hasKeys(Y, n));
+
+                mY.insert(makeString(n));
+                ASSERTV(n, X != Y);
+            }
+            {
+                Obj mY(X, &oa);
+
+                const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+
+                Obj mZ(MoveUtil::move(mY));
+                ASSERTV(n, hasKeys(mZ, n));
+                ASSERTV(n, NUM_BLOCKS == oa.numBlocksTotal());
+
+                Obj mW(MoveUtil::move(mZ), &za);
+                ASSERTV(n, hasKeys(mW, n));
+                ASSERTV(n, &za == mW.allocator());
+            }
+            {
+                Obj mY(&za);
+                mY.insert(makeString(1000));
+
+                mY = X;
+                ASSERTV(n, hasKeys(mY, n));
+                ASSERTV(n, &za == mY.allocator());
+
+                Obj mZ(&oa);
+                mZ = MoveUtil::move(mY);
+                ASSERTV(n, hasKeys(mZ, n));
+                ASSERTV(n, &oa == mZ.allocator());
+            }
+            {
+                Obj mY(&oa);
+                mY.insert(makeString(1000));
+                const Obj YY(mY, &za);
+
+                Obj mZ(X, &oa);
+                mZ.swap(mY);
+                ASSERTV(n, X  == mY);
+                ASSERTV(n, YY == mZ);
+
+                Obj mW(X, &za);
+                swap(mZ, mW);
+                ASSERTV(n, X  == mZ);
+                ASSERTV(n, YY == mW);
+                ASSERTV(n, &oa == mZ.allocator());
+                ASSERTV(n, &za == mW.allocator());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&oa);
+            Obj mY(&oa);
+            Obj mZ(&za);
+
+            ASSERT_SAFE_PASS(mX.swap(mY));
+            ASSERT_SAFE_FAIL(mX.swap(mZ));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // RANGE AND INITIALIZER LIST CONSTRUCTORS
+        //
+        // Concerns:
+        //: 1 The range constructors insert each key of the range, ignoring
+        //:   duplicates, and use the supplied capacity, functors, and
+        //:   allocator.
+        //:
+        //: 2 The range 'insert' inserts each key of the range.
+        //:
+        //: 3 The initializer list constructors, assignment, and 'insert'
+        //:   behave as the corresponding range methods.
+        //
+        // Plan:
+        //: 1 Create sets from ranges and initializer lists, having duplicate
+        //:   keys, with each constructor and verify the keys, capacity,
+        //:   functors, and allocator.  (C-1..3)
+        //
+        // Testing:
+        //   FlatHashSet(INPUT_ITER, INPUT_ITER, bslma::Allocator *);
+        //   FlatHashSet(INPUT_ITER, INPUT_ITER, size_t, bslma::Allocator *);
+        //   FlatHashSet(INPUT_ITER, INPUT_ITER, size_t, const HASH&, Alloc *);
+        //   FlatHashSet(INPUT_ITER, INPUT_ITER, size_t, HASH, EQUAL, Alloc *);
+        //   FlatHashSet(initializer_list, bslma::Allocator *);
+        //   FlatHashSet(initializer_list, size_t, bslma::Allocator *);
+        //   FlatHashSet(initializer_list, size_t, const HASH&, Alloc *);
+        //   FlatHashSet(initializer_list, size_t, HASH, EQUAL, Alloc *);
+        //   FlatHashSet& operator=(initializer_list);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(initializer_list);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                       << "RANGE AND INITIALIZER LIST CONSTRUCTORS" << endl
+                       << "=======================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            bsl::vector<bsl::string> keys;
+            for (int i = 0; i < 50; ++i) {
+                keys.push_back(makeString(i));
+            }
+            keys.push_back(makeString(7));
+
+            const Obj X(keys.begin(), keys.end(), &oa);
+            ASSERT(hasKeys(X, 50));
+            ASSERT(&oa == X.allocator());
+
+            const Obj Y(keys.begin(), keys.end(), 512, &oa);
+            ASSERT(hasKeys(Y, 50));
+            ASSERT(512 == Y.capacity());
+
+            Obj mV(&oa);
+            mV.insert(keys.begin(), keys.end());
+            ASSERT(X == mV);
+        }
+        {
+            bsl::vector<int> keys;
+            for (int i = 0; i < 50; ++i) {
+                keys.push_back(i);
+            }
+
+            const CustomSet Z(keys.begin(), keys.end(), 0, SeededHash(5), &oa);
+            ASSERT(50 == Z.size());
+            ASSERT(5 == Z.hash_function().d_seed);
+
+            const CustomSet W(keys.begin(),
+                              keys.end(),
+                              0,
+                              SeededHash(6),
+                              ModEqual(),
+                              &oa);
+            ASSERT(50 == W.size());
+            ASSERT(6 == W.hash_function().d_seed);
+            ASSERT(W.contains(1007));
+        }
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        {
+            const Obj X({ makeString(0), makeString(1), makeString(0) }, &oa);
+            ASSERT(hasKeys(X, 2));
+
+            const Obj Y({ makeString(0), makeString(1) }, 64, &oa);
+            ASSERT(hasKeys(Y, 2));
+            ASSERT(64 == Y.capacity());
+
+            const CustomSet Z({ 0 }, 0, SeededHash(3), &oa);
+            ASSERT(1 == Z.size());
+            ASSERT(3 == Z.hash_function().d_seed);
+
+            const CustomSet W({ 0, 1, 1000 },
+                              0,
+                              SeededHash(4),
+                              ModEqual(),
+                              &oa);
+            ASSERT(2 == W.size());
+            ASSERT(W.contains(1001));
+
+            Obj mV(&oa);
+            mV.insert(makeString(7));
+            mV = { makeString(0), makeString(1), makeString(2) };
+            ASSERT(hasKeys(mV, 3));
+
+            mV.insert({ makeString(3), makeString(0) });
+            ASSERT(hasKeys(mV, 4));
+        }
+#endif
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS, INSERTION, AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor taking a capacity creates an empty set having
+        //:   the supplied capacity, functors, and allocator, and the default
+        //:   allocator if none is supplied.
+        //:
+        //: 2 'insert' inserts a key if and only if it is absent, using the
+        //:   allocator of the set, and the accessors forward to the table.
+        //:
+        //: 3 The destructor releases all memory.
+        //
+        // Plan:
+        //: 1 Create sets with each constructor and verify their state.  (C-1)
+        //:
+        //: 2 Insert keys by copy and by move and verify the results of each
+        //:   accessor and the memory in use.  (C-2,3)
+        //
+        // Testing:
+        //   FlatHashSet();
+        //   FlatHashSet(bslma::Allocator *);
+        //   FlatHashSet(size_t);
+        //   FlatHashSet(size_t, bslma::Allocator *);
+        //   FlatHashSet(size_t, const HASH&, bslma::Allocator *);
+        //   FlatHashSet(size_t, const HASH&, const EQUAL&, Allocator *);
+        //   ~FlatHashSet();
+        //   pair<const_iterator, bool> insert(const KEY&);
+        //   pair<const_iterator, bool> insert(MovableRef<KEY>);
+        //   size_t capacity() const;
+        //   bool contains(const KEY&) const;
+        //   size_t count(const KEY&) const;
+        //   bool empty() const;
+        //   const_iterator find(const KEY&) const;
+        //   HASH hash_function() const;
+        //   EQUAL key_eq() const;
+        //   size_t size() const;
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator cend() const;
+        //   const_iterator end() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                  << "CONSTRUCTORS, INSERTION, AND BASIC ACCESSORS" << endl
+                  << "============================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            const Obj A;
+            const Obj B(&oa);
+            const Obj C(20);
+            const Obj D(20, &oa);
+            const CustomSet E(0, SeededHash(7), &oa);
+            const CustomSet F(100, SeededHash(8), ModEqual(), &oa);
+
+            ASSERT(&defaultAllocator == A.allocator());
+            ASSERT(&oa               == B.allocator());
+            ASSERT(&defaultAllocator == C.allocator());
+            ASSERT(&oa               == D.allocator());
+            ASSERT(&oa               == E.allocator());
+            ASSERT(&oa               == F.allocator());
+
+            ASSERT(  0 == A.capacity());
+            ASSERT(  0 == B.capacity());
+            ASSERT( 32 == C.capacity());
+            ASSERT( 32 == D.capacity());
+            ASSERT(  0 == E.capacity());
+            ASSERT(128 == F.capacity());
+
+            ASSERT(7 == E.hash_function().d_seed);
+            ASSERT(8 == F.hash_function().d_seed);
+            ASSERT(true == F.key_eq()(1, 1001));
+
+            ASSERT(A.empty());
+            ASSERT(F.empty());
+            ASSERT(0 == F.size());
+            ASSERT(F.begin()  == F.end());
+            ASSERT(F.cbegin() == F.cend());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int i = 0; i < 100; ++i) {
+                bsl::string key = makeString(i);
+
+                bsl::pair<Obj::const_iterator, bool> rv =
+                           i % 2 ? mX.insert(key)
+                                 : mX.insert(bslmf::MovableRefUtil::move(key));
+                ASSERTV(i, rv.second);
+                ASSERTV(i, makeString(i) == *rv.first);
+                ASSERTV(i, &oa == rv.first->get_allocator().mechanism());
+
+                rv = mX.insert(makeString(i));
+                ASSERTV(i, !rv.second);
+                ASSERTV(i, makeString(i) == *rv.first);
+
+                ASSERTV(i, hasKeys(X, i + 1));
+                ASSERTV(i, 1 == X.count(makeString(i)));
+                ASSERTV(i, !X.contains(makeString(i + 1)));
+                ASSERTV(i, X.end() == X.find(makeString(i + 1)));
+            }
+
+            int count = 0;
+            for (Obj::const_iterator it = X.cbegin(); it != X.cend(); ++it) {
+                ++count;
+            }
+            ASSERT(100 == count);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a set, insert, find, and erase a few keys, and copy the
+        //:   set.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(true  == mX.insert("one").second);
+            ASSERT(true  == mX.insert("two").second);
+            ASSERT(false == mX.insert("one").second);
+
+            ASSERT(2 == X.size());
+            ASSERT(X.contains("two"));
+            ASSERT(!X.contains("three"));
+
+            ASSERT(1 == mX.erase("two"));
+            ASSERT(1 == X.size());
+
+            Obj mY(X, &oa);  const Obj& Y = mY;
+            ASSERT(X == Y);
+
+            mY.insert("three");
+            ASSERT(X != Y);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
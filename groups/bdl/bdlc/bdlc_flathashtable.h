@@ -0,0 +1,1545 @@
+// bdlc_flathashtable.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHTABLE
+#define INCLUDED_BDLC_FLATHASHTABLE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed hash table like Abseil 'flat_hash_map'.
+//
+//@CLASSES:
+//  bdlc::FlatHashTable: open-addressed hash table like Abseil 'flat_hash_map'
+//  bdlc::FlatHashTable_IteratorImp: forward iterator implementation
+//
+//@SEE_ALSO: bdlc_flathashmap, bdlc_flathashset
+//
+//@DESCRIPTION: This component provides the class template,
+// 'bdlc::FlatHashTable', implementing an open-addressed hash table of entries
+// stored contiguously in a single array (a "flat" hash table), in the style
+// of Abseil's "Swiss table".  This table is the implementation of
+// 'bdlc::FlatHashMap' and 'bdlc::FlatHashSet', which are the types intended
+// for direct client use.
+//
+// The table is an array of 'capacity()' slots, each having a control byte
+// (see 'bdlc_flathashtable_groupcontrol').  The control byte of a slot holds
+// either the 7 low-order bits of the hash value of the key of the entry in
+// the slot (the "H2" value), or a special value indicating that the slot is
+// empty or erased.  The slots are partitioned into groups of
+// 'bdlc::FlatHashTable_GroupControl::k_SIZE' slots, and a lookup inspects the
+// control bytes of a whole group at once, so that the keys of the entries
+// are compared only for slots whose control byte matches the H2 value of the
+// sought key.  The high-order bits of the hash value of a key select the
+// group at which the probe sequence for the key starts, and the sequence
+// visits the groups quadratically (by triangular numbers) from there.  Since
+// the hash value is used in its entirety, the 'HASH' functor must distribute
+// the varying bits of its result over the whole word; 'bslh::Hash<>', for
+// example, has this property, whereas the identity hash of 'bsl::hash<int>'
+// does not (see 'bslh_fibonaccibadhashwrapper').
+//
+// The capacity of a table is either 0 or a power of two that is at least
+// 'k_SIZE', and the table is grown (doubling its capacity) whenever an
+// insertion would raise the load factor above 7/8.  A table with capacity 0
+// allocates no memory.
+//
+///Requirements on 'ENTRY_UTIL'
+///----------------------------
+// The (template parameter) type 'ENTRY_UTIL' must provide the following
+// static member functions, where 'entry' is an 'ENTRY *' referring to
+// uninitialized memory, 'allocator' is a 'bslma::Allocator *', and 'key' is
+// either a 'const KEY&' or a 'bslmf::MovableRef<KEY>':
+//..
+//  +-------------------------------------------+-----------------------------+
+//  | Function                                  | Effect                      |
+//  +===========================================+=============================+
+//  | constructFromKey(entry, allocator, key)   | Create an 'ENTRY' at        |
+//  |                                           | 'entry' having 'key', using |
+//  |                                           | 'allocator' to supply       |
+//  |                                           | memory.                     |
+//  +-------------------------------------------+-----------------------------+
+//  | const KEY& key(const ENTRY& entry)        | Return the key of 'entry'.  |
+//  +-------------------------------------------+-----------------------------+
+//..
+//
+///Iterator, Pointer, and Reference Invalidation
+///---------------------------------------------
+// Any change in capacity of a 'bdlc::FlatHashTable' invalidates all
+// pointers, references, and iterators.  A 'bdlc::FlatHashTable' manipulator
+// that erases an entry invalidates all pointers, references, and iterators to
+// the erased entry.
+//
+///Exception Safety
+///----------------
+// A 'bdlc::FlatHashTable' is exception neutral, and all of the methods of
+// 'bdlc::FlatHashTable' provide the basic exception safety guarantee (see
+// {'bsldoc_glossary'|Basic Guarantee}).
+//
+///Usage
+///-----
+// There is no usage example for this component since it is not meant for
+// direct client use.  See 'bdlc_flathashmap' and 'bdlc_flathashset'.
+
+#include <bdlscm_version.h>
+
+#include <bdlc_flathashtable_groupcontrol.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslalg_swaputil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslstl_forwarditerator.h>
+
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+#include <bsls_util.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>
+#include <bsl_iterator.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+// FORWARD DECLARATIONS
+template <class ENTRY>
+class FlatHashTable_IteratorImp;
+
+template <class ENTRY>
+bool operator==(const FlatHashTable_IteratorImp<ENTRY>&,
+                const FlatHashTable_IteratorImp<ENTRY>&);
+
+                     // ===============================
+                     // class FlatHashTable_IteratorImp
+                     // ===============================
+
+template <class ENTRY>
+class FlatHashTable_IteratorImp {
+    // This class implements the methods required by 'bslstl::ForwardIterator'
+    // to iterate over the entries of a 'FlatHashTable'.
+
+    // DATA
+    ENTRY              *d_entries_p;         // current entry, or 0 at end
+    const bsl::uint8_t *d_controls_p;        // control byte of current entry
+    bsl::size_t         d_additionalLength;  // number of slots after current
+
+    // FRIENDS
+    friend bool operator==<>(const FlatHashTable_IteratorImp&,
+                             const FlatHashTable_IteratorImp&);
+
+  public:
+    // CREATORS
+    FlatHashTable_IteratorImp();
+        // Create a default 'FlatHashTable_IteratorImp' having the "end"
+        // position.
+
+    FlatHashTable_IteratorImp(ENTRY              *entries,
+                              const bsl::uint8_t *controls,
+                              bsl::size_t         additionalLength);
+        // Create a 'FlatHashTable_IteratorImp' referring to the entry at the
+        // specified 'entries', whose control byte is at the specified
+        // 'controls', and followed by the specified 'additionalLength' slots.
+        // The behavior is undefined unless the slot at 'entries' is in use.
+
+    //! FlatHashTable_IteratorImp(
+    //!                   const FlatHashTable_IteratorImp& original) = default;
+        // Create a 'FlatHashTable_IteratorImp' having the same value as the
+        // specified 'original' object.
+
+    //! ~FlatHashTable_IteratorImp() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! FlatHashTable_IteratorImp& operator=(
+    //!                        const FlatHashTable_IteratorImp& rhs) = default;
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.
+
+    void operator++();
+        // Advance this object to the next in-use slot, or to the "end"
+        // position if there is no such slot.  The behavior is undefined
+        // unless this object does not have the "end" position.
+
+    // ACCESSORS
+    ENTRY& operator*() const;
+        // Return a reference to the entry referred to by this object.  The
+        // behavior is undefined unless this object does not have the "end"
+        // position.
+};
+
+// FREE OPERATORS
+template <class ENTRY>
+bool operator==(const FlatHashTable_IteratorImp<ENTRY>& a,
+                const FlatHashTable_IteratorImp<ENTRY>& b);
+    // Return 'true' if the specified 'a' and 'b' objects have the same value,
+    // and 'false' otherwise.  Two 'FlatHashTable_IteratorImp' objects have
+    // the same value if they refer to the same slot, or both have the "end"
+    // position.
+
+                            // ===================
+                            // class FlatHashTable
+                            // ===================
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+class FlatHashTable {
+    // This value-semantic class template implements an open-addressed hash
+    // table of unique 'KEY' values, each being the key of an 'ENTRY' stored
+    // in a contiguous array of slots.  The (template parameter) type
+    // 'ENTRY_UTIL' creates entries from keys and provides access to the key
+    // of an entry (see {Requirements on 'ENTRY_UTIL'}).  The (template
+    // parameter) types 'HASH' and 'EQUAL' are the hash and key-equality
+    // functors.
+
+    // PRIVATE TYPES
+    typedef FlatHashTable_GroupControl       GroupControl;
+    typedef FlatHashTable_IteratorImp<ENTRY> IteratorImp;
+    typedef bslmf::MovableRefUtil            MoveUtil;
+
+    // PRIVATE CONSTANTS
+    enum {
+        k_MAX_LOAD_FACTOR_NUMERATOR   = 7,
+        k_MAX_LOAD_FACTOR_DENOMINATOR = 8,
+
+        k_HASHTABLE_NUM_BITS = static_cast<int>(sizeof(bsl::size_t)) * 8,
+
+        k_H2_MASK = 0x7F  // hash bits stored in the control byte
+    };
+
+    // DATA
+    ENTRY            *d_entries_p;          // array of slots, or 0
+    bsl::uint8_t     *d_controls_p;         // control bytes of the slots
+    bsl::size_t       d_size;               // number of entries
+    bsl::size_t       d_capacity;           // number of slots
+    int               d_groupControlShift;  // shift of hash to group index
+    HASH              d_hasher;             // hash functor
+    EQUAL             d_equal;              // key-equality functor
+    bslma::Allocator *d_allocator_p;        // memory allocator (held)
+
+    // PRIVATE CLASS METHODS
+    static bsl::size_t minimumCompliantCapacity(bsl::size_t numEntries);
+        // Return the minimum capacity that satisfies the constraints on the
+        // capacity of a table and whose maximum load factor allows for the
+        // specified 'numEntries'.
+
+    static bsl::size_t roundUpCapacity(bsl::size_t capacity);
+        // Return the minimum capacity that satisfies the constraints on the
+        // capacity of a table and is at least the specified 'capacity'.
+
+    // PRIVATE MANIPULATORS
+    void allocateSlots(bsl::size_t capacity);
+        // Allocate the slots for the specified 'capacity', mark them empty,
+        // and set the capacity of this table to 'capacity'.  The behavior is
+        // undefined unless this table has no slots and 'capacity' satisfies
+        // the constraints on the capacity of a table.
+
+    void destroyEntriesAndDeallocate();
+        // Destroy the entries of this table and deallocate its slots, leaving
+        // this table with size and capacity 0.
+
+    void eraseSlot(bsl::size_t index);
+        // Destroy the entry in the slot at the specified 'index' and mark the
+        // slot available.  The behavior is undefined unless the slot at
+        // 'index' is in use.
+
+    bsl::size_t findAvailable(bsl::size_t hashValue);
+        // Return the index of the first available slot in the probe sequence
+        // for the specified 'hashValue'.  The behavior is undefined unless
+        // this table has an available slot.
+
+    bsl::size_t prepareInsertion(bsl::size_t hashValue);
+        // Grow this table if inserting an entry would exceed the maximum
+        // load factor, and return the index of the slot where an entry whose
+        // key has the specified 'hashValue' is to be inserted.
+
+    void rehashRaw(bsl::size_t newCapacity);
+        // Move the entries of this table into newly allocated slots for the
+        // specified 'newCapacity'.  The behavior is undefined unless
+        // 'newCapacity' satisfies the constraints on the capacity of a table
+        // and 'size() <= newCapacity * 7 / 8'.
+
+    void swapData(FlatHashTable& other);
+        // Exchange the slots, size, capacity, and functors of this table with
+        // those of the specified 'other' table.  Note that the allocators are
+        // not exchanged.
+
+    // PRIVATE ACCESSORS
+    bsl::size_t findKey(const KEY& key, bsl::size_t hashValue) const;
+        // Return the index of the slot of the entry having the specified
+        // 'key', whose hash value is the specified 'hashValue', or
+        // 'capacity()' if there is no such entry.
+
+    bsl::size_t groupIndex(bsl::size_t hashValue) const;
+        // Return the index of the group at which the probe sequence for the
+        // specified 'hashValue' starts.  The behavior is undefined unless
+        // '0 < capacity()'.
+
+    IteratorImp iteratorImp(bsl::size_t index) const;
+        // Return an iterator implementation referring to the slot at the
+        // specified 'index', or to the "end" position if 'capacity() ==
+        // index'.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatHashTable, bslma::UsesBslmaAllocator);
+
+    // TYPES
+    typedef ENTRY                                               entry_type;
+    typedef bslstl::ForwardIterator<ENTRY, IteratorImp>         iterator;
+    typedef bslstl::ForwardIterator<const ENTRY, IteratorImp>   const_iterator;
+
+    // CREATORS
+    FlatHashTable(bsl::size_t       capacity,
+                  const HASH&       hash,
+                  const EQUAL&      equal,
+                  bslma::Allocator *basicAllocator = 0);
+        // Create an empty table having at least the specified 'capacity',
+        // that will use the specified 'hash' to generate hash values for the
+        // keys of the entries contained in this table, and the specified
+        // 'equal' to verify that the keys of two entries are the same.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  If '0 == capacity', no memory is allocated and the object is
+        // defined to be in the "zero-capacity" state.
+
+    FlatHashTable(const FlatHashTable&  original,
+                  bslma::Allocator     *basicAllocator = 0);
+        // Create a table having the same value, hasher, key-equality
+        // comparator, and capacity as the specified 'original' object.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    FlatHashTable(bslmf::MovableRef<FlatHashTable> original);
+        // Create a table having the same value, hasher, key-equality
+        // comparator, and allocator as the specified 'original' object.  The
+        // contents of 'original' are moved (in constant time) to this object,
+        // 'original' is left in a (valid) unspecified state, and no
+        // exceptions will be thrown.
+
+    FlatHashTable(bslmf::MovableRef<FlatHashTable>  original,
+                  bslma::Allocator                 *basicAllocator);
+        // Create a table having the same value, hasher, and key-equality
+        // comparator as the specified 'original' object, using the specified
+        // 'basicAllocator' to supply memory.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.  The contents of
+        // 'original' are moved (in constant time) to this object if
+        // 'basicAllocator == original.allocator()', and are move-inserted (in
+        // linear time) using 'basicAllocator' otherwise.  'original' is left
+        // in a (valid) unspecified state.
+
+    ~FlatHashTable();
+        // Destroy this object and each of its entries.
+
+    // MANIPULATORS
+    FlatHashTable& operator=(const FlatHashTable& rhs);
+        // Assign to this object the value, hasher, and key-equality functor
+        // of the specified 'rhs' object, and return a reference providing
+        // modifiable access to this object.
+
+    FlatHashTable& operator=(bslmf::MovableRef<FlatHashTable> rhs);
+        // Assign to this object the value, hasher, and key-equality
+        // comparator of the specified 'rhs' object, and return a reference
+        // providing modifiable access to this object.  The contents of 'rhs'
+        // are moved (in constant time) to this object if
+        // 'rhs.allocator() == allocator()', and are move-inserted (in linear
+        // time) using 'allocator()' otherwise.  'rhs' is left in a (valid)
+        // unspecified state.
+
+    void clear();
+        // Remove all entries from this table.  Note that this table will be
+        // empty after calling this method, but allocated memory may be
+        // retained for future use.  See the 'capacity' method.
+
+    bsl::pair<iterator, iterator> equal_range(const KEY& key);
+        // Return a pair of iterators defining the sequence of modifiable
+        // entries in this table having the specified 'key', where the first
+        // iterator is positioned at the start of the sequence and the second
+        // iterator is positioned one past the end of the sequence.  If this
+        // table contains no entries having 'key', then the two returned
+        // iterators will have the same value.  Note that since a table
+        // maintains unique keys, the range will contain at most one entry.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove from this table the entry whose key is the specified 'key',
+        // if it exists, and return 1; otherwise (there is no entry having
+        // 'key' in this table), return 0 with no other effect.
+
+    iterator erase(const_iterator position);
+    iterator erase(iterator position);
+        // Remove from this table the entry at the specified 'position', and
+        // return an iterator referring to the entry immediately following the
+        // removed entry, or to the past-the-end position if the removed entry
+        // was the last in the sequence.  The behavior is undefined unless
+        // 'position' refers to an entry in this table.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this table the entries starting at the specified
+        // 'first' position up to, but not including, the specified 'last'
+        // position, and return 'last'.  The behavior is undefined unless
+        // 'first' and 'last' either refer to entries in this table or are the
+        // 'end' iterator, and the 'first' position is at or before the 'last'
+        // position in the iteration sequence provided by this table.
+
+    iterator find(const KEY& key);
+        // Return an iterator referring to the entry in this table having the
+        // specified 'key', or 'end()' if no such entry exists.
+
+    bsl::pair<iterator, bool> insert(const ENTRY& entry);
+    bsl::pair<iterator, bool> insert(bslmf::MovableRef<ENTRY> entry);
+        // Insert the specified 'entry' into this table if the key of 'entry'
+        // does not already exist in this table; otherwise, this method has no
+        // effect.  Return a 'pair' whose 'first' member is an iterator
+        // referring to the (possibly newly inserted) entry in this table
+        // whose key is the same as that of 'entry', and whose 'second' member
+        // is 'true' if a new entry was inserted, and 'false' otherwise.
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Change the capacity of this table to at least the specified
+        // 'minimumCapacity', and redistribute all the contained entries into
+        // the new sequence of slots, according to their hash values.  If
+        // '0 == minimumCapacity' and '0 == size()', the table is returned to
+        // the zero-capacity state.  Note that the resulting capacity is also
+        // large enough to hold 'size()' entries without exceeding the maximum
+        // load factor.
+
+    void reserve(bsl::size_t numEntries);
+        // Change the capacity of this table to at least a capacity that can
+        // accommodate the specified 'numEntries' (accounting for the load
+        // factor invariant), and redistribute all the contained entries into
+        // the new sequence of slots, according to their hash values.  If
+        // '0 == numEntries' and '0 == size()', the table is returned to the
+        // zero-capacity state.
+
+    void reset();
+        // Remove all entries from this table and release all memory from
+        // this table, returning the table to the zero-capacity state.
+
+    bsl::pair<iterator, bool> tryEmplace(const KEY& key);
+    bsl::pair<iterator, bool> tryEmplace(bslmf::MovableRef<KEY> key);
+        // Insert into this table a newly created entry having the specified
+        // 'key' (see 'ENTRY_UTIL::constructFromKey') if 'key' does not
+        // already exist in this table; otherwise, this method has no effect.
+        // Return a 'pair' whose 'first' member is an iterator referring to
+        // the (possibly newly inserted) entry having 'key', and whose 'second'
+        // member is 'true' if a new entry was inserted, and 'false' otherwise.
+
+    iterator begin();
+        // Return an iterator representing the beginning of the sequence of
+        // modifiable entries held by this table.
+
+    iterator end();
+        // Return an iterator representing the end of the sequence of
+        // modifiable entries held by this table.
+
+                                // Aspects
+
+    void swap(FlatHashTable& other);
+        // Efficiently exchange the value, hasher, and key-equality functor of
+        // this object with those of the specified 'other' object.  This
+        // method provides the no-throw exception-safety guarantee if 'HASH'
+        // and 'EQUAL' can be swapped without throwing.  The behavior is
+        // undefined unless this object was created with the same allocator as
+        // 'other'.
+
+    // ACCESSORS
+    bsl::size_t capacity() const;
+        // Return the number of slots of this table.  Note that the table
+        // grows before its 'size' exceeds 7/8 of its capacity.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this table contains an entry having the specified
+        // 'key', and 'false' otherwise.
+
+    const bsl::uint8_t *controlBytes() const;
+        // Return the address of the first control byte of this table, or 0 if
+        // this table has capacity 0.  Note that this method is provided for
+        // testing.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of entries in this table having the specified
+        // 'key'.  Note that since a table maintains unique keys, the returned
+        // value will be either 0 or 1.
+
+    bool empty() const;
+        // Return 'true' if this table contains no entries, and 'false'
+        // otherwise.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(
+                                                         const KEY& key) const;
+        // Return a pair of iterators defining the sequence of entries in this
+        // table having the specified 'key', where the first iterator is
+        // positioned at the start of the sequence and the second iterator is
+        // positioned one past the end of the sequence.  If this table
+        // contains no entries having 'key', then the two returned iterators
+        // will have the same value.
+
+    const_iterator find(const KEY& key) const;
+        // Return a 'const_iterator' referring to the entry in this table
+        // having the specified 'key', or 'end()' if no such entry exists.
+
+    HASH hash_function() const;
+        // Return (a copy of) the unary hash functor used by this table to
+        // generate a hash value (of type 'bsl::size_t') for a 'KEY' object.
+
+    EQUAL key_eq() const;
+        // Return (a copy of) the binary key-equality functor that returns
+        // 'true' if the value of two 'KEY' objects are the same, and 'false'
+        // otherwise.
+
+    float load_factor() const;
+        // Return the current ratio between the number of entries in this
+        // table and its capacity.
+
+    float max_load_factor() const;
+        // Return the maximum load factor, 0.875, of this table.  Note that
+        // the maximum load factor of a table is not configurable.
+
+    bsl::size_t size() const;
+        // Return the number of entries in this table.
+
+    const_iterator begin() const;
+        // Return a 'const_iterator' representing the beginning of the
+        // sequence of entries held by this table.
+
+    const_iterator cbegin() const;
+        // Return a 'const_iterator' representing the beginning of the
+        // sequence of entries held by this table.
+
+    const_iterator end() const;
+        // Return a 'const_iterator' representing the end of the sequence of
+        // entries held by this table.
+
+    const_iterator cend() const;
+        // Return a 'const_iterator' representing the end of the sequence of
+        // entries held by this table.
+
+                                // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this table to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool operator==(
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'FlatHashTable' objects have the same
+    // value if their sizes are the same and each entry contained in one is
+    // equal to an entry of the other.  The hash and equality functors are not
+    // involved in the comparison.  This method requires that the 'ENTRY'
+    // template parameter type be equality-comparable.
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool operator!=(
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'FlatHashTable' objects do not
+    // have the same value if their sizes are different or one contains an
+    // entry equal to no entry of the other.  The hash and equality functors
+    // are not involved in the comparison.  This method requires that the
+    // 'ENTRY' template parameter type be equality-comparable.
+
+// FREE FUNCTIONS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void swap(FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& a,
+          FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& b);
+    // Exchange the value, the hasher, and the key-equality functor of the
+    // specified 'a' and 'b' objects.  This function provides the no-throw
+    // exception-safety guarantee if the two objects were created with the
+    // same allocator and the basic guarantee otherwise.
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                     // -------------------------------
+                     // class FlatHashTable_IteratorImp
+                     // -------------------------------
+
+// CREATORS
+template <class ENTRY>
+inline
+FlatHashTable_IteratorImp<ENTRY>::FlatHashTable_IteratorImp()
+: d_entries_p(0)
+, d_controls_p(0)
+, d_additionalLength(0)
+{
+}
+
+template <class ENTRY>
+inline
+FlatHashTable_IteratorImp<ENTRY>::FlatHashTable_IteratorImp(
+                                          ENTRY              *entries,
+                                          const bsl::uint8_t *controls,
+                                          bsl::size_t         additionalLength)
+: d_entries_p(entries)
+, d_controls_p(controls)
+, d_additionalLength(additionalLength)
+{
+    BSLS_ASSERT_SAFE(entries);
+    BSLS_ASSERT_SAFE(controls);
+    BSLS_ASSERT_SAFE(0 == (*controls & FlatHashTable_GroupControl::k_EMPTY));
+}
+
+// MANIPULATORS
+template <class ENTRY>
+void FlatHashTable_IteratorImp<ENTRY>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_entries_p);
+
+    while (d_additionalLength) {
+        --d_additionalLength;
+        ++d_entries_p;
+        ++d_controls_p;
+
+        if (0 == (*d_controls_p & FlatHashTable_GroupControl::k_EMPTY)) {
+            return;                                                   // RETURN
+        }
+    }
+
+    d_entries_p  = 0;
+    d_controls_p = 0;
+}
+
+// ACCESSORS
+template <class ENTRY>
+inline
+ENTRY& FlatHashTable_IteratorImp<ENTRY>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_entries_p);
+
+    return *d_entries_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class ENTRY>
+inline
+bool bdlc::operator==(const FlatHashTable_IteratorImp<ENTRY>& a,
+                      const FlatHashTable_IteratorImp<ENTRY>& b)
+{
+    return a.d_entries_p == b.d_entries_p;
+}
+
+namespace bdlc {
+
+                            // -------------------
+                            // class FlatHashTable
+                            // -------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
+                           minimumCompliantCapacity(bsl::size_t numEntries)
+{
+    bsl::size_t capacity = GroupControl::k_SIZE;
+
+    while (capacity / k_MAX_LOAD_FACTOR_DENOMINATOR
+                                    * k_MAX_LOAD_FACTOR_NUMERATOR < numEntries)
+    {
+        capacity *= 2;
+    }
+
+    return capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
+                                         roundUpCapacity(bsl::size_t capacity)
+{
+    bsl::size_t rv = GroupControl::k_SIZE;
+
+    while (rv < capacity) {
+        rv *= 2;
+    }
+
+    return rv;
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::allocateSlots(
+                                                          bsl::size_t capacity)
+{
+    BSLS_ASSERT_SAFE(0 == d_entries_p);
+    BSLS_ASSERT_SAFE(0 == d_size);
+    BSLS_ASSERT_SAFE(GroupControl::k_SIZE <= capacity);
+    BSLS_ASSERT_SAFE(0 == (capacity & (capacity - 1)));
+
+    // The entries and their control bytes share one block of memory, with the
+    // (maximally aligned) entries first.
+
+    char *block = static_cast<char *>(d_allocator_p->allocate(
+                                        capacity * (sizeof(ENTRY) + 1)));
+
+    d_entries_p  = reinterpret_cast<ENTRY *>(block);
+    d_controls_p = reinterpret_cast<bsl::uint8_t *>(block
+                                                   + capacity * sizeof(ENTRY));
+    bsl::memset(d_controls_p, GroupControl::k_EMPTY, capacity);
+
+    d_capacity = capacity;
+
+    int log2NumGroups = 0;
+    for (bsl::size_t numGroups = capacity / GroupControl::k_SIZE;
+         numGroups > 1;
+         numGroups /= 2) {
+        ++log2NumGroups;
+    }
+    d_groupControlShift = k_HASHTABLE_NUM_BITS - log2NumGroups;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
+                                                 destroyEntriesAndDeallocate()
+{
+    if (d_entries_p) {
+        for (bsl::size_t i = 0; i < d_capacity && d_size; ++i) {
+            if (0 == (d_controls_p[i] & GroupControl::k_EMPTY)) {
+                bslma::DestructionUtil::destroy(d_entries_p + i);
+                --d_size;
+            }
+        }
+        d_allocator_p->deallocate(d_entries_p);
+    }
+
+    d_entries_p         = 0;
+    d_controls_p        = 0;
+    d_size              = 0;
+    d_capacity          = 0;
+    d_groupControlShift = 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::eraseSlot(
+                                                             bsl::size_t index)
+{
+    BSLS_ASSERT_SAFE(index < d_capacity);
+    BSLS_ASSERT_SAFE(0 == (d_controls_p[index] & GroupControl::k_EMPTY));
+
+    bslma::DestructionUtil::destroy(d_entries_p + index);
+    --d_size;
+
+    // A probe sequence never passes a group having an empty slot (see
+    // 'findKey').  If the group of the slot has an empty slot, no probe
+    // sequence passes the group, and the slot can be marked empty; otherwise,
+    // the slot must be marked erased so that the probe sequences passing the
+    // group are not cut short.
+
+    const bsl::size_t groupStart = index & ~(GroupControl::k_SIZE - 1);
+
+    d_controls_p[index] = GroupControl(d_controls_p + groupStart).neverFull()
+                          ? GroupControl::k_EMPTY
+                          : GroupControl::k_ERASED;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findAvailable(
+                                                         bsl::size_t hashValue)
+{
+    BSLS_ASSERT_SAFE(d_size < d_capacity);
+
+    const bsl::size_t numGroups = d_capacity / GroupControl::k_SIZE;
+
+    bsl::size_t group = groupIndex(hashValue);
+    for (bsl::size_t i = 1; ; ++i) {
+        const bsl::size_t start = group * GroupControl::k_SIZE;
+
+        const GroupControl::BitMask candidates =
+                                GroupControl(d_controls_p + start).available();
+        if (candidates) {
+            return start + bdlb::BitUtil::numTrailingUnsetBits(
+                                                   candidates);       // RETURN
+        }
+        group = (group + i) & (numGroups - 1);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
+                                     prepareInsertion(bsl::size_t hashValue)
+{
+    const bsl::size_t maxSize = d_capacity / k_MAX_LOAD_FACTOR_DENOMINATOR
+                                           * k_MAX_LOAD_FACTOR_NUMERATOR;
+
+    if (d_size >= maxSize) {
+        rehashRaw(d_capacity ? 2 * d_capacity : GroupControl::k_SIZE);
+    }
+
+    return findAvailable(hashValue);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehashRaw(
+                                                       bsl::size_t newCapacity)
+{
+    BSLS_ASSERT_SAFE(d_size <= newCapacity / k_MAX_LOAD_FACTOR_DENOMINATOR
+                                           * k_MAX_LOAD_FACTOR_NUMERATOR);
+
+    // Move the entries into a temporary table whose destructor releases the
+    // new slots if a move throws, and, otherwise, the moved-from entries and
+    // the old slots after 'swapData'.
+
+    FlatHashTable other(0, d_hasher, d_equal, d_allocator_p);
+    other.allocateSlots(newCapacity);
+
+    for (bsl::size_t i = 0; i < d_capacity; ++i) {
+        const bsl::uint8_t control = d_controls_p[i];
+        if (0 == (control & GroupControl::k_EMPTY)) {
+            const bsl::size_t index = other.findAvailable(
+                                    d_hasher(ENTRY_UTIL::key(d_entries_p[i])));
+
+            bslma::ConstructionUtil::construct(
+                                       other.d_entries_p + index,
+                                       d_allocator_p,
+                                       MoveUtil::move(d_entries_p[i]));
+            other.d_controls_p[index] = control;
+            ++other.d_size;
+        }
+    }
+
+    swapData(other);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::swapData(
+                                                          FlatHashTable& other)
+{
+    bslalg::SwapUtil::swap(&d_entries_p,         &other.d_entries_p);
+    bslalg::SwapUtil::swap(&d_controls_p,        &other.d_controls_p);
+    bslalg::SwapUtil::swap(&d_size,              &other.d_size);
+    bslalg::SwapUtil::swap(&d_capacity,          &other.d_capacity);
+    bslalg::SwapUtil::swap(&d_groupControlShift, &other.d_groupControlShift);
+    bslalg::SwapUtil::swap(&d_hasher,            &other.d_hasher);
+    bslalg::SwapUtil::swap(&d_equal,             &other.d_equal);
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findKey(
+                                                   const KEY&  key,
+                                                   bsl::size_t hashValue) const
+{
+    if (0 == d_capacity) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsl::size_t  numGroups = d_capacity / GroupControl::k_SIZE;
+    const bsl::uint8_t h2        = static_cast<bsl::uint8_t>(hashValue
+                                                                & k_H2_MASK);
+
+    bsl::size_t group = groupIndex(hashValue);
+    for (bsl::size_t i = 1; i <= numGroups; ++i) {
+        const bsl::size_t  start = group * GroupControl::k_SIZE;
+        const GroupControl groupControl(d_controls_p + start);
+
+        GroupControl::BitMask candidates = groupControl.match(h2);
+        while (candidates) {
+            const bsl::size_t index = start
+                                   + bdlb::BitUtil::numTrailingUnsetBits(
+                                                                   candidates);
+            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                         d_equal(key, ENTRY_UTIL::key(d_entries_p[index])))) {
+                return index;                                         // RETURN
+            }
+            candidates &= candidates - 1;
+        }
+
+        // An insertion uses the first available slot of a probe sequence,
+        // so a key inserted beyond a group having an empty slot would have
+        // been inserted in that group.
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(groupControl.neverFull())) {
+            break;
+        }
+        group = (group + i) & (numGroups - 1);
+    }
+
+    return d_capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::groupIndex(
+                                                   bsl::size_t hashValue) const
+{
+    BSLS_ASSERT_SAFE(0 < d_capacity);
+
+    // The shift is performed in two steps so that a table having a single
+    // group, whose shift is the number of bits in the hash value, is handled
+    // without undefined behavior.
+
+    return (hashValue >> 1) >> (d_groupControlShift - 1);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::IteratorImp
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iteratorImp(
+                                                       bsl::size_t index) const
+{
+    if (index == d_capacity) {
+        return IteratorImp();                                         // RETURN
+    }
+    return IteratorImp(d_entries_p + index,
+                       d_controls_p + index,
+                       d_capacity - index - 1);
+}
+
+// CREATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                            bsl::size_t       capacity,
+                                            const HASH&       hash,
+                                            const EQUAL&      equal,
+                                            bslma::Allocator *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_capacity(0)
+, d_groupControlShift(0)
+, d_hasher(hash)
+, d_equal(equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (capacity) {
+        allocateSlots(roundUpCapacity(capacity));
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                      const FlatHashTable&  original,
+                                      bslma::Allocator     *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_capacity(0)
+, d_groupControlShift(0)
+, d_hasher(original.d_hasher)
+, d_equal(original.d_equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (original.d_capacity) {
+        // The entries are copied into the same slots as in 'original', within
+        // a temporary table that releases the copies if a copy throws.
+
+        FlatHashTable other(0, d_hasher, d_equal, d_allocator_p);
+        other.allocateSlots(original.d_capacity);
+
+        for (bsl::size_t i = 0; i < original.d_capacity; ++i) {
+            const bsl::uint8_t control = original.d_controls_p[i];
+            if (0 == (control & GroupControl::k_EMPTY)) {
+                bslma::ConstructionUtil::construct(other.d_entries_p + i,
+                                                   d_allocator_p,
+                                                   original.d_entries_p[i]);
+                ++other.d_size;
+            }
+            other.d_controls_p[i] = control;
+        }
+
+        swapData(other);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                     bslmf::MovableRef<FlatHashTable> original)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_capacity(0)
+, d_groupControlShift(0)
+, d_hasher(MoveUtil::access(original).d_hasher)
+, d_equal(MoveUtil::access(original).d_equal)
+, d_allocator_p(MoveUtil::access(original).d_allocator_p)
+{
+    FlatHashTable& lvalue = original;
+
+    swapData(lvalue);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                              bslmf::MovableRef<FlatHashTable>  original,
+                              bslma::Allocator                 *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_capacity(0)
+, d_groupControlShift(0)
+, d_hasher(MoveUtil::access(original).d_hasher)
+, d_equal(MoveUtil::access(original).d_equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    FlatHashTable& lvalue = original;
+
+    if (d_allocator_p == lvalue.d_allocator_p) {
+        swapData(lvalue);
+    }
+    else if (lvalue.d_capacity) {
+        FlatHashTable other(0, d_hasher, d_equal, d_allocator_p);
+        other.allocateSlots(lvalue.d_capacity);
+
+        for (bsl::size_t i = 0; i < lvalue.d_capacity; ++i) {
+            const bsl::uint8_t control = lvalue.d_controls_p[i];
+            if (0 == (control & GroupControl::k_EMPTY)) {
+                bslma::ConstructionUtil::construct(
+                                        other.d_entries_p + i,
+                                        d_allocator_p,
+                                        MoveUtil::move(lvalue.d_entries_p[i]));
+                ++other.d_size;
+            }
+            other.d_controls_p[i] = control;
+        }
+
+        swapData(other);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::~FlatHashTable()
+{
+    destroyEntriesAndDeallocate();
+}
+
+// MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator=(
+                                                      const FlatHashTable& rhs)
+{
+    if (this != &rhs) {
+        FlatHashTable other(rhs, d_allocator_p);
+
+        swapData(other);
+    }
+
+    return *this;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator=(
+                                          bslmf::MovableRef<FlatHashTable> rhs)
+{
+    FlatHashTable& lvalue = rhs;
+
+    if (this != &lvalue) {
+        FlatHashTable other(MoveUtil::move(lvalue), d_allocator_p);
+
+        swapData(other);
+    }
+
+    return *this;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::clear()
+{
+    for (bsl::size_t i = 0; i < d_capacity && d_size; ++i) {
+        if (0 == (d_controls_p[i] & GroupControl::k_EMPTY)) {
+            bslma::DestructionUtil::destroy(d_entries_p + i);
+            --d_size;
+        }
+    }
+    if (d_controls_p) {
+        bsl::memset(d_controls_p, GroupControl::k_EMPTY, d_capacity);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::pair<
+    typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+    typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::equal_range(
+                                                                const KEY& key)
+{
+    iterator it1 = find(key);
+    iterator it2 = it1;
+    if (it1 != end()) {
+        ++it2;
+    }
+    return bsl::make_pair(it1, it2);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+                                                                const KEY& key)
+{
+    const bsl::size_t index = findKey(key, d_hasher(key));
+    if (index < d_capacity) {
+        eraseSlot(index);
+        return 1;                                                     // RETURN
+    }
+    return 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+                                                  const_iterator position)
+{
+    BSLS_ASSERT(position != end());
+
+    const bsl::size_t index = bsls::Util::addressOf(*position) - d_entries_p;
+
+    BSLS_ASSERT_SAFE(index < d_capacity);
+
+    // Find the next entry before erasing, since the erased slot cannot be
+    // used to advance.
+
+    IteratorImp next = iteratorImp(index);
+    ++next;
+
+    eraseSlot(index);
+
+    return iterator(next);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(iterator position)
+{
+    return erase(const_iterator(position));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+                                                    const_iterator first,
+                                                    const_iterator last)
+{
+    // Erasing an entry marks its slot available without moving any other
+    // entry, so 'last' remains valid.
+
+    while (first != last) {
+        first = erase(first);
+    }
+
+    return iterator(last.imp());
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key)
+{
+    return iterator(iteratorImp(findKey(key, d_hasher(key))));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::pair<
+    typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+    bool>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insert(const ENTRY& entry)
+{
+    const KEY&        key       = ENTRY_UTIL::key(entry);
+    const bsl::size_t hashValue = d_hasher(key);
+
+    bsl::size_t index = findKey(key, hashValue);
+    if (index < d_capacity) {
+        return bsl::pair<iterator, bool>(iterator(iteratorImp(index)),
+                                         false);                      // RETURN
+    }
+
+    index = prepareInsertion(hashValue);
+
+    bslma::ConstructionUtil::construct(d_entries_p + index,
+                                       d_allocator_p,
+                                       entry);
+    d_controls_p[index] = static_cast<bsl::uint8_t>(hashValue & k_H2_MASK);
+    ++d_size;
+
+    return bsl::pair<iterator, bool>(iterator(iteratorImp(index)), true);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::pair<
+    typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+    bool>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insert(
+                                               bslmf::MovableRef<ENTRY> entry)
+{
+    ENTRY&            lvalue    = entry;
+    const KEY&        key       = ENTRY_UTIL::key(lvalue);
+    const bsl::size_t hashValue = d_hasher(key);
+
+    bsl::size_t index = findKey(key, hashValue);
+    if (index < d_capacity) {
+        return bsl::pair<iterator, bool>(iterator(iteratorImp(index)),
+                                         false);                      // RETURN
+    }
+
+    index = prepareInsertion(hashValue);
+
+    bslma::ConstructionUtil::construct(d_entries_p + index,
+                                       d_allocator_p,
+                                       MoveUtil::move(lvalue));
+    d_controls_p[index] = static_cast<bsl::uint8_t>(hashValue & k_H2_MASK);
+    ++d_size;
+
+    return bsl::pair<iterator, bool>(iterator(iteratorImp(index)), true);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehash(
+                                                   bsl::size_t minimumCapacity)
+{
+    if (0 == minimumCapacity && 0 == d_size) {
+        reset();
+        return;                                                       // RETURN
+    }
+
+    bsl::size_t newCapacity = minimumCompliantCapacity(d_size);
+    while (newCapacity < minimumCapacity) {
+        newCapacity *= 2;
+    }
+
+    if (newCapacity != d_capacity) {
+        rehashRaw(newCapacity);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::reserve(
+                                                        bsl::size_t numEntries)
+{
+    if (0 == numEntries && 0 == d_size) {
+        reset();
+        return;                                                       // RETURN
+    }
+
+    const bsl::size_t newCapacity = minimumCompliantCapacity(
+                                            numEntries < d_size ? d_size
+                                                                : numEntries);
+
+    if (newCapacity > d_capacity) {
+        rehashRaw(newCapacity);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::reset()
+{
+    destroyEntriesAndDeallocate();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::pair<
+    typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+    bool>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::tryEmplace(const KEY& key)
+{
+    const bsl::size_t hashValue = d_hasher(key);
+
+    bsl::size_t index = findKey(key, hashValue);
+    if (index < d_capacity) {
+        return bsl::pair<iterator, bool>(iterator(iteratorImp(index)),
+                                         false);                      // RETURN
+    }
+
+    index = prepareInsertion(hashValue);
+
+    ENTRY_UTIL::constructFromKey(d_entries_p + index, d_allocator_p, key);
+    d_controls_p[index] = static_cast<bsl::uint8_t>(hashValue & k_H2_MASK);
+    ++d_size;
+
+    return bsl::pair<iterator, bool>(iterator(iteratorImp(index)), true);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::pair<
+    typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+    bool>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::tryEmplace(
+                                                    bslmf::MovableRef<KEY> key)
+{
+    KEY&              lvalue    = key;
+    const bsl::size_t hashValue = d_hasher(lvalue);
+
+    bsl::size_t index = findKey(lvalue, hashValue);
+    if (index < d_capacity) {
+        return bsl::pair<iterator, bool>(iterator(iteratorImp(index)),
+                                         false);                      // RETURN
+    }
+
+    index = prepareInsertion(hashValue);
+
+    ENTRY_UTIL::constructFromKey(d_entries_p + index,
+                                 d_allocator_p,
+                                 MoveUtil::move(lvalue));
+    d_controls_p[index] = static_cast<bsl::uint8_t>(hashValue & k_H2_MASK);
+    ++d_size;
+
+    return bsl::pair<iterator, bool>(iterator(iteratorImp(index)), true);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin()
+{
+    for (bsl::size_t i = 0; i < d_capacity && d_size; ++i) {
+        if (0 == (d_controls_p[i] & GroupControl::k_EMPTY)) {
+            return iterator(iteratorImp(i));                          // RETURN
+        }
+    }
+    return end();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::end()
+{
+    return iterator();
+}
+
+                                // Aspects
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::swap(
+                                                          FlatHashTable& other)
+{
+    BSLS_ASSERT(allocator() == other.allocator());
+
+    swapData(other);
+}
+
+// ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::capacity()
+                                                                          const
+{
+    return d_capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::contains(
+                                                          const KEY& key) const
+{
+    return findKey(key, d_hasher(key)) < d_capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+const bsl::uint8_t *
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::controlBytes() const
+{
+    return d_controls_p;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::count(
+                                                          const KEY& key) const
+{
+    return contains(key) ? 1 : 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::empty() const
+{
+    return 0 == d_size;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::pair<
+    typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
+                                                                const_iterator,
+    typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
+                                                                const_iterator>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::equal_range(
+                                                          const KEY& key) const
+{
+    const_iterator it1 = find(key);
+    const_iterator it2 = it1;
+    if (it1 != end()) {
+        ++it2;
+    }
+    return bsl::make_pair(it1, it2);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key) const
+{
+    return const_iterator(iteratorImp(findKey(key, d_hasher(key))));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+HASH FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::hash_function() const
+{
+    return d_hasher;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+EQUAL FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::key_eq() const
+{
+    return d_equal;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+float FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::load_factor() const
+{
+    return d_capacity ? static_cast<float>(d_size)
+                                            / static_cast<float>(d_capacity)
+                      : 0.0f;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+float FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::max_load_factor()
+                                                                          const
+{
+    return static_cast<float>(k_MAX_LOAD_FACTOR_NUMERATOR)
+                           / static_cast<float>(k_MAX_LOAD_FACTOR_DENOMINATOR);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::size() const
+{
+    return d_size;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin() const
+{
+    return const_cast<FlatHashTable *>(this)->begin();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::cbegin() const
+{
+    return begin();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::end() const
+{
+    return const_iterator();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::cend() const
+{
+    return const_iterator();
+}
+
+                                // Aspects
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bslma::Allocator *
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool bdlc::operator==(
+                const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+                const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs)
+{
+    typedef typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
+                                                    const_iterator ConstItr;
+
+    if (lhs.size() != rhs.size()) {
+        return false;                                                 // RETURN
+    }
+
+    for (ConstItr it = lhs.begin(); it != lhs.end(); ++it) {
+        ConstItr rhsIt = rhs.find(ENTRY_UTIL::key(*it));
+        if (rhsIt == rhs.end() || !(*rhsIt == *it)) {
+            return false;                                             // RETURN
+        }
+    }
+
+    return true;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(
+                const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+                const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void bdlc::swap(FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& a,
+                FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+
+        return;                                                       // RETURN
+    }
+
+    typedef FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL> Table;
+
+    Table futureA(b, a.allocator());
+    Table futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1267 @@
+// bdlc_flathashtable.t.cpp                                           -*-C++-*-
+#include <bdlc_flathashtable.h>
+
+#include <bslim_testutil.h>
+
+#include <bslh_hash.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_unordered_set.h>
+#include <bsl_utility.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is an open-addressed hash table, parameterized by
+// an entry utility, that is the implementation of 'bdlc::FlatHashMap' and
+// 'bdlc::FlatHashSet'.  The table is tested with a set-like entry utility
+// whose entries are their own keys, for 'int' and 'bsl::string' entries, and
+// with hash functors of deliberately poor quality, so that probe sequences
+// spanning several groups, and the marking of erased slots, are exercised.
+// The primary manipulators are 'tryEmplace' and 'erase', and the basic
+// accessors are 'find', 'size', and 'capacity'.  A randomized test compares
+// the table against 'bsl::unordered_set' as an oracle.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatHashTable(size_t, const HASH&, const EQUAL&, Allocator *);
+// [ 5] FlatHashTable(const FlatHashTable&, Allocator *);
+// [ 5] FlatHashTable(MovableRef<FlatHashTable>);
+// [ 5] FlatHashTable(MovableRef<FlatHashTable>, Allocator *);
+// [ 2] ~FlatHashTable();
+//
+// MANIPULATORS
+// [ 5] FlatHashTable& operator=(const FlatHashTable&);
+// [ 5] FlatHashTable& operator=(MovableRef<FlatHashTable>);
+// [ 4] void clear();
+// [ 3] pair<iterator, iterator> equal_range(const KEY&);
+// [ 3] size_t erase(const KEY&);
+// [ 6] iterator erase(const_iterator);
+// [ 6] iterator erase(iterator);
+// [ 6] iterator erase(const_iterator, const_iterator);
+// [ 2] iterator find(const KEY&);
+// [ 2] pair<iterator, bool> insert(const ENTRY&);
+// [ 2] pair<iterator, bool> insert(MovableRef<ENTRY>);
+// [ 4] void rehash(size_t);
+// [ 4] void reserve(size_t);
+// [ 4] void reset();
+// [ 2] pair<iterator, bool> tryEmplace(const KEY&);
+// [ 2] pair<iterator, bool> tryEmplace(MovableRef<KEY>);
+// [ 6] iterator begin();
+// [ 6] iterator end();
+// [ 5] void swap(FlatHashTable&);
+//
+// ACCESSORS
+// [ 2] size_t capacity() const;
+// [ 2] bool contains(const KEY&) const;
+// [ 3] const bsl::uint8_t *controlBytes() const;
+// [ 2] size_t count(const KEY&) const;
+// [ 2] bool empty() const;
+// [ 3] pair<const_iter, const_iter> equal_range(const KEY&) const;
+// [ 2] const_iterator find(const KEY&) const;
+// [ 2] HASH hash_function() const;
+// [ 2] EQUAL key_eq() const;
+// [ 4] float load_factor() const;
+// [ 4] float max_load_factor() const;
+// [ 2] size_t size() const;
+// [ 6] const_iterator begin() const;
+// [ 6] const_iterator cbegin() const;
+// [ 6] const_iterator end() const;
+// [ 6] const_iterator cend() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const FlatHashTable&, const FlatHashTable&);
+// [ 5] bool operator!=(const FlatHashTable&, const FlatHashTable&);
+// [ 5] void swap(FlatHashTable&, FlatHashTable&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] CONCERN: the table is exception neutral
+// [ 8] CONCERN: the table behaves as 'bsl::unordered_set'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                       GLOBAL HELPER CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+template <class ENTRY>
+struct TestEntryUtil {
+    // This 'struct' provides the entry utility of a set-like table whose
+    // entries are their own keys.
+
+    static void constructFromKey(ENTRY            *entry,
+                                 bslma::Allocator *allocator,
+                                 const ENTRY&      key)
+        // Create at the specified 'entry' a copy of the specified 'key' using
+        // the specified 'allocator'.
+    {
+        bslma::ConstructionUtil::construct(entry, allocator, key);
+    }
+
+    static void constructFromKey(ENTRY                    *entry,
+                                 bslma::Allocator         *allocator,
+                                 bslmf::MovableRef<ENTRY>  key)
+        // Create at the specified 'entry' the value moved from the specified
+        // 'key' using the specified 'allocator'.
+    {
+        bslma::ConstructionUtil::construct(entry,
+                                           allocator,
+                                           bslmf::MovableRefUtil::move(key));
+    }
+
+    static const ENTRY& key(const ENTRY& entry)
+        // Return the specified 'entry'.
+    {
+        return entry;
+    }
+};
+
+struct PoorHash {
+    // This functor hashes an 'int' to a value in which only the specified
+    // number of high-order bits (selecting the first group of a probe
+    // sequence) and the 7 low-order bits (the control byte) vary, so that
+    // many keys share a probe sequence.
+
+    int d_groupBits;  // number of varying high-order bits
+
+    explicit PoorHash(int groupBits = 0)
+    : d_groupBits(groupBits)
+    {
+    }
+
+    bsl::size_t operator()(int key) const
+        // Return the hash value of the specified 'key'.
+    {
+        const bsl::size_t low  = static_cast<bsl::size_t>(key) & 0x7F;
+        const bsl::size_t high = d_groupBits
+                     ? static_cast<bsl::size_t>(key >> 7)
+                                 << (sizeof(bsl::size_t) * 8 - d_groupBits)
+                     : 0;
+        return high | low;
+    }
+};
+
+struct ConstantHash {
+    // This functor hashes every 'int' to the same value.
+
+    bsl::size_t operator()(int) const
+        // Return 0.
+    {
+        return 0;
+    }
+};
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatHashTable<int,
+                            int,
+                            TestEntryUtil<int>,
+                            bslh::Hash<>,
+                            bsl::equal_to<int> >          Obj;
+
+typedef bdlc::FlatHashTable<int,
+                            int,
+                            TestEntryUtil<int>,
+                            PoorHash,
+                            bsl::equal_to<int> >          PoorObj;
+
+typedef bdlc::FlatHashTable<int,
+                            int,
+                            TestEntryUtil<int>,
+                            ConstantHash,
+                            bsl::equal_to<int> >          ConstantObj;
+
+typedef bdlc::FlatHashTable<bsl::string,
+                            bsl::string,
+                            TestEntryUtil<bsl::string>,
+                            bslh::Hash<>,
+                            bsl::equal_to<bsl::string> >  StringObj;
+
+typedef bdlc::FlatHashTable_GroupControl                  GroupControl;
+
+const bsl::size_t k_SIZE = GroupControl::k_SIZE;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bsl::string makeString(int value)
+    // Return a string, too long for the short-string optimization, that is
+    // unique to the specified 'value'.
+{
+    bsl::string rv("a string long enough to allocate memory: ");
+    do {
+        rv.push_back(static_cast<char>('0' + value % 10));
+        value /= 10;
+    } while (value);
+    return rv;
+}
+
+template <class TABLE>
+static bool isValid(const TABLE& table)
+    // Return 'true' if the size of the specified 'table' is the number of its
+    // in-use control bytes and of its iterated entries, each entry is found
+    // by 'find', and the load factor does not exceed its maximum; and 'false'
+    // otherwise.
+{
+    const bsl::uint8_t *controls = table.controlBytes();
+
+    bsl::size_t numInUse = 0;
+    for (bsl::size_t i = 0; i < table.capacity(); ++i) {
+        if (0 == (controls[i] & GroupControl::k_EMPTY)) {
+            ++numInUse;
+        }
+    }
+
+    bsl::size_t numIterated = 0;
+    for (typename TABLE::const_iterator it = table.begin();
+         it != table.end();
+         ++it) {
+        if (table.find(*it) != it) {
+            return false;                                             // RETURN
+        }
+        ++numIterated;
+    }
+
+    return numInUse    == table.size()
+        && numIterated == table.size()
+        && table.load_factor() <= table.max_load_factor();
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // ORACLE TEST
+        //
+        // Concerns:
+        //: 1 A table behaves as a 'bsl::unordered_set' for any sequence of
+        //:   insertions, lookups, and erasures, including when many keys
+        //:   share probe sequences and slots are erased in full groups.
+        //
+        // Plan:
+        //: 1 Apply the same pseudo-random sequence of operations on a small
+        //:   key range to a table using 'PoorHash' and to a
+        //:   'bsl::unordered_set', and verify that the results of each
+        //:   operation and the contents agree.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: the table behaves as 'bsl::unordered_set'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ORACLE TEST" << endl
+                          << "===========" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        for (int groupBits = 0; groupBits <= 3; ++groupBits) {
+            PoorObj                 mX(0, PoorHash(groupBits),
+                                       bsl::equal_to<int>(), &oa);
+            const PoorObj&          X = mX;
+            bsl::unordered_set<int> oracle;
+
+            unsigned int seed = 17 + groupBits;
+            for (int ti = 0; ti < 20000; ++ti) {
+                seed = seed * 1103515245u + 12345u;
+                const int op  = (seed >> 8) % 3;
+                const int key = static_cast<int>((seed >> 12) % 600);
+
+                if (veryVeryVerbose) { T_ P_(ti) P_(op) P(key) }
+
+                switch (op) {
+                  case 0: {
+                    const bool inserted = mX.tryEmplace(key).second;
+                    ASSERTV(groupBits, ti, key,
+                            oracle.insert(key).second == inserted);
+                  } break;
+                  case 1: {
+                    ASSERTV(groupBits, ti, key,
+                            oracle.erase(key) == mX.erase(key));
+                  } break;
+                  default: {
+                    ASSERTV(groupBits, ti, key,
+                            oracle.count(key) == X.count(key));
+                  }
+                }
+                ASSERTV(groupBits, ti, oracle.size() == X.size());
+            }
+
+            ASSERTV(groupBits, isValid(X));
+            for (int key = 0; key < 600; ++key) {
+                ASSERTV(groupBits, key, oracle.count(key) == X.count(key));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY
+        //
+        // Concerns:
+        //: 1 If the construction of an entry throws during an insertion,
+        //:   including an insertion that grows the table, the table is left
+        //:   valid, holds every entry it held before, and no memory leaks.
+        //:
+        //: 2 If an allocation throws during a copy construction, no memory
+        //:   leaks.
+        //
+        // Plan:
+        //: 1 Using the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros, insert
+        //:   allocating strings into tables of various sizes, and copy the
+        //:   tables, and verify the tables and the test allocator.  (C-1,2)
+        //
+        // Testing:
+        //   CONCERN: the table is exception neutral
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EXCEPTION SAFETY" << endl
+                          << "================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        for (int n = 0; n < 40; ++n) {
+            StringObj        mX(0, bslh::Hash<>(),
+                                bsl::equal_to<bsl::string>(), &oa);
+            const StringObj& X = mX;
+
+            for (int i = 0; i < n; ++i) {
+                mX.tryEmplace(makeString(i));
+            }
+
+            const bsl::string KEY = makeString(n);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                ASSERTV(n, isValid(X));
+                for (int i = 0; i < n; ++i) {
+                    ASSERTV(n, i, X.contains(makeString(i)));
+                }
+
+                mX.insert(KEY);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERTV(n, isValid(X));
+            ASSERTV(n, static_cast<bsl::size_t>(n + 1) == X.size());
+            ASSERTV(n, X.contains(KEY));
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                const StringObj Y(X, &oa);
+
+                ASSERTV(n, X == Y);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // ITERATORS AND ERASURE BY POSITION
+        //
+        // Concerns:
+        //: 1 Iteration visits each entry exactly once, and 'begin() == end()'
+        //:   for an empty table, including one having capacity 0.
+        //:
+        //: 2 'erase(position)' erases the entry at 'position' and returns an
+        //:   iterator to the next entry in the iteration order.
+        //:
+        //: 3 'erase(first, last)' erases the range and returns 'last'.
+        //
+        // Plan:
+        //: 1 Populate tables of various sizes, and verify the iterated
+        //:   entries, then erase entries while iterating, and erase ranges.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   iterator erase(const_iterator);
+        //   iterator erase(iterator);
+        //   iterator erase(const_iterator, const_iterator);
+        //   iterator begin();
+        //   iterator end();
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ITERATORS AND ERASURE BY POSITION" << endl
+                          << "=================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX(0, bslh::Hash<>(), bsl::equal_to<int>(), &oa);
+            const Obj& X = mX;
+
+            ASSERT(mX.begin() == mX.end());
+            ASSERT(X.begin()  == X.end());
+            ASSERT(X.cbegin() == X.cend());
+        }
+
+        for (int n = 0; n < 100; n += 7) {
+            Obj mX(0, bslh::Hash<>(), bsl::equal_to<int>(), &oa);
+            const Obj& X = mX;
+
+            for (int i = 0; i < n; ++i) {
+                mX.tryEmplace(i);
+            }
+
+            bsl::unordered_set<int> seen;
+            for (Obj::const_iterator it = X.cbegin(); it != X.cend(); ++it) {
+                ASSERTV(n, *it, seen.insert(*it).second);
+            }
+            ASSERTV(n, static_cast<bsl::size_t>(n) == seen.size());
+
+            // Erase the odd entries while iterating.
+
+            Obj::iterator it = mX.begin();
+            while (it != mX.end()) {
+                if (*it % 2) {
+                    Obj::iterator next = it;
+                    ++next;
+
+                    it = mX.erase(it);
+                    ASSERTV(n, next == it);
+                }
+                else {
+                    ++it;
+                }
+            }
+            ASSERTV(n, static_cast<bsl::size_t>((n + 1) / 2) == X.size());
+            ASSERTV(n, isValid(X));
+
+            // Erase the first half of the iteration order.
+
+            Obj::const_iterator middle = X.begin();
+            for (bsl::size_t i = 0; i < X.size() / 2; ++i) {
+                ++middle;
+            }
+            const bsl::size_t remaining = X.size() - X.size() / 2;
+
+            Obj::iterator rv = mX.erase(X.begin(), middle);
+            ASSERTV(n, middle == rv);
+            ASSERTV(n, remaining == X.size());
+            ASSERTV(n, X.begin() == middle);
+
+            mX.erase(X.begin(), X.end());
+            ASSERTV(n, X.empty());
+            ASSERTV(n, X.begin() == X.end());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 A copy has the same value and capacity as the original, and uses
+        //:   the supplied allocator.
+        //:
+        //: 2 A move with the same allocator steals the slots without
+        //:   allocating; a move with another allocator copies the entries
+        //:   using that allocator.
+        //:
+        //: 3 Assignment, including self-assignment, gives the value of the
+        //:   source and retains the allocator of the target.
+        //:
+        //: 4 'swap' exchanges the values, whether or not the allocators are
+        //:   the same (free function).
+        //:
+        //: 5 Two tables are equal if they hold the same entries, irrespective
+        //:   of their capacities and of the order of insertion.
+        //
+        // Plan:
+        //: 1 Perform each operation on tables of allocating strings of
+        //:   various sizes, and verify the values, capacities, and
+        //:   allocators.  (C-1..5)
+        //
+        // Testing:
+        //   FlatHashTable(const FlatHashTable&, Allocator *);
+        //   FlatHashTable(MovableRef<FlatHashTable>);
+        //   FlatHashTable(MovableRef<FlatHashTable>, Allocator *);
+        //   FlatHashTable& operator=(const FlatHashTable&);
+        //   FlatHashTable& operator=(MovableRef<FlatHashTable>);
+        //   void swap(FlatHashTable&);
+        //   bool operator==(const FlatHashTable&, const FlatHashTable&);
+        //   bool operator!=(const FlatHashTable&, const FlatHashTable&);
+        //   void swap(FlatHashTable&, FlatHashTable&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                   << "COPY, MOVE, ASSIGNMENT, SWAP, AND EQUALITY" << endl
+                   << "==========================================" << endl;
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        const bslh::Hash<>               H;
+        const bsl::equal_to<bsl::string> E;
+
+        for (int n = 0; n < 50; n += 7) {
+            StringObj mX(0, H, E, &oa);  const StringObj& X = mX;
+            for (int i = 0; i < n; ++i) {
+                mX.tryEmplace(makeString(i));
+            }
+
+            // equality, irrespective of capacity and insertion order
+
+            {
+                StringObj mY(4 * X.capacity() + k_SIZE, H, E, &za);
+                const StringObj& Y = mY;
+                for (int i = n - 1; i >= 0; --i) {
+                    mY.tryEmplace(makeString(i));
+                }
+                ASSERTV(n, X == Y);
+                ASSERTV(n, !(X != Y));
+
+                mY.tryEmplace(makeString(n));
+                ASSERTV(n, X != Y);
+
+                mY.erase(makeString(0));
+                ASSERTV(n, (0 != n) == (X != Y));
+            }
+
+            // copy construction
+
+            {
+                const StringObj Y(X, &za);
+
+                ASSERTV(n, X == Y);
+                ASSERTV(n, X.capacity() == Y.capacity());
+                ASSERTV(n, &za == Y.allocator());
+                ASSERTV(n, isValid(Y));
+            }
+
+            // move construction, same and different allocator
+
+            {
+                StringObj mY(X, &oa);
+
+                const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+
+                StringObj mZ(MoveUtil::move(mY));
+                ASSERTV(n, X == mZ);
+                ASSERTV(n, mY.empty());
+                ASSERTV(n, &oa == mZ.allocator());
+                ASSERTV(n, NUM_BLOCKS == oa.numBlocksTotal());
+
+                StringObj mW(MoveUtil::move(mZ), &oa);
+                ASSERTV(n, X == mW);
+                ASSERTV(n, NUM_BLOCKS == oa.numBlocksTotal());
+
+                StringObj mV(MoveUtil::move(mW), &za);
+                ASSERTV(n, X == mV);
+                ASSERTV(n, &za == mV.allocator());
+                ASSERTV(n, isValid(mV));
+            }
+
+            // copy and move assignment
+
+            {
+                StringObj mY(0, H, E, &za);
+                mY.tryEmplace(makeString(1000));
+
+                StringObj *mR = &(mY = X);
+                ASSERTV(n, &mY == mR);
+                ASSERTV(n, X == mY);
+                ASSERTV(n, &za == mY.allocator());
+
+                mR = &(mY = mY);
+                ASSERTV(n, &mY == mR);
+                ASSERTV(n, X == mY);
+
+                StringObj mZ(0, H, E, &oa);
+                mZ = MoveUtil::move(mY);
+                ASSERTV(n, X == mZ);
+                ASSERTV(n, &oa == mZ.allocator());
+                ASSERTV(n, isValid(mZ));
+
+                StringObj mW(X, &oa);
+                const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+                mZ.reset();
+                mZ = MoveUtil::move(mW);
+                ASSERTV(n, X == mZ);
+                ASSERTV(n, NUM_BLOCKS == oa.numBlocksTotal());
+            }
+
+            // swap
+
+            {
+                StringObj mY(0, H, E, &oa);
+                mY.tryEmplace(makeString(1000));
+                const StringObj YY(mY, &za);
+
+                StringObj mZ(X, &oa);
+
+                mZ.swap(mY);
+                ASSERTV(n, X  == mY);
+                ASSERTV(n, YY == mZ);
+
+                StringObj mW(X, &za);
+
+                swap(mZ, mW);
+                ASSERTV(n, X  == mZ);
+                ASSERTV(n, YY == mW);
+                ASSERTV(n, &oa == mZ.allocator());
+                ASSERTV(n, &za == mW.allocator());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            StringObj mX(0, H, E, &oa);
+            StringObj mY(0, H, E, &oa);
+            StringObj mZ(0, H, E, &za);
+
+            ASSERT_PASS(mX.swap(mY));
+            ASSERT_FAIL(mX.swap(mZ));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CAPACITY MANAGEMENT
+        //
+        // Concerns:
+        //: 1 The capacity of a table is 0 or a power of two that is at least
+        //:   the group size, and a table grows before its load factor exceeds
+        //:   7/8.
+        //:
+        //: 2 'reserve' and 'rehash' give a capacity sufficient for the
+        //:   requested number of entries or slots, and never less than needed
+        //:   for the current entries; 'reserve' never shrinks the table.
+        //:
+        //: 3 'reserve(0)' and 'rehash(0)' on an empty table, and 'reset',
+        //:   release all memory.
+        //:
+        //: 4 'clear' removes the entries and retains the slots.
+        //
+        // Plan:
+        //: 1 Insert entries one at a time and verify the capacity and the
+        //:   load factor after each insertion.  (C-1)
+        //:
+        //: 2 Call 'reserve', 'rehash', 'clear', and 'reset' on tables of
+        //:   various sizes and verify the capacity, the entries, and the
+        //:   memory in use.  (C-2..4)
+        //
+        // Testing:
+        //   void clear();
+        //   void rehash(size_t);
+        //   void reserve(size_t);
+        //   void reset();
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CAPACITY MANAGEMENT" << endl
+                          << "===================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const bslh::Hash<>       H;
+        const bsl::equal_to<int> E;
+
+        {
+            Obj mX(0, H, E, &oa);  const Obj& X = mX;
+
+            ASSERT(0.875f == X.max_load_factor());
+            ASSERT(0.0f   == X.load_factor());
+
+            bsl::size_t lastCapacity = 0;
+            for (int i = 0; i < 1000; ++i) {
+                mX.tryEmplace(i);
+
+                const bsl::size_t capacity = X.capacity();
+                ASSERTV(i, k_SIZE <= capacity);
+                ASSERTV(i, 0 == (capacity & (capacity - 1)));
+                ASSERTV(i, X.load_factor() <= 0.875f);
+                ASSERTV(i, lastCapacity == capacity
+                        || lastCapacity * 2 == capacity
+                        || 0 == lastCapacity);
+                lastCapacity = capacity;
+            }
+            ASSERT(1024 == X.capacity() || 2048 == X.capacity());
+            ASSERT(isValid(X));
+        }
+
+        for (int n = 0; n < 200; n += 13) {
+            Obj mX(0, H, E, &oa);  const Obj& X = mX;
+            for (int i = 0; i < n; ++i) {
+                mX.tryEmplace(i);
+            }
+
+            for (bsl::size_t r = 0; r < 600; r += 37) {
+                const bsl::size_t capacity = X.capacity();
+
+                mX.reserve(r);
+                ASSERTV(n, r, capacity <= X.capacity() || 0 == r);
+                ASSERTV(n, r, r <= X.capacity() * 7 / 8);
+                ASSERTV(n, r, static_cast<bsl::size_t>(n) == X.size());
+                ASSERTV(n, r, isValid(X));
+
+                mX.rehash(r);
+                ASSERTV(n, r, r <= X.capacity());
+                ASSERTV(n, r, X.size() <= X.capacity() * 7 / 8);
+                ASSERTV(n, r, 0 == X.capacity()
+                           || X.capacity() / 2 < r
+                           || X.capacity() == k_SIZE
+                           || X.capacity() / 2 * 7 / 8 < X.size());
+                ASSERTV(n, r, isValid(X));
+
+                for (int i = 0; i < n; ++i) {
+                    ASSERTV(n, r, i, X.contains(i));
+                }
+            }
+
+            const bsl::size_t capacity = X.capacity();
+
+            mX.clear();
+            ASSERTV(n, X.empty());
+            ASSERTV(n, capacity == X.capacity());
+            ASSERTV(n, !X.contains(0));
+
+            mX.rehash(0);
+            ASSERTV(n, 0 == X.capacity());
+            ASSERTV(n, 0 == oa.numBlocksInUse());
+
+            mX.tryEmplace(1);
+            mX.reserve(0);
+            ASSERTV(n, k_SIZE == X.capacity());
+
+            mX.reset();
+            ASSERTV(n, 0 == X.capacity());
+            ASSERTV(n, X.empty());
+            ASSERTV(n, 0 == oa.numBlocksInUse());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ERASURE BY KEY AND CONTROL BYTES
+        //
+        // Concerns:
+        //: 1 'erase(key)' removes the entry having 'key' and returns 1, or
+        //:   returns 0 if there is no such entry.
+        //:
+        //: 2 The control byte of an in-use slot holds the 7 low-order bits of
+        //:   the hash value of its key.
+        //:
+        //: 3 An erased slot is marked empty if its group has an empty slot,
+        //:   and erased otherwise, so that keys inserted beyond a full group
+        //:   remain reachable.
+        //:
+        //: 4 An erased slot is reused by a later insertion.
+        //:
+        //: 5 'equal_range' returns a range of one entry if the key is
+        //:   present, and an empty range otherwise.
+        //
+        // Plan:
+        //: 1 Using 'ConstantHash', so that every key shares the probe
+        //:   sequence and the control byte, fill more than one group, erase
+        //:   keys from the full group and from the partially filled group,
+        //:   and verify the control bytes and the lookups.  (C-1..4)
+        //:
+        //: 2 Verify the control bytes of a table using 'PoorHash'.  (C-2)
+        //:
+        //: 3 Verify 'equal_range' for present and absent keys.  (C-5)
+        //
+        // Testing:
+        //   size_t erase(const KEY&);
+        //   pair<iterator, iterator> equal_range(const KEY&);
+        //   pair<const_iter, const_iter> equal_range(const KEY&) const;
+        //   const bsl::uint8_t *controlBytes() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ERASURE BY KEY AND CONTROL BYTES" << endl
+                          << "================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            // A capacity of 64 holds 56 entries before growing; insert 20, so
+            // that the first group is full and the second is not.
+
+            ConstantObj mX(64, ConstantHash(), bsl::equal_to<int>(), &oa);
+            const ConstantObj& X = mX;
+
+            ASSERT(64 == X.capacity());
+
+            for (int i = 0; i < 20; ++i) {
+                ASSERTV(i, 1 == mX.tryEmplace(i).second);
+            }
+            ASSERT(64 == X.capacity());
+
+            const bsl::uint8_t *controls = X.controlBytes();
+            for (bsl::size_t i = 0; i < 20; ++i) {
+                ASSERTV(i, 0 == controls[i]);
+            }
+            for (bsl::size_t i = 20; i < 64; ++i) {
+                ASSERTV(i, GroupControl::k_EMPTY == controls[i]);
+            }
+
+            // Erase from the full group: the slot is marked erased.
+
+            ASSERT(1 == mX.erase(3));
+            ASSERT(0 == mX.erase(3));
+            ASSERT(GroupControl::k_ERASED == X.controlBytes()[3]);
+
+            // The keys beyond the full group are still found.
+
+            for (int i = 0; i < 20; ++i) {
+                ASSERTV(i, (3 != i) == X.contains(i));
+            }
+
+            // Erase from the group having empty slots: the slot is marked
+            // empty.
+
+            ASSERT(1 == mX.erase(18));
+            ASSERT(GroupControl::k_EMPTY == X.controlBytes()[18]);
+            ASSERT(!X.contains(18));
+            ASSERT( X.contains(19));
+
+            // The erased slot is reused.
+
+            ASSERT(1 == mX.tryEmplace(100).second);
+            ASSERT(0 == X.controlBytes()[3]);
+            ASSERT(100 == *X.find(100));
+            ASSERT(&*X.find(100) == &*X.begin() + 3);
+
+            ASSERT(19 == X.size());
+            ASSERT(isValid(X));
+        }
+
+        {
+            PoorObj mX(0, PoorHash(2), bsl::equal_to<int>(), &oa);
+            const PoorObj& X = mX;
+
+            for (int i = 0; i < 500; ++i) {
+                mX.tryEmplace(i);
+            }
+
+            // Each in-use control byte value occurs as often as the keys
+            // whose hash values have those 7 low-order bits.
+
+            int expCount[128] = { 0 };
+            int count[128]    = { 0 };
+
+            for (int i = 0; i < 500; ++i) {
+                ++expCount[X.hash_function()(i) & 0x7F];
+            }
+
+            const bsl::uint8_t *controls = X.controlBytes();
+            for (bsl::size_t i = 0; i < X.capacity(); ++i) {
+                ASSERTV(i, controls[i] < 0x80
+                        || GroupControl::k_EMPTY == controls[i]);
+                if (controls[i] < 0x80) {
+                    ++count[controls[i]];
+                }
+            }
+            for (int h = 0; h < 128; ++h) {
+                ASSERTV(h, expCount[h] == count[h]);
+            }
+        }
+
+        {
+            Obj mX(0, bslh::Hash<>(), bsl::equal_to<int>(), &oa);
+            const Obj& X = mX;
+
+            for (int i = 0; i < 10; ++i) {
+                mX.tryEmplace(i);
+            }
+
+            bsl::pair<Obj::iterator, Obj::iterator> r = mX.equal_range(4);
+            ASSERT(r.first != r.second);
+            ASSERT(4 == *r.first);
+            ++r.first;
+            ASSERT(r.first == r.second);
+
+            r = mX.equal_range(40);
+            ASSERT(r.first  == mX.end());
+            ASSERT(r.second == mX.end());
+
+            bsl::pair<Obj::const_iterator, Obj::const_iterator> cr =
+                                                            X.equal_range(7);
+            ASSERT(7 == *cr.first);
+            ++cr.first;
+            ASSERT(cr.first == cr.second);
+
+            cr = X.equal_range(-1);
+            ASSERT(cr.first == cr.second);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default table has capacity 0, is empty, and allocates no
+        //:   memory; a table created with a capacity rounds it up to a power
+        //:   of two that is at least the group size.
+        //:
+        //: 2 'tryEmplace' and 'insert' insert an entry if and only if its key
+        //:   is absent, and return an iterator to the entry having the key.
+        //:
+        //: 3 'find', 'contains', and 'count' locate every inserted key, and
+        //:   no other key, including when keys share probe sequences.
+        //:
+        //: 4 The functors and the allocator are those supplied, and the
+        //:   default allocator is used when none is supplied.
+        //:
+        //: 5 The destructor releases all memory.
+        //
+        // Plan:
+        //: 1 Create tables with various capacities and verify their initial
+        //:   state.  (C-1,4)
+        //:
+        //: 2 Insert a sequence of keys into tables using each hash functor,
+        //:   by each insertion method, and verify the return values and the
+        //:   lookups after each insertion.  (C-2,3)
+        //:
+        //: 3 Use test allocators to verify the memory use.  (C-4,5)
+        //
+        // Testing:
+        //   FlatHashTable(size_t, const HASH&, const EQUAL&, Allocator *);
+        //   ~FlatHashTable();
+        //   iterator find(const KEY&);
+        //   pair<iterator, bool> insert(const ENTRY&);
+        //   pair<iterator, bool> insert(MovableRef<ENTRY>);
+        //   pair<iterator, bool> tryEmplace(const KEY&);
+        //   pair<iterator, bool> tryEmplace(MovableRef<KEY>);
+        //   size_t capacity() const;
+        //   bool contains(const KEY&) const;
+        //   size_t count(const KEY&) const;
+        //   bool empty() const;
+        //   const_iterator find(const KEY&) const;
+        //   HASH hash_function() const;
+        //   EQUAL key_eq() const;
+        //   size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                      << "PRIMARY MANIPULATORS AND BASIC ACCESSORS" << endl
+                      << "========================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tInitial state." << endl;
+        {
+            const struct {
+                int         d_line;
+                bsl::size_t d_capacity;
+                bsl::size_t d_expCapacity;
+            } DATA[] = {
+                { L_,    0,    0 },
+                { L_,    1,   16 },
+                { L_,   15,   16 },
+                { L_,   16,   16 },
+                { L_,   17,   32 },
+                { L_,   64,   64 },
+                { L_,  100,  128 },
+                { L_, 1024, 1024 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE     = DATA[ti].d_line;
+                const bsl::size_t CAPACITY = DATA[ti].d_capacity;
+                const bsl::size_t EXP      = DATA[ti].d_expCapacity;
+
+                {
+                    const PoorObj X(CAPACITY, PoorHash(5),
+                                    bsl::equal_to<int>(), &oa);
+
+                    ASSERTV(LINE, EXP == X.capacity());
+                    ASSERTV(LINE, 0 == X.size());
+                    ASSERTV(LINE, X.empty());
+                    ASSERTV(LINE, &oa == X.allocator());
+                    ASSERTV(LINE, 5 == X.hash_function().d_groupBits);
+                    ASSERTV(LINE, (0 == EXP) == (0 == oa.numBlocksInUse()));
+                    ASSERTV(LINE, !X.contains(0));
+                    ASSERTV(LINE, X.end() == X.find(0));
+                }
+                ASSERTV(LINE, 0 == oa.numBlocksInUse());
+
+                {
+                    const Obj X(CAPACITY, bslh::Hash<>(),
+                                bsl::equal_to<int>());
+
+                    ASSERTV(LINE, &defaultAllocator == X.allocator());
+                    ASSERTV(LINE, EXP == X.capacity());
+                    ASSERTV(LINE, true == X.key_eq()(1, 1));
+                }
+                ASSERTV(LINE, 0 == defaultAllocator.numBlocksInUse());
+            }
+        }
+
+        if (verbose) cout << "\tInsertion and lookup." << endl;
+
+        for (int method = 0; method < 4; ++method) {
+            for (int groupBits = 0; groupBits < 4; ++groupBits) {
+                PoorObj mX(0, PoorHash(groupBits), bsl::equal_to<int>(), &oa);
+                const PoorObj& X = mX;
+
+                for (int i = 0; i < 300; ++i) {
+                    const int KEY = i * 7 % 300;
+
+                    for (int j = 0; j < 2; ++j) {
+                        int                                  key = KEY;
+                        bsl::pair<PoorObj::iterator, bool> rv;
+
+                        switch (method) {
+                          case 0: {
+                            rv = mX.tryEmplace(key);
+                          } break;
+                          case 1: {
+                            rv = mX.tryEmplace(
+                                          bslmf::MovableRefUtil::move(key));
+                          } break;
+                          case 2: {
+                            rv = mX.insert(key);
+                          } break;
+                          default: {
+                            rv = mX.insert(bslmf::MovableRefUtil::move(key));
+                          }
+                        }
+
+                        ASSERTV(method, groupBits, i, j,
+                                (0 == j) == rv.second);
+                        ASSERTV(method, groupBits, i, j, KEY == *rv.first);
+                        ASSERTV(method, groupBits, i, j,
+                                rv.first == mX.find(KEY));
+                    }
+                    ASSERTV(method, groupBits, i,
+                            static_cast<bsl::size_t>(i + 1) == X.size());
+
+                    if (veryVerbose || 0 == i % 37) {
+                        for (int k = 0; k < 300; ++k) {
+                            bool inserted = false;
+                            for (int m = 0; m <= i; ++m) {
+                                if (m * 7 % 300 == k) {
+                                    inserted = true;
+                                }
+                            }
+                            ASSERTV(method, groupBits, i, k,
+                                    inserted == X.contains(k));
+                            ASSERTV(method, groupBits, i, k,
+                                    (inserted ? 1u : 0u) == X.count(k));
+                            ASSERTV(method, groupBits, i, k,
+                                    inserted == (X.find(k) != X.end()));
+                        }
+                    }
+                }
+                ASSERTV(method, groupBits, isValid(X));
+            }
+        }
+
+        if (verbose) cout << "\tAllocating entries." << endl;
+        {
+            StringObj mX(0, bslh::Hash<>(), bsl::equal_to<bsl::string>(), &oa);
+            const StringObj& X = mX;
+
+            for (int i = 0; i < 100; ++i) {
+                const bsl::string KEY = makeString(i);
+
+                ASSERTV(i, mX.tryEmplace(KEY).second);
+                ASSERTV(i, KEY == *X.find(KEY));
+            }
+            ASSERT(100 == X.size());
+            ASSERT(0   == defaultAllocator.numBlocksInUse());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a table, insert, find, and erase a few keys, and copy the
+        //:   table.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX(0, bslh::Hash<>(), bsl::equal_to<int>(), &oa);
+            const Obj& X = mX;
+
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == X.size());
+            ASSERT(0 == oa.numBlocksTotal());
+
+            ASSERT(true  == mX.tryEmplace(1).second);
+            ASSERT(true  == mX.tryEmplace(2).second);
+            ASSERT(false == mX.tryEmplace(1).second);
+            ASSERT(2     == X.size());
+            ASSERT(16    == X.capacity());
+            ASSERT(1     == oa.numBlocksInUse());
+
+            ASSERT(X.contains(1));
+            ASSERT(X.contains(2));
+            ASSERT(!X.contains(3));
+
+            for (int i = 3; i < 100; ++i) {
+                mX.tryEmplace(i);
+            }
+            ASSERT(99  == X.size());
+            ASSERT(128 == X.capacity());
+
+            ASSERT(1 == mX.erase(50));
+            ASSERT(0 == mX.erase(50));
+            ASSERT(98 == X.size());
+
+            const Obj Y(X, &oa);
+            ASSERT(Y == X);
+
+            mX.tryEmplace(50);
+            ASSERT(Y != X);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
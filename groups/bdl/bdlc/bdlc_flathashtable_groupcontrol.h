@@ -0,0 +1,217 @@
+// bdlc_flathashtable_groupcontrol.h                                  -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHTABLE_GROUPCONTROL
+#define INCLUDED_BDLC_FLATHASHTABLE_GROUPCONTROL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide inquiries to a flat hash table group of control values.
+//
+//@CLASSES:
+//  bdlc::FlatHashTable_GroupControl: flat hash table group control inquiries
+//
+//@SEE_ALSO: bdlc_flathashtable
+//
+//@DESCRIPTION: This component implements the class,
+// 'bdlc::FlatHashTable_GroupControl', which provides a mechanism to perform
+// inquiries on a group of 'k_SIZE' contiguous control bytes of a flat hash
+// table (see 'bdlc_flathashtable').  Each control byte describes one slot of
+// the table: a slot is either empty ('k_EMPTY'), erased ('k_ERASED'), or in
+// use, in which case the control byte holds the 7 low-order bits of the hash
+// value of the key of the entry in the slot.  The inquiries return a bit mask
+// in which bit 'i' is set if the 'i'th control byte of the group satisfies the
+// inquiry, so that a whole group of slots is inspected at once.
+//
+// On platforms supporting SSE2 instructions, a group is loaded into a single
+// 128-bit register and each inquiry is a handful of instructions.  On other
+// platforms, the inquiries are implemented with portable loops.
+//
+// This class is an implementation detail of 'bdlc_flathashtable' and must not
+// be used directly.
+//
+///Usage
+///-----
+// There is no usage example for this component since it is not meant for
+// direct client use.
+
+#include <bdlscm_version.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+#include <emmintrin.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                     // ================================
+                     // class FlatHashTable_GroupControl
+                     // ================================
+
+class FlatHashTable_GroupControl {
+    // This class provides inquiries to a group of 'k_SIZE' contiguous control
+    // bytes of a flat hash table.
+
+  public:
+    // TYPES
+    typedef bsl::uint32_t BitMask;  // bit 'i' refers to control byte 'i'
+
+    // PUBLIC CONSTANTS
+    static const bsl::uint8_t k_EMPTY  = 0x80;
+    static const bsl::uint8_t k_ERASED = 0xC0;
+
+    static const bsl::size_t  k_SIZE   = 16;  // number of bytes in a group
+
+  private:
+    // DATA
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    __m128i      d_value;          // the loaded control bytes
+#else
+    bsl::uint8_t d_value[k_SIZE];  // a copy of the control bytes
+#endif
+
+    // NOT IMPLEMENTED
+    FlatHashTable_GroupControl();
+    FlatHashTable_GroupControl(const FlatHashTable_GroupControl&);
+    FlatHashTable_GroupControl& operator=(const FlatHashTable_GroupControl&);
+
+  public:
+    // CREATORS
+    explicit FlatHashTable_GroupControl(const bsl::uint8_t *data);
+        // Create a group control object for the 'k_SIZE' control bytes
+        // starting at the specified 'data'.  The behavior is undefined unless
+        // 'data' refers to at least 'k_SIZE' readable bytes.  Note that 'data'
+        // need not be aligned.
+
+    //! ~FlatHashTable_GroupControl() = default;
+        // Destroy this object.
+
+    // ACCESSORS
+    BitMask available() const;
+        // Return a bit mask of the control bytes of this group that are either
+        // empty or erased (i.e., the slots available for insertion).
+
+    BitMask inUse() const;
+        // Return a bit mask of the control bytes of this group that are in
+        // use.
+
+    BitMask match(bsl::uint8_t value) const;
+        // Return a bit mask of the control bytes of this group that have the
+        // specified 'value'.  The behavior is undefined unless '0x80 > value'.
+
+    bool neverFull() const;
+        // Return 'true' if this group has at least one empty control byte,
+        // and 'false' otherwise.  Note that a group that has an empty control
+        // byte has never been full, so that a probe sequence for a key not
+        // found in such a group can end there.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                     // --------------------------------
+                     // class FlatHashTable_GroupControl
+                     // --------------------------------
+
+// CREATORS
+inline
+FlatHashTable_GroupControl::FlatHashTable_GroupControl(
+                                                      const bsl::uint8_t *data)
+{
+    BSLS_ASSERT_SAFE(data);
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    d_value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+#else
+    bsl::memcpy(d_value, data, k_SIZE);
+#endif
+}
+
+// ACCESSORS
+inline
+FlatHashTable_GroupControl::BitMask
+                                  FlatHashTable_GroupControl::available() const
+{
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    // Empty and erased control bytes, and only those, have the high-order bit
+    // set.
+
+    return static_cast<BitMask>(_mm_movemask_epi8(d_value));
+#else
+    BitMask rv = 0;
+    for (bsl::size_t i = 0; i < k_SIZE; ++i) {
+        rv |= static_cast<BitMask>(d_value[i] >> 7) << i;
+    }
+    return rv;
+#endif
+}
+
+inline
+FlatHashTable_GroupControl::BitMask FlatHashTable_GroupControl::inUse() const
+{
+    return available() ^ ((1u << k_SIZE) - 1);
+}
+
+inline
+FlatHashTable_GroupControl::BitMask
+                    FlatHashTable_GroupControl::match(bsl::uint8_t value) const
+{
+    BSLS_ASSERT_SAFE(0x80 > value);
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    return static_cast<BitMask>(_mm_movemask_epi8(
+                 _mm_cmpeq_epi8(d_value,
+                                _mm_set1_epi8(static_cast<char>(value)))));
+#else
+    BitMask rv = 0;
+    for (bsl::size_t i = 0; i < k_SIZE; ++i) {
+        rv |= static_cast<BitMask>(value == d_value[i]) << i;
+    }
+    return rv;
+#endif
+}
+
+inline
+bool FlatHashTable_GroupControl::neverFull() const
+{
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    return 0 != _mm_movemask_epi8(
+                    _mm_cmpeq_epi8(d_value,
+                                   _mm_set1_epi8(static_cast<char>(k_EMPTY))));
+#else
+    for (bsl::size_t i = 0; i < k_SIZE; ++i) {
+        if (k_EMPTY == d_value[i]) {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+#endif
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
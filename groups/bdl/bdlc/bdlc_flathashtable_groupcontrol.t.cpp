@@ -0,0 +1,459 @@
+// bdlc_flathashtable_groupcontrol.t.cpp                              -*-C++-*-
+#include <bdlc_flathashtable_groupcontrol.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides inquiries to a group of control bytes.
+// Each inquiry is verified against an oracle that examines the control bytes
+// one at a time, for a set of control byte patterns, including every pattern
+// having at most two control bytes in use, and a set of pseudo-random
+// patterns.  The group is loaded from unaligned addresses to verify that no
+// alignment is required.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatHashTable_GroupControl(const bsl::uint8_t *data);
+//
+// ACCESSORS
+// [ 2] BitMask available() const;
+// [ 2] BitMask inUse() const;
+// [ 3] BitMask match(bsl::uint8_t value) const;
+// [ 4] bool neverFull() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCERN: precondition violations are detected when enabled
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatHashTable_GroupControl Obj;
+typedef Obj::BitMask                     BitMask;
+
+const bsl::size_t  k_SIZE   = Obj::k_SIZE;
+const bsl::uint8_t k_EMPTY  = Obj::k_EMPTY;
+const bsl::uint8_t k_ERASED = Obj::k_ERASED;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static BitMask oracleMatch(const bsl::uint8_t *data, bsl::uint8_t value)
+    // Return the bit mask of the 'k_SIZE' control bytes at the specified
+    // 'data' having the specified 'value'.
+{
+    BitMask rv = 0;
+    for (bsl::size_t i = 0; i < k_SIZE; ++i) {
+        if (value == data[i]) {
+            rv |= 1u << i;
+        }
+    }
+    return rv;
+}
+
+static BitMask oracleAvailable(const bsl::uint8_t *data)
+    // Return the bit mask of the 'k_SIZE' control bytes at the specified
+    // 'data' that are empty or erased.
+{
+    return oracleMatch(data, k_EMPTY) | oracleMatch(data, k_ERASED);
+}
+
+static void fillRandom(bsl::uint8_t *data, unsigned int *seed)
+    // Load into the 'k_SIZE' bytes at the specified 'data' a pseudo-random
+    // sequence of control bytes derived from the specified 'seed', and update
+    // 'seed'.  Each byte is empty, erased, or in use, with a value in use
+    // drawn from a small range so that values repeat within a group.
+{
+    for (bsl::size_t i = 0; i < k_SIZE; ++i) {
+        *seed = *seed * 1103515245u + 12345u;
+        const unsigned int r = (*seed >> 16) % 10;
+        data[i] = 0 == r ? k_EMPTY
+                : 1 == r ? k_ERASED
+                : static_cast<bsl::uint8_t>(r == 9 ? 0x7F : r);
+    }
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? atoi(argv[1]) : 0;
+    bool        verbose = argc > 2;
+    bool    veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // NEGATIVE TESTING
+        //
+        // Concerns:
+        //: 1 'match' asserts on a value having the high-order bit set.
+        //
+        // Plan:
+        //: 1 Verify defensive checks are triggered for invalid values.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: precondition violations are detected when enabled
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "NEGATIVE TESTING" << endl
+                          << "================" << endl;
+
+        bsls::AssertTestHandlerGuard hG;
+
+        bsl::uint8_t data[k_SIZE];
+        bsl::memset(data, k_EMPTY, k_SIZE);
+
+        const Obj X(data);
+
+        ASSERT_SAFE_PASS(X.match(0x00));
+        ASSERT_SAFE_PASS(X.match(0x7F));
+        ASSERT_SAFE_FAIL(X.match(0x80));
+        ASSERT_SAFE_FAIL(X.match(0xFF));
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'neverFull'
+        //
+        // Concerns:
+        //: 1 'neverFull' returns 'true' if and only if the group has an empty
+        //:   control byte, regardless of the position of the byte and of the
+        //:   other bytes.
+        //:
+        //: 2 Erased control bytes do not make a group "never full".
+        //
+        // Plan:
+        //: 1 For every position, verify 'neverFull' for a group of in-use and
+        //:   erased bytes with, and without, an empty byte at the position.
+        //:   (C-1,2)
+        //:
+        //: 2 Compare 'neverFull' with an oracle for pseudo-random groups.
+        //:   (C-1,2)
+        //
+        // Testing:
+        //   bool neverFull() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'neverFull'" << endl
+                          << "===========" << endl;
+
+        bsl::uint8_t data[k_SIZE];
+
+        for (bsl::size_t i = 0; i < k_SIZE; ++i) {
+            for (bsl::size_t j = 0; j < k_SIZE; ++j) {
+                data[j] = 0 == j % 3 ? k_ERASED : static_cast<bsl::uint8_t>(j);
+            }
+            {
+                const Obj X(data);
+                ASSERTV(i, false == X.neverFull());
+            }
+
+            data[i] = k_EMPTY;
+            {
+                const Obj X(data);
+                ASSERTV(i, true == X.neverFull());
+            }
+        }
+
+        unsigned int seed = 7;
+        for (int ti = 0; ti < 1000; ++ti) {
+            fillRandom(data, &seed);
+
+            const Obj X(data);
+            ASSERTV(ti, (0 != oracleMatch(data, k_EMPTY)) == X.neverFull());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'match'
+        //
+        // Concerns:
+        //: 1 'match' returns the bit mask of the control bytes having the
+        //:   specified value, for every value in use.
+        //:
+        //: 2 Empty and erased control bytes never match.
+        //
+        // Plan:
+        //: 1 For every value in use, verify 'match' against an oracle for a
+        //:   group holding each value in use once, and for pseudo-random
+        //:   groups.  (C-1,2)
+        //
+        // Testing:
+        //   BitMask match(bsl::uint8_t value) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'match'" << endl
+                          << "=======" << endl;
+
+        bsl::uint8_t data[k_SIZE];
+
+        for (int base = 0; base < 0x80; base += static_cast<int>(k_SIZE)) {
+            for (bsl::size_t i = 0; i < k_SIZE; ++i) {
+                data[i] = static_cast<bsl::uint8_t>(base + i);
+            }
+            const Obj X(data);
+
+            for (int v = 0; v < 0x80; ++v) {
+                const bsl::uint8_t VALUE = static_cast<bsl::uint8_t>(v);
+
+                const BitMask EXP = v >= base
+                                 && v <  base + static_cast<int>(k_SIZE)
+                                  ? 1u << (v - base)
+                                  : 0;
+
+                ASSERTV(base, v, EXP, X.match(VALUE), EXP == X.match(VALUE));
+            }
+        }
+
+        unsigned int seed = 3;
+        for (int ti = 0; ti < 1000; ++ti) {
+            fillRandom(data, &seed);
+
+            const Obj X(data);
+            for (int v = 0; v < 10; ++v) {
+                const bsl::uint8_t VALUE = static_cast<bsl::uint8_t>(v);
+                const BitMask      EXP   = oracleMatch(data, VALUE);
+
+                if (veryVerbose) { T_ P_(ti) P_(v) P(EXP) }
+
+                ASSERTV(ti, v, EXP, X.match(VALUE), EXP == X.match(VALUE));
+            }
+            ASSERTV(ti, oracleMatch(data, 0x7F) == X.match(0x7F));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTOR, 'available', AND 'inUse'
+        //
+        // Concerns:
+        //: 1 The constructor loads the control bytes from any address.
+        //:
+        //: 2 'available' returns the bit mask of the empty and erased control
+        //:   bytes.
+        //:
+        //: 3 'inUse' returns the complement of 'available', restricted to the
+        //:   'k_SIZE' low-order bits.
+        //
+        // Plan:
+        //: 1 For every group having at most two control bytes in use, with
+        //:   the other bytes alternating between empty and erased, and for
+        //:   pseudo-random groups, loaded at every offset from an aligned
+        //:   buffer, verify 'available' and 'inUse' against an oracle.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   FlatHashTable_GroupControl(const bsl::uint8_t *data);
+        //   BitMask available() const;
+        //   BitMask inUse() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONSTRUCTOR, 'available', AND 'inUse'" << endl
+                          << "=====================================" << endl;
+
+        const BitMask ALL = (1u << k_SIZE) - 1;
+
+        union {
+            bsl::uint8_t d_bytes[2 * k_SIZE];
+            double       d_align;
+        } buffer;
+
+        for (bsl::size_t offset = 0; offset < k_SIZE; ++offset) {
+            bsl::uint8_t *data = buffer.d_bytes + offset;
+
+            for (bsl::size_t i = 0; i <= k_SIZE; ++i) {
+                for (bsl::size_t j = i; j <= k_SIZE; ++j) {
+                    for (bsl::size_t k = 0; k < k_SIZE; ++k) {
+                        data[k] = k % 2 ? k_EMPTY : k_ERASED;
+                    }
+                    if (i < k_SIZE) {
+                        data[i] = static_cast<bsl::uint8_t>(i);
+                    }
+                    if (j < k_SIZE) {
+                        data[j] = 0x7F;
+                    }
+
+                    const Obj     X(data);
+                    const BitMask EXP = oracleAvailable(data);
+
+                    ASSERTV(offset, i, j, EXP, X.available(),
+                            EXP == X.available());
+                    ASSERTV(offset, i, j, (EXP ^ ALL) == X.inUse());
+                }
+            }
+
+            unsigned int seed = static_cast<unsigned int>(offset);
+            for (int ti = 0; ti < 100; ++ti) {
+                fillRandom(data, &seed);
+
+                const Obj     X(data);
+                const BitMask EXP = oracleAvailable(data);
+
+                ASSERTV(offset, ti, EXP, X.available(), EXP == X.available());
+                ASSERTV(offset, ti, (EXP ^ ALL) == X.inUse());
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform each inquiry on an empty group, a full group, and a group
+        //:   having an erased and a few in-use control bytes.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bsl::uint8_t data[k_SIZE];
+
+        bsl::memset(data, k_EMPTY, k_SIZE);
+        {
+            const Obj X(data);
+
+            ASSERT(0xFFFF == X.available());
+            ASSERT(0      == X.inUse());
+            ASSERT(0      == X.match(0));
+            ASSERT(true   == X.neverFull());
+        }
+
+        bsl::memset(data, 5, k_SIZE);
+        {
+            const Obj X(data);
+
+            ASSERT(0      == X.available());
+            ASSERT(0xFFFF == X.inUse());
+            ASSERT(0xFFFF == X.match(5));
+            ASSERT(0      == X.match(6));
+            ASSERT(false  == X.neverFull());
+        }
+
+        data[0] = k_ERASED;
+        data[3] = 6;
+        data[9] = 6;
+        {
+            const Obj X(data);
+
+            ASSERT(0x0001 == X.available());
+            ASSERT(0xFFFE == X.inUse());
+            ASSERT(0x0208 == X.match(6));
+            ASSERT(0xFDF6 == X.match(5));
+            ASSERT(false  == X.neverFull());
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
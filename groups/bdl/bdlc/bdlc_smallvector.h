@@ -0,0 +1,1791 @@
+// bdlc_smallvector.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLC_SMALLVECTOR
+#define INCLUDED_BDLC_SMALLVECTOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a vector that stores a few elements without allocating.
+//
+//@CLASSES:
+//  bdlc::SmallVector: vector having inline storage for a few elements
+//
+//@SEE_ALSO: bslstl_vector, bslalg_arrayprimitives
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::SmallVector', that implements a dynamically-sized contiguous array
+// of elements of the (template parameter) type 'TYPE', having an interface
+// modeled on that of 'bsl::vector'.  A 'bdlc::SmallVector' holds, within the
+// object itself, storage for up to (template parameter) 'INLINE_CAPACITY'
+// elements, and obtains memory from its allocator only when it must hold
+// more.  A vector that (almost) never grows beyond its inline capacity
+// therefore (almost) never allocates or deallocates, which makes
+// 'bdlc::SmallVector' well suited to the short, frequently-created sequences
+// that arise when processing individual messages.
+//
+// The elements are manipulated using 'bslalg::ArrayPrimitives', so that
+// growing, inserting into, and erasing from a vector of bitwise-moveable
+// elements reduce to 'memcpy' and 'memmove' calls, exactly as for
+// 'bsl::vector'.
+//
+///Inline Storage
+///--------------
+// A 'bdlc::SmallVector' uses its inline storage whenever its capacity is
+// 'INLINE_CAPACITY', and heap storage otherwise.  The capacity grows
+// geometrically once the inline storage is exhausted, and never shrinks
+// except through 'shrink_to_fit', which returns the elements to the inline
+// storage if they fit there.  Note that 'sizeof(bdlc::SmallVector)' includes
+// the inline storage, so a large 'INLINE_CAPACITY' (or a large 'TYPE')
+// produces large objects.
+//
+// Because the elements of a vector using inline storage live within the
+// vector object, a 'bdlc::SmallVector' is not bitwise moveable, and moving
+// or swapping such a vector moves its elements individually (rather than
+// exchanging pointers), invalidating all iterators, pointers, and references
+// to them.  When neither vector involved uses inline storage, moves and swaps
+// take constant time and preserve the validity of iterators, as for
+// 'bsl::vector'.
+//
+///Requirements on 'TYPE'
+///----------------------
+// The (template parameter) type 'TYPE' must be move constructible, and, if it
+// is allocator-aware, must use 'bslma' allocators.  Methods that copy
+// elements require 'TYPE' to be copy constructible, and the comparison
+// operators require the corresponding operators of 'TYPE'.
+//
+///Exception Safety
+///----------------
+// A 'bdlc::SmallVector' is exception neutral, and all of its methods provide
+// the basic exception safety guarantee (see
+// {'bsldoc_glossary'|Basic Guarantee}).
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Collecting the Tags of a Message
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose we process a stream of messages consisting of '|'-terminated
+// 'tag=value' fields, and for each message we need the sequence of its
+// integer tags.  Almost all messages have fewer than 8 fields, so we collect
+// the tags into a 'bdlc::SmallVector' having an inline capacity of 8.
+//
+// First, we define a function that loads the tags of a message:
+//..
+//  void loadTags(bdlc::SmallVector<int, 8> *tags, const char *message)
+//      // Load into the specified 'tags' the tag of each field of the
+//      // specified 'message'.  The behavior is undefined unless 'message'
+//      // consists of zero or more '|'-terminated 'tag=value' fields.
+//  {
+//      tags->clear();
+//      while (*message) {
+//          tags->push_back(bsl::atoi(message));
+//          message = bsl::strchr(message, '|') + 1;
+//      }
+//  }
+//..
+// Then, we load the tags of a typical message, and observe that no memory is
+// allocated:
+//..
+//  bslma::TestAllocator      oa("object");
+//  bdlc::SmallVector<int, 8> tags(&oa);
+//
+//  loadTags(&tags, "8=FIX.4.2|35=D|49=SENDER|56=TARGET|");
+//
+//  assert(4  == tags.size());
+//  assert(35 == tags[1]);
+//  assert(true == tags.usesInlineStorage());
+//  assert(0  == oa.numBlocksTotal());
+//..
+// Next, we load the tags of an unusually long message, which no longer fit
+// in the inline storage:
+//..
+//  loadTags(&tags, "8=FIX.4.2|35=D|49=S|56=T|34=7|52=0|11=X|21=1|55=Y|54=1|");
+//
+//  assert(10 == tags.size());
+//  assert(54 == tags.back());
+//  assert(false == tags.usesInlineStorage());
+//  assert(1  == oa.numBlocksInUse());
+//..
+// Finally, we return to a typical message; the vector keeps its larger
+// capacity until we ask it to shrink, at which point the elements move back
+// into the inline storage:
+//..
+//  loadTags(&tags, "8=FIX.4.2|35=0|");
+//  assert(2  == tags.size());
+//  assert(1  == oa.numBlocksInUse());
+//
+//  tags.shrink_to_fit();
+//  assert(true == tags.usesInlineStorage());
+//  assert(0  == oa.numBlocksInUse());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslalg_arraydestructionprimitives.h>
+#include <bslalg_arrayprimitives.h>
+#include <bslalg_rangecompare.h>
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bslh_hash.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_stdallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_integralconstant.h>
+#include <bslmf_isintegral.h>
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_alignmentfromtype.h>
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_performancehint.h>
+
+#include <bslstl_stdexceptutil.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_iterator.h>
+#include <bsl_utility.h>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+#include <bsl_initializer_list.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                            // =================
+                            // class SmallVector
+                            // =================
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+class SmallVector {
+    // This class template implements a value-semantic, allocator-aware
+    // container holding a contiguous sequence of elements of the (template
+    // parameter) type 'TYPE', which stores up to (template parameter)
+    // 'INLINE_CAPACITY' elements within the object, and allocates storage for
+    // more only when needed.
+
+    BSLMF_ASSERT(0 < INLINE_CAPACITY);
+
+    // PRIVATE TYPES
+    typedef bslalg::ArrayPrimitives   ArrayPrimitives;
+    typedef bslmf::MovableRefUtil     MoveUtil;
+
+    typedef bsls::AlignedBuffer<
+                          static_cast<int>(sizeof(TYPE) * INLINE_CAPACITY),
+                          bsls::AlignmentFromType<TYPE>::VALUE> InlineBuffer;
+        // This is the type of the inline storage.
+
+    // DATA
+    TYPE             *d_begin_p;      // first element (in 'd_inlineBuffer'
+                                      // or allocated)
+
+    TYPE             *d_end_p;        // one past the last element
+
+    bsl::size_t       d_capacity;     // number of elements that fit in the
+                                      // storage at 'd_begin_p'
+
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+    InlineBuffer      d_inlineBuffer; // storage used while 'd_capacity' is
+                                      // 'INLINE_CAPACITY'
+
+    // PRIVATE CLASS METHODS
+    static void throwLengthError();
+        // Throw a 'bsl::length_error' reporting that a 'SmallVector' would
+        // exceed its maximum size.
+
+    // PRIVATE MANIPULATORS
+    TYPE *allocateStorage(bsl::size_t capacity);
+        // Return storage for the specified 'capacity' elements obtained from
+        // the allocator of this object.  The behavior is undefined unless
+        // 'INLINE_CAPACITY < capacity <= max_size()'.
+
+    void adoptStorage(TYPE        *storage,
+                      bsl::size_t  numElements,
+                      bsl::size_t  capacity);
+        // Release the heap storage (if any) of this object, which must hold no
+        // elements, and make this object use the specified 'storage', holding
+        // the specified 'numElements' elements and having room for the
+        // specified 'capacity' elements.
+
+    TYPE *inlineStorage();
+        // Return the address of the inline storage of this object.
+
+    void moveFrom(SmallVector *original);
+        // Move the elements of the specified 'original' object to this object,
+        // leaving 'original' empty, and without allocating memory.  If
+        // 'original' uses heap storage, this object adopts that storage, and
+        // 'original' reverts to its inline storage.  The behavior is undefined
+        // unless this object is empty, uses its inline storage, and has the
+        // same allocator as 'original'.
+
+    template <class INTEGRAL_TYPE>
+    TYPE *privateInsertDispatch(const TYPE           *position,
+                                INTEGRAL_TYPE         numElements,
+                                INTEGRAL_TYPE         value,
+                                const bsl::true_type&);
+    template <class INPUT_ITERATOR>
+    TYPE *privateInsertDispatch(const TYPE            *position,
+                                INPUT_ITERATOR         first,
+                                INPUT_ITERATOR         last,
+                                const bsl::false_type&);
+        // Insert into this vector, at the specified 'position', either the
+        // specified 'numElements' copies of 'TYPE(value)' (for an integral
+        // type 'INTEGRAL_TYPE'), or the elements in the range starting at the
+        // specified 'first' and ending immediately before the specified
+        // 'last'.  Return a pointer to the first inserted element (or
+        // 'position' if none were inserted).
+
+    template <class INPUT_ITERATOR>
+    TYPE *privateInsert(const TYPE                     *position,
+                        INPUT_ITERATOR                  first,
+                        INPUT_ITERATOR                  last,
+                        const bsl::input_iterator_tag&);
+    template <class FORWARD_ITERATOR>
+    TYPE *privateInsert(const TYPE                       *position,
+                        FORWARD_ITERATOR                  first,
+                        FORWARD_ITERATOR                  last,
+                        const bsl::forward_iterator_tag&);
+        // Insert into this vector, at the specified 'position', the elements
+        // in the range starting at the specified 'first' and ending
+        // immediately before the specified 'last', and return a pointer to
+        // the first inserted element (or 'position' if none were inserted).
+        // Input iterators are appended one at a time and then rotated into
+        // place; forward iterators are measured first, so that the vector
+        // grows at most once.
+
+    void reallocate(bsl::size_t capacity);
+        // Move the elements of this vector to new storage having room for the
+        // specified 'capacity' elements, using the inline storage if
+        // 'capacity <= INLINE_CAPACITY'.  The behavior is undefined unless
+        // 'size() <= capacity <= max_size()'.
+
+    // PRIVATE ACCESSORS
+    bsl::size_t computeNewCapacity(bsl::size_t newSize) const;
+        // Return the capacity to which this vector grows to hold the specified
+        // 'newSize' elements: the larger of 'newSize' and twice the current
+        // capacity, limited to 'max_size()'.  The behavior is undefined
+        // unless 'capacity() < newSize <= max_size()'.
+
+    const TYPE *inlineStorage() const;
+        // Return the address of the inline storage of this object.
+
+  public:
+    // TYPES
+    typedef TYPE                                  value_type;
+    typedef TYPE&                                 reference;
+    typedef const TYPE&                           const_reference;
+    typedef TYPE                                 *pointer;
+    typedef const TYPE                           *const_pointer;
+    typedef TYPE                                 *iterator;
+    typedef const TYPE                           *const_iterator;
+    typedef bsl::reverse_iterator<iterator>       reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef bsl::size_t                           size_type;
+    typedef bsl::ptrdiff_t                        difference_type;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(SmallVector, bslma::UsesBslmaAllocator);
+    BSLMF_NESTED_TRAIT_DECLARATION(SmallVector, bslalg::HasStlIterators);
+
+    // CREATORS
+    explicit SmallVector(bslma::Allocator *basicAllocator = 0);
+        // Create an empty 'SmallVector' object.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  Note that no
+        // memory is allocated.
+
+    explicit SmallVector(size_type         numElements,
+                         bslma::Allocator *basicAllocator = 0);
+        // Create a 'SmallVector' object holding the specified 'numElements'
+        // value-initialized elements.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.  Throw 'bsl::length_error' if
+        // 'numElements > max_size()'.
+
+    SmallVector(size_type         numElements,
+                const TYPE&       value,
+                bslma::Allocator *basicAllocator = 0);
+        // Create a 'SmallVector' object holding the specified 'numElements'
+        // copies of the specified 'value'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  Throw
+        // 'bsl::length_error' if 'numElements > max_size()'.
+
+    template <class INPUT_ITERATOR>
+    SmallVector(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bslma::Allocator *basicAllocator = 0);
+        // Create a 'SmallVector' object holding the elements in the range
+        // starting at the specified 'first' and ending immediately before the
+        // specified 'last' iterator.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.  The behavior is undefined
+        // unless '[first .. last)' is a valid range.  Note that if
+        // 'INPUT_ITERATOR' is an integral type, this constructor has the
+        // effect of 'SmallVector(first, TYPE(last), basicAllocator)'.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    SmallVector(std::initializer_list<TYPE>  values,
+                bslma::Allocator            *basicAllocator = 0);
+        // Create a 'SmallVector' object holding the specified 'values'.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+#endif
+
+    SmallVector(const SmallVector&  original,
+                bslma::Allocator   *basicAllocator = 0);
+        // Create a 'SmallVector' object having the same value as the specified
+        // 'original' object.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    SmallVector(bslmf::MovableRef<SmallVector> original);
+        // Create a 'SmallVector' object having the same value and allocator as
+        // the specified 'original' object, and leave 'original' empty.  If
+        // 'original' uses heap storage, this object adopts that storage (in
+        // constant time); otherwise, the elements of 'original' are moved
+        // individually.  No memory is allocated.
+
+    SmallVector(bslmf::MovableRef<SmallVector>  original,
+                bslma::Allocator               *basicAllocator);
+        // Create a 'SmallVector' object having the same value as the specified
+        // 'original' object, using the specified 'basicAllocator' to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  If 'basicAllocator' is the allocator of
+        // 'original', this constructor has the effect of the move constructor
+        // above; otherwise, the elements of 'original' are move-inserted into
+        // this object, and 'original' is left in a valid but unspecified
+        // state.
+
+    ~SmallVector();
+        // Destroy this object and each of its elements.
+
+    // MANIPULATORS
+    SmallVector& operator=(const SmallVector& rhs);
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.
+
+    SmallVector& operator=(bslmf::MovableRef<SmallVector> rhs);
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.  If
+        // 'rhs' has the same allocator as this object, the elements (or heap
+        // storage) of 'rhs' are moved to this object without allocating, and
+        // 'rhs' is left empty; otherwise, the elements of 'rhs' are
+        // move-inserted into this object, and 'rhs' is left in a valid but
+        // unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    SmallVector& operator=(std::initializer_list<TYPE> values);
+        // Assign to this object the specified 'values', and return a
+        // reference providing modifiable access to this object.
+#endif
+
+    reference operator[](size_type position);
+        // Return a reference providing modifiable access to the element at
+        // the specified 'position' in this vector.  The behavior is undefined
+        // unless 'position < size()'.
+
+    template <class INPUT_ITERATOR>
+    void assign(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Assign to this object the elements in the range starting at the
+        // specified 'first' and ending immediately before the specified 'last'
+        // iterator.  The behavior is undefined unless '[first .. last)' is a
+        // valid range that does not refer to elements of this vector.
+
+    void assign(size_type numElements, const TYPE& value);
+        // Assign to this object the specified 'numElements' copies of the
+        // specified 'value'.  Throw 'bsl::length_error' if
+        // 'numElements > max_size()'.  Note that 'value' may refer to an
+        // element of this vector.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void assign(std::initializer_list<TYPE> values);
+        // Assign to this object the specified 'values'.
+#endif
+
+    reference at(size_type position);
+        // Return a reference providing modifiable access to the element at
+        // the specified 'position' in this vector.  Throw 'bsl::out_of_range'
+        // if 'position >= size()'.
+
+    reference back();
+        // Return a reference providing modifiable access to the last element
+        // of this vector.  The behavior is undefined unless this vector is not
+        // empty.
+
+    iterator begin();
+        // Return an iterator referring to the first element of this vector,
+        // or 'end()' if this vector is empty.
+
+    void clear();
+        // Remove all elements from this vector.  Note that the capacity (and
+        // any heap storage) is retained.
+
+    pointer data();
+        // Return the address of the first element of this vector.
+
+    iterator end();
+        // Return the past-the-end iterator of this vector.
+
+    iterator erase(const_iterator position);
+        // Remove from this vector the element at the specified 'position', and
+        // return an iterator referring to the element following it (or
+        // 'end()').  The behavior is undefined unless 'position' refers to an
+        // element of this vector.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this vector the elements starting at the specified
+        // 'first' position up to, but not including, the specified 'last'
+        // position, and return an iterator referring to the element that
+        // followed them (or 'end()').  The behavior is undefined unless
+        // '[first .. last)' is a valid range of elements of this vector.
+
+    reference front();
+        // Return a reference providing modifiable access to the first element
+        // of this vector.  The behavior is undefined unless this vector is not
+        // empty.
+
+    iterator insert(const_iterator position, const TYPE& value);
+    iterator insert(const_iterator position, bslmf::MovableRef<TYPE> value);
+        // Insert the specified 'value' into this vector at the specified
+        // 'position', and return an iterator referring to the inserted
+        // element.  If 'value' is moved, it is left in a valid but unspecified
+        // state.  Throw 'bsl::length_error' if 'size() == max_size()'.  The
+        // behavior is undefined unless 'position' is in the range
+        // '[begin() .. end()]'.  Note that 'value' may refer to an element of
+        // this vector.
+
+    iterator insert(const_iterator position,
+                    size_type      numElements,
+                    const TYPE&    value);
+        // Insert the specified 'numElements' copies of the specified 'value'
+        // into this vector at the specified 'position', and return an iterator
+        // referring to the first inserted element (or 'position' if
+        // 'numElements' is 0).  Throw 'bsl::length_error' if
+        // 'numElements > max_size() - size()'.  The behavior is undefined
+        // unless 'position' is in the range '[begin() .. end()]'.  Note that
+        // 'value' may refer to an element of this vector.
+
+    template <class INPUT_ITERATOR>
+    iterator insert(const_iterator position,
+                    INPUT_ITERATOR first,
+                    INPUT_ITERATOR last);
+        // Insert the elements in the range starting at the specified 'first'
+        // and ending immediately before the specified 'last' iterator into
+        // this vector at the specified 'position', and return an iterator
+        // referring to the first inserted element (or 'position' if the range
+        // is empty).  Throw 'bsl::length_error' if the resulting size would
+        // exceed 'max_size()'.  The behavior is undefined unless 'position' is
+        // in the range '[begin() .. end()]', and '[first .. last)' is a valid
+        // range that does not refer to elements of this vector.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    iterator insert(const_iterator              position,
+                    std::initializer_list<TYPE> values);
+        // Insert the specified 'values' into this vector at the specified
+        // 'position', and return an iterator referring to the first inserted
+        // element (or 'position' if 'values' is empty).
+#endif
+
+    void pop_back();
+        // Remove the last element of this vector.  The behavior is undefined
+        // if this vector is empty.
+
+    void push_back(const TYPE& value);
+    void push_back(bslmf::MovableRef<TYPE> value);
+        // Append the specified 'value' to this vector.  If 'value' is moved,
+        // it is left in a valid but unspecified state.  Throw
+        // 'bsl::length_error' if 'size() == max_size()'.  Note that 'value'
+        // may refer to an element of this vector.
+
+    reverse_iterator rbegin();
+        // Return a reverse iterator referring to the last element of this
+        // vector, or 'rend()' if this vector is empty.
+
+    reverse_iterator rend();
+        // Return the past-the-end reverse iterator of this vector.
+
+    void reserve(size_type numElements);
+        // Change the capacity of this vector to at least the specified
+        // 'numElements'.  Throw 'bsl::length_error' if
+        // 'numElements > max_size()'.  Note that if 'numElements' exceeds the
+        // current capacity, all iterators, pointers, and references to
+        // elements of this vector are invalidated.
+
+    void resize(size_type numElements);
+    void resize(size_type numElements, const TYPE& value);
+        // Change the size of this vector to the specified 'numElements',
+        // erasing elements from the end or appending value-initialized
+        // elements (or copies of the optionally specified 'value').  Throw
+        // 'bsl::length_error' if 'numElements > max_size()'.
+
+    void shrink_to_fit();
+        // Reduce the capacity of this vector to its size, or to
+        // 'INLINE_CAPACITY' (moving the elements into the inline storage and
+        // releasing the heap storage) if the size does not exceed
+        // 'INLINE_CAPACITY'.
+
+                             // Aspects
+
+    void swap(SmallVector& other);
+        // Exchange the value of this object with that of the specified 'other'
+        // object.  If neither object uses inline storage, this method takes
+        // constant time and provides the no-throw guarantee; otherwise, the
+        // elements held in inline storage are moved individually.  This
+        // method does not allocate memory.  The behavior is undefined unless
+        // this object has the same allocator as 'other'.
+
+    // ACCESSORS
+    const_reference operator[](size_type position) const;
+        // Return a reference providing non-modifiable access to the element at
+        // the specified 'position' in this vector.  The behavior is undefined
+        // unless 'position < size()'.
+
+    const_reference at(size_type position) const;
+        // Return a reference providing non-modifiable access to the element at
+        // the specified 'position' in this vector.  Throw 'bsl::out_of_range'
+        // if 'position >= size()'.
+
+    const_reference back() const;
+        // Return a reference providing non-modifiable access to the last
+        // element of this vector.  The behavior is undefined unless this
+        // vector is not empty.
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator referring to the first element of this vector,
+        // or 'end()' if this vector is empty.
+
+    size_type capacity() const;
+        // Return the number of elements this vector can hold without obtaining
+        // new storage.  Note that the capacity is never less than
+        // 'INLINE_CAPACITY'.
+
+    const_reverse_iterator crbegin() const;
+    const_reverse_iterator rbegin() const;
+        // Return a reverse iterator referring to the last element of this
+        // vector, or 'rend()' if this vector is empty.
+
+    const_iterator cend() const;
+    const_iterator end() const;
+        // Return the past-the-end iterator of this vector.
+
+    const_reverse_iterator crend() const;
+    const_reverse_iterator rend() const;
+        // Return the past-the-end reverse iterator of this vector.
+
+    const_pointer data() const;
+        // Return the address of the first element of this vector.
+
+    bool empty() const;
+        // Return 'true' if this vector has no elements, and 'false' otherwise.
+
+    const_reference front() const;
+        // Return a reference providing non-modifiable access to the first
+        // element of this vector.  The behavior is undefined unless this
+        // vector is not empty.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the number of elements this
+        // vector can hold.
+
+    size_type size() const;
+        // Return the number of elements in this vector.
+
+    bool usesInlineStorage() const;
+        // Return 'true' if the elements of this vector are stored within this
+        // object, and 'false' if they are stored in memory obtained from the
+        // allocator.  Note that this method returns 'true' exactly when
+        // 'capacity() == INLINE_CAPACITY'.
+
+                             // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this vector to supply memory.
+};
+
+// FREE OPERATORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+bool operator==(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+                const SmallVector<TYPE, INLINE_CAPACITY>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'SmallVector' objects have the same
+    // value if they have the same size and each element of one compares equal
+    // to the element at the same position in the other.
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+bool operator!=(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+                const SmallVector<TYPE, INLINE_CAPACITY>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'SmallVector' objects do not
+    // have the same value if they have different sizes or some element of one
+    // does not compare equal to the element at the same position in the
+    // other.
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+bool operator<(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+               const SmallVector<TYPE, INLINE_CAPACITY>& rhs);
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+bool operator>(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+               const SmallVector<TYPE, INLINE_CAPACITY>& rhs);
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+bool operator<=(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+                const SmallVector<TYPE, INLINE_CAPACITY>& rhs);
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+bool operator>=(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+                const SmallVector<TYPE, INLINE_CAPACITY>& rhs);
+    // Return the result of comparing the specified 'lhs' and 'rhs' objects
+    // lexicographically, using 'operator<' of 'TYPE' to compare elements.
+
+// FREE FUNCTIONS
+template <class HASHALG, class TYPE, bsl::size_t INLINE_CAPACITY>
+void hashAppend(HASHALG&                                  hashAlg,
+                const SmallVector<TYPE, INLINE_CAPACITY>& input);
+    // Pass the specified 'input' to the specified 'hashAlg'.  Note that the
+    // result equals that of hashing a 'bsl::vector' having the same elements.
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void swap(SmallVector<TYPE, INLINE_CAPACITY>& a,
+          SmallVector<TYPE, INLINE_CAPACITY>& b);
+    // Exchange the values of the specified 'a' and 'b' objects.  This function
+    // does not allocate memory if the two objects were created with the same
+    // allocator, and provides the basic guarantee otherwise.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                            // -----------------
+                            // class SmallVector
+                            // -----------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::throwLengthError()
+{
+    BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                                         "SmallVector<...>: vector too long");
+}
+
+// PRIVATE MANIPULATORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+TYPE *SmallVector<TYPE, INLINE_CAPACITY>::allocateStorage(bsl::size_t capacity)
+{
+    BSLS_ASSERT_SAFE(INLINE_CAPACITY < capacity);
+    BSLS_ASSERT_SAFE(capacity <= max_size());
+
+    return static_cast<TYPE *>(d_allocator_p->allocate(capacity
+                                                       * sizeof(TYPE)));
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::adoptStorage(TYPE        *storage,
+                                                      bsl::size_t  numElements,
+                                                      bsl::size_t  capacity)
+{
+    BSLS_ASSERT_SAFE(d_begin_p == d_end_p);
+
+    if (!usesInlineStorage()) {
+        d_allocator_p->deallocate(d_begin_p);
+    }
+    d_begin_p  = storage;
+    d_end_p    = storage + numElements;
+    d_capacity = capacity;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+TYPE *SmallVector<TYPE, INLINE_CAPACITY>::inlineStorage()
+{
+    return reinterpret_cast<TYPE *>(d_inlineBuffer.buffer());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::moveFrom(SmallVector *original)
+{
+    BSLS_ASSERT_SAFE(original);
+    BSLS_ASSERT_SAFE(empty());
+    BSLS_ASSERT_SAFE(usesInlineStorage());
+    BSLS_ASSERT_SAFE(d_allocator_p == original->d_allocator_p);
+
+    if (original->usesInlineStorage()) {
+        const bsl::size_t numElements = original->size();
+
+        ArrayPrimitives::destructiveMove(d_begin_p,
+                                         original->d_begin_p,
+                                         original->d_end_p,
+                                         d_allocator_p);
+        original->d_end_p = original->d_begin_p;
+        d_end_p           = d_begin_p + numElements;
+    }
+    else {
+        d_begin_p  = original->d_begin_p;
+        d_end_p    = original->d_end_p;
+        d_capacity = original->d_capacity;
+
+        original->d_begin_p  = original->inlineStorage();
+        original->d_end_p    = original->d_begin_p;
+        original->d_capacity = INLINE_CAPACITY;
+    }
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INTEGRAL_TYPE>
+inline
+TYPE *SmallVector<TYPE, INLINE_CAPACITY>::privateInsertDispatch(
+                                           const TYPE            *position,
+                                           INTEGRAL_TYPE          numElements,
+                                           INTEGRAL_TYPE          value,
+                                           const bsl::true_type&)
+{
+    return insert(position,
+                  static_cast<size_type>(numElements),
+                  static_cast<TYPE>(value));
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INPUT_ITERATOR>
+inline
+TYPE *SmallVector<TYPE, INLINE_CAPACITY>::privateInsertDispatch(
+                                          const TYPE             *position,
+                                          INPUT_ITERATOR          first,
+                                          INPUT_ITERATOR          last,
+                                          const bsl::false_type&)
+{
+    typedef typename bsl::iterator_traits<INPUT_ITERATOR>::iterator_category
+                                                                       Tag;
+
+    return privateInsert(position, first, last, Tag());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INPUT_ITERATOR>
+TYPE *SmallVector<TYPE, INLINE_CAPACITY>::privateInsert(
+                                      const TYPE                     *position,
+                                      INPUT_ITERATOR                  first,
+                                      INPUT_ITERATOR                  last,
+                                      const bsl::input_iterator_tag&)
+{
+    const bsl::size_t index   = position - d_begin_p;
+    const bsl::size_t oldSize = size();
+
+    for (; first != last; ++first) {
+        push_back(*first);
+    }
+
+    ArrayPrimitives::rotate(d_begin_p + index, d_begin_p + oldSize, d_end_p);
+
+    return d_begin_p + index;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class FORWARD_ITERATOR>
+TYPE *SmallVector<TYPE, INLINE_CAPACITY>::privateInsert(
+                                    const TYPE                       *position,
+                                    FORWARD_ITERATOR                  first,
+                                    FORWARD_ITERATOR                  last,
+                                    const bsl::forward_iterator_tag&)
+{
+    const bsl::size_t numElements = bsl::distance(first, last);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                       numElements > max_size() - size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        throwLengthError();
+    }
+
+    const bsl::size_t index   = position - d_begin_p;
+    const bsl::size_t newSize = size() + numElements;
+    TYPE             *pos     = d_begin_p + index;
+
+    if (newSize > d_capacity) {
+        const bsl::size_t newCapacity = computeNewCapacity(newSize);
+        TYPE             *storage     = allocateStorage(newCapacity);
+
+        bslma::DeallocatorProctor<bslma::Allocator> proctor(storage,
+                                                            d_allocator_p);
+
+        ArrayPrimitives::destructiveMoveAndInsert(storage,
+                                                  &d_end_p,
+                                                  d_begin_p,
+                                                  pos,
+                                                  d_end_p,
+                                                  first,
+                                                  last,
+                                                  numElements,
+                                                  d_allocator_p);
+        proctor.release();
+
+        d_end_p = d_begin_p;
+        adoptStorage(storage, newSize, newCapacity);
+    }
+    else {
+        ArrayPrimitives::insert(pos,
+                                d_end_p,
+                                first,
+                                last,
+                                numElements,
+                                d_allocator_p);
+        d_end_p += numElements;
+    }
+
+    return d_begin_p + index;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::reallocate(bsl::size_t capacity)
+{
+    BSLS_ASSERT_SAFE(size() <= capacity);
+    BSLS_ASSERT_SAFE(capacity <= max_size());
+
+    const bsl::size_t numElements = size();
+
+    if (capacity <= INLINE_CAPACITY) {
+        if (usesInlineStorage()) {
+            return;                                                   // RETURN
+        }
+
+        // Move the elements into the inline storage.  If a move throws, the
+        // elements already moved are destroyed and the original elements are
+        // left unchanged.
+
+        TYPE *storage = inlineStorage();
+        ArrayPrimitives::destructiveMove(storage,
+                                         d_begin_p,
+                                         d_end_p,
+                                         d_allocator_p);
+
+        d_end_p = d_begin_p;
+        adoptStorage(storage, numElements, INLINE_CAPACITY);
+        return;                                                       // RETURN
+    }
+
+    TYPE *storage = allocateStorage(capacity);
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(storage,
+                                                        d_allocator_p);
+
+    ArrayPrimitives::destructiveMove(storage,
+                                     d_begin_p,
+                                     d_end_p,
+                                     d_allocator_p);
+    proctor.release();
+
+    d_end_p = d_begin_p;
+    adoptStorage(storage, numElements, capacity);
+}
+
+// PRIVATE ACCESSORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bsl::size_t
+SmallVector<TYPE, INLINE_CAPACITY>::computeNewCapacity(bsl::size_t newSize)
+                                                                         const
+{
+    BSLS_ASSERT_SAFE(d_capacity < newSize);
+    BSLS_ASSERT_SAFE(newSize <= max_size());
+
+    const bsl::size_t maxSize = max_size();
+
+    if (d_capacity > maxSize / 2) {
+        return maxSize;                                               // RETURN
+    }
+    return newSize > d_capacity * 2 ? newSize : d_capacity * 2;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+const TYPE *SmallVector<TYPE, INLINE_CAPACITY>::inlineStorage() const
+{
+    return reinterpret_cast<const TYPE *>(d_inlineBuffer.buffer());
+}
+
+// CREATORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                              bslma::Allocator *basicAllocator)
+: d_begin_p(inlineStorage())
+, d_end_p(d_begin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                             size_type         numElements,
+                                             bslma::Allocator *basicAllocator)
+: d_begin_p(inlineStorage())
+, d_end_p(d_begin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    resize(numElements);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                             size_type         numElements,
+                                             const TYPE&       value,
+                                             bslma::Allocator *basicAllocator)
+: d_begin_p(inlineStorage())
+, d_end_p(d_begin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    insert(d_end_p, numElements, value);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INPUT_ITERATOR>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                             INPUT_ITERATOR    first,
+                                             INPUT_ITERATOR    last,
+                                             bslma::Allocator *basicAllocator)
+: d_begin_p(inlineStorage())
+, d_end_p(d_begin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    insert(d_end_p, first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                  std::initializer_list<TYPE>  values,
+                                  bslma::Allocator            *basicAllocator)
+: d_begin_p(inlineStorage())
+, d_end_p(d_begin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    insert(d_end_p, values.begin(), values.end());
+}
+#endif
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                           const SmallVector&  original,
+                                           bslma::Allocator   *basicAllocator)
+: d_begin_p(inlineStorage())
+, d_end_p(d_begin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    reserve(original.size());
+
+    ArrayPrimitives::copyConstruct(d_begin_p,
+                                   original.d_begin_p,
+                                   original.d_end_p,
+                                   d_allocator_p);
+    d_end_p = d_begin_p + original.size();
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                       bslmf::MovableRef<SmallVector> original)
+: d_begin_p(inlineStorage())
+, d_end_p(d_begin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(MoveUtil::access(original).d_allocator_p)
+{
+    moveFrom(&MoveUtil::access(original));
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                               bslmf::MovableRef<SmallVector>  original,
+                               bslma::Allocator               *basicAllocator)
+: d_begin_p(inlineStorage())
+, d_end_p(d_begin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    SmallVector& lvalue = original;
+
+    if (d_allocator_p == lvalue.d_allocator_p) {
+        moveFrom(&lvalue);
+    }
+    else {
+        reserve(lvalue.size());
+
+        ArrayPrimitives::moveConstruct(d_begin_p,
+                                       lvalue.d_begin_p,
+                                       lvalue.d_end_p,
+                                       d_allocator_p);
+        d_end_p = d_begin_p + lvalue.size();
+    }
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::~SmallVector()
+{
+    bslalg::ArrayDestructionPrimitives::destroy(d_begin_p, d_end_p);
+
+    if (!usesInlineStorage()) {
+        d_allocator_p->deallocate(d_begin_p);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>&
+SmallVector<TYPE, INLINE_CAPACITY>::operator=(const SmallVector& rhs)
+{
+    if (this != &rhs) {
+        assign(rhs.d_begin_p, rhs.d_end_p);
+    }
+    return *this;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>&
+SmallVector<TYPE, INLINE_CAPACITY>::operator=(
+                                            bslmf::MovableRef<SmallVector> rhs)
+{
+    SmallVector& lvalue = rhs;
+
+    if (this == &lvalue) {
+        return *this;                                                 // RETURN
+    }
+
+    clear();
+
+    if (d_allocator_p == lvalue.d_allocator_p) {
+        adoptStorage(inlineStorage(), 0, INLINE_CAPACITY);
+        moveFrom(&lvalue);
+    }
+    else {
+        reserve(lvalue.size());
+
+        ArrayPrimitives::moveConstruct(d_begin_p,
+                                       lvalue.d_begin_p,
+                                       lvalue.d_end_p,
+                                       d_allocator_p);
+        d_end_p = d_begin_p + lvalue.size();
+    }
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+SmallVector<TYPE, INLINE_CAPACITY>&
+SmallVector<TYPE, INLINE_CAPACITY>::operator=(
+                                            std::initializer_list<TYPE> values)
+{
+    assign(values.begin(), values.end());
+    return *this;
+}
+#endif
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::reference
+SmallVector<TYPE, INLINE_CAPACITY>::operator[](size_type position)
+{
+    BSLS_ASSERT_SAFE(position < size());
+
+    return d_begin_p[position];
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INPUT_ITERATOR>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::assign(INPUT_ITERATOR first,
+                                                INPUT_ITERATOR last)
+{
+    clear();
+    insert(d_end_p, first, last);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::assign(size_type   numElements,
+                                                const TYPE& value)
+{
+    // Overwrite the existing elements before erasing or appending, so that
+    // 'value' remains valid if it refers to an element of this vector.
+
+    if (numElements <= size()) {
+        std::fill_n(d_begin_p, numElements, value);
+        erase(d_begin_p + numElements, d_end_p);
+    }
+    else {
+        std::fill(d_begin_p, d_end_p, value);
+        insert(d_end_p, numElements - size(), value);
+    }
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::assign(
+                                            std::initializer_list<TYPE> values)
+{
+    assign(values.begin(), values.end());
+}
+#endif
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::reference
+SmallVector<TYPE, INLINE_CAPACITY>::at(size_type position)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(position >= size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                           "SmallVector<...>::at(position): invalid position");
+    }
+    return d_begin_p[position];
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::reference
+SmallVector<TYPE, INLINE_CAPACITY>::back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *(d_end_p - 1);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::begin()
+{
+    return d_begin_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::clear()
+{
+    bslalg::ArrayDestructionPrimitives::destroy(d_begin_p, d_end_p);
+    d_end_p = d_begin_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::pointer
+SmallVector<TYPE, INLINE_CAPACITY>::data()
+{
+    return d_begin_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::end()
+{
+    return d_end_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(d_begin_p <= position);
+    BSLS_ASSERT_SAFE(position  <  d_end_p);
+
+    return erase(position, position + 1);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::erase(const_iterator first,
+                                          const_iterator last)
+{
+    BSLS_ASSERT_SAFE(d_begin_p <= first);
+    BSLS_ASSERT_SAFE(first     <= last);
+    BSLS_ASSERT_SAFE(last      <= d_end_p);
+
+    TYPE *pos = d_begin_p + (first - d_begin_p);
+
+    ArrayPrimitives::erase(pos,
+                           pos + (last - first),
+                           d_end_p,
+                           d_allocator_p);
+    d_end_p -= last - first;
+
+    return pos;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::reference
+SmallVector<TYPE, INLINE_CAPACITY>::front()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *d_begin_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::insert(const_iterator position,
+                                           const TYPE&    value)
+{
+    return insert(position, size_type(1), value);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::insert(const_iterator          position,
+                                           bslmf::MovableRef<TYPE> value)
+{
+    BSLS_ASSERT_SAFE(d_begin_p <= position);
+    BSLS_ASSERT_SAFE(position  <= d_end_p);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(size() == max_size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        throwLengthError();
+    }
+
+    TYPE& lvalue = value;
+
+    const bsl::size_t index   = position - d_begin_p;
+    const bsl::size_t newSize = size() + 1;
+    TYPE             *pos     = d_begin_p + index;
+
+    if (newSize > d_capacity) {
+        const bsl::size_t newCapacity = computeNewCapacity(newSize);
+        TYPE             *storage     = allocateStorage(newCapacity);
+
+        bslma::DeallocatorProctor<bslma::Allocator> proctor(storage,
+                                                            d_allocator_p);
+
+        ArrayPrimitives::destructiveMoveAndEmplace(
+                                         storage,
+                                         &d_end_p,
+                                         d_begin_p,
+                                         pos,
+                                         d_end_p,
+                                         bsl::allocator<TYPE>(d_allocator_p),
+                                         MoveUtil::move(lvalue));
+        proctor.release();
+
+        d_end_p = d_begin_p;
+        adoptStorage(storage, newSize, newCapacity);
+    }
+    else {
+        ArrayPrimitives::insert(pos,
+                                d_end_p,
+                                MoveUtil::move(lvalue),
+                                d_allocator_p);
+        ++d_end_p;
+    }
+
+    return d_begin_p + index;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::insert(const_iterator position,
+                                           size_type      numElements,
+                                           const TYPE&    value)
+{
+    BSLS_ASSERT_SAFE(d_begin_p <= position);
+    BSLS_ASSERT_SAFE(position  <= d_end_p);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                       numElements > max_size() - size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        throwLengthError();
+    }
+
+    const bsl::size_t index   = position - d_begin_p;
+    const bsl::size_t newSize = size() + numElements;
+    TYPE             *pos     = d_begin_p + index;
+
+    if (newSize > d_capacity) {
+        const bsl::size_t newCapacity = computeNewCapacity(newSize);
+        TYPE             *storage     = allocateStorage(newCapacity);
+
+        bslma::DeallocatorProctor<bslma::Allocator> proctor(storage,
+                                                            d_allocator_p);
+
+        ArrayPrimitives::destructiveMoveAndInsert(storage,
+                                                  &d_end_p,
+                                                  d_begin_p,
+                                                  pos,
+                                                  d_end_p,
+                                                  value,
+                                                  numElements,
+                                                  d_allocator_p);
+        proctor.release();
+
+        d_end_p = d_begin_p;
+        adoptStorage(storage, newSize, newCapacity);
+    }
+    else {
+        ArrayPrimitives::insert(pos,
+                                d_end_p,
+                                value,
+                                numElements,
+                                d_allocator_p);
+        d_end_p += numElements;
+    }
+
+    return d_begin_p + index;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INPUT_ITERATOR>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::insert(const_iterator position,
+                                           INPUT_ITERATOR first,
+                                           INPUT_ITERATOR last)
+{
+    BSLS_ASSERT_SAFE(d_begin_p <= position);
+    BSLS_ASSERT_SAFE(position  <= d_end_p);
+
+    typedef typename bsl::is_integral<INPUT_ITERATOR>::type IsIntegral;
+
+    return privateInsertDispatch(position, first, last, IsIntegral());
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::insert(
+                                       const_iterator              position,
+                                       std::initializer_list<TYPE> values)
+{
+    return insert(position, values.begin(), values.end());
+}
+#endif
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::pop_back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    --d_end_p;
+    bslma::DestructionUtil::destroy(d_end_p);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::push_back(const TYPE& value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(size() < d_capacity)) {
+        bslma::ConstructionUtil::construct(d_end_p, d_allocator_p, value);
+        ++d_end_p;
+    }
+    else {
+        insert(d_end_p, size_type(1), value);
+    }
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::push_back(
+                                                 bslmf::MovableRef<TYPE> value)
+{
+    TYPE& lvalue = value;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(size() < d_capacity)) {
+        bslma::ConstructionUtil::construct(d_end_p,
+                                           d_allocator_p,
+                                           MoveUtil::move(lvalue));
+        ++d_end_p;
+    }
+    else {
+        insert(d_end_p, MoveUtil::move(lvalue));
+    }
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::reverse_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::rbegin()
+{
+    return reverse_iterator(d_end_p);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::reverse_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::rend()
+{
+    return reverse_iterator(d_begin_p);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::reserve(size_type numElements)
+{
+    if (numElements <= d_capacity) {
+        return;                                                       // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numElements > max_size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        throwLengthError();
+    }
+    reallocate(numElements);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::resize(size_type numElements)
+{
+    if (numElements <= size()) {
+        erase(d_begin_p + numElements, d_end_p);
+        return;                                                       // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numElements > max_size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        throwLengthError();
+    }
+
+    if (numElements > d_capacity) {
+        reallocate(computeNewCapacity(numElements));
+    }
+
+    ArrayPrimitives::defaultConstruct(d_end_p,
+                                      numElements - size(),
+                                      d_allocator_p);
+    d_end_p = d_begin_p + numElements;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::resize(size_type   numElements,
+                                                const TYPE& value)
+{
+    if (numElements <= size()) {
+        erase(d_begin_p + numElements, d_end_p);
+    }
+    else {
+        insert(d_end_p, numElements - size(), value);
+    }
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::shrink_to_fit()
+{
+    if (size() < d_capacity) {
+        reallocate(size());
+    }
+}
+
+                             // Aspects
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::swap(SmallVector& other)
+{
+    BSLS_ASSERT(d_allocator_p == other.d_allocator_p);
+
+    if (!usesInlineStorage() && !other.usesInlineStorage()) {
+        bsl::swap(d_begin_p,  other.d_begin_p);
+        bsl::swap(d_end_p,    other.d_end_p);
+        bsl::swap(d_capacity, other.d_capacity);
+        return;                                                       // RETURN
+    }
+
+    // At least one object holds its elements inline, so the elements must be
+    // moved.  With a common allocator, each of the moves below either adopts
+    // heap storage or moves elements into inline storage, so none allocates.
+
+    SmallVector temp(MoveUtil::move(*this));
+    *this = MoveUtil::move(other);
+    other = MoveUtil::move(temp);
+}
+
+// ACCESSORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_reference
+SmallVector<TYPE, INLINE_CAPACITY>::operator[](size_type position) const
+{
+    BSLS_ASSERT_SAFE(position < size());
+
+    return d_begin_p[position];
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_reference
+SmallVector<TYPE, INLINE_CAPACITY>::at(size_type position) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(position >= size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                     "SmallVector<...>::at(position) const: invalid position");
+    }
+    return d_begin_p[position];
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_reference
+SmallVector<TYPE, INLINE_CAPACITY>::back() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *(d_end_p - 1);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::begin() const
+{
+    return d_begin_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::cbegin() const
+{
+    return d_begin_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::size_type
+SmallVector<TYPE, INLINE_CAPACITY>::capacity() const
+{
+    return d_capacity;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_reverse_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::crbegin() const
+{
+    return const_reverse_iterator(d_end_p);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_reverse_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::rbegin() const
+{
+    return const_reverse_iterator(d_end_p);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::cend() const
+{
+    return d_end_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::end() const
+{
+    return d_end_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_reverse_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::crend() const
+{
+    return const_reverse_iterator(d_begin_p);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_reverse_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::rend() const
+{
+    return const_reverse_iterator(d_begin_p);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_pointer
+SmallVector<TYPE, INLINE_CAPACITY>::data() const
+{
+    return d_begin_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool SmallVector<TYPE, INLINE_CAPACITY>::empty() const
+{
+    return d_begin_p == d_end_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_reference
+SmallVector<TYPE, INLINE_CAPACITY>::front() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *d_begin_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::size_type
+SmallVector<TYPE, INLINE_CAPACITY>::max_size() const
+{
+    return ~size_type(0) / sizeof(TYPE);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::size_type
+SmallVector<TYPE, INLINE_CAPACITY>::size() const
+{
+    return d_end_p - d_begin_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool SmallVector<TYPE, INLINE_CAPACITY>::usesInlineStorage() const
+{
+    return d_begin_p == inlineStorage();
+}
+
+                             // Aspects
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bslma::Allocator *SmallVector<TYPE, INLINE_CAPACITY>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool bdlc::operator==(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+                      const SmallVector<TYPE, INLINE_CAPACITY>& rhs)
+{
+    return bslalg::RangeCompare::equal(lhs.begin(),
+                                       lhs.end(),
+                                       lhs.size(),
+                                       rhs.begin(),
+                                       rhs.end(),
+                                       rhs.size());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool bdlc::operator!=(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+                      const SmallVector<TYPE, INLINE_CAPACITY>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool bdlc::operator<(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+                     const SmallVector<TYPE, INLINE_CAPACITY>& rhs)
+{
+    return 0 > bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                     lhs.end(),
+                                                     lhs.size(),
+                                                     rhs.begin(),
+                                                     rhs.end(),
+                                                     rhs.size());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool bdlc::operator>(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+                     const SmallVector<TYPE, INLINE_CAPACITY>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool bdlc::operator<=(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+                      const SmallVector<TYPE, INLINE_CAPACITY>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool bdlc::operator>=(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+                      const SmallVector<TYPE, INLINE_CAPACITY>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class HASHALG, class TYPE, bsl::size_t INLINE_CAPACITY>
+void bdlc::hashAppend(HASHALG&                                  hashAlg,
+                      const SmallVector<TYPE, INLINE_CAPACITY>& input)
+{
+    using ::BloombergLP::bslh::hashAppend;
+
+    hashAppend(hashAlg, input.size());
+    bslh::hashAppendRange(hashAlg, input.begin(), input.end());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void bdlc::swap(SmallVector<TYPE, INLINE_CAPACITY>& a,
+                SmallVector<TYPE, INLINE_CAPACITY>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+
+        return;                                                       // RETURN
+    }
+
+    typedef SmallVector<TYPE, INLINE_CAPACITY> Vector;
+
+    Vector futureA(b, a.allocator());
+    Vector futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1551 @@
+// bdlc_smallvector.t.cpp                                             -*-C++-*-
+#include <bdlc_smallvector.h>
+
+#include <bslh_hash.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_iterator.h>
+#include <bsl_list.h>
+#include <bsl_sstream.h>
+#include <bsl_stdexcept.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bdlc::SmallVector' is a vector whose first 'INLINE_CAPACITY' elements live
+// within the object.  Our primary concern is that the container switches
+// correctly between its inline and heap storage in every method that changes
+// its size or capacity, allocating memory only when its size exceeds the
+// inline capacity, and never when moved or swapped with an object having the
+// same allocator.  The manipulation of the elements is delegated to
+// 'bslalg::ArrayPrimitives', so we verify the value produced by each method
+// against that of 'bsl::vector' (the oracle), for 'int' (bitwise-moveable)
+// and 'bsl::string' (allocator-aware) elements, and for several inline
+// capacities.
+//
+// Primary Manipulators:
+//: o 'push_back'
+//: o 'clear'
+//
+// Basic Accessors:
+//: o 'allocator'
+//: o 'capacity'
+//: o 'size'
+//: o 'usesInlineStorage'
+//: o 'operator[]'
+//
+// Global Concerns:
+//: o No memory is allocated from the global allocator.
+//: o No memory is allocated while the size does not exceed the inline
+//:   capacity.
+//: o Precondition violations are detected in appropriate build modes.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] SmallVector(bslma::Allocator *);
+// [ 3] SmallVector(size_type, bslma::Allocator *);
+// [ 3] SmallVector(size_type, const TYPE&, bslma::Allocator *);
+// [ 3] SmallVector(INPUT_ITERATOR, INPUT_ITERATOR, bslma::Allocator *);
+// [ 3] SmallVector(initializer_list<TYPE>, bslma::Allocator *);
+// [ 4] SmallVector(const SmallVector&, bslma::Allocator *);
+// [ 4] SmallVector(MovableRef<SmallVector>);
+// [ 4] SmallVector(MovableRef<SmallVector>, bslma::Allocator *);
+// [ 2] ~SmallVector();
+//
+// MANIPULATORS
+// [ 4] SmallVector& operator=(const SmallVector&);
+// [ 4] SmallVector& operator=(MovableRef<SmallVector>);
+// [ 5] SmallVector& operator=(initializer_list<TYPE>);
+// [ 7] reference operator[](size_type);
+// [ 5] void assign(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 5] void assign(size_type, const TYPE&);
+// [ 5] void assign(initializer_list<TYPE>);
+// [ 7] reference at(size_type);
+// [ 7] reference back();
+// [ 7] iterator begin();
+// [ 2] void clear();
+// [ 7] pointer data();
+// [ 7] iterator end();
+// [ 5] iterator erase(const_iterator);
+// [ 5] iterator erase(const_iterator, const_iterator);
+// [ 7] reference front();
+// [ 5] iterator insert(const_iterator, const TYPE&);
+// [ 5] iterator insert(const_iterator, MovableRef<TYPE>);
+// [ 5] iterator insert(const_iterator, size_type, const TYPE&);
+// [ 5] iterator insert(const_iterator, INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 5] iterator insert(const_iterator, initializer_list<TYPE>);
+// [ 5] void pop_back();
+// [ 2] void push_back(const TYPE&);
+// [ 2] void push_back(MovableRef<TYPE>);
+// [ 7] reverse_iterator rbegin();
+// [ 7] reverse_iterator rend();
+// [ 5] void reserve(size_type);
+// [ 5] void resize(size_type);
+// [ 5] void resize(size_type, const TYPE&);
+// [ 5] void shrink_to_fit();
+// [ 4] void swap(SmallVector&);
+//
+// ACCESSORS
+// [ 2] const_reference operator[](size_type) const;
+// [ 7] const_reference at(size_type) const;
+// [ 7] const_reference back() const;
+// [ 7] const_iterator begin() const;
+// [ 7] const_iterator cbegin() const;
+// [ 2] size_type capacity() const;
+// [ 7] const_reverse_iterator crbegin() const;
+// [ 7] const_reverse_iterator rbegin() const;
+// [ 7] const_iterator cend() const;
+// [ 7] const_iterator end() const;
+// [ 7] const_reverse_iterator crend() const;
+// [ 7] const_reverse_iterator rend() const;
+// [ 7] const_pointer data() const;
+// [ 2] bool empty() const;
+// [ 7] const_reference front() const;
+// [ 2] size_type max_size() const;
+// [ 2] size_type size() const;
+// [ 2] bool usesInlineStorage() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 6] bool operator==(const SmallVector&, const SmallVector&);
+// [ 6] bool operator!=(const SmallVector&, const SmallVector&);
+// [ 6] bool operator< (const SmallVector&, const SmallVector&);
+// [ 6] bool operator> (const SmallVector&, const SmallVector&);
+// [ 6] bool operator<=(const SmallVector&, const SmallVector&);
+// [ 6] bool operator>=(const SmallVector&, const SmallVector&);
+// [ 6] void hashAppend(HASHALG&, const SmallVector&);
+// [ 4] void swap(SmallVector&, SmallVector&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] USAGE EXAMPLE
+// [ 2] CONCERN: 'SmallVector' has the expected type traits
+// [-1] PERFORMANCE COMPARISON WITH 'bsl::vector'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bslmf::MovableRefUtil                 MoveUtil;
+
+typedef bdlc::SmallVector<int, 4>             Obj;
+typedef bdlc::SmallVector<bsl::string, 2>     StringObj;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bsl::string makeString(int value)
+    // Return a string, too long for the short-string optimization, that is
+    // unique to the specified 'value'.
+{
+    bsl::ostringstream out;
+    out << "a string long enough to allocate memory: " << value;
+    return out.str();
+}
+
+template <class VALUE>
+VALUE makeValue(int value);
+    // Return the value of the (template parameter) type 'VALUE' corresponding
+    // to the specified 'value'.
+
+template <>
+int makeValue<int>(int value)
+{
+    return value;
+}
+
+template <>
+bsl::string makeValue<bsl::string>(int value)
+{
+    return makeString(value);
+}
+
+template <class OBJ>
+bool matches(const OBJ&                                     object,
+             const bsl::vector<typename OBJ::value_type>&   oracle)
+    // Return 'true' if the specified 'object' holds the same sequence of
+    // elements as the specified 'oracle', and 'false' otherwise.
+{
+    if (object.size() != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+    for (bsl::size_t i = 0; i < oracle.size(); ++i) {
+        if (!(object[i] == oracle[i])) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class OBJ>
+bool usesAllocator(const OBJ& object, bslma::Allocator *allocator)
+    // Return 'true' if each element of the specified 'object' uses the
+    // specified 'allocator', and 'false' otherwise.
+{
+    for (bsl::size_t i = 0; i < object.size(); ++i) {
+        if (object[i].get_allocator() != allocator) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+                            // ===================
+                            // class InputIterator
+                            // ===================
+
+template <class VALUE>
+class InputIterator {
+    // This class provides an input iterator over an array of 'VALUE', so that
+    // the code path for single-pass ranges can be tested.
+
+    // DATA
+    const VALUE *d_current_p;
+
+  public:
+    // TYPES
+    typedef bsl::input_iterator_tag  iterator_category;
+    typedef VALUE                    value_type;
+    typedef bsl::ptrdiff_t           difference_type;
+    typedef const VALUE             *pointer;
+    typedef const VALUE&             reference;
+
+    // CREATORS
+    explicit InputIterator(const VALUE *current)
+    : d_current_p(current)
+    {
+    }
+
+    // MANIPULATORS
+    InputIterator& operator++()
+    {
+        ++d_current_p;
+        return *this;
+    }
+
+    // ACCESSORS
+    reference operator*() const
+    {
+        return *d_current_p;
+    }
+
+    bool operator!=(const InputIterator& other) const
+    {
+        return d_current_p != other.d_current_p;
+    }
+
+    bool operator==(const InputIterator& other) const
+    {
+        return d_current_p == other.d_current_p;
+    }
+};
+
+                        // ==========================
+                        // struct PrimaryManipulators
+                        // ==========================
+
+template <class VALUE, bsl::size_t INLINE_CAPACITY>
+struct PrimaryManipulators {
+    // This 'struct' provides a namespace for testing the primary manipulators
+    // of 'SmallVector<VALUE, INLINE_CAPACITY>'.
+
+    typedef bdlc::SmallVector<VALUE, INLINE_CAPACITY> Vector;
+
+    static void test(bool veryVerbose, bool veryVeryVerbose)
+        // Append, one at a time, more than twice 'INLINE_CAPACITY' elements to
+        // a vector, alternating the two 'push_back' overloads, and verify the
+        // value, capacity, storage, and memory use after each.  Also verify
+        // that appending an element of the vector itself when the vector is
+        // full appends the original value of that element, and that appending
+        // is exception neutral.
+    {
+        const int MAX = static_cast<int>(INLINE_CAPACITY) * 2 + 3;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        bsl::vector<VALUE> oracle;
+
+        Vector mX(&oa);  const Vector& X = mX;
+
+        ASSERT(X.empty());
+        ASSERT(INLINE_CAPACITY == X.capacity());
+        ASSERT(X.usesInlineStorage());
+        ASSERT(&oa == X.allocator());
+        ASSERT(0 < X.max_size());
+
+        for (int i = 0; i < MAX; ++i) {
+            const VALUE V = makeValue<VALUE>(i);
+
+            if (i % 2) {
+                mX.push_back(V);
+            }
+            else {
+                VALUE v(V);
+                mX.push_back(MoveUtil::move(v));
+            }
+            oracle.push_back(V);
+
+            const bsl::size_t SIZE = i + 1;
+
+            ASSERTV(i, SIZE == X.size());
+            ASSERTV(i, matches(X, oracle));
+            ASSERTV(i, SIZE <= X.capacity());
+            ASSERTV(i, (SIZE <= INLINE_CAPACITY) == X.usesInlineStorage());
+            ASSERTV(i, X.usesInlineStorage()
+                                        == (INLINE_CAPACITY == X.capacity()));
+            if (SIZE <= INLINE_CAPACITY) {
+                ASSERTV(i, bslma::UsesBslmaAllocator<VALUE>::value
+                        || 0 == oa.numBlocksTotal());
+            }
+        }
+
+        mX.clear();
+        ASSERT(X.empty());
+        ASSERT(!X.usesInlineStorage());
+        ASSERT(1 == oa.numBlocksInUse());
+
+        if (veryVerbose) cout << "\t\tAliasing at capacity." << endl;
+        {
+            Vector mY(&oa);  const Vector& Y = mY;
+
+            for (bsl::size_t i = 0; i < INLINE_CAPACITY; ++i) {
+                mY.push_back(makeValue<VALUE>(static_cast<int>(i)));
+            }
+            ASSERT(Y.capacity() == Y.size());
+
+            mY.push_back(Y[0]);
+            ASSERT(INLINE_CAPACITY + 1 == Y.size());
+            ASSERT(makeValue<VALUE>(0) == Y.back());
+            ASSERT(!Y.usesInlineStorage());
+
+            while (Y.size() < Y.capacity()) {
+                mY.push_back(makeValue<VALUE>(9));
+            }
+            const VALUE E = Y[1];
+            mY.push_back(MoveUtil::move(mY[1]));
+            ASSERT(E == Y.back());
+        }
+
+        if (veryVerbose) cout << "\t\tException neutrality." << endl;
+        {
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                Vector mY(&oa);  const Vector& Y = mY;
+
+                for (int i = 0; i < MAX; ++i) {
+                    const bsl::size_t SIZE = Y.size();
+                    try {
+                        mY.push_back(makeValue<VALUE>(i));
+                    }
+                    catch (...) {
+                        ASSERTV(i, SIZE == Y.size());
+                        throw;
+                    }
+                }
+                ASSERT(static_cast<bsl::size_t>(MAX) == Y.size());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        }
+        ASSERT(1 == oa.numBlocksInUse());
+    }
+};
+
+                        // ========================
+                        // struct ModifierOperations
+                        // ========================
+
+template <class VALUE, bsl::size_t INLINE_CAPACITY>
+struct ModifierOperations {
+    // This 'struct' provides a namespace for testing the modifiers of
+    // 'SmallVector<VALUE, INLINE_CAPACITY>' against 'bsl::vector'.
+
+    typedef bdlc::SmallVector<VALUE, INLINE_CAPACITY> Vector;
+    typedef bsl::vector<VALUE>                        Oracle;
+
+    static bool check(int                   line,
+                      const Vector&         object,
+                      const Oracle&         oracle,
+                      bslma::TestAllocator *allocator)
+        // Return 'true' if the specified 'object' has the value of the
+        // specified 'oracle', uses its inline storage exactly when its
+        // capacity is 'INLINE_CAPACITY', and, if it uses its inline storage,
+        // holds no block of the specified 'allocator' other than those of its
+        // elements; otherwise report an error at the specified 'line'.
+    {
+        const bool ok = matches(object, oracle)
+                     && object.usesInlineStorage()
+                                    == (INLINE_CAPACITY == object.capacity())
+                     && object.size() <= object.capacity();
+
+        ASSERTV(line, ok);
+        if (object.usesInlineStorage()
+         && !bslma::UsesBslmaAllocator<VALUE>::value) {
+            ASSERTV(line, 0 == allocator->numBlocksInUse());
+        }
+        return ok;
+    }
+
+    static void test(bool veryVerbose, bool veryVeryVerbose)
+        // Apply a pseudo-random sequence of modifications to a vector and to
+        // an oracle 'bsl::vector', and compare them after each.
+    {
+        (void)veryVerbose;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        const int N = static_cast<int>(INLINE_CAPACITY);
+
+        Vector mX(&oa);  const Vector& X = mX;
+        Oracle oracle;
+
+        const VALUE SOURCE[] = { makeValue<VALUE>(100),
+                                 makeValue<VALUE>(101),
+                                 makeValue<VALUE>(102),
+                                 makeValue<VALUE>(103),
+                                 makeValue<VALUE>(104) };
+
+        unsigned state = 12345;
+        for (int step = 0; step < 400; ++step) {
+            state = state * 1103515245u + 12345u;
+            const unsigned     r     = (state >> 8) & 0xffff;
+            const bsl::size_t  size  = X.size();
+            const bsl::size_t  index = size ? r % (size + 1) : 0;
+            const VALUE        V     = makeValue<VALUE>(step);
+            const int          n     = static_cast<int>(r / 17 % (N + 2));
+
+            switch (r % 16) {
+              case 0: {
+                mX.insert(X.begin() + index, V);
+                oracle.insert(oracle.begin() + index, V);
+              } break;
+              case 1: {
+                VALUE v(V);
+                typename Vector::iterator it =
+                               mX.insert(X.begin() + index, MoveUtil::move(v));
+                ASSERTV(step, static_cast<bsl::size_t>(it - X.begin())
+                                                                     == index);
+                oracle.insert(oracle.begin() + index, V);
+              } break;
+              case 2: {
+                mX.insert(X.begin() + index, n, V);
+                oracle.insert(oracle.begin() + index, n, V);
+              } break;
+              case 3: {
+                if (size) {
+                    // aliased insertion
+
+                    const VALUE E = X[r % size];
+                    mX.insert(X.begin() + index, n, X[r % size]);
+                    oracle.insert(oracle.begin() + index, n, E);
+                }
+              } break;
+              case 4: {
+                mX.insert(X.begin() + index, SOURCE, SOURCE + n % 5);
+                oracle.insert(oracle.begin() + index, SOURCE, SOURCE + n % 5);
+              } break;
+              case 5: {
+                typedef InputIterator<VALUE> Iter;
+
+                mX.insert(X.begin() + index,
+                          Iter(SOURCE),
+                          Iter(SOURCE + n % 5));
+                oracle.insert(oracle.begin() + index, SOURCE, SOURCE + n % 5);
+              } break;
+              case 6:
+              case 7: {
+                if (index < size) {
+                    typename Vector::iterator it =
+                                                 mX.erase(X.begin() + index);
+                    ASSERTV(step, static_cast<bsl::size_t>(it - X.begin())
+                                                                     == index);
+                    oracle.erase(oracle.begin() + index);
+                }
+              } break;
+              case 8: {
+                const bsl::size_t last = index + (r % 3 < size - index
+                                                  ? r % 3
+                                                  : size - index);
+                mX.erase(X.begin() + index, X.begin() + last);
+                oracle.erase(oracle.begin() + index, oracle.begin() + last);
+              } break;
+              case 9: {
+                if (size) {
+                    mX.pop_back();
+                    oracle.pop_back();
+                }
+              } break;
+              case 10: {
+                const bsl::size_t newSize = r % (3 * N);
+                mX.resize(newSize);
+                oracle.resize(newSize);
+              } break;
+              case 11: {
+                const bsl::size_t newSize = r % (3 * N);
+                mX.resize(newSize, V);
+                oracle.resize(newSize, V);
+              } break;
+              case 12: {
+                mX.reserve(r % (3 * N));
+                ASSERTV(step, r % (3 * N) <= X.capacity());
+              } break;
+              case 13: {
+                mX.shrink_to_fit();
+                ASSERTV(step, X.size() <= N
+                              ? X.usesInlineStorage()
+                              : X.size() == X.capacity());
+              } break;
+              case 14: {
+                if (size) {
+                    // aliased assignment
+
+                    const VALUE E = X[r % size];
+                    mX.assign(n, X[r % size]);
+                    oracle.assign(n, E);
+                }
+              } break;
+              case 15: {
+                if (r % 4) {
+                    mX.assign(SOURCE, SOURCE + n % 5);
+                    oracle.assign(SOURCE, SOURCE + n % 5);
+                }
+                else {
+                    mX.clear();
+                    oracle.clear();
+                }
+              } break;
+            }
+
+            if (!check(L_, X, oracle, &oa)) {
+                ASSERTV(step, r % 16);
+                break;
+            }
+        }
+    }
+};
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+void loadTags(bdlc::SmallVector<int, 8> *tags, const char *message)
+    // Load into the specified 'tags' the tag of each field of the specified
+    // 'message'.  The behavior is undefined unless 'message' consists of zero
+    // or more '|'-terminated 'tag=value' fields.
+{
+    tags->clear();
+    while (*message) {
+        tags->push_back(bsl::atoi(message));
+        message = bsl::strchr(message, '|') + 1;
+    }
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we load the tags of a typical message, and observe that no memory is
+// allocated:
+//..
+    bslma::TestAllocator      oa("object");
+    bdlc::SmallVector<int, 8> tags(&oa);
+
+    loadTags(&tags, "8=FIX.4.2|35=D|49=SENDER|56=TARGET|");
+
+    ASSERT(4  == tags.size());
+    ASSERT(35 == tags[1]);
+    ASSERT(true == tags.usesInlineStorage());
+    ASSERT(0  == oa.numBlocksTotal());
+//..
+// Next, we load the tags of an unusually long message, which no longer fit
+// in the inline storage:
+//..
+    loadTags(&tags, "8=FIX.4.2|35=D|49=S|56=T|34=7|52=0|11=X|21=1|55=Y|54=1|");
+
+    ASSERT(10 == tags.size());
+    ASSERT(54 == tags.back());
+    ASSERT(false == tags.usesInlineStorage());
+    ASSERT(1  == oa.numBlocksInUse());
+//..
+// Finally, we return to a typical message; the vector keeps its larger
+// capacity until we ask it to shrink, at which point the elements move back
+// into the inline storage:
+//..
+    loadTags(&tags, "8=FIX.4.2|35=0|");
+    ASSERT(2  == tags.size());
+    ASSERT(1  == oa.numBlocksInUse());
+
+    tags.shrink_to_fit();
+    ASSERT(true == tags.usesInlineStorage());
+    ASSERT(0  == oa.numBlocksInUse());
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // ELEMENT ACCESS AND ITERATORS
+        //
+        // Concerns:
+        //: 1 The element accessors and iterators refer to the elements of the
+        //:   vector, in order, whether in inline or heap storage.
+        //:
+        //: 2 'at' throws 'bsl::out_of_range' for an invalid position.
+        //:
+        //: 3 Precondition violations are detected in appropriate build modes.
+        //
+        // Plan:
+        //: 1 For vectors of several sizes, compare the results of each
+        //:   accessor with the expected elements.  (C-1)
+        //:
+        //: 2 Call 'at' with an invalid position.  (C-2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-3)
+        //
+        // Testing:
+        //   reference operator[](size_type);
+        //   reference at(size_type);
+        //   reference back();
+        //   iterator begin();
+        //   pointer data();
+        //   iterator end();
+        //   reference front();
+        //   reverse_iterator rbegin();
+        //   reverse_iterator rend();
+        //   const_reference at(size_type) const;
+        //   const_reference back() const;
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_iterator cend() const;
+        //   const_iterator end() const;
+        //   const_reverse_iterator crend() const;
+        //   const_reverse_iterator rend() const;
+        //   const_pointer data() const;
+        //   const_reference front() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ELEMENT ACCESS AND ITERATORS" << endl
+                          << "============================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        for (int size = 1; size < 10; ++size) {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < size; ++i) {
+                mX.push_back(i * 10);
+            }
+
+            ASSERTV(size, X.data()  == &X[0]);
+            ASSERTV(size, mX.data() == &mX[0]);
+            ASSERTV(size, X.begin() == X.data());
+            ASSERTV(size, X.cbegin() == X.data());
+            ASSERTV(size, mX.begin() == X.begin());
+            ASSERTV(size, X.end()  - X.begin() == size);
+            ASSERTV(size, X.cend() == X.end());
+            ASSERTV(size, mX.end() == X.end());
+            ASSERTV(size, &X.front() == X.data());
+            ASSERTV(size, &mX.front() == X.data());
+            ASSERTV(size, &X.back() == X.end() - 1);
+            ASSERTV(size, &mX.back() == X.end() - 1);
+            ASSERTV(size, &X.at(size - 1) == &X.back());
+            ASSERTV(size, &mX.at(0) == &X.front());
+
+            ASSERTV(size, X.rbegin()  == Obj::const_reverse_iterator(X.end()));
+            ASSERTV(size, X.crbegin() == X.rbegin());
+            ASSERTV(size, X.rend()  == Obj::const_reverse_iterator(X.begin()));
+            ASSERTV(size, X.crend() == X.rend());
+
+            int expected = (size - 1) * 10;
+            for (Obj::reverse_iterator it = mX.rbegin();
+                 it != mX.rend();
+                 ++it) {
+                ASSERTV(size, expected == *it);
+                *it += 1;
+                expected -= 10;
+            }
+            ASSERTV(size, 1 == X[0]);
+        }
+
+        if (verbose) cout << "\tException from 'at'." << endl;
+        {
+#ifdef BDE_BUILD_TARGET_EXC
+            Obj mX(3, 7, &oa);  const Obj& X = mX;
+
+            bool caught = false;
+            try {
+                mX.at(3);
+            }
+            catch (const bsl::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            caught = false;
+            try {
+                X.at(100);
+            }
+            catch (const bsl::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+#endif
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT_SAFE_FAIL(X.front());
+            ASSERT_SAFE_FAIL(X.back());
+            ASSERT_SAFE_FAIL(mX.pop_back());
+            ASSERT_SAFE_FAIL(X[0]);
+
+            mX.push_back(1);
+
+            ASSERT_SAFE_PASS(X.front());
+            ASSERT_SAFE_PASS(X.back());
+            ASSERT_SAFE_PASS(X[0]);
+            ASSERT_SAFE_FAIL(X[1]);
+            ASSERT_SAFE_FAIL(mX.erase(X.end()));
+            ASSERT_SAFE_FAIL(mX.insert(X.end() + 1, 5));
+            ASSERT_SAFE_FAIL(mX.erase(X.end(), X.begin()));
+            ASSERT_SAFE_PASS(mX.erase(X.begin()));
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // COMPARISON AND HASHING
+        //
+        // Concerns:
+        //: 1 The comparison operators compare the sequences of elements
+        //:   lexicographically, as for 'bsl::vector', regardless of the
+        //:   storage used by either operand.
+        //:
+        //: 2 'hashAppend' produces the same hash as for a 'bsl::vector'
+        //:   holding the same elements.
+        //
+        // Plan:
+        //: 1 For each pair of a set of short sequences, compare the results of
+        //:   each operator and of 'bslh::Hash<>' with those for 'bsl::vector'.
+        //:   (C-1..2)
+        //
+        // Testing:
+        //   bool operator==(const SmallVector&, const SmallVector&);
+        //   bool operator!=(const SmallVector&, const SmallVector&);
+        //   bool operator< (const SmallVector&, const SmallVector&);
+        //   bool operator> (const SmallVector&, const SmallVector&);
+        //   bool operator<=(const SmallVector&, const SmallVector&);
+        //   bool operator>=(const SmallVector&, const SmallVector&);
+        //   void hashAppend(HASHALG&, const SmallVector&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COMPARISON AND HASHING" << endl
+                          << "======================" << endl;
+
+        static const char *SPECS[] = {
+            "", "a", "b", "aa", "ab", "ba", "abc", "abcd", "abcde", "abcdf",
+            "abcdefgh", "abcdefgi", "b"
+        };
+        const int NUM_SPECS = static_cast<int>(sizeof SPECS / sizeof *SPECS);
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        bslh::Hash<> hasher;
+
+        for (int ti = 0; ti < NUM_SPECS; ++ti) {
+            const char *const SI = SPECS[ti];
+
+            const Obj         X(SI, SI + strlen(SI), &oa);
+            const vector<int> XV(SI, SI + strlen(SI));
+
+            ASSERTV(ti, hasher(X) == hasher(XV));
+
+            for (int tj = 0; tj < NUM_SPECS; ++tj) {
+                const char *const SJ = SPECS[tj];
+
+                const Obj         Y(SJ, SJ + strlen(SJ), &oa);
+                const vector<int> YV(SJ, SJ + strlen(SJ));
+
+                ASSERTV(ti, tj, (XV == YV) == (X == Y));
+                ASSERTV(ti, tj, (XV != YV) == (X != Y));
+                ASSERTV(ti, tj, (XV <  YV) == (X <  Y));
+                ASSERTV(ti, tj, (XV >  YV) == (X >  Y));
+                ASSERTV(ti, tj, (XV <= YV) == (X <= Y));
+                ASSERTV(ti, tj, (XV >= YV) == (X >= Y));
+                ASSERTV(ti, tj, (XV == YV) == (hasher(X) == hasher(Y)));
+            }
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // MODIFIERS
+        //
+        // Concerns:
+        //: 1 Each modifier produces the same sequence as the corresponding
+        //:   method of 'bsl::vector'.
+        //:
+        //: 2 The inline storage is used exactly when the capacity is
+        //:   'INLINE_CAPACITY', and no memory is held by a vector of
+        //:   non-allocating elements while it uses its inline storage.
+        //:
+        //: 3 Inserting or assigning copies of an element of the vector itself
+        //:   uses the original value of that element.
+        //:
+        //: 4 Input iterator ranges are inserted correctly.
+        //:
+        //: 5 'shrink_to_fit' returns the elements to the inline storage when
+        //:   they fit.
+        //
+        // Plan:
+        //: 1 For 'int' and 'bsl::string' elements and several inline
+        //:   capacities, apply a pseudo-random sequence of modifications
+        //:   (including aliased ones) to a vector and to an oracle
+        //:   'bsl::vector', and compare them after each.  (C-1..5)
+        //:
+        //: 2 Exercise the 'initializer_list' overloads directly.  (C-1)
+        //
+        // Testing:
+        //   SmallVector& operator=(initializer_list<TYPE>);
+        //   void assign(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void assign(size_type, const TYPE&);
+        //   void assign(initializer_list<TYPE>);
+        //   iterator erase(const_iterator);
+        //   iterator erase(const_iterator, const_iterator);
+        //   iterator insert(const_iterator, const TYPE&);
+        //   iterator insert(const_iterator, MovableRef<TYPE>);
+        //   iterator insert(const_iterator, size_type, const TYPE&);
+        //   iterator insert(const_iterator, INPUT_ITERATOR, INPUT_ITERATOR);
+        //   iterator insert(const_iterator, initializer_list<TYPE>);
+        //   void pop_back();
+        //   void reserve(size_type);
+        //   void resize(size_type);
+        //   void resize(size_type, const TYPE&);
+        //   void shrink_to_fit();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MODIFIERS" << endl
+                          << "=========" << endl;
+
+        ModifierOperations<int, 1>::test(veryVerbose, veryVeryVeryVerbose);
+        ModifierOperations<int, 4>::test(veryVerbose, veryVeryVeryVerbose);
+        ModifierOperations<int, 9>::test(veryVerbose, veryVeryVeryVerbose);
+        ModifierOperations<bsl::string, 1>::test(veryVerbose,
+                                                 veryVeryVeryVerbose);
+        ModifierOperations<bsl::string, 3>::test(veryVerbose,
+                                                 veryVeryVeryVerbose);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        if (verbose) cout << "\t'initializer_list' overloads." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX = { 1, 2, 3 };
+            ASSERT(3 == X.size());
+            ASSERT(X.usesInlineStorage());
+
+            mX.insert(X.begin() + 1, { 7, 8 });
+            ASSERT(5 == X.size());
+            ASSERT(7 == X[1]);
+            ASSERT(!X.usesInlineStorage());
+
+            mX.assign({ 4 });
+            ASSERT(1 == X.size());
+            ASSERT(4 == X[0]);
+        }
+#endif
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, AND SWAP
+        //
+        // Concerns:
+        //: 1 Copy construction and assignment produce the value of the source,
+        //:   using the allocator of the target, and leave the source
+        //:   unchanged.
+        //:
+        //: 2 Move construction and assignment with the same allocator produce
+        //:   the value of the source without allocating, adopt the heap
+        //:   storage of the source (if any), and leave the source empty and
+        //:   using its inline storage.
+        //:
+        //: 3 Move construction and assignment with a different allocator
+        //:   produce the value of the source using the target's allocator.
+        //:
+        //: 4 'swap' exchanges values without allocating, in constant time
+        //:   (preserving the addresses of the elements) when neither object
+        //:   uses inline storage.
+        //:
+        //: 5 The free 'swap' exchanges values of objects having different
+        //:   allocators.
+        //:
+        //: 6 Self-assignment has no effect.
+        //
+        // Plan:
+        //: 1 For each pair of sizes on either side of the inline capacity,
+        //:   perform each operation and verify the values, allocators,
+        //:   storage, and memory use.  (C-1..6)
+        //
+        // Testing:
+        //   SmallVector(const SmallVector&, bslma::Allocator *);
+        //   SmallVector(MovableRef<SmallVector>);
+        //   SmallVector(MovableRef<SmallVector>, bslma::Allocator *);
+        //   SmallVector& operator=(const SmallVector&);
+        //   SmallVector& operator=(MovableRef<SmallVector>);
+        //   void swap(SmallVector&);
+        //   void swap(SmallVector&, SmallVector&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, MOVE, AND SWAP" << endl
+                          << "====================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        const int SIZES[] = { 0, 1, 2, 3, 5, 9 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SI = SIZES[ti];
+
+            StringObj mW(&za);  const StringObj& W = mW;
+            for (int i = 0; i < SI; ++i) {
+                mW.push_back(makeString(i));
+            }
+
+            if (veryVerbose) { T_ P(SI) }
+
+            // copy construction
+
+            {
+                const StringObj X(W, &oa);
+                ASSERTV(SI, W == X);
+                ASSERTV(SI, &oa == X.allocator());
+                ASSERTV(SI, usesAllocator(X, &oa));
+                ASSERTV(SI, X.usesInlineStorage()
+                                              == (X.size() <= X.capacity()
+                                                  && X.size() <= 2));
+            }
+            {
+                const StringObj X(W);
+                ASSERTV(SI, W == X);
+                ASSERTV(SI, &defaultAllocator == X.allocator());
+            }
+
+            // move construction, same allocator
+
+            {
+                StringObj mS(W, &oa);  const StringObj& S = mS;
+                const bool  INLINE = S.usesInlineStorage();
+                const void *DATA   = S.data();
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                StringObj mX(MoveUtil::move(mS));  const StringObj& X = mX;
+
+                ASSERTV(SI, W == X);
+                ASSERTV(SI, &oa == X.allocator());
+                ASSERTV(SI, oam.isTotalSame());
+                ASSERTV(SI, S.empty());
+                ASSERTV(SI, S.usesInlineStorage());
+                ASSERTV(SI, INLINE == X.usesInlineStorage());
+                ASSERTV(SI, INLINE || DATA == X.data());
+
+                const StringObj Y(MoveUtil::move(mX), &oa);
+                ASSERTV(SI, W == Y);
+                ASSERTV(SI, oam.isTotalSame());
+                ASSERTV(SI, X.empty());
+            }
+
+            // move construction, different allocator
+
+            {
+                StringObj mS(W, &za);
+
+                const StringObj X(MoveUtil::move(mS), &oa);
+                ASSERTV(SI, W == X);
+                ASSERTV(SI, &oa == X.allocator());
+                ASSERTV(SI, usesAllocator(X, &oa));
+            }
+
+            for (int tj = 0; tj < NUM_SIZES; ++tj) {
+                const int SJ = SIZES[tj];
+
+                StringObj mV(&za);  const StringObj& V = mV;
+                for (int j = 0; j < SJ; ++j) {
+                    mV.push_back(makeString(100 + j));
+                }
+
+                // copy assignment
+
+                {
+                    StringObj mX(V, &oa);  const StringObj& X = mX;
+
+                    StringObj *mR = &(mX = W);
+                    ASSERTV(SI, SJ, mR == &mX);
+                    ASSERTV(SI, SJ, W == X);
+                    ASSERTV(SI, SJ, usesAllocator(X, &oa));
+
+                    mX = X;
+                    ASSERTV(SI, SJ, W == X);
+                }
+
+                // move assignment, same allocator
+
+                {
+                    StringObj mX(V, &oa);  const StringObj& X = mX;
+                    StringObj mS(W, &oa);  const StringObj& S = mS;
+
+                    bslma::TestAllocatorMonitor oam(&oa);
+
+                    mX = MoveUtil::move(mS);
+                    ASSERTV(SI, SJ, W == X);
+                    ASSERTV(SI, SJ, oam.isTotalSame());
+                    ASSERTV(SI, SJ, S.empty());
+                    ASSERTV(SI, SJ, S.usesInlineStorage());
+
+                    mX = MoveUtil::move(mX);
+                    ASSERTV(SI, SJ, W == X);
+                }
+
+                // move assignment, different allocator
+
+                {
+                    StringObj mX(V, &oa);  const StringObj& X = mX;
+                    StringObj mS(W, &za);
+
+                    mX = MoveUtil::move(mS);
+                    ASSERTV(SI, SJ, W == X);
+                    ASSERTV(SI, SJ, usesAllocator(X, &oa));
+                }
+
+                // member and free swap, same allocator
+
+                {
+                    StringObj mX(W, &oa);  const StringObj& X = mX;
+                    StringObj mY(V, &oa);  const StringObj& Y = mY;
+
+                    const bool  BOTH_HEAP = !X.usesInlineStorage()
+                                         && !Y.usesInlineStorage();
+                    const void *XDATA     = X.data();
+
+                    bslma::TestAllocatorMonitor oam(&oa);
+
+                    mX.swap(mY);
+                    ASSERTV(SI, SJ, V == X);
+                    ASSERTV(SI, SJ, W == Y);
+                    ASSERTV(SI, SJ, !BOTH_HEAP || XDATA == Y.data());
+                    ASSERTV(SI, SJ, usesAllocator(X, &oa));
+                    ASSERTV(SI, SJ, usesAllocator(Y, &oa));
+
+                    swap(mX, mY);
+                    ASSERTV(SI, SJ, W == X);
+                    ASSERTV(SI, SJ, V == Y);
+
+                    ASSERTV(SI, SJ, oam.isTotalSame());
+                }
+
+                // free swap, different allocators
+
+                {
+                    StringObj mX(W, &oa);  const StringObj& X = mX;
+                    StringObj mY(V, &za);  const StringObj& Y = mY;
+
+                    swap(mX, mY);
+                    ASSERTV(SI, SJ, V == X);
+                    ASSERTV(SI, SJ, W == Y);
+                    ASSERTV(SI, SJ, usesAllocator(X, &oa));
+                    ASSERTV(SI, SJ, usesAllocator(Y, &za));
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&oa);
+            Obj mY(&oa);
+            Obj mZ(&za);
+
+            ASSERT_PASS(mX.swap(mY));
+            ASSERT_FAIL(mX.swap(mZ));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // VALUE CONSTRUCTORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates a vector having the expected value,
+        //:   using the supplied (or default) allocator for itself and its
+        //:   elements.
+        //:
+        //: 2 A constructor allocates only when the initial size exceeds the
+        //:   inline capacity.
+        //:
+        //: 3 The range constructor accepts input, forward, and random-access
+        //:   iterators, and, given two integers, behaves as the
+        //:   '(size_type, const TYPE&)' constructor.
+        //
+        // Plan:
+        //: 1 Construct vectors of 'int' and 'bsl::string' using each
+        //:   constructor, for sizes on either side of the inline capacity,
+        //:   and verify the value, allocators, and memory use.  (C-1..3)
+        //
+        // Testing:
+        //   SmallVector(size_type, bslma::Allocator *);
+        //   SmallVector(size_type, const TYPE&, bslma::Allocator *);
+        //   SmallVector(INPUT_ITERATOR, INPUT_ITERATOR, bslma::Allocator *);
+        //   SmallVector(initializer_list<TYPE>, bslma::Allocator *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "VALUE CONSTRUCTORS" << endl
+                          << "==================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const int DATA[] = { 3, 1, 4, 1, 5, 9, 2, 6, 5, 3 };
+
+        for (int size = 0; size <= 10; ++size) {
+            const bool INLINE = size <= 4;
+
+            bslma::TestAllocatorMonitor oam(&oa);
+            {
+                const Obj X(size, &oa);
+                ASSERTV(size, matches(X, vector<int>(size)));
+                ASSERTV(size, INLINE == X.usesInlineStorage());
+                ASSERTV(size, INLINE == oam.isTotalSame());
+            }
+            {
+                const Obj X(size, 7, &oa);
+                ASSERTV(size, matches(X, vector<int>(size, 7)));
+                ASSERTV(size, INLINE == X.usesInlineStorage());
+            }
+            {
+                const Obj X(DATA, DATA + size, &oa);
+                ASSERTV(size, matches(X, vector<int>(DATA, DATA + size)));
+                ASSERTV(size, INLINE == X.usesInlineStorage());
+            }
+            {
+                const list<int> L(DATA, DATA + size);
+                const Obj       X(L.begin(), L.end(), &oa);
+                ASSERTV(size, matches(X, vector<int>(DATA, DATA + size)));
+            }
+            {
+                const Obj X(InputIterator<int>(DATA),
+                            InputIterator<int>(DATA + size),
+                            &oa);
+                ASSERTV(size, matches(X, vector<int>(DATA, DATA + size)));
+            }
+            {
+                const Obj X(size, size + 1, &oa);  // two 'int' arguments
+                ASSERTV(size, matches(X, vector<int>(size, size + 1)));
+            }
+            {
+                const StringObj X(size, makeString(size), &oa);
+                ASSERTV(size, matches(X, vector<string>(size,
+                                                        makeString(size))));
+                ASSERTV(size, usesAllocator(X, &oa));
+            }
+            {
+                const StringObj X(size, &oa);
+                ASSERTV(size, size == static_cast<int>(X.size()));
+                ASSERTV(size, usesAllocator(X, &oa));
+            }
+            ASSERTV(size, 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tDefault allocator." << endl;
+        {
+            const Obj X(9, 1);
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(1 == defaultAllocator.numBlocksInUse());
+        }
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        if (verbose) cout << "\t'initializer_list' constructor." << endl;
+        {
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            const Obj X({ 1, 2, 3 }, &oa);
+            ASSERT(3 == X.size());
+            ASSERT(X.usesInlineStorage());
+            ASSERT(oam.isTotalSame());
+
+            const Obj Y({ 1, 2, 3, 4, 5 }, &oa);
+            ASSERT(5 == Y.size());
+            ASSERT(!Y.usesInlineStorage());
+        }
+#endif
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed vector is empty, uses its inline storage,
+        //:   and allocates no memory.
+        //:
+        //: 2 'push_back' appends an element, using the inline storage while
+        //:   the size does not exceed 'INLINE_CAPACITY', and heap storage
+        //:   (growing geometrically) thereafter.
+        //:
+        //: 3 'push_back' of an element of the vector itself appends the
+        //:   original value of that element, even when the vector must grow.
+        //:
+        //: 4 'push_back' is exception neutral.
+        //:
+        //: 5 'clear' removes all elements and retains the capacity.
+        //:
+        //: 6 The destructor releases all memory.
+        //:
+        //: 7 'SmallVector' has the 'bslma::UsesBslmaAllocator' and
+        //:   'bslalg::HasStlIterators' traits, and is not bitwise moveable.
+        //
+        // Plan:
+        //: 1 For 'int' and 'bsl::string' elements and several inline
+        //:   capacities, append elements one at a time and verify the value,
+        //:   storage, and memory use after each.  (C-1..3, 5..6)
+        //:
+        //: 2 Append elements within the 'bslma' exception-test loop.  (C-4)
+        //:
+        //: 3 Check the traits.  (C-7)
+        //
+        // Testing:
+        //   SmallVector(bslma::Allocator *);
+        //   ~SmallVector();
+        //   void clear();
+        //   void push_back(const TYPE&);
+        //   void push_back(MovableRef<TYPE>);
+        //   const_reference operator[](size_type) const;
+        //   size_type capacity() const;
+        //   bool empty() const;
+        //   size_type max_size() const;
+        //   size_type size() const;
+        //   bool usesInlineStorage() const;
+        //   bslma::Allocator *allocator() const;
+        //   CONCERN: 'SmallVector' has the expected type traits
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "PRIMARY MANIPULATORS AND BASIC ACCESSORS" << endl
+                 << "========================================" << endl;
+
+        PrimaryManipulators<int, 1>::test(veryVerbose, veryVeryVeryVerbose);
+        PrimaryManipulators<int, 4>::test(veryVerbose, veryVeryVeryVerbose);
+        PrimaryManipulators<int, 16>::test(veryVerbose, veryVeryVeryVerbose);
+        PrimaryManipulators<bsl::string, 1>::test(veryVerbose,
+                                                  veryVeryVeryVerbose);
+        PrimaryManipulators<bsl::string, 3>::test(veryVerbose,
+                                                  veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tDefault allocator." << endl;
+        {
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+            const Obj X;
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(dam.isTotalSame());
+        }
+
+        if (verbose) cout << "\tType traits." << endl;
+        {
+            ASSERT( bslma::UsesBslmaAllocator<Obj>::value);
+            ASSERT( bslma::UsesBslmaAllocator<StringObj>::value);
+            ASSERT( bslalg::HasStlIterators<Obj>::value);
+            ASSERT(!bslmf::IsBitwiseMoveable<Obj>::value);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a vector, fill it past its inline capacity, copy it,
+        //:   modify it, and shrink it back into its inline storage.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        ASSERT(X.empty());
+        ASSERT(X.usesInlineStorage());
+        ASSERT(4 == X.capacity());
+
+        for (int i = 0; i < 4; ++i) {
+            mX.push_back(i);
+        }
+        ASSERT(4 == X.size());
+        ASSERT(X.usesInlineStorage());
+        ASSERT(0 == oa.numBlocksTotal());
+
+        mX.push_back(4);
+        ASSERT(5 == X.size());
+        ASSERT(!X.usesInlineStorage());
+        ASSERT(1 == oa.numBlocksInUse());
+
+        Obj mY(X, &oa);  const Obj& Y = mY;
+        ASSERT(X == Y);
+
+        mY.erase(mY.begin() + 1, mY.end() - 1);
+        ASSERT(2 == Y.size());
+        ASSERT(0 == Y[0]);
+        ASSERT(4 == Y[1]);
+        ASSERT(Y != X);
+        ASSERT(X < Y);
+
+        mY.shrink_to_fit();
+        ASSERT(Y.usesInlineStorage());
+        ASSERT(1 == oa.numBlocksInUse());
+
+        mX.swap(mY);
+        ASSERT(2 == X.size());
+        ASSERT(5 == Y.size());
+        ASSERT(X.usesInlineStorage());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE COMPARISON WITH 'bsl::vector'
+        //   Compare the time taken to create, fill, and destroy short vectors
+        //   using 'bdlc::SmallVector' and 'bsl::vector'.  Command line
+        //   parameters:
+        //   2nd parameter: number of elements per vector (defaults to 6).
+        //   3rd parameter: number of repetitions (defaults to 1000000).
+        //
+        // Concerns:
+        //: 1 Report the average time to create a vector, append the elements,
+        //:   sum them, and destroy the vector.
+        //
+        // Plan:
+        //: 1 Time the loop for 'SmallVector<int, 8>' and 'bsl::vector<int>'
+        //:   using 'bsls::Stopwatch', with 'bslma::NewDeleteAllocator' as the
+        //:   allocator.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE COMPARISON WITH 'bsl::vector'
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE COMPARISON WITH 'bsl::vector'" << endl
+             << "=========================================" << endl;
+
+        const int numElements    = argc > 2 ? atoi(argv[2]) : 6;
+        const int numRepetitions = argc > 3 ? atoi(argv[3]) : 1000000;
+
+        P_(numElements) P(numRepetitions)
+
+        bslma::Allocator *alloc = &bslma::NewDeleteAllocator::singleton();
+
+        bsls::Stopwatch timer;
+        long            checksum = 0;
+
+        timer.start();
+        for (int r = 0; r < numRepetitions; ++r) {
+            bdlc::SmallVector<int, 8> v(alloc);
+            for (int i = 0; i < numElements; ++i) {
+                v.push_back(i + r);
+            }
+            for (bsl::size_t i = 0; i < v.size(); ++i) {
+                checksum += v[i];
+            }
+        }
+        timer.stop();
+        const double smallTime = timer.elapsedTime() / numRepetitions;
+
+        timer.reset();
+        timer.start();
+        for (int r = 0; r < numRepetitions; ++r) {
+            bsl::vector<int> v(alloc);
+            for (int i = 0; i < numElements; ++i) {
+                v.push_back(i + r);
+            }
+            for (bsl::size_t i = 0; i < v.size(); ++i) {
+                checksum += v[i];
+            }
+        }
+        timer.stop();
+        const double vectorTime = timer.elapsedTime() / numRepetitions;
+
+        cout << "SmallVector<int, 8>: " << smallTime  * 1e9 << " ns\n"
+             << "bsl::vector<int>:    " << vectorTime * 1e9 << " ns\n"
+             << "(checksum " << checksum << ")" << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -28,6 +28,10 @@ BSLS_IDENT("$Id: $")
 // value, if the queue is full.  The 'tryPopFront' method fails immediately,
 // returning a non-zero value, if the queue is empty.
 //
+// Runs of elements may be transferred with 'pushBackRange' and 'popFrontUpTo'
+// (and their non-blocking counterparts 'tryPushBackRange' and
+// 'tryPopFrontUpTo'); see {Batch Operations}.
+//
 // The queue may be placed into a "enqueue disabled" state using the
 // 'disablePushBack' method.  When disabled, 'pushBack' and 'tryPushBack' fail
 // immediately and return an error code.  Any threads blocked in 'pushBack'
@@ -52,6 +56,28 @@ BSLS_IDENT("$Id: $")
 // (see 'bslma_usesbslmaallocator') so that the allocator of the queue is
 // propagated to the elements contained in the queue.
 //
+///Batch Operations
+///----------------
+// Each 'pushBack' and 'popFront' claims a single slot of the queue, paying
+// for its own atomic read-modify-write operations on the queue's counters and,
+// potentially, for a wake-up of a blocked thread.  When elements are produced
+// or consumed in groups, the batch methods amortize this cost: 'pushBackRange'
+// acquires as many empty slots as are available (up to the size of the range)
+// from the semaphore at once, reserves the whole run of slots with a single
+// atomic increment of the enqueue index, and publishes the run with a single
+// 'post' to the semaphore guarding the available elements.  'popFrontUpTo'
+// similarly claims up to the requested number of available elements with one
+// semaphore operation and one increment of the dequeue index, and makes the
+// run of slots writable with a single 'post'.  Consequently, a blocked
+// consumer (or producer) is woken at most once per batch, rather than once
+// per element.
+//
+// Note that 'pushBackRange' blocks until *all* the elements of the range have
+// been enqueued; when the range is larger than the available capacity, it is
+// enqueued in several runs, and elements pushed concurrently by other threads
+// may be interleaved between the runs.  'popFrontUpTo' blocks only until at
+// least one element is available.
+//
 ///Exception safety
 ///----------------
 // A 'bdlcc::BoundedQueue' is exception neutral, and all of the methods of
@@ -198,7 +224,9 @@ BSLS_IDENT("$Id: $")
 #include <bsls_objectbuffer.h>
 #include <bsls_types.h>
 
+#include <bsl_climits.h>
 #include <bsl_cstdint.h>
+#include <bsl_iterator.h>
 
 namespace BloombergLP {
 namespace bdlcc {
@@ -272,6 +300,92 @@ class BoundedQueue_PushExceptionCompleteProctor {
         // If no queue is currently managed, this method has no effect.
 };
 
+           // ===================================================
+           // class BoundedQueue_PopRangeExceptionCompleteProctor
+           // ===================================================
+
+template <class TYPE>
+class BoundedQueue_PopRangeExceptionCompleteProctor {
+    // This class implements a proctor that invokes
+    // 'TYPE::popRangeExceptionComplete' on a run of reserved indices upon
+    // destruction unless 'release' has been called.
+
+    // DATA
+    TYPE                *d_queue_p;     // managed queue
+    bsls::Types::Uint64  d_index;       // first index of the managed run
+    bsls::Types::Uint64  d_numIndices;  // number of indices in the run
+
+    // NOT IMPLEMENTED
+    BoundedQueue_PopRangeExceptionCompleteProctor();
+    BoundedQueue_PopRangeExceptionCompleteProctor(
+                         const BoundedQueue_PopRangeExceptionCompleteProctor&);
+    BoundedQueue_PopRangeExceptionCompleteProctor& operator=(
+                         const BoundedQueue_PopRangeExceptionCompleteProctor&);
+
+  public:
+    // CREATORS
+    BoundedQueue_PopRangeExceptionCompleteProctor(
+                                         TYPE                *queue,
+                                         bsls::Types::Uint64  index,
+                                         bsls::Types::Uint64  numIndices);
+        // Create a 'popRangeExceptionComplete' proctor that manages the run of
+        // the specified 'numIndices' indices starting at the specified 'index'
+        // of the specified 'queue'.
+
+    ~BoundedQueue_PopRangeExceptionCompleteProctor();
+        // Destroy this object and, if 'release' has not been invoked, invoke
+        // the managed queue's 'popRangeExceptionComplete' method with the
+        // managed run.
+
+    // MANIPULATORS
+    void release();
+        // Release from management the queue currently managed by this proctor.
+        // If no queue is currently managed, this method has no effect.
+};
+
+               // =========================================
+               // class BoundedQueue_PushRangeCompleteGuard
+               // =========================================
+
+template <class TYPE>
+class BoundedQueue_PushRangeCompleteGuard {
+    // This class implements a guard that invokes 'TYPE::pushRangeComplete' on
+    // a run of reserved indices upon destruction, indicating how many of the
+    // indices, in order, have had a value constructed.
+
+    // DATA
+    TYPE                *d_queue_p;      // managed queue
+    bsls::Types::Uint64  d_index;        // first index of the managed run
+    bsls::Types::Uint64  d_numIndices;   // number of indices in the run
+    bsls::Types::Uint64  d_numPushed;    // number of values constructed
+
+    // NOT IMPLEMENTED
+    BoundedQueue_PushRangeCompleteGuard();
+    BoundedQueue_PushRangeCompleteGuard(
+                                   const BoundedQueue_PushRangeCompleteGuard&);
+    BoundedQueue_PushRangeCompleteGuard& operator=(
+                                   const BoundedQueue_PushRangeCompleteGuard&);
+
+  public:
+    // CREATORS
+    BoundedQueue_PushRangeCompleteGuard(TYPE                *queue,
+                                        bsls::Types::Uint64  index,
+                                        bsls::Types::Uint64  numIndices);
+        // Create a 'pushRangeComplete' guard that manages the run of the
+        // specified 'numIndices' indices starting at the specified 'index' of
+        // the specified 'queue', none of which has had a value constructed.
+
+    ~BoundedQueue_PushRangeCompleteGuard();
+        // Destroy this object and invoke the managed queue's
+        // 'pushRangeComplete' method with the managed run and the number of
+        // values constructed.
+
+    // MANIPULATORS
+    void increment();
+        // Indicate that a value has been constructed in the next index of the
+        // managed run.
+};
+
                          // ========================
                          // struct BoundedQueue_Node
                          // ========================
@@ -404,11 +518,22 @@ class BoundedQueue {
     friend class BoundedQueue_PushExceptionCompleteProctor<
                                                           BoundedQueue<TYPE> >;
 
+    friend class BoundedQueue_PopRangeExceptionCompleteProctor<
+                                                          BoundedQueue<TYPE> >;
+
+    friend class BoundedQueue_PushRangeCompleteGuard<BoundedQueue<TYPE> >;
+
     // PRIVATE CLASS METHODS
     static bool isQuiescentState(bsls::Types::Uint64 count);
         // Return 'true' if the specified 'count' implies a quiescent state
         // (see *Implementation* *Note*), and 'false' otherwise.
 
+    static int maxToTake(bsl::size_t numElements);
+        // Return the number of additional slots to request from a semaphore,
+        // after one slot has been acquired, to transfer the specified
+        // 'numElements' elements; i.e., 'numElements - 1' limited to the range
+        // of 'int'.  The behavior is undefined unless '0 < numElements'.
+
     // PRIVATE MANIPULATORS
     void popComplete(Node *node, bool isEmpty);
         // Destruct the value stored in the specified 'node', mark the 'node'
@@ -422,6 +547,29 @@ class BoundedQueue {
         // element into the specified 'value'.  This method is invoked by
         // 'popFront' and 'tryPopFront' once an element is available.
 
+    void popFrontRangeHelper(TYPE *buffer, int numElements);
+        // Remove the specified 'numElements' elements from the front of this
+        // queue and load them, in order, into the array starting at the
+        // specified 'buffer'.  This method is invoked by 'popFrontUpTo' and
+        // 'tryPopFrontUpTo' once 'numElements' elements are available.
+
+    void popRangeComplete(bsls::Types::Uint64 index,
+                          bsls::Types::Uint64 numIndices,
+                          bool                isEmpty);
+        // Destruct the values stored in the nodes of the run of the specified
+        // 'numIndices' indices starting at the specified 'index' that are not
+        // marked for reclamation, mark the run writable, and if the specified
+        // 'isEmpty' is 'true' then signal the queue empty condition.
+
+    void popRangeExceptionComplete(bsls::Types::Uint64 index,
+                                   bsls::Types::Uint64 numIndices);
+        // Return to the pop semaphore the elements that could not be popped
+        // from the run of the specified 'numIndices' indices starting at the
+        // specified 'index' (one for each node marked for reclamation), and
+        // complete the run as per 'popRangeComplete'.  This method is used
+        // within 'popFrontRangeHelper' by a proctor to complete the
+        // reclamation of a run of nodes in the presence of an exception.
+
     void pushComplete();
         // Mark a "push" operation as complete, and 'post' to the
         // 'd_popSemaphore' if appropriate.
@@ -432,6 +580,24 @@ class BoundedQueue {
         // 'pushFront' by a proctor to complete the marking of a node to
         // reclaim in the presence of an exception.
 
+    template <class FORWARD_ITER>
+    FORWARD_ITER pushBackRangeHelper(FORWARD_ITER begin, int numElements);
+        // Append the specified 'numElements' elements of the range starting
+        // at the specified 'begin' to the back of this queue, and return an
+        // iterator referring to the element following the last one appended.
+        // This method is invoked by 'pushBackRange' and 'tryPushBackRange'
+        // once 'numElements' empty slots are available.
+
+    void pushRangeComplete(bsls::Types::Uint64 index,
+                           bsls::Types::Uint64 numIndices,
+                           bsls::Types::Uint64 numPushed);
+        // Mark the push operations on the run of the specified 'numIndices'
+        // indices starting at the specified 'index' as complete, where the
+        // first specified 'numPushed' nodes of the run hold a value and the
+        // remaining nodes are marked for reclamation, and 'post' to the
+        // 'd_popSemaphore' if appropriate.  The behavior is undefined unless
+        // 'numPushed <= numIndices'.
+
     // NOT IMPLEMENTED
     BoundedQueue(const BoundedQueue&);
     BoundedQueue& operator=(const BoundedQueue&);
@@ -492,6 +658,40 @@ class BoundedQueue {
         // due to the queue being full will return 'e_DISABLED' if
         // 'disablePushBack' is invoked.
 
+    int popFrontUpTo(bsl::size_t *numPopped,
+                     TYPE        *buffer,
+                     bsl::size_t  maxNumElements);
+        // Remove up to the specified 'maxNumElements' elements from the front
+        // of this queue, load them, in order, into the array starting at the
+        // specified 'buffer', and load the number of elements removed into the
+        // specified 'numPopped'.  If the queue is empty, block until it is not
+        // empty; no further blocking occurs once an element is available.
+        // Return 0 on success, and a non-zero value otherwise.  Specifically,
+        // return 'e_SUCCESS' on success, 'e_DISABLED' if
+        // 'isPopFrontDisabled()' and 'e_FAILED' if an error occurs.  On
+        // failure, '*numPopped' is 0 and 'buffer' is not changed.  Threads
+        // blocked due to the queue being empty will return 'e_DISABLED' if
+        // 'disablePopFront' is invoked.  The behavior is undefined unless
+        // '0 < maxNumElements' and 'buffer' refers to an array of at least
+        // 'maxNumElements' elements.  See {Batch Operations}.
+
+    template <class FORWARD_ITER>
+    int pushBackRange(bsl::size_t  *numPushed,
+                      FORWARD_ITER  begin,
+                      FORWARD_ITER  end);
+        // Append the elements of the specified range '[begin .. end)', in
+        // order, to the back of this queue, and load the number of elements
+        // appended into the specified 'numPushed'.  If the queue is full,
+        // block until it is not full, and repeat until all the elements have
+        // been appended.  Return 0 on success, and a non-zero value otherwise.
+        // Specifically, return 'e_SUCCESS' on success, 'e_DISABLED' if
+        // 'isPushBackDisabled()' (even if the range is empty) and 'e_FAILED'
+        // if an error occurs.  On failure, the first '*numPushed' elements of
+        // the range have been appended.  Threads blocked due to the queue
+        // being full will return 'e_DISABLED' if 'disablePushBack' is invoked.
+        // Note that the elements of the range are copied without being
+        // modified.  See {Batch Operations}.
+
     void removeAll();
         // Remove all items currently in this queue.  Note that this operation
         // is not atomic; if other threads are concurrently pushing items into
@@ -522,6 +722,36 @@ class BoundedQueue {
         // 'e_FULL' if '!isPushBackDisabled()' and the queue was full, and
         // 'e_FAILED' if an error occurs.  On failure, 'value' is not changed.
 
+    int tryPopFrontUpTo(bsl::size_t *numPopped,
+                        TYPE        *buffer,
+                        bsl::size_t  maxNumElements);
+        // Attempt to remove, without blocking, up to the specified
+        // 'maxNumElements' elements from the front of this queue, load them,
+        // in order, into the array starting at the specified 'buffer', and
+        // load the number of elements removed into the specified 'numPopped'.
+        // Return 0 on success, and a non-zero value otherwise.  Specifically,
+        // return 'e_SUCCESS' if at least one element was removed,
+        // 'e_DISABLED' if 'isPopFrontDisabled()', 'e_EMPTY' if
+        // '!isPopFrontDisabled()' and the queue was empty, and 'e_FAILED' if
+        // an error occurs.  On failure, '*numPopped' is 0 and 'buffer' is not
+        // changed.  The behavior is undefined unless '0 < maxNumElements' and
+        // 'buffer' refers to an array of at least 'maxNumElements' elements.
+
+    template <class FORWARD_ITER>
+    int tryPushBackRange(bsl::size_t  *numPushed,
+                         FORWARD_ITER  begin,
+                         FORWARD_ITER  end);
+        // Append, without blocking, as many of the elements of the specified
+        // range '[begin .. end)', in order, to the back of this queue as there
+        // is available capacity for, and load the number of elements appended
+        // into the specified 'numPushed'.  Return 0 on success, and a non-zero
+        // value otherwise.  Specifically, return 'e_SUCCESS' if at least one
+        // element was appended or the range is empty, 'e_DISABLED' if
+        // 'isPushBackDisabled()', 'e_FULL' if '!isPushBackDisabled()' and the
+        // queue was full, and 'e_FAILED' if an error occurs.  On failure,
+        // '*numPushed' is 0.  Note that the elements of the range are copied
+        // without being modified.
+
                        // Enqueue/Dequeue State
 
     void disablePopFront();
@@ -641,6 +871,76 @@ void BoundedQueue_PushExceptionCompleteProctor<TYPE>::release()
     d_queue_p = 0;
 }
 
+           // ---------------------------------------------------
+           // class BoundedQueue_PopRangeExceptionCompleteProctor
+           // ---------------------------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+BoundedQueue_PopRangeExceptionCompleteProctor<TYPE>::
+               BoundedQueue_PopRangeExceptionCompleteProctor(
+                                           TYPE                *queue,
+                                           bsls::Types::Uint64  index,
+                                           bsls::Types::Uint64  numIndices)
+: d_queue_p(queue)
+, d_index(index)
+, d_numIndices(numIndices)
+{
+}
+
+template <class TYPE>
+inline
+BoundedQueue_PopRangeExceptionCompleteProctor<TYPE>::
+                               ~BoundedQueue_PopRangeExceptionCompleteProctor()
+{
+    if (d_queue_p) {
+        d_queue_p->popRangeExceptionComplete(d_index, d_numIndices);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void BoundedQueue_PopRangeExceptionCompleteProctor<TYPE>::release()
+{
+    d_queue_p = 0;
+}
+
+               // -----------------------------------------
+               // class BoundedQueue_PushRangeCompleteGuard
+               // -----------------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+BoundedQueue_PushRangeCompleteGuard<TYPE>::BoundedQueue_PushRangeCompleteGuard(
+                                           TYPE                *queue,
+                                           bsls::Types::Uint64  index,
+                                           bsls::Types::Uint64  numIndices)
+: d_queue_p(queue)
+, d_index(index)
+, d_numIndices(numIndices)
+, d_numPushed(0)
+{
+}
+
+template <class TYPE>
+inline
+BoundedQueue_PushRangeCompleteGuard<TYPE>::
+                                         ~BoundedQueue_PushRangeCompleteGuard()
+{
+    d_queue_p->pushRangeComplete(d_index, d_numIndices, d_numPushed);
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void BoundedQueue_PushRangeCompleteGuard<TYPE>::increment()
+{
+    ++d_numPushed;
+}
+
                          // ------------------------
                          // struct BoundedQueue_Node
                          // ------------------------
@@ -685,6 +985,17 @@ bool BoundedQueue<TYPE>::isQuiescentState(bsls::Types::Uint64 count)
     return (count >> k_FINISHED_SHIFT) == (count & k_STARTED_MASK);
 }
 
+template <class TYPE>
+inline
+int BoundedQueue<TYPE>::maxToTake(bsl::size_t numElements)
+{
+    BSLS_ASSERT(0 < numElements);
+
+    return numElements - 1 < static_cast<bsl::size_t>(INT_MAX)
+           ? static_cast<int>(numElements - 1)
+           : INT_MAX;
+}
+
 // PRIVATE MANIPULATORS
 template <class TYPE>
 void BoundedQueue<TYPE>::popComplete(Node *node, bool isEmpty)
@@ -753,6 +1064,112 @@ void BoundedQueue<TYPE>::popFrontHelper(TYPE *value)
 #endif
 }
 
+template <class TYPE>
+void BoundedQueue<TYPE>::popFrontRangeHelper(TYPE *buffer, int numElements)
+{
+    bool empty = isEmpty();
+
+    // Reserve the whole run of indices at once.  Every node of the run has
+    // completed its "push" operation (the pop semaphore is only posted in a
+    // quiescent state), but nodes marked for reclamation hold no value; one
+    // element beyond the run remains to be popped for each such node.
+
+    const Uint64 numIndices = numElements;
+
+    AtomicOp::addUint64AcqRel(&d_popCount, k_STARTED_INC * numIndices);
+
+    // 'd_popIndex' stores the next location to use (want the original value)
+
+    const Uint64 index = AtomicOp::addUint64NvAcqRel(&d_popIndex, numIndices)
+                                                                  - numIndices;
+
+    int numSkipped = 0;
+    {
+        BoundedQueue_PopRangeExceptionCompleteProctor<BoundedQueue<TYPE> >
+                                             proctor(this, index, numIndices);
+
+        for (Uint64 i = 0; i < numIndices; ++i) {
+            Node& node = d_element_p[(index + i) % d_capacity];
+
+            if (node.reclaim()) {
+                ++numSkipped;
+            }
+            else {
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+                *buffer = bslmf::MovableRefUtil::move(node.d_value.object());
+#else
+                *buffer = node.d_value.object();
+#endif
+                ++buffer;
+            }
+        }
+
+        proctor.release();
+    }
+
+    popRangeComplete(index, numIndices, empty && 0 == numSkipped);
+
+    for (; numSkipped > 0; --numSkipped, ++buffer) {
+        popFrontHelper(buffer);
+    }
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::popRangeComplete(bsls::Types::Uint64 index,
+                                          bsls::Types::Uint64 numIndices,
+                                          bool                isEmpty)
+{
+    for (Uint64 i = 0; i < numIndices; ++i) {
+        Node& node = d_element_p[(index + i) % d_capacity];
+
+        if (false == node.reclaim()) {
+            node.d_value.object().~TYPE();
+        }
+    }
+
+    Uint64 count = AtomicOp::addUint64NvAcqRel(&d_popCount,
+                                               k_FINISHED_INC * numIndices);
+    if (isQuiescentState(count)) {
+        if (AtomicOp::testAndSwapUint64AcqRel(&d_popCount,
+                                              count,
+                                              0) == count) {
+            d_pushSemaphore.post(static_cast<int>(count & k_STARTED_MASK));
+        }
+    }
+
+    if (isEmpty) {
+        AtomicOp::addUintAcqRel(&d_emptyGeneration, 1);
+        if (0 < AtomicOp::getUintAcquire(&d_emptyCount)) {
+            {
+                bslmt::LockGuard<bslmt::Mutex> guard(&d_emptyMutex);
+            }
+            d_emptyCondition.broadcast();
+        }
+    }
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::popRangeExceptionComplete(
+                                             bsls::Types::Uint64 index,
+                                             bsls::Types::Uint64 numIndices)
+{
+    // The elements beyond the run that were to replace the nodes marked for
+    // reclamation are still in the queue; make them available to be popped.
+
+    int numSkipped = 0;
+    for (Uint64 i = 0; i < numIndices; ++i) {
+        if (d_element_p[(index + i) % d_capacity].reclaim()) {
+            ++numSkipped;
+        }
+    }
+
+    if (numSkipped) {
+        d_popSemaphore.post(numSkipped);
+    }
+
+    popRangeComplete(index, numIndices, false);
+}
+
 template <class TYPE>
 void BoundedQueue<TYPE>::pushComplete()
 {
@@ -792,6 +1209,74 @@ void BoundedQueue<TYPE>::pushExceptionComplete()
     }
 }
 
+template <class TYPE>
+template <class FORWARD_ITER>
+FORWARD_ITER BoundedQueue<TYPE>::pushBackRangeHelper(FORWARD_ITER begin,
+                                                     int          numElements)
+{
+    const Uint64 numIndices = numElements;
+
+    AtomicOp::addUint64AcqRel(&d_pushCount, k_STARTED_INC * numIndices);
+
+    // 'd_pushIndex' stores the next location to use (want the original value)
+
+    const Uint64 index = AtomicOp::addUint64NvAcqRel(&d_pushIndex, numIndices)
+                                                                  - numIndices;
+
+    BoundedQueue_PushRangeCompleteGuard<BoundedQueue<TYPE> >
+                                               guard(this, index, numIndices);
+
+    for (Uint64 i = 0; i < numIndices; ++i, ++begin) {
+        Node& node = d_element_p[(index + i) % d_capacity];
+
+        bslalg::ScalarPrimitives::copyConstruct(node.d_value.address(),
+                                                *begin,
+                                                d_allocator_p);
+
+        node.assignReclaim(false);
+
+        guard.increment();
+    }
+
+    return begin;
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::pushRangeComplete(bsls::Types::Uint64 index,
+                                           bsls::Types::Uint64 numIndices,
+                                           bsls::Types::Uint64 numPushed)
+{
+    BSLS_ASSERT(numPushed <= numIndices);
+
+    // Nodes that did not receive a value (due to an exception) are marked for
+    // reclamation and their "push" operations are removed from the started
+    // count, as in 'pushExceptionComplete'.
+
+    for (Uint64 i = numPushed; i < numIndices; ++i) {
+        d_element_p[(index + i) % d_capacity].assignReclaim(true);
+    }
+
+    Uint64 count = AtomicOp::addUint64NvAcqRel(
+                                   &d_pushCount,
+                                   k_FINISHED_INC * numPushed
+                                   - k_STARTED_INC * (numIndices - numPushed));
+
+    int numToPost = static_cast<int>(count & k_STARTED_MASK);
+
+    if (0 != numToPost && isQuiescentState(count)) {
+
+        // The total number of pushed elements is 'count & k_STARTED_MASK'.
+        // Attempt, once, to zero the count and, if successful, post to the pop
+        // semaphore.
+
+        if (AtomicOp::testAndSwapUint64AcqRel(&d_pushCount,
+                                               count,
+                                               0) == count) {
+            d_popSemaphore.post(numToPost);
+        }
+    }
+}
+
 // CREATORS
 template <class TYPE>
 BoundedQueue<TYPE>::BoundedQueue(bsl::size_t       capacity,
@@ -849,6 +1334,69 @@ int BoundedQueue<TYPE>::popFront(TYPE *value)
     return e_SUCCESS;
 }
 
+template <class TYPE>
+int BoundedQueue<TYPE>::popFrontUpTo(bsl::size_t *numPopped,
+                                     TYPE        *buffer,
+                                     bsl::size_t  maxNumElements)
+{
+    BSLS_ASSERT(numPopped);
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 < maxNumElements);
+
+    *numPopped = 0;
+
+    int rv = d_popSemaphore.wait();
+    if (rv) {
+        if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+            return e_DISABLED;                                        // RETURN
+        }
+        return e_FAILED;                                              // RETURN
+    }
+
+    int count = 1 + d_popSemaphore.take(maxToTake(maxNumElements));
+
+    popFrontRangeHelper(buffer, count);
+
+    *numPopped = count;
+
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+template <class FORWARD_ITER>
+int BoundedQueue<TYPE>::pushBackRange(bsl::size_t  *numPushed,
+                                      FORWARD_ITER  begin,
+                                      FORWARD_ITER  end)
+{
+    BSLS_ASSERT(numPushed);
+
+    *numPushed = 0;
+
+    bsl::size_t remaining = bsl::distance(begin, end);
+    if (0 == remaining) {
+        return isPushBackDisabled() ? e_DISABLED : e_SUCCESS;         // RETURN
+    }
+
+    while (0 < remaining) {
+        int rv = d_pushSemaphore.wait();
+        if (rv) {
+            if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+                return e_DISABLED;                                    // RETURN
+            }
+            return e_FAILED;                                          // RETURN
+        }
+
+        int count = 1 + d_pushSemaphore.take(maxToTake(remaining));
+
+        begin = pushBackRangeHelper(begin, count);
+
+        remaining  -= count;
+        *numPushed += count;
+    }
+
+    return e_SUCCESS;
+}
+
 template <class TYPE>
 int BoundedQueue<TYPE>::pushBack(const TYPE& value)
 {
@@ -1056,6 +1604,72 @@ int BoundedQueue<TYPE>::tryPushBack(bslmf::MovableRef<TYPE> value)
 
     pushComplete();
 
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+int BoundedQueue<TYPE>::tryPopFrontUpTo(bsl::size_t *numPopped,
+                                        TYPE        *buffer,
+                                        bsl::size_t  maxNumElements)
+{
+    BSLS_ASSERT(numPopped);
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 < maxNumElements);
+
+    *numPopped = 0;
+
+    int rv = d_popSemaphore.tryWait();
+    if (rv) {
+        if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+            return e_DISABLED;                                        // RETURN
+        }
+        if (bslmt::FastPostSemaphore::e_WOULD_BLOCK == rv) {
+            return e_EMPTY;                                           // RETURN
+        }
+        return e_FAILED;                                              // RETURN
+    }
+
+    int count = 1 + d_popSemaphore.take(maxToTake(maxNumElements));
+
+    popFrontRangeHelper(buffer, count);
+
+    *numPopped = count;
+
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+template <class FORWARD_ITER>
+int BoundedQueue<TYPE>::tryPushBackRange(bsl::size_t  *numPushed,
+                                         FORWARD_ITER  begin,
+                                         FORWARD_ITER  end)
+{
+    BSLS_ASSERT(numPushed);
+
+    *numPushed = 0;
+
+    bsl::size_t numElements = bsl::distance(begin, end);
+    if (0 == numElements) {
+        return isPushBackDisabled() ? e_DISABLED : e_SUCCESS;         // RETURN
+    }
+
+    int rv = d_pushSemaphore.tryWait();
+    if (rv) {
+        if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+            return e_DISABLED;                                        // RETURN
+        }
+        if (bslmt::FastPostSemaphore::e_WOULD_BLOCK == rv) {
+            return e_FULL;                                            // RETURN
+        }
+        return e_FAILED;                                              // RETURN
+    }
+
+    int count = 1 + d_pushSemaphore.take(maxToTake(numElements));
+
+    pushBackRangeHelper(begin, count);
+
+    *numPushed = count;
+
     return e_SUCCESS;
 }
 
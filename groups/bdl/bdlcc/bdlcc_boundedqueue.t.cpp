@@ -22,6 +22,7 @@
 #include <bsls_asserttest.h>
 #include <bsls_atomic.h>
 #include <bsls_atomicoperations.h>
+#include <bsls_stopwatch.h>
 #include <bsls_systemtime.h>
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
@@ -79,12 +80,16 @@ using namespace bsl;
 // [ 2] BoundedQueue(bsl::size_t capacity, bslma::Allocator bA = 0);
 // [ 2] ~BoundedQueue();
 // [ 2] int popFront(TYPE *value);
+// [13] int popFrontUpTo(size_t *numPopped, TYPE *buffer, size_t max);
 // [ 2] int pushBack(const TYPE& value);
 // [ 9] int pushBack(bslmf::MovableRef<TYPE> value);
+// [13] int pushBackRange(size_t *, FORWARD_ITER b, FORWARD_ITER e);
 // [ 2] void removeAll();
 // [ 7] int tryPopFront(TYPE *value);
+// [13] int tryPopFrontUpTo(size_t *numPopped, TYPE *buffer, size_t max);
 // [ 6] int tryPushBack(const TYPE& value);
 // [ 9] int tryPushBack(bslmf::MovableRef<TYPE> value);
+// [13] int tryPushBackRange(size_t *, FORWARD_ITER b, FORWARD_ITER e);
 // [ 5] void disablePopFront();
 // [ 5] void disablePushBack();
 // [ 5] void enablePopFront();
@@ -98,7 +103,7 @@ using namespace bsl;
 // [ 4] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [13] USAGE EXAMPLE
+// [14] USAGE EXAMPLE
 // [ 3] Obj& gg(Obj *object, const char *spec);
 // [ 3] int ggg(Obj *object, const char *spec);
 // [ 2] CONCERN: 0 == e_SUCCESS
@@ -107,6 +112,7 @@ using namespace bsl;
 // [10] CONCERN: template requirements
 // [11] CONCERN: ordering guarantee
 // [12] DRQS 153332608: 'waitUntilEmpty' RACE WITH 'popFront'
+// [-1] BATCHED VS. SINGLE-ELEMENT THROUGHPUT
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -751,6 +757,96 @@ extern "C" void *pushWaitDisable(void *arg)
     return 0;
 }
 
+struct BatchData {
+    // This 'struct' describes the work of one producer or consumer thread in
+    // the batch operation tests and benchmark.
+
+    Obj *d_obj_p;        // queue under test
+    int  d_numElements;  // number of elements to push (or pop)
+    int  d_batchSize;    // number of elements per batch, or 0 for
+                         // 'pushBack'/'popFront'
+};
+
+extern "C" void *batchPush(void *arg)
+    // Push the sequence '0 .. d_numElements - 1' onto the queue described by
+    // the specified 'arg', which must refer to a 'BatchData' object, in
+    // batches of 'd_batchSize' elements using 'pushBackRange' (or one at a
+    // time using 'pushBack' if 'd_batchSize' is 0).
+{
+    BatchData *data = static_cast<BatchData *>(arg);
+    Obj&       mX   = *data->d_obj_p;
+
+    if (0 == data->d_batchSize) {
+        for (int i = 0; i < data->d_numElements; ++i) {
+            ASSERT(e_SUCCESS == mX.pushBack(i));
+        }
+        return 0;                                                     // RETURN
+    }
+
+    bsl::vector<int> batch(data->d_batchSize);
+
+    int next = 0;
+    while (next < data->d_numElements) {
+        int count = data->d_numElements - next;
+        if (count > data->d_batchSize) {
+            count = data->d_batchSize;
+        }
+        for (int i = 0; i < count; ++i) {
+            batch[i] = next + i;
+        }
+
+        bsl::size_t numPushed;
+        ASSERT(e_SUCCESS == mX.pushBackRange(&numPushed,
+                                             batch.begin(),
+                                             batch.begin() + count));
+        ASSERT(static_cast<bsl::size_t>(count) == numPushed);
+
+        next += count;
+    }
+
+    return 0;
+}
+
+extern "C" void *batchPop(void *arg)
+    // Pop 'd_numElements' elements from the queue described by the specified
+    // 'arg', which must refer to a 'BatchData' object, in batches of up to
+    // 'd_batchSize' elements using 'popFrontUpTo' (or one at a time using
+    // 'popFront' if 'd_batchSize' is 0), and verify the elements form the
+    // sequence '0 .. d_numElements - 1'.
+{
+    BatchData *data = static_cast<BatchData *>(arg);
+    Obj&       mX   = *data->d_obj_p;
+
+    int expected = 0;
+
+    if (0 == data->d_batchSize) {
+        while (expected < data->d_numElements) {
+            int value = -1;
+            ASSERT(e_SUCCESS == mX.popFront(&value));
+            ASSERTV(expected, value, expected == value);
+            ++expected;
+        }
+        return 0;                                                     // RETURN
+    }
+
+    bsl::vector<int> batch(data->d_batchSize);
+
+    while (expected < data->d_numElements) {
+        bsl::size_t numPopped = 0;
+        ASSERT(e_SUCCESS == mX.popFrontUpTo(&numPopped,
+                                            &batch[0],
+                                            batch.size()));
+        ASSERT(0 < numPopped && numPopped <= batch.size());
+
+        for (bsl::size_t i = 0; i < numPopped; ++i) {
+            ASSERTV(expected, batch[i], expected == batch[i]);
+            ++expected;
+        }
+    }
+
+    return 0;
+}
+
 // ============================================================================
 //               GENERATOR FUNCTIONS 'gg' AND 'ggg' FOR TESTING
 // ----------------------------------------------------------------------------
@@ -971,7 +1067,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 13: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1009,6 +1105,254 @@ int main(int argc, char *argv[])
 
         bslmt::ThreadUtil::join(watchdogHandle);
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // BATCH OPERATIONS
+        //
+        // Concerns:
+        //: 1 'tryPushBackRange' appends, in order, as many elements of the
+        //:   range as there is capacity for, and reports the number appended.
+        //:
+        //: 2 'tryPopFrontUpTo' removes, in order, up to the requested number
+        //:   of elements, and reports the number removed.
+        //:
+        //: 3 The batch methods return the documented status values when the
+        //:   queue is full, empty, or disabled.
+        //:
+        //: 4 The batch methods interoperate with the single-element methods,
+        //:   including across the wrap-around of the underlying array.
+        //:
+        //: 5 'pushBackRange' enqueues a range larger than the capacity of the
+        //:   queue, blocking until a consumer using 'popFrontUpTo' makes room,
+        //:   and the consumer observes the elements in order.
+        //:
+        //: 6 An exception thrown while copying an element of a range leaves
+        //:   the queue in a valid state: the elements copied before the
+        //:   exception are available, the slots reserved for the others are
+        //:   reclaimed, and no memory is leaked.
+        //
+        // Plan:
+        //: 1 Using a small queue, apply 'tryPushBackRange' to ranges smaller
+        //:   and larger than the available capacity, and verify the number of
+        //:   elements appended and the status.  (C-1, 3)
+        //:
+        //: 2 Apply 'tryPopFrontUpTo' and 'popFrontUpTo' with various maximum
+        //:   counts and verify the values removed and the status.  Interleave
+        //:   single-element operations so that the indices wrap around the
+        //:   array.  (C-2..4)
+        //:
+        //: 3 Disable the queue and verify the status values.  (C-3)
+        //:
+        //: 4 Create a producer thread that pushes a long sequence using
+        //:   'pushBackRange' and a consumer thread that pops it using
+        //:   'popFrontUpTo', and verify the consumer observes the sequence in
+        //:   order.  (C-5)
+        //:
+        //: 5 Using 'AllocExceptionHelper' and an allocation limit, cause the
+        //:   copy of the second element of a range to throw, and verify the
+        //:   subsequent behavior of the queue and the allocator.  (C-6)
+        //
+        // Testing:
+        //   int popFrontUpTo(size_t *numPopped, TYPE *buffer, size_t max);
+        //   int pushBackRange(size_t *, FORWARD_ITER b, FORWARD_ITER e);
+        //   int tryPopFrontUpTo(size_t *numPopped, TYPE *buffer, size_t max);
+        //   int tryPushBackRange(size_t *, FORWARD_ITER b, FORWARD_ITER e);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCH OPERATIONS" << endl
+                          << "================" << endl;
+
+        const int DATA[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        if (verbose) cout << "\nSingle-threaded behavior." << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj mX(4, &sa);  const Obj& X = mX;
+
+            bsl::size_t numPushed = 99;
+            bsl::size_t numPopped = 99;
+            int         buffer[NUM_DATA];
+
+            ASSERT(e_SUCCESS == mX.tryPushBackRange(&numPushed, DATA, DATA));
+            ASSERT(0 == numPushed);
+
+            ASSERT(e_EMPTY == mX.tryPopFrontUpTo(&numPopped, buffer, 3));
+            ASSERT(0 == numPopped);
+
+            ASSERT(e_SUCCESS == mX.tryPushBackRange(&numPushed,
+                                                    DATA,
+                                                    DATA + NUM_DATA));
+            ASSERT(4 == numPushed);
+            ASSERT(4 == X.numElements());
+            ASSERT(X.isFull());
+
+            ASSERT(e_FULL == mX.tryPushBackRange(&numPushed,
+                                                 DATA + 4,
+                                                 DATA + NUM_DATA));
+            ASSERT(0 == numPushed);
+
+            ASSERT(e_SUCCESS == mX.tryPopFrontUpTo(&numPopped, buffer, 3));
+            ASSERT(3 == numPopped);
+            ASSERT(0 == buffer[0] && 1 == buffer[1] && 2 == buffer[2]);
+            ASSERT(1 == X.numElements());
+
+            // The indices now wrap around the array.
+
+            ASSERT(e_SUCCESS == mX.pushBack(4));
+            ASSERT(e_SUCCESS == mX.tryPushBackRange(&numPushed,
+                                                    DATA + 5,
+                                                    DATA + 7));
+            ASSERT(2 == numPushed);
+            ASSERT(4 == X.numElements());
+
+            int value = -1;
+            ASSERT(e_SUCCESS == mX.popFront(&value));
+            ASSERT(3 == value);
+
+            ASSERT(e_SUCCESS == mX.popFrontUpTo(&numPopped,
+                                                buffer,
+                                                NUM_DATA));
+            ASSERT(3 == numPopped);
+            ASSERT(4 == buffer[0] && 5 == buffer[1] && 6 == buffer[2]);
+            ASSERT(X.isEmpty());
+
+            for (int i = 0; i < 3 * NUM_DATA; ++i) {
+                ASSERT(e_SUCCESS == mX.tryPushBackRange(&numPushed,
+                                                        DATA + i % 2,
+                                                        DATA + 3));
+                ASSERT(3 - i % 2 == static_cast<int>(numPushed));
+
+                ASSERT(e_SUCCESS == mX.tryPopFrontUpTo(&numPopped,
+                                                       buffer,
+                                                       NUM_DATA));
+                ASSERTV(i, numPopped, numPushed == numPopped);
+                ASSERTV(i, buffer[0], i % 2 == buffer[0]);
+                ASSERTV(i, buffer[numPopped - 1], 2 == buffer[numPopped - 1]);
+            }
+
+            ASSERT(e_SUCCESS == mX.tryPushBackRange(&numPushed,
+                                                    DATA,
+                                                    DATA + 2));
+
+            mX.disablePushBack();
+
+            ASSERT(e_DISABLED == mX.tryPushBackRange(&numPushed,
+                                                     DATA,
+                                                     DATA + 1));
+            ASSERT(0 == numPushed);
+            ASSERT(e_DISABLED == mX.tryPushBackRange(&numPushed, DATA, DATA));
+            ASSERT(e_DISABLED == mX.pushBackRange(&numPushed,
+                                                  DATA,
+                                                  DATA + 1));
+            ASSERT(0 == numPushed);
+
+            mX.disablePopFront();
+
+            ASSERT(e_DISABLED == mX.tryPopFrontUpTo(&numPopped, buffer, 1));
+            ASSERT(0 == numPopped);
+            ASSERT(e_DISABLED == mX.popFrontUpTo(&numPopped, buffer, 1));
+            ASSERT(0 == numPopped);
+            ASSERT(2 == X.numElements());
+
+            mX.enablePopFront();
+            mX.enablePushBack();
+
+            ASSERT(e_SUCCESS == mX.popFrontUpTo(&numPopped, buffer, 1));
+            ASSERT(1 == numPopped);
+            ASSERT(0 == buffer[0]);
+            ASSERT(1 == X.numElements());
+
+            ASSERT(0 == defaultAllocator.numAllocations());
+        }
+
+        if (verbose) cout << "\nRange larger than the capacity." << endl;
+        {
+            Obj mX(16);
+
+            const int k_NUM_ELEMENTS = 10000;
+
+            BatchData pushData = { &mX, k_NUM_ELEMENTS, 100 };
+            BatchData popData  = { &mX, k_NUM_ELEMENTS, 7   };
+
+            bslmt::ThreadUtil::Handle pushHandle;
+            bslmt::ThreadUtil::Handle popHandle;
+
+            bslmt::ThreadUtil::create(&pushHandle, batchPush, &pushData);
+            bslmt::ThreadUtil::create(&popHandle,  batchPop,  &popData);
+
+            bslmt::ThreadUtil::join(pushHandle);
+            bslmt::ThreadUtil::join(popHandle);
+
+            ASSERT(mX.isEmpty());
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) cout << "\nException while copying a range." << endl;
+        {
+            // white-box test for when the element copy throws
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            bdlcc::BoundedQueue<AllocExceptionHelper>        mX(4, &sa);
+            const bdlcc::BoundedQueue<AllocExceptionHelper>& X = mX;
+
+            {
+                AllocExceptionHelper value(&sa);
+
+                bsl::vector<AllocExceptionHelper> range(3, value, &sa);
+                bsl::vector<AllocExceptionHelper> buffer(3, value, &sa);
+
+                bsl::size_t numPushed = 99;
+                bsl::size_t numPopped = 99;
+
+                int numException = 0;
+
+                sa.setAllocationLimit(1);
+                try {
+                    mX.tryPushBackRange(&numPushed,
+                                        range.begin(),
+                                        range.end());
+                } catch (BloombergLP::bslma::TestAllocatorException& e) {
+                    ++numException;
+                }
+                sa.setAllocationLimit(-1);
+
+                ASSERT(1 == numException);
+                ASSERT(1 == X.numElements());
+
+                // Two slots are held by reclaimed nodes until consumers skip
+                // them.
+
+                ASSERT(e_SUCCESS == mX.tryPushBackRange(&numPushed,
+                                                        range.begin(),
+                                                        range.end()));
+                ASSERT(1 == numPushed);
+                ASSERT(2 == X.numElements());
+
+                ASSERT(e_SUCCESS == mX.popFrontUpTo(&numPopped,
+                                                    &buffer[0],
+                                                    3));
+                ASSERT(2 == numPopped);
+                ASSERT(X.isEmpty());
+
+                ASSERT(e_SUCCESS == mX.tryPushBackRange(&numPushed,
+                                                        range.begin(),
+                                                        range.end()));
+                ASSERT(3 == numPushed);
+
+                ASSERT(e_SUCCESS == mX.tryPopFrontUpTo(&numPopped,
+                                                       &buffer[0],
+                                                       3));
+                ASSERT(3 == numPopped);
+                ASSERT(X.isEmpty());
+            }
+            ASSERT(1 == sa.numBlocksInUse());
+        }
+#endif
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // DRQS 153332608: 'waitUntilEmpty' RACE WITH 'popFront'
@@ -2900,6 +3244,58 @@ int main(int argc, char *argv[])
         ASSERT(3 == v);
         ASSERT(0 == X.numElements());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // BATCHED VS. SINGLE-ELEMENT THROUGHPUT
+        //
+        // Concerns:
+        //: 1 Transferring elements with 'pushBackRange' and 'popFrontUpTo' is
+        //:   faster than transferring them one at a time.
+        //
+        // Plan:
+        //: 1 For several batch sizes, time one producer and one consumer
+        //:   thread transferring a fixed number of elements through a queue,
+        //:   and report the elapsed time.  A batch size of 0 denotes
+        //:   'pushBack' and 'popFront'.  (C-1)
+        //
+        // Testing:
+        //   BATCHED VS. SINGLE-ELEMENT THROUGHPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCHED VS. SINGLE-ELEMENT THROUGHPUT" << endl
+                          << "=====================================" << endl;
+
+        const int k_NUM_ELEMENTS = argc > 2 ? atoi(argv[2]) : 4000000;
+
+        const int BATCH_SIZE[] = { 0, 1, 8, 64, 256 };
+        const int NUM_BATCH_SIZE =
+                      static_cast<int>(sizeof BATCH_SIZE / sizeof *BATCH_SIZE);
+
+        for (int ti = 0; ti < NUM_BATCH_SIZE; ++ti) {
+            Obj mX(1024);
+
+            BatchData data = { &mX, k_NUM_ELEMENTS, BATCH_SIZE[ti] };
+
+            bsls::Stopwatch timer;
+            timer.start();
+
+            bslmt::ThreadUtil::Handle pushHandle;
+            bslmt::ThreadUtil::Handle popHandle;
+
+            bslmt::ThreadUtil::create(&pushHandle, batchPush, &data);
+            bslmt::ThreadUtil::create(&popHandle,  batchPop,  &data);
+
+            bslmt::ThreadUtil::join(pushHandle);
+            bslmt::ThreadUtil::join(popHandle);
+
+            timer.stop();
+
+            cout << "batch size " << BATCH_SIZE[ti] << ": "
+                 << k_NUM_ELEMENTS << " elements in "
+                 << timer.elapsedTime() << "s" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -27,11 +27,22 @@ BSLS_IDENT("$Id: $")
 // fixed maximum size is obtained by setting the high and low watermarks to the
 // same value.
 //
-// Two eviction policies are supported: LRU (Least Recently Used) and FIFO
-// (First In, First Out).  With LRU, the item that has *not* been accessed for
-// the longest period of time will be evicted first.  With FIFO, the eviction
-// order is based on the order of insertion, with the earliest inserted item
-// being evicted first.
+// Three eviction policies are supported: LRU (Least Recently Used), FIFO
+// (First In, First Out), and CLOCK (an approximation of LRU).  With LRU, the
+// item that has *not* been accessed for the longest period of time will be
+// evicted first.  With FIFO, the eviction order is based on the order of
+// insertion, with the earliest inserted item being evicted first.
+//
+// With CLOCK (also known as "second chance"), each item has a reference bit
+// that is set whenever the item is accessed.  When an item must be evicted, a
+// "clock hand" sweeps over the items in the (unspecified) iteration order of
+// the underlying hash map: an item whose reference bit is set has its bit
+// cleared and is skipped, and the first item whose reference bit is clear is
+// evicted.  Recently accessed items are therefore unlikely to be evicted,
+// which gives hit rates close to those of LRU for most workloads.  Unlike LRU,
+// accessing an item only sets its reference bit, which does not require
+// exclusive access to the cache, and no eviction queue is maintained, which
+// saves a list node allocation per item.
 //
 ///Thread Safety
 ///-------------
@@ -49,10 +60,12 @@ BSLS_IDENT("$Id: $")
 // All of the modifier methods of the cache potentially requires a write lock.
 // Of particular note is the 'tryGetValue' method, which requires a writer lock
 // only if the eviction queue needs to be modified.  This means 'tryGetValue'
-// requires only a read lock if the eviction policy is set to FIFO or the
-// argument 'modifyEvictionQueue' is set to 'false'.  For limited cases where
-// contention is likely, temporarily setting 'modifyEvictionQueue' to 'false'
-// might be of value.
+// requires only a read lock if the eviction policy is set to FIFO or CLOCK, or
+// the argument 'modifyEvictionQueue' is set to 'false'.  For limited cases
+// where contention is likely, temporarily setting 'modifyEvictionQueue' to
+// 'false' might be of value.  For read-mostly workloads where LRU-like
+// eviction is desired, the CLOCK eviction policy avoids the write lock on
+// every hit altogether.
 //
 // The 'visit' method acquires a read lock and calls the supplied visitor
 // function for every item in the cache, or until the visitor function returns
@@ -89,6 +102,7 @@ BSLS_IDENT("$Id: $")
 // | tryGetValue                                        | O[1]               |
 // +----------------------------------------------------+--------------------+
 // | popFront                                           | O[1]               |
+// |                                                    | (CLOCK: amortized) |
 // +----------------------------------------------------+--------------------+
 // | erase                                              | O[1]               |
 // +----------------------------------------------------+--------------------+
@@ -308,6 +322,7 @@ BSLS_IDENT("$Id: $")
 #include <bslmt_writelockguard.h>
 
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
 #include <bsls_review.h>
 
 #include <bsl_memory.h>
@@ -329,11 +344,82 @@ struct CacheEvictionPolicy {
     enum Enum {
         // Enumeration of supported cache eviction policies.
 
-        e_LRU,  // Least Recently Used
-        e_FIFO  // First In, First Out
+        e_LRU,   // Least Recently Used
+        e_FIFO,  // First In, First Out
+        e_CLOCK  // CLOCK (second chance) approximation of LRU
     };
 };
 
+                         // ========================
+                         // class Cache_ReferenceBit
+                         // ========================
+
+class Cache_ReferenceBit {
+    // This class implements the reference bit of an item in a cache using the
+    // CLOCK eviction policy.  The bit can be set through a 'const' reference,
+    // i.e., by a thread holding only a read lock on the cache, and is copied
+    // by value, so that it can be part of the value type of a hash map.
+
+    // DATA
+    mutable bsls::AtomicBool d_bit;  // 'true' if the item was referenced
+
+  public:
+    // CREATORS
+    Cache_ReferenceBit();
+        // Create a cleared reference bit.
+
+    Cache_ReferenceBit(const Cache_ReferenceBit& original);
+        // Create a reference bit having the value of the specified
+        // 'original'.
+
+    //! ~Cache_ReferenceBit() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    Cache_ReferenceBit& operator=(const Cache_ReferenceBit& rhs);
+        // Assign to this object the value of the specified 'rhs', and return
+        // a reference providing modifiable access to this object.
+
+    bool testAndClear();
+        // Clear this bit and return its previous value.  The behavior is
+        // undefined unless the calling thread has exclusive access to the
+        // cache holding this bit.
+
+    // ACCESSORS
+    void set() const;
+        // Set this bit.  Note that nothing is written if the bit is already
+        // set, so that threads concurrently accessing a popular item do not
+        // contend for its cache line.
+};
+
+                           // ====================
+                           // class Cache_MapValue
+                           // ====================
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+struct Cache_MapValue {
+    // This 'struct' provides the value type of the hash map of a cache: the
+    // pointer to the cached value, the position of its key in the eviction
+    // queue (LRU and FIFO policies only), and its reference bit (CLOCK policy
+    // only).
+
+    // DATA
+    VALUE_PTR          d_valuePtr;    // pointer to the cached value
+
+    QUEUE_ITERATOR     d_queueIt;     // position of the key in the eviction
+                                      // queue (unused with CLOCK)
+
+    Cache_ReferenceBit d_referenced;  // reference bit (unused with LRU and
+                                      // FIFO)
+
+    // CREATORS
+    Cache_MapValue(const VALUE_PTR& valuePtr, const QUEUE_ITERATOR& queueIt);
+    Cache_MapValue(bslmf::MovableRef<VALUE_PTR> valuePtr,
+                   const QUEUE_ITERATOR&        queueIt);
+        // Create a map value holding the specified 'valuePtr' and 'queueIt',
+        // having a cleared reference bit.
+};
+
 template <class KEY>
 class Cache_QueueProctor {
     // This class implements a proctor that, on destruction, restores the queue
@@ -398,7 +484,8 @@ class Cache {
     typedef bsl::list<KEY>                                        QueueType;
         // Eviction queue type.
 
-    typedef bsl::pair<ValuePtrType, typename QueueType::iterator> MapValue;
+    typedef Cache_MapValue<ValuePtrType, typename QueueType::iterator>
+                                                                  MapValue;
         // Value type of the hash map.
 
     typedef bsl::unordered_map<KEY, MapValue, HASH, EQUAL>        MapType;
@@ -421,6 +508,11 @@ class Cache {
                                                        // first item to be
                                                        // evicted is at the
                                                        // front of the queue
+                                                       // (unused with CLOCK)
+
+    typename MapType::iterator d_clockHand;            // next item examined
+                                                       // by the CLOCK
+                                                       // eviction sweep
 
     CacheEvictionPolicy::Enum  d_evictionPolicy;       // eviction policy
 
@@ -447,6 +539,13 @@ class Cache {
         // 'size() < lowWatermark()' beginning from the front of the eviction
         // queue.  Invoke the post-eviction callback for each item evicted.
 
+    typename MapType::iterator evictionCandidate();
+        // Return an iterator to the item of this cache to be evicted next.
+        // With the CLOCK eviction policy, advance the clock hand, clearing the
+        // reference bits of the items passed over, until an item whose
+        // reference bit is clear is found.  The behavior is undefined unless
+        // this cache is not empty.
+
     void evictItem(const typename MapType::iterator& mapIt);
         // Evict the item at the specified 'mapIt' and invoke the post-eviction
         // callback for that item.
@@ -591,7 +690,9 @@ class Cache {
         // Load, into the specified 'value', the value associated with the
         // specified 'key' in this cache.  If the optionally specified
         // 'modifyEvictionQueue' is 'true' and the eviction policy is LRU, then
-        // move the cached item to the back of the eviction queue.  Return 0 on
+        // move the cached item to the back of the eviction queue; if
+        // 'modifyEvictionQueue' is 'true' and the eviction policy is CLOCK,
+        // then set the reference bit of the cached item.  Return 0 on
         // success, and 1 if 'key' does not exist in this cache.  Note that a
         // write lock is acquired only if this queue is modified.
 
@@ -622,7 +723,9 @@ class Cache {
     template <class VISITOR>
     void visit(VISITOR& visitor) const;
         // Call the specified 'visitor' for every item stored in this cache in
-        // the order of the eviction queue until 'visitor' returns 'false'.
+        // the order of the eviction queue (with the CLOCK eviction policy, in
+        // the order of the clock sweep, starting from the clock hand) until
+        // 'visitor' returns 'false'.
         // The 'VISITOR' type must be a callable object that can be invoked in
         // the same way as the function 'bool (const KEY&, const VALUE&)'
 };
@@ -664,6 +767,78 @@ class Cache_TestUtil {
 //                        INLINE FUNCTION DEFINITIONS
 // ============================================================================
 
+                         // ------------------------
+                         // class Cache_ReferenceBit
+                         // ------------------------
+
+// CREATORS
+inline
+Cache_ReferenceBit::Cache_ReferenceBit()
+: d_bit(false)
+{
+}
+
+inline
+Cache_ReferenceBit::Cache_ReferenceBit(const Cache_ReferenceBit& original)
+: d_bit(original.d_bit.loadRelaxed())
+{
+}
+
+// MANIPULATORS
+inline
+Cache_ReferenceBit& Cache_ReferenceBit::operator=(
+                                                 const Cache_ReferenceBit& rhs)
+{
+    d_bit.storeRelaxed(rhs.d_bit.loadRelaxed());
+    return *this;
+}
+
+inline
+bool Cache_ReferenceBit::testAndClear()
+{
+    if (d_bit.loadRelaxed()) {
+        d_bit.storeRelaxed(false);
+        return true;                                                  // RETURN
+    }
+    return false;
+}
+
+// ACCESSORS
+inline
+void Cache_ReferenceBit::set() const
+{
+    if (!d_bit.loadRelaxed()) {
+        d_bit.storeRelaxed(true);
+    }
+}
+
+                           // --------------------
+                           // class Cache_MapValue
+                           // --------------------
+
+// CREATORS
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                              const VALUE_PTR&      valuePtr,
+                                              const QUEUE_ITERATOR& queueIt)
+: d_valuePtr(valuePtr)
+, d_queueIt(queueIt)
+, d_referenced()
+{
+}
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                      bslmf::MovableRef<VALUE_PTR> valuePtr,
+                                      const QUEUE_ITERATOR&        queueIt)
+: d_valuePtr(bslmf::MovableRefUtil::move(valuePtr))
+, d_queueIt(queueIt)
+, d_referenced()
+{
+}
+
                         // ------------------------
                         // class Cache_QueueProctor
                         // ------------------------
@@ -714,6 +889,7 @@ Cache<KEY, VALUE, HASH, EQUAL>::Cache(bslma::Allocator *basicAllocator)
 : d_allocator_p(bslma::Default::allocator(basicAllocator))
 , d_map(d_allocator_p)
 , d_queue(d_allocator_p)
+, d_clockHand(d_map.end())
 , d_evictionPolicy(CacheEvictionPolicy::e_LRU)
 , d_lowWatermark(bsl::numeric_limits<bsl::size_t>::max())
 , d_highWatermark(bsl::numeric_limits<bsl::size_t>::max())
@@ -730,6 +906,7 @@ Cache<KEY, VALUE, HASH, EQUAL>::Cache(
 : d_allocator_p(bslma::Default::allocator(basicAllocator))
 , d_map(d_allocator_p)
 , d_queue(d_allocator_p)
+, d_clockHand(d_map.end())
 , d_evictionPolicy(evictionPolicy)
 , d_lowWatermark(lowWatermark)
 , d_highWatermark(highWatermark)
@@ -751,6 +928,7 @@ Cache<KEY, VALUE, HASH, EQUAL>::Cache(
 : d_allocator_p(bslma::Default::allocator(basicAllocator))
 , d_map(0, hashFunction, equalFunction, d_allocator_p)
 , d_queue(d_allocator_p)
+, d_clockHand(d_map.end())
 , d_evictionPolicy(evictionPolicy)
 , d_lowWatermark(lowWatermark)
 , d_highWatermark(highWatermark)
@@ -770,9 +948,33 @@ void Cache<KEY, VALUE, HASH, EQUAL>::enforceHighWatermark()
     }
 
     while (d_map.size() >= d_lowWatermark && d_map.size() > 0) {
+        evictItem(evictionCandidate());
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+typename Cache<KEY, VALUE, HASH, EQUAL>::MapType::iterator
+Cache<KEY, VALUE, HASH, EQUAL>::evictionCandidate()
+{
+    BSLS_ASSERT(!d_map.empty());
+
+    if (CacheEvictionPolicy::e_CLOCK != d_evictionPolicy) {
         const typename MapType::iterator mapIt = d_map.find(d_queue.front());
         BSLS_ASSERT(mapIt != d_map.end());
-        evictItem(mapIt);
+        return mapIt;                                                 // RETURN
+    }
+
+    // Every item passed over has its reference bit cleared, so the sweep
+    // terminates within one revolution of the clock hand.
+
+    for (;;) {
+        if (d_clockHand == d_map.end()) {
+            d_clockHand = d_map.begin();
+        }
+        if (!d_clockHand->second.d_referenced.testAndClear()) {
+            return d_clockHand;                                       // RETURN
+        }
+        ++d_clockHand;
     }
 }
 
@@ -780,9 +982,16 @@ template <class KEY, class VALUE, class HASH, class EQUAL>
 void Cache<KEY, VALUE, HASH, EQUAL>::evictItem(
                                        const typename MapType::iterator& mapIt)
 {
-    ValuePtrType value = mapIt->second.first;
+    ValuePtrType value = mapIt->second.d_valuePtr;
 
-    d_queue.erase(mapIt->second.second);
+    if (CacheEvictionPolicy::e_CLOCK == d_evictionPolicy) {
+        if (d_clockHand == mapIt) {
+            ++d_clockHand;
+        }
+    }
+    else {
+        d_queue.erase(mapIt->second.d_queueIt);
+    }
     d_map.erase(mapIt);
 
     if (d_postEvictionCallback) {
@@ -811,13 +1020,18 @@ bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
     typename MapType::iterator mapIt = d_map.find(key);
     if (mapIt != d_map.end()) {
         if (k_RVALUE_ASSIGN && moveValuePtr) {
-            mapIt->second.first = bslmf::MovableRefUtil::move(valuePtr);
+            mapIt->second.d_valuePtr = bslmf::MovableRefUtil::move(valuePtr);
         }
         else {
-            mapIt->second.first = valuePtr;
+            mapIt->second.d_valuePtr = valuePtr;
+        }
+
+        if (CacheEvictionPolicy::e_CLOCK == d_evictionPolicy) {
+            mapIt->second.d_referenced.set();
+            return false;                                             // RETURN
         }
 
-        typename QueueType::iterator queueIt = mapIt->second.second;
+        typename QueueType::iterator queueIt = mapIt->second.d_queueIt;
 
         // Move 'queueIt' to the back of 'd_queue'.
 
@@ -826,26 +1040,31 @@ bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
         return false;                                                 // RETURN
     }
     else {
+        const bool useQueue = CacheEvictionPolicy::e_CLOCK !=
+                                                              d_evictionPolicy;
+
         Cache_QueueProctor<KEY>      proctor(&d_queue);
-        d_queue.push_back(key);
         typename QueueType::iterator queueIt = d_queue.end();
-        --queueIt;
+        if (useQueue) {
+            d_queue.push_back(key);
+            queueIt = d_queue.end();
+            --queueIt;
+        }
 
         bsls::ObjectBuffer<MapValue> mapValueFootprint;
         MapValue *mapValue_p = mapValueFootprint.address();
 
         if (moveValuePtr) {
             new (mapValue_p) MapValue(bslmf::MovableRefUtil::move(valuePtr),
-                                      queueIt,
-                                      d_allocator_p);
+                                      queueIt);
         }
         else {
-            new (mapValue_p) MapValue(valuePtr,
-                                      queueIt,
-                                      d_allocator_p);
+            new (mapValue_p) MapValue(valuePtr, queueIt);
         }
         bslma::DestructorGuard<MapValue> mapValueGuard(mapValue_p);
 
+        const bsl::size_t numBuckets = d_map.bucket_count();
+
         if (moveKey) {
             d_map.emplace(bslmf::MovableRefUtil::move(key),
                           bslmf::MovableRefUtil::move(*mapValue_p));
@@ -855,6 +1074,13 @@ bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
                           bslmf::MovableRefUtil::move(*mapValue_p));
         }
 
+        if (!useQueue && numBuckets != d_map.bucket_count()) {
+            // Rehashing invalidates all iterators into the map, including the
+            // clock hand.
+
+            d_clockHand = d_map.begin();
+        }
+
         proctor.release();
 
         return true;                                                  // RETURN
@@ -909,6 +1135,7 @@ void Cache<KEY, VALUE, HASH, EQUAL>::clear()
     bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
     d_map.clear();
     d_queue.clear();
+    d_clockHand = d_map.end();
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
@@ -1072,9 +1299,7 @@ int Cache<KEY, VALUE, HASH, EQUAL>::popFront()
     bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
 
     if (d_map.size() > 0) {
-        const typename MapType::iterator mapIt = d_map.find(d_queue.front());
-        BSLS_ASSERT(mapIt != d_map.end());
-        evictItem(mapIt);
+        evictItem(evictionCandidate());
         return 0;                                                     // RETURN
     }
 
@@ -1115,16 +1340,20 @@ int Cache<KEY, VALUE, HASH, EQUAL>::tryGetValue(
         return 1;                                                     // RETURN
     }
 
-    *value = mapIt->second.first;
+    *value = mapIt->second.d_valuePtr;
 
     if (writeLock) {
-        typename QueueType::iterator queueIt = mapIt->second.second;
+        typename QueueType::iterator queueIt = mapIt->second.d_queueIt;
         typename QueueType::iterator last = d_queue.end();
         --last;
         if (last != queueIt) {
             d_queue.splice(d_queue.end(), d_queue, queueIt);
         }
     }
+    else if (modifyEvictionQueue &&
+             CacheEvictionPolicy::e_CLOCK == d_evictionPolicy) {
+        mapIt->second.d_referenced.set();
+    }
 
     return 0;
 }
@@ -1180,13 +1409,29 @@ void Cache<KEY, VALUE, HASH, EQUAL>::visit(VISITOR& visitor) const
 {
     bslmt::ReadLockGuard<LockType> guard(&d_rwlock);
 
+    if (CacheEvictionPolicy::e_CLOCK == d_evictionPolicy) {
+        // Visit the items starting from the clock hand, which approximates
+        // the eviction order.
+
+        typename MapType::const_iterator mapIt = d_clockHand;
+        for (bsl::size_t i = 0; i < d_map.size(); ++i, ++mapIt) {
+            if (mapIt == d_map.end()) {
+                mapIt = d_map.begin();
+            }
+            if (!visitor(mapIt->first, *mapIt->second.d_valuePtr)) {
+                break;
+            }
+        }
+        return;                                                       // RETURN
+    }
+
     for (typename QueueType::const_iterator queueIt = d_queue.begin();
          queueIt != d_queue.end(); ++queueIt) {
 
         const KEY&                             key = *queueIt;
         const typename MapType::const_iterator mapIt = d_map.find(key);
         BSLS_ASSERT(mapIt != d_map.end());
-        const ValuePtrType& valuePtr = mapIt->second.first;
+        const ValuePtrType& valuePtr = mapIt->second.d_valuePtr;
 
         if (!visitor(key, *valuePtr)) {
             break;
@@ -128,7 +128,8 @@ using namespace bsl;
 // [15] THREAD SAFETY
 // [16] LOCKING TEST UTIL
 // [17] LOCKING
-// [18] USAGE EXAMPLE
+// [19] CLOCK EVICTION POLICY
+// [20] USAGE EXAMPLE
 // [-1] INSERT PERFORMANCE
 // [-2] INSERT BULK PERFORMANCE
 // [-3] READ PERFORMANCE
@@ -1624,6 +1625,31 @@ void testLocking()
 }
 }  // close namespace testLock
 
+namespace clockTest {
+
+int numEvicted;  // number of items evicted or erased
+
+void countEviction(const bsl::shared_ptr<bsl::string>&)
+    // Increment 'numEvicted'.
+{
+    ++numEvicted;
+}
+
+struct CountingVisitor {
+    // Visitor counting the items it is invoked on.
+
+    bsl::size_t d_count;  // number of items visited
+
+    bool operator()(int, const bsl::string&)
+        // Increment 'd_count' and return 'true'.
+    {
+        ++d_count;
+        return true;
+    }
+};
+
+}  // close namespace clockTest
+
 namespace threaded {
 
 
@@ -4163,7 +4189,7 @@ int main(int argc, char *argv[])
 
     // BDE_VERIFY pragma: -TP17 These are defined in the various test functions
     switch (test) { case 0:
-      case 19: {
+      case 20: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -4184,6 +4210,161 @@ int main(int argc, char *argv[])
         usageExample1::example1();
         usageExample2::example2();
       } break;
+      case 19: {
+        // --------------------------------------------------------------------
+        // CLOCK EVICTION POLICY
+        //
+        // Concerns:
+        //: 1 With the CLOCK eviction policy, items accessed since the last
+        //:   sweep of the clock hand are given a second chance, and are not
+        //:   evicted as long as unreferenced items remain.
+        //:
+        //: 2 'tryGetValue' requires only a read lock with the CLOCK policy.
+        //:
+        //: 3 No eviction queue node is allocated per item.
+        //:
+        //: 4 'popFront', 'erase', and 'visit' behave correctly, and the clock
+        //:   hand remains valid, when items are removed and when the hash map
+        //:   is rehashed.
+        //
+        // Plan:
+        //: 1 Fill a cache to just below its high watermark, reference half of
+        //:   the items with 'tryGetValue', and insert one more item; verify
+        //:   that exactly one unreferenced item was evicted.  (C-1)
+        //:
+        //: 2 Hold a read lock using 'Cache_TestUtil' and call 'tryGetValue';
+        //:   the call would deadlock if a write lock was required.  (C-2)
+        //:
+        //: 3 Compare the memory used by a CLOCK and a FIFO cache holding the
+        //:   same items.  (C-3)
+        //:
+        //: 4 Insert many items into a small cache, referencing some of them
+        //:   and erasing others along the way, and verify the size, the
+        //:   number of evicted items, and the number of visited items.  Empty
+        //:   the cache with 'popFront'.  (C-4)
+        //
+        // Testing:
+        //   CLOCK EVICTION POLICY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CLOCK EVICTION POLICY" << endl
+                          << "=====================" << endl;
+
+        typedef bdlcc::Cache<int, bsl::string>          Obj;
+        typedef bdlcc::Cache_TestUtil<int, bsl::string> Util;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\nSecond chance for referenced items." << endl;
+        {
+            const int N = 16;
+
+            Obj mX(bdlcc::CacheEvictionPolicy::e_CLOCK, N, N, &ta);
+            const Obj& X = mX;
+
+            ASSERT(bdlcc::CacheEvictionPolicy::e_CLOCK == X.evictionPolicy());
+
+            for (int i = 0; i < N; ++i) {
+                mX.insert(i, "value");
+            }
+            ASSERT(N == static_cast<int>(X.size()));
+
+            bsl::shared_ptr<bsl::string> value;
+            for (int i = 0; i < N; i += 2) {
+                ASSERTV(i, 0 == mX.tryGetValue(&value, i));
+            }
+
+            mX.insert(N, "value");
+            ASSERTV(X.size(), N == static_cast<int>(X.size()));
+
+            int numEvicted = 0;
+            for (int i = 0; i < N; ++i) {
+                if (1 == mX.tryGetValue(&value, i, false)) {
+                    ASSERTV(i, 1 == i % 2);
+                    ++numEvicted;
+                }
+            }
+            ASSERTV(numEvicted, 1 == numEvicted);
+            ASSERT(0 == mX.tryGetValue(&value, N, false));
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\n'tryGetValue' takes a read lock." << endl;
+        {
+            Obj mX(bdlcc::CacheEvictionPolicy::e_CLOCK, 10, 10, &ta);
+            mX.insert(1, "one");
+
+            Util util(mX);
+            util.lockRead();
+
+            bsl::shared_ptr<bsl::string> value;
+            ASSERT(0 == mX.tryGetValue(&value, 1));
+            ASSERT("one" == *value);
+
+            util.unlock();
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\nNo eviction queue nodes." << endl;
+        {
+            bslma::TestAllocator fa("fifo", veryVeryVeryVerbose);
+            bslma::TestAllocator ca("clock", veryVeryVeryVerbose);
+
+            Obj mF(bdlcc::CacheEvictionPolicy::e_FIFO,  1000, 1000, &fa);
+            Obj mC(bdlcc::CacheEvictionPolicy::e_CLOCK, 1000, 1000, &ca);
+
+            for (int i = 0; i < 100; ++i) {
+                mF.insert(i, "value");
+                mC.insert(i, "value");
+            }
+            ASSERTV(fa.numBlocksInUse(), ca.numBlocksInUse(),
+                    fa.numBlocksInUse() >= ca.numBlocksInUse() + 100);
+        }
+
+        if (verbose) cout << "\nRemoval, rehash, and 'visit'." << endl;
+        {
+            Obj mX(bdlcc::CacheEvictionPolicy::e_CLOCK, 8, 12, &ta);
+            const Obj& X = mX;
+
+            clockTest::numEvicted = 0;
+            mX.setPostEvictionCallback(&clockTest::countEviction);
+
+            bsl::shared_ptr<bsl::string> value;
+            int                          numErased = 0;
+            for (int i = 0; i < 1000; ++i) {
+                mX.insert(i, "value");
+                ASSERTV(i, X.size() <= 12);
+                if (i % 3) {
+                    mX.tryGetValue(&value, i - 1);
+                }
+                if (0 == i % 7) {
+                    numErased += 0 == mX.erase(i - 2);
+                }
+
+                clockTest::CountingVisitor visitor = { 0 };
+                X.visit(visitor);
+                ASSERTV(i, visitor.d_count, X.size() == visitor.d_count);
+            }
+            ASSERTV(clockTest::numEvicted, numErased, X.size(),
+                    1000 == clockTest::numEvicted + X.size());
+
+            const int SIZE = static_cast<int>(X.size());
+            for (int i = 0; i < SIZE; ++i) {
+                ASSERTV(i, 0 == mX.popFront());
+            }
+            ASSERT(1 == mX.popFront());
+            ASSERT(0 == X.size());
+
+            mX.insert(1, "one");
+            ASSERT(0 == mX.tryGetValue(&value, 1));
+
+            mX.clear();
+            ASSERT(0 == X.size());
+            ASSERT(1 == mX.popFront());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
       // BDE_VERIFY pragma: -TP05 Defined in the various test functions
       case 18: {
         // --------------------------------------------------------------------
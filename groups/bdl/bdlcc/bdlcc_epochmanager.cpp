@@ -0,0 +1,546 @@
+// bdlcc_epochmanager.cpp                                             -*-C++-*-
+#include <bdlcc_epochmanager.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_epochmanager_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+#include <bslma_newdeleteallocator.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_once.h>
+#include <bslmt_qlock.h>
+#include <bslmt_threadlocalvariable.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#include <bsl_new.h>
+
+// IMPLEMENTATION NOTES: Each thread that enters a critical section of an epoch
+// manager is assigned a small integer index, unique among the threads that are
+// alive, which identifies its slot in every epoch manager.  Indices are
+// allocated from a process-wide free list on first use and returned to it by
+// the destructor of a thread-specific storage key when the thread exits, so
+// that the number of slots scanned by 'tryAdvance' is bounded by the maximum
+// number of threads simultaneously alive (rather than by the number of threads
+// ever created).  The index of the calling thread is cached in a thread-local
+// variable, where available, to avoid a call to
+// 'bslmt::ThreadUtil::getSpecific' on each 'enter' and 'leave'.  The free
+// list grows with the number of indices ever assigned, which is the maximum
+// number of threads simultaneously alive, and is never deallocated.
+//
+// The slots of a manager are allocated by chunks of 'k_SLOTS_PER_CHUNK' on
+// demand, and the addresses of the chunks are held in a directory that is
+// replaced by one twice as large, under the mutex of the manager, when a
+// thread having an index beyond its capacity enters a critical section.  A
+// thread that loaded a superseded directory may find a chunk missing from it,
+// in which case it takes the mutex and finds the chunk in the current
+// directory; superseded directories are therefore kept until the manager is
+// destroyed (which at most doubles the memory used by the directories).
+//
+// Deleters are invoked after the mutex of the manager is released: 'reclaim'
+// and 'synchronize' move the reclaimable prefix of the list of retired objects
+// to a local list under the mutex, and pass the objects of the local list to
+// their deleters without it, so that a deleter may retire further objects.
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                          // ========================
+                          // struct EpochManager_Slot
+                          // ========================
+
+struct EpochManager_Slot {
+    // This component-private structure is the slot in which a thread
+    // announces the epoch it observed when entering a critical section.  A
+    // slot occupies a cache line of its own, so that threads entering and
+    // leaving critical sections do not write to shared cache lines.
+
+    // PUBLIC DATA
+    bsls::AtomicInt64 d_epoch;    // epoch observed on entering the outermost
+                                  // critical section, or 0 if not in one
+
+    int               d_nesting;  // critical section nesting depth (accessed
+                                  // only by the thread owning the slot)
+
+    char              d_padding[64 - sizeof(bsls::AtomicInt64) - sizeof(int)];
+
+    // CREATORS
+    EpochManager_Slot()
+    : d_epoch(0)
+    , d_nesting(0)
+    {
+    }
+};
+
+                        // =============================
+                        // struct EpochManager_Directory
+                        // =============================
+
+struct EpochManager_Directory {
+    // This component-private structure holds the addresses of the chunks of
+    // slots of an epoch manager.
+
+    // PUBLIC DATA
+    int                                     d_numChunks;   // capacity of
+                                                           // 'd_chunks_p'
+
+    bsls::AtomicPointer<EpochManager_Slot> *d_chunks_p;    // chunk addresses,
+                                                           // 0 if unallocated
+
+    EpochManager_Directory                 *d_previous_p;  // superseded
+                                                           // directory, or 0
+};
+
+}  // close package namespace
+
+namespace {
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+BSLMT_THREAD_LOCAL_VARIABLE(int, g_threadIndexPlusOne, 0);
+#endif
+
+bslmt::QLock  g_indexLock = BSLMT_QLOCK_INITIALIZER;
+int           g_numFreeIndices = 0;
+int          *g_freeIndices = 0;
+int           g_freeIndicesCapacity = 0;
+int           g_nextIndex = 0;
+
+extern "C" void releaseThreadIndex(void *indexPlusOne)
+    // Return the index encoded by the specified 'indexPlusOne' to the free
+    // list of thread indices.  This function is the destructor of the
+    // thread-specific storage key holding the index of a thread.
+{
+    const int index = static_cast<int>(
+                        reinterpret_cast<bsls::Types::IntPtr>(indexPlusOne)) -
+                      1;
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    g_threadIndexPlusOne = 0;
+#endif
+
+    bslmt::QLockGuard guard(&g_indexLock);
+
+    g_freeIndices[g_numFreeIndices++] = index;
+}
+
+const bslmt::ThreadUtil::Key& threadIndexKey()
+    // Return the thread-specific storage key holding one more than the index
+    // of a thread.
+{
+    static bslmt::ThreadUtil::Key s_key;
+    BSLMT_ONCE_DO {
+        int rc = bslmt::ThreadUtil::createKey(&s_key, &releaseThreadIndex);
+        BSLS_ASSERT_OPT(0 == rc);
+        (void)rc;
+    }
+    return s_key;
+}
+
+int acquireThreadIndex()
+    // Assign an index to the calling thread and return it.
+{
+    int index;
+    {
+        bslmt::QLockGuard guard(&g_indexLock);
+
+        if (g_numFreeIndices) {
+            index = g_freeIndices[--g_numFreeIndices];
+        }
+        else {
+            // Every assigned index may eventually be returned to the free
+            // list, so its capacity is kept at least 'g_nextIndex'.
+
+            if (g_nextIndex == g_freeIndicesCapacity) {
+                bslma::Allocator *allocator =
+                                       &bslma::NewDeleteAllocator::singleton();
+
+                const int capacity = g_freeIndicesCapacity
+                                   ? 2 * g_freeIndicesCapacity
+                                   : 64;
+                int *freeIndices = static_cast<int *>(
+                                 allocator->allocate(sizeof(int) * capacity));
+                for (int i = 0; i < g_numFreeIndices; ++i) {
+                    freeIndices[i] = g_freeIndices[i];
+                }
+                allocator->deallocate(g_freeIndices);
+
+                g_freeIndices         = freeIndices;
+                g_freeIndicesCapacity = capacity;
+            }
+            index = g_nextIndex++;
+        }
+    }
+
+    void *value = reinterpret_cast<void *>(
+                                 static_cast<bsls::Types::IntPtr>(index + 1));
+
+    int rc = bslmt::ThreadUtil::setSpecific(threadIndexKey(), value);
+    BSLS_ASSERT_OPT(0 == rc);
+    (void)rc;
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    g_threadIndexPlusOne = index + 1;
+#endif
+
+    return index;
+}
+
+inline
+int threadIndex()
+    // Return the index of the calling thread, assigning one if needed.
+{
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    if (g_threadIndexPlusOne) {
+        return g_threadIndexPlusOne - 1;                              // RETURN
+    }
+#endif
+
+    const int indexPlusOne = static_cast<int>(
+                                  reinterpret_cast<bsls::Types::IntPtr>(
+                                      bslmt::ThreadUtil::getSpecific(
+                                                           threadIndexKey())));
+
+    return indexPlusOne ? indexPlusOne - 1 : acquireThreadIndex();
+}
+
+inline
+int threadIndexIfAssigned()
+    // Return the index of the calling thread, or -1 if none is assigned.
+{
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    if (g_threadIndexPlusOne) {
+        return g_threadIndexPlusOne - 1;                              // RETURN
+    }
+#endif
+
+    return static_cast<int>(reinterpret_cast<bsls::Types::IntPtr>(
+                           bslmt::ThreadUtil::getSpecific(threadIndexKey()))) -
+           1;
+}
+
+}  // close unnamed namespace
+
+namespace bdlcc {
+
+                             // ------------------
+                             // class EpochManager
+                             // ------------------
+
+// PRIVATE CLASS METHODS
+void EpochManager::invokeDeleters(const bsl::vector<Retired>& retired)
+{
+    for (bsl::size_t i = 0; i < retired.size(); ++i) {
+        retired[i].d_deleter(retired[i].d_object_p, retired[i].d_context_p);
+    }
+}
+
+// PRIVATE MANIPULATORS
+EpochManager::Slot *EpochManager::allocateChunk(int chunkIndex)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    Directory *directory = d_directory_p.loadRelaxed();
+    if (0 == directory || directory->d_numChunks <= chunkIndex) {
+        int numChunks = directory ? 2 * directory->d_numChunks
+                                  : static_cast<int>(k_INITIAL_NUM_CHUNKS);
+        while (numChunks <= chunkIndex) {
+            numChunks *= 2;
+        }
+
+        Directory *grown = static_cast<Directory *>(
+                                 d_allocator_p->allocate(sizeof(Directory)));
+        grown->d_chunks_p = static_cast<bsls::AtomicPointer<Slot> *>(
+                                     d_allocator_p->allocate(
+                                         sizeof(bsls::AtomicPointer<Slot>) *
+                                         numChunks));
+        grown->d_numChunks  = numChunks;
+        grown->d_previous_p = directory;
+
+        const int numCopied = directory ? directory->d_numChunks : 0;
+        for (int i = 0; i < numChunks; ++i) {
+            new (grown->d_chunks_p + i) bsls::AtomicPointer<Slot>(
+                      i < numCopied ? directory->d_chunks_p[i].loadRelaxed()
+                                    : 0);
+        }
+
+        d_directory_p.storeRelease(grown);
+        directory = grown;
+    }
+
+    Slot *chunk = directory->d_chunks_p[chunkIndex].loadRelaxed();
+    if (0 == chunk) {
+        chunk = static_cast<Slot *>(
+                d_allocator_p->allocate(sizeof(Slot) * k_SLOTS_PER_CHUNK));
+        for (int i = 0; i < k_SLOTS_PER_CHUNK; ++i) {
+            new (chunk + i) Slot();
+        }
+        directory->d_chunks_p[chunkIndex].storeRelease(chunk);
+    }
+    return chunk;
+}
+
+void EpochManager::extractReclaimable(bsl::vector<Retired> *reclaimable)
+{
+    BSLS_ASSERT(reclaimable);
+
+    if (d_retired.empty()) {
+        return;                                                       // RETURN
+    }
+
+    // Advancing the epoch beyond 'E + 2', where 'E' is the epoch of the most
+    // recently retired object, does not make any more objects reclaimable.
+
+    const bsls::Types::Int64 target = d_retired.back().d_epoch + 2;
+    while (d_epoch.loadRelaxed() < target && tryAdvance()) {
+    }
+
+    const bsls::Types::Int64 limit = d_epoch.loadRelaxed() - 2;
+
+    bsl::vector<Retired>::iterator end = d_retired.begin();
+    while (end != d_retired.end() && end->d_epoch <= limit) {
+        ++end;
+    }
+
+    if (end == d_retired.end()) {
+        reclaimable->swap(d_retired);
+    }
+    else {
+        reclaimable->assign(d_retired.begin(), end);
+        d_retired.erase(d_retired.begin(), end);
+    }
+    d_numRetired.storeRelaxed(static_cast<int>(d_retired.size()));
+}
+
+bool EpochManager::tryAdvance()
+{
+    const bsls::Types::Int64  epoch     = d_epoch.loadRelaxed();
+    const Directory          *directory = d_directory_p.loadRelaxed();
+
+    if (directory) {
+        for (int i = 0; i < directory->d_numChunks; ++i) {
+            const Slot *chunk = directory->d_chunks_p[i].load();
+            if (0 == chunk) {
+                continue;                                           // CONTINUE
+            }
+            for (int j = 0; j < k_SLOTS_PER_CHUNK; ++j) {
+                const bsls::Types::Int64 announced = chunk[j].d_epoch.load();
+                if (0 != announced && epoch != announced) {
+                    return false;                                     // RETURN
+                }
+            }
+        }
+    }
+
+    d_epoch.store(epoch + 1);
+    return true;
+}
+
+inline
+EpochManager::Slot *EpochManager::slot()
+{
+    const int index      = threadIndex();
+    const int chunkIndex = index / k_SLOTS_PER_CHUNK;
+
+    const Directory *directory = d_directory_p.loadAcquire();
+
+    Slot *chunk = directory && chunkIndex < directory->d_numChunks
+                ? directory->d_chunks_p[chunkIndex].loadAcquire()
+                : 0;
+    if (0 == chunk) {
+        chunk = allocateChunk(chunkIndex);
+    }
+    return chunk + index % k_SLOTS_PER_CHUNK;
+}
+
+// PRIVATE ACCESSORS
+const EpochManager::Slot *EpochManager::slotIfAllocated() const
+{
+    const int index = threadIndexIfAssigned();
+    if (0 > index) {
+        return 0;                                                     // RETURN
+    }
+
+    const int chunkIndex = index / k_SLOTS_PER_CHUNK;
+
+    // A chunk missing from a superseded directory was allocated by a thread
+    // other than the calling thread, which therefore has no slot in it.
+
+    const Directory *directory = d_directory_p.loadAcquire();
+    if (0 == directory || directory->d_numChunks <= chunkIndex) {
+        return 0;                                                     // RETURN
+    }
+
+    const Slot *chunk = directory->d_chunks_p[chunkIndex].loadAcquire();
+
+    return chunk ? chunk + index % k_SLOTS_PER_CHUNK : 0;
+}
+
+// CREATORS
+EpochManager::EpochManager(bslma::Allocator *basicAllocator)
+: d_epoch(1)
+, d_directory_p(0)
+, d_retired(basicAllocator)
+, d_numRetired(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+EpochManager::~EpochManager()
+{
+    invokeDeleters(d_retired);
+
+    Directory *directory = d_directory_p.loadRelaxed();
+    if (directory) {
+        for (int i = 0; i < directory->d_numChunks; ++i) {
+            Slot *chunk = directory->d_chunks_p[i].loadRelaxed();
+            if (chunk) {
+                BSLS_ASSERT(0 == chunk->d_epoch.loadRelaxed());
+
+                d_allocator_p->deallocate(chunk);
+            }
+        }
+    }
+
+    while (directory) {
+        Directory *previous = directory->d_previous_p;
+
+        d_allocator_p->deallocate(directory->d_chunks_p);
+        d_allocator_p->deallocate(directory);
+
+        directory = previous;
+    }
+}
+
+// MANIPULATORS
+void EpochManager::enter()
+{
+    Slot *s = slot();
+
+    if (0 == s->d_nesting++) {
+        // The (sequentially consistent) store orders the announcement before
+        // the subsequent reads of the shared data structure.
+
+        s->d_epoch.store(d_epoch.loadAcquire());
+    }
+}
+
+void EpochManager::leave()
+{
+    Slot *s = slot();
+
+    BSLS_ASSERT(0 < s->d_nesting);
+
+    if (0 == --s->d_nesting) {
+        s->d_epoch.storeRelease(0);
+    }
+}
+
+int EpochManager::reclaim()
+{
+    bsl::vector<Retired> reclaimable(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        extractReclaimable(&reclaimable);
+    }
+
+    invokeDeleters(reclaimable);
+
+    return static_cast<int>(reclaimable.size());
+}
+
+void EpochManager::retire(void *object, Deleter deleter, void *context)
+{
+    BSLS_ASSERT(object);
+    BSLS_ASSERT(deleter);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    Retired retired = { object, deleter, context, d_epoch.load() };
+    d_retired.push_back(retired);
+    d_numRetired.storeRelaxed(static_cast<int>(d_retired.size()));
+}
+
+void EpochManager::retire(void *const *objects,
+                          int          numObjects,
+                          Deleter      deleter,
+                          void        *context)
+{
+    BSLS_ASSERT(objects || 0 == numObjects);
+    BSLS_ASSERT(0 <= numObjects);
+    BSLS_ASSERT(deleter);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    const bsls::Types::Int64 epoch = d_epoch.load();
+
+    d_retired.reserve(d_retired.size() + numObjects);
+    for (int i = 0; i < numObjects; ++i) {
+        BSLS_ASSERT(objects[i]);
+
+        Retired retired = { objects[i], deleter, context, epoch };
+        d_retired.push_back(retired);
+    }
+    d_numRetired.storeRelaxed(static_cast<int>(d_retired.size()));
+}
+
+void EpochManager::synchronize()
+{
+    BSLS_ASSERT(!isInCriticalSection());
+
+    bsl::vector<Retired> reclaimable(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        // Once the epoch has advanced twice, every thread in a critical
+        // section at the time of the call has left it.
+
+        const bsls::Types::Int64 target = d_epoch.load() + 2;
+        while (d_epoch.loadRelaxed() < target) {
+            if (!tryAdvance()) {
+                d_mutex.unlock();
+                bslmt::ThreadUtil::yield();
+                d_mutex.lock();
+            }
+        }
+
+        extractReclaimable(&reclaimable);
+    }
+
+    invokeDeleters(reclaimable);
+}
+
+// ACCESSORS
+bool EpochManager::isInCriticalSection() const
+{
+    const Slot *s = slotIfAllocated();
+
+    return s && 0 < s->d_nesting;
+}
+
+int EpochManager::numRetired() const
+{
+    return d_numRetired.loadRelaxed();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,464 @@
+// bdlcc_epochmanager.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLCC_EPOCHMANAGER
+#define INCLUDED_BDLCC_EPOCHMANAGER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide epoch-based reclamation of memory shared between threads.
+//
+//@CLASSES:
+//  bdlcc::EpochManager: mechanism deferring destruction until no reader runs
+//  bdlcc::EpochGuard:   scoped guard for a critical section of a manager
+//
+//@SEE_ALSO: bdlcc_objectcatalog
+//
+//@DESCRIPTION: This component provides a mechanism, 'bdlcc::EpochManager',
+// that allows the readers of a concurrent data structure to traverse it
+// without taking a lock and without modifying any memory shared with other
+// threads, while the writers of the data structure unlink and then *retire*
+// the objects (nodes, arrays, values, etc.) that the readers may still be
+// accessing.  A retired object is *reclaimed* -- i.e., passed to the deleter
+// function supplied when it was retired -- only once no reader that could
+// have obtained a reference to it before it was unlinked is still running.
+// This component also provides a scoped guard, 'bdlcc::EpochGuard', that
+// delimits the *critical* *section* of a reader.
+//
+///Epochs
+///------
+// An epoch manager maintains a global *epoch* counter, and one *slot* per
+// thread in which the thread announces the epoch observed when it entered a
+// critical section (or that it is not in one).  Entering a critical section
+// reads the global epoch and stores it into the thread's own slot, and leaving
+// it clears the slot; neither operation performs an atomic read-modify-write
+// operation, nor writes to memory that is written by other threads.  Note that
+// entering a critical section does require a full memory barrier (between the
+// store to the slot and the subsequent reads of the shared data structure);
+// this is the cost that a lock-free reader pays in place of the contended
+// atomic operations of a lock or a reference count.
+//
+// An object retired while the global epoch is 'E' is reclaimable once the
+// global epoch reaches 'E + 2', and the global epoch advances from 'E' to
+// 'E + 1' only when every thread in a critical section has announced 'E'.
+// Retiring an object therefore costs a mutex-protected append to a list, and
+// reclaiming it, which is done by 'reclaim' and 'synchronize', costs a scan of
+// the slots of the threads that have used the manager.  Note that the writes
+// unlinking an object from the data structure, and the reads of the readers
+// that may reach it, must be sequentially consistent (which is the default
+// for the 'bsls::Atomic' types) for a reader to be guaranteed to observe the
+// unlinking of an object that has been reclaimed.
+//
+// A thread that stays in a critical section indefinitely prevents the
+// reclamation of all the objects retired after it entered; critical sections
+// are expected to be short, and must not block.
+//
+// Critical sections may be nested: only the outermost 'enter' and 'leave' of a
+// thread publish to its slot.  Slots are allocated on demand for any number of
+// threads; the slot index used by a thread is returned for reuse when the
+// thread exits, so that the slots scanned on reclamation are bounded by the
+// number of threads simultaneously alive.
+//
+///Deleters
+///--------
+// An object is retired together with a deleter, which is an ordinary function
+// taking the address of the object and an opaque context pointer (typically
+// the data structure from which the object was unlinked), and which is
+// responsible for destroying the object and returning its memory to the
+// appropriate allocator.  Deleters are invoked by the thread calling
+// 'reclaim', 'synchronize', or the destructor of the manager, after that
+// thread has released the internal mutex of the manager: a deleter must not
+// throw, and may retire further objects (e.g., the children of a retired
+// node) to the manager that invoked it, or call 'reclaim'.  Clients typically
+// call 'reclaim' while holding the lock that serializes their writers, so that
+// deleters may safely return objects to a free list of the data structure.
+//
+///Thread Safety
+///-------------
+// 'bdlcc::EpochManager' is fully thread-safe, meaning that all non-creator
+// operations on an object can be safely invoked simultaneously from multiple
+// threads, with the exception of 'synchronize', which must not be called by a
+// thread that is in a critical section of the same manager (as it would wait
+// for that thread forever).
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Publishing Immutable Configuration
+///- - - - - - - - - - - - - - - - - - - - - - -
+// In this example we publish a configuration object that is read very
+// frequently by many threads and is replaced rarely.  Readers must never see a
+// destroyed configuration, and must not contend with each other.
+//
+// First, we define the configuration type, and a deleter that destroys an
+// object of that type using the allocator supplied as context:
+//..
+//  struct Config {
+//      int d_timeout;
+//      int d_maxConnections;
+//  };
+//
+//  void deleteConfig(void *object, void *context)
+//  {
+//      static_cast<bslma::Allocator *>(context)->deleteObject(
+//                                              static_cast<Config *>(object));
+//  }
+//..
+// Then, we define the class that publishes the current configuration, and
+// whose 'update' method retires the configuration that it replaces:
+//..
+//  class ConfigHolder {
+//      // DATA
+//      bdlcc::EpochManager          d_epochManager;
+//      bsls::AtomicPointer<Config>  d_config_p;
+//      bslma::Allocator            *d_allocator_p;
+//
+//    public:
+//      // CREATORS
+//      explicit ConfigHolder(bslma::Allocator *basicAllocator = 0)
+//      : d_epochManager(basicAllocator)
+//      , d_config_p(0)
+//      , d_allocator_p(bslma::Default::allocator(basicAllocator))
+//      {
+//          Config initial = { 30, 100 };
+//          d_config_p = new (*d_allocator_p) Config(initial);
+//      }
+//
+//      ~ConfigHolder()
+//      {
+//          d_allocator_p->deleteObject(d_config_p.load());
+//      }
+//
+//      // MANIPULATORS
+//      void update(const Config& config)
+//      {
+//          Config *previous = d_config_p.swap(
+//                                       new (*d_allocator_p) Config(config));
+//          d_epochManager.retire(previous, &deleteConfig, d_allocator_p);
+//          d_epochManager.reclaim();
+//      }
+//
+//      // ACCESSORS
+//      int timeout()
+//      {
+//          bdlcc::EpochGuard guard(&d_epochManager);
+//
+//          return d_config_p.load()->d_timeout;
+//      }
+//  };
+//..
+// Note that 'timeout' is not declared 'const', because entering a critical
+// section is a manipulator of the epoch manager.
+//
+// Now, we create a holder, read its configuration, and update it; as no reader
+// is in a critical section of the manager of the holder, the previous
+// configuration is reclaimed by 'update' itself, and no memory remains in use
+// once the holder is destroyed:
+//..
+//  bslma::TestAllocator ta;
+//  {
+//      ConfigHolder holder(&ta);
+//      assert(30 == holder.timeout());
+//
+//      Config config = { 60, 200 };
+//      holder.update(config);
+//      assert(60 == holder.timeout());
+//  }
+//  assert(0 == ta.numBlocksInUse());
+//..
+// Finally, we observe that an object retired while a reader is in a critical
+// section is not reclaimed until that reader leaves the critical section:
+//..
+//  bdlcc::EpochManager manager(&ta);
+//  {
+//      bdlcc::EpochGuard guard(&manager);
+//
+//      manager.retire(new (ta) Config(), &deleteConfig, &ta);
+//      assert(0 == manager.reclaim());
+//      assert(1 == manager.numRetired());
+//  }
+//  assert(1 == manager.reclaim());
+//  assert(0 == manager.numRetired());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_mutex.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+struct EpochManager_Directory;
+struct EpochManager_Slot;
+
+                             // ==================
+                             // class EpochManager
+                             // ==================
+
+class EpochManager {
+    // This class provides a mechanism that defers the reclamation of objects
+    // retired by the writers of a data structure until no reader, delimited
+    // by 'enter' and 'leave', can still be referring to them.
+
+  public:
+    // TYPES
+    typedef void (*Deleter)(void *object, void *context);
+        // 'Deleter' is an alias for the type of a function that destroys the
+        // specified 'object' and deallocates its memory, using the specified
+        // 'context' supplied when 'object' was retired.
+
+  private:
+    // PRIVATE TYPES
+    enum {
+        k_SLOTS_PER_CHUNK    = 32,
+        k_INITIAL_NUM_CHUNKS = 4
+    };
+
+    typedef EpochManager_Slot      Slot;
+    typedef EpochManager_Directory Directory;
+
+    struct Retired {
+        // This 'struct' records a retired object.
+
+        // PUBLIC DATA
+        void               *d_object_p;   // retired object
+        Deleter             d_deleter;    // function reclaiming 'd_object_p'
+        void               *d_context_p;  // context passed to 'd_deleter'
+        bsls::Types::Int64  d_epoch;      // epoch when retired
+    };
+
+    // DATA
+    bsls::AtomicInt64          d_epoch;                // global epoch
+
+    bsls::AtomicPointer<Directory>
+                               d_directory_p;          // addresses of the
+                                                       // chunks of slots of
+                                                       // the threads, or 0 if
+                                                       // none is allocated
+
+    mutable bslmt::Mutex       d_mutex;                // serializes retiring,
+                                                       // reclamation, and
+                                                       // chunk allocation
+
+    bsl::vector<Retired>       d_retired;              // retired objects, in
+                                                       // increasing epoch
+                                                       // order
+
+    bsls::AtomicInt            d_numRetired;           // size of 'd_retired',
+                                                       // readable without
+                                                       // 'd_mutex'
+
+    bslma::Allocator          *d_allocator_p;          // memory allocator
+                                                       // (held)
+
+    // NOT IMPLEMENTED
+    EpochManager(const EpochManager&) BSLS_KEYWORD_DELETED;
+    EpochManager& operator=(const EpochManager&) BSLS_KEYWORD_DELETED;
+
+    // PRIVATE CLASS METHODS
+    static void invokeDeleters(const bsl::vector<Retired>& retired);
+        // Pass each of the specified 'retired' objects to its deleter.
+
+    // PRIVATE MANIPULATORS
+    Slot *allocateChunk(int chunkIndex);
+        // Return the address of the chunk of slots having the specified
+        // 'chunkIndex', allocating it, and growing the directory of chunks to
+        // hold it, if it does not exist yet.
+
+    void extractReclaimable(bsl::vector<Retired> *reclaimable);
+        // Advance the global epoch as far as the threads in critical sections
+        // allow (and as is useful), and move the retired objects that are no
+        // longer accessible to any reader to the specified (empty)
+        // 'reclaimable' list.  The behavior is undefined unless 'd_mutex' is
+        // locked by the calling thread.
+
+    bool tryAdvance();
+        // Advance the global epoch by one, if every thread in a critical
+        // section has announced the current global epoch.  Return 'true' if
+        // the epoch was advanced, and 'false' otherwise.  The behavior is
+        // undefined unless 'd_mutex' is locked by the calling thread.
+
+    Slot *slot();
+        // Return the address of the slot of the calling thread, allocating it
+        // if needed.
+
+    // PRIVATE ACCESSORS
+    const Slot *slotIfAllocated() const;
+        // Return the address of the slot of the calling thread, or 0 if the
+        // slot has not been allocated yet.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(EpochManager, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit EpochManager(bslma::Allocator *basicAllocator = 0);
+        // Create an epoch manager having no retired objects.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator
+        // is used.
+
+    ~EpochManager();
+        // Reclaim all the objects retired to this manager, and destroy it.
+        // The behavior is undefined unless no thread is in a critical section
+        // of this manager.
+
+    // MANIPULATORS
+    void enter();
+        // Enter a critical section of this manager on behalf of the calling
+        // thread: until the matching call to 'leave', no object retired to
+        // this manager after the beginning of this call is reclaimed.  Calls
+        // to 'enter' may be nested.
+
+    void leave();
+        // Leave the critical section of this manager most recently entered by
+        // the calling thread.  The behavior is undefined unless the calling
+        // thread is in a critical section of this manager.
+
+    int reclaim();
+        // Reclaim, without blocking, the objects retired to this manager that
+        // can no longer be accessed by a reader.  Return the number of objects
+        // reclaimed.
+
+    void retire(void *object, Deleter deleter, void *context = 0);
+        // Retire the specified 'object', which must no longer be reachable by
+        // a reader entering a critical section of this manager, so that it is
+        // passed to the specified 'deleter' together with the optionally
+        // specified 'context' once no reader can still be accessing it.  Note
+        // that this method does not reclaim any object: clients are expected
+        // to call 'reclaim' periodically (e.g., after retiring an object).
+
+    void retire(void *const *objects,
+                int          numObjects,
+                Deleter      deleter,
+                void        *context = 0);
+        // Retire the specified 'numObjects' objects at the specified
+        // 'objects' address, as if by calling 'retire' on each of them with
+        // the specified 'deleter' and the optionally specified 'context', but
+        // acquiring the internal mutex of this manager only once.  The
+        // behavior is undefined unless '0 <= numObjects'.
+
+    void synchronize();
+        // Block until every thread that was in a critical section of this
+        // manager at the time of this call has left it, then reclaim all the
+        // objects that were retired to this manager before this call (except
+        // those being reclaimed by a concurrent call to 'reclaim' or
+        // 'synchronize').  The behavior is undefined if the calling thread is
+        // in a critical section of this manager.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+
+    bsls::Types::Int64 epoch() const;
+        // Return a snapshot of the global epoch of this manager.
+
+    bool isInCriticalSection() const;
+        // Return 'true' if the calling thread is in a critical section of this
+        // manager, and 'false' otherwise.
+
+    int numRetired() const;
+        // Return a snapshot of the number of objects retired to this manager
+        // that have not been reclaimed yet.  Note that this method does not
+        // block.
+};
+
+                              // ================
+                              // class EpochGuard
+                              // ================
+
+class EpochGuard {
+    // This class implements a guard that enters a critical section of an
+    // epoch manager on construction, and leaves it on destruction.
+
+    // DATA
+    EpochManager *d_manager_p;  // manager whose critical section is guarded
+
+    // NOT IMPLEMENTED
+    EpochGuard(const EpochGuard&) BSLS_KEYWORD_DELETED;
+    EpochGuard& operator=(const EpochGuard&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // CREATORS
+    explicit EpochGuard(EpochManager *manager);
+        // Create a guard entering a critical section of the specified
+        // 'manager' on behalf of the calling thread.
+
+    ~EpochGuard();
+        // Leave the critical section entered by this guard, and destroy this
+        // guard.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                             // ------------------
+                             // class EpochManager
+                             // ------------------
+
+// ACCESSORS
+inline
+bslma::Allocator *EpochManager::allocator() const
+{
+    return d_allocator_p;
+}
+
+inline
+bsls::Types::Int64 EpochManager::epoch() const
+{
+    return d_epoch.loadAcquire();
+}
+
+                              // ----------------
+                              // class EpochGuard
+                              // ----------------
+
+// CREATORS
+inline
+EpochGuard::EpochGuard(EpochManager *manager)
+: d_manager_p(manager)
+{
+    BSLS_ASSERT(manager);
+
+    d_manager_p->enter();
+}
+
+inline
+EpochGuard::~EpochGuard()
+{
+    d_manager_p->leave();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
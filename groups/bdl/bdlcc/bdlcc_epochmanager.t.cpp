@@ -0,0 +1,1150 @@
+// bdlcc_epochmanager.t.cpp                                           -*-C++-*-
+#include <bdlcc_epochmanager.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'bdlcc::EpochManager' is a mechanism whose observable behavior is the set of
+// retired objects it has reclaimed (i.e., passed to their deleters) at any
+// point in time, and whether the calling thread is in one of its critical
+// sections.  We verify the single-threaded behavior of critical sections
+// (including nesting) and of reclamation, then use threads parked in critical
+// sections to verify that an object is not reclaimed while a reader that
+// entered before its retirement is running, that 'synchronize' waits for such
+// readers, and that thread slots are recycled when threads exit.  Finally, we
+// verify under stress that readers traversing a structure concurrently updated
+// by writers never observe a reclaimed object.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit EpochManager(bslma::Allocator *basicAllocator = 0);
+// [ 3] ~EpochManager();
+//
+// MANIPULATORS
+// [ 2] void enter();
+// [ 2] void leave();
+// [ 3] int reclaim();
+// [ 3] void retire(void *object, Deleter deleter, void *context = 0);
+// [ 3] void retire(void *const *objects, int num, Deleter, void *ctx);
+// [ 4] void synchronize();
+//
+// ACCESSORS
+// [ 2] bslma::Allocator *allocator() const;
+// [ 3] Int64 epoch() const;
+// [ 2] bool isInCriticalSection() const;
+// [ 3] int numRetired() const;
+//
+// EpochGuard
+// [ 2] explicit EpochGuard(EpochManager *manager);
+// [ 2] ~EpochGuard();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCERN: THREAD SLOTS ARE RECYCLED WHEN THREADS EXIT
+// [ 6] CONCERN: READERS NEVER OBSERVE A RECLAIMED OBJECT
+// [ 7] USAGE EXAMPLE
+// [-1] CONCERN: PERFORMANCE OF A CRITICAL SECTION
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bsls::AtomicInt testStatus(0);
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlcc::EpochManager Obj;
+typedef bdlcc::EpochGuard   Guard;
+typedef bsls::Types::Int64  Int64;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void countingDeleter(void *object, void *context)
+    // Append the specified 'object', which is the address of an 'int', to the
+    // 'bsl::vector<int>' at the specified 'context'.
+{
+    static_cast<bsl::vector<int> *>(context)->push_back(
+                                                  *static_cast<int *>(object));
+}
+
+struct ChainingContext {
+    // This 'struct' holds the state used by 'chainingDeleter'.
+
+    // PUBLIC DATA
+    Obj              *d_manager_p;   // manager invoking the deleter
+    bsl::vector<int> *d_reclaimed_p; // objects reclaimed
+    int              *d_next_p;      // object to retire on reclamation, or 0
+    int               d_numNested;   // result of the nested 'reclaim'
+};
+
+void chainingDeleter(void *object, void *context)
+    // Append the specified 'object', which is the address of an 'int', to the
+    // vector of the 'ChainingContext' at the specified 'context', then, if
+    // its 'd_next_p' is not 0, retire that object to the manager of the
+    // context with 'countingDeleter', reset 'd_next_p', and call 'reclaim'.
+{
+    ChainingContext *chain = static_cast<ChainingContext *>(context);
+
+    chain->d_reclaimed_p->push_back(*static_cast<int *>(object));
+
+    if (chain->d_next_p) {
+        chain->d_manager_p->retire(chain->d_next_p,
+                                   &countingDeleter,
+                                   chain->d_reclaimed_p);
+        chain->d_next_p    = 0;
+        chain->d_numNested = chain->d_manager_p->reclaim();
+    }
+}
+
+struct ParkedReader {
+    // This 'struct' holds the state shared with a thread that enters a
+    // critical section of a manager and stays in it until released.
+
+    // PUBLIC DATA
+    Obj             *d_manager_p;  // manager of the critical section
+    bsls::AtomicInt  d_entered;    // set once the thread has entered
+    bsls::AtomicInt  d_release;    // set to make the thread leave
+    bsls::AtomicInt  d_left;       // set once the thread has left
+};
+
+extern "C" void *parkedReaderThread(void *arg)
+    // Enter a critical section of the manager of the 'ParkedReader' at the
+    // specified 'arg', and leave it once its 'd_release' flag is set.
+{
+    ParkedReader *reader = static_cast<ParkedReader *>(arg);
+
+    {
+        Guard guard(reader->d_manager_p);
+
+        reader->d_entered = 1;
+        while (!reader->d_release) {
+            bslmt::ThreadUtil::microSleep(100);
+        }
+    }
+    reader->d_left = 1;
+    return 0;
+}
+
+extern "C" void *delayedReleaseThread(void *arg)
+    // Set the 'd_release' flag of the 'ParkedReader' at the specified 'arg'
+    // after a delay of 50 milliseconds.
+{
+    bslmt::ThreadUtil::microSleep(50 * 1000);
+    static_cast<ParkedReader *>(arg)->d_release = 1;
+    return 0;
+}
+
+void waitFor(const bsls::AtomicInt& flag)
+    // Block until the specified 'flag' is set.
+{
+    while (!flag) {
+        bslmt::ThreadUtil::microSleep(100);
+    }
+}
+
+extern "C" void *enterOnceThread(void *arg)
+    // Enter and leave a critical section of the manager at the specified
+    // 'arg'.
+{
+    Guard guard(static_cast<Obj *>(arg));
+    return 0;
+}
+
+struct StressObject {
+    // This 'struct' is the object published by the writers of the stress
+    // test, and retired when replaced.
+
+    enum { k_ALIVE = 0x600DF00D, k_DEAD = 0x0BADBAD0 };
+
+    // PUBLIC DATA
+    bsls::AtomicInt   d_state;  // 'k_ALIVE' until reclaimed
+    int               d_value;  // sequence number of the object
+};
+
+struct StressState {
+    // This 'struct' holds the state shared by the threads of the stress test.
+
+    enum { k_NUM_SLOTS = 8 };
+
+    // PUBLIC DATA
+    Obj                                *d_manager_p;
+    bslma::Allocator                   *d_allocator_p;
+    bsls::AtomicPointer<StressObject>   d_slots[k_NUM_SLOTS];
+    bsls::AtomicInt                     d_done;
+    bsls::AtomicInt                     d_numErrors;
+    bsls::AtomicInt                     d_numReclaimed;
+    bsls::AtomicInt64                   d_numReads;
+    int                                 d_numIterations;
+};
+
+StressState *g_stressState_p = 0;
+
+void stressDeleter(void *object, void *context)
+    // Mark the 'StressObject' at the specified 'object' as dead and
+    // deallocate it using the 'StressState' at the specified 'context'.  The
+    // object's memory is scribbled over before deallocation so that a reader
+    // accessing it afterwards is likely to detect the error.
+{
+    StressState  *state = static_cast<StressState *>(context);
+    StressObject *obj   = static_cast<StressObject *>(object);
+
+    obj->d_state = StressObject::k_DEAD;
+    obj->d_value = -1;
+    ++state->d_numReclaimed;
+    state->d_allocator_p->deallocate(obj);
+}
+
+extern "C" void *stressReader(void *)
+    // Repeatedly read the objects published in the slots of the stress state
+    // in critical sections, and count any object observed as reclaimed.
+{
+    StressState *state = g_stressState_p;
+
+    Int64 numReads = 0;
+    while (!state->d_done) {
+        Guard guard(state->d_manager_p);
+
+        for (int i = 0; i < StressState::k_NUM_SLOTS; ++i) {
+            StressObject *obj = state->d_slots[i].load();
+            if (StressObject::k_ALIVE != obj->d_state.load() ||
+                0 > obj->d_value) {
+                ++state->d_numErrors;
+            }
+            ++numReads;
+        }
+    }
+    state->d_numReads += numReads;
+    return 0;
+}
+
+extern "C" void *stressWriter(void *arg)
+    // Repeatedly replace the objects published in the slots of the stress
+    // state, retiring the replaced objects.  The specified 'arg' is the index
+    // of the writer.
+{
+    StressState *state = g_stressState_p;
+    const int    index = static_cast<int>(
+                                 reinterpret_cast<bsls::Types::IntPtr>(arg));
+
+    for (int i = 0; i < state->d_numIterations; ++i) {
+        StressObject *obj = static_cast<StressObject *>(
+                         state->d_allocator_p->allocate(sizeof(StressObject)));
+        obj->d_state = StressObject::k_ALIVE;
+        obj->d_value = i;
+
+        StressObject *previous = state->d_slots[
+                        (index + i) % StressState::k_NUM_SLOTS].swap(obj);
+
+        state->d_manager_p->retire(previous, &stressDeleter, state);
+        if (0 == i % 16) {
+            state->d_manager_p->reclaim();
+        }
+    }
+    return 0;
+}
+
+enum { k_BENCH_ITERATIONS = 10 * 1000 * 1000 };
+
+struct BenchState {
+    // This 'struct' holds the state shared by the threads of the benchmark.
+
+    // PUBLIC DATA
+    Obj             *d_manager_p;  // manager of the critical sections
+    bsls::AtomicInt  d_sum;        // value read in critical sections
+};
+
+extern "C" void *benchReader(void *arg)
+    // Enter and leave 'k_BENCH_ITERATIONS' critical sections of the manager
+    // of the 'BenchState' at the specified 'arg', reading its shared value in
+    // each.
+{
+    BenchState *state = static_cast<BenchState *>(arg);
+
+    int sum = 0;
+    for (int i = 0; i < k_BENCH_ITERATIONS; ++i) {
+        Guard guard(state->d_manager_p);
+
+        sum += state->d_sum.loadRelaxed();
+    }
+    state->d_sum.addRelaxed(sum);
+    return 0;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                              USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Publishing Immutable Configuration
+///- - - - - - - - - - - - - - - - - - - - - - -
+// In this example we publish a configuration object that is read very
+// frequently by many threads and is replaced rarely.  Readers must never see a
+// destroyed configuration, and must not contend with each other.
+//
+// First, we define the configuration type, and a deleter that destroys an
+// object of that type using the allocator supplied as context:
+//..
+    struct Config {
+        int d_timeout;
+        int d_maxConnections;
+    };
+
+    void deleteConfig(void *object, void *context)
+    {
+        static_cast<bslma::Allocator *>(context)->deleteObject(
+                                                static_cast<Config *>(object));
+    }
+//..
+// Then, we define the class that publishes the current configuration, and
+// whose 'update' method retires the configuration that it replaces:
+//..
+    class ConfigHolder {
+        // DATA
+        bdlcc::EpochManager          d_epochManager;
+        bsls::AtomicPointer<Config>  d_config_p;
+        bslma::Allocator            *d_allocator_p;
+
+      public:
+        // CREATORS
+        explicit ConfigHolder(bslma::Allocator *basicAllocator = 0)
+        : d_epochManager(basicAllocator)
+        , d_config_p(0)
+        , d_allocator_p(bslma::Default::allocator(basicAllocator))
+        {
+            Config initial = { 30, 100 };
+            d_config_p = new (*d_allocator_p) Config(initial);
+        }
+
+        ~ConfigHolder()
+        {
+            d_allocator_p->deleteObject(d_config_p.load());
+        }
+
+        // MANIPULATORS
+        void update(const Config& config)
+        {
+            Config *previous = d_config_p.swap(
+                                         new (*d_allocator_p) Config(config));
+            d_epochManager.retire(previous, &deleteConfig, d_allocator_p);
+            d_epochManager.reclaim();
+        }
+
+        // ACCESSORS
+        int timeout()
+        {
+            bdlcc::EpochGuard guard(&d_epochManager);
+
+            return d_config_p.load()->d_timeout;
+        }
+    };
+//..
+
+}  // close namespace USAGE_EXAMPLE
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test            = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    const bool verbose         = argc > 2;
+    const bool veryVerbose     = argc > 3;
+    const bool veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace USAGE_EXAMPLE;
+
+// Now, we create a holder, read its configuration, and update it; as no reader
+// is in a critical section of the manager of the holder, the previous
+// configuration is reclaimed by 'update' itself, and no memory remains in use
+// once the holder is destroyed:
+//..
+    bslma::TestAllocator ta;
+    {
+        ConfigHolder holder(&ta);
+        ASSERT(30 == holder.timeout());
+
+        Config config = { 60, 200 };
+        holder.update(config);
+        ASSERT(60 == holder.timeout());
+    }
+    ASSERT(0 == ta.numBlocksInUse());
+//..
+// Finally, we observe that an object retired while a reader is in a critical
+// section is not reclaimed until that reader leaves the critical section:
+//..
+    bdlcc::EpochManager manager(&ta);
+    {
+        bdlcc::EpochGuard guard(&manager);
+
+        manager.retire(new (ta) Config(), &deleteConfig, &ta);
+        ASSERT(0 == manager.reclaim());
+        ASSERT(1 == manager.numRetired());
+    }
+    ASSERT(1 == manager.reclaim());
+    ASSERT(0 == manager.numRetired());
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCERN: READERS NEVER OBSERVE A RECLAIMED OBJECT
+        //
+        // Concerns:
+        //: 1 An object retired by a writer is not reclaimed while a reader
+        //:   that may have obtained its address is in a critical section,
+        //:   when several readers and writers run concurrently.
+        //:
+        //: 2 Every retired object is eventually reclaimed.
+        //
+        // Plan:
+        //: 1 Publish objects in a small array of atomic pointers.  Create
+        //:   reader threads that repeatedly read all the published objects
+        //:   in critical sections, and writer threads that replace them and
+        //:   retire the replaced objects.  The deleter marks an object as
+        //:   dead before deallocating it, and the readers count any dead
+        //:   object they observe.  Verify that no reader observed a dead
+        //:   object.  (C-1)
+        //:
+        //: 2 After joining the threads, call 'synchronize', and verify that
+        //:   the number of reclaimed objects is the number of objects retired,
+        //:   and that no memory remains in use once the published objects are
+        //:   deallocated.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: READERS NEVER OBSERVE A RECLAIMED OBJECT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                        << "CONCERN: READERS NEVER OBSERVE A RECLAIMED OBJECT"
+                        << endl
+                        << "================================================="
+                        << endl;
+
+        enum { k_NUM_READERS = 4, k_NUM_WRITERS = 2 };
+
+        bslma::TestAllocator ta("stress", veryVeryVerbose);
+        {
+            Obj         mX(&ta);
+            StressState state;
+
+            state.d_manager_p     = &mX;
+            state.d_allocator_p   = &ta;
+            state.d_numIterations = 20000;
+            for (int i = 0; i < StressState::k_NUM_SLOTS; ++i) {
+                StressObject *obj = static_cast<StressObject *>(
+                                            ta.allocate(sizeof(StressObject)));
+                obj->d_state = StressObject::k_ALIVE;
+                obj->d_value = 0;
+                state.d_slots[i] = obj;
+            }
+            g_stressState_p = &state;
+
+            bslmt::ThreadUtil::Handle readers[k_NUM_READERS];
+            bslmt::ThreadUtil::Handle writers[k_NUM_WRITERS];
+
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(&readers[i],
+                                                      &stressReader,
+                                                      0));
+            }
+            for (int i = 0; i < k_NUM_WRITERS; ++i) {
+                void *arg = reinterpret_cast<void *>(
+                                         static_cast<bsls::Types::IntPtr>(i));
+                ASSERT(0 == bslmt::ThreadUtil::create(&writers[i],
+                                                      &stressWriter,
+                                                      arg));
+            }
+            for (int i = 0; i < k_NUM_WRITERS; ++i) {
+                bslmt::ThreadUtil::join(writers[i]);
+            }
+            state.d_done = 1;
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                bslmt::ThreadUtil::join(readers[i]);
+            }
+
+            if (veryVerbose) {
+                P_(state.d_numReads) P(state.d_numReclaimed)
+            }
+
+            ASSERTV(state.d_numErrors, 0 == state.d_numErrors);
+
+            mX.synchronize();
+
+            ASSERT(0 == mX.numRetired());
+            ASSERTV(state.d_numReclaimed,
+                    k_NUM_WRITERS * state.d_numIterations ==
+                                                        state.d_numReclaimed);
+
+            for (int i = 0; i < StressState::k_NUM_SLOTS; ++i) {
+                ta.deallocate(state.d_slots[i].load());
+            }
+            g_stressState_p = 0;
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: THREAD SLOTS ARE RECYCLED WHEN THREADS EXIT
+        //
+        // Concerns:
+        //: 1 The slot used by a thread is made available to other threads when
+        //:   it exits, so that any number of threads can use managers over the
+        //:   lifetime of a process.
+        //:
+        //: 2 A thread that exited does not prevent reclamation.
+        //:
+        //: 3 More threads than the initially allocated slots can be
+        //:   simultaneously in critical sections, and each of them prevents
+        //:   the reclamation of the objects retired while it is in one.
+        //
+        // Plan:
+        //: 1 Sequentially create thousands of threads that each enter and
+        //:   leave a critical section of a manager.  (C-1)
+        //:
+        //: 2 Retire an object, and verify that 'reclaim' reclaims it.  (C-2)
+        //:
+        //: 3 Park hundreds of threads in critical sections of a manager,
+        //:   retire an object, and verify that it is not reclaimed until every
+        //:   parked thread has been released.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: THREAD SLOTS ARE RECYCLED WHEN THREADS EXIT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                      << "CONCERN: THREAD SLOTS ARE RECYCLED WHEN THREADS EXIT"
+                      << endl
+                      << "===================================================="
+                      << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj mX(&ta);
+
+            enum { k_NUM_BATCHES = 129 };
+
+            for (int i = 0; i < k_NUM_BATCHES; ++i) {
+                bslmt::ThreadUtil::Handle handles[64];
+                for (int j = 0; j < 64; ++j) {
+                    ASSERTV(i, j, 0 == bslmt::ThreadUtil::create(
+                                                              &handles[j],
+                                                              &enterOnceThread,
+                                                              &mX));
+                }
+                for (int j = 0; j < 64; ++j) {
+                    bslmt::ThreadUtil::join(handles[j]);
+                }
+            }
+
+            bsl::vector<int> reclaimed(&ta);
+            int              object = 5;
+
+            mX.retire(&object, &countingDeleter, &reclaimed);
+            ASSERT(1 == mX.reclaim());
+            ASSERT(1 == reclaimed.size());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tMany simultaneous readers\n";
+        {
+            enum { k_NUM_READERS = 300 };
+
+            Obj mX(&ta);
+
+            ParkedReader              readers[k_NUM_READERS];
+            bslmt::ThreadUtil::Handle handles[k_NUM_READERS];
+
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                readers[i].d_manager_p = &mX;
+                ASSERTV(i, 0 == bslmt::ThreadUtil::create(
+                                                         &handles[i],
+                                                         &parkedReaderThread,
+                                                         &readers[i]));
+            }
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                waitFor(readers[i].d_entered);
+            }
+
+            bsl::vector<int> reclaimed(&ta);
+            int              object = 6;
+
+            mX.retire(&object, &countingDeleter, &reclaimed);
+
+            for (int i = k_NUM_READERS - 1; 0 <= i; --i) {
+                ASSERTV(i, 0 == mX.reclaim());
+
+                readers[i].d_release = 1;
+                bslmt::ThreadUtil::join(handles[i]);
+            }
+            ASSERT(1 == mX.reclaim());
+            ASSERT(1 == reclaimed.size());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'synchronize'
+        //
+        // Concerns:
+        //: 1 'synchronize' does not return while a thread that was in a
+        //:   critical section at the time of the call is still in it.
+        //:
+        //: 2 'synchronize' reclaims all the objects retired before the call.
+        //:
+        //: 3 'synchronize' returns immediately if no thread is in a critical
+        //:   section.
+        //
+        // Plan:
+        //: 1 Park a thread in a critical section and retire objects.  Call
+        //:   'synchronize' from another thread, verify that it has not
+        //:   returned after a delay, then release the parked thread and verify
+        //:   that 'synchronize' returns having reclaimed the objects.  (C-1,2)
+        //:
+        //: 2 Call 'synchronize' without readers.  (C-3)
+        //
+        // Testing:
+        //   void synchronize();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'synchronize'" << endl
+                          << "=====================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            bsl::vector<int> reclaimed(&ta);
+            int              objects[] = { 1, 2, 3 };
+            Obj              mX(&ta);
+
+            mX.synchronize();
+
+            ParkedReader reader;
+            reader.d_manager_p = &mX;
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                  &parkedReaderThread,
+                                                  &reader));
+            waitFor(reader.d_entered);
+
+            for (int i = 0; i < 3; ++i) {
+                mX.retire(&objects[i], &countingDeleter, &reclaimed);
+            }
+            ASSERT(0 == mX.reclaim());
+
+            bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+
+            bslmt::ThreadUtil::Handle releaser;
+            ASSERT(0 == bslmt::ThreadUtil::create(&releaser,
+                                                  &delayedReleaseThread,
+                                                  &reader));
+
+            mX.synchronize();
+
+            const double elapsed = (bsls::SystemTime::nowMonotonicClock() -
+                                               start).totalSecondsAsDouble();
+
+            ASSERTV(elapsed, 0.04 < elapsed);
+            ASSERT(reader.d_release);
+            ASSERT(3 == reclaimed.size());
+            ASSERT(0 == mX.numRetired());
+
+            bslmt::ThreadUtil::join(releaser);
+            bslmt::ThreadUtil::join(handle);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'retire' AND 'reclaim'
+        //
+        // Concerns:
+        //: 1 An object retired when no thread is in a critical section is
+        //:   reclaimed by the next call to 'reclaim'.
+        //:
+        //: 2 An object retired while another thread is in a critical section
+        //:   is not reclaimed until that thread leaves it, while objects
+        //:   retired before that thread entered are reclaimable.
+        //:
+        //: 3 Objects are reclaimed in the order they were retired, and each
+        //:   deleter is passed its object and context.
+        //:
+        //: 4 The destructor reclaims the objects not reclaimed yet.
+        //:
+        //: 5 'numRetired' and 'epoch' reflect the state of the manager.
+        //:
+        //: 6 A deleter may retire another object and call 'reclaim' on the
+        //:   manager invoking it.
+        //:
+        //: 7 Retiring a batch of objects is equivalent to retiring each of
+        //:   them in order.
+        //
+        // Plan:
+        //: 1 Using a deleter that records its objects in a vector passed as
+        //:   context, retire and reclaim objects while no thread, and while a
+        //:   thread parked in a critical section, is in a critical section.
+        //:   Verify the recorded objects, 'numRetired', and 'epoch' after each
+        //:   step.  (C-1..3, 5)
+        //:
+        //: 2 Retire objects while a thread is parked in a critical section,
+        //:   release the thread, and destroy the manager without calling
+        //:   'reclaim'.  Verify that the objects were reclaimed.  (C-4)
+        //:
+        //: 3 Retire an object with a deleter that retires a second object and
+        //:   calls 'reclaim', and verify that both objects are reclaimed.
+        //:   (C-6)
+        //:
+        //: 4 Retire a batch of objects (and an empty batch), and verify
+        //:   'numRetired' and the order in which they are reclaimed.  (C-7)
+        //
+        // Testing:
+        //   ~EpochManager();
+        //   int reclaim();
+        //   void retire(void *object, Deleter deleter, void *context = 0);
+        //   void retire(void *const *objects, int num, Deleter, void *ctx);
+        //   Int64 epoch() const;
+        //   int numRetired() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'retire' AND 'reclaim'" << endl
+                          << "==============================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            bsl::vector<int> reclaimed(&ta);
+            int              objects[] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+
+            {
+                Obj mX(&ta);  const Obj& X = mX;
+
+                ASSERT(0 == X.numRetired());
+                ASSERT(0 == mX.reclaim());
+
+                const Int64 epoch0 = X.epoch();
+
+                mX.retire(&objects[0], &countingDeleter, &reclaimed);
+                ASSERT(1 == X.numRetired());
+                ASSERT(0 == reclaimed.size());
+
+                ASSERT(1 == mX.reclaim());
+                ASSERT(0 == X.numRetired());
+                ASSERT(1 == reclaimed.size() && 0 == reclaimed[0]);
+                ASSERTV(epoch0, X.epoch(), epoch0 + 2 == X.epoch());
+
+                if (veryVerbose) cout << "\tRetire in own critical section\n";
+                {
+                    Guard guard(&mX);
+
+                    mX.retire(&objects[1], &countingDeleter, &reclaimed);
+                    ASSERT(0 == mX.reclaim());
+                    ASSERT(1 == X.numRetired());
+                }
+                ASSERT(1 == mX.reclaim());
+                ASSERT(2 == reclaimed.size() && 1 == reclaimed[1]);
+
+                if (veryVerbose) cout << "\tRetire with a parked reader\n";
+
+                ParkedReader reader;
+                reader.d_manager_p = &mX;
+
+                bslmt::ThreadUtil::Handle handle;
+                ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                      &parkedReaderThread,
+                                                      &reader));
+                waitFor(reader.d_entered);
+
+                mX.retire(&objects[2], &countingDeleter, &reclaimed);
+                mX.retire(&objects[3], &countingDeleter, &reclaimed);
+                mX.retire(&objects[4], &countingDeleter, &reclaimed);
+
+                for (int i = 0; i < 3; ++i) {
+                    ASSERTV(i, 0 == mX.reclaim());
+                }
+                ASSERT(3 == X.numRetired());
+                ASSERT(2 == reclaimed.size());
+
+                reader.d_release = 1;
+                bslmt::ThreadUtil::join(handle);
+
+                ASSERT(3 == mX.reclaim());
+                ASSERT(0 == X.numRetired());
+                ASSERT(5 == reclaimed.size());
+                for (int i = 0; i < static_cast<int>(reclaimed.size()); ++i) {
+                    ASSERTV(i, reclaimed[i], i == reclaimed[i]);
+                }
+
+                if (veryVerbose) cout << "\tReclaim on destruction\n";
+
+                ParkedReader reader2;
+                reader2.d_manager_p = &mX;
+
+                ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                      &parkedReaderThread,
+                                                      &reader2));
+                waitFor(reader2.d_entered);
+
+                mX.retire(&objects[5], &countingDeleter, &reclaimed);
+                mX.retire(&objects[6], &countingDeleter, &reclaimed);
+                ASSERT(0 == mX.reclaim());
+
+                reader2.d_release = 1;
+                bslmt::ThreadUtil::join(handle);
+
+                ASSERT(2 == X.numRetired());
+            }
+            ASSERT(7 == reclaimed.size());
+            ASSERT(5 == reclaimed[5] && 6 == reclaimed[6]);
+
+            if (veryVerbose) cout << "\tRetire from a deleter\n";
+            {
+                Obj mX(&ta);  const Obj& X = mX;
+
+                ChainingContext chain = { &mX, &reclaimed, &objects[7], -1 };
+
+                reclaimed.clear();
+                mX.retire(&objects[0], &chainingDeleter, &chain);
+
+                ASSERT(1 == mX.reclaim());
+                ASSERTV(chain.d_numNested, 1 == chain.d_numNested);
+                ASSERT(0 == X.numRetired());
+                ASSERT(2 == reclaimed.size());
+                ASSERT(0 == reclaimed[0] && 7 == reclaimed[1]);
+            }
+
+            if (veryVerbose) cout << "\tRetire a batch\n";
+            {
+                Obj mX(&ta);  const Obj& X = mX;
+
+                void *batch[] = { &objects[3], &objects[1], &objects[2] };
+
+                reclaimed.clear();
+                mX.retire(batch, 0, &countingDeleter, &reclaimed);
+                ASSERT(0 == X.numRetired());
+
+                mX.retire(&objects[4], &countingDeleter, &reclaimed);
+                mX.retire(batch, 3, &countingDeleter, &reclaimed);
+                ASSERT(4 == X.numRetired());
+
+                ASSERT(4 == mX.reclaim());
+                ASSERT(0 == X.numRetired());
+                ASSERT(4 == reclaimed.size());
+                ASSERT(4 == reclaimed[0] && 3 == reclaimed[1]);
+                ASSERT(1 == reclaimed[2] && 2 == reclaimed[3]);
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CRITICAL SECTIONS
+        //
+        // Concerns:
+        //: 1 'enter' and 'leave' delimit a critical section of the calling
+        //:   thread, as reported by 'isInCriticalSection', and may be nested.
+        //:
+        //: 2 A critical section of one manager is not a critical section of
+        //:   another.
+        //:
+        //: 3 'EpochGuard' enters a critical section on construction and leaves
+        //:   it on destruction.
+        //:
+        //: 4 All memory is supplied by the allocator passed at construction
+        //:   (or the default allocator), and is released by the destructor.
+        //:
+        //: 5 'allocator' returns the allocator used by the manager.
+        //
+        // Plan:
+        //: 1 Enter and leave (nested) critical sections of two managers using
+        //:   both the manipulators and guards, and verify
+        //:   'isInCriticalSection' after each step.  (C-1..3)
+        //:
+        //: 2 Install a test allocator as the default allocator, and verify
+        //:   its use, and that of the allocator passed at construction.
+        //:   (C-4,5)
+        //
+        // Testing:
+        //   explicit EpochManager(bslma::Allocator *basicAllocator = 0);
+        //   void enter();
+        //   void leave();
+        //   bslma::Allocator *allocator() const;
+        //   bool isInCriticalSection() const;
+        //   explicit EpochGuard(EpochManager *manager);
+        //   ~EpochGuard();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CRITICAL SECTIONS" << endl
+                          << "=========================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            Obj mY;       const Obj& Y = mY;
+
+            ASSERT(&ta               == X.allocator());
+            ASSERT(&defaultAllocator == Y.allocator());
+
+            ASSERT(!X.isInCriticalSection());
+            ASSERT(!Y.isInCriticalSection());
+
+            mX.enter();
+            ASSERT( X.isInCriticalSection());
+            ASSERT(!Y.isInCriticalSection());
+            ASSERT(0 < ta.numBlocksInUse());
+
+            mX.enter();
+            ASSERT( X.isInCriticalSection());
+
+            mX.leave();
+            ASSERT( X.isInCriticalSection());
+
+            mX.leave();
+            ASSERT(!X.isInCriticalSection());
+
+            {
+                Guard guardY(&mY);
+                ASSERT(!X.isInCriticalSection());
+                ASSERT( Y.isInCriticalSection());
+                {
+                    Guard guardX(&mX);
+                    Guard guardY2(&mY);
+                    ASSERT( X.isInCriticalSection());
+                    ASSERT( Y.isInCriticalSection());
+                }
+                ASSERT(!X.isInCriticalSection());
+                ASSERT( Y.isInCriticalSection());
+            }
+            ASSERT(!X.isInCriticalSection());
+            ASSERT(!Y.isInCriticalSection());
+            ASSERT(0 < defaultAllocator.numBlocksInUse());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksInUse(),
+                0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Retire and reclaim objects with and without a critical section
+        //:   in progress.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            bsl::vector<int> reclaimed(&ta);
+            int              a = 1;
+            int              b = 2;
+
+            Obj mX(&ta);
+
+            mX.enter();
+            mX.retire(&a, &countingDeleter, &reclaimed);
+            ASSERT(0 == mX.reclaim());
+            mX.leave();
+
+            ASSERT(1 == mX.reclaim());
+            ASSERT(1 == reclaimed.size());
+
+            mX.retire(&b, &countingDeleter, &reclaimed);
+            mX.synchronize();
+            ASSERT(2 == reclaimed.size());
+            ASSERT(1 == reclaimed[0] && 2 == reclaimed[1]);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // CONCERN: PERFORMANCE OF A CRITICAL SECTION
+        //
+        // Concerns:
+        //: 1 Entering and leaving a critical section is cheap, and does not
+        //:   degrade as the number of reading threads grows.
+        //
+        // Plan:
+        //: 1 For 1, 2, and 4 threads, measure the time taken by each thread
+        //:   to enter and leave a critical section 'k_NUM_ITERATIONS' times
+        //:   while reading a shared value, and report the time per critical
+        //:   section.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: PERFORMANCE OF A CRITICAL SECTION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: PERFORMANCE OF A CRITICAL SECTION"
+                          << endl
+                          << "=========================================="
+                          << endl;
+
+        for (int numThreads = 1; numThreads <= 4; numThreads *= 2) {
+            Obj         mX;
+            BenchState  state;
+            state.d_manager_p = &mX;
+            state.d_sum       = 0;
+
+            bslmt::ThreadUtil::Handle handles[4];
+
+            bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+            for (int i = 0; i < numThreads; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      &benchReader,
+                                                      &state));
+            }
+            for (int i = 0; i < numThreads; ++i) {
+                bslmt::ThreadUtil::join(handles[i]);
+            }
+            const double elapsed = (bsls::SystemTime::nowMonotonicClock() -
+                                               start).totalSecondsAsDouble();
+
+            cout << "threads: " << numThreads
+                 << "  ns/critical section: "
+                 << elapsed * 1e9 / (numThreads * k_BENCH_ITERATIONS)
+                 << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------------------------------------------------------
@@ -44,6 +44,26 @@ BSLS_IDENT("$Id: $")
 //
 // Note that an object catalog has a maximum capacity of 2^23 items.
 //
+///Lock-Free Lookup
+///----------------
+// The 'find' methods do not lock the catalog: they locate the object having a
+// handle in a table that is never reallocated (it grows by appending chunks of
+// geometrically increasing size), within a critical section of a
+// 'bdlcc::EpochManager' owned by the catalog.  Removing or replacing an object
+// therefore does not destroy it immediately: the object is retired to the
+// epoch manager, and is destroyed (and its node reused) only once no 'find'
+// that could have located it is still in progress.  As a consequence, lookups
+// scale with the number of reading threads, as they neither contend on a lock
+// nor write to memory shared with other threads.  All other operations,
+// including iteration, are serialized by a read-write lock, as are the
+// lookups performed through an iterator.
+//
+// Note that 'remove', when supplied a buffer into which the removed object is
+// moved, waits until all the 'find' operations in progress at the time of the
+// call complete, as the object must not be modified while a concurrent 'find'
+// may be copying it.  The wait is short, as 'find' never blocks, but it is
+// performed while holding the write lock of the catalog.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -265,6 +285,10 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlscm_version.h>
 
+#include <bdlcc_epochmanager.h>
+
+#include <bdlb_bitutil.h>
+
 #include <bslmt_rwmutex.h>
 #include <bslmt_readlockguard.h>
 #include <bslmt_writelockguard.h>
@@ -274,7 +298,9 @@ BSLS_IDENT("$Id: $")
 #include <bslalg_scalarprimitives.h>
 
 #include <bslma_allocator.h>
+#include <bslma_deallocatorproctor.h>
 #include <bslma_default.h>
+#include <bslma_destructorproctor.h>
 #include <bslma_usesbslmaallocator.h>
 
 #include <bslmf_movableref.h>
@@ -288,6 +314,8 @@ BSLS_IDENT("$Id: $")
 #include <bsls_platform.h>
 #include <bsls_review.h>
 
+#include <bsl_cstdint.h>
+#include <bsl_new.h>
 #include <bsl_utility.h>
 #include <bsl_vector.h>
 
@@ -380,6 +408,15 @@ class ObjectCatalog {
         k_GENERATION_MASK = 0xff000000
     };
 
+    enum {
+        // The node table is made of 'k_NUM_CHUNKS' chunks, where chunk 'i'
+        // holds '2^(i + k_CHUNK_SHIFT)' node addresses; together, the chunks
+        // can address 'k_INDEX_MASK + 1' nodes.
+
+        k_CHUNK_SHIFT = 5,
+        k_NUM_CHUNKS  = 19
+    };
+
     struct Node {
         // PUBLIC DATA
         typedef union {
@@ -389,16 +426,29 @@ class ObjectCatalog {
             Node                               *d_next_p; // when free, pointer
                                                           // to next free node
         } Payload;
-        Payload d_payload;
-        int     d_handle;
+        Payload         d_payload;
+        bsls::AtomicInt d_handle;
     };
 
+    typedef bsls::AtomicPointer<Node> NodeSlot;
+
     // DATA
-    bsl::vector<Node *>     d_nodes;
-    bdlma::Pool             d_nodePool;
-    Node                   *d_nextFreeNode_p;
-    bsls::AtomicInt         d_length;
-    mutable bslmt::RWMutex  d_lock;
+    NodeSlot                *d_chunks[k_NUM_CHUNKS];  // node table, allocated
+                                                      // by chunk on demand
+
+    bsls::AtomicInt          d_numNodes;              // number of nodes in
+                                                      // the table
+
+    bdlma::Pool              d_nodePool;
+    Node                    *d_nextFreeNode_p;
+    int                      d_numRetiredNodes;       // removed nodes waiting
+                                                      // to be freed
+
+    bsls::AtomicInt          d_length;
+    mutable EpochManager     d_epochManager;          // protects lock-free
+                                                      // lookups
+
+    mutable bslmt::RWMutex   d_lock;
 
   private:
     // NOT IMPLEMENTED
@@ -411,23 +461,47 @@ class ObjectCatalog {
 
   private:
     // PRIVATE CLASS METHODS
+    static int chunkOf(int index);
+        // Return the index of the chunk of the node table holding the slot
+        // having the specified 'index'.
+
+    static void deallocateNode(void *node, void *catalog);
+        // Destroy the object held in the specified 'node' and return 'node'
+        // to the node pool of the specified 'catalog'.  This function is the
+        // deleter of the nodes retired by 'replace'.
+
     static TYPE *getNodeValue(Node *node);
         // Return a pointer to the 'd_value' field of the specified 'node'.
         // The behavior is undefined unless '0 != node' and
         // 'node->d_payload.d_value' is initialized to a 'TYPE' object.
 
+    static void recycleNode(void *node, void *catalog);
+        // Destroy the object held in the specified 'node' and add 'node' to
+        // the free node list of the specified 'catalog'.  This function is the
+        // deleter of the nodes retired by 'remove'.
+
     // PRIVATE MANIPULATORS
     void freeNode(Node *node);
-        // Add the specified 'node' to the free node list.  Destruction of the
-        // object held in the node must be handled by the 'remove' function
-        // directly.  (This is because 'freeNode' is also used in the
-        // 'ObjectCatalog_AutoCleanup' guard, but there it should not invoke
-        // the object's destructor.)
+        // Add the specified 'node', whose handle is not marked busy, to the
+        // free node list.  Destruction of the object held in the node must be
+        // handled by the caller.  (This is because 'freeNode' is also used in
+        // the 'ObjectCatalog_AutoCleanup' guard, but there it should not
+        // invoke the object's destructor.)
+
+    NodeSlot *allocateSlot(int index);
+        // Return the address of the slot of the node table having the
+        // specified 'index', allocating the chunk holding it if needed.
 
     // PRIVATE ACCESSORS
     Node *findNode(int handle) const;
         // Return a pointer to the node with the specified 'handle', or 0 if
-        // not found.
+        // not found.  Note that this method may be called without holding
+        // 'd_lock', from a critical section of 'd_epochManager'.
+
+    NodeSlot& slot(int index) const;
+        // Return a reference to the slot of the node table having the
+        // specified 'index'.  The behavior is undefined unless the chunk
+        // holding the slot is allocated.
 
   public:
     // TRAITS
@@ -461,6 +535,9 @@ class ObjectCatalog {
         // this catalog.  Return zero on success, and a non-zero value if the
         // 'handle' is not contained in this catalog.  Note that 'valueBuffer'
         // is assigned into, and thus must point to a valid 'TYPE' instance.
+        // Also note that, if 'valueBuffer' is supplied, this method waits
+        // for the completion of the 'find' operations in progress (see
+        // {Lock-Free Lookup}).
 
     void removeAll(bsl::vector<TYPE> *buffer = 0);
         // Remove all objects that are currently held in this catalog and
@@ -490,7 +567,8 @@ class ObjectCatalog {
         // this catalog.  Note that 'valueBuffer' is assigned into, and thus
         // must point to a valid 'TYPE' instance.  Note that the overload with
         // 'valueBuffer' passed is not supported unless 'TYPE' has a copy
-        // constructor.
+        // constructor.  Also note that these methods do not lock this catalog
+        // (see {Lock-Free Lookup}).
 
     bool isMember(const TYPE& object) const;
         // Return 'true' if the catalog contains an item that compares equal to
@@ -645,6 +723,29 @@ void ObjectCatalog_AutoCleanup<TYPE>::release()
                             // -------------------
 
 // PRIVATE CLASS METHODS
+template <class TYPE>
+inline
+int ObjectCatalog<TYPE>::chunkOf(int index)
+{
+    // Chunk 'i' holds the indices in the range
+    // '[(2^i - 1) * 2^k_CHUNK_SHIFT, (2^(i + 1) - 1) * 2^k_CHUNK_SHIFT)'.
+
+    const bsl::uint32_t chunkNumber = (static_cast<bsl::uint32_t>(index) >>
+                                                           k_CHUNK_SHIFT) + 1;
+
+    return 31 - bdlb::BitUtil::numLeadingUnsetBits(chunkNumber);
+}
+
+template <class TYPE>
+void ObjectCatalog<TYPE>::deallocateNode(void *node, void *catalog)
+{
+    ObjectCatalog *object = static_cast<ObjectCatalog *>(catalog);
+    Node          *n      = static_cast<Node *>(node);
+
+    getNodeValue(n)->~TYPE();
+    object->d_nodePool.deallocate(n);
+}
+
 template <class TYPE>
 inline
 TYPE *ObjectCatalog<TYPE>::getNodeValue(
@@ -655,56 +756,101 @@ TYPE *ObjectCatalog<TYPE>::getNodeValue(
     return node->d_payload.d_value.address();
 }
 
+template <class TYPE>
+void ObjectCatalog<TYPE>::recycleNode(void *node, void *catalog)
+{
+    ObjectCatalog *object = static_cast<ObjectCatalog *>(catalog);
+    Node          *n      = static_cast<Node *>(node);
+
+    getNodeValue(n)->~TYPE();
+    object->freeNode(n);
+    --object->d_numRetiredNodes;
+}
+
 // PRIVATE MANIPULATORS
 template <class TYPE>
 inline
 void ObjectCatalog<TYPE>::freeNode(typename ObjectCatalog<TYPE>::Node *node)
 {
-    BSLS_ASSERT(node->d_handle & k_BUSY_INDICATOR);
-
-    node->d_handle += k_GENERATION_INC;
-    node->d_handle &= ~k_BUSY_INDICATOR;
+    BSLS_ASSERT(!(node->d_handle.loadRelaxed() & k_BUSY_INDICATOR));
 
     node->d_payload.d_next_p = d_nextFreeNode_p;
     d_nextFreeNode_p = node;
 }
 
+template <class TYPE>
+typename ObjectCatalog<TYPE>::NodeSlot *
+ObjectCatalog<TYPE>::allocateSlot(int index)
+{
+    const int chunk = chunkOf(index);
+
+    if (0 == d_chunks[chunk]) {
+        const int size = 1 << (chunk + k_CHUNK_SHIFT);
+
+        NodeSlot *slots = static_cast<NodeSlot *>(
+                               allocator()->allocate(size * sizeof(NodeSlot)));
+        for (int i = 0; i < size; ++i) {
+            new (slots + i) NodeSlot(0);
+        }
+        d_chunks[chunk] = slots;
+    }
+    return &slot(index);
+}
+
 // PRIVATE ACCESSORS
 template <class TYPE>
 inline
 typename ObjectCatalog<TYPE>::Node *
 ObjectCatalog<TYPE>::findNode(int handle) const
 {
+    // The loads below are sequentially consistent, as required for lookups
+    // performed in a critical section of 'd_epochManager'.
+
     int index = handle & k_INDEX_MASK;
-    // if (d_nodes.size() < index || !(handle & k_BUSY_INDICATOR)) return 0;
 
-    if (0 > index                    ||
-        index >= (int)d_nodes.size() ||
-        !(handle & k_BUSY_INDICATOR)) {
+    if (index >= d_numNodes.load() || !(handle & k_BUSY_INDICATOR)) {
         return 0;                                                     // RETURN
     }
 
-    Node *node = d_nodes[index];
+    Node *node = slot(index).load();
 
-    return node->d_handle == handle ? node : 0;
+    return node->d_handle.load() == handle ? node : 0;
+}
+
+template <class TYPE>
+inline
+typename ObjectCatalog<TYPE>::NodeSlot&
+ObjectCatalog<TYPE>::slot(int index) const
+{
+    const int chunk = chunkOf(index);
+
+    return d_chunks[chunk][index - (((1 << chunk) - 1) << k_CHUNK_SHIFT)];
 }
 
 // CREATORS
 template <class TYPE>
 inline
 ObjectCatalog<TYPE>::ObjectCatalog(bslma::Allocator *allocator)
-: d_nodes(allocator)
+: d_numNodes(0)
 , d_nodePool(sizeof(Node), allocator)
 , d_nextFreeNode_p(0)
+, d_numRetiredNodes(0)
 , d_length(0)
+, d_epochManager(allocator)
 {
+    for (int i = 0; i < k_NUM_CHUNKS; ++i) {
+        d_chunks[i] = 0;
+    }
 }
 
 template <class TYPE>
-inline
 ObjectCatalog<TYPE>::~ObjectCatalog()
 {
     removeAll();
+
+    for (int i = 0; i < k_NUM_CHUNKS; ++i) {
+        allocator()->deallocate(d_chunks[i]);
+    }
 }
 
 // MANIPULATORS
@@ -723,35 +869,43 @@ int ObjectCatalog<TYPE>::add(const TYPE& object)
         proctor.manageNode(node, false);
         // Destruction of this proctor will put node back onto the free list.
     } else {
-        // If 'd_nodes' grows as big as the flags used to indicate BUSY and
-        // generations, then the handle will be all mixed up!
+        // If the node table grows as big as the flags used to indicate BUSY
+        // and generations, then the handle will be all mixed up!
+
+        const int index = d_numNodes.loadRelaxed();
 
-        BSLS_REVIEW_OPT(d_nodes.size() < k_BUSY_INDICATOR);
+        BSLS_REVIEW_OPT(index < k_BUSY_INDICATOR);
 
         node = static_cast<Node *>(d_nodePool.allocate());
         proctor.manageNode(node, true);
         // Destruction of this proctor will deallocate node.
 
-        d_nodes.push_back(node);
-        node->d_handle = static_cast<int>(d_nodes.size()) - 1;
+        NodeSlot *nodeSlot = allocateSlot(index);
+        node->d_handle.storeRelaxed(index);
+        nodeSlot->store(node);
+        d_numNodes.store(index + 1);
         proctor.manageNode(node, false);
         // Destruction of this proctor will put node back onto the free list,
-        // which is now OK since the 'push_back' succeeded without throwing.
+        // which is now OK since the node was added to the table.
     }
 
-    node->d_handle |= k_BUSY_INDICATOR;
-    handle = node->d_handle;
+    handle = node->d_handle.loadRelaxed() | k_BUSY_INDICATOR;
 
     // We need to use the copyConstruct logic to pass the allocator through.
 
-    bslalg::ScalarPrimitives::copyConstruct(
-              getNodeValue(node), object, d_nodes.get_allocator().mechanism());
+    bslalg::ScalarPrimitives::copyConstruct(getNodeValue(node),
+                                            object,
+                                            allocator());
 
     // If the copy constructor throws, the proctor will properly put the node
     // back onto the free list.  Otherwise, the proctor should do nothing.
 
     proctor.release();
 
+    // Marking the node busy publishes the object to 'find'.
+
+    node->d_handle.store(handle);
+
     ++d_length;
     return handle;
 }
@@ -773,41 +927,48 @@ int ObjectCatalog<TYPE>::add(bslmf::MovableRef<TYPE> object)
         proctor.manageNode(node, false);
         // Destruction of this proctor will put node back onto the free list.
     } else {
-        // If 'd_nodes' grows as big as the flags used to indicate BUSY and
-        // generations, then the handle will be all mixed up!
+        // If the node table grows as big as the flags used to indicate BUSY
+        // and generations, then the handle will be all mixed up!
 
-        BSLS_REVIEW_OPT(d_nodes.size() < k_BUSY_INDICATOR);
+        const int index = d_numNodes.loadRelaxed();
+
+        BSLS_REVIEW_OPT(index < k_BUSY_INDICATOR);
 
         node = static_cast<Node *>(d_nodePool.allocate());
         proctor.manageNode(node, true);
         // Destruction of this proctor will deallocate node.
 
-        d_nodes.push_back(node);
-        node->d_handle = static_cast<int>(d_nodes.size()) - 1;
+        NodeSlot *nodeSlot = allocateSlot(index);
+        node->d_handle.storeRelaxed(index);
+        nodeSlot->store(node);
+        d_numNodes.store(index + 1);
         proctor.manageNode(node, false);
         // Destruction of this proctor will put node back onto the free list,
-        // which is now OK since the 'push_back' succeeded without throwing.
+        // which is now OK since the node was added to the table.
     }
 
-    node->d_handle |= k_BUSY_INDICATOR;
-    handle = node->d_handle;
+    handle = node->d_handle.loadRelaxed() | k_BUSY_INDICATOR;
 
     // We need to use the moveConstruct logic to pass the allocator through.
 
-    bslalg::ScalarPrimitives::moveConstruct(
-               getNodeValue(node), local, d_nodes.get_allocator().mechanism());
+    bslalg::ScalarPrimitives::moveConstruct(getNodeValue(node),
+                                            local,
+                                            allocator());
 
     // If the copy constructor throws, the proctor will properly put the node
     // back onto the free list.  Otherwise, the proctor should do nothing.
 
     proctor.release();
 
+    // Marking the node busy publishes the object to 'find'.
+
+    node->d_handle.store(handle);
+
     ++d_length;
     return handle;
 }
 
 template <class TYPE>
-inline
 int ObjectCatalog<TYPE>::remove(int handle, TYPE *valueBuffer)
 {
     bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_lock);
@@ -818,14 +979,32 @@ int ObjectCatalog<TYPE>::remove(int handle, TYPE *valueBuffer)
         return -1;                                                    // RETURN
     }
 
-    TYPE *value = getNodeValue(node);
-
     if (valueBuffer) {
+        // The object is modified by the move below, so wait for the 'find'
+        // operations that may be reading it before reusing the node
+        // immediately.
+
+        node->d_handle.store((handle + k_GENERATION_INC) & ~k_BUSY_INDICATOR);
+        d_epochManager.synchronize();
+
+        TYPE *value = getNodeValue(node);
+
         *valueBuffer = bslmf::MovableRefUtil::move(*value);
+
+        value->~TYPE();
+        freeNode(node);
     }
+    else {
+        // Note that the node can be retired before it is unlinked (by
+        // clearing its busy flag), since the epoch cannot advance while the
+        // write lock is held.
+
+        d_epochManager.retire(node, &recycleNode, this);
+        ++d_numRetiredNodes;
 
-    value->~TYPE();
-    freeNode(node);
+        node->d_handle.store((handle + k_GENERATION_INC) & ~k_BUSY_INDICATOR);
+        d_epochManager.reclaim();
+    }
 
     --d_length;
     return 0;
@@ -834,13 +1013,20 @@ int ObjectCatalog<TYPE>::remove(int handle, TYPE *valueBuffer)
 template <class TYPE>
 void ObjectCatalog<TYPE>::removeAll(bsl::vector<TYPE> *buffer)
 {
-    typedef typename bsl::vector<Node *>::iterator VIt;
-
     bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_lock);
 
-    for (VIt it = d_nodes.begin(); it != d_nodes.end(); ++it) {
-        if ((*it)->d_handle & k_BUSY_INDICATOR) {
-            TYPE *value = getNodeValue(*it);
+    // Empty the node table, then wait for the 'find' operations that may be
+    // accessing nodes (which also frees the retired nodes).
+
+    const int numNodes = d_numNodes.loadRelaxed();
+    d_numNodes.store(0);
+    d_epochManager.synchronize();
+
+    for (int i = 0; i < numNodes; ++i) {
+        Node *node = slot(i).loadRelaxed();
+
+        if (node->d_handle.loadRelaxed() & k_BUSY_INDICATOR) {
+            TYPE *value = getNodeValue(node);
 
             if (buffer) {
                 buffer->push_back(bslmf::MovableRefUtil::move(*value));
@@ -849,14 +1035,13 @@ void ObjectCatalog<TYPE>::removeAll(bsl::vector<TYPE> *buffer)
         }
     }
 
-    // Even though we get rid of the container of 'Node *' without returning
-    // the nodes to the pool prior, the release of the pool immediately after
-    // will properly (and efficiently) dispose of those nodes without leaking
-    // memory.
+    // Even though we empty the node table without returning the nodes to the
+    // pool prior, the release of the pool immediately after will properly
+    // (and efficiently) dispose of those nodes without leaking memory.
 
-    d_nodes.clear();
     d_nodePool.release();
     d_nextFreeNode_p = 0;
+    d_numRetiredNodes = 0;
     d_length = 0;
 }
 
@@ -871,14 +1056,27 @@ int ObjectCatalog<TYPE>::replace(int handle, const TYPE& newObject)
         return -1;                                                    // RETURN
     }
 
-    TYPE *value = getNodeValue(node);
+    // As a 'find' may be copying the current object, the new object is held
+    // by a new node, and the current node is retired.
+
+    Node *newNode = static_cast<Node *>(d_nodePool.allocate());
+    bslma::DeallocatorProctor<bdlma::Pool> nodeProctor(newNode, &d_nodePool);
 
-    value->~TYPE();
+    TYPE *value = getNodeValue(newNode);
 
     // We need to use the copyConstruct logic to pass the allocator through.
 
-    bslalg::ScalarPrimitives::copyConstruct(
-                        value, newObject, d_nodes.get_allocator().mechanism());
+    bslalg::ScalarPrimitives::copyConstruct(value, newObject, allocator());
+    bslma::DestructorProctor<TYPE> valueProctor(value);
+
+    d_epochManager.retire(node, &deallocateNode, this);
+
+    valueProctor.release();
+    nodeProctor.release();
+
+    newNode->d_handle.storeRelaxed(handle);
+    slot(handle & k_INDEX_MASK).store(newNode);
+    d_epochManager.reclaim();
 
     return 0;
 }
@@ -896,14 +1094,24 @@ int ObjectCatalog<TYPE>::replace(int handle, bslmf::MovableRef<TYPE> newObject)
         return -1;                                                    // RETURN
     }
 
-    TYPE *value = getNodeValue(node);
+    Node *newNode = static_cast<Node *>(d_nodePool.allocate());
+    bslma::DeallocatorProctor<bdlma::Pool> nodeProctor(newNode, &d_nodePool);
 
-    value->~TYPE();
+    TYPE *value = getNodeValue(newNode);
 
     // We need to use the moveConstruct logic to pass the allocator through.
 
-    bslalg::ScalarPrimitives::moveConstruct(
-                            value, local, d_nodes.get_allocator().mechanism());
+    bslalg::ScalarPrimitives::moveConstruct(value, local, allocator());
+    bslma::DestructorProctor<TYPE> valueProctor(value);
+
+    d_epochManager.retire(node, &deallocateNode, this);
+
+    valueProctor.release();
+    nodeProctor.release();
+
+    newNode->d_handle.storeRelaxed(handle);
+    slot(handle & k_INDEX_MASK).store(newNode);
+    d_epochManager.reclaim();
 
     return 0;
 }
@@ -920,7 +1128,7 @@ template <class TYPE>
 inline
 int ObjectCatalog<TYPE>::find(int handle) const
 {
-    bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_lock);
+    EpochGuard guard(&d_epochManager);
 
     return 0 == findNode(handle) ? -1 : 0;
 }
@@ -929,7 +1137,7 @@ template <class TYPE>
 inline
 int ObjectCatalog<TYPE>::find(int handle, TYPE *valueBuffer) const
 {
-    bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_lock);
+    EpochGuard guard(&d_epochManager);
 
     Node *node = findNode(handle);
 
@@ -977,24 +1185,26 @@ void ObjectCatalog<TYPE>::verifyState() const
 {
     bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_lock);
 
-    BSLS_ASSERT(             0 <= d_length);
-    BSLS_ASSERT(d_nodes.size() >= static_cast<unsigned>(d_length));
+    const int numNodes = d_numNodes.loadRelaxed();
 
-    unsigned numBusy = 0, numFree = 0;
-    for (unsigned ii = 0; ii < d_nodes.size(); ++ii) {
-        const int handle = d_nodes[ii]->d_handle;
+    BSLS_ASSERT(       0 <= d_length);
+    BSLS_ASSERT(numNodes >= d_length);
+
+    int numBusy = 0, numFree = 0;
+    for (int ii = 0; ii < numNodes; ++ii) {
+        const int handle = slot(ii).loadRelaxed()->d_handle.loadRelaxed();
         BSLS_ASSERT((handle & k_INDEX_MASK) == ii);
         handle & k_BUSY_INDICATOR ? ++numBusy
                                   : ++numFree;
     }
-    BSLS_ASSERT(          numBusy == static_cast<unsigned>(d_length));
-    BSLS_ASSERT(numFree + numBusy == d_nodes.size());
+    BSLS_ASSERT(          numBusy == d_length);
+    BSLS_ASSERT(numFree + numBusy == numNodes);
 
     for (const Node *p = d_nextFreeNode_p; p; p = p->d_payload.d_next_p) {
-        BSLS_ASSERT(!(p->d_handle & k_BUSY_INDICATOR));
+        BSLS_ASSERT(!(p->d_handle.loadRelaxed() & k_BUSY_INDICATOR));
         --numFree;
     }
-    BSLS_ASSERT(0 == numFree);
+    BSLS_ASSERT(d_numRetiredNodes == numFree);
 }
 
                             // -----------------
@@ -1023,9 +1233,11 @@ ObjectCatalogIter<TYPE>::~ObjectCatalogIter()
 template <class TYPE>
 void ObjectCatalogIter<TYPE>::operator++()
 {
+    const int numNodes = d_catalog_p->d_numNodes.loadRelaxed();
+
     ++d_index;
-    while ((unsigned)d_index < d_catalog_p->d_nodes.size() &&
-          !(d_catalog_p->d_nodes[d_index]->d_handle &
+    while (d_index < numNodes &&
+          !(d_catalog_p->slot(d_index).loadRelaxed()->d_handle.loadRelaxed() &
               ObjectCatalog<TYPE>::k_BUSY_INDICATOR)) {
         ++d_index;
     }
@@ -1035,18 +1247,21 @@ template <class TYPE>
 inline
 int ObjectCatalogIter<TYPE>::handle() const
 {
-    BSLS_ASSERT(static_cast<unsigned>(d_index) < d_catalog_p->d_nodes.size());
+    BSLS_ASSERT(static_cast<unsigned>(d_index) <
+                static_cast<unsigned>(d_catalog_p->d_numNodes.loadRelaxed()));
 
-    return d_catalog_p->d_nodes[d_index]->d_handle;
+    return d_catalog_p->slot(d_index).loadRelaxed()->d_handle.loadRelaxed();
 }
 
 template <class TYPE>
 inline
 const TYPE& ObjectCatalogIter<TYPE>::value() const
 {
-    BSLS_ASSERT(static_cast<unsigned>(d_index) < d_catalog_p->d_nodes.size());
+    BSLS_ASSERT(static_cast<unsigned>(d_index) <
+                static_cast<unsigned>(d_catalog_p->d_numNodes.loadRelaxed()));
 
-    return *ObjectCatalog<TYPE>::getNodeValue(d_catalog_p->d_nodes[d_index]);
+    return *ObjectCatalog<TYPE>::getNodeValue(
+                                    d_catalog_p->slot(d_index).loadRelaxed());
 }
 
 }  // close package namespace
@@ -1056,7 +1271,8 @@ template <class TYPE>
 inline
 bdlcc::ObjectCatalogIter<TYPE>::operator const void *() const
 {
-    return static_cast<unsigned>(d_index) < d_catalog_p->d_nodes.size()
+    return static_cast<unsigned>(d_index) <
+                   static_cast<unsigned>(d_catalog_p->d_numNodes.loadRelaxed())
          ? this
          : 0;
 }
@@ -1069,9 +1285,10 @@ bsl::pair<int, TYPE> ObjectCatalogIter<TYPE>::operator()() const
 {
     typedef ObjectCatalog<TYPE> Catalog;
 
-    typename Catalog::Node *node = d_catalog_p->d_nodes[d_index];
+    typename Catalog::Node *node = d_catalog_p->slot(d_index).loadRelaxed();
 
-    return bsl::pair<int, TYPE>(node->d_handle, *Catalog::getNodeValue(node));
+    return bsl::pair<int, TYPE>(node->d_handle.loadRelaxed(),
+                                *Catalog::getNodeValue(node));
 }
 
 }  // close package namespace
@@ -31,6 +31,7 @@
 #include <bsls_assert.h>
 #include <bsls_nameof.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 #include <bsltf_movestate.h>
 #include <bsltf_streamutil.h>
@@ -120,7 +121,9 @@ using namespace bsl;  // automatically added by script
 // [12] TESTING OBJECT CONSTRUCTION/DESTRUCTION WITH ALLOCATORS
 // [13] TESTING STALE HANDLE REJECTION
 // [14] CONCURRENCY TEST
-// [16] USAGE EXAMPLE
+// [16] CONCERN: 'find' DOES NOT OBSERVE REMOVED OR REPLACED OBJECTS
+// [17] USAGE EXAMPLE
+// [-1] CONCERN: PERFORMANCE OF CONCURRENT 'find'
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -2149,6 +2152,208 @@ void queryCallBack(const QueryResult& result)
 
 }  // close namespace OBJECTCATALOG_TEST_USAGE_EXAMPLE
 
+// ============================================================================
+//                         CASE 16 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace OBJECTCATALOG_TEST_CASE_16
+
+{
+
+class CheckedValue {
+    // This class holds the handle under which an object is (or is about to
+    // be) stored in a catalog, and a marker that is cleared when the object
+    // is destroyed, so that a copy of a destroyed object, or of an object
+    // stored under another handle, can be detected.
+
+    enum { k_ALIVE = 0x600DF00D, k_DEAD = 0x0BADBAD0 };
+
+    // DATA
+    int d_handle;
+    int d_marker;
+
+  public:
+    // CREATORS
+    explicit CheckedValue(int handle = -1)
+    : d_handle(handle)
+    , d_marker(k_ALIVE)
+        // Create an object holding the optionally specified 'handle'.
+    {
+    }
+
+    CheckedValue(const CheckedValue& original)
+    : d_handle(original.d_handle)
+    , d_marker(original.d_marker)
+        // Create an object having the value of the specified 'original'.
+    {
+    }
+
+    ~CheckedValue()
+        // Mark this object as destroyed, and destroy it.
+    {
+        d_marker = k_DEAD;
+        d_handle = -2;
+    }
+
+    // MANIPULATORS
+    CheckedValue& operator=(const CheckedValue& rhs)
+        // Assign to this object the value of the specified 'rhs', and return
+        // a reference providing modifiable access to this object.
+    {
+        d_handle = rhs.d_handle;
+        d_marker = rhs.d_marker;
+        return *this;
+    }
+
+    // ACCESSORS
+    bool isValidFor(int handle) const
+        // Return 'true' if this object is a copy of an object that was not
+        // destroyed and was stored under the specified 'handle' (or not yet
+        // assigned a handle), and 'false' otherwise.
+    {
+        return k_ALIVE == d_marker && (handle == d_handle || -1 == d_handle);
+    }
+};
+
+typedef bdlcc::ObjectCatalog<CheckedValue> Catalog;
+
+enum {
+    k_NUM_WRITERS    = 2,
+    k_NUM_READERS    = 4,
+    k_NUM_PUBLISHED  = 16,
+    k_NUM_ITERATIONS = 20000
+};
+
+struct SharedState {
+    // This 'struct' holds the state shared by the threads of test case 16.
+
+    // PUBLIC DATA
+    Catalog         *d_catalog_p;
+    bsls::AtomicInt  d_published[k_NUM_WRITERS][k_NUM_PUBLISHED];
+    bsls::AtomicInt  d_numWritersDone;
+    bsls::AtomicInt  d_numErrors;
+    bsls::AtomicInt  d_numFound;
+};
+
+SharedState *g_state_p = 0;
+
+extern "C" void *writerThread(void *arg)
+    // Add objects to the catalog of the shared state, publish their handles,
+    // then replace and remove them, alternating between the overloads of
+    // 'remove'.  The specified 'arg' is the index of the writer.
+{
+    SharedState *state = g_state_p;
+    const int    id    = static_cast<int>(
+                                   reinterpret_cast<bsls::Types::IntPtr>(arg));
+
+    for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+        bsls::AtomicInt& published = state->d_published[id]
+                                                        [i % k_NUM_PUBLISHED];
+
+        const int previous = published.load();
+        if (0 != previous) {
+            if (i & 1) {
+                CheckedValue buffer;
+                ASSERTV(i, 0 == state->d_catalog_p->remove(previous, &buffer));
+                ASSERTV(i, buffer.isValidFor(previous));
+            }
+            else {
+                ASSERTV(i, 0 == state->d_catalog_p->remove(previous));
+            }
+        }
+
+        const int handle = state->d_catalog_p->add(CheckedValue());
+        ASSERTV(i, 0 == state->d_catalog_p->replace(handle,
+                                                    CheckedValue(handle)));
+        published.store(handle);
+    }
+    ++state->d_numWritersDone;
+    return 0;
+}
+
+extern "C" void *readerThread(void *)
+    // Repeatedly look up the handles published in the shared state, and
+    // count the objects found that are not valid for their handle.
+{
+    SharedState *state = g_state_p;
+
+    int numFound = 0;
+    while (k_NUM_WRITERS != state->d_numWritersDone) {
+        for (int w = 0; w < k_NUM_WRITERS; ++w) {
+            for (int j = 0; j < k_NUM_PUBLISHED; ++j) {
+                const int    handle = state->d_published[w][j].load();
+                CheckedValue value;
+
+                if (0 != handle &&
+                               0 == state->d_catalog_p->find(handle, &value)) {
+                    ++numFound;
+                    if (!value.isValidFor(handle)) {
+                        ++state->d_numErrors;
+                    }
+                }
+            }
+        }
+    }
+    state->d_numFound += numFound;
+    return 0;
+}
+
+}  // close namespace OBJECTCATALOG_TEST_CASE_16
+
+// ============================================================================
+//                         CASE -1 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace OBJECTCATALOG_TEST_CASE_MINUS_1
+
+{
+
+enum {
+    k_NUM_HANDLES = 1024,
+    k_NUM_LOOKUPS = 4 * 1000 * 1000
+};
+
+struct BenchState {
+    // This 'struct' holds the state shared by the threads of the benchmark.
+
+    // PUBLIC DATA
+    bdlcc::ObjectCatalog<int> *d_catalog_p;
+    int                        d_handles[k_NUM_HANDLES];
+    bsls::AtomicInt            d_stop;
+    bsls::AtomicInt            d_sum;
+};
+
+extern "C" void *benchReader(void *arg)
+    // Look up 'k_NUM_LOOKUPS' handles in the catalog of the 'BenchState' at
+    // the specified 'arg'.
+{
+    BenchState *state = static_cast<BenchState *>(arg);
+
+    int sum = 0;
+    for (int i = 0; i < k_NUM_LOOKUPS; ++i) {
+        int value = 0;
+        state->d_catalog_p->find(state->d_handles[i % k_NUM_HANDLES], &value);
+        sum += value;
+    }
+    state->d_sum += sum;
+    return 0;
+}
+
+extern "C" void *benchWriter(void *arg)
+    // Replace the objects of the catalog of the 'BenchState' at the specified
+    // 'arg' until its 'd_stop' flag is set.
+{
+    BenchState *state = static_cast<BenchState *>(arg);
+
+    for (int i = 0; !state->d_stop; ++i) {
+        state->d_catalog_p->replace(state->d_handles[i % k_NUM_HANDLES], i);
+        bslmt::ThreadUtil::yield();
+    }
+    return 0;
+}
+
+}  // close namespace OBJECTCATALOG_TEST_CASE_MINUS_1
+
 // ============================================================================
 //                         CASE 13 RELATED ENTITIES
 // ----------------------------------------------------------------------------
@@ -2495,7 +2700,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 16: {
+      case 17: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE:
         //   The usage example provided in the component header file must
@@ -2562,6 +2767,87 @@ int main(int argc, char *argv[])
 
         }
       } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // CONCERN: 'find' DOES NOT OBSERVE REMOVED OR REPLACED OBJECTS
+        //
+        // Concerns:
+        //: 1 'find', which does not lock the catalog, never copies an object
+        //:   that has been destroyed, nor an object stored under another
+        //:   handle, while other threads concurrently add, replace, and remove
+        //:   objects (using both overloads of 'remove').
+        //:
+        //: 2 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Create writer threads that add objects, each holding the handle
+        //:   under which it is stored, publish their handles, and later
+        //:   replace and remove them.  Create reader threads that repeatedly
+        //:   'find' the published handles and verify the objects found using
+        //:   a marker cleared by the destructor of the object type.  (C-1)
+        //:
+        //: 2 Verify the state of the catalog, then destroy it and verify that
+        //:   all the memory obtained from its allocator was released.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: 'find' DOES NOT OBSERVE REMOVED OR REPLACED OBJECTS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+             << "CONCERN: 'find' DOES NOT OBSERVE REMOVED OR REPLACED OBJECTS"
+             << endl
+             << "============================================================"
+             << endl;
+
+        using namespace OBJECTCATALOG_TEST_CASE_16;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            Catalog     catalog(&ta);
+            SharedState state;
+
+            state.d_catalog_p = &catalog;
+            for (int w = 0; w < k_NUM_WRITERS; ++w) {
+                for (int j = 0; j < k_NUM_PUBLISHED; ++j) {
+                    state.d_published[w][j] = 0;
+                }
+            }
+            g_state_p = &state;
+
+            bslmt::ThreadUtil::Handle writers[k_NUM_WRITERS];
+            bslmt::ThreadUtil::Handle readers[k_NUM_READERS];
+
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(&readers[i],
+                                                      &readerThread,
+                                                      0));
+            }
+            for (int i = 0; i < k_NUM_WRITERS; ++i) {
+                void *arg = reinterpret_cast<void *>(
+                                         static_cast<bsls::Types::IntPtr>(i));
+                ASSERT(0 == bslmt::ThreadUtil::create(&writers[i],
+                                                      &writerThread,
+                                                      arg));
+            }
+            for (int i = 0; i < k_NUM_WRITERS; ++i) {
+                bslmt::ThreadUtil::join(writers[i]);
+            }
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                bslmt::ThreadUtil::join(readers[i]);
+            }
+
+            if (veryVerbose) {
+                cout << "\tfound: " << state.d_numFound << endl;
+            }
+
+            ASSERTV(state.d_numErrors, 0 == state.d_numErrors);
+            ASSERT(k_NUM_WRITERS * k_NUM_PUBLISHED == catalog.length());
+
+            catalog.verifyState();
+            g_state_p = 0;
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
       case 15: {
         // --------------------------------------------------------------------
         // MULTI-TYPE MANIPULATORS / ACCESSORS TEST
@@ -3668,6 +3954,78 @@ int main(int argc, char *argv[])
                                 testCaseBreathingCopyable,
                                 BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // CONCERN: PERFORMANCE OF CONCURRENT 'find'
+        //
+        // Concerns:
+        //: 1 The throughput of 'find' grows with the number of reading
+        //:   threads, and is not significantly degraded by a concurrent
+        //:   writer.
+        //
+        // Plan:
+        //: 1 For 1, 2, and 4 reader threads, with and without a thread
+        //:   continuously replacing objects, measure the time taken by each
+        //:   reader to perform 'k_NUM_LOOKUPS' lookups, and report the time
+        //:   per lookup.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: PERFORMANCE OF CONCURRENT 'find'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: PERFORMANCE OF CONCURRENT 'find'"
+                          << endl
+                          << "========================================="
+                          << endl;
+
+        using namespace OBJECTCATALOG_TEST_CASE_MINUS_1;
+
+        for (int withWriter = 0; withWriter < 2; ++withWriter) {
+            for (int numReaders = 1; numReaders <= 4; numReaders *= 2) {
+                bdlcc::ObjectCatalog<int> catalog;
+                BenchState                state;
+
+                state.d_catalog_p = &catalog;
+                for (int i = 0; i < k_NUM_HANDLES; ++i) {
+                    state.d_handles[i] = catalog.add(i);
+                }
+
+                bslmt::ThreadUtil::Handle writer;
+                if (withWriter) {
+                    ASSERT(0 == bslmt::ThreadUtil::create(&writer,
+                                                          &benchWriter,
+                                                          &state));
+                }
+
+                bsls::Stopwatch timer;
+                timer.start();
+
+                bslmt::ThreadUtil::Handle readers[4];
+                for (int i = 0; i < numReaders; ++i) {
+                    ASSERT(0 == bslmt::ThreadUtil::create(&readers[i],
+                                                          &benchReader,
+                                                          &state));
+                }
+                for (int i = 0; i < numReaders; ++i) {
+                    bslmt::ThreadUtil::join(readers[i]);
+                }
+                timer.stop();
+
+                state.d_stop = 1;
+                if (withWriter) {
+                    bslmt::ThreadUtil::join(writer);
+                }
+
+                cout << "readers: " << numReaders
+                     << "  writer: " << (withWriter ? "yes" : "no ")
+                     << "  ns/find: "
+                     << timer.elapsedTime() * 1e9 /
+                                              (numReaders * k_NUM_LOOKUPS)
+                     << endl;
+            }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
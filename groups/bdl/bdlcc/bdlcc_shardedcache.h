@@ -0,0 +1,1001 @@
+// bdlcc_shardedcache.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLCC_SHARDEDCACHE
+#define INCLUDED_BDLCC_SHARDEDCACHE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a lock-striped in-process cache of independent shards.
+//
+//@CLASSES:
+//  bdlcc::ShardedCache: in-process key-value cache partitioned into shards
+//
+//@SEE_ALSO: bdlcc_cache
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlcc::ShardedCache', implementing a thread-safe in-memory key-value cache
+// with a configurable eviction policy, that partitions its items into a
+// number of independently locked *shards*.  Each shard is a 'bdlcc::Cache'
+// object having its own reader-writer lock, hash map, and eviction queue.  An
+// item is assigned to a shard based on the hash value of its key; therefore,
+// operations on keys that map to different shards do not contend with each
+// other.
+//
+// 'bdlcc::ShardedCache' provides (nearly) the same interface as
+// 'bdlcc::Cache', and can be used as a drop-in replacement in situations
+// where a single 'bdlcc::Cache' becomes a point of contention, for example
+// when many threads perform LRU lookups (which require a write lock) on the
+// same cache.
+//
+///Shards and Watermarks
+///---------------------
+// The number of shards is specified at construction and is rounded up to the
+// next power of 2, then limited to the largest power of 2 not exceeding the
+// low watermark, so that each shard holds at least one item.  The low and
+// high watermarks supplied at construction apply to the cache as a whole:
+// each shard is given an equal share of each watermark (rounded up), and
+// eviction is performed independently in each shard, when the size of that
+// shard reaches its share of the high watermark and until the size of that
+// shard falls below its share of the low watermark.
+//
+// Since no shard ever exceeds its share of the high watermark, the overall
+// size of the cache never exceeds the sum of these shares, which, because of
+// the rounding, may exceed the high watermark by up to 'numShards() - 1'
+// items.  Since 'numShards()' does not exceed the low watermark, the size of
+// the cache is therefore always less than 'lowWatermark() + highWatermark()',
+// i.e., less than twice the high watermark.  If the hash function does not
+// distribute the keys evenly, eviction may start in some shards before the
+// cache as a whole reaches the high watermark, but the bound still holds.
+//
+///Eviction Order
+///--------------
+// Each shard applies the eviction policy (LRU, FIFO, or CLOCK) supplied at
+// construction independently.  As a consequence, the eviction order is exact
+// only *within* a shard; across shards, the eviction order is an
+// approximation of the global eviction order.  Similarly, the 'visit' method
+// visits the shards one after another, and visits the items of each shard in
+// the eviction order of that shard.
+//
+///Thread Safety
+///-------------
+// The 'bdlcc::ShardedCache' class template is fully thread-safe (see
+// 'bsldoc_glossary') provided that the allocator supplied at construction and
+// the default allocator in effect during the lifetime of cached items are both
+// fully thread-safe.
+//
+///Thread Contention
+///-----------------
+// Each operation on a single key ('insert', 'tryGetValue', 'erase') locks only
+// the shard to which the key belongs, with the same read/write lock rules as
+// 'bdlcc::Cache'.  Bulk operations ('insertBulk', 'eraseBulk') partition their
+// input by shard and lock each affected shard once.  The 'size', 'visit', and
+// 'clear' methods lock each shard in turn (never more than one at a time);
+// therefore, the value returned by 'size' is not an atomic snapshot of the
+// cache if other threads are modifying it concurrently.
+//
+///Post-eviction Callback and Potential Deadlocks
+///---------------------------------------------
+// The post-eviction callback is invoked with the write lock of the shard
+// containing the evicted item held.  As for 'bdlcc::Cache', the cache object
+// itself should not be used in a post-eviction callback; otherwise, a deadlock
+// may result.
+//
+///Runtime Complexity
+///------------------
+//..
+// +----------------------------------------------------+--------------------+
+// | Operation                                          | Complexity         |
+// +====================================================+====================+
+// | insert                                             | Average: O[1]      |
+// |                                                    | Worst:   O[n]      |
+// +----------------------------------------------------+--------------------+
+// | tryGetValue                                        | O[1]               |
+// +----------------------------------------------------+--------------------+
+// | popFront                                           | O[numShards]       |
+// +----------------------------------------------------+--------------------+
+// | erase                                              | O[1]               |
+// +----------------------------------------------------+--------------------+
+// | size                                               | O[numShards]       |
+// +----------------------------------------------------+--------------------+
+// | visit                                              | O[n]               |
+// +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Basic Usage
+/// - - - - - - - - - - -
+// This example shows basic usage of a sharded cache.  First, we define a
+// 'bdlcc::ShardedCache' object, 'myCache', that maps 'int' to 'bsl::string',
+// uses the LRU eviction policy, and is split into 4 shards, each of which
+// holding between 2 and 4 items:
+//..
+//  bdlcc::ShardedCache<int, bsl::string> myCache(
+//                                        bdlcc::CacheEvictionPolicy::e_LRU,
+//                                        8,
+//                                        16,
+//                                        4,
+//                                        &talloc);
+//  assert(4  == myCache.numShards());
+//  assert(8  == myCache.lowWatermark());
+//  assert(16 == myCache.highWatermark());
+//..
+// Next, we insert a few items and verify that the size of the cache has been
+// updated correctly:
+//..
+//  myCache.insert(0, "Alex");
+//  myCache.insert(1, "John");
+//  myCache.insert(2, "Rob");
+//  assert(myCache.size() == 3);
+//..
+// Then, we retrieve the value of one of the items with 'tryGetValue', which
+// locks only the shard containing the key '1':
+//..
+//  bsl::shared_ptr<bsl::string> value;
+//  int rc = myCache.tryGetValue(&value, 1);
+//  assert(rc == 0);
+//  assert(*value == "John");
+//..
+// Next, we insert many more items than the high watermark allows, and observe
+// that eviction keeps the size of each shard, and therefore of the cache,
+// bounded:
+//..
+//  for (int i = 3; i < 1000; ++i) {
+//      myCache.insert(i, "Filler");
+//  }
+//  assert(myCache.size() <= 16);
+//..
+// Finally, we use 'visit' to count the items in the cache:
+//..
+//  struct CountingVisitor {
+//      int d_count;
+//
+//      bool operator()(int, const bsl::string&)
+//      {
+//          ++d_count;
+//          return true;
+//      }
+//  };
+//
+//  CountingVisitor visitor = { 0 };
+//  myCache.visit(visitor);
+//  assert(myCache.size() == static_cast<bsl::size_t>(visitor.d_count));
+//..
+
+#include <bdlcc_cache.h>
+
+#include <bslma_allocator.h>
+#include <bslma_autodestructor.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_integralconstant.h>
+#include <bslmf_movableref.h>
+
+#include <bslmt_platform.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_limits.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                         // ========================
+                         // class ShardedCache_Shard
+                         // ========================
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+class ShardedCache_Shard {
+    // This class holds one shard of a 'ShardedCache', padded so that the
+    // locks of adjacent shards never share a cache line.
+
+    // PRIVATE TYPES
+    typedef Cache<KEY, VALUE, HASH, EQUAL> CacheType;
+
+  public:
+    // DATA
+    CacheType d_cache;                                       // shard cache
+    char      d_pad[bslmt::Platform::e_CACHE_LINE_SIZE];     // padding
+
+    // CREATORS
+    ShardedCache_Shard(CacheEvictionPolicy::Enum  evictionPolicy,
+                       bsl::size_t                lowWatermark,
+                       bsl::size_t                highWatermark,
+                       const HASH&                hashFunction,
+                       const EQUAL&               equalFunction,
+                       bslma::Allocator          *basicAllocator);
+        // Create a shard holding an empty cache using the specified
+        // 'evictionPolicy', 'lowWatermark', 'highWatermark', 'hashFunction',
+        // 'equalFunction', and 'basicAllocator'.
+};
+
+                         // ==========================
+                         // class ShardedCache_Visitor
+                         // ==========================
+
+template <class VISITOR>
+class ShardedCache_Visitor {
+    // This class wraps a user-supplied visitor in order to record whether the
+    // visitor requested the iteration to stop, so that the iteration over the
+    // remaining shards can be skipped.
+
+    // DATA
+    VISITOR *d_visitor_p;  // wrapped visitor (held, not owned)
+    bool     d_stopped;    // 'true' if the visitor returned 'false'
+
+  public:
+    // CREATORS
+    explicit ShardedCache_Visitor(VISITOR *visitor);
+        // Create a wrapper around the specified 'visitor'.
+
+    // MANIPULATORS
+    template <class KEY, class VALUE>
+    bool operator()(const KEY& key, const VALUE& value);
+        // Invoke the wrapped visitor on the specified 'key' and 'value', and
+        // return its result.  Record that the iteration was stopped if the
+        // result is 'false'.
+
+    // ACCESSORS
+    bool stopped() const;
+        // Return 'true' if the wrapped visitor has returned 'false', and
+        // 'false' otherwise.
+};
+
+                            // ==================
+                            // class ShardedCache
+                            // ==================
+
+template <class KEY,
+          class VALUE,
+          class HASH  = bsl::hash<KEY>,
+          class EQUAL = bsl::equal_to<KEY> >
+class ShardedCache {
+    // This class represents an in-process key-value store, partitioned into
+    // independently locked shards, supporting a variety of eviction policies.
+
+  public:
+    // PUBLIC TYPES
+    typedef Cache<KEY, VALUE, HASH, EQUAL>           ShardType;
+        // Type of each shard of the cache.
+
+    typedef typename ShardType::ValuePtrType         ValuePtrType;
+        // Shared pointer type pointing to value type.
+
+    typedef typename ShardType::PostEvictionCallback PostEvictionCallback;
+        // Type of function to call after an item has been evicted from the
+        // cache.
+
+    typedef typename ShardType::KVType               KVType;
+        // Value type of a bulk insert entry.
+
+    enum {
+        k_DEFAULT_NUM_SHARDS = 16  // number of shards used by the default
+                                   // constructor
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef ShardedCache_Shard<KEY, VALUE, HASH, EQUAL> Shard;
+
+    // DATA
+    bslma::Allocator          *d_allocator_p;    // memory allocator (held, not
+                                                 // owned)
+
+    bsl::size_t                d_numShards;      // number of shards, a power
+                                                 // of 2
+
+    int                        d_shardShift;     // number of bits to shift a
+                                                 // mixed hash value right to
+                                                 // obtain the shard index
+
+    Shard                     *d_shards_p;       // array of 'd_numShards'
+                                                 // shards (owned)
+
+    HASH                       d_hasher;         // hash function used to
+                                                 // select a shard
+
+    CacheEvictionPolicy::Enum  d_evictionPolicy; // eviction policy
+
+    bsl::size_t                d_lowWatermark;   // the total size at which
+                                                 // eviction stops
+
+    bsl::size_t                d_highWatermark;  // the total size at which
+                                                 // eviction starts
+
+    mutable bsls::AtomicUint   d_popFrontIndex;  // index of the shard from
+                                                 // which 'popFront' starts
+                                                 // looking for an item
+
+    // PRIVATE CLASS METHODS
+    static bsl::size_t shardWatermark(bsl::size_t watermark,
+                                      bsl::size_t numShards);
+        // Return the share of the specified 'watermark' given to each of the
+        // specified 'numShards' shards, rounded up.
+
+    // PRIVATE MANIPULATORS
+    void init(bsl::size_t   numShards,
+              const HASH&   hashFunction,
+              const EQUAL&  equalFunction);
+        // Allocate and construct the shards of this cache, using the specified
+        // 'numShards' (rounded up to a power of 2, and limited by the low
+        // watermark of this object), 'hashFunction', and 'equalFunction', and
+        // the eviction policy and watermarks of this object.
+
+    // PRIVATE ACCESSORS
+    bsl::size_t shardIndex(const KEY& key) const;
+        // Return the index of the shard to which the specified 'key' belongs.
+
+    ShardType& shard(const KEY& key) const;
+        // Return a reference providing modifiable access to the shard to which
+        // the specified 'key' belongs.
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCache(const ShardedCache&);
+    ShardedCache& operator=(const ShardedCache&);
+
+  public:
+    // CREATORS
+    explicit ShardedCache(bslma::Allocator *basicAllocator = 0);
+        // Create an empty LRU cache having no size limit and
+        // 'k_DEFAULT_NUM_SHARDS' shards.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    ShardedCache(CacheEvictionPolicy::Enum  evictionPolicy,
+                 bsl::size_t                lowWatermark,
+                 bsl::size_t                highWatermark,
+                 bsl::size_t                numShards,
+                 bslma::Allocator          *basicAllocator = 0);
+        // Create an empty cache using the specified 'evictionPolicy', the
+        // specified total 'lowWatermark' and 'highWatermark', and having the
+        // specified 'numShards' rounded up to the next power of 2, but no
+        // more than 'lowWatermark' (see {Shards and Watermarks}).  Optionally
+        // specify the 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless
+        // 'lowWatermark <= highWatermark', '1 <= lowWatermark', and
+        // '1 <= numShards'.
+
+    ShardedCache(CacheEvictionPolicy::Enum  evictionPolicy,
+                 bsl::size_t                lowWatermark,
+                 bsl::size_t                highWatermark,
+                 bsl::size_t                numShards,
+                 const HASH&                hashFunction,
+                 const EQUAL&               equalFunction,
+                 bslma::Allocator          *basicAllocator = 0);
+        // Create an empty cache using the specified 'evictionPolicy', the
+        // specified total 'lowWatermark' and 'highWatermark', and having the
+        // specified 'numShards' rounded up to the next power of 2, but no
+        // more than 'lowWatermark' (see {Shards and Watermarks}).  The
+        // specified 'hashFunction' is used to generate the hash values for a
+        // given key (both to select a shard and within the shard), and the
+        // specified 'equalFunction' is used to determine whether two keys have
+        // the same value.  Optionally specify the 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // 'lowWatermark <= highWatermark', '1 <= lowWatermark', and
+        // '1 <= numShards'.
+
+    ~ShardedCache();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void clear();
+        // Remove all items from this cache.  Do *not* invoke the post-eviction
+        // callback.
+
+    int erase(const KEY& key);
+        // Remove the item having the specified 'key' from this cache.  Invoke
+        // the post-eviction callback for the removed item.  Return 0 on
+        // success and 1 if 'key' does not exist.
+
+    int eraseBulk(const bsl::vector<KEY>& keys);
+        // Remove the items having the specified 'keys' from this cache.
+        // Invoke the post-eviction callback for each removed item.  Return
+        // the number of items successfully removed.
+
+    void insert(const KEY& key, const VALUE& value);
+    void insert(const KEY& key, bslmf::MovableRef<VALUE> value);
+    void insert(bslmf::MovableRef<KEY> key, const VALUE& value);
+    void insert(bslmf::MovableRef<KEY> key, bslmf::MovableRef<VALUE> value);
+        // Move the specified 'key' and its associated 'value' into this cache.
+        // If 'key' already exists, then its value will be replaced with
+        // 'value'.  See 'bdlcc::Cache::insert' for the exception guarantees.
+
+    void insert(const KEY& key, const ValuePtrType& valuePtr);
+    void insert(bslmf::MovableRef<KEY> key, const ValuePtrType& valuePtr);
+        // Insert the specified 'key' and its associated 'valuePtr' into this
+        // cache.  If 'key' already exists, then its value will be replaced
+        // with 'value'.  See 'bdlcc::Cache::insert' for the exception
+        // guarantees.
+
+    int insertBulk(const bsl::vector<KVType>& data);
+        // Insert the specified 'data' (composed of Key-Value pairs) into this
+        // cache.  If a key already exists, then its value will be replaced
+        // with the value.  Return the number of items successfully inserted.
+        // Note that each affected shard is locked once, and that items of
+        // different shards are not inserted atomically with respect to each
+        // other.
+
+    int insertBulk(bslmf::MovableRef<bsl::vector<KVType> > data);
+        // Insert the specified 'data' (composed of Key-Value pairs) into this
+        // cache.  If a key already exists, then its value will be replaced
+        // with the value.  Return the number of items successfully inserted.
+        // If an exception occurs during this action, we provide only the
+        // basic guarantee - both this cache and 'data' will be in some valid
+        // but unspecified state.
+
+    int popFront();
+        // Remove the item at the front of the eviction queue of one of the
+        // non-empty shards of this cache, selected in a round-robin manner.
+        // Invoke the post-eviction callback for the removed item.  Return 0
+        // on success, and 1 if this cache is empty.
+
+    void setPostEvictionCallback(
+                             const PostEvictionCallback& postEvictionCallback);
+        // Set the post-eviction callback to the specified
+        // 'postEvictionCallback'.  The post-eviction callback is invoked for
+        // each item evicted or removed from this cache.
+
+    int tryGetValue(bsl::shared_ptr<VALUE> *value,
+                    const KEY&              key,
+                    bool                    modifyEvictionQueue = true);
+        // Load, into the specified 'value', the value associated with the
+        // specified 'key' in this cache.  If the optionally specified
+        // 'modifyEvictionQueue' is 'true' and the eviction policy is LRU, then
+        // move the cached item to the back of the eviction queue of its shard.
+        // Return 0 on success, and 1 if 'key' does not exist in this cache.
+        // Note that only the shard containing 'key' is locked, and that a
+        // write lock is acquired only if its queue is modified.
+
+    // ACCESSORS
+    EQUAL equalFunction() const;
+        // Return (a copy of) the key-equality functor used by this cache that
+        // returns 'true' if two 'KEY' objects have the same value, and 'false'
+        // otherwise.
+
+    CacheEvictionPolicy::Enum evictionPolicy() const;
+        // Return the eviction policy used by this cache.
+
+    HASH hashFunction() const;
+        // Return (a copy of) the unary hash functor used by this cache to
+        // generate a hash value (of type 'std::size_t') for a 'KEY' object.
+
+    bsl::size_t highWatermark() const;
+        // Return the total high watermark of this cache, as supplied at
+        // construction.
+
+    bsl::size_t lowWatermark() const;
+        // Return the total low watermark of this cache, as supplied at
+        // construction.
+
+    bsl::size_t numShards() const;
+        // Return the number of shards of this cache.
+
+    bsl::size_t size() const;
+        // Return the current size of this cache.  Note that the result is not
+        // an atomic snapshot if the cache is concurrently modified.
+
+    template <class VISITOR>
+    void visit(VISITOR& visitor) const;
+        // Call the specified 'visitor' for every item stored in this cache,
+        // shard after shard and in the order of the eviction queue within each
+        // shard, until 'visitor' returns 'false'.  The 'VISITOR' type must be
+        // a callable object that can be invoked in the same way as the
+        // function 'bool (const KEY&, const VALUE&)'.  Note that only one
+        // shard is locked at a time.
+};
+
+// ============================================================================
+//                        INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                         // ------------------------
+                         // class ShardedCache_Shard
+                         // ------------------------
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::ShardedCache_Shard(
+                                     CacheEvictionPolicy::Enum  evictionPolicy,
+                                     bsl::size_t                lowWatermark,
+                                     bsl::size_t                highWatermark,
+                                     const HASH&                hashFunction,
+                                     const EQUAL&               equalFunction,
+                                     bslma::Allocator          *basicAllocator)
+: d_cache(evictionPolicy,
+          lowWatermark,
+          highWatermark,
+          hashFunction,
+          equalFunction,
+          basicAllocator)
+{
+}
+
+                         // --------------------------
+                         // class ShardedCache_Visitor
+                         // --------------------------
+
+// CREATORS
+template <class VISITOR>
+inline
+ShardedCache_Visitor<VISITOR>::ShardedCache_Visitor(VISITOR *visitor)
+: d_visitor_p(visitor)
+, d_stopped(false)
+{
+}
+
+// MANIPULATORS
+template <class VISITOR>
+template <class KEY, class VALUE>
+inline
+bool ShardedCache_Visitor<VISITOR>::operator()(const KEY&   key,
+                                               const VALUE& value)
+{
+    if (!(*d_visitor_p)(key, value)) {
+        d_stopped = true;
+        return false;                                                 // RETURN
+    }
+    return true;
+}
+
+// ACCESSORS
+template <class VISITOR>
+inline
+bool ShardedCache_Visitor<VISITOR>::stopped() const
+{
+    return d_stopped;
+}
+
+                            // ------------------
+                            // class ShardedCache
+                            // ------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::shardWatermark(
+                                                     bsl::size_t watermark,
+                                                     bsl::size_t numShards)
+{
+    return watermark / numShards + (0 != watermark % numShards ? 1 : 0);
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::init(bsl::size_t  numShards,
+                                                 const HASH&  hashFunction,
+                                                 const EQUAL& equalFunction)
+{
+    BSLS_ASSERT(1 <= numShards);
+
+    // Round the number of shards up to a power of 2, but do not exceed the
+    // low watermark, so that rounding the share of each shard up inflates the
+    // total watermarks by less than the low watermark (see {Shards and
+    // Watermarks}).  Compute the shift that maps the top bits of a 64-bit
+    // mixed hash value to a shard index.
+
+    d_numShards  = 1;
+    d_shardShift = 64;
+    while (d_numShards < numShards && d_numShards * 2 <= d_lowWatermark) {
+        d_numShards <<= 1;
+        --d_shardShift;
+    }
+
+    const bsl::size_t lowWatermark  = shardWatermark(d_lowWatermark,
+                                                     d_numShards);
+    const bsl::size_t highWatermark = shardWatermark(d_highWatermark,
+                                                     d_numShards);
+
+    d_shards_p = static_cast<Shard *>(
+                         d_allocator_p->allocate(d_numShards * sizeof(Shard)));
+    bslma::DeallocatorProctor<bslma::Allocator> deallocatorProctor(
+                                                                d_shards_p,
+                                                                d_allocator_p);
+    bslma::AutoDestructor<Shard> destructorProctor(d_shards_p, 0);
+
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        new (d_shards_p + i) Shard(d_evictionPolicy,
+                                   lowWatermark,
+                                   highWatermark,
+                                   hashFunction,
+                                   equalFunction,
+                                   d_allocator_p);
+        ++destructorProctor;
+    }
+
+    destructorProctor.release();
+    deallocatorProctor.release();
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t
+ShardedCache<KEY, VALUE, HASH, EQUAL>::shardIndex(const KEY& key) const
+{
+    if (1 == d_numShards) {
+        return 0;                                                     // RETURN
+    }
+
+    // The hash value is mixed with a multiplicative (Fibonacci) hash, and the
+    // top bits are used, so that the shard index is not correlated with the
+    // bucket index used by the hash map within the shard.
+
+    const bsls::Types::Uint64 mixed =
+              static_cast<bsls::Types::Uint64>(d_hasher(key)) *
+                                          0x9E3779B97F4A7C15ULL;
+
+    return static_cast<bsl::size_t>(mixed >> d_shardShift);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardType&
+ShardedCache<KEY, VALUE, HASH, EQUAL>::shard(const KEY& key) const
+{
+    return d_shards_p[shardIndex(key)].d_cache;
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                                              bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_numShards(0)
+, d_shardShift(64)
+, d_shards_p(0)
+, d_hasher()
+, d_evictionPolicy(CacheEvictionPolicy::e_LRU)
+, d_lowWatermark(bsl::numeric_limits<bsl::size_t>::max())
+, d_highWatermark(bsl::numeric_limits<bsl::size_t>::max())
+, d_popFrontIndex(0)
+{
+    init(k_DEFAULT_NUM_SHARDS, HASH(), EQUAL());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                                     CacheEvictionPolicy::Enum  evictionPolicy,
+                                     bsl::size_t                lowWatermark,
+                                     bsl::size_t                highWatermark,
+                                     bsl::size_t                numShards,
+                                     bslma::Allocator          *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_numShards(0)
+, d_shardShift(64)
+, d_shards_p(0)
+, d_hasher()
+, d_evictionPolicy(evictionPolicy)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+, d_popFrontIndex(0)
+{
+    BSLS_REVIEW(lowWatermark <= highWatermark);
+    BSLS_REVIEW(1 <= lowWatermark);
+    BSLS_REVIEW(1 <= highWatermark);
+
+    init(numShards, HASH(), EQUAL());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                                     CacheEvictionPolicy::Enum  evictionPolicy,
+                                     bsl::size_t                lowWatermark,
+                                     bsl::size_t                highWatermark,
+                                     bsl::size_t                numShards,
+                                     const HASH&                hashFunction,
+                                     const EQUAL&               equalFunction,
+                                     bslma::Allocator          *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_numShards(0)
+, d_shardShift(64)
+, d_shards_p(0)
+, d_hasher(hashFunction)
+, d_evictionPolicy(evictionPolicy)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+, d_popFrontIndex(0)
+{
+    BSLS_REVIEW(lowWatermark <= highWatermark);
+    BSLS_REVIEW(1 <= lowWatermark);
+    BSLS_REVIEW(1 <= highWatermark);
+
+    init(numShards, hashFunction, equalFunction);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::~ShardedCache()
+{
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        d_shards_p[i].~Shard();
+    }
+    d_allocator_p->deallocate(d_shards_p);
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        d_shards_p[i].d_cache.clear();
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    return shard(key).erase(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::eraseBulk(
+                                                  const bsl::vector<KEY>& keys)
+{
+    if (1 == d_numShards) {
+        return d_shards_p[0].d_cache.eraseBulk(keys);                 // RETURN
+    }
+
+    bsl::vector<bsl::vector<KEY> > partition(d_numShards, d_allocator_p);
+    for (bsl::size_t i = 0; i < keys.size(); ++i) {
+        partition[shardIndex(keys[i])].push_back(keys[i]);
+    }
+
+    int count = 0;
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        if (!partition[i].empty()) {
+            count += d_shards_p[i].d_cache.eraseBulk(partition[i]);
+        }
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(const KEY&   key,
+                                                   const VALUE& value)
+{
+    shard(key).insert(key, value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                               const KEY&               key,
+                                               bslmf::MovableRef<VALUE> value)
+{
+    shard(key).insert(key, bslmf::MovableRefUtil::move(value));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                                 bslmf::MovableRef<KEY> key,
+                                                 const VALUE&           value)
+{
+    KEY& localKey = key;
+    shard(localKey).insert(bslmf::MovableRefUtil::move(localKey), value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                               bslmf::MovableRef<KEY>   key,
+                                               bslmf::MovableRef<VALUE> value)
+{
+    KEY& localKey = key;
+    shard(localKey).insert(bslmf::MovableRefUtil::move(localKey),
+                           bslmf::MovableRefUtil::move(value));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                                 const KEY&          key,
+                                                 const ValuePtrType& valuePtr)
+{
+    shard(key).insert(key, valuePtr);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                               bslmf::MovableRef<KEY> key,
+                                               const ValuePtrType&    valuePtr)
+{
+    KEY& localKey = key;
+    shard(localKey).insert(bslmf::MovableRefUtil::move(localKey), valuePtr);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::insertBulk(
+                                              const bsl::vector<KVType>& data)
+{
+    if (1 == d_numShards) {
+        return d_shards_p[0].d_cache.insertBulk(data);                // RETURN
+    }
+
+    bsl::vector<bsl::vector<KVType> > partition(d_numShards, d_allocator_p);
+    for (bsl::size_t i = 0; i < data.size(); ++i) {
+        partition[shardIndex(data[i].first)].push_back(data[i]);
+    }
+
+    int count = 0;
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        if (!partition[i].empty()) {
+            count += d_shards_p[i].d_cache.insertBulk(
+                                bslmf::MovableRefUtil::move(partition[i]));
+        }
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::insertBulk(
+                                  bslmf::MovableRef<bsl::vector<KVType> > data)
+{
+    bsl::vector<KVType>& localData = data;
+
+    if (1 == d_numShards) {
+        return d_shards_p[0].d_cache.insertBulk(                      // RETURN
+                                    bslmf::MovableRefUtil::move(localData));
+    }
+
+    bsl::vector<bsl::vector<KVType> > partition(d_numShards, d_allocator_p);
+    for (bsl::size_t i = 0; i < localData.size(); ++i) {
+        partition[shardIndex(localData[i].first)].push_back(
+                                   bslmf::MovableRefUtil::move(localData[i]));
+    }
+
+    int count = 0;
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        if (!partition[i].empty()) {
+            count += d_shards_p[i].d_cache.insertBulk(
+                                bslmf::MovableRefUtil::move(partition[i]));
+        }
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::popFront()
+{
+    const bsl::size_t start = d_popFrontIndex.addRelaxed(1);
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        const bsl::size_t index = (start + i) & (d_numShards - 1);
+        if (0 == d_shards_p[index].d_cache.popFront()) {
+            return 0;                                                 // RETURN
+        }
+    }
+    return 1;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::setPostEvictionCallback(
+                              const PostEvictionCallback& postEvictionCallback)
+{
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        d_shards_p[i].d_cache.setPostEvictionCallback(postEvictionCallback);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::tryGetValue(
+                                   bsl::shared_ptr<VALUE> *value,
+                                   const KEY&              key,
+                                   bool                    modifyEvictionQueue)
+{
+    return shard(key).tryGetValue(value, key, modifyEvictionQueue);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL ShardedCache<KEY, VALUE, HASH, EQUAL>::equalFunction() const
+{
+    return d_shards_p[0].d_cache.equalFunction();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+CacheEvictionPolicy::Enum
+ShardedCache<KEY, VALUE, HASH, EQUAL>::evictionPolicy() const
+{
+    return d_evictionPolicy;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH ShardedCache<KEY, VALUE, HASH, EQUAL>::hashFunction() const
+{
+    return d_hasher;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::highWatermark() const
+{
+    return d_highWatermark;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::lowWatermark() const
+{
+    return d_lowWatermark;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::numShards() const
+{
+    return d_numShards;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    bsl::size_t result = 0;
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        result += d_shards_p[i].d_cache.size();
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class VISITOR>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::visit(VISITOR& visitor) const
+{
+    ShardedCache_Visitor<VISITOR> wrapper(&visitor);
+
+    for (bsl::size_t i = 0; i < d_numShards && !wrapper.stopped(); ++i) {
+        d_shards_p[i].d_cache.visit(wrapper);
+    }
+}
+
+}  // close package namespace
+
+namespace bslma {
+
+template <class KEY,  class VALUE,  class HASH,  class EQUAL>
+struct UsesBslmaAllocator<bdlcc::ShardedCache<KEY, VALUE, HASH, EQUAL> >
+    : bsl::true_type
+{
+};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
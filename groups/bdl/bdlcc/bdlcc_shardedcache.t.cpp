@@ -0,0 +1,1138 @@
+// bdlcc_shardedcache.t.cpp                                           -*-C++-*-
+
+#include <bdlcc_shardedcache.h>
+
+#include <bdlcc_cache.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmt_threadutil.h>
+#include <bslmt_throughputbenchmark.h>
+#include <bslmt_throughputbenchmarkresult.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>    // 'atoi'
+#include <bsl_functional.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_set.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a mechanism, 'bdlcc::ShardedCache', that
+// provides an in-memory key-value cache partitioned into independently locked
+// shards, each of which is a 'bdlcc::Cache'.  Since the behavior of each shard
+// is provided by (and tested in) 'bdlcc_cache', this test driver concentrates
+// on the distribution of keys to shards, the forwarding of the operations to
+// the correct shard, the division of the watermarks among the shards, and the
+// aggregation of the results of the operations that span all shards.
+//
+// Primary Manipulators:
+//: o 'insert'
+//: o 'erase'
+//
+// Basic Accessors:
+//: o 'tryGetValue'
+//: o 'size'
+//: o 'numShards'
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit ShardedCache(bslma::Allocator *basicAllocator);
+// [ 2] ShardedCache(policy, lowWat, highWat, numShards, alloc);
+// [ 2] ShardedCache(policy, lowWat, highWat, numShards, hash, equal, alloc);
+// [ 2] ~ShardedCache();
+//
+// MANIPULATORS
+// [ 2] void insert(const KEY& key, const VALUE& value);
+// [ 2] void insert(const KEY& key, const ValuePtrType& valuePtr);
+// [ 2] void insert(KEY&& key, VALUE&& value);
+// [ 4] int insertBulk(const bsl::vector<KVType>& data);
+// [ 4] int insertBulk(bsl::vector<KVType>&& data);
+// [ 2] int tryGetValue(value, const KEY& key, bool modifyEvictionQueue);
+// [ 3] int popFront();
+// [ 2] int erase(const KEY& key);
+// [ 4] int eraseBulk(const bsl::vector<KEY>& keys);
+// [ 3] void setPostEvictionCallback(postEvictionCallback);
+// [ 2] void clear();
+//
+// ACCESSORS
+// [ 4] void visit(VISITOR& visitor) const;
+// [ 2] CacheEvictionPolicy::Enum evictionPolicy() const;
+// [ 2] bsl::size_t highWatermark() const;
+// [ 2] bsl::size_t lowWatermark() const;
+// [ 2] bsl::size_t numShards() const;
+// [ 2] bsl::size_t size() const;
+// [ 2] HASH hashFunction() const;
+// [ 2] EQUAL equalFunction() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] THREAD SAFETY
+// [ 6] USAGE EXAMPLE
+// [-1] THROUGHPUT BENCHMARK: 'Cache' VS 'ShardedCache'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+typedef bdlcc::ShardedCache<int, bsl::string> Obj;
+
+// ============================================================================
+//                      HELPER FUNCTIONS AND CLASSES
+// ----------------------------------------------------------------------------
+
+struct CountingVisitor {
+    // Visitor counting the number of items it is invoked on, and stopping
+    // after 'd_limit' items.
+
+    // DATA
+    int d_count;  // number of items visited
+    int d_limit;  // number of items after which to stop
+
+    // MANIPULATORS
+    bool operator()(int, const bsl::string&)
+        // Increment 'd_count' and return 'false' if 'd_limit' was reached.
+    {
+        ++d_count;
+        return d_count < d_limit;
+    }
+};
+
+struct KeyCollector {
+    // Visitor collecting the keys of the items it is invoked on.
+
+    // DATA
+    bsl::set<int> *d_keys_p;  // collected keys (held, not owned)
+
+    // MANIPULATORS
+    bool operator()(int key, const bsl::string&)
+        // Record the specified 'key' and return 'true'.
+    {
+        d_keys_p->insert(key);
+        return true;
+    }
+};
+
+struct IdentityHash {
+    // Hash functor that returns the key itself, used to verify that the shard
+    // selection does not rely on the low bits of the hash value.
+
+    bsl::size_t operator()(int key) const
+        // Return the specified 'key'.
+    {
+        return static_cast<bsl::size_t>(key);
+    }
+};
+
+bsls::AtomicInt evictionCount;
+
+void countEviction(const bsl::shared_ptr<bsl::string>&)
+    // Increment 'evictionCount'.
+{
+    ++evictionCount;
+}
+
+bsl::vector<int> stringSplit(bsl::string csString)
+    // Return a vector of the integer split from the specified 'csString'
+    // comma separated string of integers.  Assume only digits and ','.
+{
+    bsl::vector<int> ret;
+    bsl::stringstream ss(csString);
+    for (int i; ss >> i;) {
+        ret.push_back(i);
+        if (ss.peek() == ',') {
+            ss.ignore();
+        }
+    }
+    return ret;
+}
+
+// ============================================================================
+//                              THREAD SAFETY TEST
+// ----------------------------------------------------------------------------
+
+namespace threadSafety {
+
+enum { k_NUM_THREADS = 8, k_NUM_ITERATIONS = 2000 };
+
+struct ThreadArgs {
+    Obj *d_cache_p;
+    int  d_threadId;
+};
+
+extern "C" void *workerThread(void *arg)
+    // Insert, read back, and erase keys belonging to the thread described by
+    // the specified 'arg'.
+{
+    ThreadArgs *args  = static_cast<ThreadArgs *>(arg);
+    Obj&        cache = *args->d_cache_p;
+
+    for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+        const int key = i * k_NUM_THREADS + args->d_threadId;
+
+        cache.insert(key, "value");
+
+        bsl::shared_ptr<bsl::string> value;
+        ASSERTV(key, 0 == cache.tryGetValue(&value, key));
+        ASSERTV(key, value && "value" == *value);
+
+        if (i % 2) {
+            ASSERTV(key, 0 == cache.erase(key));
+        }
+    }
+    return 0;
+}
+
+}  // close namespace threadSafety
+
+// ============================================================================
+//                             THROUGHPUT BENCHMARK
+// ----------------------------------------------------------------------------
+
+namespace cachePerf {
+
+template <class CACHE>
+class CacheBenchmark {
+    // This class provides the thread functions for a throughput benchmark of
+    // a mixed read / write load on a cache of type 'CACHE', which is either a
+    // 'bdlcc::Cache' or a 'bdlcc::ShardedCache'.
+
+    // DATA
+    CACHE *d_cache_p;   // cache under test (held, not owned)
+    int    d_numKeys;   // keys are in the range '[0, d_numKeys)'
+
+  public:
+    // CREATORS
+    CacheBenchmark(CACHE *cache, int numKeys)
+        // Create a benchmark on the specified 'cache' using keys in the range
+        // '[0, numKeys)'.
+    : d_cache_p(cache)
+    , d_numKeys(numKeys)
+    {
+    }
+
+    // MANIPULATORS
+    void initializeSample(bool)
+        // Preload the cache with half of the keys.
+    {
+        d_cache_p->clear();
+        for (int i = 0; i < d_numKeys; i += 2) {
+            d_cache_p->insert(i, i);
+        }
+    }
+
+    void read(int threadIndex)
+        // Look up a batch of keys chosen based on the specified
+        // 'threadIndex'.
+    {
+        static bsls::AtomicUint s_seed(0);
+        unsigned int seed = s_seed.addRelaxed(0x9E3779B9U) ^ threadIndex;
+        bsl::shared_ptr<int> value;
+        for (int i = 0; i < 100; ++i) {
+            seed = seed * 1664525U + 1013904223U;
+            d_cache_p->tryGetValue(&value,
+                                   static_cast<int>((seed >> 8) % d_numKeys));
+        }
+    }
+
+    void write(int threadIndex)
+        // Insert a batch of keys chosen based on the specified
+        // 'threadIndex'.
+    {
+        static bsls::AtomicUint s_seed(0);
+        unsigned int seed = s_seed.addRelaxed(0x9E3779B9U) ^ threadIndex;
+        for (int i = 0; i < 100; ++i) {
+            seed = seed * 1664525U + 1013904223U;
+            const int key = static_cast<int>((seed >> 8) % d_numKeys);
+            d_cache_p->insert(key, key);
+        }
+    }
+};
+
+template <class CACHE>
+void runBenchmark(const char *name,
+                  CACHE      *cache,
+                  int         numKeys,
+                  int         numReaders,
+                  int         numWriters,
+                  int         numMillis,
+                  int         numSamples)
+    // Run a throughput benchmark, identified by the specified 'name', on the
+    // specified 'cache' using keys in the range '[0, numKeys)' with the
+    // specified 'numReaders' reader threads and 'numWriters' writer threads,
+    // for the specified 'numSamples' samples of 'numMillis' milliseconds each,
+    // and print the median throughput of each thread group.
+{
+    typedef CacheBenchmark<CACHE> Bench;
+
+    bslma::NewDeleteAllocator nalloc;
+
+    Bench                            bench(cache, numKeys);
+    bslmt::ThroughputBenchmark       tb(&nalloc);
+    bslmt::ThroughputBenchmarkResult res(&nalloc);
+
+    int readId  = -1;
+    int writeId = -1;
+    if (numReaders) {
+        readId = tb.addThreadGroup(
+                  bdlf::BindUtil::bind(&Bench::read,
+                                       &bench,
+                                       bdlf::PlaceHolders::_1),
+                  numReaders,
+                  0);
+    }
+    if (numWriters) {
+        writeId = tb.addThreadGroup(
+                  bdlf::BindUtil::bind(&Bench::write,
+                                       &bench,
+                                       bdlf::PlaceHolders::_1),
+                  numWriters,
+                  0);
+    }
+
+    tb.execute(&res,
+               numMillis,
+               numSamples,
+               bdlf::BindUtil::bind(&Bench::initializeSample,
+                                    &bench,
+                                    bdlf::PlaceHolders::_1),
+               bslmt::ThroughputBenchmark::ShutdownSampleFunction(),
+               bslmt::ThroughputBenchmark::CleanupSampleFunction());
+
+    double readMedian  = 0;
+    double writeMedian = 0;
+    if (readId >= 0) {
+        res.getMedian(&readMedian, readId);
+    }
+    if (writeId >= 0) {
+        res.getMedian(&writeMedian, writeId);
+    }
+
+    bsl::cout << bsl::fixed << bsl::setprecision(0)
+              << name << "," << numReaders << "," << numWriters << ","
+              << readMedian * 100 << "," << writeMedian * 100 << "\n";
+}
+
+}  // close namespace cachePerf
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usageExample1 {
+
+bslma::TestAllocator talloc("ue1", veryVeryVeryVerbose);
+
+struct CountingVisitor {
+    int d_count;
+
+    bool operator()(int, const bsl::string&)
+    {
+        ++d_count;
+        return true;
+    }
+};
+
+void example1()
+{
+    // This example shows basic usage of a sharded cache.  First, we define a
+    // 'bdlcc::ShardedCache' object, 'myCache', that maps 'int' to
+    // 'bsl::string', uses the LRU eviction policy, and is split into 4
+    // shards, each of which holding between 2 and 4 items:
+
+    bdlcc::ShardedCache<int, bsl::string> myCache(
+                                          bdlcc::CacheEvictionPolicy::e_LRU,
+                                          8,
+                                          16,
+                                          4,
+                                          &talloc);
+    ASSERT(4  == myCache.numShards());
+    ASSERT(8  == myCache.lowWatermark());
+    ASSERT(16 == myCache.highWatermark());
+
+    // Next, we insert a few items and verify that the size of the cache has
+    // been updated correctly:
+
+    myCache.insert(0, "Alex");
+    myCache.insert(1, "John");
+    myCache.insert(2, "Rob");
+    ASSERT(myCache.size() == 3);
+
+    // Then, we retrieve the value of one of the items with 'tryGetValue',
+    // which locks only the shard containing the key '1':
+
+    bsl::shared_ptr<bsl::string> value;
+    int rc = myCache.tryGetValue(&value, 1);
+    ASSERT(rc == 0);
+    ASSERT(*value == "John");
+
+    // Next, we insert many more items than the high watermark allows, and
+    // observe that eviction keeps the size of each shard, and therefore of the
+    // cache, bounded:
+
+    for (int i = 3; i < 1000; ++i) {
+        myCache.insert(i, "Filler");
+    }
+    ASSERT(myCache.size() <= 16);
+
+    // Finally, we use 'visit' to count the items in the cache:
+
+    CountingVisitor visitor = { 0 };
+    myCache.visit(visitor);
+    ASSERT(myCache.size() == static_cast<bsl::size_t>(visitor.d_count));
+}
+
+}  // close namespace usageExample1
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+    bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+    bslma::TestAllocatorMonitor gam(&globalAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        usageExample1::example1();
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // THREAD SAFETY
+        //
+        // Concerns:
+        //: 1 Concurrent inserts, lookups and erasures on keys of the same and
+        //:   of different shards do not corrupt the cache.
+        //
+        // Plan:
+        //: 1 Create a number of threads, each inserting, looking up, and
+        //:   erasing every second one of a disjoint set of keys.  Verify that
+        //:   every lookup succeeds, and that the final size and contents of
+        //:   the cache are as expected.  (C-1)
+        //
+        // Testing:
+        //   THREAD SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "THREAD SAFETY" << endl
+                          << "=============" << endl;
+
+        using namespace threadSafety;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        {
+            Obj mX(bdlcc::CacheEvictionPolicy::e_LRU,
+                   k_NUM_THREADS * k_NUM_ITERATIONS,
+                   k_NUM_THREADS * k_NUM_ITERATIONS,
+                   8,
+                   &ta);
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            ThreadArgs                args[k_NUM_THREADS];
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                args[i].d_cache_p  = &mX;
+                args[i].d_threadId = i;
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      workerThread,
+                                                      &args[i]));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+
+            ASSERTV(mX.size(),
+                    k_NUM_THREADS * k_NUM_ITERATIONS / 2 == mX.size());
+
+            bsl::shared_ptr<bsl::string> value;
+            for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+                for (int t = 0; t < k_NUM_THREADS; ++t) {
+                    const int key = i * k_NUM_THREADS + t;
+                    ASSERTV(key, (i % 2) == mX.tryGetValue(&value, key));
+                }
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // BULK OPERATIONS AND VISIT
+        //
+        // Concerns:
+        //: 1 'insertBulk' inserts every item into the shard of its key, and
+        //:   returns the number of newly inserted items.
+        //:
+        //: 2 The move overload of 'insertBulk' behaves as the copy overload.
+        //:
+        //: 3 'eraseBulk' erases existing keys only, and returns their number.
+        //:
+        //: 4 'visit' visits every item of every shard exactly once, and stops
+        //:   (across shards) as soon as the visitor returns 'false'.
+        //
+        // Plan:
+        //: 1 Bulk insert a set of keys, some of them duplicates of already
+        //:   present keys, and verify the return value and the contents using
+        //:   'tryGetValue' and a collecting visitor.  (C-1..2, 4)
+        //:
+        //: 2 Bulk erase a set of keys, some of which are absent, and verify
+        //:   the return value and the contents.  (C-3)
+        //:
+        //: 3 Visit with a visitor that stops after a given number of items,
+        //:   and verify that it was invoked exactly that number of times.
+        //:   (C-4)
+        //
+        // Testing:
+        //   int insertBulk(const bsl::vector<KVType>& data);
+        //   int insertBulk(bsl::vector<KVType>&& data);
+        //   int eraseBulk(const bsl::vector<KEY>& keys);
+        //   void visit(VISITOR& visitor) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BULK OPERATIONS AND VISIT" << endl
+                          << "=========================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        {
+            Obj mX(bdlcc::CacheEvictionPolicy::e_FIFO, 1000, 1000, 4, &ta);
+            const Obj& X = mX;
+
+            mX.insert(0, "zero");
+
+            bsl::vector<Obj::KVType> data(&ta);
+            for (int i = 0; i < 10; ++i) {
+                data.push_back(Obj::KVType(
+                             i,
+                             bsl::allocate_shared<bsl::string>(&ta, "bulk")));
+            }
+
+            ASSERTV(9 == mX.insertBulk(data));
+            ASSERTV(X.size(), 10 == X.size());
+
+            bsl::shared_ptr<bsl::string> value;
+            ASSERT(0 == mX.tryGetValue(&value, 0));
+            ASSERT("bulk" == *value);
+
+            for (int i = 10; i < 20; ++i) {
+                data[i - 10].first = i;
+            }
+            ASSERT(10 == mX.insertBulk(bslmf::MovableRefUtil::move(data)));
+            ASSERTV(X.size(), 20 == X.size());
+
+            bsl::set<int> keys(&ta);
+            KeyCollector  collector = { &keys };
+            X.visit(collector);
+            ASSERTV(keys.size(), 20 == keys.size());
+            ASSERT(0  == *keys.begin());
+            ASSERT(19 == *keys.rbegin());
+
+            for (int limit = 1; limit <= 25; ++limit) {
+                CountingVisitor visitor = { 0, limit };
+                X.visit(visitor);
+                ASSERTV(limit, visitor.d_count,
+                        (limit < 20 ? limit : 20) == visitor.d_count);
+            }
+
+            bsl::vector<int> eraseKeys(&ta);
+            for (int i = 15; i < 25; ++i) {
+                eraseKeys.push_back(i);
+            }
+            ASSERT(5 == mX.eraseBulk(eraseKeys));
+            ASSERTV(X.size(), 15 == X.size());
+            ASSERT(1 == mX.tryGetValue(&value, 15));
+            ASSERT(0 == mX.tryGetValue(&value, 14));
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // WATERMARKS AND EVICTION
+        //
+        // Concerns:
+        //: 1 Each shard is given its share of the watermarks, rounded up, so
+        //:   that the total size never exceeds the high watermark rounded up
+        //:   to a multiple of the number of shards.
+        //:
+        //: 2 The post-eviction callback is installed in every shard, and is
+        //:   invoked for every evicted or erased item.
+        //:
+        //: 3 'popFront' removes an item as long as any shard is non-empty,
+        //:   and returns 1 once the cache is empty.
+        //
+        // Plan:
+        //: 1 For a range of watermarks and number of shards, insert many keys
+        //:   and verify the bound on the size after each insertion, and that
+        //:   the number of evicted items plus the size equals the number of
+        //:   inserted items.  (C-1..2)
+        //:
+        //: 2 Call 'popFront' until it fails, and verify that the cache is
+        //:   empty and that the callback was invoked for every item.  (C-3)
+        //
+        // Testing:
+        //   int popFront();
+        //   void setPostEvictionCallback(postEvictionCallback);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "WATERMARKS AND EVICTION" << endl
+                          << "=======================" << endl;
+
+        static const struct {
+            int         d_line;
+            bsl::size_t d_low;
+            bsl::size_t d_high;
+            bsl::size_t d_numShards;
+        } DATA[] = {
+            //LINE  LOW  HIGH  SHARDS
+            //----  ---  ----  ------
+            { L_,     1,    1,      1 },
+            { L_,     4,    8,      1 },
+            { L_,     8,   16,      4 },
+            { L_,    10,   13,      4 },
+            { L_,    16,   16,     16 },
+            { L_,    50,  100,      8 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const bsl::size_t LOW    = DATA[ti].d_low;
+            const bsl::size_t HIGH   = DATA[ti].d_high;
+            const bsl::size_t SHARDS = DATA[ti].d_numShards;
+
+            const bsl::size_t SHARD_HIGH = (HIGH + SHARDS - 1) / SHARDS;
+
+            if (veryVerbose) { P_(LINE) P_(LOW) P_(HIGH) P(SHARDS) }
+
+            Obj mX(bdlcc::CacheEvictionPolicy::e_LRU, LOW, HIGH, SHARDS, &ta);
+            const Obj& X = mX;
+
+            evictionCount = 0;
+            mX.setPostEvictionCallback(&countEviction);
+
+            const int NUM_INSERTS = 1000;
+            for (int i = 0; i < NUM_INSERTS; ++i) {
+                mX.insert(i, "value");
+                ASSERTV(LINE, i, X.size(), X.size() <= SHARD_HIGH * SHARDS);
+            }
+            ASSERTV(LINE,
+                    NUM_INSERTS == evictionCount + static_cast<int>(X.size()));
+
+            const int SIZE = static_cast<int>(X.size());
+            for (int i = 0; i < SIZE; ++i) {
+                ASSERTV(LINE, i, 0 == mX.popFront());
+            }
+            ASSERTV(LINE, 0 == X.size());
+            ASSERTV(LINE, 1 == mX.popFront());
+            ASSERTV(LINE, NUM_INSERTS == evictionCount);
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The number of shards is rounded up to a power of 2, but does not
+        //:   exceed the low watermark, and the default constructor uses
+        //:   'k_DEFAULT_NUM_SHARDS' shards and an LRU policy with no size
+        //:   limit.
+        //:
+        //: 2 The accessors return the values supplied at construction.
+        //:
+        //: 3 Inserted items can be retrieved, replaced, and erased, regardless
+        //:   of the quality of the low bits of the hash function.
+        //:
+        //: 4 Keys are distributed over all shards.
+        //:
+        //: 5 All memory comes from the supplied allocator, and is released on
+        //:   destruction.
+        //:
+        //: 6 The size of the cache is always less than the sum of its low and
+        //:   high watermarks, however many shards are requested.
+        //
+        // Plan:
+        //: 1 Create objects using each constructor and a range of number of
+        //:   shards, and verify the accessors.  (C-1..2)
+        //:
+        //: 2 Using an identity hash function, insert a range of keys, and
+        //:   verify each of them using 'tryGetValue'; replace, erase, and
+        //:   clear items.  (C-3)
+        //:
+        //: 3 Insert a range of keys into a cache with a per-shard high
+        //:   watermark of 1, so that every shard holds at most one item, and
+        //:   verify that the number of items equals the number of shards.
+        //:   (C-4)
+        //:
+        //: 4 Use a test allocator and verify that the default allocator is
+        //:   not used, and that all memory is released.  (C-5)
+        //:
+        //: 5 For a range of watermarks and requested numbers of shards, insert
+        //:   many keys and verify the number of shards and that the size of
+        //:   the cache stays below the sum of the watermarks.  (C-1, 6)
+        //
+        // Testing:
+        //   explicit ShardedCache(bslma::Allocator *basicAllocator);
+        //   ShardedCache(policy, lowWat, highWat, numShards, alloc);
+        //   ShardedCache(policy, lowWat, highWat, numShards, hash, eq, alloc);
+        //   ~ShardedCache();
+        //   void insert(const KEY& key, const VALUE& value);
+        //   void insert(const KEY& key, const ValuePtrType& valuePtr);
+        //   void insert(KEY&& key, VALUE&& value);
+        //   int tryGetValue(value, const KEY& key, bool modifyEvictionQueue);
+        //   int erase(const KEY& key);
+        //   void clear();
+        //   CacheEvictionPolicy::Enum evictionPolicy() const;
+        //   bsl::size_t highWatermark() const;
+        //   bsl::size_t lowWatermark() const;
+        //   bsl::size_t numShards() const;
+        //   bsl::size_t size() const;
+        //   HASH hashFunction() const;
+        //   EQUAL equalFunction() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+             << "CREATORS, PRIMARY MANIPULATORS AND BASIC ACCESSORS" << endl
+             << "==================================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\nDefault constructor." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(Obj::k_DEFAULT_NUM_SHARDS == X.numShards());
+            ASSERT(bdlcc::CacheEvictionPolicy::e_LRU == X.evictionPolicy());
+            ASSERT(bsl::numeric_limits<bsl::size_t>::max() ==
+                                                            X.lowWatermark());
+            ASSERT(bsl::numeric_limits<bsl::size_t>::max() ==
+                                                           X.highWatermark());
+            ASSERT(0 == X.size());
+            ASSERT(0 <  ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\nNumber of shards." << endl;
+        {
+            static const struct {
+                int         d_line;
+                bsl::size_t d_lowWatermark;
+                bsl::size_t d_highWatermark;
+                bsl::size_t d_numShards;
+                bsl::size_t d_expected;
+            } DATA[] = {
+                //LINE  LOW  HIGH  SHARDS  EXP
+                //----  ---  ----  ------  ---
+                { L_,   64,   128,      1,   1 },
+                { L_,   64,   128,      2,   2 },
+                { L_,   64,   128,      3,   4 },
+                { L_,   64,   128,      4,   4 },
+                { L_,   64,   128,      5,   8 },
+                { L_,   64,   128,     31,  32 },
+                { L_,   64,   128,     64,  64 },
+                { L_,   64,   128,    100,  64 },
+                { L_,   63,   128,     64,  32 },
+                { L_,    5,    10,      8,   4 },
+                { L_,    1,     1,     16,   1 },
+                { L_,    1,  1000,     16,   1 },
+                { L_,    3,     3,      2,   2 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE   = DATA[ti].d_line;
+                const bsl::size_t LOW    = DATA[ti].d_lowWatermark;
+                const bsl::size_t HIGH   = DATA[ti].d_highWatermark;
+                const bsl::size_t SHARDS = DATA[ti].d_numShards;
+                const bsl::size_t EXP    = DATA[ti].d_expected;
+
+                Obj mX(bdlcc::CacheEvictionPolicy::e_FIFO,
+                       LOW,
+                       HIGH,
+                       SHARDS,
+                       &ta);
+                const Obj& X = mX;
+
+                ASSERTV(LINE, X.numShards(), EXP == X.numShards());
+                ASSERTV(LINE, bdlcc::CacheEvictionPolicy::e_FIFO ==
+                                                         X.evictionPolicy());
+                ASSERTV(LINE, LOW  == X.lowWatermark());
+                ASSERTV(LINE, HIGH == X.highWatermark());
+
+                for (int i = 0; i < 2000; ++i) {
+                    mX.insert(i, "x");
+
+                    ASSERTV(LINE, i, X.size(), X.size() < LOW + HIGH);
+                }
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\nInsert, lookup and erase." << endl;
+        {
+            typedef bdlcc::ShardedCache<int, bsl::string, IdentityHash> ObjH;
+
+            ObjH mX(bdlcc::CacheEvictionPolicy::e_LRU,
+                    1000,
+                    1000,
+                    8,
+                    IdentityHash(),
+                    bsl::equal_to<int>(),
+                    &ta);
+            const ObjH& X = mX;
+
+            ASSERT(8 == X.numShards());
+            ASSERT(7 == X.hashFunction()(7));
+            ASSERT(X.equalFunction()(3, 3));
+
+            for (int i = 0; i < 100; ++i) {
+                bsl::ostringstream oss;
+                oss << i;
+                if (i % 3) {
+                    mX.insert(i, oss.str());
+                }
+                else {
+                    mX.insert(i,
+                              bsl::allocate_shared<bsl::string>(&ta,
+                                                                oss.str()));
+                }
+                ASSERTV(i, static_cast<bsl::size_t>(i + 1) == X.size());
+            }
+
+            bsl::shared_ptr<bsl::string> value;
+            for (int i = 0; i < 100; ++i) {
+                bsl::ostringstream oss;
+                oss << i;
+                ASSERTV(i, 0 == mX.tryGetValue(&value, i, i % 2));
+                ASSERTV(i, oss.str() == *value);
+            }
+            ASSERT(1 == mX.tryGetValue(&value, 100));
+
+            int        key = 5;
+            bsl::string s("five", &ta);
+            mX.insert(bslmf::MovableRefUtil::move(key),
+                      bslmf::MovableRefUtil::move(s));
+            ASSERT(100 == X.size());
+            ASSERT(0 == mX.tryGetValue(&value, 5));
+            ASSERT("five" == *value);
+
+            ASSERT(0 == mX.erase(5));
+            ASSERT(1 == mX.erase(5));
+            ASSERT(99 == X.size());
+
+            mX.clear();
+            ASSERT(0 == X.size());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\nDistribution over shards." << endl;
+        {
+            const bsl::size_t SHARDS = 16;
+
+            Obj mX(bdlcc::CacheEvictionPolicy::e_FIFO,
+                   SHARDS,
+                   SHARDS,
+                   SHARDS,
+                   &ta);
+            const Obj& X = mX;
+
+            for (int i = 0; i < 10000; ++i) {
+                mX.insert(i, "x");
+            }
+
+            // Each shard has a high watermark of 1; after an insertion into a
+            // shard holding one item, the shard holds exactly one item.
+
+            ASSERTV(X.size(), SHARDS == X.size());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object, insert, look up, and erase a few items.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        {
+            Obj mX(bdlcc::CacheEvictionPolicy::e_LRU, 100, 200, 4, &ta);
+            const Obj& X = mX;
+
+            ASSERT(4 == X.numShards());
+            ASSERT(0 == X.size());
+
+            mX.insert(1, "one");
+            mX.insert(2, "two");
+            mX.insert(3, "three");
+            ASSERT(3 == X.size());
+
+            bsl::shared_ptr<bsl::string> value;
+            ASSERT(0 == mX.tryGetValue(&value, 2));
+            ASSERT("two" == *value);
+            ASSERT(1 == mX.tryGetValue(&value, 4));
+
+            ASSERT(0 == mX.erase(2));
+            ASSERT(1 == mX.tryGetValue(&value, 2));
+            ASSERT(2 == X.size());
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // THROUGHPUT BENCHMARK: 'Cache' VS 'ShardedCache'
+        //   Compare the throughput of 'bdlcc::Cache' and 'bdlcc::ShardedCache'
+        //   under a mixed read / write load.  Command line parameters:
+        //   2nd parameter: number of reader threads, comma separated list
+        //       (defaults to "1,2,4,8")
+        //   3rd parameter: number of writer threads (defaults to 1)
+        //   4th parameter: number of shards (defaults to 16)
+        //   5th parameter: eviction policy, 0-LRU, 1-FIFO (defaults to 0)
+        //   6th parameter: number of keys (defaults to 100000)
+        //   7th parameter: number of milliseconds each sample runs (defaults
+        //       to 1000)
+        //   8th parameter: number of samples to run (defaults to 5)
+        //
+        // Concerns:
+        //: 1 The sharded cache scales with the number of threads when a single
+        //:   cache does not.
+        //
+        // Plan:
+        //: 1 For each number of reader threads, use
+        //:   'bslmt::ThroughputBenchmark' to measure the median throughput
+        //:   (operations per second) of the reader and writer thread groups
+        //:   against each cache type, with the high watermark set to the
+        //:   number of keys so that lookups and insertions (but no eviction)
+        //:   dominate.  (C-1)
+        //
+        // Testing:
+        //   THROUGHPUT BENCHMARK: 'Cache' VS 'ShardedCache'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "THROUGHPUT BENCHMARK" << endl
+                          << "====================" << endl;
+
+        bslma::NewDeleteAllocator nalloc;
+
+        bsl::vector<int> numReaders = stringSplit(argc > 2 ? argv[2]
+                                                           : "1,2,4,8");
+        int numWriters = argc > 3 ? atoi(argv[3]) :      1;
+        int numShards  = argc > 4 ? atoi(argv[4]) :     16;
+        int policy     = argc > 5 ? atoi(argv[5]) :      0;
+        int numKeys    = argc > 6 ? atoi(argv[6]) : 100000;
+        int numMillis  = argc > 7 ? atoi(argv[7]) :   1000;
+        int numSamples = argc > 8 ? atoi(argv[8]) :      5;
+
+        const bdlcc::CacheEvictionPolicy::Enum evictionPolicy =
+                              policy ? bdlcc::CacheEvictionPolicy::e_FIFO
+                                     : bdlcc::CacheEvictionPolicy::e_LRU;
+
+        bsl::cout << "Cache,Readers,Writers,ReadOps/s,WriteOps/s\n";
+
+        for (bsl::size_t i = 0; i < numReaders.size(); ++i) {
+            {
+                bdlcc::Cache<int, int> cache(evictionPolicy,
+                                             numKeys,
+                                             numKeys,
+                                             &nalloc);
+                cachePerf::runBenchmark("Cache",
+                                        &cache,
+                                        numKeys,
+                                        numReaders[i],
+                                        numWriters,
+                                        numMillis,
+                                        numSamples);
+            }
+            {
+                bdlcc::ShardedCache<int, int> cache(evictionPolicy,
+                                                    numKeys,
+                                                    numKeys,
+                                                    numShards,
+                                                    &nalloc);
+                cachePerf::runBenchmark("ShardedCache",
+                                        &cache,
+                                        numKeys,
+                                        numReaders[i],
+                                        numWriters,
+                                        numMillis,
+                                        numSamples);
+            }
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (test >= 0) {
+        // CONCERN: In no case does memory come from the default allocator.
+
+        ASSERT(dam.isTotalSame());
+
+        // CONCERN: In no case does memory come from the global allocator.
+
+        ASSERT(gam.isTotalSame());
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------------------------------------------------------
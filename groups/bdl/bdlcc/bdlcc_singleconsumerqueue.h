@@ -29,6 +29,12 @@ BSLS_IDENT("$Id: $")
 // provided.  The 'tryPopFront' method fails immediately, returning a non-zero
 // value, if the queue is empty.
 //
+// Runs of elements may be transferred with 'pushBackRange' and 'popFrontUpTo'
+// (and their counterparts 'tryPushBackRange' and 'tryPopFrontUpTo').  These
+// methods update the shared state of the queue once per run rather than once
+// per element, and 'pushBackRange' wakes a blocked consumer at most once per
+// run when the queue has enough spare nodes to hold the whole run.
+//
 // The queue may be placed into a "enqueue disabled" state using the
 // 'disablePushBack' method.  When disabled, 'pushBack' and 'tryPushBack' fail
 // immediately and return an error code.  The queue may be restored to normal
@@ -230,6 +236,23 @@ class SingleConsumerQueue {
         // 'e_DISABLED' if 'disablePopFront' is invoked.  The behavior is
         // undefined unless the invoker of this method is the single consumer.
 
+    int popFrontUpTo(bsl::size_t *numPopped,
+                     TYPE        *buffer,
+                     bsl::size_t  maxNumElements);
+        // Remove up to the specified 'maxNumElements' elements from the front
+        // of this queue, load them, in order, into the array starting at the
+        // specified 'buffer', and load the number of elements removed into the
+        // specified 'numPopped'.  If the queue is empty, block until it is not
+        // empty; no further blocking occurs once an element is available.
+        // Return 0 on success, and a non-zero value otherwise.  Specifically,
+        // return 'e_DISABLED' if 'isPopFrontDisabled()'.  On failure,
+        // '*numPopped' is 0 and 'buffer' is not changed.  Threads blocked due
+        // to the queue being empty will return 'e_DISABLED' if
+        // 'disablePopFront' is invoked.  The behavior is undefined unless the
+        // invoker of this method is the single consumer, '0 < maxNumElements',
+        // and 'buffer' refers to an array of at least 'maxNumElements'
+        // elements.
+
     int pushBack(const TYPE& value);
         // Append the specified 'value' to the back of this queue.  Return 0 on
         // success, and a non-zero value otherwise.  Specifically, return
@@ -242,6 +265,18 @@ class SingleConsumerQueue {
         // 'e_DISABLED' if 'isPushBackDisabled()'.  On failure, 'value' is not
         // changed.
 
+    template <class FORWARD_ITER>
+    int pushBackRange(bsl::size_t  *numPushed,
+                      FORWARD_ITER  begin,
+                      FORWARD_ITER  end);
+        // Append the elements of the specified range '[begin .. end)', in
+        // order, to the back of this queue, and load the number of elements
+        // appended into the specified 'numPushed'.  Return 0 on success, and a
+        // non-zero value otherwise.  Specifically, return 'e_DISABLED' if
+        // 'isPushBackDisabled()'.  On failure, the first '*numPushed' elements
+        // of the range have been appended.  Note that the elements of the
+        // range are copied without being modified.
+
     void removeAll();
         // Remove all items currently in this queue.  Note that this operation
         // is not atomic; if other threads are concurrently pushing items into
@@ -271,6 +306,33 @@ class SingleConsumerQueue {
         // 'e_DISABLED' if 'isPushBackDisabled()'.  On failure, 'value' is not
         // changed.
 
+    int tryPopFrontUpTo(bsl::size_t *numPopped,
+                        TYPE        *buffer,
+                        bsl::size_t  maxNumElements);
+        // Attempt to remove, without blocking, up to the specified
+        // 'maxNumElements' elements from the front of this queue, load them,
+        // in order, into the array starting at the specified 'buffer', and
+        // load the number of elements removed into the specified 'numPopped'.
+        // Return 0 on success, and a non-zero value otherwise.  Specifically,
+        // return 'e_DISABLED' if 'isPopFrontDisabled()', and 'e_EMPTY' if
+        // '!isPopFrontDisabled()' and the queue was empty.  On failure,
+        // '*numPopped' is 0 and 'buffer' is not changed.  The behavior is
+        // undefined unless the invoker of this method is the single consumer,
+        // '0 < maxNumElements', and 'buffer' refers to an array of at least
+        // 'maxNumElements' elements.
+
+    template <class FORWARD_ITER>
+    int tryPushBackRange(bsl::size_t  *numPushed,
+                         FORWARD_ITER  begin,
+                         FORWARD_ITER  end);
+        // Append the elements of the specified range '[begin .. end)', in
+        // order, to the back of this queue, and load the number of elements
+        // appended into the specified 'numPushed'.  Return 0 on success, and a
+        // non-zero value otherwise.  Specifically, return 'e_DISABLED' if
+        // 'isPushBackDisabled()'.  On failure, the first '*numPushed' elements
+        // of the range have been appended.  Note that the elements of the
+        // range are copied without being modified.
+
                        // Enqueue/Dequeue State
 
     void disablePopFront();
@@ -361,6 +423,14 @@ int SingleConsumerQueue<TYPE>::popFront(TYPE *value)
     return d_impl.popFront(value);
 }
 
+template <class TYPE>
+int SingleConsumerQueue<TYPE>::popFrontUpTo(bsl::size_t *numPopped,
+                                            TYPE        *buffer,
+                                            bsl::size_t  maxNumElements)
+{
+    return d_impl.popFrontUpTo(numPopped, buffer, maxNumElements);
+}
+
 template <class TYPE>
 int SingleConsumerQueue<TYPE>::pushBack(const TYPE& value)
 {
@@ -373,6 +443,15 @@ int SingleConsumerQueue<TYPE>::pushBack(bslmf::MovableRef<TYPE> value)
     return d_impl.pushBack(bslmf::MovableRefUtil::move(value));
 }
 
+template <class TYPE>
+template <class FORWARD_ITER>
+int SingleConsumerQueue<TYPE>::pushBackRange(bsl::size_t  *numPushed,
+                                             FORWARD_ITER  begin,
+                                             FORWARD_ITER  end)
+{
+    return d_impl.pushBackRange(numPushed, begin, end);
+}
+
 template <class TYPE>
 void SingleConsumerQueue<TYPE>::removeAll()
 {
@@ -397,6 +476,23 @@ int SingleConsumerQueue<TYPE>::tryPushBack(bslmf::MovableRef<TYPE> value)
     return d_impl.tryPushBack(bslmf::MovableRefUtil::move(value));
 }
 
+template <class TYPE>
+int SingleConsumerQueue<TYPE>::tryPopFrontUpTo(bsl::size_t *numPopped,
+                                               TYPE        *buffer,
+                                               bsl::size_t  maxNumElements)
+{
+    return d_impl.tryPopFrontUpTo(numPopped, buffer, maxNumElements);
+}
+
+template <class TYPE>
+template <class FORWARD_ITER>
+int SingleConsumerQueue<TYPE>::tryPushBackRange(bsl::size_t  *numPushed,
+                                                FORWARD_ITER  begin,
+                                                FORWARD_ITER  end)
+{
+    return d_impl.tryPushBackRange(numPushed, begin, end);
+}
+
                        // Enqueue/Dequeue State
 
 template <class TYPE>
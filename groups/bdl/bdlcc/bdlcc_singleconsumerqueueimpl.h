@@ -29,6 +29,15 @@ BSLS_IDENT("$Id: $")
 // provided.  The 'tryPopFront' method fails immediately, returning a non-zero
 // value, if the queue is empty.
 //
+// Runs of elements may be transferred with 'pushBackRange' and 'popFrontUpTo'
+// (and their counterparts 'tryPushBackRange' and 'tryPopFrontUpTo').  When
+// enough nodes are available, 'pushBackRange' claims a contiguous run of nodes
+// for the whole range with a single update of the queue state, and publishes
+// the run such that a blocked consumer is signalled at most once; otherwise,
+// the elements are pushed one at a time.  'popFrontUpTo' consumes the run of
+// readable nodes at the front of the queue and returns the run to the
+// producers with a single update of the queue state.
+//
 // The queue may be placed into a "enqueue disabled" state using the
 // 'disablePushBack' method.  When disabled, 'pushBack' and 'tryPushBack' fail
 // immediately and return an error code.  The queue may be restored to normal
@@ -101,6 +110,7 @@ BSLS_IDENT("$Id: $")
 #include <bsls_types.h>
 
 #include <bsl_cstddef.h>
+#include <bsl_iterator.h>
 
 namespace BloombergLP {
 namespace bdlcc {
@@ -209,6 +219,89 @@ class SingleConsumerQueueImpl_PopCompleteGuard {
         // managed queue.
 };
 
+           // ===================================================
+           // class SingleConsumerQueueImpl_PopRangeCompleteGuard
+           // ===================================================
+
+template <class TYPE>
+class SingleConsumerQueueImpl_PopRangeCompleteGuard {
+    // This class implements a guard that, upon destruction, automatically
+    // invokes 'popRangeComplete' on the managed queue with the number of nodes
+    // consumed.
+
+    // DATA
+    TYPE                *d_queue_p;   // managed queue
+    bsls::Types::Int64   d_numNodes;  // number of nodes consumed
+
+    // NOT IMPLEMENTED
+    SingleConsumerQueueImpl_PopRangeCompleteGuard();
+    SingleConsumerQueueImpl_PopRangeCompleteGuard(
+                         const SingleConsumerQueueImpl_PopRangeCompleteGuard&);
+    SingleConsumerQueueImpl_PopRangeCompleteGuard& operator=(
+                         const SingleConsumerQueueImpl_PopRangeCompleteGuard&);
+
+  public:
+    // CREATORS
+    explicit
+    SingleConsumerQueueImpl_PopRangeCompleteGuard(TYPE *queue);
+        // Create a 'popRangeComplete' guard managing the specified 'queue'
+        // with no nodes consumed.
+
+    ~SingleConsumerQueueImpl_PopRangeCompleteGuard();
+        // Destroy this object and, if at least one node was consumed, invoke
+        // the 'popRangeComplete' method on the managed queue with the number
+        // of nodes consumed.
+
+    // MANIPULATORS
+    void increment();
+        // Indicate that the next node at the front of the managed queue has
+        // been consumed.
+};
+
+           // ====================================================
+           // class SingleConsumerQueueImpl_PushRangeCompleteGuard
+           // ====================================================
+
+template <class TYPE, class NODE>
+class SingleConsumerQueueImpl_PushRangeCompleteGuard {
+    // This class implements a guard that, upon destruction, automatically
+    // invokes 'pushRangeComplete' on the managed run of 'NODE' objects with
+    // the number of nodes, in order, that have had a value constructed.
+
+    // DATA
+    TYPE               *d_queue_p;    // managed queue owning the managed run
+    NODE               *d_first_p;    // first node of the managed run
+    bsls::Types::Int64  d_numNodes;   // number of nodes in the run
+    bsls::Types::Int64  d_numPushed;  // number of values constructed
+
+    // NOT IMPLEMENTED
+    SingleConsumerQueueImpl_PushRangeCompleteGuard();
+    SingleConsumerQueueImpl_PushRangeCompleteGuard(
+                        const SingleConsumerQueueImpl_PushRangeCompleteGuard&);
+    SingleConsumerQueueImpl_PushRangeCompleteGuard& operator=(
+                        const SingleConsumerQueueImpl_PushRangeCompleteGuard&);
+
+  public:
+    // CREATORS
+    SingleConsumerQueueImpl_PushRangeCompleteGuard(
+                                              TYPE               *queue,
+                                              NODE               *first,
+                                              bsls::Types::Int64  numNodes);
+        // Create a 'pushRangeComplete' guard managing the run of the specified
+        // 'numNodes' nodes starting at the specified 'first' node of the
+        // specified 'queue', none of which has had a value constructed.
+
+    ~SingleConsumerQueueImpl_PushRangeCompleteGuard();
+        // Destroy this object and invoke the 'pushRangeComplete' method on the
+        // managed queue with the managed run and the number of values
+        // constructed.
+
+    // MANIPULATORS
+    void increment();
+        // Indicate that a value has been constructed in the next node of the
+        // managed run.
+};
+
                       // =============================
                       // class SingleConsumerQueueImpl
                       // =============================
@@ -334,6 +427,22 @@ class SingleConsumerQueueImpl {
                                                                   MUTEX,
                                                                   CONDITION> >;
 
+    friend class SingleConsumerQueueImpl_PopRangeCompleteGuard<
+                                          SingleConsumerQueueImpl<TYPE,
+                                                                  ATOMIC_OP,
+                                                                  MUTEX,
+                                                                  CONDITION> >;
+
+    friend class SingleConsumerQueueImpl_PushRangeCompleteGuard<
+                           SingleConsumerQueueImpl<TYPE,
+                                                   ATOMIC_OP,
+                                                   MUTEX,
+                                                   CONDITION>,
+                           typename SingleConsumerQueueImpl<TYPE,
+                                                            ATOMIC_OP,
+                                                            MUTEX,
+                                                            CONDITION>::Node >;
+
     // PRIVATE CLASS METHODS
     static bsls::Types::Int64 available(bsls::Types::Int64 state);
         // Return the available attribute from the specified 'state'.
@@ -348,10 +457,34 @@ class SingleConsumerQueueImpl {
         // then signal the queue empty condition.  This method is used to
         // complete the reclamation of a node in the presence of an exception.
 
+    void popRangeComplete(bsls::Types::Int64 numNodes);
+        // Destruct the values stored in the specified 'numNodes' nodes
+        // starting at 'd_nextRead' that are readable, mark these nodes
+        // writable, advance 'd_nextRead' past them, and if the queue is empty
+        // then signal the queue empty condition.  The behavior is undefined
+        // unless each of the 'numNodes' nodes is readable or marked for
+        // reclamation.
+
     Node *pushBackHelper();
         // Return a pointer to the node to assign the value being pushed into
         // this queue, or 0 if 'isPushBackDisabled()'.
 
+    Node *pushBackRangeHelper(bsls::Types::Int64 numNodes);
+        // Return a pointer to the first node of a contiguous run of the
+        // specified 'numNodes' existing nodes to assign the values being
+        // pushed into this queue, or 0 if fewer than 'numNodes' nodes are
+        // available (in which case no node is claimed).  The behavior is
+        // undefined unless '0 < numNodes'.
+
+    void pushRangeComplete(Node               *first,
+                           bsls::Types::Int64  numNodes,
+                           bsls::Types::Int64  numPushed);
+        // Mark readable the specified 'numPushed' leading nodes of the run of
+        // the specified 'numNodes' nodes starting at the specified 'first'
+        // node, and mark the remaining nodes of the run for reclamation.  If
+        // the consumer is blocked on 'first', signal it.  The behavior is
+        // undefined unless 'numPushed <= numNodes'.
+
     void incrementUntil(AtomicUint *value, unsigned int bitValue);
         // If the specified 'value' does not have its lowest-order bit set to
         // the value of the specified 'bitValue', increment 'value' until it
@@ -413,6 +546,23 @@ class SingleConsumerQueueImpl {
         // 'e_DISABLED' if 'disablePopFront' is invoked.  The behavior is
         // undefined unless the invoker of this method is the single consumer.
 
+    int popFrontUpTo(bsl::size_t *numPopped,
+                     TYPE        *buffer,
+                     bsl::size_t  maxNumElements);
+        // Remove up to the specified 'maxNumElements' elements from the front
+        // of this queue, load them, in order, into the array starting at the
+        // specified 'buffer', and load the number of elements removed into the
+        // specified 'numPopped'.  If the queue is empty, block until it is not
+        // empty; no further blocking occurs once an element is available.
+        // Return 0 on success, and a non-zero value otherwise.  Specifically,
+        // return 'e_DISABLED' if 'isPopFrontDisabled()'.  On failure,
+        // '*numPopped' is 0 and 'buffer' is not changed.  Threads blocked due
+        // to the queue being empty will return 'e_DISABLED' if
+        // 'disablePopFront' is invoked.  The behavior is undefined unless the
+        // invoker of this method is the single consumer, '0 < maxNumElements',
+        // and 'buffer' refers to an array of at least 'maxNumElements'
+        // elements.
+
     int pushBack(const TYPE& value);
         // Append the specified 'value' to the back of this queue.  Return 0 on
         // success, and a non-zero value otherwise.  Specifically, return
@@ -425,6 +575,18 @@ class SingleConsumerQueueImpl {
         // 'e_DISABLED' if 'isPushBackDisabled()'.  On failure, 'value' is not
         // changed.
 
+    template <class FORWARD_ITER>
+    int pushBackRange(bsl::size_t  *numPushed,
+                      FORWARD_ITER  begin,
+                      FORWARD_ITER  end);
+        // Append the elements of the specified range '[begin .. end)', in
+        // order, to the back of this queue, and load the number of elements
+        // appended into the specified 'numPushed'.  Return 0 on success, and a
+        // non-zero value otherwise.  Specifically, return 'e_DISABLED' if
+        // 'isPushBackDisabled()'.  On failure, the first '*numPushed' elements
+        // of the range have been appended.  Note that the elements of the
+        // range are copied without being modified.
+
     void removeAll();
         // Remove all items currently in this queue.  Note that this operation
         // is not atomic; if other threads are concurrently pushing items into
@@ -454,6 +616,33 @@ class SingleConsumerQueueImpl {
         // 'e_DISABLED' if 'isPushBackDisabled()'.  On failure, 'value' is not
         // changed.
 
+    int tryPopFrontUpTo(bsl::size_t *numPopped,
+                        TYPE        *buffer,
+                        bsl::size_t  maxNumElements);
+        // Attempt to remove, without blocking, up to the specified
+        // 'maxNumElements' elements from the front of this queue, load them,
+        // in order, into the array starting at the specified 'buffer', and
+        // load the number of elements removed into the specified 'numPopped'.
+        // Return 0 on success, and a non-zero value otherwise.  Specifically,
+        // return 'e_DISABLED' if 'isPopFrontDisabled()', and 'e_EMPTY' if
+        // '!isPopFrontDisabled()' and the queue was empty.  On failure,
+        // '*numPopped' is 0 and 'buffer' is not changed.  The behavior is
+        // undefined unless the invoker of this method is the single consumer,
+        // '0 < maxNumElements', and 'buffer' refers to an array of at least
+        // 'maxNumElements' elements.
+
+    template <class FORWARD_ITER>
+    int tryPushBackRange(bsl::size_t  *numPushed,
+                         FORWARD_ITER  begin,
+                         FORWARD_ITER  end);
+        // Append the elements of the specified range '[begin .. end)', in
+        // order, to the back of this queue, and load the number of elements
+        // appended into the specified 'numPushed'.  Return 0 on success, and a
+        // non-zero value otherwise.  Specifically, return 'e_DISABLED' if
+        // 'isPushBackDisabled()'.  On failure, the first '*numPushed' elements
+        // of the range have been appended.  Note that the elements of the
+        // range are copied without being modified.
+
                        // Enqueue/Dequeue State
 
     void disablePopFront();
@@ -593,6 +782,69 @@ SingleConsumerQueueImpl_PopCompleteGuard<TYPE>::
     d_queue_p->popComplete(true);
 }
 
+           // ---------------------------------------------------
+           // class SingleConsumerQueueImpl_PopRangeCompleteGuard
+           // ---------------------------------------------------
+
+// CREATORS
+template <class TYPE>
+SingleConsumerQueueImpl_PopRangeCompleteGuard<TYPE>::
+                     SingleConsumerQueueImpl_PopRangeCompleteGuard(TYPE *queue)
+: d_queue_p(queue)
+, d_numNodes(0)
+{
+}
+
+template <class TYPE>
+SingleConsumerQueueImpl_PopRangeCompleteGuard<TYPE>::
+                               ~SingleConsumerQueueImpl_PopRangeCompleteGuard()
+{
+    if (d_numNodes) {
+        d_queue_p->popRangeComplete(d_numNodes);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void SingleConsumerQueueImpl_PopRangeCompleteGuard<TYPE>::increment()
+{
+    ++d_numNodes;
+}
+
+           // ----------------------------------------------------
+           // class SingleConsumerQueueImpl_PushRangeCompleteGuard
+           // ----------------------------------------------------
+
+// CREATORS
+template <class TYPE, class NODE>
+SingleConsumerQueueImpl_PushRangeCompleteGuard<TYPE, NODE>::
+                SingleConsumerQueueImpl_PushRangeCompleteGuard(
+                                                TYPE               *queue,
+                                                NODE               *first,
+                                                bsls::Types::Int64  numNodes)
+: d_queue_p(queue)
+, d_first_p(first)
+, d_numNodes(numNodes)
+, d_numPushed(0)
+{
+}
+
+template <class TYPE, class NODE>
+SingleConsumerQueueImpl_PushRangeCompleteGuard<TYPE, NODE>::
+                              ~SingleConsumerQueueImpl_PushRangeCompleteGuard()
+{
+    d_queue_p->pushRangeComplete(d_first_p, d_numNodes, d_numPushed);
+}
+
+// MANIPULATORS
+template <class TYPE, class NODE>
+inline
+void SingleConsumerQueueImpl_PushRangeCompleteGuard<TYPE, NODE>::increment()
+{
+    ++d_numPushed;
+}
+
                       // -----------------------------
                       // class SingleConsumerQueueImpl
                       // -----------------------------
@@ -653,6 +905,48 @@ void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
     }
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                                ::popRangeComplete(bsls::Types::Int64 numNodes)
+{
+    Node *nextRead =
+                    static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextRead));
+
+    bsls::Types::Int64 reclaim = 0;
+
+    for (bsls::Types::Int64 i = 0; i < numNodes; ++i) {
+        if (e_READABLE == ATOMIC_OP::getIntAcquire(&nextRead->d_state)) {
+            nextRead->d_value.object().~TYPE();
+        }
+        else {
+            ++reclaim;
+        }
+        ATOMIC_OP::setIntRelease(&nextRead->d_state, e_WRITABLE);
+        nextRead =
+              static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&nextRead->d_next));
+    }
+
+    ATOMIC_OP::setPtrRelease(&d_nextRead, nextRead);
+
+    if (reclaim) {
+        ATOMIC_OP::addInt64AcqRel(&d_capacity, reclaim);
+    }
+
+    // The whole run is returned to the producers with one update of the
+    // state.
+
+    bsls::Types::Int64 state = ATOMIC_OP::addInt64NvAcqRel(
+                                                  &d_state,
+                                                  k_AVAILABLE_INC * numNodes);
+
+    if (ATOMIC_OP::getInt64Acquire(&d_capacity) == available(state)) {
+        {
+            bslmt::LockGuard<MUTEX> guard(&d_emptyMutex);
+        }
+        d_emptyCondition.broadcast();
+    }
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 typename SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::Node *
                      SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
@@ -754,6 +1048,103 @@ typename SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::Node *
     return nextWrite;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+typename SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::Node *
+                     SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                            ::pushBackRangeHelper(bsls::Types::Int64 numNodes)
+{
+    BSLS_ASSERT(0 < numNodes);
+
+    // Only existing nodes are claimed for a run; allocation of new nodes is
+    // left to 'pushBackHelper'.  Avoid disturbing the state when the run
+    // clearly cannot be satisfied.
+
+    bsls::Types::Int64 state = ATOMIC_OP::getInt64Acquire(&d_state);
+    if (available(state) < numNodes || 0 < (state & k_ALLOCATE_MASK)) {
+        return 0;                                                     // RETURN
+    }
+
+    state = ATOMIC_OP::addInt64NvAcqRel(
+                                      &d_state,
+                                      k_USE_INC - k_AVAILABLE_INC * numNodes);
+
+    if (0 > state || 0 < (state & k_ALLOCATE_MASK)) {
+
+        // The run can not be satisfied from the available nodes, or a thread
+        // is allocating a node; undo the indication.
+
+        ATOMIC_OP::addInt64AcqRel(&d_state,
+                                  k_AVAILABLE_INC * numNodes - k_USE_INC);
+        return 0;                                                     // RETURN
+    }
+
+    // Note that there are no threads attempting to allocate new nodes, so the
+    // links between the available nodes are stable.
+
+    Node *nextWrite = static_cast<Node *>(
+                                       ATOMIC_OP::getPtrAcquire(&d_nextWrite));
+    Node *expNextWrite;
+    do {
+        expNextWrite = nextWrite;
+
+        Node *next = nextWrite;
+        for (bsls::Types::Int64 i = 0; i < numNodes; ++i) {
+            next = static_cast<Node *>(
+                                      ATOMIC_OP::getPtrAcquire(&next->d_next));
+        }
+
+        nextWrite = static_cast<Node *>(ATOMIC_OP::testAndSwapPtrAcqRel(
+                                                                  &d_nextWrite,
+                                                                  nextWrite,
+                                                                  next));
+    } while (nextWrite != expNextWrite);
+
+    ATOMIC_OP::addInt64AcqRel(&d_state, -k_USE_INC);
+
+    return nextWrite;
+}
+
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                       ::pushRangeComplete(Node               *first,
+                                           bsls::Types::Int64  numNodes,
+                                           bsls::Types::Int64  numPushed)
+{
+    BSLS_ASSERT(numPushed <= numNodes);
+
+    // The consumer can not advance past 'first' until 'first' is readable, so
+    // the remaining nodes of the run are published before 'first' and can not
+    // have a blocked consumer; at most one signal is needed for the run.
+
+    Node *at = static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&first->d_next));
+    for (bsls::Types::Int64 i = 1; i < numNodes; ++i) {
+        Node *next =
+                    static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&at->d_next));
+
+        if (i < numPushed) {
+            ATOMIC_OP::setIntRelease(&at->d_state, e_READABLE);
+        }
+        else {
+            markReclaim(at);
+        }
+
+        at = next;
+    }
+
+    if (0 == numPushed) {
+        markReclaim(first);
+        return;                                                       // RETURN
+    }
+
+    int nodeState = ATOMIC_OP::swapIntAcqRel(&first->d_state, e_READABLE);
+    if (e_WRITABLE_AND_BLOCKED == nodeState) {
+        {
+            bslmt::LockGuard<MUTEX> guard(&d_readMutex);
+        }
+        d_readCondition.signal();
+    }
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
                      ::incrementUntil(AtomicUint *value, unsigned int bitValue)
@@ -950,6 +1341,36 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::popFront(
     return 0;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                               ::popFrontUpTo(bsl::size_t *numPopped,
+                                              TYPE        *buffer,
+                                              bsl::size_t  maxNumElements)
+{
+    BSLS_ASSERT(numPopped);
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 < maxNumElements);
+
+    int rv = tryPopFrontUpTo(numPopped, buffer, maxNumElements);
+    if (e_EMPTY != rv) {
+        return rv;                                                    // RETURN
+    }
+
+    rv = popFront(buffer);
+    if (rv) {
+        return rv;                                                    // RETURN
+    }
+
+    bsl::size_t numAdditional = 0;
+    if (1 < maxNumElements) {
+        tryPopFrontUpTo(&numAdditional, buffer + 1, maxNumElements - 1);
+    }
+
+    *numPopped = 1 + numAdditional;
+
+    return 0;
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::pushBack(
                                                              const TYPE& value)
@@ -1019,6 +1440,66 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::pushBack(
     return 0;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+template <class FORWARD_ITER>
+int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                                 ::pushBackRange(bsl::size_t  *numPushed,
+                                                 FORWARD_ITER  begin,
+                                                 FORWARD_ITER  end)
+{
+    BSLS_ASSERT(numPushed);
+
+    *numPushed = 0;
+
+    if (1 == (ATOMIC_OP::getUintAcquire(&d_pushBackDisabled) & 1)) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    const bsls::Types::Int64 numElements = bsl::distance(begin, end);
+    if (0 == numElements) {
+        return 0;                                                     // RETURN
+    }
+
+    Node *first = pushBackRangeHelper(numElements);
+
+    if (0 == first) {
+        // There are not enough available nodes for the range; push the
+        // elements one at a time, allocating nodes as needed.
+
+        for (; begin != end; ++begin) {
+            int rv = pushBack(*begin);
+            if (rv) {
+                return rv;                                            // RETURN
+            }
+            ++*numPushed;
+        }
+        return 0;                                                     // RETURN
+    }
+
+    SingleConsumerQueueImpl_PushRangeCompleteGuard<
+                                            SingleConsumerQueueImpl<TYPE,
+                                                                    ATOMIC_OP,
+                                                                    MUTEX,
+                                                                    CONDITION>,
+                                            Node> guard(this,
+                                                        first,
+                                                        numElements);
+
+    Node *at = first;
+    for (; begin != end; ++begin) {
+        bslalg::ScalarPrimitives::copyConstruct(at->d_value.address(),
+                                                *begin,
+                                                d_allocator_p);
+        guard.increment();
+
+        at = static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&at->d_next));
+    }
+
+    *numPushed = static_cast<bsl::size_t>(numElements);
+
+    return 0;
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::removeAll()
 {
@@ -1092,6 +1573,66 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPopFront(
     return 0;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                            ::tryPopFrontUpTo(bsl::size_t *numPopped,
+                                              TYPE        *buffer,
+                                              bsl::size_t  maxNumElements)
+{
+    BSLS_ASSERT(numPopped);
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 < maxNumElements);
+
+    *numPopped = 0;
+
+    unsigned int generation = ATOMIC_OP::getUintAcquire(&d_popFrontDisabled);
+    if (1 == (generation & 1)) {
+        return e_DISABLED;                                            // RETURN
+    }
+
+    bsl::size_t count = 0;
+    {
+        SingleConsumerQueueImpl_PopRangeCompleteGuard<
+                              SingleConsumerQueueImpl<TYPE,
+                                                      ATOMIC_OP,
+                                                      MUTEX,
+                                                      CONDITION> > guard(this);
+
+        Node *at = static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextRead));
+        int   nodeState = ATOMIC_OP::getIntAcquire(&at->d_state);
+
+        while (count < maxNumElements
+            && (e_READABLE == nodeState || e_RECLAIM == nodeState)) {
+
+            // The node is counted before its value is moved so that the guard
+            // completes the node if the assignment throws.
+
+            guard.increment();
+
+            if (e_READABLE == nodeState) {
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+                buffer[count] =
+                           bslmf::MovableRefUtil::move(at->d_value.object());
+#else
+                buffer[count] = at->d_value.object();
+#endif
+                ++count;
+            }
+
+            at = static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&at->d_next));
+            nodeState = ATOMIC_OP::getIntAcquire(&at->d_state);
+        }
+    }
+
+    if (0 == count) {
+        return e_EMPTY;                                               // RETURN
+    }
+
+    *numPopped = count;
+
+    return 0;
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPushBack(
                                                              const TYPE& value)
@@ -1106,6 +1647,16 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPushBack(
     return pushBack(bslmf::MovableRefUtil::move(value));
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+template <class FORWARD_ITER>
+int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                              ::tryPushBackRange(bsl::size_t  *numPushed,
+                                                 FORWARD_ITER  begin,
+                                                 FORWARD_ITER  end)
+{
+    return pushBackRange(numPushed, begin, end);
+}
+
                        // Enqueue/Dequeue State
 
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
@@ -77,12 +77,16 @@ using namespace bsl;
 // [ 5] SingleConsumerQueueImpl(capacity, *bA = 0);
 // [ 2] ~SingleConsumerQueueImpl();
 // [ 2] int popFront(TYPE *value);
+// [13] int popFrontUpTo(size_t *numPopped, TYPE *buffer, size_t max);
 // [ 2] int pushBack(const TYPE& value);
 // [10] int pushBack(bslmf::MovableRef<TYPE> value);
+// [13] int pushBackRange(size_t *, FORWARD_ITER b, FORWARD_ITER e);
 // [ 2] void removeAll();
 // [ 8] int tryPopFront(TYPE *value);
+// [13] int tryPopFrontUpTo(size_t *numPopped, TYPE *buffer, size_t max);
 // [ 7] int tryPushBack(const TYPE& value);
 // [10] int tryPushBack(bslmf::MovableRef<TYPE> value);
+// [13] int tryPushBackRange(size_t *, FORWARD_ITER b, FORWARD_ITER e);
 // [ 6] void disablePopFront();
 // [ 6] void disablePushBack();
 // [ 6] void enablePopFront();
@@ -687,6 +691,96 @@ void orderingGuaranteeTest(const int numPushThread, const int numPopThread)
     bslmt::ThreadUtil::join(watchdogHandle);
 }
 
+struct BatchData {
+    // This 'struct' describes the work of the producer or consumer thread in
+    // the batch operation tests.
+
+    Obj *d_obj_p;        // queue under test
+    int  d_numElements;  // number of elements to push (or pop)
+    int  d_batchSize;    // number of elements per batch, or 0 for
+                         // 'pushBack'/'popFront'
+};
+
+extern "C" void *batchPush(void *arg)
+    // Push the sequence '0 .. d_numElements - 1' onto the queue described by
+    // the specified 'arg', which must refer to a 'BatchData' object, in
+    // batches of 'd_batchSize' elements using 'pushBackRange' (or one at a
+    // time using 'pushBack' if 'd_batchSize' is 0).
+{
+    BatchData *data = static_cast<BatchData *>(arg);
+    Obj&       mX   = *data->d_obj_p;
+
+    if (0 == data->d_batchSize) {
+        for (int i = 0; i < data->d_numElements; ++i) {
+            ASSERT(e_SUCCESS == mX.pushBack(i));
+        }
+        return 0;                                                     // RETURN
+    }
+
+    bsl::vector<int> batch(data->d_batchSize);
+
+    int next = 0;
+    while (next < data->d_numElements) {
+        int count = data->d_numElements - next;
+        if (count > data->d_batchSize) {
+            count = data->d_batchSize;
+        }
+        for (int i = 0; i < count; ++i) {
+            batch[i] = next + i;
+        }
+
+        bsl::size_t numPushed;
+        ASSERT(e_SUCCESS == mX.pushBackRange(&numPushed,
+                                             batch.begin(),
+                                             batch.begin() + count));
+        ASSERT(static_cast<bsl::size_t>(count) == numPushed);
+
+        next += count;
+    }
+
+    return 0;
+}
+
+extern "C" void *batchPop(void *arg)
+    // Pop 'd_numElements' elements from the queue described by the specified
+    // 'arg', which must refer to a 'BatchData' object, in batches of up to
+    // 'd_batchSize' elements using 'popFrontUpTo' (or one at a time using
+    // 'popFront' if 'd_batchSize' is 0), and verify the elements form the
+    // sequence '0 .. d_numElements - 1'.
+{
+    BatchData *data = static_cast<BatchData *>(arg);
+    Obj&       mX   = *data->d_obj_p;
+
+    int expected = 0;
+
+    if (0 == data->d_batchSize) {
+        while (expected < data->d_numElements) {
+            int value = -1;
+            ASSERT(e_SUCCESS == mX.popFront(&value));
+            ASSERTV(expected, value, expected == value);
+            ++expected;
+        }
+        return 0;                                                     // RETURN
+    }
+
+    bsl::vector<int> batch(data->d_batchSize);
+
+    while (expected < data->d_numElements) {
+        bsl::size_t numPopped = 0;
+        ASSERT(e_SUCCESS == mX.popFrontUpTo(&numPopped,
+                                            &batch[0],
+                                            batch.size()));
+        ASSERT(0 < numPopped && numPopped <= batch.size());
+
+        for (bsl::size_t i = 0; i < numPopped; ++i) {
+            ASSERTV(expected, batch[i], expected == batch[i]);
+            ++expected;
+        }
+    }
+
+    return 0;
+}
+
 // ============================================================================
 //               GENERATOR FUNCTIONS 'gg' AND 'ggg' FOR TESTING
 // ----------------------------------------------------------------------------
@@ -805,6 +899,241 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 13: {
+        // --------------------------------------------------------------------
+        // BATCH OPERATIONS
+        //
+        // Concerns:
+        //: 1 'pushBackRange' and 'tryPushBackRange' append, in order, all the
+        //:   elements of the range, and report the number appended, both when
+        //:   the queue has enough spare nodes for the range and when it must
+        //:   allocate more.
+        //:
+        //: 2 'popFrontUpTo' and 'tryPopFrontUpTo' remove, in order, up to the
+        //:   requested number of elements, and report the number removed.
+        //:
+        //: 3 The batch methods return the documented status values when the
+        //:   queue is empty or disabled.
+        //:
+        //: 4 The batch methods interoperate with the single-element methods.
+        //:
+        //: 5 A consumer using 'popFrontUpTo' observes, in order, a long
+        //:   sequence enqueued by a producer using 'pushBackRange'.
+        //:
+        //: 6 An exception thrown while copying an element of a range leaves
+        //:   the queue in a valid state: the elements copied before the
+        //:   exception are available, the nodes reserved for the others are
+        //:   reclaimed, and no memory is leaked.
+        //
+        // Plan:
+        //: 1 Apply the batch methods to an empty queue having no spare nodes
+        //:   and, after removing the elements, to the same queue (which now
+        //:   has spare nodes), interleaving single-element operations, and
+        //:   verify the values, counts, and status.  (C-1..4)
+        //:
+        //: 2 Disable the queue and verify the status values.  (C-3)
+        //:
+        //: 3 Create a producer thread that pushes a long sequence using
+        //:   'pushBackRange' and a consumer thread that pops it using
+        //:   'popFrontUpTo', and verify the consumer observes the sequence in
+        //:   order.  (C-5)
+        //:
+        //: 4 Using 'AllocExceptionHelper' and an allocation limit, cause the
+        //:   copy of the second element of a range to throw, and verify the
+        //:   subsequent behavior of the queue and the allocator.  (C-6)
+        //
+        // Testing:
+        //   int popFrontUpTo(size_t *numPopped, TYPE *buffer, size_t max);
+        //   int pushBackRange(size_t *, FORWARD_ITER b, FORWARD_ITER e);
+        //   int tryPopFrontUpTo(size_t *numPopped, TYPE *buffer, size_t max);
+        //   int tryPushBackRange(size_t *, FORWARD_ITER b, FORWARD_ITER e);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCH OPERATIONS" << endl
+                          << "================" << endl;
+
+        const int DATA[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        if (verbose) cout << "\nSingle-threaded behavior." << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj mX(&sa);  const Obj& X = mX;
+
+            bsl::size_t numPushed = 99;
+            bsl::size_t numPopped = 99;
+            int         buffer[NUM_DATA];
+
+            ASSERT(e_SUCCESS == mX.tryPushBackRange(&numPushed, DATA, DATA));
+            ASSERT(0 == numPushed);
+
+            ASSERT(e_EMPTY == mX.tryPopFrontUpTo(&numPopped, buffer, 3));
+            ASSERT(0 == numPopped);
+
+            // The queue has no spare nodes.
+
+            ASSERT(e_SUCCESS == mX.tryPushBackRange(&numPushed,
+                                                    DATA,
+                                                    DATA + NUM_DATA));
+            ASSERT(NUM_DATA == static_cast<int>(numPushed));
+            ASSERT(NUM_DATA == static_cast<int>(X.numElements()));
+
+            ASSERT(e_SUCCESS == mX.tryPopFrontUpTo(&numPopped, buffer, 3));
+            ASSERT(3 == numPopped);
+            ASSERT(0 == buffer[0] && 1 == buffer[1] && 2 == buffer[2]);
+
+            int value = -1;
+            ASSERT(e_SUCCESS == mX.popFront(&value));
+            ASSERT(3 == value);
+
+            ASSERT(e_SUCCESS == mX.popFrontUpTo(&numPopped,
+                                                buffer,
+                                                NUM_DATA));
+            ASSERT(NUM_DATA - 4 == static_cast<int>(numPopped));
+            for (int i = 0; i < NUM_DATA - 4; ++i) {
+                ASSERTV(i, buffer[i], i + 4 == buffer[i]);
+            }
+            ASSERT(X.isEmpty());
+
+            // The queue now has spare nodes for every range below.
+
+            const bsls::Types::Int64 numAllocations = sa.numAllocations();
+
+            for (int i = 0; i < 3 * NUM_DATA; ++i) {
+                ASSERT(e_SUCCESS == mX.pushBack(-1));
+                ASSERT(e_SUCCESS == mX.pushBackRange(&numPushed,
+                                                     DATA + i % 2,
+                                                     DATA + 3));
+                ASSERT(3 - i % 2 == static_cast<int>(numPushed));
+
+                ASSERT(e_SUCCESS == mX.tryPopFrontUpTo(&numPopped,
+                                                       buffer,
+                                                       NUM_DATA));
+                ASSERTV(i, numPopped, numPushed + 1 == numPopped);
+                ASSERTV(i, buffer[0], -1 == buffer[0]);
+                ASSERTV(i, buffer[1], i % 2 == buffer[1]);
+                ASSERTV(i, buffer[numPopped - 1], 2 == buffer[numPopped - 1]);
+            }
+
+            ASSERT(numAllocations == sa.numAllocations());
+
+            ASSERT(e_SUCCESS == mX.tryPushBackRange(&numPushed,
+                                                    DATA,
+                                                    DATA + 2));
+
+            mX.disablePushBack();
+
+            ASSERT(e_DISABLED == mX.tryPushBackRange(&numPushed,
+                                                     DATA,
+                                                     DATA + 1));
+            ASSERT(0 == numPushed);
+            ASSERT(e_DISABLED == mX.pushBackRange(&numPushed,
+                                                  DATA,
+                                                  DATA + 1));
+            ASSERT(0 == numPushed);
+
+            mX.disablePopFront();
+
+            ASSERT(e_DISABLED == mX.tryPopFrontUpTo(&numPopped, buffer, 1));
+            ASSERT(0 == numPopped);
+            ASSERT(e_DISABLED == mX.popFrontUpTo(&numPopped, buffer, 1));
+            ASSERT(0 == numPopped);
+            ASSERT(2 == X.numElements());
+
+            mX.enablePopFront();
+            mX.enablePushBack();
+
+            ASSERT(e_SUCCESS == mX.popFrontUpTo(&numPopped, buffer, 1));
+            ASSERT(1 == numPopped);
+            ASSERT(0 == buffer[0]);
+            ASSERT(1 == X.numElements());
+
+            ASSERT(0 == defaultAllocator.numAllocations());
+        }
+
+        if (verbose) cout << "\nProducer and consumer threads." << endl;
+        {
+            Obj mX;
+
+            const int k_NUM_ELEMENTS = 10000;
+
+            BatchData pushData = { &mX, k_NUM_ELEMENTS, 100 };
+            BatchData popData  = { &mX, k_NUM_ELEMENTS, 7   };
+
+            bslmt::ThreadUtil::Handle pushHandle;
+            bslmt::ThreadUtil::Handle popHandle;
+
+            bslmt::ThreadUtil::create(&pushHandle, batchPush, &pushData);
+            bslmt::ThreadUtil::create(&popHandle,  batchPop,  &popData);
+
+            bslmt::ThreadUtil::join(pushHandle);
+            bslmt::ThreadUtil::join(popHandle);
+
+            ASSERT(mX.isEmpty());
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) cout << "\nException while copying a range." << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            bdlcc::SingleConsumerQueueImpl<AllocExceptionHelper,
+                                           bsls::AtomicOperations,
+                                           bslmt::Mutex,
+                                           bslmt::Condition>        mX(4, &sa);
+            const bdlcc::SingleConsumerQueueImpl<AllocExceptionHelper,
+                                                 bsls::AtomicOperations,
+                                                 bslmt::Mutex,
+                                                 bslmt::Condition>& X = mX;
+
+            {
+                AllocExceptionHelper value(&sa);
+
+                bsl::vector<AllocExceptionHelper> range(3, value, &sa);
+                bsl::vector<AllocExceptionHelper> buffer(3, value, &sa);
+
+                bsl::size_t numPushed = 99;
+                bsl::size_t numPopped = 99;
+
+                int numException = 0;
+
+                sa.setAllocationLimit(1);
+                try {
+                    mX.tryPushBackRange(&numPushed,
+                                        range.begin(),
+                                        range.end());
+                } catch (BloombergLP::bslma::TestAllocatorException& e) {
+                    ++numException;
+                }
+                sa.setAllocationLimit(-1);
+
+                ASSERT(1 == numException);
+                ASSERT(1 == X.numElements());
+
+                ASSERT(e_SUCCESS == mX.tryPopFrontUpTo(&numPopped,
+                                                       &buffer[0],
+                                                       3));
+                ASSERT(1 == numPopped);
+                ASSERT(X.isEmpty());
+
+                ASSERT(e_SUCCESS == mX.tryPushBackRange(&numPushed,
+                                                        range.begin(),
+                                                        range.end()));
+                ASSERT(3 == numPushed);
+                ASSERT(3 == X.numElements());
+
+                ASSERT(e_SUCCESS == mX.popFrontUpTo(&numPopped,
+                                                    &buffer[0],
+                                                    3));
+                ASSERT(3 == numPopped);
+                ASSERT(X.isEmpty());
+            }
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+#endif
+      } break;
       case 12: {
         // ---------------------------------------------------------
         // Ordering Guarantee Test
@@ -19,6 +19,15 @@ BSLS_IDENT_RCSID(bdlcc_stripedunorderedcontainerimpl,"$Id$ $CSID$")
 // table, but the stripes are locked one at a time.
 //
 // The number of stripes must not be bigger than the number of buckets.
+//
+// An incremental rehash allocates the new bucket array with all the stripes
+// locked, but then moves the buckets one stripe at a time: since the number of
+// buckets is a power of 2 not smaller than the number of stripes, the elements
+// of an old bucket are moved to new buckets of the same stripe, so that a
+// stripe can be migrated under its own lock.  Each stripe keeps the number of
+// its old buckets already moved, which tells whether a hash value maps to the
+// old or the new array.  The rehash sequence number stays odd for the duration
+// of the migration, so that lock-free readers use the locked path.
 
 // ----------------------------------------------------------------------------
 // Copyright 2018 Bloomberg Finance L.P.
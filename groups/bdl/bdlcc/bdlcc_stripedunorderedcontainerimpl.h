@@ -87,6 +87,58 @@ BSLS_IDENT("$Id: $")
 // rehash enable flag.  Note that disabling rehash does not impact a rehash in
 // progress.
 //
+///Incremental Rehash
+/// - - - - - - - - -
+// By default ('e_REHASH_BLOCKING'), the thread whose operation exceeds the
+// maximum load factor moves every element to the new bucket array before it
+// returns, locking each stripe in turn, so the writers of every stripe wait
+// for a time proportional to 'size()'.  After 'rehashPolicy' is set to
+// 'e_REHASH_INCREMENTAL', that thread only allocates and publishes the new
+// bucket array (briefly locking every stripe); the elements are then
+// migrated by the writers themselves: every operation that locks a stripe
+// for write first moves the elements of the next few (4) buckets of that
+// stripe not yet migrated.  While the migration is underway, an operation on
+// a key consults the old bucket array if the bucket of that key was not
+// migrated yet, and the new one otherwise; 'bucketCount', 'bucketIndex', and
+// 'bucketSize' describe the new array.  To ensure that a stripe that is
+// seldom (or never) written is migrated as well, every write (once its
+// stripe is unlocked), 'getValue', and 'visitReadOnly' also moves the next
+// few buckets of some stripe not yet migrated, provided that stripe can be
+// locked without blocking.  Once every stripe is migrated, the next such
+// operation releases the old array.  Should the load factor exceed
+// 'maxLoadFactor()' for the new array before the migration ends, the
+// operation observing it completes the migration (as in 'e_REHASH_BLOCKING')
+// and starts the next rehash.  Calling 'rehash' completes the migration
+// underway, if any.
+//
+///Lock-Free Reads
+///---------------
+// By default ('e_READ_LOCKED'), 'getValue' and 'visitReadOnly' acquire the
+// read lock of the stripe (or stripes) they examine.  A container constructed
+// with 'e_READ_LOCK_FREE' serves these methods without acquiring any lock:
+// a reader registers with a 'bdlcc::EpochManager' owned by the container,
+// traverses the bucket, and validates its result against a sequence number
+// that is incremented (twice) by every rehash.  A lookup that overlaps a
+// rehash (for an incremental rehash, any part of the migration) falls back to
+// the locked path, so readers never observe a partially rehashed table, and
+// never block a rehash.
+//
+// Writers still serialize on the stripe locks.  To make the lock-free reads
+// safe, in this mode elements are never modified in place: every write to an
+// existing element (including those made by the visitor supplied to
+// 'update', 'setComputedValue*', and 'visit') is applied to a copy of the
+// element that then replaces the original in its bucket, and erased or
+// replaced elements (and bucket arrays abandoned by a rehash) are retired to
+// the epoch manager and destroyed only once no reader can still refer to
+// them.  The nodes unlinked by the writers of a stripe are retired in batches
+// (so the mutex of the epoch manager is acquired once per batch), and a write
+// reclaims the retired objects only once enough of them are awaiting
+// reclamation; a bounded number of unreachable elements may therefore remain
+// allocated while the container is in use.  This mode trades more expensive
+// writes (an allocation and a copy per modified element) for reads that scale
+// with the number of reading threads; it is appropriate for read-mostly
+// workloads.
+//
 ///Usage
 ///-----
 // There is no usage example for this component since it is not meant for
@@ -94,6 +146,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlscm_version.h>
 
+#include <bdlcc_epochmanager.h>
+
 #include <bslalg_hashtableimputil.h>
 
 #include <bslim_printer.h>
@@ -106,6 +160,8 @@ BSLS_IDENT("$Id: $")
 #include <bslma_rawdeleterproctor.h>
 #include <bslma_usesbslmaallocator.h>
 
+#include <bslmf_integralconstant.h>
+#include <bslmf_iscopyconstructible.h>
 #include <bslmf_movableref.h>
 #include <bslmf_nestedtraitdeclaration.h>
 
@@ -149,8 +205,10 @@ class StripedUnorderedContainerImpl_Node {
 
   private:
     // DATA
-    mutable StripedUnorderedContainerImpl_Node *d_next_p;
-        // Pointer to next element of the bucket
+    bsls::AtomicPointer<StripedUnorderedContainerImpl_Node>
+                                       d_next_p;
+        // Pointer to next element of the bucket; stored with release
+        // semantics so that it may be traversed without a lock
 
     bsls::ObjectBuffer<KEY>            d_key;
         // footprint of key
@@ -170,6 +228,13 @@ class StripedUnorderedContainerImpl_Node {
                                                                     // = delete
 
   public:
+    // CLASS METHODS
+    static void deleteNode(void *node, void *);
+        // Destroy the specified 'node', which must be the address of a
+        // 'StripedUnorderedContainerImpl_Node' allocated from its own
+        // allocator, and return its memory to that allocator.  Note that this
+        // function has the signature of a 'bdlcc::EpochManager::Deleter'.
+
     // CREATORS
     StripedUnorderedContainerImpl_Node(
                        const KEY&                          key,
@@ -202,11 +267,9 @@ class StripedUnorderedContainerImpl_Node {
         // Destroy this object.
 
     // MANIPULATORS
-    StripedUnorderedContainerImpl_Node **nextAddress();
-        // Return the address of the pointer to the next node.
-
     void setNext(StripedUnorderedContainerImpl_Node *nextPtr);
         // Set this node's pointer-to-next-node to the specified 'nextPtr'.
+        // Note that the store has release semantics.
 
     VALUE& value();
         // Return a reference providing modifiable access to the 'value'
@@ -217,7 +280,8 @@ class StripedUnorderedContainerImpl_Node {
         // Return a 'const' reference to the 'key' attribute of this object.
 
     StripedUnorderedContainerImpl_Node *next() const;
-        // Return the pointer to the next node.
+        // Return the pointer to the next node.  Note that the load has
+        // acquire semantics.
 
     const VALUE& value() const;
         // Return a 'const' reference to the 'value' attribute of this object.
@@ -229,6 +293,73 @@ class StripedUnorderedContainerImpl_Node {
         // allocate memory.
 };
 
+             // ================================================
+             // class StripedUnorderedContainerImpl_RetireBuffer
+             // ================================================
+
+class StripedUnorderedContainerImpl_RetireBuffer {
+    // This class buffers the nodes unlinked by the writers of one stripe of a
+    // container having lock-free reads, and retires them to the epoch manager
+    // of the container by batches of 'k_CAPACITY', so that writers acquire
+    // the mutex of the epoch manager once per batch rather than once per
+    // node.  Note that retiring a node later than it was unlinked is safe, as
+    // it only delays its reclamation.  The behavior is undefined unless a
+    // buffer is accessed with its stripe locked for write.
+
+  public:
+    // TYPES
+    enum {
+        k_CAPACITY = 8  // number of nodes retired together
+    };
+
+  private:
+    // DATA
+    EpochManager          *d_epochManager_p;       // manager to which the
+                                                   // nodes are retired (held)
+
+    EpochManager::Deleter  d_deleter;              // deleter of the nodes
+
+    int                    d_numNodes;             // number of buffered nodes
+
+    void                  *d_nodes[k_CAPACITY];    // buffered nodes
+
+    // NOT IMPLEMENTED
+    StripedUnorderedContainerImpl_RetireBuffer(
+                   const StripedUnorderedContainerImpl_RetireBuffer&);
+                                                                    // = delete
+    StripedUnorderedContainerImpl_RetireBuffer& operator=(
+                   const StripedUnorderedContainerImpl_RetireBuffer&);
+                                                                    // = delete
+
+  public:
+    // CREATORS
+    StripedUnorderedContainerImpl_RetireBuffer();
+        // Create an empty buffer that is not attached to an epoch manager.
+
+    ~StripedUnorderedContainerImpl_RetireBuffer();
+        // Destroy this object.  The behavior is undefined unless this buffer
+        // is empty.
+
+    // MANIPULATORS
+    void attach(EpochManager *epochManager, EpochManager::Deleter deleter);
+        // Retire the nodes subsequently added to this buffer to the specified
+        // 'epochManager', with the specified 'deleter'.  The behavior is
+        // undefined unless this buffer is empty.
+
+    void flush();
+        // Retire the nodes in this buffer, if any, and empty it.
+
+    void retire(void *node);
+        // Add the specified 'node' to this buffer, and retire the nodes in
+        // this buffer if it is then full.  The behavior is undefined unless
+        // this buffer is attached to an epoch manager.
+
+    // ACCESSORS
+    bool isAttached() const;
+        // Return 'true' if this buffer is attached to an epoch manager, and
+        // 'false' otherwise.
+};
+
                 // ==========================================
                 // class StripedUnorderedContainerImpl_Bucket
                 // ==========================================
@@ -246,7 +377,8 @@ class StripedUnorderedContainerImpl_Bucket {
         // movable references.
 
     // DATA
-    StripedUnorderedContainerImpl_Node<KEY, VALUE> *d_head_p;
+    bsls::AtomicPointer<StripedUnorderedContainerImpl_Node<KEY, VALUE> >
+                                           d_head_p;
         // Pointer to the first element in the bucket
 
     StripedUnorderedContainerImpl_Node<KEY, VALUE> *d_tail_p;
@@ -301,16 +433,35 @@ class StripedUnorderedContainerImpl_Bucket {
     void addNode(StripedUnorderedContainerImpl_Node<KEY, VALUE> *nodePtr);
         // Add the specified 'nodePtr' node at the end of this bucket.
 
-    void clear();
+    void clear(StripedUnorderedContainerImpl_RetireBuffer *retireBuffer = 0);
         // Empty 'StripedUnorderedContainerImpl_Bucket' and delete all nodes.
-
-    StripedUnorderedContainerImpl_Node<KEY, VALUE> **headAddress();
-        // Return the address of the head (node) of this bucket list.
+        // Optionally specify a 'retireBuffer' through which the nodes are
+        // retired (once they are no longer reachable from this bucket) rather
+        // than being deleted immediately.
 
     void incrementSize(int amount);
         // Increment the 'size' attribute of this bucket by the specified
         // 'amount'.
 
+    void removeNode(StripedUnorderedContainerImpl_Node<KEY, VALUE> *prevPtr,
+                    StripedUnorderedContainerImpl_Node<KEY, VALUE> *nodePtr);
+        // Unlink the specified 'nodePtr' node, whose predecessor in this
+        // bucket is the specified 'prevPtr' node ('prevPtr' is 0 if
+        // 'nodePtr' is the head of this bucket), from this bucket.  The node
+        // is not deleted and its pointer to the next node is unchanged, so
+        // that a reader positioned on it may continue its traversal.
+
+    void replaceNode(
+                    StripedUnorderedContainerImpl_Node<KEY, VALUE> *prevPtr,
+                    StripedUnorderedContainerImpl_Node<KEY, VALUE> *nodePtr,
+                    StripedUnorderedContainerImpl_Node<KEY, VALUE> *newPtr);
+        // Replace, in this bucket, the specified 'nodePtr' node, whose
+        // predecessor is the specified 'prevPtr' node ('prevPtr' is 0 if
+        // 'nodePtr' is the head of this bucket), with the specified 'newPtr'
+        // node.  The behavior is undefined unless
+        // 'newPtr->next() == nodePtr->next()'.  Note that 'nodePtr' is not
+        // deleted.
+
     void setHead(StripedUnorderedContainerImpl_Node<KEY, VALUE> *value);
         // Set the address of the head of this bucket list to the specified
         // 'value'.
@@ -323,14 +474,19 @@ class StripedUnorderedContainerImpl_Bucket {
         // 'value'.
 
     template <class EQUAL>
-    bsl::size_t setValue(const KEY&   key,
-                         const EQUAL& equal,
-                         const VALUE& value,
-                         BucketScope  scope);
+    bsl::size_t setValue(
+                 const KEY&                                  key,
+                 const EQUAL&                                equal,
+                 const VALUE&                                value,
+                 BucketScope                                 scope,
+                 StripedUnorderedContainerImpl_RetireBuffer *retireBuffer = 0);
         // Set the value attribute of the element in this bucket having the
         // specified 'key' to the specified 'value', using the specified
         // 'equal' to compare keys.  If no such element exists, insert
-        // '(key, value)'.  The behavior with respect to duplicate key values
+        // '(key, value)'.  Optionally specify a 'retireBuffer'; if
+        // 'retireBuffer' is not 0, an element is never assigned in place but
+        // is replaced by a new node, and the replaced node is retired through
+        // 'retireBuffer'.  The behavior with respect to duplicate key values
         // in the bucket depends on the specified 'scope':
         //
         //: 'e_BUCKETSCOPE_ALL':
@@ -347,18 +503,22 @@ class StripedUnorderedContainerImpl_Bucket {
         // 'key'.
 
     template <class EQUAL>
-    bsl::size_t setValue(const KEY&               key,
-                         const EQUAL&             equal,
-                         bslmf::MovableRef<VALUE> value);
+    bsl::size_t setValue(
+                 const KEY&                                  key,
+                 const EQUAL&                                equal,
+                 bslmf::MovableRef<VALUE>                    value,
+                 StripedUnorderedContainerImpl_RetireBuffer *retireBuffer = 0);
         // Set the value attribute of the element in this bucket having the
         // specified 'key' to the specified 'value', using the specified
         // 'equal' to compare keys.  If no such element exists, insert
         // '(key, value)'.  If there are multiple elements in this hash map
         // having 'key' then set the value of the first such element found.
-        // Return the number of elements found having 'key' that had their
-        // value set.  Note that, when there are multiple elements having
-        // 'key', the selection of "first" is unspecified and subject to
-        // change.
+        // Optionally specify a 'retireBuffer'; if 'retireBuffer' is not 0,
+        // the element is not assigned in place but is replaced by a new node,
+        // and the replaced node is retired through 'retireBuffer'.  Return the
+        // number of elements found having 'key' that had their value set.
+        // Note that, when there are multiple elements having 'key', the
+        // selection of "first" is unspecified and subject to change.
 
     // ACCESSORS
     bool empty() const;
@@ -407,6 +567,22 @@ class StripedUnorderedContainerImpl {
         k_DEFAULT_NUM_STRIPES  =  4  // Default # of stripes
     };
 
+    enum ReadPolicy {
+        // Enumeration of the synchronization used by 'getValue' and
+        // 'visitReadOnly' (see {Lock-Free Reads}).
+
+        e_READ_LOCKED = 0,  // Readers acquire the read lock of the stripe.
+        e_READ_LOCK_FREE    // Readers do not acquire any lock.
+    };
+
+    enum RehashPolicy {
+        // Enumeration of the ways a rehash triggered by the load factor moves
+        // the elements to the new buckets (see {Incremental Rehash}).
+
+        e_REHASH_BLOCKING = 0,  // The triggering thread moves every element.
+        e_REHASH_INCREMENTAL    // Writers move a few buckets at a time.
+    };
+
     typedef StripedUnorderedContainerImpl_Node<KEY, VALUE> Node;
         // Node in a bucket.
 
@@ -424,11 +600,30 @@ class StripedUnorderedContainerImpl {
         //      // functor can change the value associated with 'key'.
         //..
 
+    typedef bsl::function<bool (const VALUE&, const KEY&)>
+                                                       ReadOnlyVisitorFunction;
+        // An alias to a function meeting the following contract:
+        //..
+        //  bool visitorFunction(const VALUE& value, const KEY& key);
+        //      // Visit the specified 'value' attribute associated with the
+        //      // specified 'key'.  Return 'true' if this function may be
+        //      // called on additional elements, and 'false' otherwise (i.e.,
+        //      // if no other elements should be visited).
+        //..
+
   private:
     // PRIVATE CONSTANTS
     static const int k_REHASH_IN_PROGRESS = 1; // d_state bit 0
     static const int k_REHASH_ENABLED     = 2; // d_state bit 1
 
+    static const bsl::size_t k_NUM_BUCKETS_MIGRATED = 4;
+        // number of buckets of its stripe migrated by a write while a rehash
+        // is underway
+
+    static const int k_RECLAIM_THRESHOLD = 32;
+        // minimum number of objects awaiting reclamation for a write to
+        // reclaim them, if reads are lock-free
+
     // PRIVATE TYPES
     enum {
     #if BSLS_PLATFORM_CPU_X86 || BSLS_PLATFORM_CPU_X86_64
@@ -440,7 +635,13 @@ class StripedUnorderedContainerImpl {
         k_EFFECTIVE_CACHELINE_SIZE = (1 + k_PREFETCH_ENABLED) *
                                             bslmt::Platform::e_CACHE_LINE_SIZE,
         // Cacheline size to use; may be 1 or 2 cachelines
-        k_INT_PADDING = k_EFFECTIVE_CACHELINE_SIZE - sizeof(bsls::AtomicInt)
+        k_INT_PADDING = k_EFFECTIVE_CACHELINE_SIZE - sizeof(bsls::AtomicInt),
+        // Padding following a lone 'bsls::AtomicInt'
+        k_STATE_PADDING = k_INT_PADDING - 5 * sizeof(bsls::AtomicInt)
+                                        - sizeof(bsls::AtomicUint)
+        // Padding following 'd_state', 'd_rehashPolicy', 'd_rehashSequence',
+        // 'd_numStripesToMigrate', 'd_migrationCursor', and
+        // 'd_reclaimThreshold'
     };
 
     enum Multiplicity {
@@ -467,6 +668,10 @@ class StripedUnorderedContainerImpl {
     typedef StripedUnorderedContainerImpl_LockElement           LockElement;
     typedef StripedUnorderedContainerImpl_LockElementReadGuard  LERGuard;
     typedef StripedUnorderedContainerImpl_LockElementWriteGuard LEWGuard;
+    typedef StripedUnorderedContainerImpl_RetireBuffer          RetireBuffer;
+
+    typedef StripedUnorderedContainerImpl_Bucket<KEY, VALUE>    Bucket;
+    typedef bsl::vector<Bucket>                                 BucketArray;
 
     // DATA
     bsl::size_t                       d_numStripes;
@@ -493,8 +698,31 @@ class StripedUnorderedContainerImpl {
         //: o bit 0: 0-rehash not in progress; 1-rehash in progress.
         //: o bit 1: 0-rehash disabled;        1-rehash enabled.
 
-    const char                        d_statePad[k_INT_PADDING];
-        // padding, so that 'd_state' will have its own cache line
+    bsls::AtomicInt                   d_rehashPolicy;
+        // 'RehashPolicy' of the rehashes triggered by the load factor
+
+    bsls::AtomicInt                   d_rehashSequence;
+        // incremented when a rehash starts migrating nodes and again when it
+        // has replaced the old bucket array (odd while a rehash is underway);
+        // validates lock-free reads
+
+    bsls::AtomicInt                   d_numStripesToMigrate;
+        // number of stripes whose buckets were not all migrated by the rehash
+        // underway, or -1 if no rehash is underway (or it is being finished)
+
+    bsls::AtomicUint                  d_migrationCursor;
+        // index (modulo 'd_numStripes') of the first stripe examined by the
+        // next call to 'assistRehash'
+
+    bsls::AtomicInt                   d_reclaimThreshold;
+        // number of objects awaiting reclamation from which a write reclaims
+        // them, if reads are lock-free (see 'finishWrite')
+
+    const char                        d_statePad[k_STATE_PADDING];
+        // padding, so that 'd_state', 'd_rehashPolicy', 'd_rehashSequence',
+        // 'd_numStripesToMigrate', 'd_migrationCursor', and
+        // 'd_reclaimThreshold' (all rarely modified) will have their own cache
+        // line
 
     bsls::AtomicInt                   d_numElements;
         // # of elements in the hash map
@@ -502,14 +730,25 @@ class StripedUnorderedContainerImpl {
     const char                        d_numElementsPad[k_INT_PADDING];
         // padding, so that 'd_numElements' will have its own cache line
 
-    bsl::vector<StripedUnorderedContainerImpl_Bucket<KEY,VALUE> >
-                                      d_buckets;
-        // hash table data, storing key-value pairs
+    BucketArray                       d_buckets;
+        // hash table data, storing key-value pairs (while a rehash is
+        // underway, those in the buckets not yet migrated)
+
+    BucketArray                       d_newBuckets;
+        // hash table data being built by the rehash underway, if any, and
+        // empty otherwise
+
+    bsl::size_t                       d_numNewBuckets;
+        // number of buckets in 'd_newBuckets'
 
     LockElement                      *d_locks_p;
         // Pointer to an array of locks for the stripes.  Note that mutex can't
         // be moved or copied, hence can't be in a vector.
 
+    EpochManager                     *d_epochManager_p;
+        // epoch manager deferring the reclamation of nodes and bucket arrays
+        // (owned); 0 unless reads are lock-free
+
     bslma::Allocator                 *d_allocator_p;
         // memory allocator (held, not owned)
 
@@ -534,13 +773,121 @@ class StripedUnorderedContainerImpl {
         // integer that is a power of 2 that is greater than or equal
         // 'numBuckets', 'numStripes', and 2.
 
+    static void deleteBucketArray(void *bucketArray, void *allocator);
+        // Destroy the specified 'bucketArray', the address of a 'BucketArray'
+        // allocated from the specified 'allocator', and return its memory to
+        // 'allocator'.  Note that this function has the signature of a
+        // 'bdlcc::EpochManager::Deleter'.
+
     static bsl::size_t powerCeil(bsl::size_t num);
         // Return the nearest higher power of 2 for the specified 'num'.
 
     // PRIVATE MANIPULATORS
+    Bucket& findBucket(bsl::size_t hashVal);
+        // Return a reference providing modifiable access to the bucket
+        // holding the elements whose key has the specified 'hashVal': while a
+        // rehash is underway, the bucket of the old array if that bucket was
+        // not migrated yet, and the bucket of the new array otherwise.  The
+        // behavior is undefined unless the stripe of 'hashVal' is locked.
+
+    LockElement *lockWrite(Bucket **bucket, const KEY& key);
+        // Lock for write the stripe related to the specified 'key', migrate
+        // the next few buckets of that stripe if a rehash is underway, and set
+        // the specified '*bucket' to the address of the bucket holding the
+        // elements having 'key' (see 'findBucket').  Return the address to
+        // the lock-element of that stripe.
+
+    void migrateBuckets(bsl::size_t stripeIdx, bsl::size_t maxNumBuckets);
+        // If a rehash is underway, move the elements of up to the specified
+        // 'maxNumBuckets' buckets of the old array belonging to the stripe
+        // having the specified 'stripeIdx', in order, that were not migrated
+        // yet to the new array.  The behavior is undefined unless
+        // 'stripeIdx' is locked for write.
+
+    bool startRehash(bsl::size_t numBuckets);
+        // Start a rehash to the specified 'numBuckets' (a power of 2 not less
+        // than 'd_numStripes'): allocate the new bucket array and publish it
+        // (briefly locking every stripe), leaving the migration of the
+        // elements to subsequent writers.  Return 'true' if the rehash was
+        // started, and 'false' (with no effect) if rehash is disabled or
+        // already underway.  The behavior is undefined unless no stripe is
+        // locked by the calling thread.
+
+    void completeRehash();
+        // If a rehash is underway, migrate every remaining bucket (locking
+        // one stripe at a time) and finish the rehash.  The behavior is
+        // undefined unless no stripe is locked by the calling thread.
+
+    void finishRehash();
+        // If every stripe was migrated by the rehash underway, replace the
+        // old bucket array by the new one, and end the rehash.  Otherwise,
+        // this method has no effect.  The behavior is undefined unless no
+        // stripe is locked by the calling thread.
+
+    void tryFinishRehash();
+        // If every stripe was migrated by the rehash underway and every
+        // stripe can be locked for write without blocking, replace the old
+        // bucket array by the new one, and end the rehash.  Otherwise, this
+        // method has no effect.  Note that, unlike 'finishRehash', this method
+        // may be called by a thread holding the read lock of a stripe.
+
+    void replaceBuckets(BucketArray *retired);
+        // Replace the old bucket array by the new one, moving the old array
+        // into the specified 'retired' (which is retired to the epoch manager
+        // if reads are lock-free, and must otherwise be a local object), then
+        // unlock every stripe and end the rehash.  The behavior is undefined
+        // unless the calling thread locked every stripe for write and changed
+        // 'd_numStripesToMigrate' from 0 to -1.
+
+    void assistRehash();
+        // If a rehash is underway, migrate the next few buckets of a stripe
+        // not yet migrated, skipping the stripes that cannot be locked for
+        // write without blocking, then finish the rehash if every stripe was
+        // migrated and no stripe is locked (see 'tryFinishRehash').  This
+        // method never blocks, and may be called by a thread holding the read
+        // lock of a stripe; it lets the readers, and the writers of other
+        // stripes, advance a migration that would otherwise wait for a write
+        // to every stripe.
+
+    bool applyVisitor(Bucket                 *bucket,
+                      Node                   *prevNode,
+                      Node                  **node,
+                      const VisitorFunction&  visitor,
+                      RetireBuffer           *retireBuffer);
+        // Invoke the specified 'visitor' on the value and key of the specified
+        // '*node' of the specified 'bucket', whose predecessor is the
+        // specified 'prevNode' (0 if '*node' is the head of 'bucket'), and
+        // return the result.  If the specified 'retireBuffer' is not 0 (i.e.,
+        // reads are lock-free), 'visitor' is invoked on a copy of '*node' that
+        // then replaces '*node' in 'bucket', '*node' is retired through
+        // 'retireBuffer', and '*node' is set to the address of the copy.  The
+        // behavior is undefined unless the stripe of 'bucket' is locked for
+        // write.
+
+    bool applyVisitorToCopy(Bucket                 *bucket,
+                            Node                   *prevNode,
+                            Node                  **node,
+                            const VisitorFunction&  visitor,
+                            RetireBuffer           *retireBuffer,
+                            bsl::true_type);
+    bool applyVisitorToCopy(Bucket                 *bucket,
+                            Node                   *prevNode,
+                            Node                  **node,
+                            const VisitorFunction&  visitor,
+                            RetireBuffer           *retireBuffer,
+                            bsl::false_type);
+        // Implement the lock-free case of 'applyVisitor' for the specified
+        // 'bucket', 'prevNode', 'node', 'visitor', and 'retireBuffer'.  The
+        // overload taking 'bsl::false_type' (a 'VALUE' that is not
+        // copy-constructible) is never reached, as the constructor does not
+        // create an epoch manager for such a 'VALUE'.
+
     void checkRehash();
-        // Perform a rehash if the 'loadFactor() > maxLoadFactor()', and
-        // 'true == canRehash()'.
+        // Finish the rehash underway if every stripe was migrated, then start
+        // a rehash if the 'loadFactor() > maxLoadFactor()' and rehash is
+        // enabled, first completing the rehash underway, if any (see
+        // {Incremental Rehash}).  The behavior is undefined unless no stripe
+        // is locked by the calling thread.
 
     bsl::size_t erase(const KEY& key, Scope scope);
         // Remove from this hash map the element, if any, having the specified
@@ -614,6 +961,27 @@ class StripedUnorderedContainerImpl {
         // having 'key', the selection of "first" is unspecified and subject to
         // change.
 
+    void finishWrite();
+        // Perform the work a write defers until its stripe lock is released:
+        // advance the rehash underway, if any (see 'assistRehash'), finish it
+        // if every stripe was migrated (see 'finishRehash') and, if reads are
+        // lock-free and at least 'd_reclaimThreshold' objects are awaiting
+        // reclamation, destroy the nodes and bucket arrays retired by this
+        // container that can no longer be accessed by a reader.  The behavior
+        // is undefined if the calling thread holds the lock of any stripe.
+
+    void releaseNode(Node *node, RetireBuffer *retireBuffer);
+        // Delete the specified 'node', which has been unlinked from its
+        // bucket, or, if the specified 'retireBuffer' is not 0 (i.e., reads
+        // are lock-free), retire 'node' through 'retireBuffer' so that it is
+        // deleted once no reader can access it.
+
+    void retireAllBuffered();
+        // Retire the nodes held by the retire buffers of all the stripes.  The
+        // behavior is undefined unless reads are lock-free and every stripe is
+        // locked for write by the calling thread (or the container is being
+        // destroyed).
+
     int setComputedValue(const KEY&             key,
                          const VisitorFunction& visitor,
                          Scope                  scope);
@@ -673,17 +1041,35 @@ class StripedUnorderedContainerImpl {
     bsl::size_t bucketToStripe(bsl::size_t bucketIndex) const;
         // Return the stripe index associated with the specified 'bucketIndex'.
 
-    LockElement *lockRead(bsl::size_t *bucketIdx, const KEY& key) const;
-        // Lock for read the stripe related to the specified 'key', setting the
-        // specified 'bucketIdx' to the bucket index associated with 'key'.
-        // Return the address to the lock-element associated with the returned
-        // 'bucketIdx'.
+    const Bucket& findBucket(bsl::size_t hashVal) const;
+        // Return a reference providing non-modifiable access to the bucket
+        // holding the elements whose key has the specified 'hashVal' (see the
+        // manipulator 'findBucket').  The behavior is undefined unless the
+        // stripe of 'hashVal' is locked.
 
-    LockElement *lockWrite(bsl::size_t *bucketIdx, const KEY& key) const;
-        // Lock for write the stripe related to the specified 'key', setting
-        // the specified 'bucketIdx' to the bucket index associated with 'key'.
-        // Return the address to the lock-element associated with the returned
-        // 'bucketIdx'.
+    int getValueLockFree(VALUE *value, const KEY& key) const;
+        // Load, into the specified '*value', the value attribute of the first
+        // element found in this hash map having the specified 'key' without
+        // acquiring any lock.  Return 1 if 'key' was found, 0 if 'key' was not
+        // found, and a negative value if the lookup overlapped a rehash (in
+        // which case '*value' is unchanged and the lookup must be repeated
+        // under the stripe lock).  The behavior is undefined unless reads are
+        // lock-free.
+
+    int getValueLockFree(bsl::vector<VALUE> *valuesPtr, const KEY& key) const;
+        // Append, to the specified '*valuesPtr', the value attributes of every
+        // element in this hash map having the specified 'key' without
+        // acquiring any lock.  Return the number of elements found, or a
+        // negative value if the lookup overlapped a rehash (in which case the
+        // contents of '*valuesPtr' are unspecified and the lookup must be
+        // repeated under the stripe lock).  The behavior is undefined unless
+        // reads are lock-free.
+
+    LockElement *lockRead(const Bucket **bucket, const KEY& key) const;
+        // Lock for read the stripe related to the specified 'key', setting the
+        // specified '*bucket' to the address of the bucket holding the
+        // elements having 'key' (see 'findBucket').  Return the address to
+        // the lock-element of that stripe.
 
   public:
     // CREATORS
@@ -700,6 +1086,25 @@ class StripedUnorderedContainerImpl {
         // 'basicAllocator' is 0, the currently installed default allocator is
         // used.  The hash map has rehash enabled.
 
+    StripedUnorderedContainerImpl(bsl::size_t       numInitialBuckets,
+                                  bsl::size_t       numStripes,
+                                  ReadPolicy        readPolicy,
+                                  bslma::Allocator *basicAllocator = 0);
+        // Create an empty 'StripedUnorderedContainerImpl' object, a fully
+        // thread-safe hash map where access is divided into "stripes" (a group
+        // of buckets protected by a reader-write mutex), having the specified
+        // 'numInitialBuckets' and 'numStripes' as the minimum number of
+        // buckets and the (fixed) number of stripes, and using the specified
+        // 'readPolicy' to synchronize 'getValue' and 'visitReadOnly' with
+        // writers (see {Lock-Free Reads}).  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The hash map
+        // has rehash enabled.  The behavior is undefined unless
+        // 'e_READ_LOCKED == readPolicy' or 'VALUE' is copy-constructible.
+        // Note that a 'VALUE' that is not copy-constructible must specialize
+        // 'bsl::is_copy_constructible' where the compiler cannot detect it
+        // (i.e., in C++03).
+
     ~StripedUnorderedContainerImpl();
         // Destroy this hash map.  This method is *not* thread-safe.
 
@@ -816,7 +1221,14 @@ class StripedUnorderedContainerImpl {
         // Recreate this hash map to one having at least the specified
         // 'numBuckets'.  This operation is a no-op if *any* of the following
         // are true: 1) rehash is disabled; 2) 'numBuckets' less or equals the
-        // current number of buckets.  See {Rehash}.
+        // current number of buckets.  An incremental rehash underway, if any,
+        // is completed first, and the rehash is complete on return,
+        // irrespective of 'rehashPolicy()'.  See {Rehash}.
+
+    void rehashPolicy(RehashPolicy newRehashPolicy);
+        // Set the policy of the rehashes triggered by the load factor of this
+        // hash map to the specified 'newRehashPolicy'.  A rehash underway is
+        // not affected.  See {Incremental Rehash}.
 
     int setComputedValueAll(const KEY&             key,
                             const VisitorFunction& visitor);
@@ -926,7 +1338,9 @@ class StripedUnorderedContainerImpl {
         // may or may not be visited.  The behavior is undefined if hash map
         // manipulators and 'getValue*' methods are invoked from within
         // 'visitor', as it may lead to a deadlock.  Note that 'visitor' can
-        // change the value of the visited elements.
+        // change the value of the visited elements.  Also note that, if reads
+        // are lock-free, 'visitor' is invoked on a copy of each element, which
+        // then replaces the element.
 
     // ACCESSORS
     bsl::size_t bucketIndex(const KEY& key) const;
@@ -981,6 +1395,10 @@ class StripedUnorderedContainerImpl {
     bool isRehashEnabled() const;
         // Return 'true' if rehash is enabled, or 'false' otherwise.
 
+    ReadPolicy readPolicy() const;
+        // Return the synchronization used by the readers of this hash map, as
+        // specified at construction.
+
     float loadFactor() const;
         // Return the current quotient of the size of this hash map and the
         // number of buckets.  Note that the load factor is a measure of
@@ -995,12 +1413,36 @@ class StripedUnorderedContainerImpl {
         // increases the number of buckets and rehashes the elements of the
         // container into that larger set of buckets.
 
+    RehashPolicy rehashPolicy() const;
+        // Return the policy of the rehashes triggered by the load factor of
+        // this hash map.  The default is 'e_REHASH_BLOCKING'.
+
     bsl::size_t numStripes() const;
         // Return the number of stripes in the hash.
 
     bsl::size_t size() const;
         // Return the current number of elements in this hash.
 
+    int visitReadOnly(const ReadOnlyVisitorFunction& visitor) const;
+        // Call the specified 'visitor' (in an unspecified order) on the
+        // elements in this hash table until each element has been visited or
+        // until 'visitor' returns 'false'.  That is, for '(key, value)',
+        // invoke:
+        //..
+        //  bool visitor(value, key);
+        //..
+        // Return the number of elements visited or the negation of that value
+        // if visitations stopped because 'visitor' returned 'false'.
+        // 'visitor' has read-only access to each element.  Every element
+        // present in this hash map at the time 'visitReadOnly' is invoked will
+        // be visited (once) unless it is removed before 'visitor' is called
+        // for that element.  Elements inserted during the execution of
+        // 'visitReadOnly' may or may not be visited.  If reads are lock-free,
+        // no lock is held while 'visitor' is invoked (unless the visitation
+        // of a stripe overlaps a rehash), but memory retired by writers is not
+        // reclaimed until 'visitReadOnly' returns.  The behavior is undefined
+        // if hash map manipulators are invoked from within 'visitor'.
+
                                // Aspects
 
     bslma::Allocator *allocator() const;
@@ -1078,13 +1520,21 @@ class StripedUnorderedContainerImpl_LockElement {
         k_EFFECTIVE_CACHELINE_SIZE = (1 + k_PREFETCH_ENABLED) *
                                             bslmt::Platform::e_CACHE_LINE_SIZE,
         // Cacheline size to use; may be 1 or 2 cachelines
-        k_LOCK_PADDING = k_EFFECTIVE_CACHELINE_SIZE >= sizeof(LockType) ?
-                         k_EFFECTIVE_CACHELINE_SIZE -  sizeof(LockType) :
-                     2 * k_EFFECTIVE_CACHELINE_SIZE -  sizeof(LockType)
+        k_LOCK_SIZE = sizeof(LockType) + sizeof(bsl::size_t) +
+                      sizeof(StripedUnorderedContainerImpl_RetireBuffer),
+        // Size of the data members other than the padding
+        k_LOCK_PADDING = k_EFFECTIVE_CACHELINE_SIZE -
+                                       k_LOCK_SIZE % k_EFFECTIVE_CACHELINE_SIZE
+        // Padding rounding the size up to a multiple of the cacheline size
     };
 
     // DATA
     LockType        d_lock;
+    bsl::size_t     d_numMigratedBuckets;  // buckets of the stripe migrated
+                                           // by the rehash underway
+    StripedUnorderedContainerImpl_RetireBuffer
+                    d_retireBuffer;        // nodes unlinked by the writers of
+                                           // the stripe, not yet retired
     const char      d_pad[k_LOCK_PADDING];
 
   public:
@@ -1093,17 +1543,48 @@ class StripedUnorderedContainerImpl_LockElement {
         // Create an empty 'StripedUnorderedContainerImpl_LockElement' object.
 
     // MANIPULATORS
+    void attachRetireBuffer(EpochManager          *epochManager,
+                            EpochManager::Deleter  deleter);
+        // Retire the nodes unlinked by the writers of the stripe guarded by
+        // this lock element to the specified 'epochManager', with the
+        // specified 'deleter', in batches (see 'retireBuffer').  The behavior
+        // is undefined unless this method is called before the lock element
+        // is used.
+
     void lockR();
         // Read lock the lock element.
 
     void lockW();
         // Write lock the lock element.
 
+    int tryLockW();
+        // Attempt to write lock the lock element without blocking.  Return 0
+        // on success, and a non-zero value if the lock element is already
+        // locked.
+
     void unlockR();
         // Read unlock the lock element.
 
     void unlockW();
         // Write unlock the lock element.
+
+    StripedUnorderedContainerImpl_RetireBuffer *retireBuffer();
+        // Return the address of the buffer of the nodes unlinked by the
+        // writers of the stripe guarded by this lock element if that buffer is
+        // attached to an epoch manager, and 0 otherwise.  The behavior is
+        // undefined unless this lock element is locked for write.
+
+    void setNumMigratedBuckets(bsl::size_t value);
+        // Set the number of buckets of the stripe guarded by this lock element
+        // that were migrated by the rehash underway to the specified 'value'.
+        // The behavior is undefined unless this lock element is locked for
+        // write.
+
+    // ACCESSORS
+    bsl::size_t numMigratedBuckets() const;
+        // Return the number of buckets of the stripe guarded by this lock
+        // element that were migrated by the rehash underway.  The behavior is
+        // undefined unless this lock element is locked.
 };
 
 
@@ -1191,6 +1672,17 @@ bool operator<(const StripedUnorderedContainerImpl_SortItem& lhs,
                 // class StripedUnorderedContainerImpl_Node
                 // ----------------------------------------
 
+// CLASS METHODS
+template <class KEY, class VALUE>
+void StripedUnorderedContainerImpl_Node<KEY, VALUE>::deleteNode(void *node,
+                                                                void *)
+{
+    StripedUnorderedContainerImpl_Node *nodePtr =
+                       static_cast<StripedUnorderedContainerImpl_Node *>(node);
+
+    nodePtr->d_allocator_p->deleteObject(nodePtr);
+}
+
 // CREATORS
 template <class KEY, class VALUE>
 inline
@@ -1268,20 +1760,12 @@ StripedUnorderedContainerImpl_Node<KEY, VALUE>::
 
 
 // MANIPULATORS
-template <class KEY, class VALUE>
-inline
-StripedUnorderedContainerImpl_Node<KEY, VALUE> **
-                  StripedUnorderedContainerImpl_Node<KEY, VALUE>::nextAddress()
-{
-    return &d_next_p;
-}
-
 template <class KEY, class VALUE>
 inline
 void StripedUnorderedContainerImpl_Node<KEY, VALUE>::setNext(
                        StripedUnorderedContainerImpl_Node<KEY, VALUE> *nextPtr)
 {
-    d_next_p = nextPtr;
+    d_next_p.storeRelease(nextPtr);
 }
 
 template <class KEY, class VALUE>
@@ -1304,7 +1788,7 @@ inline
 StripedUnorderedContainerImpl_Node<KEY, VALUE> *
                    StripedUnorderedContainerImpl_Node<KEY, VALUE>::next() const
 {
-    return d_next_p;
+    return d_next_p.loadAcquire();
 }
 
 template <class KEY, class VALUE>
@@ -1324,6 +1808,68 @@ bslma::Allocator *
     return d_allocator_p;
 }
 
+             // ------------------------------------------------
+             // class StripedUnorderedContainerImpl_RetireBuffer
+             // ------------------------------------------------
+
+// CREATORS
+inline
+StripedUnorderedContainerImpl_RetireBuffer::
+                                   StripedUnorderedContainerImpl_RetireBuffer()
+: d_epochManager_p(0)
+, d_deleter(0)
+, d_numNodes(0)
+{
+}
+
+inline
+StripedUnorderedContainerImpl_RetireBuffer::
+                                  ~StripedUnorderedContainerImpl_RetireBuffer()
+{
+    BSLS_ASSERT(0 == d_numNodes);
+}
+
+// MANIPULATORS
+inline
+void StripedUnorderedContainerImpl_RetireBuffer::attach(
+                                          EpochManager          *epochManager,
+                                          EpochManager::Deleter  deleter)
+{
+    BSLS_ASSERT(epochManager);
+    BSLS_ASSERT(deleter);
+    BSLS_ASSERT(0 == d_numNodes);
+
+    d_epochManager_p = epochManager;
+    d_deleter        = deleter;
+}
+
+inline
+void StripedUnorderedContainerImpl_RetireBuffer::flush()
+{
+    if (d_numNodes) {
+        d_epochManager_p->retire(d_nodes, d_numNodes, d_deleter);
+        d_numNodes = 0;
+    }
+}
+
+inline
+void StripedUnorderedContainerImpl_RetireBuffer::retire(void *node)
+{
+    BSLS_ASSERT(d_epochManager_p);
+
+    d_nodes[d_numNodes++] = node;
+    if (k_CAPACITY == d_numNodes) {
+        flush();
+    }
+}
+
+// ACCESSORS
+inline
+bool StripedUnorderedContainerImpl_RetireBuffer::isAttached() const
+{
+    return 0 != d_epochManager_p;
+}
+
                // ------------------------------------------
                // class StripedUnorderedContainerImpl_Bucket
                // ------------------------------------------
@@ -1348,7 +1894,7 @@ StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::
            bslmf::MovableRef<StripedUnorderedContainerImpl_Bucket<KEY, VALUE> >
                                                                       original,
            bslma::Allocator                                          *)
-: d_head_p(MoveUtil::move(MoveUtil::access(original).d_head_p))
+: d_head_p(MoveUtil::access(original).d_head_p.loadRelaxed())
 , d_tail_p(MoveUtil::move(MoveUtil::access(original).d_tail_p))
 , d_size(  MoveUtil::access(original).d_size)
 , d_allocator_p(MoveUtil::access(original).d_allocator_p)
@@ -1374,8 +1920,8 @@ void StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::addNode(
 {
     BSLS_ASSERT(nodePtr->next() == NULL);
 
-    if (d_head_p == NULL) {
-        d_head_p = nodePtr;
+    if (d_head_p.loadRelaxed() == NULL) {
+        d_head_p.storeRelease(nodePtr);
     }
     else {
         d_tail_p->setNext(nodePtr);
@@ -1386,35 +1932,81 @@ void StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::addNode(
 
 template <class KEY, class VALUE>
 inline
-void StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::clear()
+void StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::clear(
+                      StripedUnorderedContainerImpl_RetireBuffer *retireBuffer)
 {
-    // Delete all content in a loop
-    for (StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode = d_head_p;
-                                                            curNode != NULL;) {
-        StripedUnorderedContainerImpl_Node<KEY, VALUE> *nextPtr =
-                                                               curNode->next();
-        d_allocator_p->deleteObject(curNode);
-        curNode = nextPtr;
-    }
-    d_head_p = NULL;
+    typedef StripedUnorderedContainerImpl_Node<KEY, VALUE> Node;
+
+    // Unlink the list before disposing of its nodes, so that a lock-free
+    // reader arriving now finds an empty bucket.
+    Node *curNode = d_head_p.loadRelaxed();
+    d_head_p.storeRelease(NULL);
     d_tail_p = NULL;
     d_size = 0;
+
+    // Delete (or retire) all content in a loop
+    while (curNode != NULL) {
+        Node *nextPtr = curNode->next();
+        if (retireBuffer) {
+            retireBuffer->retire(curNode);
+        }
+        else {
+            d_allocator_p->deleteObject(curNode);
+        }
+        curNode = nextPtr;
+    }
 }
 
 template <class KEY, class VALUE>
 inline
-StripedUnorderedContainerImpl_Node<KEY, VALUE>
-              **StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::headAddress()
+void StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::incrementSize(
+                                                                    int amount)
 {
-    return &d_head_p;
+    d_size += amount;
 }
 
 template <class KEY, class VALUE>
 inline
-void StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::incrementSize(
-                                                                    int amount)
+void StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::removeNode(
+                       StripedUnorderedContainerImpl_Node<KEY, VALUE> *prevPtr,
+                       StripedUnorderedContainerImpl_Node<KEY, VALUE> *nodePtr)
 {
-    d_size += amount;
+    BSLS_ASSERT(nodePtr);
+    BSLS_ASSERT(prevPtr ? prevPtr->next() == nodePtr
+                        : d_head_p.loadRelaxed() == nodePtr);
+
+    if (prevPtr) {
+        prevPtr->setNext(nodePtr->next());
+    }
+    else {
+        d_head_p.storeRelease(nodePtr->next());
+    }
+    if (d_tail_p == nodePtr) {
+        d_tail_p = prevPtr;
+    }
+    --d_size;
+}
+
+template <class KEY, class VALUE>
+inline
+void StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::replaceNode(
+                       StripedUnorderedContainerImpl_Node<KEY, VALUE> *prevPtr,
+                       StripedUnorderedContainerImpl_Node<KEY, VALUE> *nodePtr,
+                       StripedUnorderedContainerImpl_Node<KEY, VALUE> *newPtr)
+{
+    BSLS_ASSERT(nodePtr);
+    BSLS_ASSERT(newPtr);
+    BSLS_ASSERT(newPtr->next() == nodePtr->next());
+
+    if (prevPtr) {
+        prevPtr->setNext(newPtr);
+    }
+    else {
+        d_head_p.storeRelease(newPtr);
+    }
+    if (d_tail_p == nodePtr) {
+        d_tail_p = newPtr;
+    }
 }
 
 template <class KEY, class VALUE>
@@ -1422,7 +2014,7 @@ inline
 void StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::setHead(
                          StripedUnorderedContainerImpl_Node<KEY, VALUE> *value)
 {
-    d_head_p = value;
+    d_head_p.storeRelease(value);
 }
 
 template <class KEY, class VALUE>
@@ -1444,28 +2036,41 @@ void StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::setTail(
 template <class KEY, class VALUE>
 template <class EQUAL>
 bsl::size_t StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::setValue(
-                                                            const KEY&   key,
-                                                            const EQUAL& equal,
-                                                            const VALUE& value,
-                                                            BucketScope  scope)
+                      const KEY&                                  key,
+                      const EQUAL&                                equal,
+                      const VALUE&                                value,
+                      BucketScope                                 scope,
+                      StripedUnorderedContainerImpl_RetireBuffer *retireBuffer)
 {
-    if (d_head_p == NULL) {
-        d_head_p = new (*d_allocator_p)
-                                StripedUnorderedContainerImpl_Node<KEY, VALUE>(
-                                                                key,
-                                                                value,
-                                                                NULL,
-                                                                d_allocator_p);
-        d_tail_p = d_head_p;
+    typedef StripedUnorderedContainerImpl_Node<KEY, VALUE> Node;
+
+    if (d_head_p.loadRelaxed() == NULL) {
+        d_tail_p = new (*d_allocator_p) Node(key, value, NULL, d_allocator_p);
+        d_head_p.storeRelease(d_tail_p);
         d_size = 1;
         return 0;                                                     // RETURN
     }
 
-    StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode = d_head_p;
-    int                                             count   = 0;
-    for (; curNode != NULL; curNode = curNode->next()) {
+    Node *prevNode = NULL;
+    Node *curNode  = d_head_p.loadRelaxed();
+    int   count    = 0;
+    for (; curNode != NULL; prevNode = curNode, curNode = curNode->next()) {
         if (equal(curNode->key(), key)) {
-            curNode->value() = value;
+            if (retireBuffer) {
+                // Lock-free readers may be copying the current value: publish
+                // the new value in a new node instead of assigning it.
+
+                Node *newNode = new (*d_allocator_p) Node(curNode->key(),
+                                                          value,
+                                                          curNode->next(),
+                                                          d_allocator_p);
+                replaceNode(prevNode, curNode, newNode);
+                retireBuffer->retire(curNode);
+                curNode = newNode;
+            }
+            else {
+                curNode->value() = value;
+            }
             if (e_BUCKETSCOPE_FIRST == scope) {
                 return 1;                                             // RETURN
             }
@@ -1475,14 +2080,9 @@ bsl::size_t StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::setValue(
     if (count > 0) {
         return count;                                                 // RETURN
     }
-    StripedUnorderedContainerImpl_Node<KEY, VALUE> *newNode =
-           new (*d_allocator_p) StripedUnorderedContainerImpl_Node<KEY, VALUE>(
-                                                                key,
-                                                                value,
-                                                                NULL,
-                                                                d_allocator_p);
+    Node *newNode = new (*d_allocator_p) Node(key, value, NULL, d_allocator_p);
     d_tail_p->setNext(newNode);
-    d_tail_p = d_tail_p->next();
+    d_tail_p = newNode;
     ++d_size;
     return 0;
 }
@@ -1490,24 +2090,37 @@ bsl::size_t StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::setValue(
 template <class KEY, class VALUE>
 template <class EQUAL>
 bsl::size_t StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::setValue(
-                                                const KEY&               key,
-                                                const EQUAL&             equal,
-                                                bslmf::MovableRef<VALUE> value)
+                      const KEY&                                  key,
+                      const EQUAL&                                equal,
+                      bslmf::MovableRef<VALUE>                    value,
+                      StripedUnorderedContainerImpl_RetireBuffer *retireBuffer)
 {
-    if (d_head_p == NULL) {
-        d_head_p = new (*d_allocator_p)
-                                StripedUnorderedContainerImpl_Node<KEY, VALUE>(
+    typedef StripedUnorderedContainerImpl_Node<KEY, VALUE> Node;
+
+    if (d_head_p.loadRelaxed() == NULL) {
+        d_tail_p = new (*d_allocator_p) Node(
                                             key,
                                             bslmf::MovableRefUtil::move(value),
                                             NULL,
                                             d_allocator_p);
-        d_tail_p = d_head_p;
+        d_head_p.storeRelease(d_tail_p);
         d_size = 1;
         return 0;                                                     // RETURN
     }
-    StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode = d_head_p;
-    for (; curNode != NULL; curNode = curNode->next()) {
+    Node *prevNode = NULL;
+    Node *curNode  = d_head_p.loadRelaxed();
+    for (; curNode != NULL; prevNode = curNode, curNode = curNode->next()) {
         if (equal(curNode->key(), key)) {
+            if (retireBuffer) {
+                Node *newNode = new (*d_allocator_p) Node(
+                                            curNode->key(),
+                                            bslmf::MovableRefUtil::move(value),
+                                            curNode->next(),
+                                            d_allocator_p);
+                replaceNode(prevNode, curNode, newNode);
+                retireBuffer->retire(curNode);
+                return 1;                                             // RETURN
+            }
 #if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
             curNode->value() = bslmf::MovableRefUtil::move(value);
 #else
@@ -1541,7 +2154,7 @@ inline
 StripedUnorderedContainerImpl_Node<KEY, VALUE>
                 *StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::head() const
 {
-    return d_head_p;
+    return d_head_p.loadAcquire();
 }
 
 template <class KEY, class VALUE>
@@ -1577,12 +2190,21 @@ bslma::Allocator *StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::allocator()
 inline
 StripedUnorderedContainerImpl_LockElement::
                                     StripedUnorderedContainerImpl_LockElement()
-: d_pad()
+: d_numMigratedBuckets(0)
+, d_pad()
 {
     (void)d_pad;
 }
 
 // MANIPULATORS
+inline
+void StripedUnorderedContainerImpl_LockElement::attachRetireBuffer(
+                                          EpochManager          *epochManager,
+                                          EpochManager::Deleter  deleter)
+{
+    d_retireBuffer.attach(epochManager, deleter);
+}
+
 inline
 void StripedUnorderedContainerImpl_LockElement::lockR()
 {
@@ -1595,6 +2217,12 @@ void StripedUnorderedContainerImpl_LockElement::lockW()
     d_lock.lockWrite();
 }
 
+inline
+int StripedUnorderedContainerImpl_LockElement::tryLockW()
+{
+    return d_lock.tryLockWrite();
+}
+
 inline
 void StripedUnorderedContainerImpl_LockElement::unlockR()
 {
@@ -1607,6 +2235,28 @@ void StripedUnorderedContainerImpl_LockElement::unlockW()
     d_lock.unlockWrite();
 }
 
+inline
+StripedUnorderedContainerImpl_RetireBuffer *
+                      StripedUnorderedContainerImpl_LockElement::retireBuffer()
+{
+    return d_retireBuffer.isAttached() ? &d_retireBuffer : 0;
+}
+
+inline
+void StripedUnorderedContainerImpl_LockElement::setNumMigratedBuckets(
+                                                             bsl::size_t value)
+{
+    d_numMigratedBuckets = value;
+}
+
+// ACCESSORS
+inline
+bsl::size_t StripedUnorderedContainerImpl_LockElement::numMigratedBuckets()
+                                                                          const
+{
+    return d_numMigratedBuckets;
+}
+
          // --------------------------------------------------------
          // class StripedUnorderedContainerImpl_LockElementReadGuard
          // --------------------------------------------------------
@@ -1691,6 +2341,18 @@ bsl::size_t
     return numBuckets;
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void
+     StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::deleteBucketArray(
+                                                             void *bucketArray,
+                                                             void *allocator)
+{
+    bslma::Allocator *basicAllocator =
+                                    static_cast<bslma::Allocator *>(allocator);
+
+    basicAllocator->deleteObject(static_cast<BucketArray *>(bucketArray));
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::powerCeil(
@@ -1710,57 +2372,379 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::powerCeil(
 // PRIVATE MANIPULATORS
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
-void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::checkRehash()
+typename StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::Bucket&
+StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::findBucket(
+                                                           bsl::size_t hashVal)
 {
-    float loadF = loadFactor();
-    if (d_maxLoadFactor < loadF && canRehash()) {
-        int ratio = static_cast<int>(loadF / d_maxLoadFactor);
-        int growthFactor = 2;
-        while (growthFactor < ratio) {
-            growthFactor <<= 1;
-        }
-        bsl::size_t newNumBuckets = d_numBuckets * growthFactor;
-        rehash(newNumBuckets);
+    bsl::size_t bucketIdx =
+           bslalg::HashTableImpUtil::computeBucketIndex(hashVal, d_numBuckets);
+
+    if (d_numNewBuckets && bucketIdx / d_numStripes <
+               d_locks_p[bucketToStripe(bucketIdx)].numMigratedBuckets()) {
+        return d_newBuckets[bslalg::HashTableImpUtil::computeBucketIndex(
+                                                     hashVal,
+                                                     d_numNewBuckets)];
+                                                                      // RETURN
     }
+    return d_buckets[bucketIdx];
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
-bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::erase(
-                                                              const KEY& key,
-                                                              Scope      scope)
+inline
+StripedUnorderedContainerImpl_LockElement *
+StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::lockWrite(
+                                                           Bucket     **bucket,
+                                                           const KEY&   key)
 {
-    bool        eraseAll = scope == e_SCOPE_ALL;
-    bsl::size_t bucketIdx;
-    LEWGuard    guard(lockWrite(&bucketIdx, key));
+    bsl::size_t  hashVal     = d_hasher(key);
+    bsl::size_t  stripeIdx   = bucketToStripe(
+          bslalg::HashTableImpUtil::computeBucketIndex(hashVal, d_numBuckets));
+    LockElement& lockElement = d_locks_p[stripeIdx];
+    lockElement.lockW();
 
-    StripedUnorderedContainerImpl_Bucket<KEY, VALUE> &bucket =
-                                                          d_buckets[bucketIdx];
+    migrateBuckets(stripeIdx, k_NUM_BUCKETS_MIGRATED);
 
-    typedef StripedUnorderedContainerImpl_Node<KEY, VALUE> Node;
+    *bucket = &findBucket(hashVal);
+    return &lockElement;
+}
 
-    bsl::size_t count = 0;
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::migrateBuckets(
+                                                     bsl::size_t stripeIdx,
+                                                     bsl::size_t maxNumBuckets)
+{
+    if (0 == d_numNewBuckets) {
+        return;                                                       // RETURN
+    }
 
-    Node **prevNodeAddress = bucket.headAddress();
-    Node  *prevNode        = NULL;
-    while (*prevNodeAddress) {
-        Node *node = *prevNodeAddress;
-        if (d_comparator(node->key(), key)) {
-            *prevNodeAddress = node->next();
-            if (bucket.tail() == node) {
-                bucket.setTail(prevNode);
-            }
-            d_allocator_p->deleteObject(node);
-            bucket.incrementSize(-1);
+    LockElement&      lockElement = d_locks_p[stripeIdx];
+    const bsl::size_t numBuckets  = d_numBuckets / d_numStripes;
+    const bsl::size_t first       = lockElement.numMigratedBuckets();
+    if (first == numBuckets) {
+        return;                                                       // RETURN
+    }
+    const bsl::size_t last = numBuckets - first > maxNumBuckets
+                           ? first + maxNumBuckets
+                           : numBuckets;
+
+    // The 'k'th bucket of the stripe is at index 'stripeIdx + k * numStripes'
+    // in the old array.  Move its nodes (do not copy them) to the new array.
+
+    for (bsl::size_t k = first; k < last; ++k) {
+        Bucket& bucket = d_buckets[stripeIdx + k * d_numStripes];
+        for (Node *curNode = bucket.head(); curNode != NULL;) {
+            Node *nextPtr = curNode->next();
+
+            bsl::size_t newBucketIdx = bucketIndex(curNode->key(),
+                                                   d_numNewBuckets);
+            curNode->setNext(NULL);
+            d_newBuckets[newBucketIdx].addNode(curNode);
+            curNode = nextPtr;
+        }
+        bucket.setHead(NULL);
+        bucket.setTail(NULL);
+        bucket.setSize(0);
+    }
+    lockElement.setNumMigratedBuckets(last);
+
+    if (last == numBuckets) {
+        d_numStripesToMigrate.add(-1);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::startRehash(
+                                                        bsl::size_t numBuckets)
+{
+    // Allocate the new array before claiming the rehash, so that an exception
+    // leaves the state unchanged.
+
+    BucketArray newBuckets(numBuckets, d_allocator_p);
+
+    int oldState = d_state.testAndSwap(
+                                      k_REHASH_ENABLED,
+                                      k_REHASH_ENABLED | k_REHASH_IN_PROGRESS);
+    if (oldState != k_REHASH_ENABLED) { // Disabled, or state changed
+        return false;                                                 // RETURN
+    }
+
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        d_locks_p[i].lockW();
+    }
+    d_newBuckets.swap(newBuckets);
+    d_numNewBuckets      = numBuckets;
+    d_numStripesToMigrate = static_cast<int>(d_numStripes);
+
+    // Invalidate the lock-free reads that overlap the migration.
+    d_rehashSequence.add(1);
+
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        d_locks_p[i].unlockW();
+    }
+    return true;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::completeRehash()
+{
+    if (0 > d_numStripesToMigrate.load()) {
+        return;                                                       // RETURN
+    }
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        d_locks_p[i].lockW();
+        LEWGuard guard(&d_locks_p[i]);
+        migrateBuckets(i, d_numBuckets);
+    }
+    finishRehash();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::finishRehash()
+{
+    // Exactly one thread observes the transition of the number of stripes
+    // left to migrate from 0 to -1.
+
+    if (0 != d_numStripesToMigrate.load()
+     || 0 != d_numStripesToMigrate.testAndSwap(0, -1)) {
+        return;                                                       // RETURN
+    }
+
+    // A lock-free reader may still be reading the heads of the (now empty)
+    // old buckets: in that mode, retire them rather than free them on return.
+
+    BucketArray  oldBuckets(d_allocator_p);
+    BucketArray *retired = d_epochManager_p
+                         ? new (*d_allocator_p) BucketArray(d_allocator_p)
+                         : &oldBuckets;
+
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        d_locks_p[i].lockW();
+    }
+    replaceBuckets(retired);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::tryFinishRehash()
+{
+    if (0 != d_numStripesToMigrate.load()) {
+        return;                                                       // RETURN
+    }
+
+    BucketArray  oldBuckets(d_allocator_p);
+    BucketArray *retired = d_epochManager_p
+                         ? new (*d_allocator_p) BucketArray(d_allocator_p)
+                         : &oldBuckets;
+
+    bsl::size_t numLocked = 0;
+    while (numLocked < d_numStripes && 0 == d_locks_p[numLocked].tryLockW()) {
+        ++numLocked;
+    }
+
+    // No stripe can be migrated while every stripe is locked, so the number
+    // of stripes left to migrate is stable here.
+
+    if (numLocked == d_numStripes
+     && 0 == d_numStripesToMigrate.testAndSwap(0, -1)) {
+        replaceBuckets(retired);
+        return;                                                       // RETURN
+    }
+
+    while (0 < numLocked) {
+        d_locks_p[--numLocked].unlockW();
+    }
+    if (retired != &oldBuckets) {
+        d_allocator_p->deleteObject(retired);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::replaceBuckets(
+                                                          BucketArray *retired)
+{
+    d_buckets.swap(d_newBuckets);
+    retired->swap(d_newBuckets);
+    d_numBuckets    = d_numNewBuckets;
+    d_numNewBuckets = 0;
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        d_locks_p[i].setNumMigratedBuckets(0);
+    }
+
+    d_rehashSequence.add(1);
+
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        d_locks_p[i].unlockW();
+    }
+
+    if (d_epochManager_p) {
+        d_epochManager_p->retire(retired, &deleteBucketArray, d_allocator_p);
+    }
+
+    // Rehash no longer in progress
+    d_state = d_state & ~k_REHASH_IN_PROGRESS;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::assistRehash()
+{
+    if (0 < d_numStripesToMigrate.load()) {
+        // Start from a different stripe on each call, so that concurrent
+        // helpers seldom compete for the same stripe.
+
+        const bsl::size_t start = d_migrationCursor.addRelaxed(1);
+
+        for (bsl::size_t n = 0; n < d_numStripes; ++n) {
+            const bsl::size_t  stripeIdx   = (start + n) & d_hashMask;
+            LockElement&       lockElement = d_locks_p[stripeIdx];
+            if (0 != lockElement.tryLockW()) {
+                continue;                                           // CONTINUE
+            }
+            const bool isMigrated = 0 == d_numNewBuckets
+                                 || lockElement.numMigratedBuckets() ==
+                                                  d_numBuckets / d_numStripes;
+            if (!isMigrated) {
+                migrateBuckets(stripeIdx, k_NUM_BUCKETS_MIGRATED);
+            }
+            lockElement.unlockW();
+            if (!isMigrated) {
+                break;
+            }
+        }
+    }
+    tryFinishRehash();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::applyVisitor(
+                                          Bucket                 *bucket,
+                                          Node                   *prevNode,
+                                          Node                  **node,
+                                          const VisitorFunction&  visitor,
+                                          RetireBuffer           *retireBuffer)
+{
+    if (!retireBuffer) {
+        return visitor(&(*node)->value(), (*node)->key());            // RETURN
+    }
+    return applyVisitorToCopy(bucket,
+                              prevNode,
+                              node,
+                              visitor,
+                              retireBuffer,
+                              bsl::is_copy_constructible<VALUE>());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::
+                      applyVisitorToCopy(Bucket                 *bucket,
+                                         Node                   *prevNode,
+                                         Node                  **node,
+                                         const VisitorFunction&  visitor,
+                                         RetireBuffer           *retireBuffer,
+                                         bsl::true_type)
+{
+    // Readers may be copying the value of '*node' without a lock: let the
+    // visitor modify a copy, and publish the copy in place of '*node'.
+
+    Node *copy = new (*d_allocator_p) Node((*node)->key(),
+                                           (*node)->value(),
+                                           (*node)->next(),
+                                           d_allocator_p);
+    bslma::RawDeleterProctor<Node, bslma::Allocator> proctor(copy,
+                                                             d_allocator_p);
+
+    bool ret = visitor(&copy->value(), copy->key());
+    proctor.release();
+
+    bucket->replaceNode(prevNode, *node, copy);
+    retireBuffer->retire(*node);
+    *node = copy;
+    return ret;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::
+                      applyVisitorToCopy(Bucket                 *,
+                                         Node                   *,
+                                         Node                  **node,
+                                         const VisitorFunction&  visitor,
+                                         RetireBuffer           *,
+                                         bsl::false_type)
+{
+    // Never reached: the constructor refuses 'e_READ_LOCK_FREE' for such a
+    // 'VALUE', so no stripe has a retire buffer.
+
+    return visitor(&(*node)->value(), (*node)->key());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::checkRehash()
+{
+    finishRehash();
+
+    float loadF = loadFactor();
+    if (d_maxLoadFactor < loadF && !canRehash()
+     && (k_REHASH_ENABLED | k_REHASH_IN_PROGRESS) == d_state) {
+        // The load factor exceeds the maximum for the new bucket array of the
+        // rehash underway: complete that rehash, so that the next one can
+        // start, rather than let the load factor grow without bound.
+
+        completeRehash();
+        loadF = loadFactor();
+    }
+    if (d_maxLoadFactor < loadF && canRehash()) {
+        int ratio = static_cast<int>(loadF / d_maxLoadFactor);
+        int growthFactor = 2;
+        while (growthFactor < ratio) {
+            growthFactor <<= 1;
+        }
+        bsl::size_t newNumBuckets = d_numBuckets * growthFactor;
+        if (e_REHASH_INCREMENTAL == d_rehashPolicy.loadRelaxed()) {
+            startRehash(newNumBuckets);
+        }
+        else {
+            rehash(newNumBuckets);
+        }
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::erase(
+                                                              const KEY& key,
+                                                              Scope      scope)
+{
+    bool        eraseAll = scope == e_SCOPE_ALL;
+    Bucket      *bucketPtr;
+    LockElement *lockElement = lockWrite(&bucketPtr, key);
+    LEWGuard     guard(lockElement);
+    Bucket&      bucket = *bucketPtr;
+
+    bsl::size_t count = 0;
+
+    Node *prevNode = NULL;
+    Node *node     = bucket.head();
+    while (node) {
+        Node *nextNode = node->next();
+        if (d_comparator(node->key(), key)) {
+            bucket.removeNode(prevNode, node);
+            releaseNode(node, lockElement->retireBuffer());
             d_numElements.addRelaxed(-1);
             ++count;
             if (!eraseAll) {
-                return count;                                         // RETURN
+                break;
             }
         }
         else {
-            prevNode        = node;
-            prevNodeAddress = node->nextAddress();
+            prevNode = node;
         }
+        node = nextNode;
+    }
+    guard.release();
+
+    if (count) {
+        finishWrite();
     }
     return count;
 }
@@ -1800,29 +2784,20 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::eraseBulk(
         LockElement& lockElement = d_locks_p[curStripeIdx];
         lockElement.lockW();
         LEWGuard guard(&lockElement);
+        migrateBuckets(curStripeIdx, k_NUM_BUCKETS_MIGRATED);
         for (; j < dataSize && sortIdxs[j].d_stripeIdx == curStripeIdx; ++j) {
-            int          dataIdx   = sortIdxs[j].d_dataIdx;
-            bsl::size_t  bucketIdx =
-                                  bslalg::HashTableImpUtil::computeBucketIndex(
-                                                         sortIdxs[j].d_hashVal,
-                                                         d_numBuckets);
-
-            StripedUnorderedContainerImpl_Bucket<KEY, VALUE> &bucket =
-                                                          d_buckets[bucketIdx];
+            int     dataIdx = sortIdxs[j].d_dataIdx;
+            Bucket& bucket  = findBucket(sortIdxs[j].d_hashVal);
 
             const KEY& key  = first[dataIdx];
 
-            Node **prevNodeAddress = bucket.headAddress();
-            Node  *prevNode        = NULL;
-            while (*prevNodeAddress) {
-                Node *node = *prevNodeAddress;
+            Node *prevNode = NULL;
+            Node *node     = bucket.head();
+            while (node) {
+                Node *nextNode = node->next();
                 if (d_comparator(node->key(), key)) {
-                    *prevNodeAddress = node->next();
-                    if (bucket.tail() == node) {
-                        bucket.setTail(prevNode);
-                    }
-                    d_allocator_p->deleteObject(node);
-                    bucket.incrementSize(-1);
+                    bucket.removeNode(prevNode, node);
+                    releaseNode(node, lockElement.retireBuffer());
                     d_numElements.addRelaxed(-1);
                     ++count;
                     if (!eraseAll) {
@@ -1830,13 +2805,16 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::eraseBulk(
                     }
                 }
                 else {
-                    prevNode        = node;
-                    prevNodeAddress = node->nextAddress();
+                    prevNode = node;
                 }
+                node = nextNode;
             }
         }
     }
 
+    if (count) {
+        finishWrite();
+    }
     return count;
 }
 
@@ -1849,8 +2827,9 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::insert(
 {
     bool insertAlways = multiplicity == e_INSERT_ALWAYS;
 
-    bsl::size_t bucketIdx;
-    LEWGuard    guard(lockWrite(&bucketIdx, key));
+    Bucket      *bucket;
+    LockElement *lockElement = lockWrite(&bucket, key);
+    LEWGuard     guard(lockElement);
 
     bsl::size_t ret = 0;
     if (insertAlways) {
@@ -1860,17 +2839,20 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::insert(
                                                                 value,
                                                                 NULL,
                                                                 d_allocator_p);
-        d_buckets[bucketIdx].addNode(node);
+        bucket->addNode(node);
     }
     else {
         // Update only the first value if key exists.  Use only in hash map.
-        ret = d_buckets[bucketIdx].setValue(
+        ret = bucket->setValue(
         key,
         d_comparator,
         value,
-        StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::e_BUCKETSCOPE_FIRST);
+        StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::e_BUCKETSCOPE_FIRST,
+        lockElement->retireBuffer());
     }
     if (ret == 1) {
+        guard.release();
+        finishWrite();
         return 0;                                                     // RETURN
     }
     guard.release();
@@ -1888,24 +2870,28 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::insert(
 {
     bool insertAlways = multiplicity == e_INSERT_ALWAYS;
 
-    bsl::size_t bucketIdx;
-    LEWGuard    guard(lockWrite(&bucketIdx, key));
+    Bucket      *bucket;
+    LockElement *lockElement = lockWrite(&bucket, key);
+    LEWGuard     guard(lockElement);
 
     bsl::size_t ret = 0;
     if (insertAlways) {
         // Insert, ignoring an existing value if any.  Use only in multimap.
         Node *node = new (*d_allocator_p)
             Node(key, bslmf::MovableRefUtil::move(value), NULL, d_allocator_p);
-        d_buckets[bucketIdx].addNode(node);
+        bucket->addNode(node);
     }
     else {
         // Update only the first value if key exists.  Use only in hash map.
-        ret = d_buckets[bucketIdx].setValue(
-                                           key,
-                                           d_comparator,
-                                           bslmf::MovableRefUtil::move(value));
+        ret = bucket->setValue(
+                                            key,
+                                            d_comparator,
+                                            bslmf::MovableRefUtil::move(value),
+                                            lockElement->retireBuffer());
     }
     if (ret == 1) {
+        guard.release();
+        finishWrite();
         return 0;                                                     // RETURN
     }
     guard.release();
@@ -1950,13 +2936,11 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::insertBulk(
         LockElement& lockElement = d_locks_p[curStripeIdx];
         lockElement.lockW();
         LEWGuard guard(&lockElement);
+        migrateBuckets(curStripeIdx, k_NUM_BUCKETS_MIGRATED);
         for (; j < dataSize && sortIdxs[j].d_stripeIdx == curStripeIdx; ++j) {
-            int          dataIdx   = sortIdxs[j].d_dataIdx;
-            bsl::size_t  bucketIdx =
-                bslalg::HashTableImpUtil::computeBucketIndex(
-                                                         sortIdxs[j].d_hashVal,
-                                                         d_numBuckets);
-            const KEY&   key   = first[dataIdx].first;
+            int          dataIdx = sortIdxs[j].d_dataIdx;
+            Bucket&      bucket  = findBucket(sortIdxs[j].d_hashVal);
+            const KEY&   key     = first[dataIdx].first;
             const VALUE& value = first[dataIdx].second;
 
             if (insertAlways) {
@@ -1969,16 +2953,17 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::insertBulk(
                                                                 value,
                                                                 NULL,
                                                                 d_allocator_p);
-                d_buckets[bucketIdx].addNode(node);
+                bucket.addNode(node);
                 ++count;
                 d_numElements.addRelaxed(1);
             } else {
-                bsl::size_t ret = d_buckets[bucketIdx].setValue(
+                bsl::size_t ret = bucket.setValue(
                     key,
                     d_comparator,
                     value,
                     StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::
-                                                          e_BUCKETSCOPE_FIRST);
+                                                          e_BUCKETSCOPE_FIRST,
+                    lockElement.retireBuffer());
                 if (ret == 0) {
                     ++count;
                     d_numElements.addRelaxed(1);
@@ -1986,10 +2971,64 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::insertBulk(
             }
         }
     }
+    if (!insertAlways && count < static_cast<bsl::size_t>(dataSize)) {
+        finishWrite();
+    }
     checkRehash();
     return count;
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::finishWrite()
+{
+    if (0 <= d_numStripesToMigrate.loadRelaxed()) {
+        assistRehash();
+        finishRehash();
+    }
+
+    // Reclaiming serializes the writers on the mutex of the epoch manager:
+    // do it only once enough objects are awaiting reclamation, and raise the
+    // threshold if readers prevent most of them from being reclaimed.
+
+    if (d_epochManager_p
+     && d_reclaimThreshold.loadRelaxed() <= d_epochManager_p->numRetired()) {
+        d_epochManager_p->reclaim();
+
+        const int numLeft = d_epochManager_p->numRetired();
+        d_reclaimThreshold.storeRelaxed(
+                               numLeft < k_RECLAIM_THRESHOLD / 2
+                               ? static_cast<int>(k_RECLAIM_THRESHOLD)
+                               : 2 * numLeft);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::releaseNode(
+                                                    Node         *node,
+                                                    RetireBuffer *retireBuffer)
+{
+    if (retireBuffer) {
+        retireBuffer->retire(node);
+    }
+    else {
+        d_allocator_p->deleteObject(node);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void
+StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::retireAllBuffered()
+{
+    BSLS_ASSERT(d_epochManager_p);
+
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        d_locks_p[i].retireBuffer()->flush();
+    }
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 int StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::setComputedValue(
                                                 const KEY&             key,
@@ -2001,28 +3040,32 @@ int StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::setComputedValue(
                                             ? BucketClass::e_BUCKETSCOPE_ALL
                                             : BucketClass::e_BUCKETSCOPE_FIRST;
 
-    bsl::size_t                bucketIdx;
-    LEWGuard                   guard(lockWrite(&bucketIdx, key));
-
-    StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket =
-                                                          d_buckets[bucketIdx];
+    Bucket      *bucketPtr;
+    LockElement *lockElement = lockWrite(&bucketPtr, key);
+    LEWGuard     guard(lockElement);
+    Bucket&      bucket = *bucketPtr;
     // Loop on the elements in the list
-    int                                             count = 0;
-    StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode = bucket.head();
-    for (; curNode != NULL; curNode = curNode->next()) {
+    int   count    = 0;
+    bool  ret      = true;
+    Node *prevNode = NULL;
+    Node *curNode  = bucket.head();
+    for (; curNode != NULL; prevNode = curNode, curNode = curNode->next()) {
         if (d_comparator(curNode->key(), key)) {
-            bool ret = visitor(&curNode->value(), key);
-            if (false == setAll) {
-                return ret ? 1 : -1;                                  // RETURN
-            }
+            ret = applyVisitor(&bucket,
+                               prevNode,
+                               &curNode,
+                               visitor,
+                               lockElement->retireBuffer());
             ++count;
-            if (false == ret) {
-                return -count;                                        // RETURN
+            if (false == setAll || false == ret) {
+                break;
             }
         }
     }
     if (count > 0) {
-        return count;                                                 // RETURN
+        guard.release();
+        finishWrite();
+        return ret ? count : -count;                                  // RETURN
     }
 
     // Not found - process as false, and return 0.
@@ -2068,18 +3111,24 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::setValue(
                                             ? BucketClass::e_BUCKETSCOPE_ALL
                                             : BucketClass::e_BUCKETSCOPE_FIRST;
 
-    bsl::size_t                bucketIdx;
-    LEWGuard                   guard(lockWrite(&bucketIdx, key));
-
-    StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket =
-                                                          d_buckets[bucketIdx];
+    Bucket      *bucketPtr;
+    LockElement *lockElement = lockWrite(&bucketPtr, key);
+    LEWGuard     guard(lockElement);
+    Bucket&      bucket = *bucketPtr;
 
-    bsl::size_t count = bucket.setValue(key, d_comparator, value, setAll);
+    bsl::size_t count = bucket.setValue(key,
+                                        d_comparator,
+                                        value,
+                                        setAll,
+                                        lockElement->retireBuffer());
+    guard.release();
     if (count == 0) {
-        guard.release();
         d_numElements.addRelaxed(1);
         checkRehash();
     }
+    else {
+        finishWrite();
+    }
     return count;
 }
 
@@ -2106,52 +3155,126 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::bucketToStripe(
     return bucketIndex & d_hashMask;
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::getValueLockFree(
+                                                         VALUE      *value,
+                                                         const KEY&  key) const
+{
+    BSLS_ASSERT(d_epochManager_p);
+
+    bsl::size_t hashVal = d_hasher(key);
+    EpochGuard  guard(d_epochManager_p);
+
+    // Read the bucket array and its size between two loads of the rehash
+    // sequence, so that they are known to be consistent.  A node reached from
+    // the bucket is not reclaimed before 'guard' is destroyed, and (since
+    // values are never modified in place) a node found to have 'key' is an
+    // element of this hash map that can be copied safely.
+
+    const int sequence = d_rehashSequence.load();
+    if (sequence & 1) {
+        return -1;                                                    // RETURN
+    }
+    const Bucket      *buckets    = d_buckets.data();
+    const bsl::size_t  numBuckets = d_numBuckets;
+    if (sequence != d_rehashSequence.load()) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsl::size_t bucketIdx =
+                  bslalg::HashTableImpUtil::computeBucketIndex(hashVal,
+                                                               numBuckets);
+    const Bucket&     bucket    = buckets[bucketIdx];
+    for (const Node *curNode = bucket.head();
+                                 curNode != NULL; curNode = curNode->next()) {
+        if (d_comparator(curNode->key(), key)) {
+            *value = curNode->value();
+            return 1;                                                 // RETURN
+        }
+    }
+
+    // Not finding 'key' is conclusive only if no rehash relinked the nodes
+    // while the bucket was traversed.
+
+    return sequence == d_rehashSequence.load() ? 0 : -1;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::getValueLockFree(
+                                                 bsl::vector<VALUE> *valuesPtr,
+                                                 const KEY&          key) const
+{
+    BSLS_ASSERT(d_epochManager_p);
+
+    bsl::size_t hashVal = d_hasher(key);
+    EpochGuard  guard(d_epochManager_p);
+
+    const int sequence = d_rehashSequence.load();
+    if (sequence & 1) {
+        return -1;                                                    // RETURN
+    }
+    const Bucket      *buckets    = d_buckets.data();
+    const bsl::size_t  numBuckets = d_numBuckets;
+    if (sequence != d_rehashSequence.load()) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsl::size_t bucketIdx =
+                  bslalg::HashTableImpUtil::computeBucketIndex(hashVal,
+                                                               numBuckets);
+    const Bucket&     bucket    = buckets[bucketIdx];
+    int               count     = 0;
+    for (const Node *curNode = bucket.head();
+                                 curNode != NULL; curNode = curNode->next()) {
+        if (d_comparator(curNode->key(), key)) {
+            valuesPtr->push_back(curNode->value());
+            ++count;
+        }
+    }
+    return sequence == d_rehashSequence.load() ? count : -1;
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
-StripedUnorderedContainerImpl_LockElement *
-StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::lockRead(
-                                                       bsl::size_t  *bucketIdx,
-                                                       const KEY&    key) const
+const typename StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::Bucket&
+StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::findBucket(
+                                                     bsl::size_t hashVal) const
 {
-    // From key, get hash value, and current number of buckets.
-    bsl::size_t  hashVal    = d_hasher(key);
-    bsl::size_t  numBuckets = d_numBuckets;
-    bsl::size_t  bucketIndex  =
-           bslalg::HashTableImpUtil::computeBucketIndex(hashVal, d_numBuckets);
-    bsl::size_t  stripeIdx = bucketToStripe(bucketIndex);
-    LockElement& lockElement = d_locks_p[stripeIdx];
-    lockElement.lockR();
-    // When we get the lock, did the number of buckets change?
-    if (numBuckets != d_numBuckets) {
-        bucketIndex =
+    bsl::size_t bucketIdx =
            bslalg::HashTableImpUtil::computeBucketIndex(hashVal, d_numBuckets);
+
+    // The buckets of a stripe are migrated in order of their index, so the
+    // bucket of 'hashVal' was migrated if its position within its stripe is
+    // below the number of buckets migrated for that stripe.
+
+    if (d_numNewBuckets && bucketIdx / d_numStripes <
+               d_locks_p[bucketToStripe(bucketIdx)].numMigratedBuckets()) {
+        return d_newBuckets[bslalg::HashTableImpUtil::computeBucketIndex(
+                                                     hashVal,
+                                                     d_numNewBuckets)];
+                                                                      // RETURN
     }
-    *bucketIdx = bucketIndex;
-    return &lockElement;
+    return d_buckets[bucketIdx];
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 StripedUnorderedContainerImpl_LockElement *
-StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::lockWrite(
-                                                       bsl::size_t  *bucketIdx,
-                                                       const KEY&    key) const
+StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::lockRead(
+                                                      const Bucket **bucket,
+                                                      const KEY&     key) const
 {
-    // From key, get hash value, and current number of buckets.
-    bsl::size_t  hashVal      = d_hasher(key);
-    bsl::size_t  numBuckets   = d_numBuckets;
-    bsl::size_t  bucketIndex  =
-           bslalg::HashTableImpUtil::computeBucketIndex(hashVal, d_numBuckets);
-    bsl::size_t  stripeIdx   = bucketToStripe(bucketIndex);
+    // The stripe of a key does not depend on the number of buckets (a power
+    // of 2 not less than the number of stripes), so it is safe to compute it
+    // before acquiring the lock, even if a rehash is underway.
+
+    bsl::size_t  hashVal     = d_hasher(key);
+    bsl::size_t  stripeIdx   = bucketToStripe(
+          bslalg::HashTableImpUtil::computeBucketIndex(hashVal, d_numBuckets));
     LockElement& lockElement = d_locks_p[stripeIdx];
-    lockElement.lockW();
+    lockElement.lockR();
 
-    // When we get the lock, did the number of buckets change?
-    if (numBuckets != d_numBuckets) {
-        bucketIndex =
-           bslalg::HashTableImpUtil::computeBucketIndex(hashVal, d_numBuckets);
-    }
-    *bucketIdx = bucketIndex;
+    *bucket = &findBucket(hashVal);
     return &lockElement;
 }
 
@@ -2172,17 +3295,81 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::
 , d_statePad()
 , d_numElementsPad()
 , d_buckets(d_numBuckets, basicAllocator)
+, d_newBuckets(basicAllocator)
+, d_numNewBuckets(0)
+, d_epochManager_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_state       = k_REHASH_ENABLED; // Rehash enabled, not in progress
+    d_numElements = 0; // Hash empty
+
+    d_rehashPolicy        = e_REHASH_BLOCKING;
+    d_numStripesToMigrate = -1; // No rehash underway
+    d_reclaimThreshold    = k_RECLAIM_THRESHOLD;
+
+    // Allocate array of 'LockElement' objects, and construct them.
+    d_locks_p = reinterpret_cast<LockElement*>(
+                  d_allocator_p->allocate(d_numStripes * sizeof(LockElement)));
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        bslma::ConstructionUtil::construct(&d_locks_p[i], d_allocator_p);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::
+                                                 StripedUnorderedContainerImpl(
+                                           bsl::size_t       numInitialBuckets,
+                                           bsl::size_t       numStripes,
+                                           ReadPolicy        readPolicy,
+                                           bslma::Allocator *basicAllocator)
+: d_numStripes(powerCeil(numStripes))
+, d_numBuckets(adjustBuckets(numInitialBuckets, d_numStripes))
+, d_hashMask(d_numStripes - 1)
+, d_maxLoadFactor(1.0)
+, d_hasher()
+, d_comparator()
+, d_statePad()
+, d_numElementsPad()
+, d_buckets(d_numBuckets, basicAllocator)
+, d_newBuckets(basicAllocator)
+, d_numNewBuckets(0)
+, d_epochManager_p(0)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
+    // Lock-free reads copy the elements on every write (see
+    // 'applyVisitorToCopy'), so a 'VALUE' that is not copy-constructible is
+    // rejected here rather than when a visitor is first applied.
+
+    BSLS_ASSERT_OPT(e_READ_LOCKED == readPolicy
+                 || bsl::is_copy_constructible<VALUE>::value);
+
     d_state       = k_REHASH_ENABLED; // Rehash enabled, not in progress
     d_numElements = 0; // Hash empty
 
+    d_rehashPolicy        = e_REHASH_BLOCKING;
+    d_numStripesToMigrate = -1; // No rehash underway
+    d_reclaimThreshold    = k_RECLAIM_THRESHOLD;
+
+    if (e_READ_LOCK_FREE == readPolicy
+     && bsl::is_copy_constructible<VALUE>::value) {
+        d_epochManager_p = new (*d_allocator_p) EpochManager(d_allocator_p);
+    }
+    bslma::RawDeleterProctor<EpochManager, bslma::Allocator> proctor(
+                                                              d_epochManager_p,
+                                                              d_allocator_p);
+
     // Allocate array of 'LockElement' objects, and construct them.
     d_locks_p = reinterpret_cast<LockElement*>(
                   d_allocator_p->allocate(d_numStripes * sizeof(LockElement)));
     for (bsl::size_t i = 0; i < d_numStripes; ++i) {
         bslma::ConstructionUtil::construct(&d_locks_p[i], d_allocator_p);
+        if (d_epochManager_p) {
+            d_locks_p[i].attachRetireBuffer(d_epochManager_p,
+                                            &Node::deleteNode);
+        }
     }
+    proctor.release();
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
@@ -2190,10 +3377,21 @@ inline
 StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::
                                                ~StripedUnorderedContainerImpl()
 {
+    if (d_epochManager_p) {
+        retireAllBuffered();
+    }
     for (bsl::size_t i = 0; i < d_numStripes; ++i) {
         bslma::DestructionUtil::destroy(&d_locks_p[i]);
     }
     d_allocator_p->deallocate(d_locks_p);
+
+    if (d_epochManager_p) {
+        // Destroying the epoch manager reclaims the retired nodes and bucket
+        // arrays; the elements still in 'd_buckets' are deleted by its
+        // destructor.
+
+        d_allocator_p->deleteObject(d_epochManager_p);
+    }
 }
 
 // MANIPULATORS
@@ -2201,17 +3399,25 @@ template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::clear()
 {
-    // Locking all stripes will inherently block until a rehash will complete
+    // Locking all stripes excludes every other writer.  The buckets of both
+    // arrays are emptied if a rehash is underway, which then continues.
     for (bsl::size_t i = 0; i < d_numStripes; ++i) {
         d_locks_p[i].lockW();
     }
     for (bsl::size_t j = 0; j < d_numBuckets; ++j) {
-        d_buckets[j].clear();
+        d_buckets[j].clear(d_locks_p[bucketToStripe(j)].retireBuffer());
+    }
+    for (bsl::size_t j = 0; j < d_numNewBuckets; ++j) {
+        d_newBuckets[j].clear(d_locks_p[bucketToStripe(j)].retireBuffer());
+    }
+    if (d_epochManager_p) {
+        retireAllBuffered();
     }
     d_numElements = 0;
     for (bsl::size_t i = 0; i < d_numStripes; ++i) {
         d_locks_p[i].unlockW();
     }
+    finishWrite();
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
@@ -2370,69 +3576,28 @@ void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::rehash(
     }
     numBuckets = powerCeil(numBuckets);
 
+    // Complete the rehash underway, if any, so that the number of buckets
+    // compared below is the one the elements are placed in.
+    completeRehash();
+
     if (numBuckets == d_numBuckets) { // Skip if no change in # of buckets
         return;                                                       // RETURN
     }
     if (!canRehash()) { // Skip if can't rehash
         return;                                                       // RETURN
     }
-
-    // Set state to rehash
-    int oldState = d_state.testAndSwap(
-                                      k_REHASH_ENABLED,
-                                      k_REHASH_ENABLED | k_REHASH_IN_PROGRESS);
-    if (oldState != k_REHASH_ENABLED) { // State changed under our feet
-        return;                                                       // RETURN
-    }
-
-    // Allocate a new data vector
-    bsl::vector<StripedUnorderedContainerImpl_Bucket<KEY,VALUE> > newBuckets(
-                                                                numBuckets,
-                                                                d_allocator_p);
-
-    // Main loop on stripes: lock a stripe and process all buckets in it
-    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
-        d_locks_p[i].lockW();
-        // Loop on the buckets of the current stripe.  This is simple, as the
-        // stripe is the last bits in a bucket index.  We start with the
-        // current stripe as the first bucket, and add 'd_numStripes' for the
-        // next bucket, until 'd_numBuckets'.
-        for (bsl::size_t j = i; j < d_numBuckets; j += d_numStripes) {
-            StripedUnorderedContainerImpl_Bucket<KEY, VALUE> &bucket =
-                                                                  d_buckets[j];
-            // Process the nodes in the bucket.  Note that we do not need to
-            // delete the old node and allocate a new one, but can simply move
-            // it.
-            for (StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode =
-                                             bucket.head(); curNode != NULL;) {
-                StripedUnorderedContainerImpl_Node<KEY, VALUE> *nextPtr =
-                                                               curNode->next();
-
-                bsl::size_t newBucketIdx = bucketIndex(curNode->key(),
-                                                       numBuckets);
-                curNode->setNext(NULL);
-                newBuckets[newBucketIdx].addNode(curNode);
-                curNode = nextPtr;
-            }
-            bucket.setHead(NULL);
-            bucket.setTail(NULL);
-            bucket.setSize(0);
-        }
-    }
-    // Swap 'newBuckets' and 'd_buckets'.  This requires the same allocator.
-    d_buckets.swap(newBuckets);
-
-    // Update number of buckets.
-    d_numBuckets = numBuckets;
-
-    // Unlock all stripes.  This could not be done on the spot, as we store the
-    /// rehashed data in a new set of buckets.
-    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
-        d_locks_p[i].unlockW();
+    if (startRehash(numBuckets)) {
+        completeRehash();
     }
+    finishWrite();
+}
 
-    // Rehash no longer in progress
-    d_state = d_state & ~k_REHASH_IN_PROGRESS;
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::rehashPolicy(
+                                                  RehashPolicy newRehashPolicy)
+{
+    d_rehashPolicy.storeRelaxed(newRehashPolicy);
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
@@ -2482,20 +3647,23 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::setValueFirst(
                                                 const KEY&               key,
                                                 bslmf::MovableRef<VALUE> value)
 {
-    bsl::size_t bucketIdx;
-    LEWGuard    guard(lockWrite(&bucketIdx, key));
-
-    StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket =
-                                                          d_buckets[bucketIdx];
+    Bucket      *bucketPtr;
+    LockElement *lockElement = lockWrite(&bucketPtr, key);
+    LEWGuard     guard(lockElement);
+    Bucket&      bucket = *bucketPtr;
 
     bsl::size_t count = bucket.setValue(key,
                                         d_comparator,
-                                        bslmf::MovableRefUtil::move(value));
+                                        bslmf::MovableRefUtil::move(value),
+                                        lockElement->retireBuffer());
+    guard.release();
     if (count == 0) {
-        guard.release();
         d_numElements.addRelaxed(1);
         checkRehash();
     }
+    else {
+        finishWrite();
+    }
     return count;
 }
 
@@ -2505,25 +3673,35 @@ int StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::update(
                                                 const KEY&             key,
                                                 const VisitorFunction& visitor)
 {
-    bsl::size_t bucketIdx;
-    LEWGuard    guard(lockWrite(&bucketIdx, key));
-
-    StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket =
-                                                          d_buckets[bucketIdx];
+    Bucket      *bucketPtr;
+    LockElement *lockElement = lockWrite(&bucketPtr, key);
+    LEWGuard     guard(lockElement);
+    Bucket&      bucket = *bucketPtr;
 
     // Loop on the elements in the list
-    int                                             count = 0;
-    StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode = bucket.head();
-    for (; curNode != NULL; curNode = curNode->next()) {
+    int   count    = 0;
+    bool  ret      = true;
+    Node *prevNode = NULL;
+    Node *curNode  = bucket.head();
+    for (; curNode != NULL; prevNode = curNode, curNode = curNode->next()) {
         if (d_comparator(curNode->key(), key)) {
             ++count;
-            bool ret = visitor(&curNode->value(), key);
+            ret = applyVisitor(&bucket,
+                               prevNode,
+                               &curNode,
+                               visitor,
+                               lockElement->retireBuffer());
             if (ret == false) {
-                return -count;                                        // RETURN
+                break;
             }
         }
     }
-    return count;
+    guard.release();
+
+    if (count) {
+        finishWrite();
+    }
+    return ret ? count : -count;
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
@@ -2537,23 +3715,33 @@ int StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::visit(
         // Loop on the buckets of the current stripe.  This is simple, as the
         // stripe is the last bits in a bucket index.  We start with the
         // current stripe as the first bucket, and add 'd_numStripes' for the
-        // next bucket, until 'd_numBuckets'.
-        for (bsl::size_t j = i; j < d_numBuckets; j += d_numStripes) {
-            StripedUnorderedContainerImpl_Bucket<KEY, VALUE> &bucket =
-                                                                  d_buckets[j];
-            // Loop on the nodes in the bucket.
-            for (StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode =
-                                                bucket.head(); curNode != NULL;
-                                                   curNode = curNode->next()) {
-                ++count;
-                bool ret = visitor(&(curNode->value()), curNode->key());
-                if (!ret) {
-                    d_locks_p[i].unlockW();
-                    return -count;                                    // RETURN
+        // next bucket, until the number of buckets.  If a rehash is underway,
+        // the elements are in the buckets of the stripe in either array (the
+        // old buckets already migrated are empty).
+        for (int t = 0; t < 2; ++t) {
+            BucketArray& buckets = t ? d_newBuckets : d_buckets;
+            for (bsl::size_t j = i; j < buckets.size(); j += d_numStripes) {
+                Bucket& bucket = buckets[j];
+                // Loop on the nodes in the bucket.
+                Node *prevNode = NULL;
+                for (Node *curNode = bucket.head(); curNode != NULL;
+                               prevNode = curNode, curNode = curNode->next()) {
+                    ++count;
+                    bool ret = applyVisitor(&bucket,
+                                            prevNode,
+                                            &curNode,
+                                            visitor,
+                                            d_locks_p[i].retireBuffer());
+                    if (!ret) {
+                        d_locks_p[i].unlockW();
+                        finishWrite();
+                        return -count;                                // RETURN
+                    }
                 }
             }
         }
         d_locks_p[i].unlockW();
+        finishWrite();
     }
     return count;
 }
@@ -2564,7 +3752,8 @@ inline
 bsl::size_t
 StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::bucketCount() const
 {
-    return d_numBuckets;
+    const bsl::size_t numNewBuckets = d_numNewBuckets;
+    return numNewBuckets ? numNewBuckets : d_numBuckets;
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
@@ -2573,7 +3762,7 @@ bsl::size_t
 StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::bucketIndex(
                                                           const KEY& key) const
 {
-    return bucketIndex(key, d_numBuckets);
+    return bucketIndex(key, bucketCount());
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
@@ -2584,7 +3773,34 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::bucketSize(
     BSLS_ASSERT(0 <= index);
     BSLS_ASSERT(index < bucketCount());
 
-    return d_buckets[index].size();
+    LockElement& lockElement = d_locks_p[bucketToStripe(index)];
+    lockElement.lockR();
+    LERGuard guard(&lockElement);
+
+    if (0 == d_numNewBuckets) {
+        return d_buckets[index].size();                               // RETURN
+    }
+
+    // A rehash is underway: add, to the size of the new bucket, the number of
+    // elements of the old buckets not yet migrated that will be moved to it.
+    // These old buckets are those whose index is congruent to 'index' modulo
+    // the smaller of the two numbers of buckets.
+
+    bsl::size_t       count       = d_newBuckets[index].size();
+    const bsl::size_t numMigrated = lockElement.numMigratedBuckets();
+    for (bsl::size_t j = index % d_numBuckets; j < d_numBuckets;
+                                                       j += d_numNewBuckets) {
+        if (j / d_numStripes < numMigrated) {
+            continue;
+        }
+        for (const Node *curNode = d_buckets[j].head();
+                                 curNode != NULL; curNode = curNode->next()) {
+            if (index == bucketIndex(curNode->key(), d_numNewBuckets)) {
+                ++count;
+            }
+        }
+    }
+    return count;
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
@@ -2603,6 +3819,11 @@ bool StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::empty() const
             return false;                                             // RETURN
         }
     }
+    for (bsl::size_t i = 0; i < d_numNewBuckets; ++i) {
+        if (!d_newBuckets[i].empty()) {
+            return false;                                             // RETURN
+        }
+    }
     return true;
 }
 
@@ -2622,11 +3843,25 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::getValue(
 {
     BSLS_ASSERT(NULL != value);
 
-    bsl::size_t bucketIdx;
-    LERGuard    guard(lockRead(&bucketIdx, key));
+    if (0 <= d_numStripesToMigrate.loadRelaxed()) {
+        // Advance the rehash underway: the migration of a stripe that is never
+        // written would otherwise never end.  This does not change the salient
+        // state of this container.
+
+        const_cast<StripedUnorderedContainerImpl *>(this)->assistRehash();
+    }
+
+    if (d_epochManager_p) {
+        int rc = getValueLockFree(value, key);
+        if (0 <= rc) {
+            return rc;                                                // RETURN
+        }
+    }
+
+    const Bucket *bucketPtr;
+    LERGuard      guard(lockRead(&bucketPtr, key));
+    const Bucket& bucket = *bucketPtr;
 
-    const StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket = d_buckets[
-                                                                    bucketIdx];
     // Loop on the elements in the list
     StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode  = bucket.head();
     for (; curNode != NULL; curNode = curNode->next()) {
@@ -2648,12 +3883,25 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::getValue(
 
     valuesPtr->clear();
 
-    bsl::size_t bucketIdx;
-    LERGuard    guard(lockRead(&bucketIdx, key));
+    if (0 <= d_numStripesToMigrate.loadRelaxed()) {
+        // See 'getValue'.
 
-    bsl::size_t                                             count  = 0;
-    const StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket = d_buckets[
-                                                                    bucketIdx];
+        const_cast<StripedUnorderedContainerImpl *>(this)->assistRehash();
+    }
+
+    if (d_epochManager_p) {
+        int rc = getValueLockFree(valuesPtr, key);
+        if (0 <= rc) {
+            return rc;                                                // RETURN
+        }
+        valuesPtr->clear();
+    }
+
+    const Bucket *bucketPtr;
+    LERGuard      guard(lockRead(&bucketPtr, key));
+    const Bucket& bucket = *bucketPtr;
+
+    bsl::size_t count = 0;
     // Loop on the elements in the list
     StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode  = bucket.head();
     for (; curNode != NULL; curNode = curNode->next()) {
@@ -2681,13 +3929,21 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::isRehashEnabled() const
     return d_state & k_REHASH_ENABLED;
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::ReadPolicy
+StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::readPolicy() const
+{
+    return d_epochManager_p ? e_READ_LOCK_FREE : e_READ_LOCKED;
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 float
 StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::loadFactor() const
 {
     return static_cast<float>(d_numElements.loadRelaxed()) /
-           static_cast<float>(d_numBuckets);
+           static_cast<float>(bucketCount());
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
@@ -2698,6 +3954,14 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::maxLoadFactor() const
     return d_maxLoadFactor;
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::RehashPolicy
+StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::rehashPolicy() const
+{
+    return static_cast<RehashPolicy>(d_rehashPolicy.loadRelaxed());
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 bsl::size_t
@@ -2714,6 +3978,108 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::size() const
     return d_numElements.loadRelaxed();
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::visitReadOnly(
+                                  const ReadOnlyVisitorFunction& visitor) const
+{
+    int count = 0;
+
+    if (0 <= d_numStripesToMigrate.loadRelaxed()) {
+        // See 'getValue'.
+
+        const_cast<StripedUnorderedContainerImpl *>(this)->assistRehash();
+    }
+
+    if (!d_epochManager_p) {
+        // Main loop on stripes: lock a stripe for read and process all
+        // buckets in it.
+        for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+            d_locks_p[i].lockR();
+            LERGuard guard(&d_locks_p[i]);
+            for (int t = 0; t < 2; ++t) {
+                const BucketArray& buckets = t ? d_newBuckets : d_buckets;
+                for (bsl::size_t j = i; j < buckets.size();
+                                                          j += d_numStripes) {
+                    for (const Node *curNode = buckets[j].head();
+                                 curNode != NULL; curNode = curNode->next()) {
+                        ++count;
+                        if (!visitor(curNode->value(), curNode->key())) {
+                            return -count;                            // RETURN
+                        }
+                    }
+                }
+            }
+        }
+        return count;                                                 // RETURN
+    }
+
+    // No node reached below is reclaimed before 'guard' is destroyed, so the
+    // address of a node identifies its element for the whole visitation.
+    // Since a rehash moves elements only between buckets of the same stripe,
+    // a stripe whose traversal overlaps a rehash is completed under its read
+    // lock, skipping the nodes already visited.
+
+    EpochGuard               guard(d_epochManager_p);
+    bsl::vector<const Node *> visited(bslma::Default::defaultAllocator());
+
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        visited.clear();
+
+        const int sequence = d_rehashSequence.load();
+        if (0 == (sequence & 1)) {
+            const Bucket      *buckets    = d_buckets.data();
+            const bsl::size_t  numBuckets = d_numBuckets;
+            bool               isValid    =
+                                         sequence == d_rehashSequence.load();
+
+            for (bsl::size_t j = i; isValid && j < numBuckets;
+                                                          j += d_numStripes) {
+                for (const Node *curNode = buckets[j].head();
+                                 curNode != NULL; curNode = curNode->next()) {
+                    // The path to 'curNode' is valid only if no rehash
+                    // started since 'sequence' was loaded.
+
+                    if (sequence != d_rehashSequence.load()) {
+                        isValid = false;
+                        break;
+                    }
+                    ++count;
+                    visited.push_back(curNode);
+                    if (!visitor(curNode->value(), curNode->key())) {
+                        return -count;                                // RETURN
+                    }
+                }
+            }
+            if (isValid && sequence == d_rehashSequence.load()) {
+                continue;
+            }
+        }
+
+        bsl::sort(visited.begin(), visited.end());
+
+        d_locks_p[i].lockR();
+        LERGuard lockGuard(&d_locks_p[i]);
+        for (int t = 0; t < 2; ++t) {
+            const BucketArray& buckets = t ? d_newBuckets : d_buckets;
+            for (bsl::size_t j = i; j < buckets.size(); j += d_numStripes) {
+                for (const Node *curNode = buckets[j].head();
+                                 curNode != NULL; curNode = curNode->next()) {
+                    if (bsl::binary_search(visited.begin(),
+                                           visited.end(),
+                                           curNode)) {
+                        continue;
+                    }
+                    ++count;
+                    if (!visitor(curNode->value(), curNode->key())) {
+                        return -count;                                // RETURN
+                    }
+                }
+            }
+        }
+    }
+    return count;
+}
+
                                // Aspects
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
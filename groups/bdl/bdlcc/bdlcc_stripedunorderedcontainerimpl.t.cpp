@@ -124,6 +124,7 @@ using namespace bsl;
 // [10] bsl::size_t insertBulkUnique(RANDOMIT first, last);
 // [15] void maxLoadFactor(float newMaxLoadFactor);
 // [15] void rehash(bsl::size_t numBuckets);
+// [22] void rehashPolicy(RehashPolicy newRehashPolicy);
 // [12] int setComputedValueAll(const KEY& key, functor);
 // [12] int setComputedValueFirst(const KEY& key, functor);
 // [11] bsl::size_t setValueAll(const KEY& key, const VALUE& value);
@@ -145,6 +146,7 @@ using namespace bsl;
 // [15] bool isRehashEnabled() const;
 // [15] float loadFactor() const;
 // [15] float maxLoadFactor() const;
+// [22] RehashPolicy rehashPolicy() const;
 // [ 4] bsl::size_t numStripes() const;
 // [ 4] bsl::size_t size() const;
 //
@@ -155,6 +157,7 @@ using namespace bsl;
 // [19] LOCKING TEST UTIL
 // [20] LOCKING
 // [21] MULTI-THREADED STRESS TEST
+// [22] INCREMENTAL REHASH
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -1035,6 +1038,379 @@ void threadedTest1()
 
 }  // close namespace threaded
 
+namespace incremental {
+
+typedef bdlcc::StripedUnorderedContainerImpl<int, int> IntStripType;
+
+bool addKey(int *value, const int& key)
+    // Add the specified 'key' to the specified 'value', and return 'true'.
+{
+    *value += key;
+    return true;
+}
+
+struct CountElements {
+    // This functor counts the elements it visits.
+
+    // DATA
+    int *d_count_p;  // number of elements visited (held, not owned)
+
+    // ACCESSORS
+    bool operator()(int *, const int&) const
+    {
+        ++*d_count_p;
+        return true;
+    }
+
+    bool operator()(const int&, const int&) const
+        // Increment the count of this visitor, and return 'true'.
+    {
+        ++*d_count_p;
+        return true;
+    }
+};
+
+void verifyContents(const IntStripType&      X,
+                    const bsl::vector<int>&  expected,
+                    int                      line)
+    // Verify that the specified 'X' holds, for every index 'k' of the
+    // specified 'expected' whose element is not negative, exactly one element
+    // having the key 'k' and the value 'expected[k]', that the sizes of the
+    // buckets of 'X' add up to 'X.size()', and that each element is found in
+    // the bucket at 'X.bucketIndex' of its key.  Report failures with the
+    // specified 'line'.
+{
+    bsl::size_t numExpected = 0;
+    for (int k = 0; k < static_cast<int>(expected.size()); ++k) {
+        int         value = -1;
+        bsl::size_t rc    = X.getValue(&value, k);
+        if (0 > expected[k]) {
+            ASSERTV(line, k, rc, 0 == rc);
+            continue;
+        }
+        ++numExpected;
+        ASSERTV(line, k, rc, 1 == rc);
+        ASSERTV(line, k, expected[k], value, expected[k] == value);
+        ASSERTV(line, k, 0 < X.bucketSize(X.bucketIndex(k)));
+    }
+    ASSERTV(line, numExpected, X.size(), numExpected == X.size());
+
+    bsl::size_t total = 0;
+    for (bsl::size_t j = 0; j < X.bucketCount(); ++j) {
+        total += X.bucketSize(j);
+    }
+    ASSERTV(line, total, X.size(), total == X.size());
+}
+
+void testIncrementalRehash()
+    // Test the incremental rehash policy.
+{
+    // ------------------------------------------------------------------------
+    // INCREMENTAL REHASH
+    //
+    // Concerns:
+    //: 1 The default rehash policy is 'e_REHASH_BLOCKING', and 'rehashPolicy'
+    //:   sets and returns the policy.
+    //:
+    //: 2 With 'e_REHASH_INCREMENTAL', exceeding the maximum load factor
+    //:   immediately sets 'bucketCount' to the new number of buckets, while
+    //:   the elements are moved by the subsequent writes.
+    //:
+    //: 3 While the elements are being moved, every method (lookups, inserts,
+    //:   updates, visits, and erasures) behaves as if they were all in the
+    //:   new buckets, and the 'bucketSize' of each new bucket accounts for
+    //:   the elements not yet moved to it.
+    //:
+    //: 4 'rehash' completes the migration underway, and is complete on
+    //:   return.
+    //:
+    //: 5 The incremental policy can be combined with lock-free reads.
+    //:
+    //: 6 Concurrent writers and readers see every element while rehashes
+    //:   are migrated by the writers.
+    //:
+    //: 7 All memory is returned on destruction, including while a migration
+    //:   is underway.
+    //:
+    //: 8 'getValue' and 'visitReadOnly' migrate the stripes that are not
+    //:   written, so that the migration ends (and the old bucket array is
+    //:   released) without further writes.
+    //:
+    //: 9 Exceeding the maximum load factor while a migration is underway
+    //:   completes that migration and starts the next rehash.
+    //
+    // Plan:
+    //: 1 Verify the default policy, then set and verify each policy.  (C-1)
+    //:
+    //: 2 For each read policy, create a hash map with few buckets and the
+    //:   incremental policy, and apply a sequence of 'insertUnique',
+    //:   'setValueFirst', 'update', 'setComputedValueFirst', 'eraseFirst',
+    //:   and 'visit' calls, spanning several rehashes, mirrored in a
+    //:   'bsl::vector' of expected values.  After each step, verify the
+    //:   contents with 'verifyContents'.  Verify the number of buckets just
+    //:   after a rehash is triggered.  (C-2..5)
+    //:
+    //: 3 Call 'rehash' during a migration and verify the number of buckets
+    //:   and the contents.  (C-4)
+    //:
+    //: 4 Run threads inserting and updating disjoint sets of keys, and
+    //:   reading their own keys, with the incremental policy; verify the
+    //:   final contents.  (C-6)
+    //:
+    //: 5 Use a test allocator and verify that no memory is in use after each
+    //:   hash map is destroyed, one of them in the middle of a
+    //:   migration.  (C-7)
+    //:
+    //: 6 For each read policy, trigger a rehash with a single write, then
+    //:   call 'getValue' (respectively 'visitReadOnly') a few times, and
+    //:   verify, with a test allocator, that the old bucket array is
+    //:   released.  (C-8)
+    //:
+    //: 7 Trigger a rehash of a hash map having many buckets per stripe, then
+    //:   lower the maximum load factor below the load factor and verify
+    //:   that the number of buckets grows again at once.  (C-9)
+    //
+    // Testing:
+    //   void rehashPolicy(RehashPolicy newRehashPolicy);
+    //   RehashPolicy rehashPolicy() const;
+    //   INCREMENTAL REHASH
+    // ------------------------------------------------------------------------
+
+    if (verbose) cout << endl
+                      << "INCREMENTAL REHASH" << endl
+                      << "------------------" << endl;
+
+    bslma::TestAllocator supplied("supplied", veryVeryVeryVerbose);
+
+    if (verbose) cout << "\nTesting 'rehashPolicy'." << endl;
+    {
+        IntStripType mX(16, 4, &supplied);  const IntStripType& X = mX;
+
+        ASSERT(IntStripType::e_REHASH_BLOCKING    == X.rehashPolicy());
+
+        mX.rehashPolicy(IntStripType::e_REHASH_INCREMENTAL);
+        ASSERT(IntStripType::e_REHASH_INCREMENTAL == X.rehashPolicy());
+
+        mX.rehashPolicy(IntStripType::e_REHASH_BLOCKING);
+        ASSERT(IntStripType::e_REHASH_BLOCKING    == X.rehashPolicy());
+    }
+
+    if (verbose) cout << "\nMigration by the writers." << endl;
+
+    const IntStripType::ReadPolicy READ_POLICIES[] = {
+        IntStripType::e_READ_LOCKED,
+        IntStripType::e_READ_LOCK_FREE
+    };
+
+    for (int ti = 0; ti < 2; ++ti) {
+        IntStripType mX(16, 4, READ_POLICIES[ti], &supplied);
+        const IntStripType& X = mX;
+
+        mX.rehashPolicy(IntStripType::e_REHASH_INCREMENTAL);
+
+        enum { k_NUM_KEYS = 600 };
+
+        bsl::vector<int> expected(k_NUM_KEYS, -1, &supplied);
+
+        for (int k = 0; k < 16; ++k) {
+            ASSERTV(ti, k, 1 == mX.insertUnique(k, k));
+            expected[k] = k;
+        }
+        ASSERTV(ti, X.bucketCount(), 16 == X.bucketCount());
+
+        // The 17th element triggers a rehash to 32 buckets, and the 16
+        // buckets of the old array are moved by the next writes (4 buckets
+        // of the stripe locked by each write).
+
+        ASSERTV(ti, 1 == mX.insertUnique(16, 16));
+        expected[16] = 16;
+        ASSERTV(ti, X.bucketCount(), 32 == X.bucketCount());
+        verifyContents(X, expected, L_);
+
+        for (int k = 17; k < k_NUM_KEYS; ++k) {
+            ASSERTV(ti, k, 1 == mX.insertUnique(k, k));
+            expected[k] = k;
+
+            const int key = k / 2;
+            switch (k % 5) {
+              case 0: {
+                const bsl::size_t rc = mX.setValueFirst(key, 7);
+                ASSERTV(ti, k, rc, (0 <= expected[key]) == rc);
+                expected[key] = 7;
+              } break;
+              case 1: {
+                const int rc = mX.update(key, &addKey);
+                ASSERTV(ti, k, rc, (0 <= expected[key]) == rc);
+                if (0 <= expected[key]) {
+                    expected[key] += key;
+                }
+              } break;
+              case 2: {
+                const int rc = mX.setComputedValueFirst(key, &addKey);
+                ASSERTV(ti, k, rc, (0 <= expected[key]) == rc);
+                expected[key] = 0 <= expected[key] ? expected[key] + key : key;
+              } break;
+              case 3: {
+                const bsl::size_t rc = mX.eraseFirst(key);
+                ASSERTV(ti, k, rc, (0 <= expected[key]) == rc);
+                expected[key] = -1;
+              } break;
+              default: {
+                int                 count = 0;
+                const CountElements visitor = { &count };
+                ASSERTV(ti, k, static_cast<int>(X.size()) ==
+                                                           mX.visit(visitor));
+                ASSERTV(ti, k, count, static_cast<int>(X.size()) == count);
+              } break;
+            }
+            if (0 == k % 17) {
+                verifyContents(X, expected, L_);
+            }
+        }
+        verifyContents(X, expected, L_);
+        ASSERTV(ti, X.bucketCount(), X.bucketCount() >= X.size());
+
+        // 'rehash' completes the migration underway, if any, then rehashes.
+
+        const bsl::size_t numBuckets = X.bucketCount();
+        mX.rehash(numBuckets * 4);
+        ASSERTV(ti, X.bucketCount(), numBuckets * 4 == X.bucketCount());
+        verifyContents(X, expected, L_);
+
+        // Leave a migration underway: trigger a rehash, then destroy 'mX'.
+
+        mX.maxLoadFactor(X.loadFactor() / 2);
+        ASSERTV(ti, X.bucketCount(), numBuckets * 8 == X.bucketCount());
+        verifyContents(X, expected, L_);
+    }
+    ASSERTV(supplied.numBytesInUse(), 0 == supplied.numBytesInUse());
+
+    if (verbose) cout << "\nMigration by the readers." << endl;
+
+    for (int ti = 0; ti < 2; ++ti) {
+        // With lock-free reads, the old bucket array is retired to the epoch
+        // manager: verify its release with locked reads only.
+
+        IntStripType mX(16, 4, IntStripType::e_READ_LOCKED, &supplied);
+        const IntStripType& X = mX;
+
+        mX.rehashPolicy(IntStripType::e_REHASH_INCREMENTAL);
+
+        bsl::vector<int> expected(17, -1, &supplied);
+        for (int k = 0; k < 16; ++k) {
+            ASSERTV(ti, k, 1 == mX.insertUnique(k, k));
+            expected[k] = k;
+        }
+
+        // Each write moves at most 8 of the 16 old buckets.
+
+        ASSERTV(ti, 1 == mX.insertUnique(16, 16));
+        expected[16] = 16;
+        ASSERTV(ti, X.bucketCount(), 32 == X.bucketCount());
+
+        const bsls::Types::Int64 numBlocks = supplied.numBlocksInUse();
+
+        for (int i = 0; i < 4; ++i) {
+            if (ti) {
+                int                 count = 0;
+                const CountElements visitor = { &count };
+                ASSERTV(ti, i, 17 == X.visitReadOnly(visitor));
+            }
+            else {
+                int value;
+                ASSERTV(ti, i, 1 == X.getValue(&value, i));
+            }
+        }
+        ASSERTV(ti, numBlocks, supplied.numBlocksInUse(),
+                numBlocks - 1 == supplied.numBlocksInUse());
+        ASSERTV(ti, X.bucketCount(), 32 == X.bucketCount());
+        verifyContents(X, expected, L_);
+    }
+    ASSERTV(supplied.numBytesInUse(), 0 == supplied.numBytesInUse());
+
+    if (verbose) cout << "\nRehash during a migration." << endl;
+
+    for (int ti = 0; ti < 2; ++ti) {
+        IntStripType mX(1024, 4, READ_POLICIES[ti], &supplied);
+        const IntStripType& X = mX;
+
+        mX.rehashPolicy(IntStripType::e_REHASH_INCREMENTAL);
+
+        enum { k_NUM_KEYS = 1025 };
+
+        bsl::vector<int> expected(k_NUM_KEYS, -1, &supplied);
+        for (int k = 0; k < k_NUM_KEYS; ++k) {
+            ASSERTV(ti, k, 1 == mX.insertUnique(k, k));
+            expected[k] = k;
+        }
+
+        // The last write started a migration of 1024 buckets, 8 of which at
+        // most were moved.  Exceeding the maximum load factor again completes
+        // it, and starts the next rehash.
+
+        ASSERTV(ti, X.bucketCount(), 2048 == X.bucketCount());
+
+        mX.maxLoadFactor(0.25f);
+        ASSERTV(ti, X.bucketCount(), 4096 == X.bucketCount());
+        verifyContents(X, expected, L_);
+    }
+    ASSERTV(supplied.numBytesInUse(), 0 == supplied.numBytesInUse());
+
+    if (verbose) cout << "\nConcurrent writers and readers." << endl;
+    {
+        enum { k_NUM_THREADS = 4, k_NUM_ITEMS = 4096 };
+
+        typedef threaded::ThreadArg ThreadArg;
+
+        ThreadArg::StripType strip(4, 4, &supplied);
+        bsls::AtomicInt      writeCounts[k_NUM_ITEMS];  // default 0
+        bsls::AtomicInt      stop(0);
+
+        strip.rehashPolicy(ThreadArg::StripType::e_REHASH_INCREMENTAL);
+
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+        ThreadArg                 args[k_NUM_THREADS];
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ThreadArg arg = { &strip, &stop, writeCounts,
+                              k_NUM_ITEMS, i, k_NUM_THREADS };
+            args[i] = arg;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                  threaded::workerThread,
+                                                  &args[i]));
+        }
+        bslmt::ThreadUtil::microSleep(0, 1);
+        stop = 1;
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            bslmt::ThreadUtil::join(handles[i]);
+        }
+
+        for (int i = 0; i < k_NUM_ITEMS; ++i) {
+            int         value;
+            bsl::size_t rc    = strip.getValue(&value, i);
+            int         count = rc != 1 ? 0 : value;
+
+            ASSERTV(i, count, writeCounts[i], count == writeCounts[i]);
+        }
+        ASSERTV(strip.bucketCount(), 4 < strip.bucketCount());
+    }
+    ASSERTV(supplied.numBytesInUse(), 0 == supplied.numBytesInUse());
+}
+
+}  // close namespace incremental
+
+namespace bsl {
+
+// Lock-free reads require a copy-constructible 'VALUE', which C++03 cannot
+// detect: declare the non-copyable test type as such.
+
+template <>
+struct is_copy_constructible<BloombergLP::bsltf::NonCopyConstructibleTestType>
+: false_type {
+};
+
+}  // close namespace bsl
+
 // TestDriver template
 namespace {
 
@@ -8161,6 +8537,9 @@ int main(int argc, char *argv[])
     // BDE_VERIFY pragma: -TP17 These are defined in the various test functions
     switch (test) { case 0:
       // BDE_VERIFY pragma: -TP05 Defined in the various test functions
+      case 22: {
+        incremental::testIncrementalRehash();
+      } break;
       case 21: {
         threaded::threadedTest1();
       } break;
@@ -31,7 +31,9 @@ BSLS_IDENT("$Id: $")
 // elements in a map.  Alternatively, this container provides the
 // 'setComputedValue' method that allows users to change the value for a given
 // key via a user provided functor and the 'visit' method that will apply a
-// user provided functor the value of every key in the map.
+// user provided functor the value of every key in the map.  The
+// 'visitReadOnly' method applies a user provided functor to (a 'const'
+// reference to) the value of every key in the map.
 //
 // The 'bdlcc::StripedUnorderedMap' class is an *irregular* value-semantic
 // type, even if 'KEY' and 'VALUE' are VSTs.  This class does not implement
@@ -63,7 +65,7 @@ BSLS_IDENT("$Id: $")
 //  +----------------------------------------------------+--------------------+
 //  | rehash                                             | O[n]               |
 //  +----------------------------------------------------+--------------------+
-//  | visit                                              | O[n]               |
+//  | visit, visitReadOnly                               | O[n]               |
 //  +----------------------------------------------------+--------------------+
 //..
 //
@@ -111,6 +113,41 @@ BSLS_IDENT("$Id: $")
 // rehash enable flag.  Note that disabling rehash does not impact a rehash in
 // progress.
 //
+///Incremental Rehash
+/// - - - - - - - - -
+// By default ('e_REHASH_BLOCKING'), a rehash triggered by the load factor
+// moves every element before the triggering operation returns, so writers to
+// any stripe can be delayed for a time proportional to 'size()'.  With the
+// 'e_REHASH_INCREMENTAL' policy (see 'rehashPolicy'), the triggering
+// operation only allocates the new buckets, and each subsequent write moves
+// the elements of a few buckets of the stripe it locks; lookups consult the
+// old or the new buckets, depending on whether the bucket of their key was
+// already moved.  This keeps the latency of every operation low as the
+// map grows, at the cost of a load factor that may exceed
+// 'maxLoadFactor()' until the migration (which advances only with writes)
+// completes.  An explicit call to 'rehash' completes the migration.
+//
+///Lock-Free Reads
+///---------------
+// A map constructed with the 'e_READ_LOCK_FREE' read policy serves
+// 'getValue' and 'visitReadOnly' without acquiring the stripe locks, so that
+// lookups neither contend with each other on the lock of a popular stripe nor
+// wait for a writer of that stripe.  Writers continue to serialize on the
+// stripe locks, but, in this mode, replace (rather than assign) the elements
+// they modify and defer the destruction of erased elements until no reader
+// can observe them (see {'bdlcc_stripedunorderedcontainerimpl'|Lock-Free
+// Reads}).  Modifying an element, including through the visitor supplied to
+// 'update', 'setComputedValue', or 'visit', therefore costs an additional
+// allocation and a copy of the element.  The lock-free read policy is
+// intended for maps that are read far more often than they are modified:
+//..
+//  bdlcc::StripedUnorderedMap<int, bsl::string> cache(
+//                       1024,
+//                       16,
+//                       bdlcc::StripedUnorderedMap<int, bsl::string>::
+//                                                         e_READ_LOCK_FREE);
+//..
+//
 ///Usage
 ///-----
 // In this section we show intended use of this component.
@@ -399,6 +436,22 @@ class StripedUnorderedMap {
         k_DEFAULT_NUM_STRIPES  =  4  // Default number of stripes
     };
 
+    enum ReadPolicy {
+        // Enumeration of the synchronization used by 'getValue' and
+        // 'visitReadOnly' (see {Lock-Free Reads}).
+
+        e_READ_LOCKED    = Impl::e_READ_LOCKED,    // acquire the stripe lock
+        e_READ_LOCK_FREE = Impl::e_READ_LOCK_FREE  // do not acquire any lock
+    };
+
+    enum RehashPolicy {
+        // Enumeration of the ways a rehash triggered by the load factor moves
+        // the elements (see {Incremental Rehash}).
+
+        e_REHASH_BLOCKING    = Impl::e_REHASH_BLOCKING,    // all at once
+        e_REHASH_INCREMENTAL = Impl::e_REHASH_INCREMENTAL  // by the writers
+    };
+
     // PUBLIC TYPES
     typedef bsl::pair<KEY, VALUE> KVType;
         // Value type of a bulk insert entry.
@@ -414,6 +467,17 @@ class StripedUnorderedMap {
         //      // functor can change the value associated with 'key'.
         //..
 
+    typedef bsl::function<bool (const VALUE&, const KEY&)>
+                                                       ReadOnlyVisitorFunction;
+        // An alias to a function meeting the following contract:
+        //..
+        //  bool visitorFunction(const VALUE& value, const KEY& key);
+        //      // Visit the specified 'value' attribute associated with the
+        //      // specified 'key'.  Return 'true' if this function may be
+        //      // called on additional elements, and 'false' otherwise (i.e.,
+        //      // if no other elements should be visited).
+        //..
+
     // CREATORS
     explicit StripedUnorderedMap(
                    bsl::size_t       numInitialBuckets = k_DEFAULT_NUM_BUCKETS,
@@ -430,6 +494,23 @@ class StripedUnorderedMap {
         // stripes will not change after construction, but the number of
         // buckets may (unless rehashing is disabled via 'disableRehash').
 
+    StripedUnorderedMap(bsl::size_t       numInitialBuckets,
+                        bsl::size_t       numStripes,
+                        ReadPolicy        readPolicy,
+                        bslma::Allocator *basicAllocator = 0);
+        // Create an empty 'StripedUnorderedMap' object, a fully thread-safe
+        // hash map where access is partitioned into "stripes" (a group of
+        // buckets protected a reader-writer mutex), having the specified
+        // 'numInitialBuckets' and 'numStripes' as the minimum number of
+        // buckets and the (fixed) number of stripes in this map, and whose
+        // 'getValue' and 'visitReadOnly' methods are synchronized with writers
+        // as indicated by the specified 'readPolicy' (see {Lock-Free Reads}).
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The hash map has rehash enabled.  The behavior is undefined
+        // unless 'e_READ_LOCKED == readPolicy' or 'VALUE' is
+        // copy-constructible.
+
     //! ~StripedUnorderedMap() = default;
         // Destroy this hash map.
 
@@ -507,7 +588,13 @@ class StripedUnorderedMap {
         // Recreate this hash map to one having at least the specified
         // 'numBuckets'.  This operation is a no-op if *any* of the following
         // are true: 1) rehash is disabled; 2) 'numBuckets' less or equals the
-        // current number of buckets.  See {Rehash}.
+        // current number of buckets.  The rehash (and an incremental rehash
+        // underway, if any) is complete on return.  See {Rehash}.
+
+    void rehashPolicy(RehashPolicy newRehashPolicy);
+        // Set the policy of the rehashes that the load factor of this hash map
+        // triggers to the specified 'newRehashPolicy'.  A rehash underway is
+        // not affected.  See {Incremental Rehash}.
 
     int setComputedValue(const KEY&             key,
                          const VisitorFunction& visitor);
@@ -613,7 +700,9 @@ class StripedUnorderedMap {
         // Load, into the specified '*value', the value attribute of the
         // element in this hash map having the specified 'key'.  Return 1 on
         // success and 0 if 'key' does not exist in this hash map.  Note that
-        // the return value equals the number of values returned.
+        // the return value equals the number of values returned.  Also note
+        // that, if the read policy is 'e_READ_LOCK_FREE', no lock is acquired
+        // unless the lookup overlaps a rehash.
 
     HASH hashFunction() const;
         // Return (a copy of) the unary hash functor used by this hash map.
@@ -623,6 +712,10 @@ class StripedUnorderedMap {
     bool isRehashEnabled() const;
         // Return 'true' if rehash is enabled, or 'false' otherwise.
 
+    ReadPolicy readPolicy() const;
+        // Return the synchronization used by 'getValue' and 'visitReadOnly',
+        // as specified at construction.
+
     float loadFactor() const;
         // Return the current quotient of the size of this hash map and the
         // number of buckets.  Note that the load factor is a measure of
@@ -637,12 +730,36 @@ class StripedUnorderedMap {
         // increases the number of buckets and rehashes the elements of the
         // container into that larger set of buckets.  See {Rehash Control}.
 
+    RehashPolicy rehashPolicy() const;
+        // Return the policy of the rehashes that the load factor of this hash
+        // map triggers.  The default is 'e_REHASH_BLOCKING'.  See
+        // {Incremental Rehash}.
+
     bsl::size_t numStripes() const;
         // Return the number of stripes in the hash.
 
     bsl::size_t size() const;
         // Return the current number of elements in this hash map.
 
+    int visitReadOnly(const ReadOnlyVisitorFunction& visitor) const;
+        // Call the specified 'visitor' (in an unspecified order) on all
+        // elements in this hash table until each such element has been
+        // visited or until 'visitor' returns 'false'.  That is, for
+        // '(key, value)', invoke:
+        //..
+        //  bool visitor(value, key);
+        //..
+        // Return the number of elements visited or the negation of that value
+        // if visitations stopped because 'visitor' returned 'false'.
+        // 'visitor' has read-only access to each element.  Every element
+        // present in this hash map at the time 'visitReadOnly' is invoked will
+        // be visited unless it is removed before 'visitor' is called for that
+        // element.  Elements inserted during the execution of 'visitReadOnly'
+        // may or may not be visited.  The behavior is undefined if hash map
+        // manipulators are invoked from within 'visitor'.  Note that, unlike
+        // 'visit', this method holds no write lock and, if the read policy is
+        // 'e_READ_LOCK_FREE', typically no lock at all.
+
                                // Aspects
 
     bslma::Allocator *allocator() const;
@@ -670,6 +787,20 @@ StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::StripedUnorderedMap(
 {
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::StripedUnorderedMap(
+                                           bsl::size_t       numInitialBuckets,
+                                           bsl::size_t       numStripes,
+                                           ReadPolicy        readPolicy,
+                                           bslma::Allocator *basicAllocator)
+: d_imp(numInitialBuckets,
+        numStripes,
+        static_cast<typename Impl::ReadPolicy>(readPolicy),
+        basicAllocator)
+{
+}
+
 // MANIPULATORS
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
@@ -759,6 +890,15 @@ StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::rehash(bsl::size_t numBuckets)
     d_imp.rehash(numBuckets);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::rehashPolicy(
+                                                  RehashPolicy newRehashPolicy)
+{
+    d_imp.rehashPolicy(
+                 static_cast<typename Impl::RehashPolicy>(newRehashPolicy));
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 int StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::setComputedValue(
@@ -867,6 +1007,14 @@ bool StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::isRehashEnabled() const
     return d_imp.isRehashEnabled();
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::ReadPolicy
+StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::readPolicy() const
+{
+    return static_cast<ReadPolicy>(d_imp.readPolicy());
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 float StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::loadFactor() const
@@ -881,6 +1029,14 @@ float StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::maxLoadFactor() const
     return d_imp.maxLoadFactor();
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::RehashPolicy
+StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::rehashPolicy() const
+{
+    return static_cast<RehashPolicy>(d_imp.rehashPolicy());
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 bsl::size_t StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::numStripes() const
@@ -895,6 +1051,14 @@ bsl::size_t StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::size() const
     return d_imp.size();
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::visitReadOnly(
+                                  const ReadOnlyVisitorFunction& visitor) const
+{
+    return d_imp.visitReadOnly(visitor);
+}
+
                                // Aspects
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
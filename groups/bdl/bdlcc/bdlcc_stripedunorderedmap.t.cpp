@@ -45,6 +45,7 @@
 #include <bsls_atomic.h>
 #include <bsls_nameof.h>
 #include <bsls_performancehint.h>
+#include <bsls_stopwatch.h>
 #include <bsls_timeutil.h>  // 'HashPerformance'
 #include <bsls_types.h>     // 'BloombergLP::bsls::Types::Int64'
 
@@ -112,6 +113,7 @@ using namespace bsl;
 // ----------------------------------------------------------------------------
 // CREATORS
 // [ 2] StripedUnorderedMap(numInitialBuckets, numStripes, *basicAllocator);
+// [20] StripedUnorderedMap(numInitialBuckets, numStripes, readPolicy, *ba);
 // [ 2] ~StripedUnorderedMap();
 //
 // MANIPULATORS
@@ -143,19 +145,23 @@ using namespace bsl;
 // [14] float loadFactor() const;
 // [14] float maxLoadFactor() const;
 // [ 4] bsl::size_t numStripes() const;
+// [20] ReadPolicy readPolicy() const;
 // [ 4] bsl::size_t size() const;
+// [20] int visitReadOnly(const ReadOnlyVisitorFunction& visitor) const;
 //
 // [ 4] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [20] USAGE EXAMPLE
+// [21] USAGE EXAMPLE
 // [15] TYPE TRAITS
 // [18] MULTI-THREADED STRESS TEST
 // [19] DRQS 155023497: 'erase' MEMORY CORRUPTION
+// [20] CONCERN: LOCK-FREE READS
 // [-1] PERFORMANCE TEST INT->STRING
 // [-2] PERFORMANCE TEST STRING->INT64
 // [-4] READ WRITE PERFORMANCE
 // [-8] READ/WRITE PERFORMANCE TEST WITH LONG KEY
+// [-9] LOCK-FREE READ PERFORMANCE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -1939,6 +1945,149 @@ void threadedTest1()
 
 }  // close namespace threaded
 
+namespace lockFree {
+
+typedef bdlcc::StripedUnorderedMap<int, bsl::string> Obj;
+
+enum {
+    k_NUM_STABLE    =   64,  // keys '[0 .. k_NUM_STABLE)' are never erased
+    k_VALUE_LENGTH  =   40,  // length of every value (not a short string)
+    k_NUM_TRANSIENT = 2048   // keys inserted, then erased, by writers
+};
+
+bool isUniform(const bsl::string& value)
+    // Return 'true' if the specified 'value' has 'k_VALUE_LENGTH' characters
+    // that are all the same, and 'false' otherwise.
+{
+    if (k_VALUE_LENGTH != value.length()) {
+        return false;                                                 // RETURN
+    }
+    return bsl::string::npos == value.find_first_not_of(value[0]);
+}
+
+bool makeUniform(bsl::string *value, const int&)
+    // Overwrite the specified 'value' with a uniform string using the
+    // character following its current first character and return 'true'.
+{
+    char c = static_cast<char>('a' + ((*value)[0] - 'a' + 1) % 26);
+    value->assign(k_VALUE_LENGTH, c);
+    return true;
+}
+
+struct CheckVisitor {
+    // Functor counting the stable keys visited and the non-uniform values.
+
+    int *d_numStable_p;
+    int *d_numBad_p;
+
+    bool operator()(const bsl::string& value, const int& key) const
+    {
+        if (key < k_NUM_STABLE) {
+            ++*d_numStable_p;
+        }
+        if (!isUniform(value)) {
+            ++*d_numBad_p;
+        }
+        return true;
+    }
+};
+
+struct ThreadArg {
+    Obj             *d_obj_p;
+    bsls::AtomicInt *d_numWritersDone_p;
+    int              d_numWriters;
+    int              d_id;
+};
+
+extern "C" void *writerThread(void *v_arg)
+    // Repeatedly replace the values of the stable keys, and insert and erase
+    // transient keys (causing rehashes) of the map in the specified 'v_arg'.
+{
+    ThreadArg *arg = static_cast<ThreadArg *>(v_arg);
+    Obj&       mX  = *arg->d_obj_p;
+
+    for (int round = 0; round < 4; ++round) {
+        for (int i = arg->d_id; i < k_NUM_TRANSIENT; i += arg->d_numWriters) {
+            const int key = k_NUM_STABLE + i;
+            mX.insert(key, bsl::string(k_VALUE_LENGTH, 'x'));
+
+            const int stableKey = i % k_NUM_STABLE;
+            if (i & 1) {
+                mX.setValue(stableKey,
+                            bsl::string(k_VALUE_LENGTH,
+                                        static_cast<char>('a' + i % 26)));
+            }
+            else {
+                mX.update(stableKey, &makeUniform);
+            }
+        }
+        for (int i = arg->d_id; i < k_NUM_TRANSIENT; i += arg->d_numWriters) {
+            ASSERTV(i, 1 == mX.erase(k_NUM_STABLE + i));
+        }
+    }
+    ++*arg->d_numWritersDone_p;
+    return 0;
+}
+
+extern "C" void *readerThread(void *v_arg)
+    // Until every writer is done, look up the stable keys, and visit the map
+    // in the specified 'v_arg', verifying that each stable key is found, once,
+    // with a uniform value.
+{
+    ThreadArg *arg = static_cast<ThreadArg *>(v_arg);
+    const Obj& X   = *arg->d_obj_p;
+
+    bsl::string value;
+    int         iteration = 0;
+    do {
+        for (int key = 0; key < k_NUM_STABLE; ++key) {
+            ASSERTV(key, 1 == X.getValue(&value, key));
+            ASSERTV(key, value, isUniform(value));
+        }
+        if (0 == ++iteration % 8) {
+            int          numStable = 0;
+            int          numBad    = 0;
+            CheckVisitor visitor   = { &numStable, &numBad };
+
+            X.visitReadOnly(visitor);
+
+            ASSERTV(numStable, k_NUM_STABLE == numStable);
+            ASSERTV(numBad,    0            == numBad);
+        }
+        bslmt::ThreadUtil::yield();
+    } while (*arg->d_numWritersDone_p < arg->d_numWriters);
+    return 0;
+}
+
+class NonCopyable {
+    // This class has no copy constructor, and cannot be the 'VALUE' of a map
+    // having lock-free reads.
+
+    // DATA
+    int d_value;
+
+    // NOT IMPLEMENTED
+    NonCopyable(const NonCopyable&);
+    NonCopyable& operator=(const NonCopyable&);
+
+  public:
+    // CREATORS
+    NonCopyable() : d_value(0) {}
+        // Create a 'NonCopyable' object.
+};
+
+typedef bdlcc::StripedUnorderedMap<int, NonCopyable> NonCopyableObj;
+
+}  // close namespace lockFree
+
+namespace bsl {
+
+template <>
+struct is_copy_constructible<lockFree::NonCopyable> : false_type {
+};
+
+}  // close namespace bsl
+
 // TestDriver template
 namespace {
 
@@ -6116,7 +6265,7 @@ int main(int argc, char *argv[])
 
     // BDE_VERIFY pragma: -TP17 These are defined in the various test functions
     switch (test) { case 0:
-      case 20: {
+      case 21: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -6139,6 +6288,228 @@ int main(int argc, char *argv[])
         usage::example3();
 
       } break;
+      case 20: {
+        // --------------------------------------------------------------------
+        // CONCERN: LOCK-FREE READS
+        //
+        // Concerns:
+        //: 1 'readPolicy' returns the policy supplied at construction, and
+        //:   'e_READ_LOCKED' by default.
+        //:
+        //: 2 Under either policy, the manipulators and 'getValue' produce the
+        //:   same results, and 'visitReadOnly' visits each element once.
+        //:
+        //: 3 Under 'e_READ_LOCK_FREE', erased and replaced elements are
+        //:   reclaimed while the map is in use, and all memory is returned on
+        //:   destruction.
+        //:
+        //: 4 Under 'e_READ_LOCK_FREE', readers concurrent with writers (and
+        //:   with rehashes) always find an element that is never erased,
+        //:   never observe a partially written value, and 'visitReadOnly'
+        //:   visits every such element exactly once.
+        //:
+        //: 5 'e_READ_LOCK_FREE' is rejected on construction for a 'VALUE'
+        //:   that is not copy-constructible.
+        //
+        // Plan:
+        //: 1 Create maps with each policy and verify 'readPolicy'.  (C-1)
+        //:
+        //: 2 Apply the same sequence of operations to a map of each policy,
+        //:   spanning several rehashes, and compare the results.  (C-2)
+        //:
+        //: 3 Replace and erase many elements of a lock-free map, and verify
+        //:   that the number of blocks in use stays within the bound implied
+        //:   by batched retirement (fewer than 70 unreachable elements, of 2
+        //:   blocks each, for 4 stripes) of its value for the populated map;
+        //:   verify that the test allocator reports no memory in use after
+        //:   destruction.  (C-3)
+        //:
+        //: 4 Run writer threads that replace the values of a set of stable
+        //:   keys (through 'setValue' and 'update') while inserting and
+        //:   erasing enough transient keys to force rehashes, and reader
+        //:   threads that repeatedly call 'getValue' on the stable keys and
+        //:   'visitReadOnly', checking each value observed.  (C-4)
+        //:
+        //: 5 Verify that, in appropriate build modes, constructing a map of
+        //:   a non-copyable 'VALUE' with 'e_READ_LOCK_FREE' is detected.
+        //:   (C-5)
+        //
+        // Testing:
+        //   StripedUnorderedMap(numBuckets, numStripes, readPolicy, *ba);
+        //   ReadPolicy readPolicy() const;
+        //   int visitReadOnly(const ReadOnlyVisitorFunction& visitor) const;
+        //   CONCERN: LOCK-FREE READS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "CONCERN: LOCK-FREE READS\n"
+                          << "========================\n";
+
+        using namespace lockFree;
+
+        bslma::TestAllocator supplied("supplied", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\nTesting 'readPolicy'." << endl;
+        {
+            Obj mA(16, 4, &supplied);
+            Obj mB(16, 4, Obj::e_READ_LOCKED, &supplied);
+            Obj mC(16, 4, Obj::e_READ_LOCK_FREE, &supplied);
+
+            ASSERT(Obj::e_READ_LOCKED    == mA.readPolicy());
+            ASSERT(Obj::e_READ_LOCKED    == mB.readPolicy());
+            ASSERT(Obj::e_READ_LOCK_FREE == mC.readPolicy());
+            ASSERT(&supplied == mC.allocator());
+        }
+        ASSERTV(supplied.numBytesInUse(), 0 == supplied.numBytesInUse());
+
+        if (verbose) cout << "\nNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_OPT_PASS_RAW((NonCopyableObj(
+                                            16,
+                                            4,
+                                            NonCopyableObj::e_READ_LOCKED,
+                                            &supplied)));
+            ASSERT_OPT_FAIL_RAW((NonCopyableObj(
+                                            16,
+                                            4,
+                                            NonCopyableObj::e_READ_LOCK_FREE,
+                                            &supplied)));
+        }
+        ASSERTV(supplied.numBytesInUse(), 0 == supplied.numBytesInUse());
+
+        if (verbose) cout << "\nComparing both policies." << endl;
+        {
+            Obj mL(2, 2, Obj::e_READ_LOCKED,    &supplied);
+            Obj mF(2, 2, Obj::e_READ_LOCK_FREE, &supplied);
+
+            Obj *objs[] = { &mL, &mF };
+
+            for (int k = 0; k < 2; ++k) {
+                Obj& mX = *objs[k];
+
+                for (int i = 0; i < 500; ++i) {
+                    ASSERTV(k, i, 1 == mX.insert(i, bsl::string(40, 'a')));
+                }
+                for (int i = 0; i < 500; i += 2) {
+                    ASSERTV(k, i, 1 == mX.setValue(i,
+                                                   bsl::string(40, 'b')));
+                }
+                for (int i = 0; i < 500; i += 3) {
+                    ASSERTV(k, i, 1 == mX.update(i, &makeUniform));
+                }
+                for (int i = 0; i < 500; i += 5) {
+                    ASSERTV(k, i, 1 == mX.setComputedValue(i, &makeUniform));
+                }
+                for (int i = 0; i < 500; i += 7) {
+                    ASSERTV(k, i, 1 == mX.erase(i));
+                }
+                ASSERTV(k, 1 == mX.insert(7, bsl::string(40, 'z')));
+                ASSERTV(k, 0 == mX.insert(7, bsl::string(40, 'y')));
+                ASSERTV(k, 429 == mX.size());
+                ASSERTV(k, 429 == mX.visit(&makeUniform));
+
+                ASSERTV(k, mX.bucketCount(), 512 <= mX.bucketCount());
+            }
+
+            ASSERTV(mL.size(), mF.size(), mL.size() == mF.size());
+
+            for (int i = -1; i < 501; ++i) {
+                bsl::string vL, vF;
+                bsl::size_t rcL = mL.getValue(&vL, i);
+                bsl::size_t rcF = mF.getValue(&vF, i);
+                ASSERTV(i, rcL, rcF, rcL == rcF);
+                ASSERTV(i, vL, vF, vL == vF);
+            }
+
+            for (int k = 0; k < 2; ++k) {
+                int          numStable = 0;
+                int          numBad    = 0;
+                CheckVisitor visitor   = { &numStable, &numBad };
+
+                const int numVisited = objs[k]->visitReadOnly(visitor);
+                ASSERTV(k, numVisited,
+                        static_cast<int>(objs[k]->size()) == numVisited);
+                ASSERTV(k, numStable, 55 == numStable);
+                ASSERTV(k, numBad,     0 == numBad);
+            }
+        }
+        ASSERTV(supplied.numBytesInUse(), 0 == supplied.numBytesInUse());
+
+        if (verbose) cout << "\nTesting reclamation." << endl;
+        {
+            Obj mX(1024, 4, Obj::e_READ_LOCK_FREE, &supplied);
+
+            bsl::string value;
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(i, bsl::string(40, 'a'));
+            }
+            mX.getValue(&value, 0);  // allocate the thread's epoch slot
+
+            for (int i = 0; i < 100; ++i) {
+                mX.setValue(i, bsl::string(40, 'b'));
+                mX.update(i, &makeUniform);
+            }
+            const bsls::Types::Int64 numBlocks = supplied.numBlocksInUse();
+
+            for (int round = 0; round < 10; ++round) {
+                for (int i = 0; i < 100; ++i) {
+                    mX.setValue(i, bsl::string(40, 'c'));
+                }
+            }
+            ASSERTV(numBlocks, supplied.numBlocksInUse(),
+                    numBlocks + 2 * 70 >= supplied.numBlocksInUse());
+
+            mX.clear();
+            ASSERTV(numBlocks, supplied.numBlocksInUse(),
+                    numBlocks - 200 + 2 >= supplied.numBlocksInUse());
+        }
+        ASSERTV(supplied.numBytesInUse(), 0 == supplied.numBytesInUse());
+
+        if (verbose) cout << "\nConcurrent readers and writers." << endl;
+        {
+            enum { k_NUM_READERS = 2, k_NUM_WRITERS = 2 };
+
+            Obj             mX(4, 4, Obj::e_READ_LOCK_FREE, &supplied);
+            bsls::AtomicInt numWritersDone(0);
+
+            for (int i = 0; i < k_NUM_STABLE; ++i) {
+                mX.insert(i, bsl::string(k_VALUE_LENGTH, 'a'));
+            }
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_READERS + k_NUM_WRITERS];
+            ThreadArg                 args[k_NUM_READERS + k_NUM_WRITERS];
+
+            for (int i = 0; i < k_NUM_READERS + k_NUM_WRITERS; ++i) {
+                ThreadArg arg = { &mX, &numWritersDone, k_NUM_WRITERS, i };
+                args[i] = arg;
+            }
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      readerThread,
+                                                      &args[i]));
+            }
+            for (int i = 0; i < k_NUM_WRITERS; ++i) {
+                args[k_NUM_READERS + i].d_id = i;
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                                 &handles[k_NUM_READERS + i],
+                                                 writerThread,
+                                                 &args[k_NUM_READERS + i]));
+            }
+            for (int i = 0; i < k_NUM_READERS + k_NUM_WRITERS; ++i) {
+                bslmt::ThreadUtil::join(handles[i]);
+            }
+
+            ASSERTV(mX.size(), k_NUM_STABLE == mX.size());
+            ASSERTV(mX.bucketCount(),
+                    k_NUM_TRANSIENT <= mX.bucketCount());
+
+            if (verbose) {
+                P_(mX.bucketCount()); P(supplied.numBlocksInUse());
+            }
+        }
+        ASSERTV(supplied.numBytesInUse(), 0 == supplied.numBytesInUse());
+      } break;
       case 19: {
         // --------------------------------------------------------------------
         // DRQS 155023497: 'erase' MEMORY CORRUPTION
@@ -6862,6 +7233,102 @@ int main(int argc, char *argv[])
         hp.runTests(&times, args, hashPerf::HashPerformance::testReadWrite2);
         hp.printResult();
       } break;
+      case -9: {
+        // --------------------------------------------------------------------
+        // LOCK-FREE READ PERFORMANCE
+        //   Compare the cost of 'getValue' under each read policy, with one
+        //   writer thread replacing values concurrently.  Command line
+        //   parameters:
+        //   2nd parameter: number of reader threads.
+        //   3rd parameter: number of lookups per reader thread.
+        //   4th parameter: number of elements (and number of buckets).
+        //
+        // Concerns:
+        //: 1 Report the time per 'getValue' call for each read policy.
+        //
+        // Plan:
+        //: 1 For each policy, populate a map, then time reader threads that
+        //:   look up every key in turn, while a writer thread repeatedly calls
+        //:   'setValue' until the readers are done.  (C-1)
+        //
+        // Testing:
+        //   LOCK-FREE READ PERFORMANCE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "LOCK-FREE READ PERFORMANCE\n"
+                          << "==========================\n";
+
+        typedef bdlcc::StripedUnorderedMap<int, int> IntMap;
+
+        struct Local {
+            static void reader(const IntMap *map, int numElements, int numOps)
+            {
+                int value;
+                for (int i = 0; i < numOps; ++i) {
+                    map->getValue(&value, i % numElements);
+                }
+            }
+
+            static void writer(IntMap          *map,
+                               int              numElements,
+                               bsls::AtomicInt *done)
+            {
+                for (int i = 0; !*done; ++i) {
+                    map->setValue(i % numElements, i);
+                }
+            }
+        };
+
+        const int numReaders  = argc > 2 ? atoi(argv[2]) : 2;
+        const int numOps      = argc > 3 ? atoi(argv[3]) : 1000000;
+        const int numElements = argc > 4 ? atoi(argv[4]) : 4096;
+
+        const IntMap::ReadPolicy POLICIES[] = { IntMap::e_READ_LOCKED,
+                                                IntMap::e_READ_LOCK_FREE };
+        const char *NAMES[] = { "locked", "lock-free" };
+
+        for (int p = 0; p < 2; ++p) {
+            IntMap mX(numElements, 16, POLICIES[p]);
+            for (int i = 0; i < numElements; ++i) {
+                mX.insert(i, i);
+            }
+
+            bsls::AtomicInt          done(0);
+            bslmt::ThreadUtil::Handle writerHandle;
+            bsl::vector<bslmt::ThreadUtil::Handle> readerHandles(numReaders);
+
+            bsls::Stopwatch stopwatch;
+            stopwatch.start();
+
+            ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(
+                      &writerHandle,
+                      bdlf::BindUtil::bind(&Local::writer,
+                                           &mX,
+                                           numElements,
+                                           &done),
+                      bslma::Default::globalAllocator()));
+            for (int i = 0; i < numReaders; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(
+                          &readerHandles[i],
+                          bdlf::BindUtil::bind(&Local::reader,
+                                               &mX,
+                                               numElements,
+                                               numOps),
+                          bslma::Default::globalAllocator()));
+            }
+            for (int i = 0; i < numReaders; ++i) {
+                bslmt::ThreadUtil::join(readerHandles[i]);
+            }
+            stopwatch.stop();
+            done = 1;
+            bslmt::ThreadUtil::join(writerHandle);
+
+            const double totalOps = static_cast<double>(numReaders) * numOps;
+            cout << NAMES[p] << ": "
+                 << stopwatch.elapsedTime() * 1e9 / totalOps
+                 << " ns per getValue\n";
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -116,6 +116,20 @@ BSLS_IDENT("$Id: $")
 // rehash enable flag.  Note that disabling rehash does not impact a rehash in
 // progress.
 //
+///Incremental Rehash
+/// - - - - - - - - -
+// By default ('e_REHASH_BLOCKING'), a rehash triggered by the load factor
+// moves every element before the triggering operation returns, so writers to
+// any stripe can be delayed for a time proportional to 'size()'.  With the
+// 'e_REHASH_INCREMENTAL' policy (see 'rehashPolicy'), the triggering
+// operation only allocates the new buckets, and each subsequent write moves
+// the elements of a few buckets of the stripe it locks; lookups consult the
+// old or the new buckets, depending on whether the bucket of their key was
+// already moved.  This keeps the latency of every operation low as the
+// multimap grows, at the cost of a load factor that may exceed
+// 'maxLoadFactor()' until the migration (which advances only with writes)
+// completes.  An explicit call to 'rehash' completes the migration.
+//
 ///Usage
 ///-----
 // In this section we show intended use of this component.
@@ -247,6 +261,14 @@ class StripedUnorderedMultiMap {
         k_DEFAULT_NUM_STRIPES  =  4  // Default number of stripes
     };
 
+    enum RehashPolicy {
+        // Enumeration of the ways a rehash triggered by the load factor moves
+        // the elements (see {Incremental Rehash}).
+
+        e_REHASH_BLOCKING    = Impl::e_REHASH_BLOCKING,    // all at once
+        e_REHASH_INCREMENTAL = Impl::e_REHASH_INCREMENTAL  // by the writers
+    };
+
     // PUBLIC TYPES
     typedef bsl::pair<KEY, VALUE> KVType;
         // Value type of a bulk insert entry.
@@ -352,7 +374,13 @@ class StripedUnorderedMultiMap {
         // Recreate this hash map to one having at least the specified
         // 'numBuckets'.  This operation is a no-op if *any* of the following
         // are true: 1) rehash is disabled; 2) 'numBuckets' less or equals the
-        // current number of buckets.  See {Rehash}.
+        // current number of buckets.  The rehash (and an incremental rehash
+        // underway, if any) is complete on return.  See {Rehash}.
+
+    void rehashPolicy(RehashPolicy newRehashPolicy);
+        // Set the policy of the rehashes that the load factor of this hash map
+        // triggers to the specified 'newRehashPolicy'.  A rehash underway is
+        // not affected.  See {Incremental Rehash}.
 
     int setComputedValueAll(const KEY&             key,
                             const VisitorFunction& visitor);
@@ -528,6 +556,11 @@ class StripedUnorderedMultiMap {
         // increases the number of buckets and rehashes the elements of the
         // container into that larger set of buckets.  See {Rehash Control}.
 
+    RehashPolicy rehashPolicy() const;
+        // Return the policy of the rehashes that the load factor of this hash
+        // map triggers.  The default is 'e_REHASH_BLOCKING'.  See
+        // {Incremental Rehash}.
+
     bsl::size_t numStripes() const;
         // Return the number of stripes in the hash.
 
@@ -659,6 +692,15 @@ void StripedUnorderedMultiMap<KEY, VALUE, HASH, EQUAL>::rehash(
     d_imp.rehash(numBuckets);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedUnorderedMultiMap<KEY, VALUE, HASH, EQUAL>::rehashPolicy(
+                                                  RehashPolicy newRehashPolicy)
+{
+    d_imp.rehashPolicy(
+                 static_cast<typename Impl::RehashPolicy>(newRehashPolicy));
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 int
@@ -812,6 +854,14 @@ StripedUnorderedMultiMap<KEY, VALUE, HASH, EQUAL>::maxLoadFactor() const
     return d_imp.maxLoadFactor();
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename StripedUnorderedMultiMap<KEY, VALUE, HASH, EQUAL>::RehashPolicy
+StripedUnorderedMultiMap<KEY, VALUE, HASH, EQUAL>::rehashPolicy() const
+{
+    return static_cast<RehashPolicy>(d_imp.rehashPolicy());
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 bsl::size_t StripedUnorderedMultiMap<KEY, VALUE, HASH, EQUAL>::numStripes()
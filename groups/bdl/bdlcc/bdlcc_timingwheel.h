@@ -0,0 +1,1137 @@
+// bdlcc_timingwheel.h                                                -*-C++-*-
+#ifndef INCLUDED_BDLCC_TIMINGWHEEL
+#define INCLUDED_BDLCC_TIMINGWHEEL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a thread-safe hierarchical timing wheel of timed values.
+//
+//@CLASSES:
+//  bdlcc::TimingWheel:           thread-safe container of timed values
+//  bdlcc::TimingWheelPair:       type for opaque pointers
+//  bdlcc::TimingWheelPairHandle: scope mechanism for safe item references
+//
+//@SEE_ALSO: bdlcc_skiplist, bdlmt_eventscheduler
+//
+//@DESCRIPTION: This component provides a thread-safe container,
+// 'bdlcc::TimingWheel', that associates objects of a parameterized 'DATA' type
+// with integral time values (e.g., a number of microseconds since an epoch),
+// and that, as time advances, releases the values whose time has been reached
+// in increasing time order.  Adding, removing, and changing the time of a
+// value are constant-time operations, regardless of the number of values in
+// the container, which makes 'bdlcc::TimingWheel' well-suited to the
+// management of large numbers of timeouts, most of which are canceled before
+// their time is reached.
+//
+// The interface of 'bdlcc::TimingWheel' follows that of 'bdlcc::SkipList':
+// associations (pairs) in the wheel are identified by
+// 'bdlcc::TimingWheelPairHandle' objects or by reference-counted
+// 'bdlcc::TimingWheelPair' pointers, which are used following the rules
+// described in "'bdlcc::SkipListPair' Usage Rules" in 'bdlcc_skiplist'.
+// Unlike a skip list, however, a timing wheel is not a general ordered
+// container: only the pairs whose time has been reached (i.e., is not after
+// the current time of the wheel) are accessible in order, using 'frontRaw' and
+// 'popFrontRaw'.
+//
+///Structure
+///---------
+// A timing wheel has a *current* *time*, initially 0, which is moved forward
+// by 'advance'.  A pair whose time is not after the current time is *due*, and
+// is held in a list ordered by time (and, for equal times, by the order in
+// which the pairs were added or became due).  The other pairs are held in a
+// hierarchy of 'k_NUM_LEVELS' arrays of 'k_NUM_SLOTS' slots, where each slot
+// is a (doubly-linked, and therefore unordered) list of pairs.  The slots of
+// the lowest level each hold the pairs of a single time value, and each slot
+// of a higher level covers the time range of all the slots of the level
+// below.  A pair is added to the lowest level whose range, relative to the
+// current time, includes its time; as the current time advances into the
+// range of a slot of a higher level, the pairs of that slot are redistributed
+// ("cascaded") to the lower levels.  The slots holding pairs are tracked in a
+// bit mask per level, so that advancing the current time over empty slots
+// costs nothing.
+//
+// Each pair is cascaded at most once per level before becoming due, and 'add',
+// 'remove', and 'update' access a single slot; all of these operations are
+// therefore performed in constant time.  Note that a pair that is removed
+// before its time is reached, which is the common case for timeouts, is
+// usually never cascaded at all.
+//
+///Thread Safety
+///-------------
+// 'bdlcc::TimingWheel' is thread-safe and thread-aware; that is, multiple
+// threads may use their own timing wheel objects or may concurrently use the
+// same object.  The state of a timing wheel is protected by a mutex; each
+// operation holds it for a constant time (except for 'removeAll', and for
+// 'advance', which holds it for a time proportional to the number of pairs
+// that become due).
+//
+// 'bdlcc::TimingWheelPairHandle' is only *const* *thread-safe*.  It is not
+// safe for multiple threads to invoke non-'const' methods on the same
+// 'PairHandle' object concurrently.
+//
+// 'bdlcc::TimingWheelPair' is a name used for opaque pointers; the concept of
+// thread safety does not apply to it.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Managing Connection Timeouts
+///- - - - - - - - - - - - - - - - - - - -
+// In this example we manage the timeouts of a set of connections.  A timeout
+// is armed for each connection when it is opened, and is rearmed each time
+// data is received on the connection; a connection that does not receive data
+// before its timeout expires is closed.
+//
+// First, we create a timing wheel whose times are numbers of milliseconds,
+// and bring it to the current time, 1000:
+//..
+//  bdlcc::TimingWheel<int> timeouts;
+//  timeouts.advance(1000);
+//..
+// Then, we open three connections, identified by the integers 1, 2, and 3,
+// each with a timeout of 500 milliseconds:
+//..
+//  bdlcc::TimingWheel<int>::PairHandle timeout[4];
+//  for (int connection = 1; connection <= 3; ++connection) {
+//      timeouts.add(&timeout[connection], 1500, connection);
+//  }
+//  assert(3 == timeouts.length());
+//..
+// Next, data is received on connection 2 at time 1200, so we rearm its
+// timeout, and connection 3 is closed by its peer, so we cancel its timeout:
+//..
+//  int rc = timeouts.update(timeout[2], 1700);
+//  assert(0 == rc);
+//
+//  rc = timeouts.remove(timeout[3]);
+//  assert(0 == rc);
+//  timeout[3].release();
+//..
+// Now, at time 1600, we advance the wheel and close the connections whose
+// timeout has expired; only connection 1 is closed:
+//..
+//  timeouts.advance(1600);
+//
+//  bdlcc::TimingWheel<int>::Pair *expired;
+//  while (0 == timeouts.popFrontRaw(&expired)) {
+//      assert(1 == expired->data());
+//      timeouts.releaseReferenceRaw(expired);
+//  }
+//..
+// Finally, we verify that the timeout of connection 2 is still pending, and
+// that 'nextTime' reports (a lower bound of) its time:
+//..
+//  assert(1 == timeouts.length());
+//
+//  bsls::Types::Int64 nextTime;
+//  rc = timeouts.nextTime(&nextTime);
+//  assert(0    == rc);
+//  assert(1600 <  nextTime && nextTime <= 1700);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bdlma_concurrentpool.h>
+
+#include <bslalg_constructorproxy.h>
+
+#include <bslma_allocator.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_new.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+template <class DATA>
+class TimingWheel;
+
+                        // =======================
+                        // struct TimingWheel_Link
+                        // =======================
+
+struct TimingWheel_Link {
+    // This component-private structure provides the links of a node in a
+    // circular, doubly-linked list; the sentinel of each list is a
+    // 'TimingWheel_Link' that is not part of a node.
+
+    // PUBLIC DATA
+    TimingWheel_Link *d_next_p;  // next link in the list
+    TimingWheel_Link *d_prev_p;  // previous link in the list
+};
+
+                        // =======================
+                        // struct TimingWheel_Node
+                        // =======================
+
+template <class DATA>
+struct TimingWheel_Node : TimingWheel_Link {
+    // This component-private structure is a node of a 'TimingWheel'.
+
+    // PUBLIC DATA
+    bsls::AtomicInt                 d_refCount;  // number of references,
+                                                 // including one held by the
+                                                 // wheel while the node is in
+                                                 // it
+
+    int                             d_location;  // index of the list holding
+                                                 // the node, or one of the
+                                                 // special values defined by
+                                                 // 'TimingWheel'
+
+    bsls::Types::Int64              d_key;       // time of the node
+
+    bslalg::ConstructorProxy<DATA>  d_data;      // value of the node
+
+    // CREATORS
+    TimingWheel_Node(bsls::Types::Int64  key,
+                     const DATA&         data,
+                     bslma::Allocator   *basicAllocator);
+        // Create a node having the specified 'key' and 'data', and a
+        // reference count of 1, using the specified 'basicAllocator' to
+        // supply memory to 'data'.
+};
+
+                           // =====================
+                           // class TimingWheelPair
+                           // =====================
+
+template <class DATA>
+class TimingWheelPair {
+    // Pointers to objects of this class are used in the "raw" API of
+    // 'TimingWheel'; objects of the class are never constructed, as the class
+    // serves only to provide type-safe pointers to the nodes of a wheel.
+
+    // DATA
+    TimingWheel_Node<DATA> d_node;  // never directly accessed
+
+  private:
+    // NOT IMPLEMENTED
+    TimingWheelPair();
+    TimingWheelPair(const TimingWheelPair&);
+    TimingWheelPair& operator=(const TimingWheelPair&);
+
+  public:
+    // ACCESSORS
+    DATA& data() const;
+        // Return a reference to the modifiable "data" of this pair.
+
+    const bsls::Types::Int64& key() const;
+        // Return a reference to the non-modifiable time of this pair.  Note
+        // that the time of a pair is modified by 'TimingWheel::update'.
+};
+
+                        // ===========================
+                        // class TimingWheelPairHandle
+                        // ===========================
+
+template <class DATA>
+class TimingWheelPairHandle {
+    // Objects of this class refer to a pair in a 'TimingWheel'.  A
+    // 'TimingWheelPairHandle' is implicitly convertible to a 'const Pair*' and
+    // thus may be used anywhere in the 'TimingWheel' API that a 'const Pair*'
+    // is expected.
+
+    // PRIVATE TYPES
+    typedef TimingWheelPair<DATA> Pair;
+
+    // DATA
+    TimingWheel<DATA> *d_wheel_p;  // wheel holding '*d_pair_p' (held)
+    Pair              *d_pair_p;   // referenced pair, or 0 (owned reference)
+
+    // FRIENDS
+    friend class TimingWheel<DATA>;
+
+    // PRIVATE MANIPULATORS
+    void reset(const TimingWheel<DATA> *wheel, Pair *reference);
+        // Release the reference managed by this handle, if any, then make this
+        // handle manage the specified 'reference' to a pair of the specified
+        // 'wheel'.  Note that the calling scope is assumed to own
+        // 'reference'.
+
+  public:
+    // CREATORS
+    TimingWheelPairHandle();
+        // Create a handle that does not refer to a pair.
+
+    TimingWheelPairHandle(const TimingWheelPairHandle& original);
+        // Create a handle referring to the same pair as the specified
+        // 'original', and acquire a new reference to that pair.
+
+    ~TimingWheelPairHandle();
+        // Release the reference managed by this handle, if any, and destroy
+        // this object.
+
+    // MANIPULATORS
+    TimingWheelPairHandle& operator=(const TimingWheelPairHandle& rhs);
+        // Release the reference managed by this handle, if any, then make this
+        // handle refer to the same pair as the specified 'rhs' (acquiring a
+        // new reference to it).  Return a reference providing modifiable
+        // access to this handle.
+
+    void release();
+        // Release the reference managed by this handle, if any.
+
+    // ACCESSORS
+    operator const Pair*() const;
+        // Return the address of the pair referred to by this handle, or 0 if
+        // this handle does not manage a reference.
+
+    DATA& data() const;
+        // Return a reference to the "data" of the pair referred to by this
+        // handle.  The behavior is undefined unless 'isValid()'.
+
+    const bsls::Types::Int64& key() const;
+        // Return a reference to the non-modifiable time of the pair referred
+        // to by this handle.  The behavior is undefined unless 'isValid()'.
+
+    bool isValid() const;
+        // Return 'true' if this handle refers to a pair, and 'false'
+        // otherwise.
+};
+
+                             // =================
+                             // class TimingWheel
+                             // =================
+
+template <class DATA>
+class TimingWheel {
+    // This class provides a thread-safe container of values associated with
+    // integral times, supporting constant-time insertion, removal, and
+    // rescheduling, and the retrieval, in time order, of the values whose
+    // time has been reached.
+
+  public:
+    // CONSTANTS
+    enum {
+        e_SUCCESS   = 0,
+        e_NOT_FOUND = 1,
+        e_INVALID   = 3   // same value as 'SkipList::e_INVALID'
+    };
+
+    enum {
+        k_BITS_PER_LEVEL = 6,                      // bits of time per level
+
+        k_NUM_SLOTS      = 1 << k_BITS_PER_LEVEL,  // slots per level
+
+        k_NUM_LEVELS     = (64 + k_BITS_PER_LEVEL - 1) / k_BITS_PER_LEVEL
+                                                   // levels needed to cover
+                                                   // all 64-bit times
+    };
+
+    // TYPES
+    typedef TimingWheelPair<DATA>       Pair;
+    typedef TimingWheelPairHandle<DATA> PairHandle;
+
+  private:
+    // PRIVATE CONSTANTS
+    enum {
+        k_NOT_IN_WHEEL = -1,  // location of a removed node
+        k_DUE          = -2   // location of a node in 'd_due'
+    };
+
+    // PRIVATE TYPES
+    typedef TimingWheel_Link       Link;
+    typedef TimingWheel_Node<DATA> Node;
+    typedef bsls::Types::Int64     Int64;
+    typedef bsls::Types::Uint64    Uint64;
+
+    // DATA
+    mutable bslmt::Mutex  d_mutex;         // protects the state below
+
+    Int64                 d_currentTime;   // current time of the wheel
+
+    Link                  d_due;           // sentinel of the list of due
+                                           // nodes, ordered by time
+
+    Link                  d_slots[k_NUM_LEVELS * k_NUM_SLOTS];
+                                           // sentinels of the slot lists
+
+    Uint64                d_occupied[k_NUM_LEVELS];
+                                           // bit 'i' of 'd_occupied[l]' is
+                                           // set if slot 'i' of level 'l' is
+                                           // not empty
+
+    int                   d_length;        // number of nodes in the wheel
+
+    bdlma::ConcurrentPool d_pool;          // supplies the nodes
+
+    bslma::Allocator     *d_allocator_p;   // memory allocator (held)
+
+    // FRIENDS
+    friend class TimingWheelPair<DATA>;
+    friend class TimingWheelPairHandle<DATA>;
+
+    // PRIVATE CLASS METHODS
+    static void append(Link *list, Link *link);
+        // Append the specified 'link' to the end of the specified 'list'.
+
+    static void unlink(Link *link);
+        // Remove the specified 'link' from the list holding it.
+
+    static Node *pairToNode(const Pair *reference);
+        // Return the node referred to by the specified 'reference'.
+
+    // PRIVATE MANIPULATORS
+    Node *allocateNode(Int64 key, const DATA& data);
+        // Return a new node having the specified 'key' and 'data', and a
+        // reference count of 1.
+
+    void insertNode(Node *node);
+        // Insert the specified 'node' into the due list if its time is not
+        // after the current time of this wheel, and into the appropriate slot
+        // otherwise.  The behavior is undefined unless 'd_mutex' is locked.
+
+    void releaseNode(Node *node);
+        // Release one reference to the specified 'node', and destroy it if
+        // this was the last one.
+
+    void removeNode(Node *node);
+        // Remove the specified 'node' from the list holding it.  The behavior
+        // is undefined unless 'd_mutex' is locked and 'node' is in this
+        // wheel.
+
+    // PRIVATE ACCESSORS
+    int findFirstOccupiedSlot(int *level) const;
+        // Load into the specified 'level' the lowest level having a non-empty
+        // slot, and return the index of the first non-empty slot of that
+        // level, or return -1, with no effect on 'level', if all the slots
+        // are empty.  The behavior is undefined unless 'd_mutex' is locked.
+
+    Int64 slotStartTime(int level, int slot) const;
+        // Return the earliest time covered by the specified 'slot' of the
+        // specified 'level', relative to the current time.  The behavior is
+        // undefined unless 'd_mutex' is locked, and 'slot' is, at 'level',
+        // not before the slot of the current time.
+
+  private:
+    // NOT IMPLEMENTED
+    TimingWheel(const TimingWheel&);
+    TimingWheel& operator=(const TimingWheel&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(TimingWheel, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit TimingWheel(bslma::Allocator *basicAllocator = 0);
+        // Create an empty timing wheel having a current time of 0.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    ~TimingWheel();
+        // Destroy this object.  The behavior is undefined unless all the
+        // references to the pairs of this wheel have been released.
+
+    // MANIPULATORS
+    void add(const Int64& key, const DATA& data);
+    void add(PairHandle *result, const Int64& key, const DATA& data);
+        // Add to this wheel the specified 'data' associated with the specified
+        // 'key' time, and load into the optionally specified 'result' a
+        // reference to the new pair.  Note that the pair is due immediately if
+        // 'key' is not after the current time of this wheel.
+
+    void addRaw(Pair **result, const Int64& key, const DATA& data);
+        // Add to this wheel the specified 'data' associated with the specified
+        // 'key' time, and, if the specified 'result' is not 0, load into it a
+        // reference to the new pair that must be released using
+        // 'releaseReferenceRaw'.
+
+    int advance(const Int64& time);
+        // Set the current time of this wheel to the specified 'time', making
+        // due the pairs whose time is not after 'time', and return the number
+        // of pairs that became due.  This method has no effect (and returns 0)
+        // if 'time' is not after the current time.
+
+    int popFrontRaw(Pair **item);
+        // Remove from this wheel the due pair having the earliest time, load
+        // into the specified 'item' a reference to it, that must be released
+        // using 'releaseReferenceRaw', and return 0; return 'e_NOT_FOUND',
+        // with no effect, if no pair is due.
+
+    void releaseReferenceRaw(const Pair *reference);
+        // Release the specified 'reference' to a pair of this wheel.
+
+    int remove(const Pair *reference);
+        // Remove from this wheel the pair referred to by the specified
+        // 'reference'.  Return 0 on success, 'e_NOT_FOUND' if the pair is not
+        // in this wheel (i.e., was already removed), and 'e_INVALID' if
+        // 'reference' is 0.  Note that 'reference' remains to be released.
+
+    int removeAll();
+        // Remove all the pairs from this wheel, and return the number of
+        // pairs removed.
+
+    int update(const Pair *reference, const Int64& newKey);
+        // Change the time of the pair referred to by the specified
+        // 'reference' to the specified 'newKey'.  Return 0 on success,
+        // 'e_NOT_FOUND' if the pair is not in this wheel, and 'e_INVALID' if
+        // 'reference' is 0.
+
+    // ACCESSORS
+    Pair *addPairReferenceRaw(const Pair *reference) const;
+        // Acquire an additional reference to the pair referred to by the
+        // specified 'reference', and return 'reference'.  The returned
+        // reference must be released using 'releaseReferenceRaw'.
+
+    Int64 currentTime() const;
+        // Return the current time of this wheel.
+
+    int frontRaw(Pair **front) const;
+        // Load into the specified 'front' a reference to the due pair having
+        // the earliest time, that must be released using
+        // 'releaseReferenceRaw', and return 0; return 'e_NOT_FOUND', with no
+        // effect, if no pair is due.
+
+    bool isEmpty() const;
+        // Return 'true' if this wheel holds no pair, and 'false' otherwise.
+
+    int length() const;
+        // Return the number of pairs in this wheel.
+
+    int nextTime(Int64 *time) const;
+        // Load into the specified 'time' the earliest time of a pair of this
+        // wheel if a pair is due, and a lower bound of that time otherwise,
+        // and return 0; return 'e_NOT_FOUND', with no effect, if this wheel is
+        // empty.  Note that the bound is the start of the time range of the
+        // first non-empty slot, so that advancing the wheel to the loaded
+        // 'time' either makes a pair due or cascades the pairs of that slot,
+        // after which a tighter bound is reported.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                        // -----------------------
+                        // struct TimingWheel_Node
+                        // -----------------------
+
+// CREATORS
+template <class DATA>
+inline
+TimingWheel_Node<DATA>::TimingWheel_Node(bsls::Types::Int64  key,
+                                         const DATA&         data,
+                                         bslma::Allocator   *basicAllocator)
+: d_refCount(1)
+, d_location(-1)
+, d_key(key)
+, d_data(data, basicAllocator)
+{
+    d_next_p = 0;
+    d_prev_p = 0;
+}
+
+                           // ---------------------
+                           // class TimingWheelPair
+                           // ---------------------
+
+// ACCESSORS
+template <class DATA>
+inline
+DATA& TimingWheelPair<DATA>::data() const
+{
+    return TimingWheel<DATA>::pairToNode(this)->d_data.object();
+}
+
+template <class DATA>
+inline
+const bsls::Types::Int64& TimingWheelPair<DATA>::key() const
+{
+    return TimingWheel<DATA>::pairToNode(this)->d_key;
+}
+
+                        // ---------------------------
+                        // class TimingWheelPairHandle
+                        // ---------------------------
+
+// PRIVATE MANIPULATORS
+template <class DATA>
+inline
+void TimingWheelPairHandle<DATA>::reset(const TimingWheel<DATA> *wheel,
+                                        Pair                    *reference)
+{
+    release();
+    d_wheel_p = const_cast<TimingWheel<DATA> *>(wheel);
+    d_pair_p  = reference;
+}
+
+// CREATORS
+template <class DATA>
+inline
+TimingWheelPairHandle<DATA>::TimingWheelPairHandle()
+: d_wheel_p(0)
+, d_pair_p(0)
+{
+}
+
+template <class DATA>
+inline
+TimingWheelPairHandle<DATA>::TimingWheelPairHandle(
+                                         const TimingWheelPairHandle& original)
+: d_wheel_p(original.d_wheel_p)
+, d_pair_p(original.d_pair_p
+           ? d_wheel_p->addPairReferenceRaw(original.d_pair_p)
+           : 0)
+{
+}
+
+template <class DATA>
+inline
+TimingWheelPairHandle<DATA>::~TimingWheelPairHandle()
+{
+    release();
+}
+
+// MANIPULATORS
+template <class DATA>
+inline
+TimingWheelPairHandle<DATA>&
+TimingWheelPairHandle<DATA>::operator=(const TimingWheelPairHandle& rhs)
+{
+    Pair *reference = rhs.d_pair_p
+                    ? rhs.d_wheel_p->addPairReferenceRaw(rhs.d_pair_p)
+                    : 0;
+    reset(rhs.d_wheel_p, reference);
+    return *this;
+}
+
+template <class DATA>
+inline
+void TimingWheelPairHandle<DATA>::release()
+{
+    if (d_pair_p) {
+        BSLS_ASSERT(0 != d_wheel_p);
+
+        d_wheel_p->releaseReferenceRaw(d_pair_p);
+        d_pair_p = 0;
+    }
+}
+
+// ACCESSORS
+template <class DATA>
+inline
+TimingWheelPairHandle<DATA>::operator const Pair*() const
+{
+    return d_pair_p;
+}
+
+template <class DATA>
+inline
+DATA& TimingWheelPairHandle<DATA>::data() const
+{
+    BSLS_ASSERT_SAFE(isValid());
+
+    return d_pair_p->data();
+}
+
+template <class DATA>
+inline
+const bsls::Types::Int64& TimingWheelPairHandle<DATA>::key() const
+{
+    BSLS_ASSERT_SAFE(isValid());
+
+    return d_pair_p->key();
+}
+
+template <class DATA>
+inline
+bool TimingWheelPairHandle<DATA>::isValid() const
+{
+    return 0 != d_pair_p;
+}
+
+                             // -----------------
+                             // class TimingWheel
+                             // -----------------
+
+// PRIVATE CLASS METHODS
+template <class DATA>
+inline
+void TimingWheel<DATA>::append(Link *list, Link *link)
+{
+    link->d_next_p           = list;
+    link->d_prev_p           = list->d_prev_p;
+    list->d_prev_p->d_next_p = link;
+    list->d_prev_p           = link;
+}
+
+template <class DATA>
+inline
+void TimingWheel<DATA>::unlink(Link *link)
+{
+    link->d_prev_p->d_next_p = link->d_next_p;
+    link->d_next_p->d_prev_p = link->d_prev_p;
+    link->d_next_p           = 0;
+    link->d_prev_p           = 0;
+}
+
+template <class DATA>
+inline
+TimingWheel_Node<DATA> *TimingWheel<DATA>::pairToNode(const Pair *reference)
+{
+    return reinterpret_cast<Node *>(const_cast<Pair *>(reference));
+}
+
+// PRIVATE MANIPULATORS
+template <class DATA>
+TimingWheel_Node<DATA> *TimingWheel<DATA>::allocateNode(Int64       key,
+                                                        const DATA& data)
+{
+    void *address = d_pool.allocate();
+    bslma::DeallocatorProctor<bdlma::ConcurrentPool> proctor(address,
+                                                             &d_pool);
+
+    Node *node = new (address) Node(key, data, d_allocator_p);
+    proctor.release();
+
+    return node;
+}
+
+template <class DATA>
+void TimingWheel<DATA>::insertNode(Node *node)
+{
+    const Int64 key = node->d_key;
+
+    if (key <= d_currentTime) {
+        // Keep the due list ordered by time; a node becoming due is usually
+        // not earlier than the nodes already due, so search from the back.
+
+        Link *position = d_due.d_prev_p;
+        while (position != &d_due
+            && static_cast<Node *>(position)->d_key > key) {
+            position = position->d_prev_p;
+        }
+        append(position->d_next_p, node);
+        node->d_location = k_DUE;
+        return;                                                       // RETURN
+    }
+
+    // The level of the node is that of the most significant group of bits in
+    // which its time differs from the current time, so that the slots of a
+    // level, from the slot of the current time on, cover increasing times.
+
+    const Uint64 difference = static_cast<Uint64>(key)
+                            ^ static_cast<Uint64>(d_currentTime);
+    const int    highBit    = 63 - bdlb::BitUtil::numLeadingUnsetBits(
+                                       static_cast<bsl::uint64_t>(difference));
+    const int    level      = highBit / k_BITS_PER_LEVEL;
+    const int    slot       = static_cast<int>(
+                              (static_cast<Uint64>(key)
+                                        >> (level * k_BITS_PER_LEVEL))
+                                                         & (k_NUM_SLOTS - 1));
+    const int    location   = level * k_NUM_SLOTS + slot;
+
+    append(&d_slots[location], node);
+    node->d_location    = location;
+    d_occupied[level]  |= static_cast<Uint64>(1) << slot;
+}
+
+template <class DATA>
+void TimingWheel<DATA>::releaseNode(Node *node)
+{
+    if (0 == --node->d_refCount) {
+        node->~Node();
+        d_pool.deallocate(node);
+    }
+}
+
+template <class DATA>
+void TimingWheel<DATA>::removeNode(Node *node)
+{
+    const int location = node->d_location;
+
+    unlink(node);
+    node->d_location = k_NOT_IN_WHEEL;
+
+    if (0 <= location) {
+        Link& slot = d_slots[location];
+        if (slot.d_next_p == &slot) {
+            d_occupied[location / k_NUM_SLOTS] &=
+                         ~(static_cast<Uint64>(1) << (location % k_NUM_SLOTS));
+        }
+    }
+}
+
+// PRIVATE ACCESSORS
+template <class DATA>
+int TimingWheel<DATA>::findFirstOccupiedSlot(int *level) const
+{
+    for (int i = 0; i < k_NUM_LEVELS; ++i) {
+        if (d_occupied[i]) {
+            *level = i;
+            return bdlb::BitUtil::numTrailingUnsetBits(
+                                  static_cast<bsl::uint64_t>(d_occupied[i]));
+                                                                      // RETURN
+        }
+    }
+    return -1;
+}
+
+template <class DATA>
+bsls::Types::Int64 TimingWheel<DATA>::slotStartTime(int level, int slot) const
+{
+    const int    shift     = level * k_BITS_PER_LEVEL;
+    const int    highShift = shift + k_BITS_PER_LEVEL;
+    const Uint64 high      = highShift < 64
+                           ? (static_cast<Uint64>(d_currentTime) >> highShift)
+                                                                  << highShift
+                           : 0;
+
+    return static_cast<Int64>(high | (static_cast<Uint64>(slot) << shift));
+}
+
+// CREATORS
+template <class DATA>
+TimingWheel<DATA>::TimingWheel(bslma::Allocator *basicAllocator)
+: d_currentTime(0)
+, d_length(0)
+, d_pool(sizeof(Node), basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_due.d_next_p = &d_due;
+    d_due.d_prev_p = &d_due;
+
+    for (int i = 0; i < k_NUM_LEVELS * k_NUM_SLOTS; ++i) {
+        d_slots[i].d_next_p = &d_slots[i];
+        d_slots[i].d_prev_p = &d_slots[i];
+    }
+    for (int i = 0; i < k_NUM_LEVELS; ++i) {
+        d_occupied[i] = 0;
+    }
+}
+
+template <class DATA>
+TimingWheel<DATA>::~TimingWheel()
+{
+    removeAll();
+}
+
+// MANIPULATORS
+template <class DATA>
+inline
+void TimingWheel<DATA>::add(const Int64& key, const DATA& data)
+{
+    addRaw(0, key, data);
+}
+
+template <class DATA>
+inline
+void TimingWheel<DATA>::add(PairHandle  *result,
+                            const Int64& key,
+                            const DATA&  data)
+{
+    BSLS_ASSERT(result);
+
+    Pair *reference;
+    addRaw(&reference, key, data);
+    result->reset(this, reference);
+}
+
+template <class DATA>
+void TimingWheel<DATA>::addRaw(Pair        **result,
+                               const Int64&  key,
+                               const DATA&   data)
+{
+    Node *node = allocateNode(key, data);
+    if (result) {
+        ++node->d_refCount;
+        *result = reinterpret_cast<Pair *>(node);
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    insertNode(node);
+    ++d_length;
+}
+
+template <class DATA>
+int TimingWheel<DATA>::advance(const Int64& time)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    int numDue = 0;
+    while (time > d_currentTime) {
+        int       level;
+        const int slot = findFirstOccupiedSlot(&level);
+
+        if (0 > slot) {
+            d_currentTime = time;
+            break;
+        }
+
+        const Int64 start = slotStartTime(level, slot);
+        if (start > time) {
+            d_currentTime = time;
+            break;
+        }
+
+        // No node is earlier than the first occupied slot of the lowest
+        // level, so the current time can move to its start; its nodes then
+        // either become due (at level 0) or move to lower levels.
+
+        d_currentTime = start;
+
+        Link& list = d_slots[level * k_NUM_SLOTS + slot];
+        Link *link = list.d_next_p;
+
+        list.d_next_p = &list;
+        list.d_prev_p = &list;
+        d_occupied[level] &= ~(static_cast<Uint64>(1) << slot);
+
+        while (link != &list) {
+            Node *node = static_cast<Node *>(link);
+            link = link->d_next_p;
+
+            insertNode(node);
+            if (k_DUE == node->d_location) {
+                ++numDue;
+            }
+        }
+    }
+    return numDue;
+}
+
+template <class DATA>
+int TimingWheel<DATA>::popFrontRaw(Pair **item)
+{
+    BSLS_ASSERT(item);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (d_due.d_next_p == &d_due) {
+        return e_NOT_FOUND;                                           // RETURN
+    }
+
+    // The reference held by the wheel is transferred to 'item'.
+
+    Node *node = static_cast<Node *>(d_due.d_next_p);
+    removeNode(node);
+    --d_length;
+
+    *item = reinterpret_cast<Pair *>(node);
+    return 0;
+}
+
+template <class DATA>
+inline
+void TimingWheel<DATA>::releaseReferenceRaw(const Pair *reference)
+{
+    BSLS_ASSERT(reference);
+
+    releaseNode(pairToNode(reference));
+}
+
+template <class DATA>
+int TimingWheel<DATA>::remove(const Pair *reference)
+{
+    if (0 == reference) {
+        return e_INVALID;                                             // RETURN
+    }
+
+    Node *node = pairToNode(reference);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        if (k_NOT_IN_WHEEL == node->d_location) {
+            return e_NOT_FOUND;                                       // RETURN
+        }
+        removeNode(node);
+        --d_length;
+    }
+
+    // 'reference' is still held by the caller, so this is not the last
+    // reference.
+
+    releaseNode(node);
+    return 0;
+}
+
+template <class DATA>
+int TimingWheel<DATA>::removeAll()
+{
+    Link removed;
+    removed.d_next_p = &removed;
+    removed.d_prev_p = &removed;
+
+    int numRemoved;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        numRemoved = d_length;
+
+        for (int i = -1; i < k_NUM_LEVELS * k_NUM_SLOTS; ++i) {
+            Link& list = i < 0 ? d_due : d_slots[i];
+            while (list.d_next_p != &list) {
+                Node *node = static_cast<Node *>(list.d_next_p);
+                unlink(node);
+                node->d_location = k_NOT_IN_WHEEL;
+                append(&removed, node);
+            }
+        }
+        for (int i = 0; i < k_NUM_LEVELS; ++i) {
+            d_occupied[i] = 0;
+        }
+        d_length = 0;
+    }
+
+    // Destroy the nodes outside of the lock, since destroying their data may
+    // be arbitrarily expensive.
+
+    while (removed.d_next_p != &removed) {
+        Node *node = static_cast<Node *>(removed.d_next_p);
+        unlink(node);
+        releaseNode(node);
+    }
+    return numRemoved;
+}
+
+template <class DATA>
+int TimingWheel<DATA>::update(const Pair *reference, const Int64& newKey)
+{
+    if (0 == reference) {
+        return e_INVALID;                                             // RETURN
+    }
+
+    Node *node = pairToNode(reference);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (k_NOT_IN_WHEEL == node->d_location) {
+        return e_NOT_FOUND;                                           // RETURN
+    }
+    removeNode(node);
+    node->d_key = newKey;
+    insertNode(node);
+
+    return 0;
+}
+
+// ACCESSORS
+template <class DATA>
+inline
+TimingWheelPair<DATA> *
+TimingWheel<DATA>::addPairReferenceRaw(const Pair *reference) const
+{
+    BSLS_ASSERT(reference);
+
+    ++pairToNode(reference)->d_refCount;
+    return const_cast<Pair *>(reference);
+}
+
+template <class DATA>
+inline
+bsls::Types::Int64 TimingWheel<DATA>::currentTime() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_currentTime;
+}
+
+template <class DATA>
+int TimingWheel<DATA>::frontRaw(Pair **front) const
+{
+    BSLS_ASSERT(front);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (d_due.d_next_p == &d_due) {
+        return e_NOT_FOUND;                                           // RETURN
+    }
+
+    Node *node = static_cast<Node *>(d_due.d_next_p);
+    ++node->d_refCount;
+
+    *front = reinterpret_cast<Pair *>(node);
+    return 0;
+}
+
+template <class DATA>
+inline
+bool TimingWheel<DATA>::isEmpty() const
+{
+    return 0 == length();
+}
+
+template <class DATA>
+inline
+int TimingWheel<DATA>::length() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_length;
+}
+
+template <class DATA>
+int TimingWheel<DATA>::nextTime(Int64 *time) const
+{
+    BSLS_ASSERT(time);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (d_due.d_next_p != &d_due) {
+        *time = static_cast<const Node *>(d_due.d_next_p)->d_key;
+        return 0;                                                     // RETURN
+    }
+
+    int       level;
+    const int slot = findFirstOccupiedSlot(&level);
+    if (0 > slot) {
+        return e_NOT_FOUND;                                           // RETURN
+    }
+
+    *time = slotStartTime(level, slot);
+    return 0;
+}
+
+                                  // Aspects
+
+template <class DATA>
+inline
+bslma::Allocator *TimingWheel<DATA>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1079 @@
+// bdlcc_timingwheel.t.cpp                                            -*-C++-*-
+#include <bdlcc_timingwheel.h>
+
+#include <bdlcc_skiplist.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'bdlcc::TimingWheel' is a container whose observable state is the set of
+// pairs it holds, its current time, and the order in which the due pairs are
+// returned.  Its correctness hinges on the redistribution of the pairs of the
+// higher levels of the wheel as the current time advances, so, after testing
+// the basic manipulators and 'PairHandle', we compare the behavior of the
+// wheel with that of a sorted reference sequence over random sequences of
+// additions, removals, updates, and advances, with times spread over ranges
+// exercising every level of the wheel.  We verify that all the memory used by
+// the wheel (including that of the 'DATA' values) comes from the allocator
+// supplied at construction, and that every node is released.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit TimingWheel(bslma::Allocator *basicAllocator = 0);
+// [ 2] ~TimingWheel();
+//
+// MANIPULATORS
+// [ 2] void add(const Int64& key, const DATA& data);
+// [ 3] void add(PairHandle *result, const Int64& key, const DATA& data);
+// [ 2] void addRaw(Pair **result, const Int64& key, const DATA& data);
+// [ 4] int advance(const Int64& time);
+// [ 2] int popFrontRaw(Pair **item);
+// [ 2] void releaseReferenceRaw(const Pair *reference);
+// [ 5] int remove(const Pair *reference);
+// [ 6] int removeAll();
+// [ 5] int update(const Pair *reference, const Int64& newKey);
+//
+// ACCESSORS
+// [ 3] Pair *addPairReferenceRaw(const Pair *reference) const;
+// [ 2] Int64 currentTime() const;
+// [ 2] int frontRaw(Pair **front) const;
+// [ 2] bool isEmpty() const;
+// [ 2] int length() const;
+// [ 6] int nextTime(Int64 *time) const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// TimingWheelPair
+// [ 2] DATA& data() const;
+// [ 2] const Int64& key() const;
+//
+// TimingWheelPairHandle
+// [ 3] TimingWheelPairHandle();
+// [ 3] TimingWheelPairHandle(const TimingWheelPairHandle& original);
+// [ 3] ~TimingWheelPairHandle();
+// [ 3] TimingWheelPairHandle& operator=(const TimingWheelPairHandle& rhs);
+// [ 3] void release();
+// [ 3] operator const Pair*() const;
+// [ 3] DATA& data() const;
+// [ 3] const Int64& key() const;
+// [ 3] bool isValid() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: DUE PAIRS ARE RETURNED IN TIME ORDER AT EVERY LEVEL
+// [ 7] USAGE EXAMPLE
+// [-1] CONCERN: PERFORMANCE OF ADD/REMOVE COMPARED TO 'bdlcc::SkipList'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlcc::TimingWheel<int> Obj;
+typedef Obj::Pair               Pair;
+typedef Obj::PairHandle         PairHandle;
+typedef bsls::Types::Int64      Int64;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+class Random {
+    // This class provides a deterministic 64-bit pseudo-random number
+    // generator.
+
+    // DATA
+    bsls::Types::Uint64 d_state;
+
+  public:
+    // CREATORS
+    explicit Random(bsls::Types::Uint64 seed)
+    : d_state(seed)
+        // Create a generator having the specified 'seed'.
+    {
+    }
+
+    // MANIPULATORS
+    Int64 operator()(int numBits)
+        // Return a non-negative pseudo-random number of at most the specified
+        // 'numBits' bits.  The behavior is undefined unless
+        // '0 < numBits < 64'.
+    {
+        d_state = d_state * 6364136223846793005ULL + 1442695040888963407ULL;
+        bsls::Types::Uint64 result = d_state ^ (d_state >> 29);
+        result *= 0xbf58476d1ce4e5b9ULL;
+        result ^= result >> 32;
+        return static_cast<Int64>(result >> (64 - numBits));
+    }
+};
+
+typedef bsl::pair<Int64, int> Entry;
+    // A reference entry: the time of a pair and the sequence number of its
+    // addition.
+
+int popAllDue(bsl::vector<Entry> *result, Obj *wheel)
+    // Pop all the due pairs of the specified 'wheel', append to the specified
+    // 'result' their time and data, and return the number of pairs popped.
+{
+    int   count = 0;
+    Pair *item;
+    while (0 == wheel->popFrontRaw(&item)) {
+        result->push_back(Entry(item->key(), item->data()));
+        wheel->releaseReferenceRaw(item);
+        ++count;
+    }
+    return count;
+}
+
+struct EntryKeyLess {
+    // This 'struct' orders entries by time only.
+
+    bool operator()(const Entry& lhs, const Entry& rhs) const
+        // Return 'true' if the time of the specified 'lhs' is before that of
+        // the specified 'rhs', and 'false' otherwise.
+    {
+        return lhs.first < rhs.first;
+    }
+};
+
+void extractDue(bsl::vector<Entry> *result,
+                bsl::vector<Entry> *reference,
+                Int64               time)
+    // Move to the specified 'result' the entries of the specified 'reference'
+    // whose time is not after the specified 'time', in the order in which a
+    // timing wheel returns them (by time, then by sequence number).
+{
+    bsl::vector<Entry> remaining;
+    for (bsl::size_t i = 0; i < reference->size(); ++i) {
+        if ((*reference)[i].first <= time) {
+            result->push_back((*reference)[i]);
+        }
+        else {
+            remaining.push_back((*reference)[i]);
+        }
+    }
+    bsl::stable_sort(result->begin(), result->end(), EntryKeyLess());
+    reference->swap(remaining);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test            = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    const bool verbose         = argc > 2;
+    const bool veryVerbose     = argc > 3;
+    const bool veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Managing Connection Timeouts
+///- - - - - - - - - - - - - - - - - - - -
+// In this example we manage the timeouts of a set of connections.  A timeout
+// is armed for each connection when it is opened, and is rearmed each time
+// data is received on the connection; a connection that does not receive data
+// before its timeout expires is closed.
+//
+// First, we create a timing wheel whose times are numbers of milliseconds,
+// and bring it to the current time, 1000:
+//..
+    bdlcc::TimingWheel<int> timeouts;
+    timeouts.advance(1000);
+//..
+// Then, we open three connections, identified by the integers 1, 2, and 3,
+// each with a timeout of 500 milliseconds:
+//..
+    bdlcc::TimingWheel<int>::PairHandle timeout[4];
+    for (int connection = 1; connection <= 3; ++connection) {
+        timeouts.add(&timeout[connection], 1500, connection);
+    }
+    ASSERT(3 == timeouts.length());
+//..
+// Next, data is received on connection 2 at time 1200, so we rearm its
+// timeout, and connection 3 is closed by its peer, so we cancel its timeout:
+//..
+    int rc = timeouts.update(timeout[2], 1700);
+    ASSERT(0 == rc);
+
+    rc = timeouts.remove(timeout[3]);
+    ASSERT(0 == rc);
+    timeout[3].release();
+//..
+// Now, at time 1600, we advance the wheel and close the connections whose
+// timeout has expired; only connection 1 is closed:
+//..
+    timeouts.advance(1600);
+
+    bdlcc::TimingWheel<int>::Pair *expired;
+    while (0 == timeouts.popFrontRaw(&expired)) {
+        ASSERT(1 == expired->data());
+        timeouts.releaseReferenceRaw(expired);
+    }
+//..
+// Finally, we verify that the timeout of connection 2 is still pending, and
+// that 'nextTime' reports (a lower bound of) its time:
+//..
+    ASSERT(1 == timeouts.length());
+
+    bsls::Types::Int64 nextTime;
+    rc = timeouts.nextTime(&nextTime);
+    ASSERT(0    == rc);
+    ASSERT(1600 <  nextTime && nextTime <= 1700);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'removeAll' AND 'nextTime'
+        //
+        // Concerns:
+        //: 1 'nextTime' fails on an empty wheel, loads the time of the first
+        //:   due pair if any, and otherwise loads a lower bound of the times
+        //:   of the pairs that is after the current time.
+        //:
+        //: 2 Repeatedly advancing the wheel to 'nextTime' reaches the time of
+        //:   the earliest pair in at most one step per level.
+        //:
+        //: 3 'removeAll' removes both the due and the pending pairs, returns
+        //:   their number, and releases their memory unless they are still
+        //:   referenced.
+        //
+        // Plan:
+        //: 1 Add single pairs at times spread over all the levels, and verify
+        //:   that advancing to 'nextTime' reaches the time of the pair within
+        //:   'k_NUM_LEVELS' steps, 'nextTime' being a strictly increasing
+        //:   lower bound of the time at each step.  (C-1..2)
+        //:
+        //: 2 Fill a wheel with due and pending pairs, holding a handle to one
+        //:   of them, call 'removeAll', and verify its result, the state of
+        //:   the wheel, and the memory in use before and after releasing the
+        //:   handle.  (C-3)
+        //
+        // Testing:
+        //   int removeAll();
+        //   int nextTime(Int64 *time) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'removeAll' AND 'nextTime'" << endl
+                          << "==========================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        if (verbose) cout << "\tTesting 'nextTime'." << endl;
+        {
+            Random random(6);
+
+            for (int numBits = 1; numBits < 63; ++numBits) {
+                for (int i = 0; i < 20; ++i) {
+                    Obj   mX(&ta);  const Obj& X = mX;
+                    Int64 start = random(numBits);
+                    Int64 time  = start + 1 + random(numBits);
+                    Int64 next;
+
+                    mX.advance(start);
+                    ASSERT(Obj::e_NOT_FOUND == X.nextTime(&next));
+
+                    mX.add(time, i);
+
+                    int numSteps = 0;
+                    while (0 == X.nextTime(&next) && next < time) {
+                        ASSERTV(numBits, X.currentTime(), next,
+                                X.currentTime() < next);
+                        mX.advance(next);
+                        ASSERTV(numBits, X.currentTime() == next);
+                        ++numSteps;
+                    }
+                    ASSERTV(numBits, time, next, time == next);
+                    ASSERTV(numBits, numSteps, numSteps <= Obj::k_NUM_LEVELS);
+
+                    mX.advance(next);
+
+                    Pair *item;
+                    ASSERT(0 == mX.frontRaw(&item));
+                    ASSERT(0 == X.nextTime(&next));
+                    ASSERT(time == next);
+                    mX.releaseReferenceRaw(item);
+                }
+            }
+        }
+
+        if (verbose) cout << "\tTesting 'removeAll'." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(0 == mX.removeAll());
+
+            PairHandle handle;
+            mX.advance(1000);
+            for (int i = 0; i < 100; ++i) {
+                mX.add(i * 20, i);
+            }
+            mX.add(&handle, 1 << 20, 100);
+            ASSERT(101 == X.length());
+
+            const Int64 numBlocks = ta.numBlocksInUse();
+
+            ASSERT(101 == mX.removeAll());
+            ASSERT(0   == X.length());
+            ASSERT(X.isEmpty());
+            ASSERT(numBlocks == ta.numBlocksInUse());
+
+            Pair  *item;
+            Int64  next;
+            ASSERT(Obj::e_NOT_FOUND == mX.frontRaw(&item));
+            ASSERT(Obj::e_NOT_FOUND == X.nextTime(&next));
+            ASSERT(Obj::e_NOT_FOUND == mX.remove(handle));
+            ASSERT(Obj::e_NOT_FOUND == mX.update(handle, 5));
+            ASSERT(100              == handle.data());
+
+            ASSERT(0 == mX.removeAll());
+            handle.release();
+
+            // Freed nodes are returned to the pool of the wheel.
+
+            ASSERT(numBlocks == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'remove' AND 'update'
+        //
+        // Concerns:
+        //: 1 'remove' and 'update' fail with 'e_INVALID' for a null reference,
+        //:   and with 'e_NOT_FOUND' for a pair that is no longer in the wheel.
+        //:
+        //: 2 'remove' removes a due or pending pair, and leaves the other
+        //:   pairs (including those in the same slot) unaffected.
+        //:
+        //: 3 'update' moves a pair to its new time, whether the new time is
+        //:   before or after the original one, and makes the pair due if the
+        //:   new time is not after the current time.
+        //:
+        //: 4 Random interleavings of 'add', 'remove', 'update', and 'advance'
+        //:   return the same pairs, in the same order, as a reference model.
+        //
+        // Plan:
+        //: 1 Verify the return values of 'remove' and 'update' for a null
+        //:   reference and for a removed pair.  (C-1)
+        //:
+        //: 2 Remove and update pairs in the same slot, and in different
+        //:   levels, and verify the pairs subsequently popped.  (C-2..3)
+        //:
+        //: 3 Apply random operations to both a wheel and a vector of entries
+        //:   modeling its pending pairs, verifying after each 'advance' that
+        //:   the popped pairs are those predicted by the model.  (C-4)
+        //
+        // Testing:
+        //   int remove(const Pair *reference);
+        //   int update(const Pair *reference, const Int64& newKey);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'remove' AND 'update'" << endl
+                          << "=====================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        if (verbose) cout << "\tTesting invalid references." << endl;
+        {
+            Obj mX(&ta);
+
+            ASSERT(Obj::e_INVALID == mX.remove(0));
+            ASSERT(Obj::e_INVALID == mX.update(0, 5));
+
+            PairHandle handle;
+            mX.add(&handle, 10, 1);
+            ASSERT(0                == mX.remove(handle));
+            ASSERT(Obj::e_NOT_FOUND == mX.remove(handle));
+            ASSERT(Obj::e_NOT_FOUND == mX.update(handle, 5));
+            ASSERT(mX.isEmpty());
+        }
+
+        if (verbose) cout << "\tTesting simple cases." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            PairHandle h[6];
+            mX.add(&h[0], 100,     0);
+            mX.add(&h[1], 100,     1);
+            mX.add(&h[2], 100,     2);
+            mX.add(&h[3], 5000,    3);
+            mX.add(&h[4], 1 << 30, 4);
+            mX.add(&h[5], 50,      5);
+
+            ASSERT(0 == mX.remove(h[1]));       // middle of a slot
+            ASSERT(0 == mX.update(h[4], 60));   // higher level to lower
+            ASSERT(0 == mX.update(h[5], 2000)); // later, higher level
+            ASSERT(0 == mX.update(h[0], 9000)); // first of a slot to later
+
+            mX.advance(20);
+            ASSERT(0 == mX.update(h[3], 10));   // made due by update
+            ASSERT(5 == X.length());
+
+            bsl::vector<Entry> popped;
+            mX.advance(1000);
+            ASSERT(3 == popAllDue(&popped, &mX));
+            ASSERT(3 == popped.size());
+            ASSERT(Entry(10,  3) == popped[0]);
+            ASSERT(Entry(60,  4) == popped[1]);
+            ASSERT(Entry(100, 2) == popped[2]);
+
+            ASSERT(0 == mX.update(h[5], 1000)); // made due by update
+            ASSERT(0 == mX.remove(h[0]));       // last pending pair
+
+            popped.clear();
+            ASSERT(1 == popAllDue(&popped, &mX));
+            ASSERT(Entry(1000, 5) == popped[0]);
+
+            ASSERT(X.isEmpty());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tTesting random operations." << endl;
+
+        // The current time advances by up to '2^(numBits - 2)' for each of
+        // (about) 250 calls to 'advance', which must not overflow.
+
+        for (int numBits = 4; numBits < 55; numBits += 3) {
+            Obj    mX(&ta);  const Obj& X = mX;
+            Random random(numBits);
+
+            bsl::vector<Entry>      reference;
+            bsl::vector<PairHandle> handles;
+            int                     sequence = 0;
+
+            for (int i = 0; i < 2000; ++i) {
+                const int operation = static_cast<int>(random(3));
+
+                if (operation < 4 || reference.empty()) {
+                    const Int64 time = X.currentTime() + random(numBits);
+
+                    handles.resize(sequence + 1);
+                    mX.add(&handles[sequence], time, sequence);
+                    reference.push_back(Entry(time, sequence));
+                    ++sequence;
+                }
+                else if (operation < 6) {
+                    const bsl::size_t index = static_cast<bsl::size_t>(
+                                           random(20) % reference.size());
+                    const int id = reference[index].second;
+
+                    ASSERTV(numBits, i, 0 == mX.remove(handles[id]));
+                    handles[id].release();
+                    reference.erase(reference.begin() + index);
+                }
+                else if (operation < 7) {
+                    const bsl::size_t index = static_cast<bsl::size_t>(
+                                           random(20) % reference.size());
+                    const int   id   = reference[index].second;
+                    const Int64 time = X.currentTime() + random(numBits);
+
+                    // An updated pair is ordered as if it were added last.
+
+                    ASSERTV(numBits, i, 0 == mX.update(handles[id], time));
+                    reference.erase(reference.begin() + index);
+                    reference.push_back(Entry(time, id));
+                }
+                else {
+                    const Int64 time = X.currentTime() + random(numBits) / 4;
+
+                    bsl::vector<Entry> expected;
+                    extractDue(&expected, &reference, time);
+
+                    mX.advance(time);
+
+                    bsl::vector<Entry> popped;
+                    popAllDue(&popped, &mX);
+                    ASSERTV(numBits, i, expected.size(), popped.size(),
+                            expected == popped);
+
+                    for (bsl::size_t j = 0; j < popped.size(); ++j) {
+                        handles[popped[j].second].release();
+                    }
+                }
+                ASSERTV(numBits, i, reference.size() == X.length());
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'advance'
+        //
+        // Concerns:
+        //: 1 'advance' makes due exactly the pairs whose time is not after the
+        //:   new current time, and returns the number of pairs made due from
+        //:   the slots of the wheel.
+        //:
+        //: 2 The due pairs are returned in time order, and pairs having the
+        //:   same time are returned in the order in which they were added,
+        //:   for times at every level of the wheel, including when a single
+        //:   call to 'advance' crosses several levels.
+        //:
+        //: 3 'advance' to a time not after the current time has no effect.
+        //:
+        //: 4 Pairs added with a time not after the current time, including
+        //:   negative times, are due immediately.
+        //
+        // Plan:
+        //: 1 For ranges of times of increasing width, add random pairs (with
+        //:   many duplicate times), advance the wheel by random amounts, and
+        //:   compare the popped pairs with those of a stable-sorted reference.
+        //:   (C-1..2)
+        //:
+        //: 2 Verify that advancing backward has no effect.  (C-3)
+        //:
+        //: 3 Add pairs before the current time and verify that they are
+        //:   immediately due, in order.  (C-4)
+        //
+        // Testing:
+        //   int advance(const Int64& time);
+        //   CONCERN: DUE PAIRS ARE RETURNED IN TIME ORDER AT EVERY LEVEL
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'advance'" << endl
+                          << "=========" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        for (int numBits = 1; numBits < 59; ++numBits) {
+            Obj    mX(&ta);  const Obj& X = mX;
+            Random random(numBits);
+
+            if (veryVerbose) { T_ P(numBits) }
+
+            bsl::vector<Entry> reference;
+            int                sequence = 0;
+
+            const Int64 origin = random(numBits);
+            mX.advance(origin);
+            ASSERT(origin == X.currentTime());
+
+            for (int round = 0; round < 20; ++round) {
+                for (int i = 0; i < 50; ++i) {
+                    Int64 time = X.currentTime() + 1 + random(numBits);
+                    if (i % 5) {
+                        // Duplicate the time of a random pending pair.
+
+                        if (!reference.empty()) {
+                            time = reference[random(20) % reference.size()]
+                                                                       .first;
+                        }
+                    }
+                    mX.add(time, sequence);
+                    reference.push_back(Entry(time, sequence));
+                    ++sequence;
+                }
+
+                const Int64 time = X.currentTime() + random(numBits);
+
+                bsl::vector<Entry> expected;
+                extractDue(&expected, &reference, time);
+
+                const int numDue = mX.advance(time);
+                ASSERTV(numBits, round, time == X.currentTime());
+                ASSERTV(numBits, round, numDue, expected.size(),
+                        static_cast<bsl::size_t>(numDue) == expected.size());
+
+                bsl::vector<Entry> popped;
+                popAllDue(&popped, &mX);
+                ASSERTV(numBits, round, expected == popped);
+                ASSERTV(numBits, round, reference.size() == X.length());
+
+                ASSERT(0 == mX.advance(time - 1));
+                ASSERT(time == X.currentTime());
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tTesting pairs due on addition." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            mX.advance(100);
+            mX.add(50,   0);
+            mX.add(-7,   1);
+            mX.add(100,  2);
+            mX.add(50,   3);
+            mX.add(101,  4);
+            ASSERT(5 == X.length());
+
+            bsl::vector<Entry> popped;
+            ASSERT(4 == popAllDue(&popped, &mX));
+            ASSERT(Entry(-7,  1) == popped[0]);
+            ASSERT(Entry(50,  0) == popped[1]);
+            ASSERT(Entry(50,  3) == popped[2]);
+            ASSERT(Entry(100, 2) == popped[3]);
+
+            ASSERT(1 == mX.advance(101));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'PairHandle'
+        //
+        // Concerns:
+        //: 1 A default-constructed handle is not valid and converts to 0.
+        //:
+        //: 2 A handle loaded by 'add' refers to the new pair, and keeps the
+        //:   pair alive after it is removed from the wheel.
+        //:
+        //: 3 Copying and assigning a handle acquire a new reference, and
+        //:   'release' and the destructor release it.
+        //
+        // Plan:
+        //: 1 Exercise the handle API, using a test allocator holding 'DATA'
+        //:   values that allocate memory ('bsl::string') to verify that the
+        //:   pair is destroyed exactly when the last reference is released.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   void add(PairHandle *result, const Int64& key, const DATA& data);
+        //   Pair *addPairReferenceRaw(const Pair *reference) const;
+        //   TimingWheelPairHandle();
+        //   TimingWheelPairHandle(const TimingWheelPairHandle& original);
+        //   ~TimingWheelPairHandle();
+        //   TimingWheelPairHandle& operator=(const TimingWheelPairHandle&);
+        //   void release();
+        //   operator const Pair*() const;
+        //   DATA& data() const;
+        //   const Int64& key() const;
+        //   bool isValid() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'PairHandle'" << endl
+                          << "============" << endl;
+
+        typedef bdlcc::TimingWheel<bsl::string> SObj;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            SObj mX(&ta);
+
+            bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+            const bsl::string LONG(100, 'x', &sa);
+
+            SObj::PairHandle h1;
+            ASSERT(!h1.isValid());
+            ASSERT(0 == static_cast<const SObj::Pair *>(h1));
+
+            mX.add(&h1, 7, LONG);
+            ASSERT(h1.isValid());
+            ASSERT(7    == h1.key());
+            ASSERT(LONG == h1.data());
+
+            SObj::PairHandle h2(h1);
+            ASSERT(h2.isValid());
+            ASSERT(static_cast<const SObj::Pair *>(h1) ==
+                   static_cast<const SObj::Pair *>(h2));
+
+            SObj::PairHandle h3;
+            h3 = h2;
+            ASSERT(&h3.data() == &h1.data());
+
+            h3 = h3;
+            ASSERT(h3.isValid());
+
+            ASSERT(0 == mX.remove(h1));
+            ASSERT(mX.isEmpty());
+
+            const Int64 numBlocks = ta.numBlocksInUse();
+
+            h1.release();
+            ASSERT(!h1.isValid());
+            h2.release();
+            ASSERT(LONG == h3.data());
+            ASSERT(numBlocks == ta.numBlocksInUse());
+
+            SObj::Pair *raw = mX.addPairReferenceRaw(h3);
+            h3 = SObj::PairHandle();
+            ASSERT(LONG == raw->data());
+
+            // Releasing the last reference destroys the string, which frees
+            // its memory.
+
+            mX.releaseReferenceRaw(raw);
+            ASSERT(numBlocks > ta.numBlocksInUse());
+
+            {
+                SObj::PairHandle h4;
+                mX.add(&h4, 8, LONG);
+            }
+            ASSERT(1 == mX.length());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A new wheel is empty, has a current time of 0, and uses the
+        //:   supplied (or default) allocator.
+        //:
+        //: 2 'add' and 'addRaw' add a pair that becomes due when the wheel is
+        //:   advanced to its time, and 'addRaw' optionally returns a
+        //:   reference to the pair.
+        //:
+        //: 3 'frontRaw' returns a reference to the first due pair without
+        //:   removing it, and 'popFrontRaw' removes it.
+        //:
+        //: 4 The memory of the wheel, including that of the 'DATA' values,
+        //:   is supplied by its allocator and is released on destruction.
+        //
+        // Plan:
+        //: 1 Create wheels with and without an allocator, add pairs using all
+        //:   the 'add' overloads, advance, and verify the accessors and the
+        //:   popped pairs.  Destroy a non-empty wheel and verify that all its
+        //:   memory is released.  (C-1..4)
+        //
+        // Testing:
+        //   explicit TimingWheel(bslma::Allocator *basicAllocator = 0);
+        //   ~TimingWheel();
+        //   void add(const Int64& key, const DATA& data);
+        //   void addRaw(Pair **result, const Int64& key, const DATA& data);
+        //   int popFrontRaw(Pair **item);
+        //   void releaseReferenceRaw(const Pair *reference);
+        //   Int64 currentTime() const;
+        //   int frontRaw(Pair **front) const;
+        //   bool isEmpty() const;
+        //   int length() const;
+        //   bslma::Allocator *allocator() const;
+        //   DATA& TimingWheelPair::data() const;
+        //   const Int64& TimingWheelPair::key() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(&defaultAllocator == X.allocator());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(0   == X.currentTime());
+            ASSERT(0   == X.length());
+            ASSERT(X.isEmpty());
+
+            Pair *item = 0;
+            ASSERT(Obj::e_NOT_FOUND == mX.frontRaw(&item));
+            ASSERT(Obj::e_NOT_FOUND == mX.popFrontRaw(&item));
+
+            mX.add(30, 3);
+            mX.addRaw(0, 10, 1);
+
+            Pair *raw;
+            mX.addRaw(&raw, 20, 2);
+            ASSERT(20 == raw->key());
+            ASSERT(2  == raw->data());
+            raw->data() = 22;
+
+            ASSERT(3 == X.length());
+            ASSERT(!X.isEmpty());
+            ASSERT(Obj::e_NOT_FOUND == mX.frontRaw(&item));
+
+            ASSERT(2  == mX.advance(20));
+            ASSERT(20 == X.currentTime());
+
+            ASSERT(0  == mX.frontRaw(&item));
+            ASSERT(10 == item->key());
+            ASSERT(1  == item->data());
+            mX.releaseReferenceRaw(item);
+            ASSERT(3  == X.length());
+
+            ASSERT(0  == mX.popFrontRaw(&item));
+            ASSERT(10 == item->key());
+            mX.releaseReferenceRaw(item);
+
+            ASSERT(0  == mX.popFrontRaw(&item));
+            ASSERT(raw == item);
+            ASSERT(22 == item->data());
+            mX.releaseReferenceRaw(item);
+            mX.releaseReferenceRaw(raw);
+
+            ASSERT(1 == X.length());
+            ASSERT(Obj::e_NOT_FOUND == mX.popFrontRaw(&item));
+
+            // Leave pending pairs in the wheel on destruction.
+
+            mX.add(1 << 20, 4);
+            mX.add(static_cast<Int64>(1) << 40, 5);
+            ASSERT(3 == X.length());
+            ASSERT(0 < ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Add, remove, and pop a few pairs.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        PairHandle handle;
+        mX.add(300, 3);
+        mX.add(&handle, 200, 2);
+        mX.add(100, 1);
+        ASSERT(3 == X.length());
+
+        ASSERT(0 == mX.remove(handle));
+        ASSERT(2 == X.length());
+
+        ASSERT(1 == mX.advance(250));
+
+        Pair *item;
+        ASSERT(0 == mX.popFrontRaw(&item));
+        ASSERT(1 == item->data());
+        mX.releaseReferenceRaw(item);
+        ASSERT(Obj::e_NOT_FOUND == mX.popFrontRaw(&item));
+
+        ASSERT(1 == mX.advance(300));
+        ASSERT(0 == mX.popFrontRaw(&item));
+        ASSERT(3 == item->data());
+        mX.releaseReferenceRaw(item);
+        ASSERT(X.isEmpty());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE OF ADD/REMOVE COMPARED TO 'bdlcc::SkipList'
+        //
+        // Concerns:
+        //: 1 Adding and removing a pair, with a large number of pairs in the
+        //:   container, is faster with a timing wheel than with a skip list.
+        //
+        // Plan:
+        //: 1 Fill each container with a number of pairs (argument 2, default
+        //:   100000) having random times within the next minute, in
+        //:   microseconds, then repeatedly add a pair and remove the oldest
+        //:   pair (modeling a timeout canceled before it expires), and report
+        //:   the elapsed time of each container.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: PERFORMANCE OF ADD/REMOVE COMPARED TO 'bdlcc::SkipList'
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE OF ADD/REMOVE COMPARED TO 'bdlcc::SkipList'"
+             << endl
+             << "======================================================="
+             << endl;
+
+        int numPairs = argc > 2 ? bsl::atoi(argv[2]) : 0;
+        if (numPairs <= 0) {
+            numPairs = 100000;
+        }
+        const int   k_NUM_ITERATIONS = 1000000;
+        const Int64 k_MINUTE         = 60 * 1000 * 1000;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        bsl::vector<Int64> times(numPairs + k_NUM_ITERATIONS);
+        {
+            Random random(1);
+            for (bsl::size_t i = 0; i < times.size(); ++i) {
+                times[i] = static_cast<Int64>(i) + random(25) % k_MINUTE;
+            }
+        }
+
+        double wheelTime;
+        {
+            Obj                     mX(&ta);
+            bsl::vector<PairHandle> handles(numPairs);
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < numPairs; ++i) {
+                mX.add(&handles[i], times[i], i);
+            }
+            for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+                PairHandle& handle = handles[i % numPairs];
+                mX.remove(handle);
+                mX.add(&handle, times[numPairs + i], i);
+            }
+            timer.stop();
+            wheelTime = timer.elapsedTime();
+        }
+
+        double skipListTime;
+        {
+            typedef bdlcc::SkipList<Int64, int> SkipList;
+
+            SkipList                          mX(&ta);
+            bsl::vector<SkipList::PairHandle> handles(numPairs);
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < numPairs; ++i) {
+                mX.add(&handles[i], times[i], i);
+            }
+            for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+                SkipList::PairHandle& handle = handles[i % numPairs];
+                mX.remove(handle);
+                mX.add(&handle, times[numPairs + i], i);
+            }
+            timer.stop();
+            skipListTime = timer.elapsedTime();
+        }
+
+        cout << "pairs: " << numPairs
+             << "  iterations: " << k_NUM_ITERATIONS << endl
+             << "TimingWheel: " << wheelTime << "s" << endl
+             << "SkipList:    " << skipListTime << "s" << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
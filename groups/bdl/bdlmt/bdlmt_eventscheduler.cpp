@@ -23,6 +23,7 @@ BSLS_IDENT_RCSID(bdlmt_eventscheduler_cpp,"$Id$ $CSID$")
 #include <bsls_review.h>
 
 #include <bsl_algorithm.h>
+#include <bsl_limits.h>
 #include <bsl_vector.h>
 
 // Implementation note: When casting, we often cast through 'void *' or
@@ -37,6 +38,14 @@ void defaultDispatcherFunction(const bsl::function<void()>& callback)
     callback();
 }
 
+static const bsls::Types::Int64 k_NOT_WAITING =
+                                bsl::numeric_limits<bsls::Types::Int64>::min();
+    // value of 'd_wakeTime' while the dispatcher thread is not waiting
+
+static const bsls::Types::Int64 k_NO_EVENT =
+                                bsl::numeric_limits<bsls::Types::Int64>::max();
+    // value returned by 'nextWheelEventTime' when there is no event
+
 static inline
 bsl::function<bsls::TimeInterval()> createDefaultCurrentTimeFunctor(
                                         bsls::SystemClockType::Enum clockType)
@@ -163,6 +172,19 @@ bsls::Types::Int64 EventScheduler::chooseNextEvent(bsls::Types::Int64 *now)
     return t;
 }
 
+void EventScheduler::createWheels(QueueType queueType)
+{
+    if (e_TIMING_WHEEL != queueType) {
+        return;                                                       // RETURN
+    }
+
+    bslma::Allocator *allocator = d_eventQueue.allocator();
+
+    d_eventWheel_mp.load(new (*allocator) EventWheel(allocator), allocator);
+    d_recurringWheel_mp.load(new (*allocator) RecurringEventWheel(allocator),
+                             allocator);
+}
+
 void EventScheduler::dispatchEvents()
 {
     bsls::Types::Int64 now = d_currentTimeFunctor().totalMicroseconds();
@@ -231,6 +253,134 @@ void EventScheduler::dispatchEvents()
 
 }
 
+void EventScheduler::dispatchWheelEvents()
+{
+    while (1) {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        // Get ready for the next iteration.
+
+        releaseCurrentEvents();
+
+        if (d_dispatcherAwaited) {
+            d_dispatcherAwaited = false;
+            d_iterationCondition.broadcast();
+        }
+
+        // Now proceed with the next iteration.
+
+        if (!d_running) {
+            return;                                                   // RETURN
+        }
+
+        BSLS_ASSERT(0 == d_currentRecurringWheelEvent);
+        BSLS_ASSERT(0 == d_currentWheelEvent);
+
+        bsls::Types::Int64 now = d_currentTimeFunctor().totalMicroseconds();
+
+        d_recurringWheel_mp->advance(now);
+        d_eventWheel_mp->advance(now);
+
+        d_recurringWheel_mp->frontRaw(&d_currentRecurringWheelEvent);
+        d_eventWheel_mp->frontRaw(&d_currentWheelEvent);
+
+        if (0 == d_currentRecurringWheelEvent && 0 == d_currentWheelEvent) {
+            // Publish the wake-up time before checking the wheels once more,
+            // so that a thread scheduling an earlier event either sees it and
+            // signals 'd_queueCondition' (which it cannot do before this
+            // thread waits, since 'd_mutex' is locked), or has added the
+            // event before the check.
+
+            const bsls::Types::Int64 wakeTime = nextWheelEventTime();
+
+            d_wakeTime = wakeTime;
+            if (nextWheelEventTime() < wakeTime) {
+                d_wakeTime = k_NOT_WAITING;
+                continue;
+            }
+
+            ++d_waitCount;
+            if (k_NO_EVENT == wakeTime) {
+                d_queueCondition.wait(&d_mutex);
+            }
+            else {
+                bsls::TimeInterval w;
+                w.addMicroseconds(wakeTime);
+                d_queueCondition.timedWait(&d_mutex, w);
+            }
+            d_wakeTime = k_NOT_WAITING;
+            continue;
+        }
+
+        // Prefer overdue events over overdue clocks if running behind.
+
+        bsls::Types::Int64 t;
+        if (0 == d_currentRecurringWheelEvent) {
+            t = d_currentWheelEvent->key();
+        }
+        else if (0 == d_currentWheelEvent) {
+            t = d_currentRecurringWheelEvent->key();
+        }
+        else {
+            const bsls::Types::Int64 recurringEventTime =
+                                          d_currentRecurringWheelEvent->key();
+            const bsls::Types::Int64 eventTime = d_currentWheelEvent->key();
+
+            if (eventTime < recurringEventTime || eventTime < now) {
+                d_recurringWheel_mp->releaseReferenceRaw(
+                                                 d_currentRecurringWheelEvent);
+                d_currentRecurringWheelEvent = 0;
+                t = eventTime;
+            }
+            else {
+                d_eventWheel_mp->releaseReferenceRaw(d_currentWheelEvent);
+                d_currentWheelEvent = 0;
+                t = recurringEventTime;
+            }
+        }
+
+        if (t > now) {
+            // The event became due at a later time of the clock, which has
+            // since been set back.
+
+            releaseCurrentEvents();
+            bsls::TimeInterval w;
+            w.addMicroseconds(t);
+            ++d_waitCount;
+            d_queueCondition.timedWait(&d_mutex, w);
+            continue;
+        }
+
+        // We have an event due for execution.
+
+        if (d_currentRecurringWheelEvent) {
+            RecurringEventData& data = d_currentRecurringWheelEvent->data();
+            int ret = d_recurringWheel_mp->update(
+                                          d_currentRecurringWheelEvent,
+                                          t + data.second.totalMicroseconds());
+            if (0 == ret) {
+                lock.release()->unlock();
+                d_dispatcherFunctor(data.first);
+            }
+            continue;
+        }
+        BSLS_ASSERT(0 != d_currentWheelEvent);
+        int ret = d_eventWheel_mp->remove(d_currentWheelEvent);
+        if (0 == ret) {
+            lock.release()->unlock();
+            d_dispatcherFunctor(d_currentWheelEvent->data());
+        }
+    }
+}
+
+void EventScheduler::notifyDispatcher(bsls::Types::Int64 epochTime)
+{
+    if (epochTime < d_wakeTime.load()) {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        d_queueCondition.signal();
+    }
+}
+
 void EventScheduler::releaseCurrentEvents()
 {
     if (d_currentRecurringEvent) {
@@ -242,6 +392,31 @@ void EventScheduler::releaseCurrentEvents()
         d_eventQueue.releaseReferenceRaw(d_currentEvent);
         d_currentEvent = 0;
     }
+
+    if (d_currentRecurringWheelEvent) {
+        d_recurringWheel_mp->releaseReferenceRaw(d_currentRecurringWheelEvent);
+        d_currentRecurringWheelEvent = 0;
+    }
+
+    if (d_currentWheelEvent) {
+        d_eventWheel_mp->releaseReferenceRaw(d_currentWheelEvent);
+        d_currentWheelEvent = 0;
+    }
+}
+
+// PRIVATE ACCESSORS
+bsls::Types::Int64 EventScheduler::nextWheelEventTime() const
+{
+    bsls::Types::Int64 result = k_NO_EVENT;
+    bsls::Types::Int64 time;
+
+    if (0 == d_eventWheel_mp->nextTime(&time)) {
+        result = time;
+    }
+    if (0 == d_recurringWheel_mp->nextTime(&time) && time < result) {
+        result = time;
+    }
+    return result;
 }
 
 // CREATORS
@@ -258,6 +433,9 @@ EventScheduler::EventScheduler(bslma::Allocator *basicAllocator)
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentRecurringWheelEvent(0)
+, d_currentWheelEvent(0)
+, d_wakeTime(k_NOT_WAITING)
 , d_waitCount(0)
 , d_clockType(bsls::SystemClockType::e_REALTIME)
 {
@@ -277,9 +455,36 @@ EventScheduler::EventScheduler(bsls::SystemClockType::Enum  clockType,
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentRecurringWheelEvent(0)
+, d_currentWheelEvent(0)
+, d_wakeTime(k_NOT_WAITING)
+, d_waitCount(0)
+, d_clockType(clockType)
+{
+}
+
+EventScheduler::EventScheduler(bsls::SystemClockType::Enum  clockType,
+                               QueueType                    queueType,
+                               bslma::Allocator            *basicAllocator)
+: d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_eventQueue(basicAllocator)
+, d_recurringQueue(basicAllocator)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      &defaultDispatcherFunction)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_queueCondition(clockType)
+, d_running(false)
+, d_dispatcherAwaited(false)
+, d_currentRecurringEvent(0)
+, d_currentEvent(0)
+, d_currentRecurringWheelEvent(0)
+, d_currentWheelEvent(0)
+, d_wakeTime(k_NOT_WAITING)
 , d_waitCount(0)
 , d_clockType(clockType)
 {
+    createWheels(queueType);
 }
 
 EventScheduler::EventScheduler(
@@ -297,6 +502,9 @@ EventScheduler::EventScheduler(
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentRecurringWheelEvent(0)
+, d_currentWheelEvent(0)
+, d_wakeTime(k_NOT_WAITING)
 , d_waitCount(0)
 , d_clockType(bsls::SystemClockType::e_REALTIME)
 {
@@ -318,9 +526,38 @@ EventScheduler::EventScheduler(
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentRecurringWheelEvent(0)
+, d_currentWheelEvent(0)
+, d_wakeTime(k_NOT_WAITING)
+, d_waitCount(0)
+, d_clockType(clockType)
+{
+}
+
+EventScheduler::EventScheduler(
+                          const EventScheduler::Dispatcher&  dispatcherFunctor,
+                          bsls::SystemClockType::Enum        clockType,
+                          QueueType                          queueType,
+                          bslma::Allocator                  *basicAllocator)
+: d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_eventQueue(basicAllocator)
+, d_recurringQueue(basicAllocator)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      dispatcherFunctor)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_queueCondition(clockType)
+, d_running(false)
+, d_dispatcherAwaited(false)
+, d_currentRecurringEvent(0)
+, d_currentEvent(0)
+, d_currentRecurringWheelEvent(0)
+, d_currentWheelEvent(0)
+, d_wakeTime(k_NOT_WAITING)
 , d_waitCount(0)
 , d_clockType(clockType)
 {
+    createWheels(queueType);
 }
 
 EventScheduler::~EventScheduler()
@@ -357,7 +594,10 @@ int EventScheduler::start(const bslmt::ThreadAttributes& threadAttributes)
     if (bslmt::ThreadUtil::createWithAllocator(
                 &d_dispatcherThread,
                 modAttr,
-                bdlf::BindUtil::bind(&EventScheduler::dispatchEvents, this),
+                bdlf::BindUtil::bind(d_eventWheel_mp
+                                     ? &EventScheduler::dispatchWheelEvents
+                                     : &EventScheduler::dispatchEvents,
+                                     this),
                 allocator())) {
         return -1;                                                    // RETURN
     }
@@ -394,6 +634,17 @@ EventScheduler::scheduleEvent(EventHandle                  *event,
                               const bsls::TimeInterval&     epochTime,
                               const bsl::function<void()>&  callback)
 {
+    if (d_eventWheel_mp) {
+        event->d_handle.release();
+        d_eventWheel_mp->add(&event->d_wheelHandle,
+                             epochTime.totalMicroseconds(),
+                             callback);
+        notifyDispatcher(epochTime.totalMicroseconds());
+        return;                                                       // RETURN
+    }
+
+    event->d_wheelHandle.release();
+
     bool newTop;
 
     d_eventQueue.addR(&event->d_handle,
@@ -411,6 +662,14 @@ void EventScheduler::scheduleEventRaw(Event                        **event,
                                       const bsls::TimeInterval&      epochTime,
                                       const bsl::function<void()>&   callback)
 {
+    if (d_eventWheel_mp) {
+        d_eventWheel_mp->addRaw((EventWheel::Pair **)event,
+                                epochTime.totalMicroseconds(),
+                                callback);
+        notifyDispatcher(epochTime.totalMicroseconds());
+        return;                                                       // RETURN
+    }
+
     bool newTop;
 
     d_eventQueue.addRawR((EventQueue::Pair **)event,
@@ -443,6 +702,17 @@ EventScheduler::scheduleRecurringEvent(
 
     RecurringEventData recurringEventData(callback, interval);
 
+    if (d_recurringWheel_mp) {
+        event->d_handle.release();
+        d_recurringWheel_mp->add(&event->d_wheelHandle,
+                                 stime,
+                                 recurringEventData);
+        notifyDispatcher(stime);
+        return;                                                       // RETURN
+    }
+
+    event->d_wheelHandle.release();
+
     bool newTop;
 
     d_recurringQueue.addR(&event->d_handle,
@@ -475,6 +745,14 @@ EventScheduler::scheduleRecurringEventRaw(
 
     RecurringEventData recurringEventData(callback, interval);
 
+    if (d_recurringWheel_mp) {
+        d_recurringWheel_mp->addRaw((RecurringEventWheel::Pair **)event,
+                                    stime,
+                                    recurringEventData);
+        notifyDispatcher(stime);
+        return;                                                       // RETURN
+    }
+
     bool newTop;
     d_recurringQueue.addRawR((RecurringEventQueue::Pair **)event,
                              stime,
@@ -514,6 +792,26 @@ int EventScheduler::cancelEventAndWait(const RecurringEvent *handle)
     BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
                                             d_dispatcherThread));
 
+    if (d_recurringWheel_mp) {
+        const RecurringEventWheel::Pair *itemPtr =
+                       reinterpret_cast<const RecurringEventWheel::Pair *>(
+                                       reinterpret_cast<const void *>(handle));
+
+        int ret = d_recurringWheel_mp->remove(itemPtr);
+        if (RecurringEventWheel::e_INVALID == ret) {
+            return ret;                                               // RETURN
+        }
+
+        // Wait until the next iteration if currently executing the event.
+
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        while (d_currentRecurringWheelEvent == itemPtr) {
+            d_dispatcherAwaited = true;
+            d_iterationCondition.wait(&d_mutex);
+        }
+        return ret;                                                   // RETURN
+    }
+
     const RecurringEventQueue::Pair *itemPtr =
                        reinterpret_cast<const RecurringEventQueue::Pair *>(
                                        reinterpret_cast<const void *>(handle));
@@ -551,6 +849,24 @@ int EventScheduler::cancelEventAndWait(const Event *handle)
     BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
                                             d_dispatcherThread));
 
+    if (d_eventWheel_mp) {
+        const EventWheel::Pair *itemPtr =
+                             reinterpret_cast<const EventWheel::Pair *>(
+                                       reinterpret_cast<const void *>(handle));
+
+        int ret = d_eventWheel_mp->remove(itemPtr);
+        if (EventWheel::e_NOT_FOUND != ret) {
+            return ret;                                               // RETURN
+        }
+
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        while (d_currentWheelEvent == itemPtr) {
+            d_dispatcherAwaited = true;
+            d_iterationCondition.wait(&d_mutex);
+        }
+        return ret;                                                   // RETURN
+    }
+
     const EventQueue::Pair *itemPtr =
                              reinterpret_cast<const EventQueue::Pair *>(
                                        reinterpret_cast<const void *>(handle));
@@ -603,6 +919,17 @@ int EventScheduler::cancelEventAndWait(RecurringEventHandle *handle)
 int EventScheduler::rescheduleEvent(const Event               *handle,
                                     const bsls::TimeInterval&  newEpochTime)
 {
+    if (d_eventWheel_mp) {
+        int ret = d_eventWheel_mp->update(
+                                  reinterpret_cast<const EventWheel::Pair *>(
+                                      reinterpret_cast<const void *>(handle)),
+                                  newEpochTime.totalMicroseconds());
+        if (0 == ret) {
+            notifyDispatcher(newEpochTime.totalMicroseconds());
+        }
+        return ret;                                                   // RETURN
+    }
+
     const EventQueue::Pair *h = reinterpret_cast<const EventQueue::Pair *>(
                                        reinterpret_cast<const void *>(handle));
 
@@ -626,6 +953,25 @@ int EventScheduler::rescheduleEventAndWait(
     BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
                                             d_dispatcherThread));
 
+    if (d_eventWheel_mp) {
+        const EventWheel::Pair *h = reinterpret_cast<const EventWheel::Pair *>(
+                                       reinterpret_cast<const void *>(handle));
+
+        int ret = d_eventWheel_mp->update(h, newEpochTime.totalMicroseconds());
+        if (0 == ret) {
+            notifyDispatcher(newEpochTime.totalMicroseconds());
+        }
+
+        // Wait until event is rescheduled or dispatched.
+
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        while (d_currentWheelEvent == h) {
+            d_dispatcherAwaited = true;
+            d_iterationCondition.wait(&d_mutex);
+        }
+        return ret;                                                   // RETURN
+    }
+
     const EventQueue::Pair *h = reinterpret_cast<const EventQueue::Pair *>(
                                        reinterpret_cast<const void *>(handle));
     int ret;
@@ -665,6 +1011,12 @@ int EventScheduler::rescheduleEventAndWait(
 
 void EventScheduler::cancelAllEvents()
 {
+    if (d_eventWheel_mp) {
+        d_eventWheel_mp->removeAll();
+        d_recurringWheel_mp->removeAll();
+        return;                                                       // RETURN
+    }
+
     d_eventQueue.removeAll();
     d_recurringQueue.removeAll();
 }
@@ -674,12 +1026,12 @@ void EventScheduler::cancelAllEventsAndWait()
     BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
                                             d_dispatcherThread));
 
-    d_eventQueue.removeAll();
-    d_recurringQueue.removeAll();
+    cancelAllEvents();
 
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
     while (1) {
-        if (0 == d_currentEvent && 0 == d_currentRecurringEvent) {
+        if (0 == d_currentEvent && 0 == d_currentRecurringEvent
+         && 0 == d_currentWheelEvent && 0 == d_currentRecurringWheelEvent) {
             break;
         }
         else {
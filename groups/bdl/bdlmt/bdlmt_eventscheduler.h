@@ -20,7 +20,7 @@ BSLS_IDENT("$Id: $")
 //  bdlmt::EventSchedulerEventHandle: handle to a single scheduled event
 //  bdlmt::EventSchedulerRecurringEventHandle: handle to a recurring event
 //
-//@SEE_ALSO: bdlmt_timereventscheduler
+//@SEE_ALSO: bdlmt_timereventscheduler, bdlcc_timingwheel
 //
 //@DESCRIPTION: This component provides a thread-safe event scheduler.
 // 'bdlmt::EventScheduler', that implements methods to schedule and cancel
@@ -111,6 +111,27 @@ BSLS_IDENT("$Id: $")
 // dispatcher thread becomes available; once the backlog is worked off, events
 // will be executed at or near their scheduled times.
 //
+///Event Queue Types
+///-----------------
+// By default, the pending events of a scheduler are held in ordered queues
+// ('bdlcc::SkipList'), in which scheduling, rescheduling, and canceling an
+// event take time logarithmic in the number of pending events.  A scheduler
+// can instead be constructed with 'EventScheduler::e_TIMING_WHEEL', in which
+// case its events are held in hierarchical timing wheels
+// ('bdlcc::TimingWheel'), in which these operations take constant time.  A
+// timing-wheel scheduler also signals its dispatcher thread only when a new
+// (or rescheduled) event is due before the time at which the dispatcher is
+// set to wake up, rather than whenever it becomes the earliest event.
+//
+// Timing wheels are best suited to schedulers managing large numbers of
+// events, such as per-connection I/O timeouts, most of which are canceled or
+// rescheduled before they are due.  The behavior and guarantees of the two
+// kinds of schedulers are otherwise the same, except that, as a timing wheel
+// provides only a lower bound of the time of its earliest event, the
+// dispatcher thread of a timing-wheel scheduler may wake up a few times
+// (at most once per level of the wheel) before dispatching an event scheduled
+// far in the future.
+//
 ///Supported Clock-Types
 ///---------------------
 // The component 'bsls::SystemClockType' supplies the enumeration indicating
@@ -383,7 +404,9 @@ BSLS_IDENT("$Id: $")
 #include <bdlscm_version.h>
 
 #include <bdlcc_skiplist.h>
+#include <bdlcc_timingwheel.h>
 
+#include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 
 #include <bslmf_nestedtraitdeclaration.h>
@@ -433,6 +456,10 @@ class EventScheduler {
     typedef bdlcc::SkipList<bsls::Types::Int64,
                             bsl::function<void()> >        EventQueue;
 
+    typedef bdlcc::TimingWheel<RecurringEventData>         RecurringEventWheel;
+
+    typedef bdlcc::TimingWheel<bsl::function<void()> >     EventWheel;
+
     typedef bsl::function<bsls::TimeInterval()>            CurrentTimeFunctor;
 
     // FRIENDS
@@ -455,6 +482,14 @@ class EventScheduler {
                                                Dispatcher;
         // Defines a type alias for the dispatcher functor type.
 
+    enum QueueType {
+        // Enumerate the kinds of queues that may hold the pending events of a
+        // scheduler (see {Event Queue Types} in the component documentation).
+
+        e_SKIP_LIST,    // ordered queues (the default)
+        e_TIMING_WHEEL  // hierarchical timing wheels
+    };
+
   private:
     // NOT IMPLEMENTED
     EventScheduler(const EventScheduler&);
@@ -471,6 +506,15 @@ class EventScheduler {
 
     RecurringEventQueue   d_recurringQueue;     // recurring events
 
+    bslma::ManagedPtr<EventWheel>
+                          d_eventWheel_mp;      // events, if held in a timing
+                                                // wheel, and null otherwise
+
+    bslma::ManagedPtr<RecurringEventWheel>
+                          d_recurringWheel_mp;  // recurring events, if held in
+                                                // a timing wheel, and null
+                                                // otherwise
+
     Dispatcher            d_dispatcherFunctor;  // dispatch events
 
     bslmt::ThreadUtil::Handle
@@ -511,6 +555,20 @@ class EventScheduler {
                                                 // scheduled recurring event
                                                 // being executed
 
+    RecurringEventWheel::Pair
+                         *d_currentRecurringWheelEvent;
+                                                // 'd_currentRecurringEvent'
+                                                // of a timing-wheel scheduler
+
+    EventWheel::Pair     *d_currentWheelEvent;  // 'd_currentEvent' of a
+                                                // timing-wheel scheduler
+
+    bsls::AtomicInt64     d_wakeTime;           // time until which the
+                                                // dispatcher of a timing-wheel
+                                                // scheduler is waiting, or
+                                                // the minimum 'Int64' value if
+                                                // it is not waiting
+
     unsigned int          d_waitCount;          // count of the number of waits
                                                 // performed in the main
                                                 // dispatch loop, used in
@@ -537,15 +595,37 @@ class EventScheduler {
         // documentation).  Also note that this method may update the value of
         // 'now' with the current system time if necessary.
 
+    void createWheels(QueueType queueType);
+        // Create the timing wheels holding the events of this scheduler if
+        // the specified 'queueType' is 'e_TIMING_WHEEL', and do nothing
+        // otherwise.
+
     void dispatchEvents();
         // While d_running is true, execute events in the event and recurring
         // event queues at their scheduled times.  Note that this method
         // implements the dispatching thread.
 
+    void dispatchWheelEvents();
+        // While d_running is true, execute events in the event and recurring
+        // event timing wheels at their scheduled times.  Note that this method
+        // implements the dispatching thread of a timing-wheel scheduler.
+
+    void notifyDispatcher(bsls::Types::Int64 epochTime);
+        // Wake up the dispatcher thread of this timing-wheel scheduler if it
+        // is waiting until a time after the specified 'epochTime' (in
+        // microseconds).
+
     void releaseCurrentEvents();
-        // Release 'd_currentRecurringEvent' and 'd_currentEvent', if they
+        // Release 'd_currentRecurringEvent' and 'd_currentEvent' (or
+        // 'd_currentRecurringWheelEvent' and 'd_currentWheelEvent'), if they
         // refer to valid events.
 
+    // PRIVATE ACCESSORS
+    bsls::Types::Int64 nextWheelEventTime() const;
+        // Return a lower bound of the time of the earliest event held in the
+        // timing wheels of this scheduler, or the maximum 'Int64' value if
+        // there is no such event.
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(EventScheduler, bslma::UsesBslmaAllocator);
@@ -570,6 +650,19 @@ class EventScheduler {
         // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
         // the currently installed default allocator is used.
 
+    EventScheduler(bsls::SystemClockType::Enum  clockType,
+                   QueueType                    queueType,
+                   bslma::Allocator            *basicAllocator = 0);
+        // Construct an event scheduler using the default dispatcher functor
+        // (see the "The dispatcher thread and the dispatcher functor" section
+        // in component-level doc), use the specified 'clockType' to indicate
+        // the epoch used for all time intervals (see {Supported Clock-Types}
+        // in the component documentation), and hold the pending events in
+        // queues of the specified 'queueType' (see {Event Queue Types} in the
+        // component documentation).  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.
+
     explicit EventScheduler(const Dispatcher&  dispatcherFunctor,
                             bslma::Allocator  *basicAllocator = 0);
         // Construct an event scheduler using the specified 'dispatcherFunctor'
@@ -591,6 +684,20 @@ class EventScheduler {
         // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
         // the currently installed default allocator is used.
 
+    EventScheduler(const Dispatcher&            dispatcherFunctor,
+                   bsls::SystemClockType::Enum  clockType,
+                   QueueType                    queueType,
+                   bslma::Allocator            *basicAllocator = 0);
+        // Construct an event scheduler using the specified 'dispatcherFunctor'
+        // (see "The dispatcher thread and the dispatcher functor" section in
+        // component-level doc), use the specified 'clockType' to indicate the
+        // epoch used for all time intervals (see {Supported Clock-Types} in
+        // the component documentation), and hold the pending events in queues
+        // of the specified 'queueType' (see {Event Queue Types} in the
+        // component documentation).  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.
+
     ~EventScheduler();
         // Discard all unprocessed events and destroy this object.  The
         // behavior is undefined unless the scheduler is stopped.
@@ -822,6 +929,10 @@ class EventScheduler {
 
     int numRecurringEvents() const;
         // Return the number of recurring events registered with this
+        // scheduler.
+
+    QueueType queueType() const;
+        // Return the type of the queues holding the pending events of this
         // scheduler.
 
                                   // Aspects
@@ -844,8 +955,14 @@ class EventSchedulerEventHandle
     typedef bdlcc::SkipList<bsls::Types::Int64,
                             bsl::function<void()> > EventQueue;
 
+    typedef bdlcc::TimingWheel<bsl::function<void()> >
+                                                    EventWheel;
+
     // DATA
-    EventQueue::PairHandle  d_handle;
+    EventQueue::PairHandle  d_handle;       // event of a skip-list scheduler
+
+    EventWheel::PairHandle  d_wheelHandle;  // event of a timing-wheel
+                                            // scheduler
 
     // FRIENDS
     friend class EventScheduler;
@@ -895,9 +1012,14 @@ class EventSchedulerRecurringEventHandle
                                                        RecurringEventData;
     typedef bdlcc::SkipList<bsls::Types::Int64,
                             RecurringEventData>        RecurringEventQueue;
+    typedef bdlcc::TimingWheel<RecurringEventData>     RecurringEventWheel;
 
     // DATA
-    RecurringEventQueue::PairHandle  d_handle;
+    RecurringEventQueue::PairHandle  d_handle;       // event of a skip-list
+                                                     // scheduler
+
+    RecurringEventWheel::PairHandle  d_wheelHandle;  // event of a
+                                                     // timing-wheel scheduler
 
     // FRIENDS
     friend class EventScheduler;
@@ -1005,6 +1127,7 @@ inline
 EventSchedulerEventHandle::EventSchedulerEventHandle(
                                      const EventSchedulerEventHandle& original)
 : d_handle(original.d_handle)
+, d_wheelHandle(original.d_wheelHandle)
 {
 }
 
@@ -1018,7 +1141,8 @@ inline
 EventSchedulerEventHandle&
 EventSchedulerEventHandle::operator=(const EventSchedulerEventHandle& rhs)
 {
-    d_handle = rhs.d_handle;
+    d_handle      = rhs.d_handle;
+    d_wheelHandle = rhs.d_wheelHandle;
     return *this;
 }
 
@@ -1026,6 +1150,7 @@ inline
 void EventSchedulerEventHandle::release()
 {
     d_handle.release();
+    d_wheelHandle.release();
 }
 }  // close package namespace
 
@@ -1037,6 +1162,10 @@ inline
 bdlmt::EventSchedulerEventHandle::
 operator const bdlmt::EventSchedulerEventHandle::Event*() const
 {
+    if (d_wheelHandle.isValid()) {
+        return (const Event*)(const void*)(
+                                      (const EventWheel::Pair*)d_wheelHandle);
+    }
     return (const Event*)((const EventQueue::Pair*)d_handle);
 }
 
@@ -1056,6 +1185,7 @@ inline
 EventSchedulerRecurringEventHandle::EventSchedulerRecurringEventHandle(
                             const EventSchedulerRecurringEventHandle& original)
 : d_handle(original.d_handle)
+, d_wheelHandle(original.d_wheelHandle)
 {
 }
 
@@ -1069,6 +1199,7 @@ inline
 void EventSchedulerRecurringEventHandle::release()
 {
     d_handle.release();
+    d_wheelHandle.release();
 }
 
 inline
@@ -1076,7 +1207,8 @@ EventSchedulerRecurringEventHandle&
 EventSchedulerRecurringEventHandle::operator=(
                                  const EventSchedulerRecurringEventHandle& rhs)
 {
-    d_handle = rhs.d_handle;
+    d_handle      = rhs.d_handle;
+    d_wheelHandle = rhs.d_wheelHandle;
     return *this;
 }
 }  // close package namespace
@@ -1089,6 +1221,10 @@ inline
 bdlmt::EventSchedulerRecurringEventHandle::operator
        const bdlmt::EventSchedulerRecurringEventHandle::RecurringEvent*() const
 {
+    if (d_wheelHandle.isValid()) {
+        return (const RecurringEvent*)(const void*)(
+                             (const RecurringEventWheel::Pair*)d_wheelHandle);
+    }
     return (const RecurringEvent*)((const RecurringEventQueue::Pair*)d_handle);
 }
 
@@ -1102,6 +1238,13 @@ namespace bdlmt {
 inline
 int EventScheduler::cancelEvent(const Event *handle)
 {
+    if (d_eventWheel_mp) {
+        return d_eventWheel_mp->remove(
+                               reinterpret_cast<const EventWheel::Pair*>(
+                                       reinterpret_cast<const void*>(handle)));
+                                                                      // RETURN
+    }
+
     const EventQueue::Pair *itemPtr =
                         reinterpret_cast<const EventQueue::Pair*>(
                                         reinterpret_cast<const void*>(handle));
@@ -1112,6 +1255,13 @@ int EventScheduler::cancelEvent(const Event *handle)
 inline
 int EventScheduler::cancelEvent(const RecurringEvent *handle)
 {
+    if (d_recurringWheel_mp) {
+        return d_recurringWheel_mp->remove(
+                        reinterpret_cast<const RecurringEventWheel::Pair*>(
+                                       reinterpret_cast<const void*>(handle)));
+                                                                      // RETURN
+    }
+
     const RecurringEventQueue::Pair *itemPtr =
                 reinterpret_cast<const RecurringEventQueue::Pair*>(
                                         reinterpret_cast<const void*>(handle));
@@ -1129,6 +1279,12 @@ void EventScheduler::scheduleEvent(const bsls::TimeInterval&    epochTime,
 inline
 void EventScheduler::releaseEventRaw(Event *handle)
 {
+    if (d_eventWheel_mp) {
+        d_eventWheel_mp->releaseReferenceRaw(
+                                     reinterpret_cast<EventWheel::Pair*>(
+                                             reinterpret_cast<void*>(handle)));
+        return;                                                       // RETURN
+    }
     d_eventQueue.releaseReferenceRaw(reinterpret_cast<EventQueue::Pair*>(
                                              reinterpret_cast<void*>(handle)));
 }
@@ -1136,6 +1292,12 @@ void EventScheduler::releaseEventRaw(Event *handle)
 inline
 void EventScheduler::releaseEventRaw(RecurringEvent *handle)
 {
+    if (d_recurringWheel_mp) {
+        d_recurringWheel_mp->releaseReferenceRaw(
+                            reinterpret_cast<RecurringEventWheel::Pair*>(
+                                             reinterpret_cast<void*>(handle)));
+        return;                                                       // RETURN
+    }
     d_recurringQueue.releaseReferenceRaw(
                          reinterpret_cast<RecurringEventQueue::Pair*>(
                                              reinterpret_cast<void*>(handle)));
@@ -1155,6 +1317,13 @@ inline
 EventScheduler::Event*
 EventScheduler::addEventRefRaw(Event *handle) const
 {
+    if (d_eventWheel_mp) {
+        return reinterpret_cast<Event*>(d_eventWheel_mp->addPairReferenceRaw(
+                                     reinterpret_cast<EventWheel::Pair*>(
+                                            reinterpret_cast<void*>(handle))));
+                                                                      // RETURN
+    }
+
     EventQueue::Pair *h = reinterpret_cast<EventQueue::Pair*>(
                                               reinterpret_cast<void*>(handle));
     return reinterpret_cast<Event*>(d_eventQueue.addPairReferenceRaw(h));
@@ -1164,6 +1333,14 @@ inline
 EventScheduler::RecurringEvent*
 EventScheduler::addRecurringEventRefRaw(RecurringEvent *handle) const
 {
+    if (d_recurringWheel_mp) {
+        return reinterpret_cast<RecurringEvent*>(
+                         d_recurringWheel_mp->addPairReferenceRaw(
+                            reinterpret_cast<RecurringEventWheel::Pair*>(
+                                            reinterpret_cast<void*>(handle))));
+                                                                      // RETURN
+    }
+
     RecurringEventQueue::Pair *h =
                                reinterpret_cast<RecurringEventQueue::Pair*>(
                                               reinterpret_cast<void*>(handle));
@@ -1186,13 +1363,21 @@ bsls::TimeInterval EventScheduler::now() const
 inline
 int EventScheduler::numEvents() const
 {
-    return d_eventQueue.length();
+    return d_eventWheel_mp ? d_eventWheel_mp->length()
+                           : d_eventQueue.length();
 }
 
 inline
 int EventScheduler::numRecurringEvents() const
 {
-    return d_recurringQueue.length();
+    return d_recurringWheel_mp ? d_recurringWheel_mp->length()
+                               : d_recurringQueue.length();
+}
+
+inline
+EventScheduler::QueueType EventScheduler::queueType() const
+{
+    return d_eventWheel_mp ? e_TIMING_WHEEL : e_SKIP_LIST;
 }
 
                                   // Aspects
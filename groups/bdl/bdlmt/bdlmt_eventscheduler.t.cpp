@@ -52,6 +52,7 @@
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
 #include <bsl_utility.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;  // automatically added by script
@@ -96,6 +97,8 @@ using namespace bsl;  // automatically added by script
 //
 // [08] bdlmt::EventScheduler(dispatcher, allocator = 0);
 // [20] bdlmt::EventScheduler(disp, clockType, alloc = 0);
+// [27] bdlmt::EventScheduler(clockType, queueType, alloc = 0);
+// [27] bdlmt::EventScheduler(disp, clockType, queueType, alloc = 0);
 //
 // [01] ~bdlmt::EventScheduler();
 //
@@ -118,6 +121,7 @@ using namespace bsl;  // automatically added by script
 // [21] bsls::SystemClockType::Enum clockType() const;
 // [23] bsls::TimeInterval now() const;
 // [24] bslma::Allocator *allocator() const;
+// [27] QueueType queueType() const;
 //-----------------------------------------------------------------------------
 // [01] BREATHING TEST
 // [25] DRQS 150355963: 'advanceTime' WITH UNDER A MICROSECOND
@@ -126,7 +130,9 @@ using namespace bsl;  // automatically added by script
 // [10] TESTING CONCURRENT SCHEDULING AND CANCELLING
 // [11] TESTING CONCURRENT SCHEDULING AND CANCELLING-ALL
 // [22] CLOCK REPLACEMENT BREATHING TEST
-// [27] USAGE EXAMPLE
+// [27] TIMING-WHEEL QUEUES
+// [28] USAGE EXAMPLE
+// [-2] PERFORMANCE OF SCHEDULING AND CANCELING TIMEOUTS
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -957,6 +963,29 @@ void my_Server::dataAvailable(my_Server::Connection *connection,
 
 }  // close namespace EVENTSCHEDULER_TEST_CASE_USAGE
 
+// ============================================================================
+//                         CASE 27 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace EVENTSCHEDULER_TEST_CASE_27 {
+
+void increment(bsls::AtomicInt *counter)
+    // Increment the specified 'counter'.
+{
+    ++*counter;
+}
+
+void waitForCount(const bsls::AtomicInt& counter, int expected)
+    // Wait (for at most 10 seconds) until the specified 'counter' reaches the
+    // specified 'expected' value.
+{
+    for (int i = 0; i < 1000 && counter < expected; ++i) {
+        bslmt::ThreadUtil::microSleep(10000);
+    }
+}
+
+}  // close namespace EVENTSCHEDULER_TEST_CASE_27
+
 // ============================================================================
 //                         CASE 25 RELATED ENTITIES
 // ----------------------------------------------------------------------------
@@ -2380,7 +2409,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 27: {
+      case 28: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLES:
         //
@@ -2441,6 +2470,233 @@ int main(int argc, char *argv[])
         ASSERT(0 < ta.numAllocations());
         ASSERT(0 == ta.numBytesInUse());
       } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // TIMING-WHEEL QUEUES
+        //
+        // Concerns:
+        //: 1 The constructors taking a 'QueueType' create a scheduler holding
+        //:   its events in queues of that type, as reported by 'queueType';
+        //:   the other constructors create skip-list schedulers.
+        //:
+        //: 2 A timing-wheel scheduler dispatches one-time and recurring
+        //:   events at their scheduled times, including events scheduled in
+        //:   the past and events scheduled far in the future, under the
+        //:   control of a test time source.
+        //:
+        //: 3 The handle and raw APIs ('cancelEvent', 'rescheduleEvent', the
+        //:   '...AndWait' variants, 'releaseEventRaw', 'addEventRefRaw', and
+        //:   'cancelAllEvents') behave as for a skip-list scheduler, and
+        //:   'numEvents' and 'numRecurringEvents' report the pending events.
+        //:
+        //: 4 A waiting dispatcher is woken up by an event scheduled, or
+        //:   rescheduled, before the time it is waiting for.
+        //:
+        //: 5 All memory is supplied by the allocator of the scheduler.
+        //
+        // Plan:
+        //: 1 Construct schedulers with each constructor and verify
+        //:   'queueType'.  (C-1)
+        //:
+        //: 2 Using a test time source, schedule events at various offsets,
+        //:   advance the time, and verify the events executed at each step.
+        //:   (C-2..3)
+        //:
+        //: 3 Using the real clock, schedule an event far in the future, start
+        //:   the scheduler, then schedule (and reschedule) events due soon,
+        //:   and verify that they are executed promptly.  (C-4)
+        //:
+        //: 4 Use a test allocator for all the schedulers and verify that no
+        //:   memory is in use after their destruction.  (C-5)
+        //
+        // Testing:
+        //   bdlmt::EventScheduler(clockType, queueType, alloc = 0);
+        //   bdlmt::EventScheduler(disp, clockType, queueType, alloc = 0);
+        //   QueueType queueType() const;
+        //   TIMING-WHEEL QUEUES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TIMING-WHEEL QUEUES" << endl
+                          << "===================" << endl;
+
+        using namespace EVENTSCHEDULER_TEST_CASE_27;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard defaultAllocGuard(&da);
+
+        if (verbose) cout << "\tTesting 'queueType'." << endl;
+        {
+            const bsls::SystemClockType::Enum RT =
+                                             bsls::SystemClockType::e_REALTIME;
+            const Obj::Dispatcher dispatcher(
+                             &EVENTSCHEDULER_TEST_CASE_20::dispatcherFunction);
+
+            Obj mA(&oa);
+            Obj mB(RT, &oa);
+            Obj mC(RT, Obj::e_SKIP_LIST, &oa);
+            Obj mD(RT, Obj::e_TIMING_WHEEL, &oa);
+            Obj mE(dispatcher, RT, Obj::e_TIMING_WHEEL, &oa);
+            Obj mF(dispatcher, RT, Obj::e_SKIP_LIST, &oa);
+
+            ASSERT(Obj::e_SKIP_LIST    == mA.queueType());
+            ASSERT(Obj::e_SKIP_LIST    == mB.queueType());
+            ASSERT(Obj::e_SKIP_LIST    == mC.queueType());
+            ASSERT(Obj::e_TIMING_WHEEL == mD.queueType());
+            ASSERT(Obj::e_TIMING_WHEEL == mE.queueType());
+            ASSERT(Obj::e_SKIP_LIST    == mF.queueType());
+
+            ASSERT(RT  == mD.clockType());
+            ASSERT(&oa == mD.allocator());
+            ASSERT(&oa == mE.allocator());
+        }
+        ASSERT(0 == oa.numBytesInUse());
+
+        if (verbose) cout << "\tTesting with a test time source." << endl;
+        {
+            const Obj::Dispatcher dispatcher(
+                             &EVENTSCHEDULER_TEST_CASE_20::dispatcherFunction);
+
+            Obj mX(dispatcher,
+                   bsls::SystemClockType::e_MONOTONIC,
+                   Obj::e_TIMING_WHEEL,
+                   &oa);
+            bdlmt::EventSchedulerTestTimeSource timeSource(&mX);
+
+            const bsls::TimeInterval T0 = timeSource.now();
+
+            bsls::AtomicInt counts[8];
+
+            EventHandle          h0, h1, h2, h3;
+            RecurringEventHandle r0, r1;
+            Event               *raw;
+
+            mX.scheduleEvent(&h0, T0 - 5,    bdlf::BindUtil::bind(&increment,
+                                                                 &counts[0]));
+            mX.scheduleEvent(&h1, T0 + 10,   bdlf::BindUtil::bind(&increment,
+                                                                 &counts[1]));
+            mX.scheduleEvent(&h2, T0 + 10,   bdlf::BindUtil::bind(&increment,
+                                                                 &counts[2]));
+            mX.scheduleEvent(&h3, T0 + 3600, bdlf::BindUtil::bind(&increment,
+                                                                 &counts[3]));
+            mX.scheduleEventRaw(&raw,
+                                T0 + 20,
+                                bdlf::BindUtil::bind(&increment, &counts[4]));
+            mX.scheduleRecurringEvent(&r0,
+                                      bsls::TimeInterval(7),
+                                      bdlf::BindUtil::bind(&increment,
+                                                           &counts[5]));
+            mX.scheduleRecurringEvent(&r1,
+                                      bsls::TimeInterval(30),
+                                      bdlf::BindUtil::bind(&increment,
+                                                           &counts[6]),
+                                      T0 + 1);
+            mX.scheduleEvent(T0 + 40,
+                             bdlf::BindUtil::bind(&increment, &counts[7]));
+
+            ASSERT(6 == mX.numEvents());
+            ASSERT(2 == mX.numRecurringEvents());
+
+            ASSERT(0 == mX.cancelEvent(h2));
+            ASSERT(0 != mX.cancelEvent(h2));
+            ASSERT(5 == mX.numEvents());
+
+            Event *raw2 = mX.addEventRefRaw(raw);
+            ASSERT(raw2 == raw);
+            mX.releaseEventRaw(raw2);
+
+            mX.start();
+
+            timeSource.advanceTime(bsls::TimeInterval(1));     // T0 + 1
+
+            ASSERTV(counts[0], 1 == counts[0]);
+            ASSERTV(counts[6], 1 == counts[6]);
+            ASSERT(0 != mX.cancelEvent(h0));
+
+            timeSource.advanceTime(bsls::TimeInterval(9));     // T0 + 10
+
+            ASSERTV(counts[1], 1 == counts[1]);
+            ASSERTV(counts[2], 0 == counts[2]);
+            ASSERTV(counts[5], 1 == counts[5]);
+
+            ASSERT(0 == mX.rescheduleEvent(raw, T0 + 15));
+            timeSource.advanceTime(bsls::TimeInterval(5));     // T0 + 15
+
+            ASSERTV(counts[4], 1 == counts[4]);
+            ASSERT(0 != mX.rescheduleEvent(raw, T0 + 50));
+            mX.releaseEventRaw(raw);
+
+            ASSERT(0 == mX.rescheduleEventAndWait(h3, T0 + 60));
+
+            timeSource.advanceTime(bsls::TimeInterval(20));    // T0 + 35
+
+            ASSERTV(counts[5], 5 == counts[5]);
+            ASSERTV(counts[6], 2 == counts[6]);
+            ASSERTV(counts[7], 0 == counts[7]);
+            ASSERTV(counts[3], 0 == counts[3]);
+
+            ASSERT(0 == mX.cancelEventAndWait(&r0));
+            ASSERT(!r0);
+            ASSERT(1 == mX.numRecurringEvents());
+            ASSERT(2 == mX.numEvents());
+
+            timeSource.advanceTime(bsls::TimeInterval(30));    // T0 + 65
+
+            ASSERTV(counts[3], 1 == counts[3]);
+            ASSERTV(counts[5], 5 == counts[5]);
+            ASSERTV(counts[6], 3 == counts[6]);
+            ASSERTV(counts[7], 1 == counts[7]);
+            ASSERT(0 == mX.numEvents());
+
+            mX.cancelAllEventsAndWait();
+            ASSERT(0 == mX.numRecurringEvents());
+
+            mX.stop();
+        }
+        ASSERT(0 == oa.numBytesInUse());
+
+        if (verbose) cout << "\tTesting the wake up of the dispatcher."
+                          << endl;
+        {
+            Obj mX(bsls::SystemClockType::e_MONOTONIC,
+                   Obj::e_TIMING_WHEEL,
+                   &oa);
+
+            bsls::AtomicInt counts[3];
+
+            EventHandle h0, h1;
+
+            mX.scheduleEvent(&h0,
+                             mX.now() + 3600,
+                             bdlf::BindUtil::bind(&increment, &counts[0]));
+            mX.start();
+            microSleep(50000, 0);
+
+            const bsls::TimeInterval start = mX.now();
+
+            mX.scheduleEvent(start + bsls::TimeInterval(0, 50000000),
+                             bdlf::BindUtil::bind(&increment, &counts[1]));
+            waitForCount(counts[1], 1);
+            ASSERT(1 == counts[1]);
+            ASSERT(mX.now() - start < bsls::TimeInterval(5));
+
+            mX.scheduleEvent(&h1,
+                             mX.now() + 3600,
+                             bdlf::BindUtil::bind(&increment, &counts[2]));
+            microSleep(50000, 0);
+            ASSERT(0 == mX.rescheduleEvent(h1, mX.now()));
+            waitForCount(counts[2], 1);
+            ASSERT(1 == counts[2]);
+
+            ASSERT(0 == counts[0]);
+            ASSERT(1 == mX.numEvents());
+
+            mX.stop();
+        }
+        ASSERT(0 == oa.numBytesInUse());
+        ASSERT(0 == da.numBytesInUse());
+      } break;
       case 26: {
         // --------------------------------------------------------------------
         // DRQS 150475152: AFTER TEST TIME SOURCE DESTRUCTION
@@ -6121,6 +6377,83 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE OF SCHEDULING AND CANCELING TIMEOUTS
+        //
+        // Concerns:
+        //: 1 Scheduling, rescheduling, and canceling events that are not due
+        //:   (such as I/O timeouts) is faster with timing-wheel queues than
+        //:   with skip-list queues when many events are pending.
+        //
+        // Plan:
+        //: 1 For each queue type, schedule a number of events (argument 2,
+        //:   default 100000) due within the next minute in a started
+        //:   scheduler, reschedule each of them several times (modeling the
+        //:   rearming of a timeout upon the reception of data), then cancel
+        //:   them, and report the elapsed times.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE OF SCHEDULING AND CANCELING TIMEOUTS
+        // --------------------------------------------------------------------
+
+        cout << "PERFORMANCE OF SCHEDULING AND CANCELING TIMEOUTS" << endl
+             << "================================================" << endl;
+
+        int numEvents = argc > 2 ? atoi(argv[2]) : 0;
+        if (numEvents <= 0) {
+            numEvents = 100000;
+        }
+        const int k_NUM_RESCHEDULES = 5;
+
+        const Obj::QueueType QUEUE_TYPES[] = { Obj::e_SKIP_LIST,
+                                               Obj::e_TIMING_WHEEL };
+        const char *const    QUEUE_NAMES[] = { "skip list:   ",
+                                               "timing wheel:" };
+
+        for (int q = 0; q < 2; ++q) {
+            Obj mX(bsls::SystemClockType::e_MONOTONIC, QUEUE_TYPES[q], &ta);
+            mX.start();
+
+            bsl::vector<EventHandle> handles(numEvents, &ta);
+
+            // Spread the events pseudo-randomly over 30 seconds, starting 30
+            // seconds from now.
+
+            bsl::vector<bsls::TimeInterval> times(numEvents, &ta);
+            {
+                const bsls::TimeInterval now = mX.now();
+                unsigned int             seed = 1;
+                for (int i = 0; i < numEvents; ++i) {
+                    seed = seed * 1103515245 + 12345;
+                    times[i] = now + 30
+                             + bsls::TimeInterval(0, (seed >> 8) % 30000000
+                                                                     * 1000);
+                }
+            }
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < numEvents; ++i) {
+                mX.scheduleEvent(&handles[i], times[i], &noop);
+            }
+            for (int r = 1; r <= k_NUM_RESCHEDULES; ++r) {
+                for (int i = 0; i < numEvents; ++i) {
+                    mX.rescheduleEvent(handles[i], times[i] + r);
+                }
+            }
+            for (int i = 0; i < numEvents; ++i) {
+                mX.cancelEvent(&handles[i]);
+            }
+            timer.stop();
+
+            ASSERT(0 == mX.numEvents());
+            mX.stop();
+
+            cout << QUEUE_NAMES[q] << " " << timer.elapsedTime() << "s"
+                 << endl;
+        }
+      } break;
       case -100: {
         // --------------------------------------------------------------------
         // The router simulation (kind of) test
@@ -13,6 +13,7 @@ BSLS_IDENT_RCSID(bdlmt_multiqueuethreadpool_cpp,"$Id$ $CSID$")
 #include <bslmt_threadutil.h>
 #include <bslmt_writelockguard.h>
 
+#include <bslma_deallocatorproctor.h>
 #include <bslma_default.h>
 
 #include <bsls_assert.h>
@@ -20,10 +21,10 @@ BSLS_IDENT_RCSID(bdlmt_multiqueuethreadpool_cpp,"$Id$ $CSID$")
 #include <bsls_stackaddressutil.h>
 #include <bsls_systemtime.h>
 #include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
 
 #include <bsl_algorithm.h>
 #include <bsl_memory.h>
-#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace {
@@ -42,15 +43,143 @@ void createMultiQueueThreadPool_Queue(
                                                   allocator);
 }
 
+class DecrementGuard {
+    // This class implements a guard that decrements an atomic counter when
+    // it is destroyed.
+
+    // DATA
+    bsls::AtomicInt *d_counter_p;  // counter to decrement (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    DecrementGuard(const DecrementGuard&);
+    DecrementGuard& operator=(const DecrementGuard&);
+
+  public:
+    // CREATORS
+    explicit DecrementGuard(bsls::AtomicInt *counter)
+        // Create a guard that decrements the specified 'counter' on
+        // destruction.
+    : d_counter_p(counter)
+    {
+    }
+
+    ~DecrementGuard()
+        // Decrement the counter supplied at construction.
+    {
+        d_counter_p->add(-1);
+    }
+};
+
 }  // close unnamed namespace
 
 namespace bdlmt {
 
+                      // ================================
+                      // struct MultiQueueThreadPool_Node
+                      // ================================
+
+struct MultiQueueThreadPool_Node {
+    // This 'struct' provides a node of the job lists of a
+    // 'MultiQueueThreadPool_Queue'.  Nodes are allocated from the node pool of
+    // the owning 'MultiQueueThreadPool'.
+
+    // PUBLIC TYPES
+    typedef MultiQueueThreadPool::Job Job;
+
+    // DATA
+    MultiQueueThreadPool_Node *d_next_p;       // next node in the list
+
+    bsls::Types::Int64         d_enqueueTime;  // 'bsls::TimeUtil::getTimer()'
+                                               // when the job was enqueued,
+                                               // or 0 if not measured
+
+    Job                        d_job;          // job to execute
+
+    // CREATORS
+    MultiQueueThreadPool_Node(const Job&        job,
+                              bool              isTimingEnabled,
+                              bslma::Allocator *allocator)
+        // Create a node holding a copy of the specified 'job', recording the
+        // current time as the time of enqueuing if the specified
+        // 'isTimingEnabled' is 'true', and 0 otherwise, and using the
+        // specified 'allocator' to supply memory for the copy.
+    : d_next_p(0)
+    , d_enqueueTime(isTimingEnabled ? bsls::TimeUtil::getTimer() : 0)
+    , d_job(bsl::allocator_arg, allocator, job)
+    {
+    }
+};
+
                      // --------------------------------
                      // class MultiQueueThreadPool_Queue
                      // --------------------------------
 
 // PRIVATE MANIPULATORS
+MultiQueueThreadPool_Node *MultiQueueThreadPool_Queue::popFront()
+{
+    BSLMT_MUTEXASSERT_IS_LOCKED(&d_lock);
+
+    Node *node = d_list_p;
+
+    if (0 == node) {
+        // Move the jobs appended by 'pushBack' to 'd_list_p', reversing their
+        // order so that they are executed in the order of enqueuing.
+
+        Node *incoming = d_incoming.swapAcqRel(0);
+        while (incoming) {
+            Node *next = incoming->d_next_p;
+
+            incoming->d_next_p = node;
+            node               = incoming;
+            incoming           = next;
+        }
+    }
+
+    BSLS_ASSERT(node);
+
+    d_list_p = node->d_next_p;
+
+    return node;
+}
+
+void MultiQueueThreadPool_Queue::removeAll()
+{
+    bdlma::ConcurrentPool& nodePool = d_multiQueueThreadPool_p->d_nodePool;
+
+    Node *lists[] = { d_list_p, d_incoming.swapAcqRel(0) };
+
+    d_list_p = 0;
+
+    for (int i = 0; i < 2; ++i) {
+        Node *node = lists[i];
+        while (node) {
+            Node *next = node->d_next_p;
+
+            node->~Node();
+            nodePool.deallocate(node);
+
+            node = next;
+        }
+    }
+}
+
+void MultiQueueThreadPool_Queue::scheduleIfNotScheduled()
+{
+    BSLMT_MUTEXASSERT_IS_LOCKED(&d_lock);
+
+    if (e_NOT_SCHEDULED == d_runState) {
+        d_runState = e_SCHEDULED;
+
+        ++d_multiQueueThreadPool_p->d_numActiveQueues;
+
+        int status = d_multiQueueThreadPool_p->d_threadPool_p->
+                                                    enqueueJob(d_processingCb);
+
+        BSLS_ASSERT_OPT(0 == status);  (void)status;
+    }
+}
+
 void MultiQueueThreadPool_Queue::setPaused()
 {
     BSLS_ASSERT(e_PAUSING == d_runState);
@@ -65,7 +194,7 @@ void MultiQueueThreadPool_Queue::setPaused()
 
     if (e_DELETING == d_enqueueState) {
         int status = d_multiQueueThreadPool_p->d_threadPool_p->
-                                                    enqueueJob(d_list.front());
+                                                      enqueueJob(d_deletionCb);
 
         BSLS_ASSERT_OPT(0 == status);  (void)status;
 
@@ -83,22 +212,34 @@ MultiQueueThreadPool_Queue::MultiQueueThreadPool_Queue(
                                     MultiQueueThreadPool *multiQueueThreadPool,
                                     bslma::Allocator     *basicAllocator)
 : d_multiQueueThreadPool_p(multiQueueThreadPool)
-, d_list(basicAllocator)
+, d_incoming(0)
+, d_list_p(0)
+, d_numJobs(0)
+, d_numExecuting(0)
 , d_enqueueState(e_ENQUEUING_ENABLED)
+, d_numPushing(0)
 , d_runState(e_NOT_SCHEDULED)
 , d_batchSize(1)
+, d_isTimingEnabled(false)
 , d_lock()
 , d_pauseCondition()
 , d_pauseCount(0)
 , d_processingCb(bdlf::BindUtil::bind(
                                      &MultiQueueThreadPool_Queue::executeFront,
                                      this))
+, d_deletionCb(bsl::allocator_arg, basicAllocator)
 , d_processor(bslmt::ThreadUtil::invalidHandle())
+, d_numExecuted(0)
+, d_totalDispatchTime(0)
+, d_maxDispatchTime(0)
+, d_totalExecutionTime(0)
+, d_maxExecutionTime(0)
 {
 }
 
 MultiQueueThreadPool_Queue::~MultiQueueThreadPool_Queue()
 {
+    removeAll();
 }
 
 // MANIPULATORS
@@ -111,6 +252,11 @@ void MultiQueueThreadPool_Queue::setBatchSize(int batchSize)
     d_batchSize = batchSize;
 }
 
+void MultiQueueThreadPool_Queue::setTimingEnabled(bool enabled)
+{
+    d_isTimingEnabled.storeRelaxed(enabled);
+}
+
 int MultiQueueThreadPool_Queue::enable()
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
@@ -125,13 +271,25 @@ int MultiQueueThreadPool_Queue::enable()
 
 int MultiQueueThreadPool_Queue::disable()
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
 
-    if (e_DELETING == d_enqueueState) {
-        return 1;                                                     // RETURN
+        if (e_DELETING == d_enqueueState) {
+            return 1;                                                 // RETURN
+        }
+
+        d_enqueueState = e_ENQUEUING_DISABLED;
+    }
+
+    // Wait, with 'd_lock' unlocked, for the 'pushBack' calls that found
+    // enqueuing enabled to complete, so that no job is enqueued after this
+    // method returns (see 'pushBack').  The wait is bounded by the time to
+    // link and count one job.
+
+    while (0 != d_numPushing) {
+        bslmt::ThreadUtil::yield();
     }
 
-    d_enqueueState = e_ENQUEUING_DISABLED;
     return 0;
 }
 
@@ -169,41 +327,35 @@ void MultiQueueThreadPool_Queue::drainWaitWhilePausing()
 
 void MultiQueueThreadPool_Queue::executeFront()
 {
-    bsl::vector<Job> functors;
+    Node *batch = 0;  // nodes of the jobs to execute, in order
 
     {
         bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
 
-        BSLS_ASSERT(!d_list.empty());
-
         if (e_PAUSING == d_runState) {
             setPaused();
 
             return;                                                   // RETURN
         }
 
-        // If the queue is being deleted, the functor about to be popped is
-        // 'deleteQueueCb' and is not counted in 'd_numEnqueued' so must not be
-        // counted in 'd_numExecuted'.
+        // Note that a queue being deleted is always in the 'e_PAUSING' state,
+        // and its 'deleteQueueCb' is not held in the job lists.
 
-        bsl::size_t count;
+        BSLS_ASSERT(0 == d_numExecuting);
+        BSLS_ASSERT(0 <  d_numJobs);
 
-        if (e_DELETING != d_enqueueState) {
-            count = bsl::min(static_cast<bsl::size_t>(d_batchSize),
-                             d_list.size());
+        const int count = bsl::min(d_batchSize, d_numJobs.load());
 
-            d_multiQueueThreadPool_p->d_numExecuted += static_cast<int>(count);
-        }
-        else {
-            count = 1;
-        }
+        d_multiQueueThreadPool_p->d_numExecuted += count;
 
-        functors.reserve(count);
+        d_numExecuting = count;
 
-        for (bsl::size_t i = 0; i < count; ++i) {
-            functors.emplace_back(d_list.front());
-            d_list.pop_front();
+        Node **tail = &batch;
+        for (int i = 0; i < count; ++i) {
+            *tail = popFront();
+            tail  = &(*tail)->d_next_p;
         }
+        *tail = 0;
 
         d_processor = bslmt::ThreadUtil::self();
     }
@@ -215,8 +367,56 @@ void MultiQueueThreadPool_Queue::executeFront()
     // creating a new state to reflect this situation while the 'functors' are
     // executing, we leave 'd_runState' as 'e_SCHEDULED'.
 
-    for (bsl::size_t i = 0; i < functors.size(); ++i) {
-        functors[i]();
+    bdlma::ConcurrentPool& nodePool = d_multiQueueThreadPool_p->d_nodePool;
+
+    bsls::Types::Int64 totalDispatchTime  = 0;
+    bsls::Types::Int64 maxDispatchTime    = 0;
+    bsls::Types::Int64 totalExecutionTime = 0;
+    bsls::Types::Int64 maxExecutionTime   = 0;
+
+    if (d_isTimingEnabled.loadRelaxed()) {
+        bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+
+        while (batch) {
+            Node *node = batch;
+            batch      = node->d_next_p;
+
+            // Note that no enqueue time is recorded for a job enqueued while
+            // timing was disabled.
+
+            if (0 != node->d_enqueueTime) {
+                const bsls::Types::Int64 dispatchTime =
+                                                  start - node->d_enqueueTime;
+
+                totalDispatchTime += dispatchTime;
+                maxDispatchTime    = bsl::max(maxDispatchTime, dispatchTime);
+            }
+
+            node->d_job();
+
+            node->~Node();
+            nodePool.deallocate(node);
+
+            const bsls::Types::Int64 end = bsls::TimeUtil::getTimer();
+
+            const bsls::Types::Int64 executionTime = end - start;
+
+            totalExecutionTime += executionTime;
+            maxExecutionTime    = bsl::max(maxExecutionTime, executionTime);
+
+            start = end;
+        }
+    }
+    else {
+        while (batch) {
+            Node *node = batch;
+            batch      = node->d_next_p;
+
+            node->d_job();
+
+            node->~Node();
+            nodePool.deallocate(node);
+        }
     }
 
     // Note that 'pause' might be called while executing the functors since no
@@ -229,11 +429,25 @@ void MultiQueueThreadPool_Queue::executeFront()
 
         d_processor = bslmt::ThreadUtil::invalidHandle();
 
+        d_numExecuted        += d_numExecuting;
+        d_totalDispatchTime  += totalDispatchTime;
+        d_maxDispatchTime     = bsl::max(d_maxDispatchTime, maxDispatchTime);
+        d_totalExecutionTime += totalExecutionTime;
+        d_maxExecutionTime    = bsl::max(d_maxExecutionTime,
+                                         maxExecutionTime);
+
+        // A producer that enqueues a job after 'd_numJobs' is decremented to 0
+        // schedules this queue itself (once this lock is released).
+
+        const int numJobs = d_numJobs.add(-d_numExecuting);
+
+        d_numExecuting = 0;
+
         // As per the above, at this point 'e_SCHEDULED' does not imply there
         // is a job queued in the thread pool.
 
         if (e_SCHEDULED == d_runState) {
-            if (!d_list.empty()) {
+            if (0 < numJobs) {
                 int status = d_multiQueueThreadPool_p->d_threadPool_p->
                                                     enqueueJob(d_processingCb);
 
@@ -272,7 +486,7 @@ bool MultiQueueThreadPool_Queue::enqueueDeletion(
                                    cleanupFunctor,
                                    isProcessingThread ? 0 : completionSignal);
 
-    d_multiQueueThreadPool_p->d_numDeleted += static_cast<int>(d_list.size());
+    d_multiQueueThreadPool_p->d_numDeleted += d_numJobs - d_numExecuting;
 
     if (e_NOT_SCHEDULED == d_runState || e_PAUSED == d_runState) {
         // Note that 'd_numActiveQueues' is decremented at the completion of
@@ -291,7 +505,7 @@ bool MultiQueueThreadPool_Queue::enqueueDeletion(
 
         d_runState = e_PAUSING;
 
-        d_list.push_front(job);
+        d_deletionCb = job;
     }
 
     return isProcessingThread;
@@ -321,28 +535,62 @@ int MultiQueueThreadPool_Queue::initiatePause()
 
 int MultiQueueThreadPool_Queue::pushBack(const Job& functor)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+    // Note that the owning 'MultiQueueThreadPool' holds its lock for read
+    // while invoking this method, and for write while deleting the queue, so
+    // 'd_enqueueState' cannot become 'e_DELETING' during this method.
 
-    if (e_ENQUEUING_ENABLED == d_enqueueState) {
-        d_list.push_back(functor);
+    if (e_ENQUEUING_ENABLED != d_enqueueState.loadAcquire()) {
+        return 1;                                                     // RETURN
+    }
 
-        // Note that the following should match what is in 'pushFront'.
+    bdlma::ConcurrentPool& nodePool = d_multiQueueThreadPool_p->d_nodePool;
 
-        if (e_NOT_SCHEDULED == d_runState) {
-            d_runState = e_SCHEDULED;
+    void *arena = nodePool.allocate();
 
-            ++d_multiQueueThreadPool_p->d_numActiveQueues;
+    bslma::DeallocatorProctor<bdlma::ConcurrentPool> proctor(arena,
+                                                             &nodePool);
 
-            int status = d_multiQueueThreadPool_p->d_threadPool_p->
-                                                    enqueueJob(d_processingCb);
+    Node *node = new (arena) Node(functor,
+                                  d_isTimingEnabled.loadRelaxed(),
+                                  d_multiQueueThreadPool_p->d_allocator_p);
 
-            BSLS_ASSERT_OPT(0 == status);  (void)status;
+    // Announce this call before checking the enqueue state again: as both
+    // this increment and the store of the state in 'disable' are sequentially
+    // consistent, either the check below finds enqueuing disabled, or
+    // 'disable' finds this call in progress and waits for it to complete.
+    // Either way, no job is enqueued once 'disable' returns.
+
+    d_numPushing.add(1);
+    DecrementGuard pushingGuard(&d_numPushing);
+
+    if (e_ENQUEUING_ENABLED != d_enqueueState) {
+        node->~Node();
+        return 1;                                                     // RETURN
+    }
+
+    proctor.release();
+
+    Node *head = d_incoming.loadRelaxed();
+    while (1) {
+        node->d_next_p = head;
+
+        Node *previous = d_incoming.testAndSwapAcqRel(head, node);
+        if (previous == head) {
+            break;
         }
+        head = previous;
+    }
 
-        return 0;                                                     // RETURN
+    // Count the job after it is reachable from 'd_incoming', so that the
+    // processing thread finds the node of every job it counts.
+
+    if (1 == d_numJobs.add(1)) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+
+        scheduleIfNotScheduled();
     }
 
-    return 1;
+    return 0;
 }
 
 int MultiQueueThreadPool_Queue::pushFront(const Job& functor)
@@ -350,21 +598,30 @@ int MultiQueueThreadPool_Queue::pushFront(const Job& functor)
     bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
 
     if (e_ENQUEUING_ENABLED == d_enqueueState) {
-        d_list.push_front(functor);
+        bdlma::ConcurrentPool& nodePool =
+                                        d_multiQueueThreadPool_p->d_nodePool;
 
-        // Note that the following should match what is in 'pushBack'.
+        void *arena = nodePool.allocate();
 
-        if (e_NOT_SCHEDULED == d_runState) {
+        bslma::DeallocatorProctor<bdlma::ConcurrentPool> proctor(arena,
+                                                                 &nodePool);
 
-            d_runState = e_SCHEDULED;
+        Node *node = new (arena) Node(functor,
+                                      d_isTimingEnabled.loadRelaxed(),
+                                      d_multiQueueThreadPool_p->d_allocator_p);
 
-            ++d_multiQueueThreadPool_p->d_numActiveQueues;
+        proctor.release();
 
-            int status = d_multiQueueThreadPool_p->d_threadPool_p->
-                                                    enqueueJob(d_processingCb);
+        node->d_next_p = d_list_p;
+        d_list_p       = node;
 
-            BSLS_ASSERT_OPT(0 == status);  (void)status;
-        }
+        ++d_numJobs;
+
+        // Note that a producer that incremented 'd_numJobs' from 0 may be
+        // waiting for the lock, in which case it will find the queue
+        // scheduled.
+
+        scheduleIfNotScheduled();
 
         return 0;                                                     // RETURN
     }
@@ -374,12 +631,21 @@ int MultiQueueThreadPool_Queue::pushFront(const Job& functor)
 
 void MultiQueueThreadPool_Queue::reset()
 {
-    d_list.clear();
-    d_enqueueState = e_ENQUEUING_ENABLED;
-    d_runState     = e_NOT_SCHEDULED;
-    d_pauseCount   = 0;
-    d_processor    = bslmt::ThreadUtil::invalidHandle();
-
+    removeAll();
+
+    d_numJobs            = 0;
+    d_numExecuting       = 0;
+    d_enqueueState       = e_ENQUEUING_ENABLED;
+    d_runState           = e_NOT_SCHEDULED;
+    d_pauseCount         = 0;
+    d_deletionCb         = Job();
+    d_processor          = bslmt::ThreadUtil::invalidHandle();
+    d_isTimingEnabled    = false;
+    d_numExecuted        = 0;
+    d_totalDispatchTime  = 0;
+    d_maxDispatchTime    = 0;
+    d_totalExecutionTime = 0;
+    d_maxExecutionTime   = 0;
 }
 
 int MultiQueueThreadPool_Queue::resume()
@@ -406,7 +672,7 @@ int MultiQueueThreadPool_Queue::resume()
         return 1;                                                     // RETURN
     }
 
-    if (!d_list.empty()) {
+    if (0 < d_numJobs) {
         int status = d_multiQueueThreadPool_p->d_threadPool_p->
                                                     enqueueJob(d_processingCb);
 
@@ -484,6 +750,7 @@ MultiQueueThreadPool::MultiQueueThreadPool(
                               bslma::Allocator               *basicAllocator)
 : d_allocator_p(bslma::Default::allocator(basicAllocator))
 , d_threadPoolIsOwned(true)
+, d_nodePool(sizeof(MultiQueueThreadPool_Node), basicAllocator)
 , d_queuePool(bdlf::BindUtil::bind(&createMultiQueueThreadPool_Queue,
                                    bdlf::PlaceHolders::_1,
                                    bdlf::PlaceHolders::_2,
@@ -510,6 +777,7 @@ MultiQueueThreadPool::MultiQueueThreadPool(ThreadPool       *threadPool,
 : d_allocator_p(bslma::Default::allocator(basicAllocator))
 , d_threadPool_p(threadPool)
 , d_threadPoolIsOwned(false)
+, d_nodePool(sizeof(MultiQueueThreadPool_Node), basicAllocator)
 , d_queuePool(bdlf::BindUtil::bind(&createMultiQueueThreadPool_Queue,
                                    bdlf::PlaceHolders::_1,
                                    bdlf::PlaceHolders::_2,
@@ -70,6 +70,35 @@ BSLS_IDENT("$Id: $")
 // encouraged to use benchmarks to guide their decision when setting this
 // option.
 //
+///Job Storage
+///-----------
+// Jobs enqueued with 'enqueueJob' are appended to a lock-free list of the
+// queue without acquiring the lock of the queue, and the lock is acquired only
+// when a job is enqueued to an empty queue (i.e., when the queue must be
+// scheduled on the thread pool).  The thread processing a queue removes jobs
+// from the list, under the lock of the queue, once per batch.  The nodes of
+// the lists are obtained from a pool shared by all the queues of a
+// 'bdlmt::MultiQueueThreadPool', so that enqueuing a job whose functor fits in
+// the small-object buffer of 'bsl::function' does not allocate memory once the
+// pool is primed.
+//
+///Queue Metrics
+///-------------
+// The 'queueMetrics' method reports, for a given queue, the number of jobs
+// awaiting execution, the number of jobs executed, and the total and maximum
+// (1) time between the enqueuing of a job and the start of its execution
+// ("dispatch time"), and (2) time taken to execute a job ("execution time").
+// Times are measured using 'bsls::TimeUtil::getTimer' and reported in
+// nanoseconds.
+//
+// Reading the timer costs about as much as enqueuing a job, so the times are
+// measured only for queues for which 'setTimingEnabled' has been called with
+// 'true'; the number of pending and executed jobs is always maintained.  The
+// dispatch time of a job is measured only if timing was enabled when the job
+// was enqueued, and its execution time only if timing was enabled when the
+// thread pool started to process the batch holding the job.  Note that timing
+// is initially disabled for all queues.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -336,6 +365,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlcc_objectpool.h>
 
+#include <bdlma_concurrentpool.h>
+
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
 
@@ -350,8 +381,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bsls_assert.h>
 #include <bsls_atomic.h>
+#include <bsls_types.h>
 
-#include <bsl_deque.h>
 #include <bsl_functional.h>
 #include <bsl_map.h>
 
@@ -360,13 +391,22 @@ namespace bslmt { class Latch; }
 namespace bdlmt {
 
 class MultiQueueThreadPool;
+struct MultiQueueThreadPool_Node;
 
                      // ================================
                      // class MultiQueueThreadPool_Queue
                      // ================================
 
 class MultiQueueThreadPool_Queue {
-    // This private class provides a thread-safe, lightweight job queue.
+    // This private class provides a thread-safe, lightweight job queue.  Jobs
+    // appended by 'pushBack' are pushed onto a lock-free stack,
+    // 'd_incoming'; the processing thread, holding 'd_lock', moves the
+    // contents of 'd_incoming' onto 'd_list_p' in reverse order (i.e., in the
+    // order of enqueuing) when 'd_list_p' is exhausted.  'd_numJobs' counts
+    // the jobs in both lists plus the jobs being executed, and the producer
+    // that increments 'd_numJobs' from 0 is responsible for scheduling the
+    // queue.  As 'pushBack' does not hold 'd_lock', 'disable' waits for the
+    // 'pushBack' calls in progress, counted by 'd_numPushing', to complete.
 
   public:
     // PUBLIC TYPES
@@ -388,20 +428,42 @@ class MultiQueueThreadPool_Queue {
         e_PAUSED               // paused
     };
 
+    typedef MultiQueueThreadPool_Node Node;
+
     // DATA
     MultiQueueThreadPool      *d_multiQueueThreadPool_p;
                                                  // the 'MultiQueueThreadPool'
                                                  // that owns this object
 
-    bsl::deque<Job>            d_list;           // queue of jobs to be
-                                                 // executed
+    bsls::AtomicPointer<Node>  d_incoming;       // jobs appended by
+                                                 // 'pushBack', most recent
+                                                 // first
 
-    EnqueueState               d_enqueueState;   // maintains enqueue state
+    Node                      *d_list_p;         // jobs to be executed next,
+                                                 // in order
+
+    bsls::AtomicInt            d_numJobs;        // number of jobs in
+                                                 // 'd_incoming' and 'd_list_p'
+                                                 // plus 'd_numExecuting'
+
+    int                        d_numExecuting;   // number of jobs in the batch
+                                                 // being executed
+
+    bsls::AtomicInt            d_enqueueState;   // maintains enqueue state
+
+    bsls::AtomicInt            d_numPushing;     // number of 'pushBack' calls
+                                                 // in progress that may find
+                                                 // enqueuing enabled
 
     RunState                   d_runState;       // maintains run state
 
     int                        d_batchSize;      // execution batch size
 
+    bsls::AtomicBool           d_isTimingEnabled;
+                                                 // whether dispatch and
+                                                 // execution times are
+                                                 // measured
+
     mutable bslmt::Mutex       d_lock;           // protect queue and
                                                  // informational members
 
@@ -414,15 +476,52 @@ class MultiQueueThreadPool_Queue {
     Job                        d_processingCb;   // bound processing callback
                                                  // for pool
 
+    Job                        d_deletionCb;     // bound deletion callback,
+                                                 // enqueued to the pool when a
+                                                 // queue being deleted pauses
+
     bslmt::ThreadUtil::Handle  d_processor;      // current worker thread, or
                                                  // ThreadUtil::invalidHandle()
 
+    bsls::Types::Int64         d_numExecuted;    // number of jobs executed
+
+    bsls::Types::Int64         d_totalDispatchTime;
+                                                 // sum of the dispatch times
+                                                 // (ns) of executed jobs
+
+    bsls::Types::Int64         d_maxDispatchTime;
+                                                 // maximum dispatch time (ns)
+
+    bsls::Types::Int64         d_totalExecutionTime;
+                                                 // sum of the execution times
+                                                 // (ns) of executed jobs
+
+    bsls::Types::Int64         d_maxExecutionTime;
+                                                 // maximum execution time (ns)
+
     // NOT IMPLEMENTED
     MultiQueueThreadPool_Queue();
     MultiQueueThreadPool_Queue(const MultiQueueThreadPool_Queue&);
     MultiQueueThreadPool_Queue &operator=(const MultiQueueThreadPool_Queue &);
 
     // PRIVATE MANIPULATORS
+    Node *popFront();
+        // Remove the node at the front of this queue, and return it.  The
+        // behavior is undefined unless this queue's lock is in a locked state
+        // and the node of at least one job counted in 'd_numJobs' (and not
+        // being executed) has not been removed.
+
+    void removeAll();
+        // Destroy the jobs, and deallocate the nodes, of this queue.  The
+        // behavior is undefined unless no other thread is accessing this
+        // queue.
+
+    void scheduleIfNotScheduled();
+        // If this queue is in the 'e_NOT_SCHEDULED' state, enqueue the
+        // processing callback of this queue to the associated thread pool and
+        // change the state to 'e_SCHEDULED'.  The behavior is undefined unless
+        // this queue's lock is in a locked state.
+
     void setPaused();
         // Mark this queue as paused, notify any threads blocked on
         // 'd_pauseCondition', and schedule the deletion job if this queue is
@@ -454,9 +553,13 @@ class MultiQueueThreadPool_Queue {
         // 'prepareForDeletion' has already been called on this object.
 
     int disable();
-        // Disable enqueuing to this queue.  Return 0 on success, and a
-        // non-zero value otherwise.  This method will fail (with an error) if
-        // 'prepareForDeletion' has already been called on this object.
+        // Disable enqueuing to this queue, waiting for concurrent calls to
+        // 'pushBack' that found enqueuing enabled to complete.  Return 0 on
+        // success, and a non-zero value otherwise.  This method will fail
+        // (with an error) if 'prepareForDeletion' has already been called on
+        // this object.  Note that, on success, no job is enqueued to this
+        // queue by 'pushBack' after this method returns, until enqueuing is
+        // enabled again.
 
     void drainWaitWhilePausing();
         // Block until all threads waiting for this queue to pause are
@@ -496,7 +599,8 @@ class MultiQueueThreadPool_Queue {
 
     int pushBack(const Job& functor);
         // Enqueue the specified 'functor' at the end of this queue.  Return 0
-        // on success, and a non-zero value if enqueuing is disabled.
+        // on success, and a non-zero value if enqueuing is disabled.  Note
+        // that this queue's lock is acquired only if this queue was empty.
 
     int pushFront(const Job& functor);
         // Add the specified 'functor' at the front of this queue.  Return 0 on
@@ -511,8 +615,8 @@ class MultiQueueThreadPool_Queue {
 
     int resume();
         // Allow jobs on the queue to begin executing.  Return 0 on success,
-        // and a non-zero value if the queue is not paused or '!d_list.empty()'
-        // and the associated thread pool fails to enqueue a job.
+        // and a non-zero value if the queue is not paused or the queue is not
+        // empty and the associated thread pool fails to enqueue a job.
 
     void setBatchSize(int batchSize);
         // Configure this queue to process jobs in groups of the specified
@@ -523,6 +627,12 @@ class MultiQueueThreadPool_Queue {
         // Note that the initial value for the execution batch size is 1 for
         // all queues.
 
+    void setTimingEnabled(bool enabled);
+        // Measure the dispatch and execution times of the jobs of this queue
+        // if the specified 'enabled' is 'true', and stop measuring them
+        // otherwise (see {'Queue Metrics'}).  Note that timing is initially
+        // disabled for all queues.
+
     void waitWhilePausing();
         // Wait until any currently-executing job on the queue completes and
         // the queue is paused.  Note that pausing differs from 'disable' in
@@ -548,8 +658,22 @@ class MultiQueueThreadPool_Queue {
     bool isPaused() const;
         // Report whether this object is paused.
 
+    bool isTimingEnabled() const;
+        // Report whether the dispatch and execution times of the jobs of this
+        // queue are measured (see {'Queue Metrics'}).
+
     int length() const;
         // Return an instantaneous snapshot of the length of this queue.
+
+    void loadMetrics(bsls::Types::Int64 *numExecuted,
+                     bsls::Types::Int64 *totalDispatchTime,
+                     bsls::Types::Int64 *maxDispatchTime,
+                     bsls::Types::Int64 *totalExecutionTime,
+                     bsls::Types::Int64 *maxExecutionTime) const;
+        // Load into the specified 'numExecuted', 'totalDispatchTime',
+        // 'maxDispatchTime', 'totalExecutionTime', and 'maxExecutionTime' an
+        // instantaneous snapshot of the corresponding metrics of this queue
+        // (see {'Queue Metrics'}).
 };
 
                         // ==========================
@@ -577,6 +701,23 @@ class MultiQueueThreadPool {
     typedef bsl::function<void()>                       CleanupFunctor;
     typedef bsl::map<int, MultiQueueThreadPool_Queue *> QueueRegistry;
 
+    struct QueueMetrics {
+        // This 'struct' provides a snapshot of the metrics of a queue (see
+        // {'Queue Metrics'}).  Times are in nanoseconds.
+
+        int                d_numPendingJobs;      // jobs awaiting execution
+
+        bsls::Types::Int64 d_numExecutedJobs;     // jobs executed
+
+        bsls::Types::Int64 d_totalDispatchTime;   // sum of dispatch times
+
+        bsls::Types::Int64 d_maxDispatchTime;     // maximum dispatch time
+
+        bsls::Types::Int64 d_totalExecutionTime;  // sum of execution times
+
+        bsls::Types::Int64 d_maxExecutionTime;    // maximum execution time
+    };
+
   private:
     // DATA
     bslma::Allocator *d_allocator_p;        // memory allocator (held)
@@ -585,6 +726,11 @@ class MultiQueueThreadPool {
 
     bool              d_threadPoolIsOwned;  // 'true' if thread pool is owned
 
+    bdlma::ConcurrentPool
+                      d_nodePool;           // pool of job nodes shared by the
+                                            // queues; must outlive
+                                            // 'd_queuePool'
+
     bdlcc::ObjectPool<
           MultiQueueThreadPool_Queue,
           bdlcc::ObjectPoolFunctors::DefaultCreator,
@@ -790,6 +936,13 @@ class MultiQueueThreadPool {
         // that the initial value for the execution batch size is 1 for all
         // queues.
 
+    int setTimingEnabled(int id, bool enabled);
+        // Measure the dispatch and execution times of the jobs of the queue
+        // specified by 'id' if the specified 'enabled' is 'true', and stop
+        // measuring them otherwise (see {'Queue Metrics'}).  Return 0 on
+        // success, and a non-zero value otherwise.  Note that timing is
+        // initially disabled for all queues.
+
     void shutdown();
         // Disable queuing on all queues, and wait until all non-paused queues
         // are empty.  Then, delete all queues, and shut down the thread pool
@@ -831,6 +984,12 @@ class MultiQueueThreadPool {
         // currently enabled, or 'false' otherwise (including if 'id' is not a
         // valid queue id).
 
+    bool isTimingEnabled(int id) const;
+        // Return 'true' if the dispatch and execution times of the jobs of
+        // the queue associated with the specified 'id' are measured (see
+        // {'Queue Metrics'}), or 'false' otherwise (including if 'id' is not
+        // a valid queue id).
+
     int numQueues() const;
         // Return an instantaneous snapshot of the number of queues managed by
         // this object.
@@ -853,6 +1012,12 @@ class MultiQueueThreadPool {
         // load into the number of items deleted since the last time this value
         // was reset.
 
+    int queueMetrics(QueueMetrics *result, int id) const;
+        // Load into the specified 'result' an instantaneous snapshot of the
+        // metrics (see {'Queue Metrics'}) of the queue associated with the
+        // specified 'id'.  Return 0 on success, and a non-zero value, with no
+        // effect on 'result', if 'id' does not specify a valid queue.
+
     const ThreadPool& threadPool() const;
         // Return a reference to the non-modifiable thread pool owned by this
         // object.
@@ -880,16 +1045,14 @@ bool MultiQueueThreadPool_Queue::isDrained() const
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
 
-    return 0 == d_list.size() && (   e_NOT_SCHEDULED == d_runState
-                                  || e_PAUSED        == d_runState);
+    return 0 == d_numJobs && (   e_NOT_SCHEDULED == d_runState
+                              || e_PAUSED        == d_runState);
 }
 
 inline
 bool MultiQueueThreadPool_Queue::isEnabled() const
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-
-    return e_ENQUEUING_ENABLED == d_enqueueState;
+    return e_ENQUEUING_ENABLED == d_enqueueState.loadAcquire();
 }
 
 inline
@@ -900,12 +1063,35 @@ bool MultiQueueThreadPool_Queue::isPaused() const
     return e_PAUSED == d_runState;
 }
 
+inline
+bool MultiQueueThreadPool_Queue::isTimingEnabled() const
+{
+    return d_isTimingEnabled.loadRelaxed();
+}
+
 inline
 int MultiQueueThreadPool_Queue::length() const
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
 
-    return static_cast<int>(d_list.size());
+    return d_numJobs - d_numExecuting;
+}
+
+inline
+void MultiQueueThreadPool_Queue::loadMetrics(
+                                 bsls::Types::Int64 *numExecuted,
+                                 bsls::Types::Int64 *totalDispatchTime,
+                                 bsls::Types::Int64 *maxDispatchTime,
+                                 bsls::Types::Int64 *totalExecutionTime,
+                                 bsls::Types::Int64 *maxExecutionTime) const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+
+    *numExecuted        = d_numExecuted;
+    *totalDispatchTime  = d_totalDispatchTime;
+    *maxDispatchTime    = d_maxDispatchTime;
+    *totalExecutionTime = d_totalExecutionTime;
+    *maxExecutionTime   = d_maxExecutionTime;
 }
 
                         // --------------------------
@@ -1009,6 +1195,22 @@ int MultiQueueThreadPool::setBatchSize(int id, int batchSize)
     return 0;
 }
 
+inline
+int MultiQueueThreadPool::setTimingEnabled(int id, bool enabled)
+{
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+
+    MultiQueueThreadPool_Queue *queue;
+
+    if (findIfUsable(id, &queue)) {
+        return 1;                                                     // RETURN
+    }
+
+    queue->setTimingEnabled(enabled);
+
+    return 0;
+}
+
 // ACCESSORS
 inline
 int MultiQueueThreadPool::batchSize(int id) const
@@ -1052,6 +1254,20 @@ bool MultiQueueThreadPool::isPaused(int id) const
     return false;
 }
 
+inline
+bool MultiQueueThreadPool::isTimingEnabled(int id) const
+{
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+
+    QueueRegistry::const_iterator iter = d_queueRegistry.find(id);
+
+    if (d_queueRegistry.end() != iter) {
+        return iter->second->isTimingEnabled();                       // RETURN
+    }
+
+    return false;
+}
+
 inline
 int MultiQueueThreadPool::numElements() const
 {
@@ -1097,6 +1313,31 @@ int MultiQueueThreadPool::numQueues() const
     return static_cast<int>(d_queueRegistry.size());
 }
 
+inline
+int MultiQueueThreadPool::queueMetrics(QueueMetrics *result, int id) const
+{
+    BSLS_ASSERT(result);
+
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);
+
+    QueueRegistry::const_iterator iter = d_queueRegistry.find(id);
+
+    if (d_queueRegistry.end() == iter) {
+        return 1;                                                     // RETURN
+    }
+
+    const MultiQueueThreadPool_Queue& queue = *iter->second;
+
+    result->d_numPendingJobs = queue.length();
+    queue.loadMetrics(&result->d_numExecutedJobs,
+                      &result->d_totalDispatchTime,
+                      &result->d_maxDispatchTime,
+                      &result->d_totalExecutionTime,
+                      &result->d_maxExecutionTime);
+
+    return 0;
+}
+
 inline
 const ThreadPool& MultiQueueThreadPool::threadPool() const
 {
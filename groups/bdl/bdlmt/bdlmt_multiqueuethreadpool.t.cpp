@@ -72,6 +72,7 @@ using namespace BloombergLP;
 //
 // MANIPULATORS
 // [33] void setBatchSize(int id, int batchSize);
+// [34] int setTimingEnabled(int id, bool enabled);
 // [ 2] int createQueue();
 // [ 2] int deleteQueue(int id, const bsl::function<void()>& cleanupFunc);
 // [ 2] int enqueueJob(int id, const bsl::function<void()>& functor);
@@ -89,6 +90,8 @@ using namespace BloombergLP;
 // [13] int numElements() const;
 // [ 4] int numElements(int id) const;
 // [ 6] bool isEnabled(int id);
+// [34] bool isTimingEnabled(int id) const;
+// [34] int queueMetrics(QueueMetrics *result, int id) const;
 // [ 2] const bdlmt::ThreadPool& threadPool() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
@@ -112,7 +115,9 @@ using namespace BloombergLP;
 // [30] DRQS 140150365: resume fails immediately after pause
 // [31] DRQS 140403279: pause can deadlock with delete and create
 // [32] DRQS 143578129: 'numElements' stress test
-// [34] USAGE EXAMPLE 1
+// [34] CONCERN: concurrent producers enqueuing to one queue
+// [34] CONCERN: no job is enqueued after 'disableQueue' returns
+// [35] USAGE EXAMPLE 1
 // [-2] PERFORMANCE TEST
 // ----------------------------------------------------------------------------
 
@@ -619,6 +624,51 @@ void case32Job()
     bslmt::ThreadUtil::microSleep(10000);
 }
 
+void case34Record(bsl::vector<int> *results, int value)
+    // Append the specified 'value' to the specified 'results'.  Note that the
+    // jobs of a queue are executed serially, so no synchronization is needed.
+{
+    results->push_back(value);
+}
+
+void case34Producer(Obj              *pool,
+                    int               queueId,
+                    bsl::vector<int> *results,
+                    int               producer,
+                    int               numJobs,
+                    bslmt::Barrier   *barrier)
+    // Wait on the specified 'barrier', then enqueue to the queue having the
+    // specified 'queueId' of the specified 'pool' the specified 'numJobs' jobs
+    // that record, in the specified 'results', the values
+    // 'producer * numJobs + i' for 'i' in '[0 .. numJobs)', where 'producer'
+    // is the specified 'producer'.
+{
+    barrier->wait();
+
+    for (int i = 0; i < numJobs; ++i) {
+        Func job = bdlf::BindUtil::bind(&case34Record,
+                                        results,
+                                        producer * numJobs + i);
+        ASSERT(0 == pool->enqueueJob(queueId, job));
+    }
+}
+
+void case34DisableProducer(Obj             *pool,
+                           int              queueId,
+                           bsls::AtomicInt *counter,
+                           bslmt::Barrier  *barrier)
+    // Wait on the specified 'barrier', then enqueue to the queue having the
+    // specified 'queueId' of the specified 'pool' jobs that increment the
+    // specified 'counter' until 'enqueueJob' fails.
+{
+    barrier->wait();
+
+    Func job = bdlf::BindUtil::bind(&incrementCounter, counter);
+
+    while (0 == pool->enqueueJob(queueId, job)) {
+    }
+}
+
 // ============================================================================
 //          CLASSES AND HELPER FUNCTIONS FOR TESTING USAGE EXAMPLES
 // ----------------------------------------------------------------------------
@@ -1481,7 +1531,7 @@ int main(int argc, char *argv[]) {
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 34: {
+      case 35: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 1
         //
@@ -1562,6 +1612,271 @@ int main(int argc, char *argv[]) {
         ASSERT(0 <  ta.numAllocations());
         ASSERT(0 == ta.numBytesInUse());
       }  break;
+      case 34: {
+        // --------------------------------------------------------------------
+        // TESTING QUEUE METRICS AND CONCURRENT PRODUCERS
+        //
+        // Concerns:
+        //: 1 'queueMetrics' fails, without modifying the result, for an
+        //:   invalid queue id.
+        //:
+        //: 2 'queueMetrics' reports the number of pending and executed jobs,
+        //:   and dispatch and execution times consistent with the delays
+        //:   introduced by the test.
+        //:
+        //: 5 Timing is initially disabled, and dispatch and execution times
+        //:   are measured only once 'setTimingEnabled' enables them; the
+        //:   number of executed jobs is maintained either way.
+        //:
+        //: 6 'setTimingEnabled' and 'isTimingEnabled' fail for an invalid
+        //:   queue id.
+        //:
+        //: 3 When many threads enqueue jobs to one queue concurrently, every
+        //:   job is executed exactly once, and the jobs enqueued by any one
+        //:   thread are executed in the order they were enqueued, for any
+        //:   batch size.
+        //:
+        //: 4 No job is added to a queue after 'disableQueue' returns, even
+        //:   when other threads are enqueuing to it concurrently.
+        //
+        // Plan:
+        //: 1 Invoke 'queueMetrics' with ids that do not refer to a queue.
+        //:   (C-1)
+        //:
+        //: 2 Pause a queue, enqueue jobs (one of which sleeps), verify the
+        //:   number of pending jobs, wait, resume and drain the queue, and
+        //:   verify that jobs were counted but not timed.  Enable timing,
+        //:   repeat, and verify the metrics.  (C-2, 5)
+        //:
+        //: 3 Invoke 'setTimingEnabled' and 'isTimingEnabled' with ids that do
+        //:   not refer to a queue.  (C-6)
+        //:
+        //: 4 For several batch sizes, have several threads concurrently
+        //:   enqueue jobs that record a per-thread sequence number, and verify
+        //:   the recorded values and the metrics.  (C-3)
+        //:
+        //: 5 Pause a queue, have several threads enqueue jobs to it until
+        //:   'enqueueJob' fails, disable the queue, and verify that the number
+        //:   of pending jobs does not change once 'disableQueue' returns.
+        //:   (C-4)
+        //
+        // Testing:
+        //   int queueMetrics(QueueMetrics *result, int id) const;
+        //   int setTimingEnabled(int id, bool enabled);
+        //   bool isTimingEnabled(int id) const;
+        //   CONCERN: concurrent producers enqueuing to one queue
+        //   CONCERN: no job is enqueued after 'disableQueue' returns
+        // --------------------------------------------------------------------
+
+        if (verbose) {
+            cout << "TESTING QUEUE METRICS AND CONCURRENT PRODUCERS\n"
+                 << "==============================================\n";
+        }
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        if (verbose) cout << "\nTesting 'queueMetrics'." << endl;
+        {
+            Obj mX(bslmt::ThreadAttributes(), 1, 1, 30, &ta);
+            const Obj& X = mX;
+
+            Obj::QueueMetrics metrics = { -1, -1, -1, -1, -1, -1 };
+
+            ASSERT(0 != X.queueMetrics(&metrics, 0));
+            ASSERT(-1 == metrics.d_numPendingJobs);
+            ASSERT(-1 == metrics.d_numExecutedJobs);
+
+            int queueId = mX.createQueue();
+
+            ASSERT(0 != X.queueMetrics(&metrics, queueId + 1));
+            ASSERT(-1 == metrics.d_numPendingJobs);
+
+            ASSERT(0 == X.queueMetrics(&metrics, queueId));
+            ASSERT(0 == metrics.d_numPendingJobs);
+            ASSERT(0 == metrics.d_numExecutedJobs);
+            ASSERT(0 == metrics.d_totalDispatchTime);
+            ASSERT(0 == metrics.d_maxDispatchTime);
+            ASSERT(0 == metrics.d_totalExecutionTime);
+            ASSERT(0 == metrics.d_maxExecutionTime);
+
+            mX.start();
+
+            ASSERT(false == X.isTimingEnabled(queueId));
+
+            const int k_NUM_JOBS = 5;
+
+            bsls::AtomicInt counter(0);
+
+            Func job = bdlf::BindUtil::bind(&incrementCounter, &counter);
+
+            for (int round = 1; round <= 2; ++round) {
+                const bool isTimed = 2 == round;
+
+                if (veryVerbose) { T_ P_(round) P(isTimed) }
+
+                ASSERT(0       == mX.setTimingEnabled(queueId, isTimed));
+                ASSERT(isTimed == X.isTimingEnabled(queueId));
+
+                ASSERT(0 == mX.pauseQueue(queueId));
+
+                ASSERT(0 == mX.enqueueJob(queueId, &case32Job));  // 10ms
+                for (int i = 1; i < k_NUM_JOBS; ++i) {
+                    ASSERT(0 == mX.enqueueJob(queueId, job));
+                }
+
+                ASSERT(0 == X.queueMetrics(&metrics, queueId));
+                ASSERT(k_NUM_JOBS              == metrics.d_numPendingJobs);
+                ASSERT((round - 1) * k_NUM_JOBS == metrics.d_numExecutedJobs);
+
+                bslmt::ThreadUtil::microSleep(20000);
+
+                ASSERT(0 == mX.resumeQueue(queueId));
+                ASSERT(0 == mX.drainQueue(queueId));
+
+                ASSERT(round * (k_NUM_JOBS - 1) == counter);
+
+                ASSERT(0 == X.queueMetrics(&metrics, queueId));
+                ASSERT(0                  == metrics.d_numPendingJobs);
+                ASSERT(round * k_NUM_JOBS == metrics.d_numExecutedJobs);
+
+                if (!isTimed) {
+                    ASSERT(0 == metrics.d_totalDispatchTime);
+                    ASSERT(0 == metrics.d_maxDispatchTime);
+                    ASSERT(0 == metrics.d_totalExecutionTime);
+                    ASSERT(0 == metrics.d_maxExecutionTime);
+                    continue;                                       // CONTINUE
+                }
+
+                const bsls::Types::Int64 k_MS = 1000 * 1000;
+
+                ASSERTV(metrics.d_maxDispatchTime,
+                        20 * k_MS <= metrics.d_maxDispatchTime);
+                ASSERT(metrics.d_maxDispatchTime <=
+                                                  metrics.d_totalDispatchTime);
+                ASSERTV(metrics.d_maxExecutionTime,
+                        10 * k_MS <= metrics.d_maxExecutionTime);
+                ASSERT(metrics.d_maxExecutionTime <=
+                                                 metrics.d_totalExecutionTime);
+            }
+
+            ASSERT(0 != mX.setTimingEnabled(queueId + 1, true));
+            ASSERT(false == X.isTimingEnabled(queueId + 1));
+
+            ASSERT(0 == mX.deleteQueue(queueId));
+            ASSERT(0 != X.queueMetrics(&metrics, queueId));
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\nTesting concurrent producers." << endl;
+        {
+            const int k_NUM_PRODUCERS = 4;
+            const int k_NUM_JOBS      = 5000;
+
+            for (int batchSize = 1; batchSize <= 16; batchSize *= 4) {
+                Obj mX(bslmt::ThreadAttributes(), 2, 2, 30, &ta);
+                const Obj& X = mX;
+
+                mX.start();
+
+                int queueId = mX.createQueue();
+                ASSERT(0 == mX.setBatchSize(queueId, batchSize));
+
+                bsl::vector<int> results(&ta);
+                bslmt::Barrier   barrier(k_NUM_PRODUCERS);
+
+                bslmt::ThreadGroup producers(&ta);
+                for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+                    producers.addThread(bdlf::BindUtil::bind(&case34Producer,
+                                                             &mX,
+                                                             queueId,
+                                                             &results,
+                                                             i,
+                                                             k_NUM_JOBS,
+                                                             &barrier));
+                }
+                producers.joinAll();
+
+                ASSERT(0 == mX.drainQueue(queueId));
+
+                ASSERTV(batchSize,
+                        results.size(),
+                        k_NUM_PRODUCERS * k_NUM_JOBS == results.size());
+
+                int next[k_NUM_PRODUCERS] = { 0 };
+                for (bsl::size_t i = 0; i < results.size(); ++i) {
+                    const int producer = results[i] / k_NUM_JOBS;
+                    const int sequence = results[i] % k_NUM_JOBS;
+
+                    ASSERTV(batchSize, i, sequence == next[producer]);
+                    next[producer] = sequence + 1;
+                }
+
+                Obj::QueueMetrics metrics;
+
+                ASSERT(0 == X.queueMetrics(&metrics, queueId));
+                ASSERT(0 == metrics.d_numPendingJobs);
+                ASSERT(k_NUM_PRODUCERS * k_NUM_JOBS ==
+                                                    metrics.d_numExecutedJobs);
+
+                int numExecuted;
+                int numEnqueued;
+                X.numProcessed(&numExecuted, &numEnqueued);
+                ASSERT(k_NUM_PRODUCERS * k_NUM_JOBS == numExecuted);
+                ASSERT(k_NUM_PRODUCERS * k_NUM_JOBS == numEnqueued);
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+
+        if (verbose) {
+            cout << "\nTesting 'disableQueue' with producers." << endl;
+        }
+        {
+            const int k_NUM_PRODUCERS = 4;
+
+            for (int iteration = 0; iteration < 20; ++iteration) {
+                Obj mX(bslmt::ThreadAttributes(), 1, 1, 30, &ta);
+                const Obj& X = mX;
+
+                mX.start();
+
+                int queueId = mX.createQueue();
+                ASSERT(0 == mX.pauseQueue(queueId));
+
+                bsls::AtomicInt counter(0);
+                bslmt::Barrier  barrier(k_NUM_PRODUCERS + 1);
+
+                bslmt::ThreadGroup producers(&ta);
+                for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+                    producers.addThread(bdlf::BindUtil::bind(
+                                                       &case34DisableProducer,
+                                                       &mX,
+                                                       queueId,
+                                                       &counter,
+                                                       &barrier));
+                }
+                barrier.wait();
+                bslmt::ThreadUtil::microSleep(iteration * 100);
+
+                ASSERT(0 == mX.disableQueue(queueId));
+
+                const int numPending = X.numElements(queueId);
+
+                producers.joinAll();
+
+                ASSERTV(iteration,
+                        numPending,
+                        X.numElements(queueId),
+                        numPending == X.numElements(queueId));
+
+                ASSERT(0 == mX.resumeQueue(queueId));
+                ASSERT(0 == mX.drainQueue(queueId));
+
+                ASSERTV(iteration, numPending, counter,
+                        numPending == counter);
+            }
+        }
+        ASSERT(0 == ta.numBytesInUse());
+      }  break;
       case 33: {
         // --------------------------------------------------------------------
         // TESTING BATCH SIZE
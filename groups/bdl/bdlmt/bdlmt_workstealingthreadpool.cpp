@@ -0,0 +1,577 @@
+// bdlmt_workstealingthreadpool.cpp                                   -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_workstealingthreadpool_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_nullptr.h>
+#include <bsls_spinlock.h>
+
+#include <bsl_deque.h>
+
+namespace {
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+void initBlockSet(sigset_t *blockSet)
+{
+    sigfillset(blockSet);
+
+    const int synchronousSignals[] = {
+      SIGBUS,
+      SIGFPE,
+      SIGILL,
+      SIGSEGV,
+      SIGSYS,
+      SIGABRT,
+      SIGTRAP,
+     #if !defined(BSLS_PLATFORM_OS_CYGWIN) || defined(SIGIOT)
+      SIGIOT
+     #endif
+    };
+
+    const int SIZE = sizeof synchronousSignals / sizeof *synchronousSignals;
+
+    for (int i = 0; i < SIZE; ++i) {
+        sigdelset(blockSet, synchronousSignals[i]);
+    }
+}
+#endif
+
+}  // close unnamed namespace
+
+namespace BloombergLP {
+namespace bdlmt {
+
+                    // ===================================
+                    // class WorkStealingThreadPool_Worker
+                    // ===================================
+
+class WorkStealingThreadPool_Worker {
+    // This implementation class provides the double-ended queue of jobs of a
+    // processing thread of a 'WorkStealingThreadPool'.  The owning thread
+    // pushes and pops jobs at the back of the queue; other threads push jobs
+    // at the back, and steal jobs from the front.  The queue is protected by
+    // a spin lock, which is held only for the duration of a single push or
+    // pop, and is rarely contended since most accesses are made by the owning
+    // thread.
+
+    // PRIVATE TYPES
+    typedef WorkStealingThreadPool::Job Job;
+
+    // DATA
+    bsls::SpinLock     d_lock;           // protects 'd_jobs'
+
+    bsl::deque<Job>    d_jobs;           // pending jobs
+
+    bsls::AtomicInt    d_numJobs;        // 'd_jobs.size()', readable without
+                                         // holding 'd_lock'
+
+    bsls::AtomicInt64  d_numStolenJobs;  // number of jobs stolen by the
+                                         // owning thread
+
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool_Worker(const WorkStealingThreadPool_Worker&);
+    WorkStealingThreadPool_Worker& operator=(
+                                         const WorkStealingThreadPool_Worker&);
+
+  public:
+    // CREATORS
+    explicit
+    WorkStealingThreadPool_Worker(bslma::Allocator *basicAllocator);
+        // Create a worker having an empty queue, using the specified
+        // 'basicAllocator' to supply memory.
+
+    // MANIPULATORS
+    void pushBack(Job *job);
+        // Move the specified 'job' onto the back of the queue of this worker.
+
+    bool popBack(Job *job);
+        // Move the job at the back of the queue of this worker into the
+        // specified 'job', and return 'true'; return 'false', with no effect,
+        // if the queue is empty.
+
+    bool popFront(Job *job);
+        // Move the job at the front of the queue of this worker into the
+        // specified 'job', and return 'true'; return 'false', with no effect,
+        // if the queue is empty.
+
+    int removeAll();
+        // Destroy all the jobs in the queue of this worker, and return the
+        // number of jobs destroyed.
+
+    void incrementNumStolenJobs();
+        // Record that the owning thread stole one job.
+
+    // ACCESSORS
+    int numJobs() const;
+        // Return a snapshot of the number of jobs in the queue of this worker.
+
+    bsls::Types::Int64 numStolenJobs() const;
+        // Return a snapshot of the number of jobs stolen by the owning thread.
+};
+
+                    // -----------------------------------
+                    // class WorkStealingThreadPool_Worker
+                    // -----------------------------------
+
+// CREATORS
+WorkStealingThreadPool_Worker::WorkStealingThreadPool_Worker(
+                                              bslma::Allocator *basicAllocator)
+: d_lock(bsls::SpinLock::s_unlocked)
+, d_jobs(basicAllocator)
+, d_numJobs(0)
+, d_numStolenJobs(0)
+{
+}
+
+// MANIPULATORS
+void WorkStealingThreadPool_Worker::pushBack(Job *job)
+{
+    bsls::SpinLockGuard guard(&d_lock);
+
+    d_jobs.push_back(bslmf::MovableRefUtil::move(*job));
+    d_numJobs.storeRelaxed(static_cast<int>(d_jobs.size()));
+}
+
+bool WorkStealingThreadPool_Worker::popBack(Job *job)
+{
+    bsls::SpinLockGuard guard(&d_lock);
+
+    if (d_jobs.empty()) {
+        return false;                                                 // RETURN
+    }
+    *job = bslmf::MovableRefUtil::move(d_jobs.back());
+    d_jobs.pop_back();
+    d_numJobs.storeRelaxed(static_cast<int>(d_jobs.size()));
+    return true;
+}
+
+bool WorkStealingThreadPool_Worker::popFront(Job *job)
+{
+    bsls::SpinLockGuard guard(&d_lock);
+
+    if (d_jobs.empty()) {
+        return false;                                                 // RETURN
+    }
+    *job = bslmf::MovableRefUtil::move(d_jobs.front());
+    d_jobs.pop_front();
+    d_numJobs.storeRelaxed(static_cast<int>(d_jobs.size()));
+    return true;
+}
+
+int WorkStealingThreadPool_Worker::removeAll()
+{
+    // Destroy the jobs after releasing the lock, since their destructors may
+    // be arbitrarily expensive.
+
+    bsl::deque<Job> jobs(d_jobs.get_allocator());
+    {
+        bsls::SpinLockGuard guard(&d_lock);
+
+        d_jobs.swap(jobs);
+        d_numJobs.storeRelaxed(0);
+    }
+    return static_cast<int>(jobs.size());
+}
+
+inline
+void WorkStealingThreadPool_Worker::incrementNumStolenJobs()
+{
+    d_numStolenJobs.addRelaxed(1);
+}
+
+// ACCESSORS
+inline
+int WorkStealingThreadPool_Worker::numJobs() const
+{
+    return d_numJobs.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 WorkStealingThreadPool_Worker::numStolenJobs() const
+{
+    return d_numStolenJobs.loadRelaxed();
+}
+
+                        // ----------------------------
+                        // class WorkStealingThreadPool
+                        // ----------------------------
+
+// PRIVATE MANIPULATORS
+void WorkStealingThreadPool::init(int numThreads)
+{
+    d_workers.reserve(numThreads);
+    for (int i = 0; i < numThreads; ++i) {
+        d_workers.push_back(new (*d_allocator_p) Worker(d_allocator_p));
+    }
+
+    // Without a thread-specific key, every job is enqueued as if from outside
+    // the pool.
+
+    d_workerKeyValid = 0 == bslmt::ThreadUtil::createKey(&d_workerKey, 0);
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    initBlockSet(&d_blockSet);
+#endif
+}
+
+int WorkStealingThreadPool::pushJob(Job *functor)
+{
+    // Count the job as unfinished before checking whether enqueuing is
+    // enabled, so that a concurrent 'stop' (which disables enqueuing, then
+    // drains) either rejects the job or waits for it.
+
+    ++d_numUnfinishedJobs;
+
+    if (!isEnabled()) {
+        jobDone();
+        return -1;                                                    // RETURN
+    }
+
+    Worker *worker = 0;
+    if (d_workerKeyValid) {
+        worker = static_cast<Worker *>(
+                                  bslmt::ThreadUtil::getSpecific(d_workerKey));
+    }
+    if (0 == worker) {
+        worker = d_workers[d_nextWorker.addRelaxed(1) % d_workers.size()];
+    }
+
+    worker->pushBack(functor);
+
+    // An idle thread increments 'd_numThreadsWaiting' before checking
+    // 'd_numPendingJobs' (both sequentially consistent), so either it sees
+    // this job, or this thread sees it waiting and wakes it up.
+
+    ++d_numPendingJobs;
+    wakeOneThread();
+
+    return 0;
+}
+
+bool WorkStealingThreadPool::popJob(Job *functor, int workerIndex)
+{
+    Worker *self = d_workers[workerIndex];
+
+    if (self->popBack(functor)) {
+        --d_numPendingJobs;
+        return true;                                                  // RETURN
+    }
+
+    const int numWorkers = numThreads();
+    for (int i = 1; i < numWorkers; ++i) {
+        Worker *victim = d_workers[(workerIndex + i) % numWorkers];
+
+        if (0 < victim->numJobs() && victim->popFront(functor)) {
+            self->incrementNumStolenJobs();
+            --d_numPendingJobs;
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+void WorkStealingThreadPool::jobDone()
+{
+    if (0 == --d_numUnfinishedJobs) {
+        // Lock the mutex so that a thread in 'drain', having observed a
+        // non-zero count, is waiting on the condition before it is signaled.
+
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_drainMutex);
+        d_drainCondition.broadcast();
+    }
+}
+
+void WorkStealingThreadPool::workerThread(int workerIndex)
+{
+    if (d_workerKeyValid) {
+        bslmt::ThreadUtil::setSpecific(d_workerKey, d_workers[workerIndex]);
+    }
+
+    // Use the allocator of the queues so that moving a job out of a queue
+    // does not copy it.
+
+    Job functor(bsl::allocator_arg, d_allocator_p);
+    while (1) {
+        if (popJob(&functor, workerIndex)) {
+            functor();
+
+            // Destroy the job before it is reported complete, so that 'drain'
+            // also waits for the release of the resources it holds.
+
+            functor = bsl::nullptr_t();
+            jobDone();
+            continue;
+        }
+
+        ++d_numThreadsWaiting;
+
+        const bool stopping = e_STOP == d_control;
+        if (0 < d_numPendingJobs || stopping) {
+            // Withdraw from the waiting threads; if a thread enqueuing a job
+            // has already claimed this thread, consume its post instead.
+
+            if (!tryClaimWaitingThread()) {
+                d_idleSemaphore.wait();
+            }
+            if (stopping) {
+                break;
+            }
+            continue;
+        }
+
+        // The thread posting 'd_idleSemaphore' has removed this thread from
+        // 'd_numThreadsWaiting'.
+
+        d_idleSemaphore.wait();
+    }
+
+    if (d_workerKeyValid) {
+        bslmt::ThreadUtil::setSpecific(d_workerKey, 0);
+    }
+}
+
+int WorkStealingThreadPool::startNewThread(int workerIndex)
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Block all asynchronous signals.
+
+    sigset_t oldset;
+    pthread_sigmask(SIG_BLOCK, &d_blockSet, &oldset);
+#endif
+
+    bsl::function<void()> workerThreadFunc = bdlf::BindUtil::bind(
+                                         &WorkStealingThreadPool::workerThread,
+                                         this,
+                                         workerIndex);
+
+    int rc = d_threadGroup.addThread(workerThreadFunc, d_threadAttributes);
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Restore the mask.
+
+    pthread_sigmask(SIG_SETMASK, &oldset, &d_blockSet);
+#endif
+
+    return rc;
+}
+
+void WorkStealingThreadPool::stopThreads()
+{
+    d_control = e_STOP;
+
+    // Wake up every thread; a thread that is not yet waiting either observes
+    // 'e_STOP', or consumes one of the posts and then observes it.
+
+    d_idleSemaphore.post(numThreads());
+    d_threadGroup.joinAll();
+    d_idleSemaphore.takeAll();
+    d_numThreadsWaiting = 0;
+}
+
+bool WorkStealingThreadPool::tryClaimWaitingThread()
+{
+    int numWaiting = d_numThreadsWaiting;
+    while (0 < numWaiting) {
+        const int previous = d_numThreadsWaiting.testAndSwap(numWaiting,
+                                                             numWaiting - 1);
+        if (previous == numWaiting) {
+            return true;                                              // RETURN
+        }
+        numWaiting = previous;
+    }
+    return false;
+}
+
+void WorkStealingThreadPool::wakeOneThread()
+{
+    // Posting only for a thread removed from 'd_numThreadsWaiting' prevents a
+    // burst of enqueued jobs from waking the same parked thread repeatedly
+    // (and accumulating posts that later cause spurious wake-ups).
+
+    if (tryClaimWaitingThread()) {
+        d_idleSemaphore.post();
+    }
+}
+
+// CREATORS
+WorkStealingThreadPool::WorkStealingThreadPool(
+                                              int               numThreads,
+                                              bslma::Allocator *basicAllocator)
+: d_workers(basicAllocator)
+, d_enabled(0)
+, d_control(e_STOP)
+, d_numPendingJobs(0)
+, d_numUnfinishedJobs(0)
+, d_nextWorker(0)
+, d_numThreadsWaiting(0)
+, d_workerKeyValid(false)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT_OPT(1 <= numThreads);
+
+    init(numThreads);
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+                             const bslmt::ThreadAttributes&  threadAttributes,
+                             int                             numThreads,
+                             bslma::Allocator               *basicAllocator)
+: d_workers(basicAllocator)
+, d_enabled(0)
+, d_control(e_STOP)
+, d_numPendingJobs(0)
+, d_numUnfinishedJobs(0)
+, d_nextWorker(0)
+, d_numThreadsWaiting(0)
+, d_workerKeyValid(false)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(threadAttributes, basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT_OPT(1 <= numThreads);
+
+    init(numThreads);
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    shutdown();
+
+    for (bsl::size_t i = 0; i < d_workers.size(); ++i) {
+        d_allocator_p->deleteObject(d_workers[i]);
+    }
+
+    if (d_workerKeyValid) {
+        bslmt::ThreadUtil::deleteKey(d_workerKey);
+    }
+}
+
+// MANIPULATORS
+int WorkStealingThreadPool::enqueueJob(const Job& functor)
+{
+    BSLS_ASSERT(functor);
+
+    Job job(bsl::allocator_arg, d_allocator_p, functor);
+    return pushJob(&job);
+}
+
+int WorkStealingThreadPool::enqueueJob(bslmf::MovableRef<Job> functor)
+{
+    BSLS_ASSERT(bslmf::MovableRefUtil::access(functor));
+
+    return pushJob(&bslmf::MovableRefUtil::access(functor));
+}
+
+void WorkStealingThreadPool::drain()
+{
+    bslmt::LockGuard<bslmt::Mutex> metaLock(&d_metaMutex);
+
+    if (e_RUN != d_control.loadRelaxed()) {
+        return;                                                       // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_drainMutex);
+    while (0 != d_numUnfinishedJobs) {
+        d_drainCondition.wait(&d_drainMutex);
+    }
+}
+
+void WorkStealingThreadPool::shutdown()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (e_RUN != d_control.loadRelaxed()) {
+        return;                                                       // RETURN
+    }
+
+    disable();
+
+    for (bsl::size_t i = 0; i < d_workers.size(); ++i) {
+        const int numRemoved = d_workers[i]->removeAll();
+
+        d_numPendingJobs.addRelaxed(-numRemoved);
+        for (int j = 0; j < numRemoved; ++j) {
+            jobDone();
+        }
+    }
+
+    stopThreads();
+}
+
+int WorkStealingThreadPool::start()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (e_RUN == d_control.loadRelaxed()) {
+        return 0;                                                     // RETURN
+    }
+
+    d_control = e_RUN;
+
+    for (int i = 0; i < numThreads(); ++i) {
+        if (0 != startNewThread(i)) {
+            stopThreads();
+            return -1;                                                // RETURN
+        }
+    }
+
+    enable();
+    return 0;
+}
+
+void WorkStealingThreadPool::stop()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (e_RUN != d_control.loadRelaxed()) {
+        return;                                                       // RETURN
+    }
+
+    disable();
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> drainLock(&d_drainMutex);
+        while (0 != d_numUnfinishedJobs) {
+            d_drainCondition.wait(&d_drainMutex);
+        }
+    }
+
+    stopThreads();
+}
+
+// ACCESSORS
+bsls::Types::Int64 WorkStealingThreadPool::numStolenJobs() const
+{
+    bsls::Types::Int64 result = 0;
+    for (bsl::size_t i = 0; i < d_workers.size(); ++i) {
+        result += d_workers[i]->numStolenJobs();
+    }
+    return result;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,527 @@
+// bdlmt_workstealingthreadpool.h                                     -*-C++-*-
+#ifndef INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+#define INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fixed-size thread pool whose threads steal jobs.
+//
+//@CLASSES:
+//   bdlmt::WorkStealingThreadPool: fixed-size work-stealing thread pool
+//
+//@SEE_ALSO: bdlmt_fixedthreadpool, bdlmt_threadpool
+//
+//@DESCRIPTION: This component defines a thread pool,
+// 'bdlmt::WorkStealingThreadPool', that executes user-defined functions
+// ("jobs") on a fixed number of processing threads, like a
+// 'bdlmt::FixedThreadPool', but without dispatching all the jobs from a single
+// shared queue.  Instead, each processing thread (a "worker") owns a
+// double-ended queue of jobs:
+//
+//: o A job enqueued by a job running in the pool (i.e., from a worker thread)
+//:   is pushed onto the back of the queue of that worker.
+//:
+//: o A job enqueued from any other thread is pushed onto the back of the queue
+//:   of one of the workers, chosen in round-robin order.
+//:
+//: o A worker executes the jobs of its own queue from the back (i.e., the
+//:   most recently enqueued job first), and, when its queue is empty, "steals"
+//:   the job at the front (i.e., the least recently enqueued job) of the
+//:   queue of another worker.
+//:
+//: o A worker finding no job to execute or steal is parked on a
+//:   'bslmt::FastPostSemaphore' until a job is enqueued.
+//
+// Because each queue is mostly accessed by its owner, the lock protecting it
+// is rarely contended, and, because a worker continues with the jobs it
+// spawned, recursively decomposed ("fork/join") computations keep their data
+// in the cache of the thread that produced it.  Stealing from the front of a
+// queue takes the oldest, and, for such computations, typically the largest,
+// piece of work, which amortizes the cost of the steal.  This pool is best
+// suited to high rates of short jobs, and, in particular, to jobs that
+// themselves enqueue jobs.
+//
+// Jobs are not executed in the order in which they are enqueued, and a job
+// enqueued from a worker may be executed by that worker before jobs enqueued
+// earlier.  Applications requiring jobs to be processed in order should use a
+// 'bdlmt::FixedThreadPool' (or a 'bdlmt::MultiQueueThreadPool').
+//
+// The interface follows that of 'bdlmt::FixedThreadPool': jobs are specified
+// either as a 'bsl::function<void()>' or as a "void function/void pointer"
+// pair, enqueuing fails when the pool is disabled (i.e., before 'start', and
+// after 'stop' or 'shutdown'), 'drain' waits for all the enqueued jobs
+// (including the jobs these enqueue) to complete, 'stop' disables enqueuing,
+// drains the pool and joins the processing threads, and 'shutdown' discards
+// the pending jobs instead of draining them.  Unlike a
+// 'bdlmt::FixedThreadPool', the number of pending jobs is not bounded, so
+// 'enqueueJob' never blocks.
+//
+///Thread Safety
+///-------------
+// The 'bdlmt::WorkStealingThreadPool' class is both *fully thread-safe* (i.e.,
+// all non-creator methods can correctly execute concurrently), and is
+// *thread-enabled* (i.e., the class does not function correctly in a
+// non-multi-threading environment).  See 'bsldoc_glossary' for complete
+// definitions of *fully thread-safe* and *thread-enabled*.  The behavior is
+// undefined if 'drain', 'stop', or 'shutdown' is invoked from a job executing
+// in the pool.
+//
+///Synchronous Signals on Unix
+///---------------------------
+// As with 'bdlmt::FixedThreadPool', on unix platforms, all the threads in the
+// pool block all asynchronous signals, i.e., all the signals except 'SIGBUS',
+// 'SIGFPE', 'SIGILL', 'SIGSEGV', 'SIGSYS', 'SIGABRT', 'SIGTRAP', and 'SIGIOT'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Parallel Recursive Summation
+///- - - - - - - - - - - - - - - - - - - -
+// In this example we sum the elements of an array by recursively splitting
+// the array in halves, each summed by a separate job, until the pieces are
+// small enough to be summed directly.  The partial sums are accumulated in an
+// atomic variable.
+//
+// First, we define a structure describing the summation of a range of the
+// array, and a function executing it.  A range that is too large to be summed
+// directly is split in two: the function enqueues the summation of the upper
+// half into the pool and continues with the lower half.  Since the job is
+// enqueued from a worker thread, it is pushed onto the queue of that worker,
+// from which an idle worker can steal it:
+//..
+//  struct SumJob {
+//      bdlmt::WorkStealingThreadPool *d_pool_p;    // pool executing the job
+//      const int                     *d_begin_p;   // first element to sum
+//      const int                     *d_end_p;     // end of the elements
+//      bsls::AtomicInt64             *d_result_p;  // accumulated sum
+//
+//      void operator()() const;
+//          // Add to 'd_result_p' the sum of the elements in the range
+//          // '[d_begin_p .. d_end_p)'.
+//  };
+//
+//  void SumJob::operator()() const
+//  {
+//      enum { k_GRAIN_SIZE = 1024 };  // largest range summed directly
+//
+//      const int *begin = d_begin_p;
+//      const int *end   = d_end_p;
+//
+//      while (end - begin > k_GRAIN_SIZE) {
+//          const int *middle = begin + (end - begin) / 2;
+//
+//          SumJob upperHalf = { d_pool_p, middle, end, d_result_p };
+//          d_pool_p->enqueueJob(upperHalf);
+//
+//          end = middle;
+//      }
+//
+//      bsls::Types::Int64 sum = 0;
+//      for (; begin != end; ++begin) {
+//          sum += *begin;
+//      }
+//      d_result_p->addRelaxed(sum);
+//  }
+//..
+// Then, we create the array to sum:
+//..
+//  bsl::vector<int> values(100000);
+//  for (bsl::size_t i = 0; i < values.size(); ++i) {
+//      values[i] = static_cast<int>(i % 100);
+//  }
+//..
+// Next, we create and start a pool having 4 worker threads:
+//..
+//  bdlmt::WorkStealingThreadPool pool(4);
+//  int rc = pool.start();
+//  assert(0 == rc);
+//..
+// Now, we enqueue the job summing the whole array, and wait until the pool
+// has executed it, and all the jobs it enqueued, using 'drain':
+//..
+//  bsls::AtomicInt64 result(0);
+//  SumJob job = { &pool, values.data(), values.data() + values.size(),
+//                 &result };
+//
+//  rc = pool.enqueueJob(job);
+//  assert(0 == rc);
+//
+//  pool.drain();
+//..
+// Finally, we verify the result, and stop the pool:
+//..
+//  assert(4950000 == result);
+//
+//  pool.stop();
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_fastpostsemaphore.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_functional.h>
+#include <bsl_vector.h>
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <bsl_c_signal.h>              // sigset_t
+#endif
+
+namespace BloombergLP {
+namespace bdlmt {
+
+extern "C" typedef void (*WorkStealingThreadPoolJobFunc)(void *);
+    // This type declares the prototype for functions that are suitable to be
+    // specified 'bdlmt::WorkStealingThreadPool::enqueueJob'.
+
+class WorkStealingThreadPool_Worker;  // defined in implementation
+
+                        // ============================
+                        // class WorkStealingThreadPool
+                        // ============================
+
+class WorkStealingThreadPool {
+    // This class implements a thread pool used for concurrently executing
+    // multiple user-defined functions ("jobs"), in which each processing
+    // thread has its own queue of jobs, and idle processing threads steal
+    // jobs from the queues of the other threads.
+
+  public:
+    // TYPES
+    typedef bsl::function<void()> Job;
+
+  private:
+    // PRIVATE TYPES
+    typedef WorkStealingThreadPool_Worker Worker;
+
+    enum {
+        e_STOP,  // processing threads are stopped, or exit when idle
+        e_RUN    // processing threads wait for jobs when idle
+    };
+
+    // DATA
+    bsl::vector<Worker *>    d_workers;            // one per processing
+                                                   // thread (owned)
+
+    bsls::AtomicInt          d_enabled;            // 1 if enqueuing is
+                                                   // enabled, and 0 otherwise
+
+    bsls::AtomicInt          d_control;            // 'e_RUN' or 'e_STOP'
+
+    bsls::AtomicInt          d_numPendingJobs;     // number of jobs enqueued
+                                                   // and not yet started
+
+    bsls::AtomicInt          d_numUnfinishedJobs;  // number of jobs enqueued
+                                                   // (or being enqueued) and
+                                                   // not yet completed
+
+    bsls::AtomicUint         d_nextWorker;         // index (modulo the number
+                                                   // of workers) of the worker
+                                                   // receiving the next job
+                                                   // enqueued from outside the
+                                                   // pool
+
+    bsls::AtomicInt          d_numThreadsWaiting;  // number of processing
+                                                   // threads parked, or about
+                                                   // to park, on
+                                                   // 'd_idleSemaphore', and
+                                                   // not yet claimed by a
+                                                   // post
+
+    bslmt::FastPostSemaphore d_idleSemaphore;      // parks idle processing
+                                                   // threads
+
+    bslmt::Mutex             d_drainMutex;         // protects waiting on
+                                                   // 'd_drainCondition'
+
+    bslmt::Condition         d_drainCondition;     // signaled when
+                                                   // 'd_numUnfinishedJobs'
+                                                   // drops to 0
+
+    bslmt::Mutex             d_metaMutex;          // serializes 'start',
+                                                   // 'stop', and 'shutdown'
+
+    bslmt::ThreadUtil::Key   d_workerKey;          // thread-specific key to
+                                                   // the 'Worker' of the
+                                                   // calling thread
+
+    bool                     d_workerKeyValid;     // 'true' if 'd_workerKey'
+                                                   // was successfully created
+
+    bslmt::ThreadGroup       d_threadGroup;        // processing threads
+
+    bslmt::ThreadAttributes  d_threadAttributes;   // attributes of the
+                                                   // processing threads
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    sigset_t                 d_blockSet;           // set of signals to be
+                                                   // blocked in managed
+                                                   // threads
+#endif
+
+    bslma::Allocator        *d_allocator_p;        // memory allocator (held,
+                                                   // not owned)
+
+    // PRIVATE MANIPULATORS
+    void init(int numThreads);
+        // Create the specified 'numThreads' workers, and the thread-specific
+        // key, of this pool.  Note that this method is called by the
+        // constructors.
+
+    int pushJob(Job *functor);
+        // Move the specified 'functor' onto the queue of the worker of the
+        // calling thread, if it is a processing thread of this pool, or onto
+        // the queue of the next worker in round-robin order otherwise, and
+        // wake up an idle processing thread if there is one.  Return 0 on
+        // success, and a non-zero value if enqueuing is disabled (in which
+        // case 'functor' is unmodified).
+
+    bool popJob(Job *functor, int workerIndex);
+        // Load into the specified 'functor' the job at the back of the queue
+        // of the worker having the specified 'workerIndex' or, if that queue
+        // is empty, the job at the front of the queue of another worker, and
+        // return 'true'; return 'false' if all the queues are empty.
+
+    void jobDone();
+        // Record that one job has completed (or failed to be enqueued), and
+        // wake up the threads blocked in 'drain' if no unfinished jobs remain.
+
+    void workerThread(int workerIndex);
+        // Execute the jobs of this pool, as the worker having the specified
+        // 'workerIndex', until this pool is stopped.
+
+    int startNewThread(int workerIndex);
+        // Spawn a processing thread executing 'workerThread(workerIndex)'.
+        // Return 0 on success, and a non-zero value otherwise.  Note that
+        // this method must be called with 'd_metaMutex' locked.
+
+    void stopThreads();
+        // Stop and join all the processing threads.  Note that this method
+        // must be called with 'd_metaMutex' locked.
+
+    bool tryClaimWaitingThread();
+        // Remove one thread from the count of threads waiting on
+        // 'd_idleSemaphore', and return 'true', unless that count is 0, in
+        // which case return 'false' with no effect.
+
+    void wakeOneThread();
+        // Post 'd_idleSemaphore' if a thread waiting on it can be claimed
+        // (see 'tryClaimWaitingThread').
+
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool(const WorkStealingThreadPool&);
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&);
+
+  public:
+    // CREATORS
+    explicit
+    WorkStealingThreadPool(int               numThreads,
+                           bslma::Allocator *basicAllocator = 0);
+        // Create a thread pool having the specified 'numThreads' processing
+        // threads.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  Note that the pool is disabled until 'start' is
+        // called.  The behavior is undefined unless '1 <= numThreads'.
+
+    WorkStealingThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
+                           int                             numThreads,
+                           bslma::Allocator               *basicAllocator = 0);
+        // Create a thread pool having the specified 'numThreads' processing
+        // threads created with the specified 'threadAttributes'.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  Note that the pool is disabled until 'start' is called.  The
+        // behavior is undefined unless '1 <= numThreads'.
+
+    ~WorkStealingThreadPool();
+        // Remove all pending jobs without executing them, block until all
+        // currently running jobs complete, and then destroy this thread pool.
+
+    // MANIPULATORS
+    void disable();
+        // Disable enqueuing into this pool.  Subsequent calls to 'enqueueJob'
+        // will immediately fail.  Note that this method has no effect on jobs
+        // already enqueued.
+
+    void enable();
+        // Enable enqueuing into this pool.
+
+    int enqueueJob(const Job& functor);
+    int enqueueJob(bslmf::MovableRef<Job> functor);
+        // Enqueue the specified 'functor' to be executed by a processing
+        // thread of this pool.  If the calling thread is a processing thread
+        // of this pool, 'functor' is enqueued on the queue of that thread.
+        // Return 0 if enqueued successfully, and a non-zero value if enqueuing
+        // is currently disabled.  This method does not block.  The behavior is
+        // undefined unless 'functor' is not "unset".
+
+    int enqueueJob(WorkStealingThreadPoolJobFunc function, void *userData);
+        // Enqueue the specified 'function' to be executed, with the specified
+        // 'userData' as its argument, by a processing thread of this pool.
+        // Return 0 if enqueued successfully, and a non-zero value if enqueuing
+        // is currently disabled.
+
+    void drain();
+        // Wait until all the enqueued jobs, including those enqueued by these
+        // jobs, complete.  Note that if jobs are enqueued concurrently with
+        // this method from outside the pool, this method may or may not wait
+        // until they have also completed.  The behavior is undefined if this
+        // method is invoked from a job executing in this pool.
+
+    void shutdown();
+        // Disable enqueuing on this thread pool, discard all pending jobs, and
+        // after all active jobs have completed, join all processing threads.
+        // The behavior is undefined if this method is invoked from a job
+        // executing in this pool.
+
+    int start();
+        // Spawn 'numThreads()' processing threads.  On success, enable
+        // enqueuing and return 0.  Return a non-zero value otherwise, in
+        // which case no processing thread is left running.  This method has
+        // no effect, and returns 0, if the processing threads are already
+        // started.
+
+    void stop();
+        // Disable enqueuing on this thread pool, wait until all pending jobs
+        // (including those enqueued by these jobs) complete, then join all
+        // processing threads.  Note that a job enqueuing a job after this
+        // method is called fails to enqueue it, so computations whose jobs
+        // enqueue other jobs should call 'drain' before 'stop'.  The behavior
+        // is undefined if this method is invoked from a job executing in this
+        // pool.
+
+    // ACCESSORS
+    bool isEnabled() const;
+        // Return 'true' if enqueuing is enabled on this thread pool, and
+        // 'false' otherwise.
+
+    bool isStarted() const;
+        // Return 'true' if the processing threads of this pool are started,
+        // and 'false' otherwise.
+
+    int numActiveThreads() const;
+        // Return a snapshot of the number of processing threads that are not
+        // idle.
+
+    int numPendingJobs() const;
+        // Return a snapshot of the number of jobs enqueued and not yet started
+        // by this pool.
+
+    bsls::Types::Int64 numStolenJobs() const;
+        // Return a snapshot of the number of jobs that were executed by a
+        // processing thread other than the one on whose queue they were
+        // enqueued.
+
+    int numThreads() const;
+        // Return the number of processing threads of this pool.
+
+    int numThreadsStarted() const;
+        // Return a snapshot of the number of processing threads currently
+        // started by this thread pool.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                        // ----------------------------
+                        // class WorkStealingThreadPool
+                        // ----------------------------
+
+// MANIPULATORS
+inline
+void WorkStealingThreadPool::disable()
+{
+    d_enabled = 0;
+}
+
+inline
+void WorkStealingThreadPool::enable()
+{
+    d_enabled = 1;
+}
+
+inline
+int WorkStealingThreadPool::enqueueJob(
+                                     WorkStealingThreadPoolJobFunc  function,
+                                     void                          *userData)
+{
+    return enqueueJob(bdlf::BindUtil::bindR<void>(function, userData));
+}
+
+// ACCESSORS
+inline
+bool WorkStealingThreadPool::isEnabled() const
+{
+    return 0 != d_enabled.load();
+}
+
+inline
+bool WorkStealingThreadPool::isStarted() const
+{
+    return numThreads() == d_threadGroup.numThreads();
+}
+
+inline
+int WorkStealingThreadPool::numActiveThreads() const
+{
+    const int numStarted = d_threadGroup.numThreads();
+    return numThreads() == numStarted
+         ? numStarted - d_numThreadsWaiting.loadRelaxed()
+         : 0;
+}
+
+inline
+int WorkStealingThreadPool::numPendingJobs() const
+{
+    return d_numPendingJobs.loadRelaxed();
+}
+
+inline
+int WorkStealingThreadPool::numThreads() const
+{
+    return static_cast<int>(d_workers.size());
+}
+
+inline
+int WorkStealingThreadPool::numThreadsStarted() const
+{
+    return d_threadGroup.numThreads();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
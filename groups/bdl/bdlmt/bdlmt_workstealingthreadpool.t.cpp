@@ -0,0 +1,1047 @@
+// bdlmt_workstealingthreadpool.t.cpp                                 -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bdlmt_fixedthreadpool.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_semaphore.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_timedsemaphore.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'bdlmt::WorkStealingThreadPool' is a mechanism whose observable behavior is
+// the execution of the jobs enqueued into it.  We first verify the life cycle
+// of the pool (construction, 'start', 'stop', and the basic accessors), then
+// that every job enqueued from outside the pool is executed exactly once.  We
+// then verify the behavior specific to this component: a job enqueued by a
+// worker thread is pushed onto the queue of that worker (observable as LIFO
+// execution in a pool having a single thread), and is stolen by an idle worker
+// when its owner is busy.  Finally, we verify that 'drain' waits for jobs
+// enqueued by other jobs, and that 'stop' executes, while 'shutdown' discards,
+// the pending jobs.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] WorkStealingThreadPool(int numThreads, Allocator *ba = 0);
+// [ 2] WorkStealingThreadPool(const ThreadAttributes&, int, Allocator *);
+// [ 2] ~WorkStealingThreadPool();
+//
+// MANIPULATORS
+// [ 3] void disable();
+// [ 3] void enable();
+// [ 3] int enqueueJob(const Job& functor);
+// [ 3] int enqueueJob(bslmf::MovableRef<Job> functor);
+// [ 3] int enqueueJob(WorkStealingThreadPoolJobFunc func, void *data);
+// [ 5] void drain();
+// [ 6] void shutdown();
+// [ 2] int start();
+// [ 2] void stop();
+//
+// ACCESSORS
+// [ 3] bool isEnabled() const;
+// [ 2] bool isStarted() const;
+// [ 6] int numActiveThreads() const;
+// [ 6] int numPendingJobs() const;
+// [ 4] bsls::Types::Int64 numStolenJobs() const;
+// [ 2] int numThreads() const;
+// [ 2] int numThreadsStarted() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: JOBS ENQUEUED BY A WORKER ARE LOCAL AND CAN BE STOLEN
+// [ 7] USAGE EXAMPLE
+// [-1] CONCERN: PERFORMANCE OF FORK/JOIN WORKLOADS
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::WorkStealingThreadPool Obj;
+typedef bsls::Types::Int64            Int64;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+extern "C" void incrementCounter(void *counter)
+    // Increment the 'bsls::AtomicInt' addressed by the specified 'counter'.
+{
+    ++*static_cast<bsls::AtomicInt *>(counter);
+}
+
+struct CountingJob {
+    // This 'struct' provides a job incrementing the element of an array of
+    // counters identified by an index.
+
+    bsls::AtomicInt *d_counters_p;  // counters, indexed by 'd_index'
+    int              d_index;       // index of the counter to increment
+
+    void operator()() const
+        // Increment the counter identified by 'd_index'.
+    {
+        ++d_counters_p[d_index];
+    }
+};
+
+struct EnqueuingThread {
+    // This 'struct' provides a thread function enqueuing the jobs incrementing
+    // a range of counters.
+
+    Obj             *d_pool_p;      // pool to enqueue into
+    bsls::AtomicInt *d_counters_p;  // counters to increment
+    int              d_begin;       // first counter of the range
+    int              d_end;         // end of the range
+    bsls::AtomicInt *d_numFailed_p; // number of failed calls to 'enqueueJob'
+
+    void operator()() const
+        // Enqueue a 'CountingJob' for each counter in '[d_begin .. d_end)'.
+    {
+        for (int i = d_begin; i < d_end; ++i) {
+            CountingJob job = { d_counters_p, i };
+            if (0 != d_pool_p->enqueueJob(job)) {
+                ++*d_numFailed_p;
+            }
+        }
+    }
+};
+
+struct BlockingJob {
+    // This 'struct' provides a job that blocks the worker executing it until
+    // a semaphore is posted.
+
+    bslmt::Semaphore *d_started_p;  // posted once the job has started
+    bslmt::Semaphore *d_release_p;  // waited on by the job
+
+    void operator()() const
+        // Post 'd_started_p', then wait on 'd_release_p'.
+    {
+        d_started_p->post();
+        d_release_p->wait();
+    }
+};
+
+struct DelayedPost {
+    // This 'struct' provides a thread function posting a semaphore after a
+    // delay.
+
+    bslmt::Semaphore *d_semaphore_p;  // semaphore to post
+
+    void operator()() const
+        // Sleep for 100 milliseconds, then post 'd_semaphore_p'.
+    {
+        bslmt::ThreadUtil::microSleep(100 * 1000);
+        d_semaphore_p->post();
+    }
+};
+
+struct RecordingJob {
+    // This 'struct' provides a job appending an identifier to a vector; it is
+    // meant to be executed by a pool having a single thread.
+
+    bsl::vector<int> *d_order_p;  // order of execution
+    int               d_id;       // identifier to record
+
+    void operator()() const
+        // Append 'd_id' to 'd_order_p'.
+    {
+        d_order_p->push_back(d_id);
+    }
+};
+
+struct SpawningJob {
+    // This 'struct' provides a job enqueuing, from the worker executing it, a
+    // sequence of 'RecordingJob' objects.
+
+    Obj              *d_pool_p;   // pool executing the job
+    bsl::vector<int> *d_order_p;  // order of execution
+    int               d_numJobs;  // number of jobs to enqueue
+
+    void operator()() const
+        // Enqueue 'd_numJobs' jobs recording the identifiers '0' to
+        // 'd_numJobs - 1', in order.
+    {
+        for (int i = 0; i < d_numJobs; ++i) {
+            RecordingJob job = { d_order_p, i };
+            d_pool_p->enqueueJob(job);
+        }
+    }
+};
+
+struct ThreadIdJob {
+    // This 'struct' provides a job recording the identifier of the thread
+    // executing it, then posting a semaphore.
+
+    bsls::Types::Uint64   *d_threadId_p;  // identifier of the running thread
+    bslmt::TimedSemaphore *d_done_p;      // posted once the job has run
+
+    void operator()() const
+        // Load the identifier of the current thread into 'd_threadId_p', then
+        // post 'd_done_p'.
+    {
+        *d_threadId_p = bslmt::ThreadUtil::selfIdAsUint64();
+        d_done_p->post();
+    }
+};
+
+struct StealingTestJob {
+    // This 'struct' provides a job that enqueues a 'ThreadIdJob' from the
+    // worker executing it, and then stays busy until that job has run.
+
+    Obj                   *d_pool_p;           // pool executing the job
+    bsls::Types::Uint64   *d_parentId_p;       // thread of this job
+    bsls::Types::Uint64   *d_childId_p;        // thread of the child job
+    bslmt::TimedSemaphore *d_done_p;           // posted by the child
+    bsls::AtomicInt       *d_childTimedOut_p;  // set if the child did not run
+
+    void operator()() const
+        // Enqueue the child job, then wait (for at most 10 seconds) for it to
+        // be executed.
+    {
+        *d_parentId_p = bslmt::ThreadUtil::selfIdAsUint64();
+
+        ThreadIdJob child = { d_childId_p, d_done_p };
+        d_pool_p->enqueueJob(child);
+
+        if (0 != d_done_p->timedWait(bsls::SystemTime::nowRealtimeClock() +
+                                     bsls::TimeInterval(10, 0))) {
+            *d_childTimedOut_p = 1;
+        }
+    }
+};
+
+template <class POOL>
+struct TreeJob {
+    // This 'struct' provides a job spawning a binomial tree of jobs: a job of
+    // depth 'd' enqueues one job of each depth '0' to 'd - 1', so that a job
+    // of depth 'd' results in the execution of '2^d' jobs in total.
+
+    POOL            *d_pool_p;     // pool executing the jobs
+    int              d_depth;      // depth of the tree rooted at this job
+    bsls::AtomicInt *d_numJobs_p;  // number of jobs executed
+
+    void operator()() const
+        // Enqueue the children of this job, then count it as executed.
+    {
+        for (int depth = d_depth - 1; 0 <= depth; --depth) {
+            TreeJob child = { d_pool_p, depth, d_numJobs_p };
+            d_pool_p->enqueueJob(child);
+        }
+        d_numJobs_p->addRelaxed(1);
+    }
+};
+
+template <class POOL>
+double timeTree(POOL *pool, int depth)
+    // Enqueue into the specified (started) 'pool' a 'TreeJob' of the specified
+    // 'depth', wait for the 'pool' to execute all the jobs of the tree, and
+    // return the elapsed wall time, in seconds.
+{
+    bsls::AtomicInt numJobs(0);
+    TreeJob<POOL>   root = { pool, depth, &numJobs };
+
+    bsls::Stopwatch timer;
+    timer.start();
+    pool->enqueueJob(root);
+    pool->drain();
+    timer.stop();
+
+    ASSERTV(depth, numJobs, (1 << depth) == numJobs);
+
+    return timer.elapsedTime();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       USAGE EXAMPLE SUPPORT
+// ----------------------------------------------------------------------------
+
+namespace {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Parallel Recursive Summation
+///- - - - - - - - - - - - - - - - - - - -
+// In this example we sum the elements of an array by recursively splitting
+// the array in halves, each summed by a separate job, until the pieces are
+// small enough to be summed directly.  The partial sums are accumulated in an
+// atomic variable.
+//
+// First, we define a structure describing the summation of a range of the
+// array, and a function executing it.  A range that is too large to be summed
+// directly is split in two: the function enqueues the summation of the upper
+// half into the pool and continues with the lower half.  Since the job is
+// enqueued from a worker thread, it is pushed onto the queue of that worker,
+// from which an idle worker can steal it:
+//..
+    struct SumJob {
+        bdlmt::WorkStealingThreadPool *d_pool_p;    // pool executing the job
+        const int                     *d_begin_p;   // first element to sum
+        const int                     *d_end_p;     // end of the elements
+        bsls::AtomicInt64             *d_result_p;  // accumulated sum
+
+        void operator()() const;
+            // Add to 'd_result_p' the sum of the elements in the range
+            // '[d_begin_p .. d_end_p)'.
+    };
+
+    void SumJob::operator()() const
+    {
+        enum { k_GRAIN_SIZE = 1024 };  // largest range summed directly
+
+        const int *begin = d_begin_p;
+        const int *end   = d_end_p;
+
+        while (end - begin > k_GRAIN_SIZE) {
+            const int *middle = begin + (end - begin) / 2;
+
+            SumJob upperHalf = { d_pool_p, middle, end, d_result_p };
+            d_pool_p->enqueueJob(upperHalf);
+
+            end = middle;
+        }
+
+        bsls::Types::Int64 sum = 0;
+        for (; begin != end; ++begin) {
+            sum += *begin;
+        }
+        d_result_p->addRelaxed(sum);
+    }
+//..
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test            = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    const bool verbose         = argc > 2;
+    const bool veryVerbose     = argc > 3;
+    const bool veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we create the array to sum:
+//..
+    bsl::vector<int> values(100000);
+    for (bsl::size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<int>(i % 100);
+    }
+//..
+// Next, we create and start a pool having 4 worker threads:
+//..
+    bdlmt::WorkStealingThreadPool pool(4);
+    int rc = pool.start();
+    ASSERT(0 == rc);
+//..
+// Now, we enqueue the job summing the whole array, and wait until the pool
+// has executed it, and all the jobs it enqueued, using 'drain':
+//..
+    bsls::AtomicInt64 result(0);
+    SumJob job = { &pool, values.data(), values.data() + values.size(),
+                   &result };
+
+    rc = pool.enqueueJob(job);
+    ASSERT(0 == rc);
+
+    pool.drain();
+//..
+// Finally, we verify the result, and stop the pool:
+//..
+    ASSERT(4950000 == result);
+
+    pool.stop();
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'stop' AND 'shutdown'
+        //
+        // Concerns:
+        //: 1 'stop' executes all the pending jobs before returning.
+        //:
+        //: 2 'shutdown' removes the pending jobs without executing them, and
+        //:   waits for the jobs being executed to complete.
+        //:
+        //: 3 'numPendingJobs' and 'numActiveThreads' reflect the jobs waiting
+        //:   and, respectively, the threads executing a job.
+        //:
+        //: 4 The pool can be restarted after 'shutdown'.
+        //
+        // Plan:
+        //: 1 In a pool having a single thread, enqueue a job blocking on a
+        //:   semaphore, wait until it has started, then enqueue further jobs
+        //:   incrementing a counter.
+        //:   Verify the accessors, release the blocking job, call 'stop', and
+        //:   verify that all the jobs were executed.  (C-1,3)
+        //:
+        //: 2 Repeat P-1, but call 'shutdown' (with the blocking job released
+        //:   from a separate thread after a delay), and verify that none of
+        //:   the pending jobs was executed.  (C-2)
+        //:
+        //: 3 Restart the pool, and verify that it executes new jobs.  (C-4)
+        //
+        // Testing:
+        //   void shutdown();
+        //   int numActiveThreads() const;
+        //   int numPendingJobs() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'stop' AND 'shutdown'" << endl
+                          << "=============================" << endl;
+
+        enum { k_NUM_JOBS = 10 };
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        for (int useShutdown = 0; useShutdown < 2; ++useShutdown) {
+            if (veryVerbose) { T_ P(useShutdown) }
+
+            Obj mX(1, &ta);  const Obj& X = mX;
+            ASSERT(0 == mX.start());
+
+            bslmt::Semaphore started;
+            bslmt::Semaphore release;
+            bsls::AtomicInt  counter(0);
+
+            BlockingJob blockingJob = { &started, &release };
+            ASSERT(0 == mX.enqueueJob(blockingJob));
+            started.wait();
+
+            for (int i = 0; i < k_NUM_JOBS; ++i) {
+                ASSERT(0 == mX.enqueueJob(&incrementCounter, &counter));
+            }
+            ASSERTV(X.numPendingJobs(), k_NUM_JOBS == X.numPendingJobs());
+            ASSERTV(X.numActiveThreads(), 1 == X.numActiveThreads());
+
+            if (useShutdown) {
+                DelayedPost               delayedPost = { &release };
+                bslmt::ThreadUtil::Handle handle;
+                ASSERT(0 == bslmt::ThreadUtil::create(&handle, delayedPost));
+
+                mX.shutdown();
+                ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+                ASSERTV(counter, 0 == counter);
+            }
+            else {
+                release.post();
+                mX.stop();
+
+                ASSERTV(counter, k_NUM_JOBS == counter);
+            }
+            ASSERT(false == X.isStarted());
+            ASSERT(0     == X.numPendingJobs());
+            ASSERT(0     == X.numActiveThreads());
+
+            ASSERT(0 == mX.start());
+            ASSERT(0 == mX.enqueueJob(&incrementCounter, &counter));
+            mX.stop();
+            ASSERTV(counter, (useShutdown ? 1 : k_NUM_JOBS + 1) == counter);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'drain'
+        //
+        // Concerns:
+        //: 1 'drain' returns only once all the jobs, including the jobs
+        //:   enqueued by other jobs, have been executed.
+        //:
+        //: 2 After 'drain', the pool is still started and enabled, and
+        //:   executes new jobs.
+        //:
+        //: 3 'drain' returns immediately if the pool is not started.
+        //
+        // Plan:
+        //: 1 For pools having various numbers of threads, enqueue binomial
+        //:   trees of jobs of increasing depths, call 'drain', and verify
+        //:   that all the jobs of the tree were executed.  (C-1,2)
+        //:
+        //: 2 Call 'drain' on a pool that was never started, and on a stopped
+        //:   pool.  (C-3)
+        //
+        // Testing:
+        //   void drain();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'drain'" << endl
+                          << "===============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        for (int numThreads = 1; numThreads <= 4; ++numThreads) {
+            Obj mX(numThreads, &ta);  const Obj& X = mX;
+
+            mX.drain();
+            ASSERT(0 == mX.start());
+
+            for (int depth = 0; depth <= 12; ++depth) {
+                if (veryVerbose) { T_ P_(numThreads) P(depth) }
+
+                bsls::AtomicInt numJobs(0);
+                TreeJob<Obj>    root = { &mX, depth, &numJobs };
+
+                ASSERT(0 == mX.enqueueJob(root));
+                mX.drain();
+
+                ASSERTV(numThreads, depth, numJobs, (1 << depth) == numJobs);
+                ASSERT(0    == X.numPendingJobs());
+                ASSERT(true == X.isStarted());
+                ASSERT(true == X.isEnabled());
+            }
+
+            mX.stop();
+            mX.drain();
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: JOBS ENQUEUED BY A WORKER ARE LOCAL AND CAN BE STOLEN
+        //
+        // Concerns:
+        //: 1 A job enqueued by a worker thread is pushed onto the queue of
+        //:   that worker, which executes the jobs of its own queue in LIFO
+        //:   order.
+        //:
+        //: 2 A job enqueued by a worker that remains busy is executed (i.e.,
+        //:   stolen) by another, idle, worker, and 'numStolenJobs' reflects
+        //:   the steal.
+        //
+        // Plan:
+        //: 1 In a pool having a single thread, execute a job enqueuing a
+        //:   sequence of jobs recording their identifiers, and verify that
+        //:   they are executed in reverse order.  (C-1)
+        //:
+        //: 2 In a pool having two threads, execute a job enqueuing a child
+        //:   job, then blocking until the child has run.  Verify that the
+        //:   child ran (on a different thread), and that 'numStolenJobs' is
+        //:   positive (the parent job itself may also have been stolen).
+        //:   (C-2)
+        //
+        // Testing:
+        //   CONCERN: JOBS ENQUEUED BY A WORKER ARE LOCAL AND CAN BE STOLEN
+        //   bsls::Types::Int64 numStolenJobs() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+               << "CONCERN: JOBS ENQUEUED BY A WORKER ARE LOCAL AND CAN BE "
+               << "STOLEN" << endl
+               << "========================================================"
+               << "======" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        if (verbose) cout << "\tLIFO execution of local jobs." << endl;
+        {
+            enum { k_NUM_JOBS = 8 };
+
+            Obj mX(1, &ta);  const Obj& X = mX;
+            ASSERT(0 == mX.start());
+
+            bsl::vector<int> order;
+            SpawningJob      job = { &mX, &order, k_NUM_JOBS };
+
+            ASSERT(0 == mX.enqueueJob(job));
+            mX.drain();
+
+            ASSERTV(order.size(), k_NUM_JOBS == order.size());
+            for (int i = 0; i < static_cast<int>(order.size()); ++i) {
+                ASSERTV(i, order[i], k_NUM_JOBS - 1 - i == order[i]);
+            }
+            ASSERT(0 == X.numStolenJobs());
+
+            mX.stop();
+        }
+
+        if (verbose) cout << "\tStealing from a busy worker." << endl;
+        {
+            Obj mX(2, &ta);  const Obj& X = mX;
+            ASSERT(0 == mX.start());
+
+            bsls::Types::Uint64   parentId = 0;
+            bsls::Types::Uint64   childId  = 0;
+            bslmt::TimedSemaphore done;
+            bsls::AtomicInt       childTimedOut(0);
+
+            StealingTestJob job = { &mX,
+                                    &parentId,
+                                    &childId,
+                                    &done,
+                                    &childTimedOut };
+
+            ASSERT(0 == mX.enqueueJob(job));
+            mX.drain();
+
+            ASSERT(0        == childTimedOut);
+            ASSERT(0        != childId);
+            ASSERT(parentId != childId);
+            ASSERTV(X.numStolenJobs(), 1 <= X.numStolenJobs());
+
+            mX.stop();
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'enqueueJob', 'enable', AND 'disable'
+        //
+        // Concerns:
+        //: 1 Each form of 'enqueueJob' enqueues a job that is executed once.
+        //:
+        //: 2 Jobs enqueued concurrently from several threads outside the pool
+        //:   are each executed exactly once.
+        //:
+        //: 3 'enqueueJob' fails, without executing the job, if the pool is
+        //:   disabled, and succeeds again once it is enabled.
+        //:
+        //: 4 The jobs are created using the allocator of the pool.
+        //
+        // Plan:
+        //: 1 Enqueue a job using each form of 'enqueueJob', stop the pool, and
+        //:   verify that each was executed.  (C-1,4)
+        //:
+        //: 2 Start several threads, each enqueuing jobs incrementing a
+        //:   distinct range of an array of counters, and verify, once the
+        //:   pool is stopped, that each counter has the value 1.  (C-2)
+        //:
+        //: 3 Disable the pool, verify that 'enqueueJob' fails and that no job
+        //:   is executed, then enable it and enqueue again.  (C-3)
+        //
+        // Testing:
+        //   void disable();
+        //   void enable();
+        //   int enqueueJob(const Job& functor);
+        //   int enqueueJob(bslmf::MovableRef<Job> functor);
+        //   int enqueueJob(WorkStealingThreadPoolJobFunc func, void *data);
+        //   bool isEnabled() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                   << "TESTING 'enqueueJob', 'enable', AND 'disable'" << endl
+                   << "=============================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        if (verbose) cout << "\tEach form of 'enqueueJob'." << endl;
+        {
+            Obj mX(2, &ta);
+            ASSERT(0 == mX.start());
+
+            bsls::AtomicInt counters[3];
+
+            const CountingJob job0 = { counters, 0 };
+            const Obj::Job    JOB0(job0);
+            ASSERT(0 == mX.enqueueJob(JOB0));
+
+            const CountingJob job1 = { counters, 1 };
+            Obj::Job          job1Functor(job1);
+            ASSERT(0 == mX.enqueueJob(bslmf::MovableRefUtil::move(
+                                                              job1Functor)));
+
+            ASSERT(0 == mX.enqueueJob(&incrementCounter, counters + 2));
+
+            const bsls::Types::Int64 numBlocks = ta.numBlocksTotal();
+
+            mX.stop();
+
+            for (int i = 0; i < 3; ++i) {
+                ASSERTV(i, counters[i], 1 == counters[i]);
+            }
+            ASSERT(0 < numBlocks);
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tConcurrent enqueuing." << endl;
+        {
+            enum { k_NUM_ENQUEUERS = 4, k_JOBS_PER_ENQUEUER = 2500 };
+
+            Obj mX(3, &ta);
+            ASSERT(0 == mX.start());
+
+            bsl::vector<bsls::AtomicInt> counters(
+                                    k_NUM_ENQUEUERS * k_JOBS_PER_ENQUEUER);
+            bsls::AtomicInt              numFailed(0);
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_ENQUEUERS];
+            for (int i = 0; i < k_NUM_ENQUEUERS; ++i) {
+                EnqueuingThread enqueuer = { &mX,
+                                             counters.data(),
+                                             i * k_JOBS_PER_ENQUEUER,
+                                             (i + 1) * k_JOBS_PER_ENQUEUER,
+                                             &numFailed };
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i], enqueuer));
+            }
+            for (int i = 0; i < k_NUM_ENQUEUERS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+            mX.stop();
+
+            ASSERT(0 == numFailed);
+            for (bsl::size_t i = 0; i < counters.size(); ++i) {
+                ASSERTV(i, counters[i], 1 == counters[i]);
+            }
+        }
+
+        if (verbose) cout << "\t'enable' and 'disable'." << endl;
+        {
+            bsls::AtomicInt counter(0);
+
+            Obj mX(2, &ta);  const Obj& X = mX;
+
+            ASSERT(false == X.isEnabled());
+            ASSERT(0     != mX.enqueueJob(&incrementCounter, &counter));
+
+            ASSERT(0 == mX.start());
+            ASSERT(true == X.isEnabled());
+
+            mX.disable();
+            ASSERT(false == X.isEnabled());
+            ASSERT(0     != mX.enqueueJob(&incrementCounter, &counter));
+            mX.drain();
+            ASSERT(0 == counter);
+
+            mX.enable();
+            ASSERT(true == X.isEnabled());
+            ASSERT(0    == mX.enqueueJob(&incrementCounter, &counter));
+            mX.drain();
+            ASSERT(1 == counter);
+
+            mX.stop();
+            ASSERT(false == X.isEnabled());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS, 'start', AND 'stop'
+        //
+        // Concerns:
+        //: 1 A pool is created with the specified number of threads, none of
+        //:   which is started.
+        //:
+        //: 2 'start' starts all the threads and is idempotent; 'stop' stops
+        //:   them, and the pool can be restarted.
+        //:
+        //: 3 The destructor stops a started pool.
+        //:
+        //: 4 The pool uses the supplied allocator, or the default allocator if
+        //:   none is supplied, and releases all its memory on destruction.
+        //
+        // Plan:
+        //: 1 For pools created with both constructors, with and without an
+        //:   allocator, and with various numbers of threads, verify the
+        //:   accessors before and after 'start', 'stop', and a restart.
+        //:   (C-1,2,4)
+        //:
+        //: 2 Destroy a started pool.  (C-3)
+        //
+        // Testing:
+        //   WorkStealingThreadPool(int numThreads, Allocator *ba = 0);
+        //   WorkStealingThreadPool(const ThreadAttributes&, int, Allocator*);
+        //   ~WorkStealingThreadPool();
+        //   int start();
+        //   void stop();
+        //   bool isStarted() const;
+        //   int numThreads() const;
+        //   int numThreadsStarted() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CREATORS, 'start', AND 'stop'" << endl
+                          << "=====================================" << endl;
+
+        for (int numThreads = 1; numThreads <= 5; ++numThreads) {
+            for (char cfg = 'a'; cfg <= 'c'; ++cfg) {
+                if (veryVerbose) { T_ P_(numThreads) P(cfg) }
+
+                bslma::TestAllocator ta("object", veryVeryVerbose);
+
+                Obj *objPtr = 0;
+                switch (cfg) {
+                  case 'a': {
+                    objPtr = new (ta) Obj(numThreads);
+                  } break;
+                  case 'b': {
+                    objPtr = new (ta) Obj(numThreads, &ta);
+                  } break;
+                  case 'c': {
+                    bslmt::ThreadAttributes attributes;
+                    attributes.setStackSize(256 * 1024);
+                    objPtr = new (ta) Obj(attributes, numThreads, &ta);
+                  } break;
+                }
+                Obj& mX = *objPtr;  const Obj& X = mX;
+
+                bslma::TestAllocator& oa = 'a' == cfg ? defaultAllocator : ta;
+                ASSERTV(cfg, 0 < oa.numBlocksInUse());
+
+                ASSERT(numThreads == X.numThreads());
+                ASSERT(0          == X.numThreadsStarted());
+                ASSERT(false      == X.isStarted());
+                ASSERT(0          == X.numPendingJobs());
+                ASSERT(0          == X.numStolenJobs());
+
+                for (int iteration = 0; iteration < 2; ++iteration) {
+                    ASSERT(0          == mX.start());
+                    ASSERT(true       == X.isStarted());
+                    ASSERT(numThreads == X.numThreadsStarted());
+
+                    ASSERT(0          == mX.start());
+                    ASSERT(numThreads == X.numThreadsStarted());
+
+                    mX.stop();
+                    ASSERT(false      == X.isStarted());
+                    ASSERT(0          == X.numThreadsStarted());
+                    ASSERT(numThreads == X.numThreads());
+                }
+
+                ASSERT(0 == mX.start());
+                ta.deleteObject(objPtr);
+
+                ASSERTV(cfg, 0 == ta.numBlocksInUse());
+                ASSERTV(cfg, 0 == defaultAllocator.numBlocksInUse());
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Start a pool, enqueue jobs from outside the pool and from its
+        //:   workers, and verify that they are all executed.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            bsls::AtomicInt counter(0);
+
+            Obj mX(4, &ta);  const Obj& X = mX;
+            ASSERT(4     == X.numThreads());
+            ASSERT(false == X.isStarted());
+
+            ASSERT(0    == mX.start());
+            ASSERT(true == X.isStarted());
+
+            for (int i = 0; i < 100; ++i) {
+                ASSERT(0 == mX.enqueueJob(&incrementCounter, &counter));
+            }
+            mX.drain();
+            ASSERTV(counter, 100 == counter);
+
+            bsls::AtomicInt numJobs(0);
+            TreeJob<Obj>    root = { &mX, 8, &numJobs };
+            ASSERT(0 == mX.enqueueJob(root));
+            mX.drain();
+            ASSERTV(numJobs, 256 == numJobs);
+
+            if (veryVerbose) { P(X.numStolenJobs()) }
+
+            mX.stop();
+            ASSERT(false == X.isStarted());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // CONCERN: PERFORMANCE OF FORK/JOIN WORKLOADS
+        //
+        // Concerns:
+        //: 1 Jobs spawning other jobs execute faster in a work-stealing pool
+        //:   than in a pool sharing a single queue among all its threads.
+        //
+        // Plan:
+        //: 1 For 'bdlmt::WorkStealingThreadPool' and 'bdlmt::FixedThreadPool'
+        //:   (note that 'bdlmt::ThreadPool::drain' disables the pool, which
+        //:   precludes jobs enqueued by other jobs), each having the number of
+        //:   threads specified as the second argument (4 by default), time the
+        //:   execution of a binomial tree of '2^depth' jobs, each enqueuing
+        //:   its children from the worker executing it.  The depth is the
+        //:   third argument (18 by default).  (C-1)
+        //
+        // Testing:
+        //   CONCERN: PERFORMANCE OF FORK/JOIN WORKLOADS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                     << "CONCERN: PERFORMANCE OF FORK/JOIN WORKLOADS" << endl
+                     << "===========================================" << endl;
+
+        int numThreads = argc > 2 ? bsl::atoi(argv[2]) : 0;
+        int depth      = argc > 3 ? bsl::atoi(argv[3]) : 0;
+        if (0 >= numThreads) {
+            numThreads = 4;
+        }
+        if (0 >= depth) {
+            depth = 18;
+        }
+        const int numJobs = 1 << depth;
+
+        cout << "Threads: " << numThreads << ", jobs: " << numJobs << endl;
+
+        {
+            Obj mX(numThreads);
+            mX.start();
+
+            const double elapsed = timeTree(&mX, depth);
+            cout << "WorkStealingThreadPool: " << elapsed << "s ("
+                 << numJobs / elapsed << " jobs/s, "
+                 << mX.numStolenJobs() << " stolen)" << endl;
+
+            mX.stop();
+        }
+        {
+            bdlmt::FixedThreadPool mX(numThreads, numJobs);
+            mX.start();
+
+            const double elapsed = timeTree(&mX, depth);
+            cout << "FixedThreadPool:        " << elapsed << "s ("
+                 << numJobs / elapsed << " jobs/s)" << endl;
+
+            mX.stop();
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,44 @@
+// bsl_flat_map.h                                                     -*-C++-*-
+#ifndef INCLUDED_BSL_FLAT_MAP
+#define INCLUDED_BSL_FLAT_MAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide functionality of the corresponding C++ Standard header.
+//
+//@SEE_ALSO: package bos+stdhdrs in the bos package group
+//
+//@DESCRIPTION: Provide types, in the 'bsl' namespace, equivalent to those
+// defined in the corresponding C++ standard header.  There is no native
+// '<flat_map>' header prior to C++23, so this header includes only Bloomberg's
+// implementation of the standard type.
+
+#include <bsls_nativestd.h>
+
+// Include Bloomberg's implementation, unless compilation is configured to
+// override native types in the 'std' namespace with Bloomberg's
+// implementation, in which case the implementation file will be included by
+// the Bloomberg supplied standard header file.
+
+#ifndef BSL_OVERRIDES_STD
+#include <bslstl_flatmap.h>
+#endif
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
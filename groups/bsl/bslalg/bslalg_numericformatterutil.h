@@ -13,7 +13,32 @@ BSLS_IDENT("$Id: $")
 //@DESCRIPTION: This component, 'bslalg_numericformatterutil' provides a
 // namespace 'struct', 'bslalg::NumericFormatterUtil', containing the template
 // function 'toChars', that translates integral fundamental types into ASCII
-// strings.
+// strings, and overloads of 'toChars' that translate 'double' and 'float'
+// values into the shortest ASCII strings from which they can be read back
+// exactly.
+//
+///Floating Point Formatting
+///-------------------------
+// The 'toChars' overloads for 'double' and 'float' write the decimal having
+// the least number of significant digits that reads back as the same value
+// (choosing the closest such decimal, and the even one of two equally close
+// decimals).  The result is laid out as the C library's 'printf' function
+// lays out the "%g" conversion: in scientific notation (e.g., "1.5e+20",
+// "2e-07") if the decimal exponent is less than -4 or not less than the
+// precision, and in fixed notation (e.g., "0.001", "123.25", "1000")
+// otherwise, with no trailing zeros after the decimal point.  Infinities are
+// written as "inf" and "-inf", and NaNs as "nan" or "-nan".  No locale is
+// consulted.
+//
+// The precision is 'bsl::numeric_limits<TYPE>::max_digits10' (17 for
+// 'double' and 9 for 'float') unless it is specified.  A specified precision
+// also limits the number of significant digits written: if the shortest
+// decimal has more digits than the precision, the value is written rounded
+// to that many digits, exactly as by "%.*g".  Note that for a normal (i.e.,
+// not subnormal) value and a precision of at most
+// 'bsl::numeric_limits<TYPE>::digits10', the result is always the same as
+// that of the much slower "%.*g", since with so few digits the correctly
+// rounded decimal is the shortest one whenever that has no more digits.
 //
 ///Usage
 ///-----
@@ -59,6 +84,39 @@ BSLS_IDENT("$Id: $")
 //      result->sputn(buffer, ret - buffer);
 //  }
 //..
+//
+///Example 2: Writing the Shortest Representation of a 'double'
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to write a 'double' so that it reads back as the same value
+// using as few characters as possible.
+//
+// First, we declare a buffer large enough for any 'double' value written with
+// the default precision, such as "-2.2250738585072014e-308":
+//..
+//  char buffer[24];
+//..
+// Then, we write the value 0.1, which "%.17g" would render as
+// "0.10000000000000001":
+//..
+//  char *end = bslalg::NumericFormatterUtil::toChars(buffer,
+//                                                    buffer + sizeof buffer,
+//                                                    0.1);
+//  assert(bsl::string(buffer, end) == "0.1");
+//..
+// Finally, we write a value that needs 16 digits to be read back, and that
+// same value limited to 6 significant digits:
+//..
+//  end = bslalg::NumericFormatterUtil::toChars(buffer,
+//                                              buffer + sizeof buffer,
+//                                              1.0 / 3);
+//  assert(bsl::string(buffer, end) == "0.3333333333333333");
+//
+//  end = bslalg::NumericFormatterUtil::toChars(buffer,
+//                                              buffer + sizeof buffer,
+//                                              1.0 / 3,
+//                                              6);
+//  assert(bsl::string(buffer, end) == "0.333333");
+//..
 
 #include <bslscm_version.h>
 
@@ -127,6 +185,34 @@ class NumericFormatterUtil {
         // 'first' with leftover room following the return value.  The behavior
         // is undefined unless 'first < last' and 'base' is in the range
         // '[ 2 .. 36 ]'.
+
+    static char *toChars(char   *first,
+                         char   *last,
+                         double  value) BSLS_KEYWORD_NOEXCEPT;
+    static char *toChars(char   *first,
+                         char   *last,
+                         float   value) BSLS_KEYWORD_NOEXCEPT;
+    static char *toChars(char   *first,
+                         char   *last,
+                         double  value,
+                         int     precision) BSLS_KEYWORD_NOEXCEPT;
+    static char *toChars(char   *first,
+                         char   *last,
+                         float   value,
+                         int     precision) BSLS_KEYWORD_NOEXCEPT;
+        // Write the specified 'value' into the character buffer starting at
+        // the specified 'first' and ending at the specified 'last', as the
+        // shortest decimal that reads back as 'value', in the notation of the
+        // "%g" conversion of 'printf' (see {Floating Point Formatting}).
+        // Optionally specify 'precision', the notation threshold and the
+        // maximum number of significant digits to write; if the shortest
+        // decimal has more than 'precision' digits, 'value' is instead
+        // written rounded to 'precision' digits.  If 'precision' is not
+        // specified, 'bsl::numeric_limits<TYPE>::max_digits10' is used.
+        // Return the address one past the last character written on success,
+        // or 0 on failure.  The only reason for failure is if the range
+        // '[ first, last )' is not large enough to contain the result.  The
+        // behavior is undefined unless 'first <= last' and '1 <= precision'.
 };
 
 // ============================================================================
@@ -173,6 +259,22 @@ char *NumericFormatterUtil::toChars(char *first,
     return toCharsImpl(first, last, uValue, base);
 }
 
+inline
+char *NumericFormatterUtil::toChars(char   *first,
+                                    char   *last,
+                                    double  value) BSLS_KEYWORD_NOEXCEPT
+{
+    return toChars(first, last, value, 17);
+}
+
+inline
+char *NumericFormatterUtil::toChars(char  *first,
+                                    char  *last,
+                                    float  value) BSLS_KEYWORD_NOEXCEPT
+{
+    return toChars(first, last, value, 9);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -42,9 +42,15 @@ using std::numeric_limits;
 // [ 4] char *toChars(char *, char *, TYPE, int); // Random Signed
 // [ 3] char *toChars(char *, char *, TYPE, int); // Corner Cases
 // [ 2] char *toChars(char *, char *, TYPE, int); // Table-Driven
+// [ 6] char *toChars(char *, char *, double);
+// [ 6] char *toChars(char *, char *, float);
+// [ 6] char *toChars(char *, char *, double, int);
+// [ 6] char *toChars(char *, char *, float, int);
+// [ 7] char *toChars(char *, char *, FLOAT_TYPE); // Random
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 6] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
+// [-2] FLOATING POINT SPEED TRIAL
 
 // ============================================================================
 //                     STANDARD BSL ASSERT TEST FUNCTION
@@ -599,6 +605,95 @@ void testValueMeta(Uint64 num, unsigned base)
 
 const Uint64 uint64Max = ~0ULL;    // max value a 'Uint64' can represent
 
+inline
+bool readBack(double *result, const char *string)
+    // Load into the specified 'result' the 'double' value read from the
+    // specified 'string'.  Return 'true' on success, and 'false' otherwise.
+{
+    return 1 == std::sscanf(string, "%lf", result);
+}
+
+inline
+bool readBack(float *result, const char *string)
+    // Load into the specified 'result' the 'float' value read from the
+    // specified 'string'.  Return 'true' on success, and 'false' otherwise.
+{
+    return 1 == std::sscanf(string, "%f", result);
+}
+
+int countSignificantDigits(const char *first, const char *last)
+    // Return the number of significant digits of the decimal in the specified
+    // '[ first, last )', which is in fixed or scientific notation, ignoring
+    // leading and trailing zeros (and returning 1 for a zero).
+{
+    const char *begin = first;
+    const char *end   = std::find(first, last, 'e');
+
+    while (begin < end && ('0' == *begin || '.' == *begin || '-' == *begin)) {
+        ++begin;
+    }
+    while (begin < end && ('0' == end[-1] || '.' == end[-1])) {
+        --end;
+    }
+
+    if (begin == end) {
+        return 1;                                                     // RETURN
+    }
+    return static_cast<int>(end - begin) - (std::find(begin, end, '.') != end);
+}
+
+template <class FLOAT_TYPE>
+void checkShortest(FLOAT_TYPE value, int precision)
+    // Check that 'toChars' writes the specified 'value' as a decimal that
+    // reads back as 'value', that no decimal with fewer digits does so, and
+    // that the result for the specified 'precision' is the same as that of
+    // 'sprintf' with "%.*g" if either 'value' is normal and 'precision' is at
+    // most 'digits10', or the shortest decimal has more than 'precision'
+    // digits.  The behavior is undefined unless 'value' is finite and
+    // 'precision < max_digits10'.
+{
+    typedef numeric_limits<FLOAT_TYPE> Limits;
+
+    char buffer[64];
+    char *end = Util::toChars(buffer, buffer + sizeof buffer, value);
+    ASSERT(0 != end);
+    if (0 == end) {
+        return;                                                       // RETURN
+    }
+    *end = 0;
+
+    FLOAT_TYPE result = 0;
+    ASSERTV(buffer, readBack(&result, buffer));
+    ASSERTV(buffer, result == value);
+
+    const int numDigits = countSignificantDigits(buffer, end);
+    if (1 < numDigits) {
+        // The correctly rounded decimal having one digit less must not read
+        // back as 'value'.
+
+        char shorter[64];
+        std::sprintf(shorter, "%.*e", numDigits - 2, value);
+
+        ASSERTV(buffer, shorter, readBack(&result, shorter));
+        ASSERTV(buffer, shorter, result != value);
+    }
+
+    if (precision < numDigits
+     || (precision <= Limits::digits10
+      && (Limits::min() <= value || value <= -Limits::min()))) {
+        char expected[64];
+        std::sprintf(expected, "%.*g", precision, value);
+
+        end = Util::toChars(buffer, buffer + sizeof buffer, value, precision);
+        ASSERT(0 != end);
+        if (0 != end) {
+            *end = 0;
+            ASSERTV(precision, buffer, expected,
+                    0 == std::strcmp(buffer, expected));
+        }
+    }
+}
+
 }  // close namespace u
 }  // close unnamed namespace
 
@@ -665,7 +760,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 6: {
+      case 8: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -702,6 +797,306 @@ int main(int argc, char *argv[])
 
         writeJsonScalar(sb, -1234567890);    // worst case int, max string len
         ASSERT("-1234567890" == oss.str());
+
+///Example 2: Writing the Shortest Representation of a 'double'
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to write a 'double' so that it reads back as the same value
+// using as few characters as possible.
+//
+// First, we declare a buffer large enough for any 'double' value written with
+// the default precision, such as "-2.2250738585072014e-308":
+//..
+    char buffer[24];
+//..
+// Then, we write the value 0.1, which "%.17g" would render as
+// "0.10000000000000001":
+//..
+    char *end = bslalg::NumericFormatterUtil::toChars(buffer,
+                                                      buffer + sizeof buffer,
+                                                      0.1);
+    ASSERT(std::string(buffer, end) == "0.1");
+//..
+// Finally, we write a value that needs 16 digits to be read back, and that
+// same value limited to 6 significant digits:
+//..
+    end = bslalg::NumericFormatterUtil::toChars(buffer,
+                                                buffer + sizeof buffer,
+                                                1.0 / 3);
+    ASSERT(std::string(buffer, end) == "0.3333333333333333");
+
+    end = bslalg::NumericFormatterUtil::toChars(buffer,
+                                                buffer + sizeof buffer,
+                                                1.0 / 3,
+                                                6);
+    ASSERT(std::string(buffer, end) == "0.333333");
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // RANDOM FLOATING POINT VALUES TEST
+        //
+        // Concerns:
+        //: 1 Every finite 'double' and 'float' value is written as a decimal
+        //:   that reads back as the same value.
+        //:
+        //: 2 No decimal having fewer significant digits reads back as the
+        //:   value.
+        //:
+        //: 3 For normal values and a precision of at most 'digits10', and for
+        //:   any value whose shortest decimal has more digits than the
+        //:   precision, the result is the same as that of 'sprintf' with
+        //:   "%.*g".
+        //
+        // Plan:
+        //: 1 Use an MMIX-style random number generator to generate random
+        //:   bit patterns of 'double' and 'float', covering all exponents,
+        //:   and check each finite one with 'u::checkShortest', which reads
+        //:   the result back with 'sscanf', and compares the result of
+        //:   'sprintf' rounded to one digit less.  (C-1..3)
+        //:
+        //: 2 Check also values whose shortest decimal ends in 5 with
+        //:   precisions truncating it, the least and greatest significands of
+        //:   every exponent, and the smallest subnormal values.  (C-1..3)
+        //
+        // Testing:
+        //   char *toChars(char *, char *, FLOAT_TYPE); // Random
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("RANDOM FLOATING POINT VALUES TEST\n"
+                            "=================================\n");
+
+        int iterations = 100 * 1000;
+        if (verbose) {
+            const int it = std::atoi(argv[2]);
+            if (it) {
+                iterations = it;
+                P(iterations);
+            }
+        }
+
+        u::mmixRand64(true);
+
+        for (int ii = 0; ii < iterations; ++ii) {
+            const Uint64 bits      = u::mmixRand64();
+            const int    precision = static_cast<int>(bits % 16) + 1;
+
+            double doubleValue;
+            std::memcpy(&doubleValue, &bits, sizeof doubleValue);
+            if (doubleValue == doubleValue
+             && doubleValue - doubleValue == 0) {  // finite
+                u::checkShortest(doubleValue, precision);
+            }
+
+            const unsigned floatBits = static_cast<unsigned>(bits >> 32);
+            float          floatValue;
+            std::memcpy(&floatValue, &floatBits, sizeof floatValue);
+            if (floatValue == floatValue && floatValue - floatValue == 0) {
+                u::checkShortest(floatValue, precision % 8 + 1);
+            }
+        }
+
+        for (int i = 0; i < 20000; ++i) {
+            // Values whose shortest decimal ends in 5, so that rounding it to
+            // one digit less depends on the exact value.
+
+            const double value = (2 * i + 1) / 2000.0;
+            for (int precision = 1; precision <= 5; ++precision) {
+                u::checkShortest(value, precision);
+                u::checkShortest(static_cast<float>(value), precision);
+            }
+        }
+
+        for (Uint64 exponent = 0; exponent < 0x7FF; ++exponent) {
+            for (Uint64 fraction = 0; fraction < 4; ++fraction) {
+                const Uint64 least    = (exponent << 52) | fraction;
+                const Uint64 greatest = (exponent << 52)
+                                      | ((1ULL << 52) - 1 - fraction);
+                double       value;
+
+                std::memcpy(&value, &least, sizeof value);
+                u::checkShortest(value, 15);
+                std::memcpy(&value, &greatest, sizeof value);
+                u::checkShortest(-value, 15);
+            }
+        }
+
+        for (unsigned exponent = 0; exponent < 0xFF; ++exponent) {
+            for (unsigned fraction = 0; fraction < 16; ++fraction) {
+                const unsigned least    = (exponent << 23) | fraction;
+                const unsigned greatest = (exponent << 23)
+                                        | ((1u << 23) - 1 - fraction);
+                float          value;
+
+                std::memcpy(&value, &least, sizeof value);
+                u::checkShortest(value, 6);
+                std::memcpy(&value, &greatest, sizeof value);
+                u::checkShortest(-value, 6);
+            }
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // FLOATING POINT TABLE-DRIVEN TEST
+        //
+        // Concerns:
+        //: 1 A 'double' or 'float' is written as the shortest decimal that
+        //:   reads back as the same value, in fixed notation if its decimal
+        //:   exponent is in '[ -4 .. precision )', and in scientific notation
+        //:   otherwise.
+        //:
+        //: 2 If the shortest decimal has more digits than a specified
+        //:   precision, the value is written rounded to the precision.
+        //:
+        //: 3 Zeros, infinities, and NaNs are written as "0", "-0", "inf",
+        //:   "-inf", and "nan".
+        //:
+        //: 4 If the buffer is one character too small, 0 is returned.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, write values, with and without
+        //:   a precision, to a buffer of exactly the required size and to a
+        //:   buffer one character smaller, and check the results.  (C-1..4)
+        //
+        // Testing:
+        //   char *toChars(char *, char *, double);
+        //   char *toChars(char *, char *, float);
+        //   char *toChars(char *, char *, double, int);
+        //   char *toChars(char *, char *, float, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("FLOATING POINT TABLE-DRIVEN TEST\n"
+                            "================================\n");
+
+        const double k_INF = numeric_limits<double>::infinity();
+        const double k_NAN = numeric_limits<double>::quiet_NaN();
+
+        static const struct {
+            int         d_line;
+            double      d_value;
+            bool        d_isFloat;    // convert 'd_value' to 'float'
+            int         d_precision;  // 0 means not specified
+            const char *d_expected;
+        } DATA[] = {
+            //LINE  VALUE                    FLOAT  PREC  EXPECTED
+            //----  -----                    -----  ----  --------
+            { L_,   0.0,                     false,    0, "0"               },
+            { L_,   -0.0,                    false,    0, "-0"              },
+            { L_,   1.0,                     false,    0, "1"               },
+            { L_,   -1.5,                    false,    0, "-1.5"            },
+            { L_,   0.1,                     false,    0, "0.1"             },
+            { L_,   123.25,                  false,    0, "123.25"          },
+            { L_,   1000.0,                  false,    0, "1000"            },
+            { L_,   1.0 / 3,                 false,    0,
+                                                      "0.3333333333333333" },
+            { L_,   2.0 / 3,                 false,    0,
+                                                      "0.6666666666666666" },
+            { L_,   0.0001,                  false,    0, "0.0001"          },
+            { L_,   0.00001,                 false,    0, "1e-05"           },
+            { L_,   1e16,                    false,    0,
+                                                       "10000000000000000" },
+            { L_,   1e17,                    false,    0, "1e+17"           },
+            { L_,   12345678901234567.0,     false,    0,
+                                                       "12345678901234568" },
+            { L_,   9007199254740993.0,      false,    0, "9007199254740992"},
+            { L_,   -9.9e100,                false,    0, "-9.9e+100"       },
+            { L_,   1.7976931348623157e308,  false,    0,
+                                                 "1.7976931348623157e+308" },
+            { L_,   2.2250738585072014e-308, false,    0,
+                                                 "2.2250738585072014e-308" },
+            { L_,   4.9406564584124654e-324, false,    0, "5e-324"          },
+            { L_,   1e23,                    false,    0, "1e+23"           },
+            { L_,   5e-324 * 3,              false,    0, "1.5e-323"        },
+            { L_,   k_INF,                   false,    0, "inf"             },
+            { L_,   -k_INF,                  false,    0, "-inf"            },
+            { L_,   k_NAN,                   false,    0, "nan"             },
+
+            { L_,   1.0 / 3,                 false,    6, "0.333333"        },
+            { L_,   1.0 / 3,                 false,   16,
+                                                      "0.3333333333333333" },
+            { L_,   0.1,                     false,    1, "0.1"             },
+            { L_,   0.15,                    false,    1, "0.1"             },
+            { L_,   1234.5,                  false,    2, "1.2e+03"         },
+            { L_,   1234.5,                  false,    4, "1234"            },
+            { L_,   1234.5,                  false,    5, "1234.5"          },
+            { L_,   -9.9e100,                false,   17, "-9.9e+100"       },
+            { L_,   1e16,                    false,   16, "1e+16"           },
+            { L_,   0.0,                     false,    1, "0"               },
+            { L_,   2.675,                   false,    3, "2.67"            },
+            { L_,   1.005,                   false,    3, "1"               },
+            { L_,   0.125,                   false,    2, "0.12"            },
+            { L_,   0.375,                   false,    2, "0.38"            },
+            { L_,   2.5,                     false,    1, "2"               },
+            { L_,   3.5,                     false,    1, "4"               },
+            { L_,   9.5,                     false,    1, "1e+01"           },
+            { L_,   99999.5,                 false,    5, "1e+05"           },
+            { L_,   1.0000000000000002,      false,   16, "1"               },
+            { L_,   1e23,                    false,   16, "1e+23"           },
+            { L_,   5e-324 * 3,              false,    1, "1e-323"          },
+            { L_,   5e-324 * 5,              false,    1, "2e-323"          },
+
+            { L_,   0.1,                     true,     0, "0.1"             },
+            { L_,   1.0 / 3,                 true,     0, "0.33333334"      },
+            { L_,   16777216.0,              true,     0, "16777216"        },
+            { L_,   1e10,                    true,     0, "1e+10"           },
+            { L_,   3.4028234663852886e38,   true,     0, "3.4028235e+38"   },
+            { L_,   1.1754943508222875e-38,  true,     0, "1.1754944e-38"   },
+            { L_,   1.4012984643248171e-45,  true,     0, "1e-45"           },
+            { L_,   1.0 / 3,                 true,     3, "0.333"           },
+            { L_,   0.1234567891,            true,     8, "0.12345679"      },
+            { L_,   1.5,                     true,     1, "2"               },
+            { L_,   0.45,                    true,     1, "0.4"             },
+            { L_,   16777215.0,              true,     7, "1.677722e+07"    },
+            { L_,   -k_INF,                  true,     0, "-inf"            },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int          LINE      = DATA[ti].d_line;
+            const double       VALUE     = DATA[ti].d_value;
+            const bool         IS_FLOAT  = DATA[ti].d_isFloat;
+            const int          PRECISION = DATA[ti].d_precision;
+            const std::string  EXPECTED  = DATA[ti].d_expected;
+            const IntPtr       LENGTH    = EXPECTED.length();
+
+            if (veryVerbose) {
+                P_(LINE) P_(VALUE) P_(IS_FLOAT) P_(PRECISION)
+                                                         P(EXPECTED.c_str());
+            }
+
+            char  buffer[64];
+            char *result = 0;
+            for (IntPtr size = LENGTH - 1; size <= LENGTH; ++size) {
+                const float FLOAT_VALUE = static_cast<float>(VALUE);
+
+                std::memset(buffer, '#', sizeof buffer);
+
+                if (IS_FLOAT) {
+                    result = PRECISION
+                           ? Util::toChars(buffer, buffer + size,
+                                           FLOAT_VALUE, PRECISION)
+                           : Util::toChars(buffer, buffer + size, FLOAT_VALUE);
+                }
+                else {
+                    result = PRECISION
+                           ? Util::toChars(buffer, buffer + size,
+                                           VALUE, PRECISION)
+                           : Util::toChars(buffer, buffer + size, VALUE);
+                }
+
+                if (size < LENGTH) {
+                    ASSERTV(LINE, size, 0 == result);
+                    ASSERTV(LINE, '#' == buffer[0]);
+                }
+            }
+
+            ASSERTV(LINE, 0 != result);
+            if (0 != result) {
+                const std::string RESULT(buffer, result);
+                ASSERTV(LINE, RESULT.c_str(), EXPECTED.c_str(),
+                        RESULT == EXPECTED);
+            }
+            ASSERTV(LINE, '#' == buffer[LENGTH]);
+        }
       } break;
       case 5: {
         // --------------------------------------------------------------------
@@ -2086,6 +2481,87 @@ int main(int argc, char *argv[])
         }
       } break;
 #endif
+      case -2: {
+        // --------------------------------------------------------------------
+        // FLOATING POINT SPEED TRIAL
+        //
+        // Concern:
+        //: 1 Measure how the performance of 'toChars' for 'double' compares
+        //:   to that of 'sprintf' with "%.17g" and "%.15g".
+        //
+        // Plan:
+        //: 1 Format random bit patterns, which mostly need 16 or 17 digits,
+        //:   and values having 2 decimal places, like prices, many times and
+        //:   time the functions using 'bsls_stopwatch'.
+        //
+        //  Results on Linux host, g++, -O2:
+        //
+        //  random:       toChars: 39.285 nsec
+        //  random: sprintf %.17g: 560.084 nsec
+        //  random: sprintf %.15g: 543.53 nsec
+        //  prices:       toChars: 50.784 nsec
+        //  prices: sprintf %.17g: 380.824 nsec
+        //  prices: sprintf %.15g: 328.994 nsec
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("FLOATING POINT SPEED TRIAL\n"
+                            "==========================\n");
+
+        enum { k_NUM_VALUES = 1000, k_ITERATIONS = 1000 };
+
+        double random[k_NUM_VALUES];
+        double prices[k_NUM_VALUES];
+
+        u::mmixRand64(true);
+        for (int ii = 0; ii < k_NUM_VALUES; ) {
+            const Uint64 bits = u::mmixRand64();
+            std::memcpy(&random[ii], &bits, sizeof(double));
+            if (random[ii] - random[ii] == 0) {  // finite
+                prices[ii] = static_cast<double>(bits % 1000000) / 100;
+                ++ii;
+            }
+        }
+
+        const double *SETS[]  = { random, prices };
+        const char   *NAMES[] = { "random", "prices" };
+
+        for (int set = 0; set < 2; ++set) {
+            const double *values = SETS[set];
+            char          buffer[32];
+            Uint64        length = 0;
+
+            for (int mode = 0; mode < 3; ++mode) {
+                bsls::Stopwatch sw;
+                sw.start(true);
+                for (int jj = 0; jj < k_ITERATIONS; ++jj) {
+                    for (int ii = 0; ii < k_NUM_VALUES; ++ii) {
+                        if (0 == mode) {
+                            length += Util::toChars(buffer,
+                                                    buffer + sizeof buffer,
+                                                    values[ii]) - buffer;
+                        }
+                        else {
+                            length += sprintf(buffer,
+                                              "%.*g",
+                                              1 == mode ? 17 : 15,
+                                              values[ii]);
+                        }
+                    }
+                }
+                sw.stop();
+
+                static const char *const MODES[] = { "      toChars",
+                                                     "sprintf %.17g",
+                                                     "sprintf %.15g" };
+                printf("%s: %s: %g nsec\n",
+                       NAMES[set],
+                       MODES[mode],
+                       1e9 * sw.accumulatedUserTime() /
+                                            (k_NUM_VALUES * k_ITERATIONS));
+            }
+            if (veryVerbose) P(length);
+        }
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;
@@ -279,6 +279,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bsls_assert.h>
 
+#include <bslh_issplitinvariant.h>
 #include <bslh_spookyhashalgorithm.h>
 
 namespace BloombergLP {
@@ -372,6 +373,16 @@ DefaultHashAlgorithm::result_type DefaultHashAlgorithm::computeHash()
 
 }  // close package namespace
 
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+namespace bslh {
+template <>
+struct IsSplitInvariant<bslh::DefaultHashAlgorithm>
+    : bsl::true_type {};
+}  // close namespace bslh
+
 }  // close enterprise namespace
 
 #endif
@@ -293,6 +293,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bsls_assert.h>
 
+#include <bslh_issplitinvariant.h>
 #include <bslh_spookyhashalgorithm.h>
 
 namespace BloombergLP {
@@ -395,6 +396,16 @@ DefaultSeededHashAlgorithm::computeHash()
 
 }  // close package namespace
 
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+namespace bslh {
+template <>
+struct IsSplitInvariant<bslh::DefaultSeededHashAlgorithm>
+    : bsl::true_type {};
+}  // close namespace bslh
+
 }  // close enterprise namespace
 
 #endif
@@ -9,8 +9,9 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bslh::Hash: functor that runs 'bslh' hash algorithms on supported types
+//  bslh::IsContiguouslyHashable: trait for types hashed as their bytes
 //
-//@SEE_ALSO:
+//@SEE_ALSO: bslh_issplitinvariant
 //
 //@DESCRIPTION: This component provides a templated 'struct', 'bslh::Hash',
 // that defines a hash-functor that can be used with standard containers (a
@@ -77,6 +78,41 @@ BSLS_IDENT("$Id: $")
 // representation.  The algorithm will then incorporate the type into its
 // internal state and return a finalized hash when requested.
 //
+///Hashing Contiguous Ranges
+///-------------------------
+// The 'hashAppend' of many types (integers and pointers among the fundamental
+// types) passes exactly the bytes of the object to the hashing algorithm, in a
+// single call.  Such types are identified by the
+// 'bslh::IsContiguouslyHashable' trait.  If a hashing algorithm produces the
+// same hash regardless of how its input is divided among calls (as declared
+// by the 'bslh::IsSplitInvariant' trait, which the algorithms of the 'bslh'
+// package declare), a contiguous range of objects of such a type can be
+// hashed by passing the whole range to the algorithm in one call, with the
+// same result as calling 'hashAppend' on each element, but without the
+// per-element overhead, and in a form that lets the algorithm use its
+// block-processing loop.  The function 'bslh::hashAppendRange' does this, and
+// falls back to calling 'hashAppend' on each element for other types and
+// other algorithms.  Containers storing their elements
+// contiguously, such as 'bsl::vector', should use it in their 'hashAppend':
+//..
+//  template <class HASH_ALGORITHM, class TYPE>
+//  void hashAppend(HASH_ALGORITHM& hashAlg, const MyVector<TYPE>& input)
+//  {
+//      using bslh::hashAppend;
+//      hashAppend(hashAlg, input.size());
+//      bslh::hashAppendRange(hashAlg,
+//                            input.data(),
+//                            input.data() + input.size());
+//  }
+//..
+// The owner of a type whose 'hashAppend' passes exactly the bytes of the
+// object to the algorithm in one call (which implies that the type has no
+// padding, and that equal objects have equal object representations) may
+// specialize 'bslh::IsContiguouslyHashable' for that type to enable this
+// optimization.  Note that enumerations are not contiguously hashable unless
+// so declared, since the owner of an enumeration may provide a 'hashAppend'
+// of its own that the trait cannot detect.
+//
 ///Hashing Algorithms
 ///------------------
 // There are algorithms implemented in the 'bslh' package that can be passed in
@@ -408,8 +444,10 @@ BSLS_IDENT("$Id: $")
 #include <bslscm_version.h>
 
 #include <bslh_defaulthashalgorithm.h>
+#include <bslh_issplitinvariant.h>
 
 #include <bslmf_enableif.h>
+#include <bslmf_integralconstant.h>
 #include <bslmf_isbitwisemoveable.h>
 #include <bslmf_isenum.h>
 #include <bslmf_isfloatingpoint.h>
@@ -419,6 +457,7 @@ BSLS_IDENT("$Id: $")
 #include <bslmf_istriviallycopyable.h>
 #include <bslmf_istriviallydefaultconstructible.h>
 
+#include <bsls_assert.h>
 #include <bsls_compilerfeatures.h>
 #include <bsls_platform.h>
 
@@ -472,6 +511,27 @@ struct Hash {
 
 };
 
+                     // ==================================
+                     // struct bslh::IsContiguouslyHashable
+                     // ==================================
+
+template <class TYPE>
+struct IsContiguouslyHashable
+: bsl::integral_constant<bool,
+                         (bsl::is_integral<TYPE>::value ||
+                          bsl::is_pointer<TYPE>::value) &&
+                         !bsl::is_same<TYPE, bool>::value> {
+    // This 'struct' template implements a metafunction to determine whether
+    // 'hashAppend' for the (template parameter) 'TYPE' passes exactly the
+    // 'sizeof(TYPE)' bytes of the object to the hashing algorithm in a single
+    // call, so that a contiguous range of 'TYPE' objects can be hashed by
+    // passing the whole range to the algorithm at once.  This trait derives
+    // from 'bsl::true_type' for integral (except 'bool') and pointer types,
+    // and from 'bsl::false_type' otherwise (including for enumerations, whose
+    // 'hashAppend' may be overloaded).  It may be specialized to derive from
+    // 'bsl::true_type' for other types meeting the requirement.
+};
+
 // FREE FUNCTIONS
 template <class HASH_ALGORITHM, class TYPE>
 inline
@@ -557,9 +617,11 @@ template <class HASH_ALGORITHM, class TYPE, size_t N>
 void hashAppend(HASH_ALGORITHM& hashAlg, TYPE (&input)[N]);
     // Passes the specified 'input' into the specified 'hashAlg' to be combined
     // into the internal state of the algorithm which is used to produce the
-    // resulting hash value.  Note that the elements in 'input' will be hashed
-    // one at a time by calling 'hashAppend' because the (template parameter)
-    // 'TYPE' might not be hashable as a contiguous sequence of bytes.  Also
+    // resulting hash value.  Note that the elements in 'input' are passed to
+    // 'bslh::hashAppendRange', which hashes them in a single call to
+    // 'hashAlg' if the (template parameter) 'TYPE' is contiguously hashable
+    // and 'HASH_ALGORITHM' is split invariant (see 'bslh::IsSplitInvariant'),
+    // and otherwise hashes them one at a time by calling 'hashAppend'.  Also
     // note that this 'hashAppend' exists because some platforms don't
     // recognize that adding a const qualifier is a better match for arrays
     // than decaying to a pointer and using the 'hashAppend' function for
@@ -569,9 +631,22 @@ template <class HASH_ALGORITHM, class TYPE, size_t N>
 void hashAppend(HASH_ALGORITHM& hashAlg, const TYPE (&input)[N]);
     // Passes the specified 'input' into the specified 'hashAlg' to be combined
     // into the internal state of the algorithm which is used to produce the
-    // resulting hash value.  Note that the elements in 'input' will be hashed
-    // one at a time by calling 'hashAppend' because the (template parameter)
-    // 'TYPE' might not be hashable as a contiguous sequence of bytes.
+    // resulting hash value.  Note that the elements in 'input' are passed to
+    // 'bslh::hashAppendRange', which hashes them in a single call to
+    // 'hashAlg' if the (template parameter) 'TYPE' is contiguously hashable
+    // and 'HASH_ALGORITHM' is split invariant (see 'bslh::IsSplitInvariant'),
+    // and otherwise hashes them one at a time by calling 'hashAppend'.
+
+template <class HASH_ALGORITHM, class TYPE>
+void hashAppendRange(HASH_ALGORITHM&  hashAlg,
+                     const TYPE      *first,
+                     const TYPE      *last);
+    // Pass the elements in the specified range '[first, last)' to the
+    // specified 'hashAlg', producing the same hash as calling 'hashAppend' on
+    // each element in order.  If both 'IsContiguouslyHashable<TYPE>::value'
+    // and 'IsSplitInvariant<HASH_ALGORITHM>::value' are 'true', the bytes of
+    // the whole range are passed to 'hashAlg' in a single call.  The behavior
+    // is undefined unless '[first, last)' is a valid range.
 
 }  // close package namespace
 
@@ -709,10 +784,7 @@ template <class HASH_ALGORITHM, class TYPE, size_t N>
 inline
 void bslh::hashAppend(HASH_ALGORITHM& hashAlg, TYPE (&input)[N])
 {
-
-    for (size_t i = 0; i < N; ++i) {
-        hashAppend(hashAlg, input[i]);
-    }
+    bslh::hashAppendRange(hashAlg, input + 0, input + N);
 }
 
 
@@ -720,8 +792,25 @@ template <class HASH_ALGORITHM, class TYPE, size_t N>
 inline
 void bslh::hashAppend(HASH_ALGORITHM& hashAlg, const TYPE (&input)[N])
 {
-    for (size_t i = 0; i < N; ++i) {
-        hashAppend(hashAlg, input[i]);
+    bslh::hashAppendRange(hashAlg, input + 0, input + N);
+}
+
+template <class HASH_ALGORITHM, class TYPE>
+inline
+void bslh::hashAppendRange(HASH_ALGORITHM&  hashAlg,
+                           const TYPE      *first,
+                           const TYPE      *last)
+{
+    BSLS_ASSERT_SAFE(first <= last);
+
+    if (IsContiguouslyHashable<TYPE>::value
+     && IsSplitInvariant<HASH_ALGORITHM>::value) {
+        hashAlg(first, sizeof(TYPE) * (last - first));
+    }
+    else {
+        for (; first != last; ++first) {
+            hashAppend(hashAlg, *first);
+        }
     }
 }
 
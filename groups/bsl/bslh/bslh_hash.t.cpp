@@ -3,6 +3,9 @@
 #include <bslh_defaultseededhashalgorithm.h>
 #include <bslh_siphashalgorithm.h>
 #include <bslh_spookyhashalgorithm.h>
+#include <bslh_wyhashalgorithm.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
 
 #include <bsls_alignmentfromtype.h>
 #include <bsls_assert.h>
@@ -72,9 +75,12 @@ using namespace bslh;
 // [ 3] void hashAppend(HASHALG& hashAlg, const TYPE (&input)[N]);
 // [ 3] void hashAppend(HASHALG& hashAlg, const void *input);
 // [ 3] void hashAppend(HASHALG& hashAlg, RT (*input)(ARGS...));
+// [ 8] void hashAppendRange(HASHALG&, const TYPE *, const TYPE *);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 8] USAGE EXAMPLE
+// [ 9] USAGE EXAMPLE
+// [ 8] IsContiguouslyHashable trait
+// [ 8] CONCERN: algorithms of the package are declared 'IsSplitInvariant'
 // [ 6] IsBitwiseMovable trait
 // [ 6] is_trivially_copyable trait
 // [ 6] is_trivially_default_constructible trait
@@ -620,6 +626,155 @@ class MockAccumulatingHashingAlgorithm {
     }
 };
 
+class MockCountingHashingAlgorithm {
+    // This class implements a mock hashing algorithm that accumulates the data
+    // passed into it, and counts the calls passing a non-zero length.
+
+    char   d_data[256];  // Data we were asked to hash
+    size_t d_length;     // Length of the data we were asked to hash
+    int    d_numCalls;   // Number of calls with non-zero length
+
+  public:
+    MockCountingHashingAlgorithm()
+    : d_length(0)
+    , d_numCalls(0)
+        // Create a new 'MockCountingHashingAlgorithm'
+    {
+    }
+
+    void operator()(const void *voidPtr, size_t length)
+        // Append the specified 'length' bytes at the specified 'voidPtr' to
+        // the accumulated data.  The behavior is undefined unless the total
+        // length does not exceed 256.
+    {
+        ASSERT(d_length + length <= sizeof d_data);
+        if (length) {
+            memcpy(d_data + d_length, voidPtr, length);
+            d_length += length;
+            ++d_numCalls;
+        }
+    }
+
+    const char *getData() const
+        // Return the accumulated data.
+    {
+        return d_data;
+    }
+
+    size_t getLength() const
+        // Return the length of the accumulated data.
+    {
+        return d_length;
+    }
+
+    int numCalls() const
+        // Return the number of calls passing a non-zero length.
+    {
+        return d_numCalls;
+    }
+};
+
+class MockSplitInvariantHashingAlgorithm
+                                        : public MockCountingHashingAlgorithm {
+    // This class implements a mock hashing algorithm that behaves as
+    // 'MockCountingHashingAlgorithm', and declares 'bslh::IsSplitInvariant'.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(MockSplitInvariantHashingAlgorithm,
+                                   bslh::IsSplitInvariant);
+};
+
+enum Color { e_RED, e_GREEN, e_BLUE };
+
+enum Shade { e_LIGHT, e_DARK };
+    // 'bslh::IsContiguouslyHashable' is specialized for this enumeration.
+
+struct PackedPair {
+    // This 'struct' has no padding and a 'hashAppend' passing its bytes in one
+    // call, and so may be declared contiguously hashable.
+
+    int d_first;
+    int d_second;
+};
+
+template <class HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& hashAlg, const PackedPair& pair)
+    // Pass the bytes of the specified 'pair' to the specified 'hashAlg'.
+{
+    hashAlg(&pair, sizeof pair);
+}
+
+struct UnpackedPair {
+    // This 'struct' has padding, and is hashed attribute by attribute.
+
+    char d_first;
+    int  d_second;
+};
+
+template <class HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& hashAlg, const UnpackedPair& pair)
+    // Pass the attributes of the specified 'pair' to the specified 'hashAlg'.
+{
+    using bslh::hashAppend;
+    hashAppend(hashAlg, pair.d_first);
+    hashAppend(hashAlg, pair.d_second);
+}
+
+namespace BloombergLP {
+namespace bslh {
+
+template <>
+struct IsContiguouslyHashable<PackedPair> : bsl::true_type {
+};
+
+template <>
+struct IsContiguouslyHashable<Shade> : bsl::true_type {
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+template <class TYPE>
+bool hashesAsElements(const TYPE *first, const TYPE *last, int expectedCalls)
+    // Return 'true' if 'hashAppendRange' passes to a split-invariant hashing
+    // algorithm the same bytes for the specified range '[first, last)' as
+    // does 'hashAppend' on each element, in the specified 'expectedCalls'
+    // calls, passes them to an algorithm that is not declared split-invariant
+    // in the same calls as does 'hashAppend' on each element, and produces the
+    // same hash with 'DefaultHashAlgorithm', and 'false' otherwise.
+{
+    MockSplitInvariantHashingAlgorithm rangeAlg;
+    MockCountingHashingAlgorithm       plainAlg;
+    MockCountingHashingAlgorithm       elementAlg;
+
+    hashAppendRange(rangeAlg, first, last);
+    hashAppendRange(plainAlg, first, last);
+    for (const TYPE *it = first; it != last; ++it) {
+        hashAppend(elementAlg, *it);
+    }
+
+    DefaultHashAlgorithm rangeHash;
+    DefaultHashAlgorithm elementHash;
+
+    hashAppendRange(rangeHash, first, last);
+    for (const TYPE *it = first; it != last; ++it) {
+        hashAppend(elementHash, *it);
+    }
+
+    return rangeAlg.getLength() == elementAlg.getLength()
+        && 0 == memcmp(rangeAlg.getData(),
+                       elementAlg.getData(),
+                       rangeAlg.getLength())
+        && expectedCalls == rangeAlg.numCalls()
+        && plainAlg.getLength() == elementAlg.getLength()
+        && 0 == memcmp(plainAlg.getData(),
+                       elementAlg.getData(),
+                       plainAlg.getLength())
+        && elementAlg.numCalls() == plainAlg.numCalls()
+        && rangeHash.computeHash() == elementHash.computeHash();
+}
+
 template<class TYPE>
 class TestDriver {
     // This class implements a test driver that can run tests on any type.
@@ -847,7 +1002,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 8: {
+      case 9: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   The hashing algorithm can be applied to user defined types which
@@ -902,6 +1057,166 @@ int main(int argc, char *argv[])
         ASSERT(!hashTable.contains(Box(Point(3, 3), 3, 3)));
 
       } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING 'hashAppendRange' AND 'IsContiguouslyHashable'
+        //   Verify that contiguous ranges of contiguously hashable types are
+        //   passed to the algorithm in one call, and that the result is the
+        //   same as hashing each element.
+        //
+        // Concerns:
+        //: 1 'IsContiguouslyHashable' is 'true' for integral (except 'bool')
+        //:   and pointer types, and 'false' for 'bool', floating point, enum,
+        //:   and class types, unless specialized.
+        //:
+        //: 2 'hashAppendRange' passes the same bytes to the algorithm as does
+        //:   'hashAppend' on each element, for every type.
+        //:
+        //: 3 For a contiguously hashable type and an algorithm declaring
+        //:   'IsSplitInvariant', the range is passed in a single call;
+        //:   otherwise, each element is passed as by 'hashAppend'.
+        //:
+        //: 4 Empty ranges pass no data.
+        //:
+        //: 5 'hashAppend' on an array of a contiguously hashable type passes
+        //:   the array in a single call.
+        //:
+        //: 6 Precondition violations are detected in appropriate build modes.
+        //:
+        //: 7 The algorithms of the 'bslh' package declare 'IsSplitInvariant'.
+        //
+        // Plan:
+        //: 1 Check the trait for a set of types.  (C-1)
+        //:
+        //: 2 For ranges of several types and lengths, compare the data passed
+        //:   to mock algorithms, declaring 'IsSplitInvariant' or not, by
+        //:   'hashAppendRange' and by 'hashAppend' on each element, the number
+        //:   of calls, and the hashes produced by 'DefaultHashAlgorithm'.
+        //:   (C-2..4)
+        //:
+        //: 3 Hash an array with 'hashAppend' and count the calls.  (C-5)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for an invalid range.  (C-6)
+        //:
+        //: 5 Check 'IsSplitInvariant' for the algorithms of the package.
+        //:   (C-7)
+        //
+        // Testing:
+        //   void hashAppendRange(HASHALG&, const TYPE *, const TYPE *);
+        //   IsContiguouslyHashable trait
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                 "\nTESTING 'hashAppendRange' AND 'IsContiguouslyHashable'"
+                 "\n======================================================\n");
+
+        if (verbose) printf("Check the trait. (C-1)\n");
+        {
+            ASSERT( IsContiguouslyHashable<char>::value);
+            ASSERT( IsContiguouslyHashable<unsigned char>::value);
+            ASSERT( IsContiguouslyHashable<int>::value);
+            ASSERT( IsContiguouslyHashable<unsigned long long>::value);
+            ASSERT( IsContiguouslyHashable<wchar_t>::value);
+            ASSERT( IsContiguouslyHashable<const char *>::value);
+            ASSERT( IsContiguouslyHashable<void (*)()>::value);
+            ASSERT( IsContiguouslyHashable<Shade>::value);
+            ASSERT( IsContiguouslyHashable<PackedPair>::value);
+
+            ASSERT(!IsContiguouslyHashable<bool>::value);
+            ASSERT(!IsContiguouslyHashable<float>::value);
+            ASSERT(!IsContiguouslyHashable<double>::value);
+            ASSERT(!IsContiguouslyHashable<long double>::value);
+            ASSERT(!IsContiguouslyHashable<Color>::value);
+            ASSERT(!IsContiguouslyHashable<UnpackedPair>::value);
+        }
+
+        if (verbose) printf("Compare with 'hashAppend' on each element."
+                            " (C-2..4)\n");
+        {
+            const int          INTS[]    = { 1, -2, 3, 0x7fffffff, 5 };
+            const char        *PTRS[]    = { "a", 0, "b" };
+            const Color        COLORS[]  = { e_BLUE, e_RED, e_GREEN };
+            const Shade        SHADES[]  = { e_DARK, e_LIGHT, e_DARK };
+            const PackedPair   PACKED[]  = { { 1, 2 }, { 3, 4 } };
+            const bool         BOOLS[]   = { true, false, true };
+            const double       DOUBLES[] = { 1.5, -0.0, 0.0, 2.25 };
+            UnpackedPair       UNPACKED[2];
+            memset(UNPACKED, 0x5a, sizeof UNPACKED);  // padding differs
+            UNPACKED[0].d_first = 'x';  UNPACKED[0].d_second = 7;
+            UNPACKED[1].d_first = 'y';  UNPACKED[1].d_second = 8;
+
+            for (int n = 0; n <= 5; ++n) {
+                ASSERTV(n, hashesAsElements(INTS, INTS + n, n ? 1 : 0));
+            }
+            ASSERT(hashesAsElements(PTRS,     PTRS     + 3, 1));
+            ASSERT(hashesAsElements(COLORS,   COLORS   + 3, 3));
+            ASSERT(hashesAsElements(SHADES,   SHADES   + 3, 1));
+            ASSERT(hashesAsElements(PACKED,   PACKED   + 2, 1));
+            ASSERT(hashesAsElements(BOOLS,    BOOLS    + 3, 3));
+            ASSERT(hashesAsElements(DOUBLES,  DOUBLES  + 4, 4));
+            ASSERT(hashesAsElements(UNPACKED, UNPACKED + 2, 4));
+            ASSERT(hashesAsElements(DOUBLES,  DOUBLES,      0));
+
+            // '-0.0' and '0.0' are still normalized.
+
+            MockCountingHashingAlgorithm negativeZero;
+            MockCountingHashingAlgorithm positiveZero;
+            hashAppendRange(negativeZero, DOUBLES + 1, DOUBLES + 2);
+            hashAppendRange(positiveZero, DOUBLES + 2, DOUBLES + 3);
+            ASSERT(0 == memcmp(negativeZero.getData(),
+                               positiveZero.getData(),
+                               sizeof(double)));
+        }
+
+        if (verbose) printf("Hash arrays with 'hashAppend'. (C-5)\n");
+        {
+            int          iarray[]     = { 1, 2, 3, 4 };
+            const int    ciarray[]    = { 1, 2, 3, 4 };
+            const double darray[]     = { 1, 2, 3, 4 };
+
+            MockSplitInvariantHashingAlgorithm iarrayAlg;
+            MockSplitInvariantHashingAlgorithm ciarrayAlg;
+            MockSplitInvariantHashingAlgorithm darrayAlg;
+            MockCountingHashingAlgorithm       plainAlg;
+
+            hashAppend(iarrayAlg,  iarray);
+            hashAppend(ciarrayAlg, ciarray);
+            hashAppend(darrayAlg,  darray);
+            hashAppend(plainAlg,   iarray);
+
+            ASSERT(1 == iarrayAlg.numCalls());
+            ASSERT(1 == ciarrayAlg.numCalls());
+            ASSERT(4 == darrayAlg.numCalls());
+            ASSERT(4 == plainAlg.numCalls());
+        }
+
+        if (verbose) printf("Negative testing. (C-6)\n");
+        {
+            bsls::AssertTestHandlerGuard guard;
+
+            const int INTS[] = { 1, 2, 3 };
+
+            MockCountingHashingAlgorithm alg;
+
+            ASSERT_SAFE_PASS(hashAppendRange(alg, INTS,     INTS + 3));
+            ASSERT_SAFE_PASS(hashAppendRange(alg, INTS + 3, INTS + 3));
+            ASSERT_SAFE_FAIL(hashAppendRange(alg, INTS + 1, INTS));
+        }
+
+        if (verbose) printf("Check the algorithms of the package. (C-7)\n");
+        {
+            ASSERT( IsSplitInvariant<DefaultHashAlgorithm>::value);
+            ASSERT( IsSplitInvariant<DefaultSeededHashAlgorithm>::value);
+            ASSERT( IsSplitInvariant<SipHashAlgorithm>::value);
+            ASSERT( IsSplitInvariant<SpookyHashAlgorithm>::value);
+            ASSERT( IsSplitInvariant<WyHashAlgorithm>::value);
+
+            ASSERT(!IsSplitInvariant<MockCountingHashingAlgorithm>::value);
+            ASSERT( IsSplitInvariant<
+                                  MockSplitInvariantHashingAlgorithm>::value);
+        }
+      } break;
       case 7: {
         // --------------------------------------------------------------------
         // TESTING QOI: IS AN EMPTY TYPE
@@ -0,0 +1,128 @@
+// bslh_issplitinvariant.h                                            -*-C++-*-
+#ifndef INCLUDED_BSLH_ISSPLITINVARIANT
+#define INCLUDED_BSLH_ISSPLITINVARIANT
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a trait for algorithms insensitive to how input is split.
+//
+//@CLASSES:
+//  bslh::IsSplitInvariant: trait for input-split-invariant hash algorithms
+//
+//@SEE_ALSO: bslh_hash, bslmf_detectnestedtrait
+//
+//@DESCRIPTION: This component defines a metafunction,
+// 'bslh::IsSplitInvariant', that determines whether a hashing algorithm
+// declares that the hash it produces does not depend on how its input is
+// divided among calls to its 'operator()' (e.g., passing "ab" and then "c"
+// produces the same hash as passing "abc" at once).  Although every 'bslh'
+// hashing algorithm is required to behave this way (see the 'bslh' package
+// documentation), a function that relies on it to change how it passes data
+// to an algorithm (e.g., 'bslh::hashAppendRange', which may pass a whole
+// range of objects at once rather than one object at a time) should do so
+// only for the algorithms declaring this trait, so that an algorithm that
+// does not meet the requirement still produces the hash its owner expects.
+//
+// 'bslh::IsSplitInvariant<ALGORITHM>' derives from 'bsl::true_type' if
+// 'ALGORITHM' declares the trait with 'BSLMF_NESTED_TRAIT_DECLARATION', or if
+// the trait is specialized for 'ALGORITHM', and from 'bsl::false_type'
+// otherwise.  The hashing algorithms provided by the 'bslh' package
+// specialize it.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Declaring a Split-Invariant Algorithm
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we implement a hashing algorithm that, like FNV-1a, consumes its
+// input one byte at a time, so that its result depends only on the sequence of
+// bytes passed to it.  We declare the trait in the definition of the class:
+//..
+//  class MyFnv1aAlgorithm {
+//      // This class implements the 64-bit FNV-1a hashing algorithm.
+//
+//      // DATA
+//      bsls::Types::Uint64 d_state;
+//
+//    public:
+//      // TRAITS
+//      BSLMF_NESTED_TRAIT_DECLARATION(MyFnv1aAlgorithm,
+//                                     bslh::IsSplitInvariant);
+//
+//      // TYPES
+//      typedef bsls::Types::Uint64 result_type;
+//
+//      // CREATORS
+//      MyFnv1aAlgorithm()
+//      : d_state(14695981039346656037ULL)
+//      {
+//      }
+//
+//      // MANIPULATORS
+//      void operator()(const void *data, size_t numBytes)
+//      {
+//          const unsigned char *bytes =
+//                                static_cast<const unsigned char *>(data);
+//          for (size_t i = 0; i < numBytes; ++i) {
+//              d_state = (d_state ^ bytes[i]) * 1099511628211ULL;
+//          }
+//      }
+//
+//      result_type computeHash()
+//      {
+//          return d_state;
+//      }
+//  };
+//..
+// Then, we verify that the trait is detected for our algorithm, and not for a
+// type that does not declare it:
+//..
+//  assert(true  == bslh::IsSplitInvariant<MyFnv1aAlgorithm>::value);
+//  assert(false == bslh::IsSplitInvariant<int>::value);
+//..
+
+#include <bslscm_version.h>
+
+#include <bslmf_detectnestedtrait.h>
+
+namespace BloombergLP {
+namespace bslh {
+
+                          // =======================
+                          // struct IsSplitInvariant
+                          // =======================
+
+template <class HASH_ALGORITHM>
+struct IsSplitInvariant
+: bslmf::DetectNestedTrait<HASH_ALGORITHM, IsSplitInvariant>::type {
+    // This 'struct' template implements a metafunction to determine whether
+    // the (template parameter) 'HASH_ALGORITHM' produces the same hash
+    // regardless of how its input is divided among calls to its
+    // 'operator()'.  This trait derives from 'bsl::true_type' if
+    // 'HASH_ALGORITHM' declares it as a nested trait, and from
+    // 'bsl::false_type' otherwise.  It may be specialized to derive from
+    // 'bsl::true_type' for other algorithms meeting the requirement.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,281 @@
+// bslh_issplitinvariant.t.cpp                                        -*-C++-*-
+#include <bslh_issplitinvariant.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_types.h>
+
+#include <stddef.h>     // 'size_t'
+#include <stdio.h>      // 'printf'
+#include <stdlib.h>     // 'atoi'
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a metafunction deriving from 'bsl::true_type'
+// for the hashing algorithms that declare it as a nested trait or specialize
+// it, and from 'bsl::false_type' for every other type.  We verify its value
+// for each of these categories of types.
+//-----------------------------------------------------------------------------
+// [ 1] struct bslh::IsSplitInvariant;
+//-----------------------------------------------------------------------------
+// [ 2] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+struct NestedTraitAlgorithm {
+    // This algorithm declares 'bslh::IsSplitInvariant' as a nested trait.
+
+    BSLMF_NESTED_TRAIT_DECLARATION(NestedTraitAlgorithm,
+                                   bslh::IsSplitInvariant);
+};
+
+struct SpecializedAlgorithm {
+    // 'bslh::IsSplitInvariant' is specialized for this algorithm.
+};
+
+struct PlainAlgorithm {
+    // This algorithm does not declare 'bslh::IsSplitInvariant'.
+};
+
+namespace BloombergLP {
+namespace bslh {
+
+template <>
+struct IsSplitInvariant<SpecializedAlgorithm> : bsl::true_type {
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+//=============================================================================
+//                             USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Declaring a Split-Invariant Algorithm
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we implement a hashing algorithm that, like FNV-1a, consumes its
+// input one byte at a time, so that its result depends only on the sequence of
+// bytes passed to it.  We declare the trait in the definition of the class:
+//..
+    class MyFnv1aAlgorithm {
+        // This class implements the 64-bit FNV-1a hashing algorithm.
+
+        // DATA
+        bsls::Types::Uint64 d_state;
+
+      public:
+        // TRAITS
+        BSLMF_NESTED_TRAIT_DECLARATION(MyFnv1aAlgorithm,
+                                       bslh::IsSplitInvariant);
+
+        // TYPES
+        typedef bsls::Types::Uint64 result_type;
+
+        // CREATORS
+        MyFnv1aAlgorithm()
+        : d_state(14695981039346656037ULL)
+        {
+        }
+
+        // MANIPULATORS
+        void operator()(const void *data, size_t numBytes)
+        {
+            const unsigned char *bytes =
+                                  static_cast<const unsigned char *>(data);
+            for (size_t i = 0; i < numBytes; ++i) {
+                d_state = (d_state ^ bytes[i]) * 1099511628211ULL;
+            }
+        }
+
+        result_type computeHash()
+        {
+            return d_state;
+        }
+    };
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;          // suppress warning
+    (void)veryVeryVerbose;      // suppress warning
+    (void)veryVeryVeryVerbose;  // suppress warning
+
+    setbuf(stdout, NULL);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 2: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we verify that the trait is detected for our algorithm, and not for a
+// type that does not declare it:
+//..
+    ASSERT(true  == bslh::IsSplitInvariant<MyFnv1aAlgorithm>::value);
+    ASSERT(false == bslh::IsSplitInvariant<int>::value);
+//..
+
+        MyFnv1aAlgorithm alg;
+        alg("abc", 3);
+        ASSERT(0xe71fa2190541574bULL == alg.computeHash());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // 'bslh::IsSplitInvariant'
+        //
+        // Concerns:
+        //: 1 The trait is 'true' for a type declaring it as a nested trait.
+        //:
+        //: 2 The trait is 'true' for a type for which it is specialized.
+        //:
+        //: 3 The trait is 'false' for any other type, including fundamental
+        //:   and pointer types.
+        //:
+        //: 4 The trait derives from 'bsl::true_type' or 'bsl::false_type'.
+        //
+        // Plan:
+        //: 1 Verify the value of the trait for a class declaring it as a
+        //:   nested trait, a class for which it is specialized, a class that
+        //:   does not declare it, and a few fundamental and pointer types.
+        //:   (C-1..3)
+        //:
+        //: 2 Verify that the address of each trait object converts to a
+        //:   pointer to the expected base.  (C-4)
+        //
+        // Testing:
+        //   struct bslh::IsSplitInvariant;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'bslh::IsSplitInvariant'"
+                            "\n========================\n");
+
+        ASSERT(true  == bslh::IsSplitInvariant<NestedTraitAlgorithm>::value);
+        ASSERT(true  == bslh::IsSplitInvariant<SpecializedAlgorithm>::value);
+        ASSERT(false == bslh::IsSplitInvariant<PlainAlgorithm>::value);
+        ASSERT(false == bslh::IsSplitInvariant<int>::value);
+        ASSERT(false == bslh::IsSplitInvariant<char *>::value);
+        ASSERT(false == bslh::IsSplitInvariant<PlainAlgorithm *>::value);
+
+        typedef bslh::IsSplitInvariant<NestedTraitAlgorithm> NestedTrait;
+        typedef bslh::IsSplitInvariant<PlainAlgorithm>       PlainTrait;
+
+        const NestedTrait nested = NestedTrait();
+        const PlainTrait  plain  = PlainTrait();
+
+        const bsl::true_type  *nestedBase = &nested;
+        const bsl::false_type *plainBase  = &plain;
+
+        ASSERT(0 != nestedBase);
+        ASSERT(0 != plainBase);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
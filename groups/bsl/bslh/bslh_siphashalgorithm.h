@@ -369,6 +369,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bslscm_version.h>
 
+#include <bslh_issplitinvariant.h>
+
 #include <bslmf_isbitwisemoveable.h>
 
 #include <bsls_types.h>
@@ -472,6 +474,12 @@ class SipHashAlgorithm {
 //                                TYPE TRAITS
 // ============================================================================
 
+namespace bslh {
+template <>
+struct IsSplitInvariant<bslh::SipHashAlgorithm>
+    : bsl::true_type {};
+}  // close namespace bslh
+
 namespace bslmf {
 template <>
 struct IsBitwiseMoveable<bslh::SipHashAlgorithm>
@@ -280,6 +280,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bslscm_version.h>
 
+#include <bslh_issplitinvariant.h>
 #include <bslh_spookyhashalgorithmimp.h>
 
 #include <bslmf_isbitwisemoveable.h>
@@ -430,6 +431,12 @@ SpookyHashAlgorithm::result_type SpookyHashAlgorithm::computeHash()
 //                                TYPE TRAITS
 // ============================================================================
 
+namespace bslh {
+template <>
+struct IsSplitInvariant<bslh::SpookyHashAlgorithm>
+    : bsl::true_type {};
+}  // close namespace bslh
+
 namespace bslmf {
 template <>
 struct IsBitwiseMoveable<bslh::SpookyHashAlgorithm>
@@ -0,0 +1,259 @@
+// bslh_wyhashalgorithm.cpp                                           -*-C++-*-
+#include <bslh_wyhashalgorithm.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_assert.h>
+#include <bsls_byteorder.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <stddef.h>  // for 'size_t'
+#include <string.h>
+
+#if defined(BSLS_PLATFORM_CMP_MSVC) && defined(BSLS_PLATFORM_CPU_X86_64)
+#include <intrin.h>
+#endif
+
+///Implementation Notes
+///--------------------
+// The functions below follow 'wyhash.h' (version "final 3") of the reference
+// implementation at https://github.com/wangyi-fudan/wyhash, which has been
+// released into the public domain by its author.  The one-shot function of the
+// reference implementation has been split into 'operator()', which mixes every
+// 48-byte block that is followed by more input into the three lanes of the
+// state, and 'computeHash', which mixes the remaining 1 to 48 bytes.  When the
+// remaining input is shorter than 16 bytes, the reference implementation reads
+// (again) the end of the last block; 'operator()' therefore retains the last
+// 16 bytes of the most recent block immediately before the unprocessed input.
+// The default secret of the reference implementation is used, and the
+// 'WYHASH_CONDOM' option is 1 (the default of the reference implementation).
+
+namespace BloombergLP {
+
+namespace bslh {
+
+typedef bsls::Types::Uint64 u64;
+typedef unsigned int        u32;
+typedef unsigned char       u8;
+
+static const u64 k_SECRET[4] = { 0xa0761d6478bd642fULL,
+                                 0xe7037ed1a0b428dbULL,
+                                 0x8ebc6af09c88c6e3ULL,
+                                 0x589965cc75374cc3ULL };
+    // The default secret of the reference implementation.
+
+inline
+static u64 mix(u64 a, u64 b)
+    // Return the exclusive-or of the low and high 64-bit halves of the 128-bit
+    // product of the specified 'a' and 'b'.
+{
+#if defined(BSLS_PLATFORM_CPU_64_BIT)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+    __extension__ typedef unsigned __int128 u128;
+
+    const u128 r = static_cast<u128>(a) * b;
+    return static_cast<u64>(r) ^ static_cast<u64>(r >> 64);
+#elif defined(BSLS_PLATFORM_CMP_MSVC) && defined(BSLS_PLATFORM_CPU_X86_64)
+    u64 hi;
+    const u64 lo = _umul128(a, b, &hi);
+    return lo ^ hi;
+#else
+    const u64 ha = a >> 32;
+    const u64 hb = b >> 32;
+    const u64 la = static_cast<u32>(a);
+    const u64 lb = static_cast<u32>(b);
+
+    const u64 rh  = ha * hb;
+    const u64 rm0 = ha * lb;
+    const u64 rm1 = hb * la;
+    const u64 rl  = la * lb;
+    const u64 t   = rl + (rm0 << 32);
+    u64       c   = t < rl;
+    const u64 lo  = t + (rm1 << 32);
+    c += lo < t;
+    const u64 hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+    return lo ^ hi;
+#endif
+}
+
+inline
+static u64 read8(const u8 *p)
+    // Return the 64-bit integer whose little-endian representation is the 8
+    // bytes at the specified 'p'.
+{
+    u64 v;
+    memcpy(&v, p, sizeof v);
+    return BSLS_BYTEORDER_LE_U64_TO_HOST(v);
+}
+
+inline
+static u64 read4(const u8 *p)
+    // Return the 32-bit integer whose little-endian representation is the 4
+    // bytes at the specified 'p'.
+{
+    u32 v;
+    memcpy(&v, p, sizeof v);
+    return BSLS_BYTEORDER_LE_U32_TO_HOST(v);
+}
+
+inline
+static u64 read3(const u8 *p, size_t k)
+    // Return an integer combining the first, middle, and last of the
+    // specified 'k' bytes at the specified 'p'.  The behavior is undefined
+    // unless '1 <= k <= 3'.
+{
+    return static_cast<u64>(p[0]) << 16
+         | static_cast<u64>(p[k >> 1]) << 8
+         | p[k - 1];
+}
+
+                          // ---------------------
+                          // class WyHashAlgorithm
+                          // ---------------------
+
+// PRIVATE MANIPULATORS
+void WyHashAlgorithm::initialize(Uint64 seed)
+{
+    d_seed         = seed ^ k_SECRET[0];
+    d_see1         = d_seed;
+    d_see2         = d_seed;
+    d_bufferLength = 0;
+    d_totalLength  = 0;
+}
+
+inline
+void WyHashAlgorithm::processBlock(const unsigned char *block)
+{
+    d_seed = mix(read8(block)      ^ k_SECRET[1], read8(block +  8) ^ d_seed);
+    d_see1 = mix(read8(block + 16) ^ k_SECRET[2], read8(block + 24) ^ d_see1);
+    d_see2 = mix(read8(block + 32) ^ k_SECRET[3], read8(block + 40) ^ d_see2);
+}
+
+// CREATORS
+WyHashAlgorithm::WyHashAlgorithm()
+{
+    initialize(0);
+}
+
+WyHashAlgorithm::WyHashAlgorithm(const char *seed)
+{
+    BSLS_ASSERT(seed);
+
+    initialize(read8(reinterpret_cast<const u8 *>(seed)));
+}
+
+// MANIPULATORS
+void WyHashAlgorithm::operator()(const void *data, size_t numBytes)
+{
+    BSLS_ASSERT(0 != data || 0 == numBytes);
+
+    if (0 == numBytes) {
+        return;                                                       // RETURN
+    }
+
+    const u8 *in   = static_cast<const u8 *>(data);
+    u8       *tail = d_buffer + k_RETAIN_LENGTH;
+
+    d_totalLength += numBytes;
+
+    if (d_bufferLength + numBytes <= k_BLOCK_LENGTH) {
+        // Not known to be followed by more input: buffer it.
+
+        memcpy(tail + d_bufferLength, in, numBytes);
+        d_bufferLength += numBytes;
+        return;                                                       // RETURN
+    }
+
+    const u8 *lastBlockEnd;
+
+    if (d_bufferLength) {
+        const size_t fill = k_BLOCK_LENGTH - d_bufferLength;
+
+        memcpy(tail + d_bufferLength, in, fill);
+        in       += fill;
+        numBytes -= fill;
+
+        processBlock(tail);
+        lastBlockEnd = tail + k_BLOCK_LENGTH;
+    }
+    else {
+        lastBlockEnd = in;
+    }
+
+    // There is at least one more byte of input, so every complete block but
+    // the last can be mixed directly from the caller's memory.
+
+    while (numBytes > k_BLOCK_LENGTH) {
+        processBlock(in);
+        in           += k_BLOCK_LENGTH;
+        numBytes     -= k_BLOCK_LENGTH;
+        lastBlockEnd  = in;
+    }
+
+    memcpy(d_buffer, lastBlockEnd - k_RETAIN_LENGTH, k_RETAIN_LENGTH);
+    memcpy(tail, in, numBytes);
+    d_bufferLength = numBytes;
+}
+
+WyHashAlgorithm::result_type WyHashAlgorithm::computeHash()
+{
+    const u8     *p   = d_buffer + k_RETAIN_LENGTH;
+    const size_t  len = d_totalLength;
+    size_t        i   = d_bufferLength;
+    u64           a;
+    u64           b;
+
+    // The lanes are all equal unless a block has been processed, in which
+    // case this combines them as does the reference implementation.
+
+    u64 seed = d_seed ^ d_see1 ^ d_see2;
+
+    if (len <= 16) {
+        if (len >= 4) {
+            const size_t offset = (len >> 3) << 2;
+
+            a = read4(p) << 32 | read4(p + offset);
+            b = read4(p + len - 4) << 32 | read4(p + len - 4 - offset);
+        }
+        else if (len > 0) {
+            a = read3(p, len);
+            b = 0;
+        }
+        else {
+            a = b = 0;
+        }
+    }
+    else {
+        while (i > 16) {
+            seed = mix(read8(p) ^ k_SECRET[1], read8(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+        a = read8(p + i - 16);
+        b = read8(p + i - 8);
+    }
+
+    return mix(k_SECRET[1] ^ len, mix(a ^ k_SECRET[1], b ^ seed));
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,280 @@
+// bslh_wyhashalgorithm.h                                             -*-C++-*-
+#ifndef INCLUDED_BSLH_WYHASHALGORITHM
+#define INCLUDED_BSLH_WYHASHALGORITHM
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an implementation of the wyhash algorithm.
+//
+//@CLASSES:
+//  bslh::WyHashAlgorithm: functor implementing the wyhash algorithm
+//
+//@SEE_ALSO: bslh_hash, bslh_spookyhashalgorithm
+//
+//@DESCRIPTION: 'bslh::WyHashAlgorithm' implements the wyhash algorithm by
+// Wang Yi (version "final 3").  This algorithm mixes its input with 64x64 to
+// 128-bit multiplications, and processes long input in blocks of 48 bytes
+// through three independent multiplication chains, which a superscalar
+// processor executes in parallel.  It is faster than
+// 'bslh::SpookyHashAlgorithm' for keys of every length, and markedly so for
+// the short keys (up to 16 bytes) that are typical of hash tables, which are
+// hashed in a single multiplication.  For more information, see:
+// https://github.com/wangyi-fudan/wyhash
+//
+// This class satisfies the requirements for regular 'bslh' hashing algorithms
+// and seeded 'bslh' hashing algorithms, defined in 'bslh_hash.h' and
+// 'bslh_seededhash.h' respectively.  More information can be found in the
+// package level documentation for 'bslh' (internal users can also find
+// information here {TEAM BDE:USING MODULAR HASHING<GO>})
+//
+///Incremental Hashing
+///-------------------
+// The canonical wyhash is a function of a complete, contiguous key.  As
+// required of a 'bslh' hashing algorithm, 'bslh::WyHashAlgorithm' produces the
+// same hash regardless of how the key is divided among calls to 'operator()',
+// and that hash is the value that the canonical implementation produces for
+// the concatenated key.  To do so, it buffers at most 64 bytes: blocks of 48
+// bytes are mixed into its state only once more input is known to follow them,
+// and the last 16 bytes of the most recent block are retained because the
+// finalization of wyhash may read them again.  Input passed in a single call
+// is mixed directly from the caller's memory.
+//
+// Ranges of elements whose object representation is their hashed value (such
+// as a 'bsl::vector<int>') are passed to the algorithm in a single call (see
+// 'bslh::hashAppendRange' in 'bslh_hash'), and so benefit fully from the block
+// processing of this algorithm.
+//
+///Security
+///--------
+// In this context "security" refers to the ability of the algorithm to produce
+// hashes that are not predictable by an attacker.  Security is a concern when
+// an attacker may be able to provide malicious input into a hash table,
+// thereby causing hashes to collide to buckets, which degrades performance.
+// There are *no* security guarantees made by 'bslh::WyHashAlgorithm', meaning
+// attackers may be able to engineer keys that will cause a Denial of Service
+// (DoS) attack in hash tables using this algorithm.  If security is required,
+// an algorithm that documents better secure properties should be used, such
+// as 'bslh::SipHashAlgorithm'.
+//
+///Speed
+///-----
+// This algorithm will compute a hash on the order of O(n) where 'n' is the
+// length of the input data.  Keys of up to 16 bytes are hashed with two
+// multiplications in total.  On platforms lacking a native 64x64 to 128-bit
+// multiplication (notably 32-bit platforms) the product is computed from four
+// 32-bit multiplications, and the algorithm is correspondingly slower.
+//
+///Hash Distribution
+///-----------------
+// Output hashes will be well distributed and will avalanche, which means
+// changing one bit of the input will change approximately 50% of the output
+// bits.  This will prevent similar values from funneling to the same hash or
+// bucket.
+//
+///Hash Consistency
+///----------------
+// The input is read as little-endian 64-bit words on every platform, so this
+// algorithm produces the same hash for the same sequence of bytes (and seed)
+// regardless of the byte order of the machine, and produces the same hashes
+// as the canonical implementation.  Note that hashes of objects other than
+// byte strings (e.g., integers) still depend on the object representation of
+// those objects, and so on the machine.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example: Hashing Variable-Length Keys
+///- - - - - - - - - - - - - - - - - - -
+// Suppose we maintain a cache of market data keyed by instrument symbols,
+// which are mostly short, and occasionally keyed by long composite
+// identifiers.  We want a fast, general purpose hash for these keys, and we
+// have no concern about malicious input.
+//
+// First, we hash a symbol in a single call:
+//..
+//  const char *symbol = "IBM US Equity";
+//
+//  bslh::WyHashAlgorithm oneShot;
+//  oneShot(symbol, strlen(symbol));
+//  const bsls::Types::Uint64 symbolHash = oneShot.computeHash();
+//..
+// Then, we hash the same symbol in two pieces (as 'hashAppend' might do for a
+// type holding a ticker and a market sector separately), and observe that the
+// hash is the same:
+//..
+//  bslh::WyHashAlgorithm pieces;
+//  pieces("IBM US", 6);
+//  pieces(" Equity", 7);
+//  assert(symbolHash == pieces.computeHash());
+//..
+// Next, we observe that the hash of a different symbol differs:
+//..
+//  bslh::WyHashAlgorithm other;
+//  other("IBM LN Equity", 13);
+//  assert(symbolHash != other.computeHash());
+//..
+// Finally, we use the algorithm as the hash functor of an unordered container
+// by way of 'bslh::Hash', which applies it to any type that implements
+// 'hashAppend':
+//..
+//  typedef bslh::Hash<bslh::WyHashAlgorithm> Hasher;
+//
+//  Hasher hasher;
+//  assert(hasher(12345) == hasher(12345));
+//  assert(hasher(12345) != hasher(54321));
+//..
+
+#include <bslscm_version.h>
+
+#include <bslh_issplitinvariant.h>
+
+#include <bslmf_isbitwisemoveable.h>
+
+#include <bsls_types.h>
+
+#include <stddef.h>  // for 'size_t'
+
+namespace BloombergLP {
+
+namespace bslh {
+
+                          // ===========================
+                          // class bslh::WyHashAlgorithm
+                          // ===========================
+
+class WyHashAlgorithm {
+    // This class implements the "wyhash" hash algorithm in an interface that
+    // is usable in the modular hashing system in 'bslh'.
+
+  private:
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+        // Typedef for a 64-bit integer type used in the hashing algorithm.
+
+    enum {
+        k_BLOCK_LENGTH  = 48,  // bytes mixed into the state at a time
+        k_RETAIN_LENGTH = 16   // bytes of the previous block that are kept
+    };
+
+    // DATA
+    Uint64 d_seed;
+    Uint64 d_see1;
+    Uint64 d_see2;
+        // Stores the intermediate state of the three independent lanes of the
+        // algorithm as blocks are accumulated.
+
+    union {
+        Uint64        d_alignment;
+            // Provides alignment
+
+        unsigned char d_buffer[k_RETAIN_LENGTH + k_BLOCK_LENGTH];
+            // Holds the last 'k_RETAIN_LENGTH' bytes of the most recently
+            // processed block, followed by the input that has not yet been
+            // processed.
+    };
+
+    size_t d_bufferLength;
+        // The number of bytes of unprocessed input in 'd_buffer'.
+
+    size_t d_totalLength;
+        // The total length of all data that has been passed into the
+        // algorithm.
+
+    // NOT IMPLEMENTED
+    WyHashAlgorithm(const WyHashAlgorithm& original); // = delete;
+        // Do not allow copy construction.
+
+    WyHashAlgorithm& operator=(const WyHashAlgorithm& rhs); // = delete;
+        // Do not allow assignment.
+
+    // PRIVATE MANIPULATORS
+    void initialize(Uint64 seed);
+        // Set the state of this object to that of an algorithm having the
+        // specified 'seed' to which no data has been passed.
+
+    void processBlock(const unsigned char *block);
+        // Mix the 'k_BLOCK_LENGTH' bytes at the specified 'block' into the
+        // state of this algorithm.
+
+  public:
+    // TYPES
+    typedef Uint64 result_type;
+        // Typedef indicating the value type returned by this algorithm.
+
+    // CONSTANTS
+    enum { k_SEED_LENGTH = 8 }; // Seed length in bytes.
+
+    // CREATORS
+    WyHashAlgorithm();
+        // Create a 'bslh::WyHashAlgorithm' using a default initial seed of 0.
+
+    explicit WyHashAlgorithm(const char *seed);
+        // Create a 'bslh::WyHashAlgorithm', seeded with a 64-bit
+        // ('k_SEED_LENGTH' bytes) seed pointed to by the specified 'seed',
+        // read as a little-endian integer.  Each bit of the supplied seed will
+        // contribute to the final hash produced by 'computeHash()'.  The
+        // behavior is undefined unless 'seed' points to at least 8 bytes of
+        // initialized memory.
+
+    //! ~WyHashAlgorithm() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void operator()(const void *data, size_t numBytes);
+        // Incorporate the specified 'data', of at least the specified
+        // 'numBytes', into the internal state of the hashing algorithm.  Every
+        // bit of data incorporated into the internal state of the algorithm
+        // will contribute to the final hash produced by 'computeHash()'.  The
+        // same hash value will be produced regardless of whether a sequence of
+        // bytes is passed in all at once or through multiple calls to this
+        // member function.  Input where 'numBytes' is 0 will have no effect on
+        // the internal state of the algorithm.  The behavior is undefined
+        // unless 'data' points to a valid memory location with at least
+        // 'numBytes' bytes of initialized memory or 'numBytes' is zero.
+
+    result_type computeHash();
+        // Return the finalized version of the hash that has been accumulated.
+        // Note that a value will be returned, even if data has not been passed
+        // into 'operator()'.  Also note that, unlike some other 'bslh'
+        // algorithms, this method does not change the state of this object.
+};
+
+}  // close package namespace
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+namespace bslh {
+template <>
+struct IsSplitInvariant<bslh::WyHashAlgorithm>
+    : bsl::true_type {};
+}  // close namespace bslh
+
+namespace bslmf {
+template <>
+struct IsBitwiseMoveable<bslh::WyHashAlgorithm>
+    : bsl::true_type {};
+}  // close namespace bslmf
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,861 @@
+// bslh_wyhashalgorithm.t.cpp                                         -*-C++-*-
+#include <bslh_wyhashalgorithm.h>
+
+#include <bslh_defaulthashalgorithm.h>
+#include <bslh_hash.h>
+#include <bslh_siphashalgorithm.h>
+#include <bslh_spookyhashalgorithm.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_issame.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+using namespace bslh;
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a 'bslh' hashing algorithm.  The basic test plan
+// is to compare the output of the function call operator with the expected
+// output of the reference implementation of the algorithm, both for published
+// test vectors and, using a transcription of the reference one-shot function
+// as an oracle, for input of every length up to several blocks divided among
+// calls to 'operator()' in many ways.  The component will also be tested for
+// conformance to the requirements on 'bslh' hashing algorithms, outlined in
+// the 'bslh' package level documentation.
+//-----------------------------------------------------------------------------
+// TYPEDEF
+// [ 4] typedef bsls::Types::Uint64 result_type;
+//
+// CONSTANTS
+// [ 5] enum { k_SEED_LENGTH = 8 };
+//
+// CREATORS
+// [ 2] WyHashAlgorithm();
+// [ 2] explicit WyHashAlgorithm(const char *seed);
+// [ 2] ~WyHashAlgorithm();
+//
+// MANIPULATORS
+// [ 3] void operator()(void const* key, size_t len);
+// [ 3] result_type computeHash();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] Trait IsBitwiseMoveable
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: KEYS FROM 8 BYTES TO 4 KB
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  PRINTF FORMAT MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ZU BSLS_BSLTESTUTIL_FORMAT_ZU
+
+//=============================================================================
+//                   GLOBAL TYPEDEFS AND DATA FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef WyHashAlgorithm     Obj;
+typedef bsls::Types::Uint64 Uint64;
+
+const char genericSeed[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+//=============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace reference {
+    // This namespace provides a transcription of the one-shot function of the
+    // reference implementation of wyhash (version "final 3"), used as an
+    // oracle.  It is deliberately independent of the component: it reads the
+    // input with byte arithmetic and multiplies in 32-bit halves.
+
+static const Uint64 k_SECRET[4] = { 0xa0761d6478bd642fULL,
+                                    0xe7037ed1a0b428dbULL,
+                                    0x8ebc6af09c88c6e3ULL,
+                                    0x589965cc75374cc3ULL };
+
+Uint64 mix(Uint64 a, Uint64 b)
+    // Return the exclusive-or of the halves of the 128-bit product of the
+    // specified 'a' and 'b'.
+{
+    const Uint64 ha = a >> 32, hb = b >> 32;
+    const Uint64 la = a & 0xffffffff, lb = b & 0xffffffff;
+    const Uint64 rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    const Uint64 t  = rl + (rm0 << 32);
+    Uint64       c  = t < rl;
+    const Uint64 lo = t + (rm1 << 32);
+    c += lo < t;
+    return lo ^ (rh + (rm0 >> 32) + (rm1 >> 32) + c);
+}
+
+Uint64 read(const unsigned char *p, int n)
+    // Return the integer whose little-endian representation is the specified
+    // 'n' bytes at the specified 'p'.
+{
+    Uint64 result = 0;
+    for (int i = n - 1; i >= 0; --i) {
+        result = result << 8 | p[i];
+    }
+    return result;
+}
+
+Uint64 wyhash(const void *key, size_t len, Uint64 seed)
+    // Return the wyhash of the specified 'len' bytes at the specified 'key'
+    // with the specified 'seed'.
+{
+    const unsigned char *p = static_cast<const unsigned char *>(key);
+    Uint64               a, b;
+
+    seed ^= k_SECRET[0];
+    if (len <= 16) {
+        if (len >= 4) {
+            const size_t o = (len >> 3) << 2;
+            a = read(p, 4) << 32 | read(p + o, 4);
+            b = read(p + len - 4, 4) << 32 | read(p + len - 4 - o, 4);
+        }
+        else if (len > 0) {
+            a = Uint64(p[0]) << 16 | Uint64(p[len >> 1]) << 8 | p[len - 1];
+            b = 0;
+        }
+        else {
+            a = b = 0;
+        }
+    }
+    else {
+        size_t i = len;
+        if (i > 48) {
+            Uint64 see1 = seed, see2 = seed;
+            do {
+                seed = mix(read(p,      8) ^ k_SECRET[1],
+                           read(p +  8, 8) ^ seed);
+                see1 = mix(read(p + 16, 8) ^ k_SECRET[2],
+                           read(p + 24, 8) ^ see1);
+                see2 = mix(read(p + 32, 8) ^ k_SECRET[3],
+                           read(p + 40, 8) ^ see2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+            seed ^= see1 ^ see2;
+        }
+        while (i > 16) {
+            seed = mix(read(p, 8) ^ k_SECRET[1], read(p + 8, 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+        a = read(p + i - 16, 8);
+        b = read(p + i - 8, 8);
+    }
+    return mix(k_SECRET[1] ^ len, mix(a ^ k_SECRET[1], b ^ seed));
+}
+
+}  // close namespace reference
+
+template <class HASH_ALGORITHM>
+double timeKeys(const char *data, size_t keyLength, int numKeys)
+    // Return the average time, in nanoseconds, taken by 'HASH_ALGORITHM' to
+    // hash each of the specified 'numKeys' keys having the specified
+    // 'keyLength' and starting at successive bytes of the specified 'data'.
+{
+    bsls::Stopwatch timer;
+    Uint64          sink = 0;
+
+    timer.start();
+    for (int i = 0; i < numKeys; ++i) {
+        HASH_ALGORITHM alg;
+        alg(data + (i & 63), keyLength);
+        sink += alg.computeHash();
+    }
+    timer.stop();
+
+    if (sink == 42) {
+        printf(" ");  // Prevent the loop from being optimized away.
+    }
+    return timer.elapsedTime() * 1e9 / numKeys;
+}
+
+template <class HASH_ALGORITHM>
+double timeElementwise(const int *data, size_t numElements, int numKeys)
+    // Return the average time, in nanoseconds, taken by 'HASH_ALGORITHM' to
+    // hash the specified 'numElements' 'int' values at the specified 'data'
+    // by calling 'hashAppend' for each element, the specified 'numKeys'
+    // times.
+{
+    bsls::Stopwatch timer;
+    Uint64          sink = 0;
+
+    timer.start();
+    for (int i = 0; i < numKeys; ++i) {
+        HASH_ALGORITHM alg;
+        for (size_t j = 0; j < numElements; ++j) {
+            hashAppend(alg, data[j]);
+        }
+        sink += alg.computeHash();
+    }
+    timer.stop();
+
+    if (sink == 42) {
+        printf(" ");  // Prevent the loop from being optimized away.
+    }
+    return timer.elapsedTime() * 1e9 / numKeys;
+}
+
+template <class HASH_ALGORITHM>
+double timeRange(const int *data, size_t numElements, int numKeys)
+    // Return the average time, in nanoseconds, taken by 'HASH_ALGORITHM' to
+    // hash the specified 'numElements' 'int' values at the specified 'data'
+    // using 'hashAppendRange', the specified 'numKeys' times.
+{
+    bsls::Stopwatch timer;
+    Uint64          sink = 0;
+
+    timer.start();
+    for (int i = 0; i < numKeys; ++i) {
+        HASH_ALGORITHM alg;
+        hashAppendRange(alg, data, data + numElements);
+        sink += alg.computeHash();
+    }
+    timer.stop();
+
+    if (sink == 42) {
+        printf(" ");  // Prevent the loop from being optimized away.
+    }
+    return timer.elapsedTime() * 1e9 / numKeys;
+}
+
+struct SipHashWithDefaultSeed : SipHashAlgorithm {
+    // This 'struct' provides a default-constructible 'SipHashAlgorithm' for
+    // benchmarking.
+
+    SipHashWithDefaultSeed()
+    : SipHashAlgorithm("0123456789abcdef")
+    {
+    }
+};
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;      // suppress warning
+    (void)veryVeryVeryVerbose;  // suppress warning
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("USAGE EXAMPLE\n"
+                            "=============\n");
+
+// First, we hash a symbol in a single call:
+//..
+    const char *symbol = "IBM US Equity";
+
+    bslh::WyHashAlgorithm oneShot;
+    oneShot(symbol, strlen(symbol));
+    const bsls::Types::Uint64 symbolHash = oneShot.computeHash();
+//..
+// Then, we hash the same symbol in two pieces (as 'hashAppend' might do for a
+// type holding a ticker and a market sector separately), and observe that the
+// hash is the same:
+//..
+    bslh::WyHashAlgorithm pieces;
+    pieces("IBM US", 6);
+    pieces(" Equity", 7);
+    ASSERT(symbolHash == pieces.computeHash());
+//..
+// Next, we observe that the hash of a different symbol differs:
+//..
+    bslh::WyHashAlgorithm other;
+    other("IBM LN Equity", 13);
+    ASSERT(symbolHash != other.computeHash());
+//..
+// Finally, we use the algorithm as the hash functor of an unordered container
+// by way of 'bslh::Hash', which applies it to any type that implements
+// 'hashAppend':
+//..
+    typedef bslh::Hash<bslh::WyHashAlgorithm> Hasher;
+
+    Hasher hasher;
+    ASSERT(hasher(12345) == hasher(12345));
+    ASSERT(hasher(12345) != hasher(54321));
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING BDE TYPE TRAITS
+        //   The class is bitwise movable and should have a trait that
+        //   indicates that.
+        //
+        // Concerns:
+        //: 1 The class is marked as 'IsBitwiseMoveable'.
+        //
+        // Plan:
+        //: 1 ASSERT the presence of the trait using the 'bslalg::HasTrait'
+        //:   metafunction. (C-1)
+        //
+        // Testing:
+        //   Trait IsBitwiseMoveable
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING BDE TYPE TRAITS"
+                            "\n=======================\n");
+
+        ASSERT(bslmf::IsBitwiseMoveable<WyHashAlgorithm>::value);
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'k_SEED_LENGTH'
+        //   The class is a seeded algorithm and should expose a
+        //   'k_SEED_LENGTH' enum.
+        //
+        // Concerns:
+        //: 1 'k_SEED_LENGTH' is publicly accessible.
+        //:
+        //: 2 'k_SEED_LENGTH' is set to 8.
+        //
+        // Plan:
+        //: 1 Access 'k_SEED_LENGTH' and ASSERT it is equal to the expected
+        //:   value. (C-1,2)
+        //
+        // Testing:
+        //   enum { k_SEED_LENGTH = 8 };
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'k_SEED_LENGTH'"
+                            "\n=======================\n");
+
+        ASSERT(8 == WyHashAlgorithm::k_SEED_LENGTH);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'result_type' TYPEDEF
+        //   Verify that the class offers the result_type typedef that needs to
+        //   be exposed by all 'bslh' hashing algorithms
+        //
+        // Concerns:
+        //: 1 The typedef 'result_type' is publicly accessible and an alias for
+        //:   'bsls::Types::Uint64'.
+        //:
+        //: 2 'computeHash()' returns 'result_type'
+        //
+        // Plan:
+        //: 1 ASSERT the typedef is accessible and is the correct type using
+        //:   'bslmf::IsSame'. (C-1)
+        //:
+        //: 2 Declare the expected signature of 'computeHash()' and then assign
+        //:   to it.  If it compiles, the test passes. (C-2)
+        //
+        // Testing:
+        //   typedef bsls::Types::Uint64 result_type;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'result_type' TYPEDEF"
+                            "\n=============================\n");
+
+        ASSERT((bslmf::IsSame<bsls::Types::Uint64,
+                              WyHashAlgorithm::result_type>::VALUE));
+
+        Obj::result_type (Obj::*expectedSignature) ();
+
+        (void)(expectedSignature = &Obj::computeHash);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'operator()' AND 'computeHash()'
+        //   Verify that the hash of a sequence of bytes is that of the
+        //   reference implementation of wyhash, however the sequence is
+        //   divided among calls to 'operator()'.
+        //
+        // Concerns:
+        //: 1 'computeHash' returns the hash of the reference implementation,
+        //:   including for the published test vectors.
+        //:
+        //: 2 The hash is the same regardless of whether the bytes are passed
+        //:   all at once or in pieces of any lengths, in particular pieces
+        //:   ending on either side of the 16- and 48-byte boundaries at which
+        //:   the algorithm changes its processing.
+        //:
+        //: 3 Calls to 'operator()' with a length of 0 do not contribute to the
+        //:   hash.
+        //:
+        //: 4 The seed is read as little-endian bytes, so that the hash of a
+        //:   byte string does not depend on the byte order of the platform.
+        //:
+        //: 5 'computeHash' does not change the state of the object.
+        //:
+        //: 6 'operator()' does a BSLS_ASSERT for null pointers and non-zero
+        //:   length, and not for null pointers and zero length.
+        //
+        // Plan:
+        //: 1 Compare the hashes of the published test vectors with the values
+        //:   published with the reference implementation.  (C-1, 4)
+        //:
+        //: 2 For each length up to several blocks of pseudo-random data,
+        //:   compare with the oracle the hashes computed by passing the data
+        //:   all at once, one byte at a time, in two pieces split at every
+        //:   position, and in pseudo-random pieces interspersed with empty
+        //:   pieces.  (C-1..3, 5)
+        //:
+        //: 3 Call 'operator()' with a null pointer. (C-6)
+        //
+        // Testing:
+        //   void operator()(void const* key, size_t len);
+        //   result_type computeHash();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'operator()' AND 'computeHash()'"
+                            "\n========================================\n");
+
+        if (verbose) printf("Published test vectors. (C-1, 4)\n");
+        {
+            static const struct {
+                int         d_line;
+                const char *d_value;
+                char        d_seed;
+                Uint64      d_expectedHash;
+            } DATA[] = {
+                //LINE VALUE                                SEED  HASH
+                //---- ------------------------------------ ---- -----------
+                { L_,  "",                                  0,
+                                                     0x42bc986dc5eec4d3ULL },
+                { L_,  "a",                                 1,
+                                                     0x84508dc903c31551ULL },
+                { L_,  "abc",                               2,
+                                                     0x0bc54887cfc9ecb1ULL },
+                { L_,  "message digest",                    3,
+                                                     0x6e2ff3298208a67cULL },
+                { L_,  "abcdefghijklmnopqrstuvwxyz",        4,
+                                                     0x9a64e42e897195b9ULL },
+                { L_,  "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"
+                       "0123456789",                        5,
+                                                     0x9199383239c32554ULL },
+                { L_,  "123456789012345678901234567890123456789012345678901"
+                       "23456789012345678901234567890",     6,
+                                                     0x7c1ccf6bba30f5a5ULL },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int i = 0; i != NUM_DATA; ++i) {
+                const int     LINE  = DATA[i].d_line;
+                const char   *VALUE = DATA[i].d_value;
+                const Uint64  EXP   = DATA[i].d_expectedHash;
+
+                const char SEED[8] = { DATA[i].d_seed, 0, 0, 0, 0, 0, 0, 0 };
+
+                Obj mX(SEED);
+                mX(VALUE, strlen(VALUE));
+                const Uint64 hash = mX.computeHash();
+
+                if (veryVerbose) { P_(LINE) P_(EXP) P(hash) }
+
+                ASSERTV(LINE, hash, EXP, EXP == hash);
+                ASSERTV(LINE, hash == mX.computeHash());
+            }
+
+            Obj mX;
+            ASSERTV(0x42bc986dc5eec4d3ULL == mX.computeHash());
+        }
+
+        if (verbose) printf("Compare with the oracle. (C-1..3, 5)\n");
+        {
+            const int MAX_LENGTH = 48 * 5 + 20;
+
+            char data[MAX_LENGTH];
+            unsigned state = 7;
+            for (int i = 0; i < MAX_LENGTH; ++i) {
+                state = state * 1103515245u + 12345u;
+                data[i] = static_cast<char>(state >> 16);
+            }
+
+            const char SEED[8] = { '\x01', '\x23', '\x45', '\x67',
+                                   '\x89', '\xab', '\xcd', '\xef' };
+            const Uint64 SEED_VALUE = 0xefcdab8967452301ULL;
+
+            for (int len = 0; len <= MAX_LENGTH; ++len) {
+                const Uint64 EXP = reference::wyhash(data, len, SEED_VALUE);
+
+                {
+                    Obj mX(SEED);
+                    mX(data, len);
+                    ASSERTV(len, EXP == mX.computeHash());
+                    ASSERTV(len, EXP == mX.computeHash());
+                }
+                {
+                    Obj mX(SEED);
+                    for (int i = 0; i < len; ++i) {
+                        mX(data + i, 1);
+                    }
+                    ASSERTV(len, EXP == mX.computeHash());
+                }
+                for (int split = 0; split <= len; ++split) {
+                    Obj mX(SEED);
+                    mX(data, split);
+                    mX(data + split, len - split);
+                    ASSERTV(len, split, EXP == mX.computeHash());
+                }
+                for (int trial = 0; trial < 8; ++trial) {
+                    Obj mX(SEED);
+                    int pos = 0;
+                    while (pos < len) {
+                        state = state * 1103515245u + 12345u;
+                        int n = static_cast<int>(state >> 16) % 70;
+                        if (n > len - pos) {
+                            n = len - pos;
+                        }
+                        mX(data + pos, n);
+                        mX(data, 0);
+                        pos += n;
+                    }
+                    ASSERTV(len, trial, EXP == mX.computeHash());
+                }
+            }
+        }
+
+        if (verbose) printf("Call 'operator()' with null pointers. (C-6)\n");
+        {
+            const char data[5] = {'a', 'b', 'c', 'd', 'e'};
+
+            bsls::AssertTestHandlerGuard guard;
+
+            ASSERT_FAIL(Obj().operator()(   0, 5));
+            ASSERT_PASS(Obj().operator()(   0, 0));
+            ASSERT_PASS(Obj().operator()(data, 5));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS
+        //   Ensure that the default and seeded constructors are publicly
+        //   callable, and that the seed contributes to the hash.
+        //
+        // Concerns:
+        //: 1 Objects can be created using the default constructor, which is
+        //:   equivalent to a seed of 0.
+        //:
+        //: 2 Objects can be created using the parameterized constructor.
+        //:
+        //: 3 Objects can be destroyed.
+        //:
+        //: 4 Every byte of the seed contributes to the hash.
+        //:
+        //: 5 The parameterized constructor does a BSLS_ASSERT for null
+        //:   pointers.
+        //
+        // Plan:
+        //: 1 Create objects with each constructor and allow them to leave
+        //:   scope, comparing the hashes of the same input.  (C-1..3)
+        //:
+        //: 2 Change each byte of the seed in turn and verify that the hash
+        //:   changes.  (C-4)
+        //:
+        //: 3 Call the parameterized constructor with a null pointer. (C-5)
+        //
+        // Testing:
+        //   WyHashAlgorithm();
+        //   explicit WyHashAlgorithm(const char *seed);
+        //   ~WyHashAlgorithm();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING CREATORS"
+                            "\n================\n");
+
+        {
+            Obj mX;
+            Obj mY(genericSeed);
+            mX("seed", 4);
+            mY("seed", 4);
+            ASSERT(mX.computeHash() == mY.computeHash());
+        }
+
+        {
+            Obj mX(genericSeed);
+            mX("seed", 4);
+            const Uint64 HASH = mX.computeHash();
+
+            for (int i = 0; i < Obj::k_SEED_LENGTH; ++i) {
+                char seed[Obj::k_SEED_LENGTH] = { 0 };
+                seed[i] = 1;
+
+                Obj mY(seed);
+                mY("seed", 4);
+                ASSERTV(i, HASH != mY.computeHash());
+            }
+        }
+
+        {
+            bsls::AssertTestHandlerGuard guard;
+
+            ASSERT_FAIL(Obj dummy(0));
+            ASSERT_PASS(Obj dummy(genericSeed));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an instance of 'bslh::WyHashAlgorithm'. (C-1)
+        //:
+        //: 2 Verify different hashes are produced for different c-strings.
+        //:   (C-1)
+        //:
+        //: 3 Verify the same hashes are produced for the same c-strings. (C-1)
+        //:
+        //: 4 Verify different hashes are produced for different 'int's. (C-1)
+        //:
+        //: 5 Verify the same hashes are produced for the same 'int's. (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        {
+            WyHashAlgorithm hashAlg1;
+            WyHashAlgorithm hashAlg2;
+            const char * str1 = "Hello World";
+            const char * str2 = "Goodbye World";
+            hashAlg1(str1, strlen(str1));
+            hashAlg2(str2, strlen(str2));
+            ASSERT(hashAlg1.computeHash() != hashAlg2.computeHash());
+        }
+
+        {
+            WyHashAlgorithm hashAlg1;
+            WyHashAlgorithm hashAlg2;
+            const char * str1 = "Hello World";
+            const char * str2 = "Hello World";
+            hashAlg1(str1, strlen(str1));
+            hashAlg2(str2, strlen(str2));
+            ASSERT(hashAlg1.computeHash() == hashAlg2.computeHash());
+        }
+
+        {
+            WyHashAlgorithm hashAlg1;
+            WyHashAlgorithm hashAlg2;
+            int int1 = 123456;
+            int int2 = 654321;
+            hashAlg1(&int1, sizeof(int));
+            hashAlg2(&int2, sizeof(int));
+            ASSERT(hashAlg1.computeHash() != hashAlg2.computeHash());
+        }
+
+        {
+            WyHashAlgorithm hashAlg1;
+            WyHashAlgorithm hashAlg2;
+            int int1 = 123456;
+            int int2 = 123456;
+            hashAlg1(&int1, sizeof(int));
+            hashAlg2(&int2, sizeof(int));
+            ASSERT(hashAlg1.computeHash() == hashAlg2.computeHash());
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: KEYS FROM 8 BYTES TO 4 KB
+        //   Compare the time taken to hash keys of various lengths with this
+        //   and other 'bslh' algorithms, and the time taken to hash a range of
+        //   'int' values element by element and with 'hashAppendRange'.
+        //   Command line parameters:
+        //   2nd parameter: number of bytes hashed per key length (defaults to
+        //   256 MB).
+        //
+        // Concerns:
+        //: 1 Report the average time to hash a key, for each key length and
+        //:   algorithm.
+        //
+        // Plan:
+        //: 1 For key lengths from 8 bytes to 4 KB, time the hashing of keys
+        //:   with 'WyHashAlgorithm', 'SpookyHashAlgorithm' (the current
+        //:   default), and 'SipHashAlgorithm', and print the results and the
+        //:   throughput.
+        //:
+        //: 2 For the same lengths, time the hashing of an array of 'int'
+        //:   values by 'hashAppend' on each element and by 'hashAppendRange'.
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE: KEYS FROM 8 BYTES TO 4 KB"
+               "\n======================================\n");
+
+        const double totalBytes = argc > 2 ? atof(argv[2]) : 256.0 * 1024
+                                                                   * 1024;
+
+        static char data[4096 + 64];
+        static int  ints[4096 / sizeof(int)];
+        for (size_t i = 0; i < sizeof data; ++i) {
+            data[i] = static_cast<char>(i * 131 + 17);
+        }
+        for (size_t i = 0; i < sizeof ints / sizeof *ints; ++i) {
+            ints[i] = static_cast<int>(i * 2654435761u);
+        }
+
+        printf("Time per key (ns), and throughput (GB/s) for 'WyHash'\n");
+        printf("%8s %10s %10s %10s %10s\n",
+               "bytes", "WyHash", "Spooky", "SipHash", "GB/s");
+
+        for (size_t len = 8; len <= 4096; len *= 2) {
+            const int numKeys = static_cast<int>(totalBytes / len);
+
+            const double wy     = timeKeys<WyHashAlgorithm>(data,
+                                                            len,
+                                                            numKeys);
+            const double spooky = timeKeys<SpookyHashAlgorithm>(data,
+                                                                len,
+                                                                numKeys);
+            const double sip    = timeKeys<SipHashWithDefaultSeed>(data,
+                                                                   len,
+                                                                   numKeys);
+
+            printf("%8d %10.2f %10.2f %10.2f %10.2f\n",
+                   static_cast<int>(len), wy, spooky, sip, len / wy);
+        }
+
+        printf("\nTime per range of 'int' (ns): per element vs. one call\n");
+        printf("%8s %12s %12s %12s %12s\n",
+               "bytes", "Wy/elem", "Wy/range", "Dflt/elem", "Dflt/range");
+
+        for (size_t len = 8; len <= 4096; len *= 2) {
+            const size_t n       = len / sizeof(int);
+            const int    numKeys = static_cast<int>(totalBytes / len);
+
+            const double wyElem  = timeElementwise<WyHashAlgorithm>(ints,
+                                                                    n,
+                                                                    numKeys);
+            const double wyRange = timeRange<WyHashAlgorithm>(ints,
+                                                              n,
+                                                              numKeys);
+            const double dfElem  =
+                    timeElementwise<DefaultHashAlgorithm>(ints, n, numKeys);
+            const double dfRange =
+                          timeRange<DefaultHashAlgorithm>(ints, n, numKeys);
+
+            printf("%8d %12.2f %12.2f %12.2f %12.2f\n",
+                   static_cast<int>(len), wyElem, wyRange, dfElem, dfRange);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -758,10 +758,9 @@ void hashAppend(HASH_ALGORITHM& hashAlgorithm, const array<TYPE, SIZE>& input)
     using ::BloombergLP::bslh::hashAppend;
 
     hashAppend(hashAlgorithm, SIZE);
-    for (size_t i = 0; i < SIZE; ++i)
-    {
-        hashAppend(hashAlgorithm, input[i]);
-    }
+    ::BloombergLP::bslh::hashAppendRange(hashAlgorithm,
+                                         input.data(),
+                                         input.data() + SIZE);
 }
 
 }  // close namespace bsl
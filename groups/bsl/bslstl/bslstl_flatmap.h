@@ -0,0 +1,1542 @@
+// bslstl_flatmap.h                                                   -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATMAP
+#define INCLUDED_BSLSTL_FLATMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a map container implemented as a sorted vector.
+//
+//@CLASSES:
+//   bsl::flat_map: map of unique keys to values held in a sorted sequence
+//
+//@SEE_ALSO: bslstl_flatset, bslstl_map, bslstl_flattree
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::flat_map', implementing a container holding an ordered sequence of
+// key-value pairs having unique keys, with the interface of 'bsl::map', in a
+// 'bsl::vector' kept sorted by key.  It follows the 'std::flat_map' of C++23
+// where that differs from 'bsl::map', except as noted below.
+//
+// An instantiation of 'flat_map' is an allocator-aware, value-semantic type
+// whose salient attributes are its size (number of key-value pairs) and the
+// ordered sequence of key-value pairs the 'flat_map' contains.  If 'flat_map'
+// is instantiated with a key type or mapped-value type that is not itself
+// value-semantic, then it will not retain all of its value-semantic
+// qualities.
+//
+///'flat_map' vs. 'map'
+///--------------------
+// A 'bsl::map' allocates a node for each key-value pair and links the nodes
+// into a red-black tree.  A 'flat_map' holds its key-value pairs in a single
+// contiguous array, so that a lookup is a binary search touching a few cache
+// lines, iteration is a linear scan, and the memory overhead per pair is nil.
+// The price is paid on modification: inserting or erasing a single pair
+// shifts the pairs that follow it, and so has linear complexity, and an
+// insertion or erasure invalidates all iterators and references into the
+// container.  A 'flat_map' is therefore best suited to small maps, and to
+// lookup tables built once (or in bulk) and then searched often.
+//
+// Building a 'flat_map' from a range with the range constructor (or the range
+// 'insert' method) sorts the pairs of the range once and discards those with
+// duplicate keys, which is 'O[N * log(N)]'; inserting the same 'N' pairs one
+// at a time is 'O[N * N]'.  If the pairs are known to be sorted and to have
+// unique keys already, passing the 'bsl::sorted_unique' tag avoids the sort.
+//
+///Differences From 'std::flat_map'
+/// - - - - - - - - - - - - - - - -
+// 'std::flat_map' holds keys and mapped values in two separate containers.
+// A 'bsl::flat_map' holds both in a single 'bsl::vector' of
+// 'bsl::pair<KEY, VALUE>', so that its iterators are plain pointers and a
+// lookup touches the key and the value together.  Note that the key of a
+// 'value_type' is not 'const' (so that pairs may be shifted by assignment);
+// the behavior is undefined if the key of a pair held by a 'flat_map' is
+// modified through an iterator.
+//
+// The 'emplace' family of methods is not provided; 'insert', 'operator[]',
+// and the range constructors cover the intended uses.
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a flat map's 'ALLOCATOR' template parameter determines
+// how that flat map will allocate memory, as for 'bsl::map'.  If 'ALLOCATOR'
+// is 'bsl::allocator' (the default), a 'flat_map' accepts an optional
+// 'bslma::Allocator' argument at construction, uses it to supply memory for
+// its array, and passes it to the constructors of keys and values having the
+// 'bslma::UsesBslmaAllocator' trait.
+//
+// A 'flat_map' holds its pairs out of line, in memory obtained from its
+// allocator, and so is bitwise moveable (regardless of 'KEY' and 'VALUE') if
+// its comparator and allocator are bitwise moveable.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'flat_map':
+//..
+//  Legend
+//  ------
+//  'K'             - (template parameter) type 'KEY' of the flat map
+//  'V'             - (template parameter) type 'VALUE' of the flat map
+//  'a', 'b'        - two distinct objects of type 'flat_map<K, V>'
+//  'n', 'm'        - number of elements in 'a' and 'b' respectively
+//  'k'             - an object of type 'K'
+//  'v'             - an object of type 'pair<K, V>'
+//  'i1', 'i2'      - two iterators defining a sequence of 'value_type' objects
+//  'N'             - distance(i1,i2)
+//
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | flat_map<K, V> a(i1, i2);                          | O[N * log(N)]      |
+//  +----------------------------------------------------+--------------------+
+//  | flat_map<K, V> a(sorted_unique, i1, i2);           | O[N]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(i1, i2)                                   | O[N * log(N) + n]  |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(sorted_unique, i1, i2)                    | O[N + n]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(v), a.erase(k)                            | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a[k]                                               | O[log(n)] if 'k'   |
+//  |                                                    | is present,        |
+//  |                                                    | O[n] otherwise     |
+//  +----------------------------------------------------+--------------------+
+//  | a.at(k), a.find(k), a.count(k), a.contains(k),     | O[log(n)]          |
+//  | a.lower_bound(k), a.upper_bound(k),                |                    |
+//  | a.equal_range(k)                                   |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.swap(b), swap(a,b)                               | O[1] if 'a' and    |
+//  |                                                    | 'b' use the same   |
+//  |                                                    | allocator,         |
+//  |                                                    | O[n + m] otherwise |
+//  +----------------------------------------------------+--------------------+
+//..
+// The remaining operations have the complexity of the corresponding
+// operations of 'bsl::vector'.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Read-Mostly Lookup Table
+///- - - - - - - - - - - - - - - - - - -
+// Suppose we are writing a message router that maps each message type code
+// to the name of the queue that handles it.  The table is loaded once from
+// configuration and then consulted for every message, so a 'flat_map' is a
+// good fit.
+//
+// First, we load the routes, which arrive in no particular order, into a
+// vector:
+//..
+//  typedef bsl::pair<int, bsl::string> Route;
+//
+//  bslma::TestAllocator oa("object", veryVeryVerbose);
+//
+//  bsl::vector<Route> config(&oa);
+//  config.push_back(Route(300, "trades"));
+//  config.push_back(Route(100, "quotes"));
+//  config.push_back(Route(200, "orders"));
+//  config.push_back(Route(150, "news"));
+//..
+// Then, we build the routing table in one step, which sorts the routes once
+// rather than shifting them on each insertion:
+//..
+//  bsl::flat_map<int, bsl::string> routes(config.begin(), config.end(), &oa);
+//
+//  assert(4 == routes.size());
+//  assert(100 == routes.begin()->first);
+//..
+// Now, we route a few messages:
+//..
+//  assert("orders" == routes.at(200));
+//  assert(routes.end() == routes.find(250));
+//..
+// Finally, we map a new message type to a default queue using 'operator[]':
+//..
+//  routes[250] = "misc";
+//
+//  assert(5 == routes.size());
+//  assert("misc" == routes.find(250)->second);
+//..
+
+// Prevent 'bslstl' headers from being included directly in 'BSL_OVERRIDES_STD'
+// mode.  Doing so is unsupported, and is likely to cause compilation errors.
+#if defined(BSL_OVERRIDES_STD) && !defined(BOS_STDHDRS_PROLOGUE_IN_EFFECT)
+#error "include <bsl_flat_map.h> instead of <bslstl_flatmap.h> in \
+BSL_OVERRIDES_STD mode"
+#endif
+#include <bslscm_version.h>
+
+#include <bslstl_flattree.h>
+#include <bslstl_iterator.h>
+#include <bslstl_pair.h>
+#include <bslstl_stdexceptutil.h>
+
+#include <bslalg_rangecompare.h>
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bslma_allocatortraits.h>
+#include <bslma_destructorguard.h>
+#include <bslma_stdallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_objectbuffer.h>
+
+#include <functional>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+# include <initializer_list>
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                          // ========================
+                          // struct FlatMap_EntryUtil
+                          // ========================
+
+template <class KEY, class VALUE>
+struct FlatMap_EntryUtil {
+    // This 'struct' provides the key of an entry of a 'flat_map', which is
+    // the 'first' member of the entry, as required by 'FlatTree'.
+
+    // CLASS METHODS
+    static const KEY& key(const bsl::pair<KEY, VALUE>& entry);
+        // Return a reference providing non-modifiable access to the key of
+        // the specified 'entry'.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                              // ==============
+                              // class flat_map
+                              // ==============
+
+template <class KEY,
+          class VALUE,
+          class COMPARATOR = std::less<KEY>,
+          class ALLOCATOR  = bsl::allocator<bsl::pair<KEY, VALUE> > >
+class flat_map {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of key-value pairs having unique keys (of the
+    // template parameter type 'KEY') and associated values (of the template
+    // parameter type 'VALUE') in a sorted 'bsl::vector'.
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslstl::FlatTree<
+                           KEY,
+                           bsl::pair<KEY, VALUE>,
+                           BloombergLP::bslstl::FlatMap_EntryUtil<KEY, VALUE>,
+                           COMPARATOR,
+                           ALLOCATOR>                  Tree;
+        // This 'typedef' is an alias for the sorted vector holding the pairs.
+
+    typedef bsl::allocator_traits<ALLOCATOR>           AllocatorTraits;
+        // This 'typedef' is an alias for the allocator traits type associated
+        // with this container.
+
+    typedef BloombergLP::bslmf::MovableRefUtil         MoveUtil;
+        // This 'typedef' is a convenient alias for the utility associated
+        // with movable references.
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef VALUE                                      mapped_type;
+    typedef bsl::pair<KEY, VALUE>                      value_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef ALLOCATOR                                  allocator_type;
+    typedef value_type&                                reference;
+    typedef const value_type&                          const_reference;
+
+    typedef typename AllocatorTraits::size_type        size_type;
+    typedef typename AllocatorTraits::difference_type  difference_type;
+    typedef typename AllocatorTraits::pointer          pointer;
+    typedef typename AllocatorTraits::const_pointer    const_pointer;
+
+    typedef typename Tree::iterator                    iterator;
+    typedef typename Tree::const_iterator              const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+    class value_compare {
+        // This nested class defines a mechanism for comparing two objects of
+        // 'value_type' by adapting an object of (template parameter) type
+        // 'COMPARATOR', which compares two objects of (template parameter)
+        // type 'KEY', as does 'bsl::map::value_compare'.
+
+        // FRIENDS
+        friend class flat_map;
+
+      protected:
+        // PROTECTED DATA
+        COMPARATOR comp;  // we would not have elected to make this data
+                          // member 'protected'
+
+        // PROTECTED CREATORS
+        value_compare(COMPARATOR comparator);                       // IMPLICIT
+            // Create a 'value_compare' object that uses the specified
+            // 'comparator'.
+
+      public:
+        // PUBLIC TYPES
+        typedef bool result_type;
+            // This 'typedef' is an alias for the result type of a call to
+            // the comparison function.
+
+        typedef value_type first_argument_type;
+            // This 'typedef' is an alias for the type of the first parameter
+            // of the comparison function.
+
+        typedef value_type second_argument_type;
+            // This 'typedef' is an alias for the type of the second parameter
+            // of the comparison function.
+
+        // ACCESSORS
+        bool operator()(const value_type& x, const value_type& y) const;
+            // Return 'true' if the key of the specified 'x' is ordered before
+            // the key of the specified 'y', and 'false' otherwise.
+    };
+
+  private:
+    // DATA
+    Tree d_tree;  // sorted vector of key-value pairs, and comparator
+
+  public:
+    // CREATORS
+    flat_map();
+    explicit flat_map(const COMPARATOR& comparator,
+                      const ALLOCATOR&  basicAllocator = ALLOCATOR())
+        // Create an empty flat map.  Optionally specify a 'comparator' used
+        // to order key-value pairs contained in this object.  If 'comparator'
+        // is not supplied, a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'ALLOCATOR' is used.  If the type 'ALLOCATOR' is
+        // 'bsl::allocator' and 'basicAllocator' is not supplied, the
+        // currently installed default allocator is used.
+    : d_tree(comparator, basicAllocator)
+    {
+        // The implementation is placed here in the class definition to work
+        // around an AIX compiler bug (see 'bslstl_map').
+    }
+
+    explicit flat_map(const ALLOCATOR& basicAllocator);
+        // Create an empty flat map that uses the specified 'basicAllocator'
+        // to supply memory.  Use a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' to order the key-value
+        // pairs.
+
+    flat_map(const flat_map& original);
+        // Create a flat map having the same value as the specified 'original'
+        // object.  Use a copy of 'original.key_comp()' to order the key-value
+        // pairs contained in this flat map.  Use the allocator returned by
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // allocate memory.
+
+    flat_map(BloombergLP::bslmf::MovableRef<flat_map> original);    // IMPLICIT
+        // Create a flat map having the same value as the specified 'original'
+        // object by moving (in constant time) the contents of 'original' to
+        // the new flat map.  The allocator associated with 'original' is
+        // propagated for use in the new flat map.  'original' is left in a
+        // valid but unspecified state.
+
+    flat_map(const flat_map& original, const ALLOCATOR& basicAllocator);
+        // Create a flat map having the same value as the specified 'original'
+        // object that uses the specified 'basicAllocator' to supply memory.
+
+    flat_map(BloombergLP::bslmf::MovableRef<flat_map> original,
+             const ALLOCATOR&                         basicAllocator);
+        // Create a flat map having the same value as the specified 'original'
+        // object that uses the specified 'basicAllocator' to supply memory.
+        // The contents of 'original' are moved (in constant time) to the new
+        // flat map if 'basicAllocator == original.get_allocator()', and are
+        // move-inserted (in linear time) using 'basicAllocator' otherwise.
+        // 'original' is left in a valid but unspecified state.
+
+    template <class INPUT_ITERATOR>
+    flat_map(INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const COMPARATOR& comparator = COMPARATOR(),
+             const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    template <class INPUT_ITERATOR>
+    flat_map(INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const ALLOCATOR&  basicAllocator);
+        // Create a flat map holding the key-value pairs in the range starting
+        // at the specified 'first' element, and ending immediately before the
+        // specified 'last' element, sorting them (once) and keeping only one
+        // of each set of pairs having equivalent keys.  It is unspecified
+        // which of a set of pairs having equivalent keys is kept.  Optionally
+        // specify a 'comparator' used to order key-value pairs contained in
+        // this object.  If 'comparator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'COMPARATOR' is used.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  This operation has 'O[N * log(N)]'
+        // complexity, where 'N' is the number of elements in the range.  The
+        // behavior is undefined unless '[first .. last)' is a valid range.
+
+    template <class INPUT_ITERATOR>
+    flat_map(sorted_unique_t,
+             INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const COMPARATOR& comparator = COMPARATOR(),
+             const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    template <class INPUT_ITERATOR>
+    flat_map(sorted_unique_t,
+             INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const ALLOCATOR&  basicAllocator);
+        // Create a flat map holding the key-value pairs in the range starting
+        // at the specified 'first' element, and ending immediately before the
+        // specified 'last' element, in linear time.  Optionally specify a
+        // 'comparator' used to order key-value pairs contained in this
+        // object.  If 'comparator' is not supplied, a default-constructed
+        // object of the (template parameter) type 'COMPARATOR' is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is not supplied, a default-constructed object of
+        // the (template parameter) type 'ALLOCATOR' is used.  The behavior is
+        // undefined unless '[first .. last)' is a valid range that is sorted
+        // by key according to the comparator and has no equivalent keys.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_map(std::initializer_list<value_type> values,
+             const COMPARATOR&                 comparator = COMPARATOR(),
+             const ALLOCATOR&                  basicAllocator = ALLOCATOR());
+    flat_map(std::initializer_list<value_type> values,
+             const ALLOCATOR&                  basicAllocator);
+        // Create a flat map holding the key-value pairs in the specified
+        // 'values' initializer list, keeping only one of each set of pairs
+        // having equivalent keys.  Optionally specify a 'comparator' used to
+        // order key-value pairs contained in this object.  If 'comparator' is
+        // not supplied, a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'ALLOCATOR' is used.
+#endif
+
+    ~flat_map();
+        // Destroy this object.
+
+    // MANIPULATORS
+    flat_map& operator=(const flat_map& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, propagate to this object the allocator of 'rhs' if
+        // the 'ALLOCATOR' type has trait
+        // 'propagate_on_container_copy_assignment', and return a reference
+        // providing modifiable access to this object.
+
+    flat_map& operator=(BloombergLP::bslmf::MovableRef<flat_map> rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, propagate to this object the allocator of 'rhs' if
+        // the 'ALLOCATOR' type has trait
+        // 'propagate_on_container_move_assignment', and return a reference
+        // providing modifiable access to this object.  The contents of 'rhs'
+        // are moved (in constant time) to this flat map if
+        // 'get_allocator() == rhs.get_allocator()' (after accounting for the
+        // aforementioned trait), and are move-inserted (in linear time)
+        // otherwise.  'rhs' is left in a valid but unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_map& operator=(std::initializer_list<value_type> values);
+        // Assign to this object the value resulting from first clearing this
+        // flat map and then inserting each key-value pair in the specified
+        // 'values' initializer list, keeping only one of each set of pairs
+        // having equivalent keys, and return a reference providing modifiable
+        // access to this object.
+#endif
+
+    VALUE& operator[](const key_type& key);
+    VALUE& operator[](BloombergLP::bslmf::MovableRef<key_type> key);
+        // Return a reference providing modifiable access to the
+        // mapped-value associated with the specified 'key' in this flat map;
+        // if this flat map does not already contain a 'value_type' object
+        // having an equivalent key, first insert a new 'value_type' object
+        // having 'key' and a default-constructed 'VALUE' object, and return a
+        // reference to the newly mapped (default) value.  Note that the
+        // insertion shifts the pairs ordered after 'key', and invalidates all
+        // iterators into this flat map.
+
+    VALUE& at(const key_type& key);
+        // Return a reference providing modifiable access to the mapped-value
+        // associated with the specified 'key' in this flat map, if such an
+        // entry exists; otherwise, throw a 'std::out_of_range' exception.
+
+    pair<iterator, bool> insert(const value_type& value);
+    pair<iterator, bool> insert(
+                          BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' into this flat map if the key (the
+        // 'first' element) of 'value' does not already exist in this flat
+        // map; otherwise, this method has no effect.  Return a pair whose
+        // 'first' member is an iterator referring to the (possibly newly
+        // inserted) 'value_type' object in this flat map whose key is
+        // equivalent to that of 'value', and whose 'second' member is 'true'
+        // if a new value was inserted, and 'false' if the key was already
+        // present.  Note that this operation shifts the pairs ordered after
+        // 'value', and invalidates all iterators into this flat map.
+
+    iterator insert(const_iterator hint, const value_type& value);
+    iterator insert(const_iterator                             hint,
+                    BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' into this flat map (in amortized
+        // constant time, not counting the shift of subsequent pairs, if the
+        // specified 'hint' is the position of 'value') if the key of 'value'
+        // does not already exist in this flat map.  Return an iterator
+        // referring to the (possibly newly inserted) 'value_type' object in
+        // this flat map whose key is equivalent to that of 'value'.  The
+        // behavior is undefined unless 'hint' is an iterator in the range
+        // '[begin() .. end()]' (both endpoints included).
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this flat map the key-value pairs in the range starting
+        // at the specified 'first' position, and ending immediately before
+        // the specified 'last' position, whose keys are not equivalent to a
+        // key in this flat map, sorting the range once and merging it with
+        // the pairs of this flat map.  It is unspecified which of a set of
+        // pairs in the range having equivalent keys is inserted.  The
+        // behavior is undefined unless '[first .. last)' is a valid range not
+        // referring into this flat map.
+
+    template <class INPUT_ITERATOR>
+    void insert(sorted_unique_t, INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this flat map the key-value pairs in the range starting
+        // at the specified 'first' position, and ending immediately before
+        // the specified 'last' position, whose keys are not equivalent to a
+        // key in this flat map, merging the range with the pairs of this flat
+        // map.  The behavior is undefined unless '[first .. last)' is a valid
+        // range, not referring into this flat map, that is sorted by key
+        // according to 'key_comp()' and has no equivalent keys.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(std::initializer_list<value_type> values);
+        // Insert into this flat map the key-value pairs in the specified
+        // 'values' initializer list whose keys are not equivalent to a key in
+        // this flat map.
+#endif
+
+    iterator erase(const_iterator position);
+        // Remove from this flat map the 'value_type' object at the specified
+        // 'position', and return an iterator referring to the element
+        // immediately following the removed element, or 'end()' if the
+        // removed element was the last.  The behavior is undefined unless
+        // 'position' refers to a 'value_type' object in this flat map.
+
+    size_type erase(const key_type& key);
+        // Remove from this flat map the 'value_type' object whose key is
+        // equivalent to the specified 'key', if such an entry exists, and
+        // return the number of objects removed (0 or 1).
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this flat map the 'value_type' objects starting at the
+        // specified 'first' position up to, but not including, the specified
+        // 'last' position, and return 'last' (as an 'iterator').  The
+        // behavior is undefined unless '[first .. last)' is a valid range of
+        // this flat map.
+
+    void clear();
+        // Remove all entries from this flat map.  Note that the capacity of
+        // this flat map is retained.
+
+    void reserve(size_type numEntries);
+        // Reserve memory sufficient for this flat map to hold the specified
+        // 'numEntries' without allocating.
+
+    void shrink_to_fit();
+        // Reduce the memory used by this flat map to that required by its
+        // entries, if possible.
+
+    void swap(flat_map& other);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object; also exchange the allocator of this
+        // object with that of 'other' if the (template parameter) type
+        // 'ALLOCATOR' has the 'propagate_on_container_swap' trait.  This
+        // method provides the no-throw exception-safety guarantee if the
+        // allocators are equal (or propagated) and the comparator does not
+        // throw on swap; otherwise, the entries are copied (in linear time).
+
+    iterator begin();
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object (the one having the key ordered first) in this
+        // flat map, or 'end()' if this flat map is empty.
+
+    iterator end();
+        // Return the past-the-end iterator of this flat map.
+
+    reverse_iterator rbegin();
+        // Return a reverse iterator providing modifiable access to the last
+        // 'value_type' object in this flat map, or 'rend()' if this flat map
+        // is empty.
+
+    reverse_iterator rend();
+        // Return the past-the-end reverse iterator of this flat map.
+
+    iterator find(const key_type& key);
+        // Return an iterator providing modifiable access to the 'value_type'
+        // object in this flat map whose key is equivalent to the specified
+        // 'key', or 'end()' if there is no such object.
+
+    iterator lower_bound(const key_type& key);
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in this flat map whose key is not ordered
+        // before the specified 'key', or 'end()' if there is no such object.
+
+    iterator upper_bound(const key_type& key);
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in this flat map whose key is ordered after the
+        // specified 'key', or 'end()' if there is no such object.
+
+    pair<iterator, iterator> equal_range(const key_type& key);
+        // Return a pair of iterators providing modifiable access to the
+        // (empty or one-element) sequence of 'value_type' objects in this
+        // flat map whose keys are equivalent to the specified 'key'.
+
+    // ACCESSORS
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // flat map.
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in this flat map, or 'end()' if this flat map
+        // is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return the past-the-end iterator of this flat map.
+
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in this flat map, or 'rend()' if this flat
+        // map is empty.
+
+    const_reverse_iterator rend() const;
+    const_reverse_iterator crend() const;
+        // Return the past-the-end reverse iterator of this flat map.
+
+    const VALUE& at(const key_type& key) const;
+        // Return a reference providing non-modifiable access to the
+        // mapped-value associated with the specified 'key' in this flat map,
+        // if such an entry exists; otherwise, throw a 'std::out_of_range'
+        // exception.
+
+    bool contains(const key_type& key) const;
+        // Return 'true' if this flat map contains an entry whose key is
+        // equivalent to the specified 'key', and 'false' otherwise.
+
+    size_type count(const key_type& key) const;
+        // Return the number of entries in this flat map whose keys are
+        // equivalent to the specified 'key' (0 or 1).
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this flat map whose key is equivalent to the
+        // specified 'key', or 'end()' if there is no such object.
+
+    const_iterator lower_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in this flat map whose key is not ordered
+        // before the specified 'key', or 'end()' if there is no such object.
+
+    const_iterator upper_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in this flat map whose key is ordered after the
+        // specified 'key', or 'end()' if there is no such object.
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                   const key_type& key) const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // (empty or one-element) sequence of 'value_type' objects in this
+        // flat map whose keys are equivalent to the specified 'key'.
+
+    key_compare key_comp() const;
+        // Return the comparison functor used by this flat map to order keys.
+
+    value_compare value_comp() const;
+        // Return a functor for comparing two 'value_type' objects by
+        // comparing their keys using 'key_comp()'.
+
+    bool empty() const;
+        // Return 'true' if this flat map contains no entries, and 'false'
+        // otherwise.
+
+    size_type size() const;
+        // Return the number of entries in this flat map.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the largest number of entries
+        // that this flat map could possibly hold.
+
+    size_type capacity() const;
+        // Return the number of entries this flat map can hold without
+        // allocating.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator==(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_map' objects have the same
+    // value if they have the same number of key-value pairs, and each pair in
+    // 'lhs' is equal (using 'operator==') to the pair at the same position in
+    // 'rhs'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator< (const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' flat map is
+    // lexicographically less than that of the specified 'rhs' flat map (see
+    // 'bsl::map'), and 'false' otherwise.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator> (const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' flat map is
+    // lexicographically greater than that of the specified 'rhs' flat map,
+    // and 'false' otherwise.  Note that this operator returns 'rhs < lhs'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' flat map is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // flat map, and 'false' otherwise.  Note that this operator returns
+    // '!(rhs < lhs)'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' flat map is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // flat map, and 'false' otherwise.  Note that this operator returns
+    // '!(lhs < rhs)'.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void swap(flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+          flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& b);
+    // Exchange the value and comparator of the specified 'a' object with
+    // those of the specified 'b' object (see 'flat_map::swap').
+
+}  // close namespace bsl
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+namespace BloombergLP {
+namespace bslstl {
+
+                          // ------------------------
+                          // struct FlatMap_EntryUtil
+                          // ------------------------
+
+// CLASS METHODS
+template <class KEY, class VALUE>
+inline
+const KEY&
+FlatMap_EntryUtil<KEY, VALUE>::key(const bsl::pair<KEY, VALUE>& entry)
+{
+    return entry.first;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                      // -----------------------------
+                      // class flat_map::value_compare
+                      // -----------------------------
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare::value_compare(
+                                                         COMPARATOR comparator)
+: comp(comparator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare::operator()(
+                                                    const value_type& x,
+                                                    const value_type& y) const
+{
+    return comp(x.first, y.first);
+}
+
+                              // --------------
+                              // class flat_map
+                              // --------------
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map()
+: d_tree(COMPARATOR(), ALLOCATOR())
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                              const ALLOCATOR& basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                                      const flat_map& original)
+: d_tree(original.d_tree,
+         AllocatorTraits::select_on_container_copy_construction(
+                                                     original.get_allocator()))
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                            BloombergLP::bslmf::MovableRef<flat_map> original)
+: d_tree(MoveUtil::move(MoveUtil::access(original).d_tree))
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                              const flat_map&  original,
+                                              const ALLOCATOR& basicAllocator)
+: d_tree(original.d_tree, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                     BloombergLP::bslmf::MovableRef<flat_map> original,
+                     const ALLOCATOR&                         basicAllocator)
+: d_tree(MoveUtil::move(MoveUtil::access(original).d_tree), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                             INPUT_ITERATOR    first,
+                                             INPUT_ITERATOR    last,
+                                             const COMPARATOR& comparator,
+                                             const ALLOCATOR&  basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+    d_tree.insert(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                             INPUT_ITERATOR    first,
+                                             INPUT_ITERATOR    last,
+                                             const ALLOCATOR&  basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+    d_tree.insert(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                             sorted_unique_t,
+                                             INPUT_ITERATOR    first,
+                                             INPUT_ITERATOR    last,
+                                             const COMPARATOR& comparator,
+                                             const ALLOCATOR&  basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+    d_tree.insert(sorted_unique, first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                             sorted_unique_t,
+                                             INPUT_ITERATOR    first,
+                                             INPUT_ITERATOR    last,
+                                             const ALLOCATOR&  basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+    d_tree.insert(sorted_unique, first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                            std::initializer_list<value_type> values,
+                            const COMPARATOR&                 comparator,
+                            const ALLOCATOR&                  basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+    d_tree.insert(values.begin(), values.end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                            std::initializer_list<value_type> values,
+                            const ALLOCATOR&                  basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+    d_tree.insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::~flat_map()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(const flat_map& rhs)
+{
+    d_tree = rhs.d_tree;
+    return *this;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(
+                                 BloombergLP::bslmf::MovableRef<flat_map> rhs)
+{
+    d_tree = MoveUtil::move(MoveUtil::access(rhs).d_tree);
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(
+                                      std::initializer_list<value_type> values)
+{
+    d_tree.clear();
+    d_tree.insert(values.begin(), values.end());
+    return *this;
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+VALUE& flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator[](
+                                                           const key_type& key)
+{
+    iterator iter = d_tree.lowerBound(key);
+    if (iter == end() || key_comp()(key, iter->first)) {
+        BloombergLP::bsls::ObjectBuffer<VALUE> temp;  // for default 'VALUE'
+
+        ALLOCATOR alloc = get_allocator();
+
+        AllocatorTraits::construct(alloc, temp.address());
+
+        BloombergLP::bslma::DestructorGuard<VALUE> guard(temp.address());
+
+        // See 'bslstl_map' for why 'move' is not used in C++03.
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        iter = d_tree.emplaceAt(iter, key, MoveUtil::move(temp.object()));
+#else
+        iter = d_tree.emplaceAt(iter, key, temp.object());
+#endif
+    }
+    return iter->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+VALUE& flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator[](
+                                  BloombergLP::bslmf::MovableRef<key_type> key)
+{
+    key_type& lvalue = key;
+
+    iterator iter = d_tree.lowerBound(lvalue);
+    if (iter == end() || key_comp()(lvalue, iter->first)) {
+        BloombergLP::bsls::ObjectBuffer<VALUE> temp;  // for default 'VALUE'
+
+        ALLOCATOR alloc = get_allocator();
+
+        AllocatorTraits::construct(alloc, temp.address());
+
+        BloombergLP::bslma::DestructorGuard<VALUE> guard(temp.address());
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        iter = d_tree.emplaceAt(iter,
+                                MoveUtil::move(lvalue),
+                                MoveUtil::move(temp.object()));
+#else
+        iter = d_tree.emplaceAt(iter, lvalue, temp.object());
+#endif
+    }
+    return iter->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+VALUE& flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::at(const key_type& key)
+{
+    iterator iter = d_tree.find(key);
+    if (iter == end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                            "flat_map<...>::at(key_type): invalid key value");
+    }
+    return iter->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
+{
+    return d_tree.insert(value);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                              BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    return d_tree.insert(MoveUtil::move(value));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const_iterator    hint,
+                                                    const value_type& value)
+{
+    return d_tree.insert(hint, value);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                       const_iterator                             hint,
+                       BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    return d_tree.insert(hint, MoveUtil::move(value));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                         INPUT_ITERATOR last)
+{
+    d_tree.insert(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(sorted_unique_t,
+                                                         INPUT_ITERATOR first,
+                                                         INPUT_ITERATOR last)
+{
+    d_tree.insert(sorted_unique, first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                      std::initializer_list<value_type> values)
+{
+    d_tree.insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    return d_tree.erase(position);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    return d_tree.erase(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                                   const_iterator last)
+{
+    return d_tree.erase(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::clear()
+{
+    d_tree.clear();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::reserve(size_type numEntries)
+{
+    d_tree.reserve(numEntries);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::shrink_to_fit()
+{
+    d_tree.shrinkToFit();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::swap(flat_map& other)
+{
+    d_tree.swap(other.d_tree);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin()
+{
+    return d_tree.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::end()
+{
+    return d_tree.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(const key_type& key)
+{
+    return d_tree.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(const key_type& key)
+{
+    return d_tree.lowerBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(const key_type& key)
+{
+    return d_tree.upperBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator,
+     typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(const key_type& key)
+{
+    const iterator first = d_tree.lowerBound(key);
+    const iterator last  = first != end() && !key_comp()(key, first->first)
+                           ? first + 1
+                           : first;
+
+    return pair<iterator, iterator>(first, last);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::allocator_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::get_allocator() const
+{
+    return d_tree.allocator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return d_tree.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::cbegin() const
+{
+    return d_tree.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::end() const
+{
+    return d_tree.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::cend() const
+{
+    return d_tree.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::crbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::crend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+const VALUE&
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::at(const key_type& key) const
+{
+    const_iterator iter = d_tree.find(key);
+    if (iter == end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                            "flat_map<...>::at(key_type): invalid key value");
+    }
+    return iter->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::contains(
+                                                    const key_type& key) const
+{
+    return d_tree.contains(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::count(const key_type& key) const
+{
+    return d_tree.contains(key) ? 1 : 0;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(const key_type& key) const
+{
+    return d_tree.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(
+                                                    const key_type& key) const
+{
+    return d_tree.lowerBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(
+                                                    const key_type& key) const
+{
+    return d_tree.upperBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator,
+     typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(
+                                                    const key_type& key) const
+{
+    const const_iterator first = d_tree.lowerBound(key);
+    const const_iterator last  = first != end()
+                              && !key_comp()(key, first->first)
+                                 ? first + 1
+                                 : first;
+
+    return pair<const_iterator, const_iterator>(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_compare
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_tree.comparator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return value_compare(d_tree.comparator());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::empty() const
+{
+    return 0 == d_tree.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_tree.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::max_size() const
+{
+    return d_tree.maxSize();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::capacity() const
+{
+    return d_tree.capacity();
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+               bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for STL *ordered* containers:
+//: o An ordered container defines STL iterators.
+//: o An ordered container uses 'bslma' allocators if the (template parameter)
+//:   type 'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+//
+// In addition, a 'flat_map' is bitwise moveable if its comparator and
+// allocator are, since its key-value pairs are held out of line.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct HasStlIterators<bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close namespace bslma
+
+namespace bslmf {
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct IsBitwiseMoveable<bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::integral_constant<bool, IsBitwiseMoveable<COMPARATOR>::value
+                                && IsBitwiseMoveable<ALLOCATOR>::value>
+{};
+
+}  // close namespace bslmf
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1204 @@
+// bslstl_flatmap.t.cpp                                               -*-C++-*-
+#include <bslstl_flatmap.h>
+
+#include <bslstl_map.h>
+#include <bslstl_pair.h>
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_stdallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_stopwatch.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a map container, 'bsl::flat_map', implemented
+// by forwarding to 'bslstl::FlatTree' (tested thoroughly in its own
+// component).  We therefore concentrate on the forwarding of each method, on
+// the allocator used by each constructor and supplied to the keys and values,
+// on the map-specific methods ('operator[]' and 'at'), and on the agreement
+// of the observable behavior with that of 'bsl::map', which we use as an
+// oracle.  Test case -1 compares the performance of lookups with that of
+// 'bsl::map'.
+//
+// Global Concerns:
+//: o All memory is supplied by the allocator passed at construction.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_map();
+// [ 2] flat_map(const COMPARATOR&, const ALLOCATOR&);
+// [ 2] flat_map(const ALLOCATOR&);
+// [ 2] flat_map(const flat_map&);
+// [ 2] flat_map(MovableRef<flat_map>);
+// [ 2] flat_map(const flat_map&, const ALLOCATOR&);
+// [ 2] flat_map(MovableRef<flat_map>, const ALLOCATOR&);
+// [ 2] flat_map(ITER, ITER, const COMPARATOR&, const ALLOCATOR&);
+// [ 2] flat_map(ITER, ITER, const ALLOCATOR&);
+// [ 2] flat_map(sorted_unique_t, ITER, ITER, const COMP&, const ALLOC&);
+// [ 2] flat_map(sorted_unique_t, ITER, ITER, const ALLOCATOR&);
+// [ 2] flat_map(initializer_list<VT>, const COMP&, const ALLOCATOR&);
+// [ 2] flat_map(initializer_list<VT>, const ALLOCATOR&);
+// [ 2] ~flat_map();
+//
+// MANIPULATORS
+// [ 5] flat_map& operator=(const flat_map&);
+// [ 5] flat_map& operator=(MovableRef<flat_map>);
+// [ 5] flat_map& operator=(initializer_list<VT>);
+// [ 3] VALUE& operator[](const key_type&);
+// [ 3] VALUE& operator[](MovableRef<key_type>);
+// [ 3] VALUE& at(const key_type&);
+// [ 4] pair<iterator, bool> insert(const value_type&);
+// [ 4] pair<iterator, bool> insert(MovableRef<value_type>);
+// [ 4] iterator insert(const_iterator, const value_type&);
+// [ 4] iterator insert(const_iterator, MovableRef<value_type>);
+// [ 4] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 4] void insert(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 4] void insert(initializer_list<VT>);
+// [ 4] iterator erase(const_iterator);
+// [ 4] size_type erase(const key_type&);
+// [ 4] iterator erase(const_iterator, const_iterator);
+// [ 4] void clear();
+// [ 4] void reserve(size_type);
+// [ 4] void shrink_to_fit();
+// [ 5] void swap(flat_map&);
+// [ 4] iterator begin();
+// [ 4] iterator end();
+// [ 4] reverse_iterator rbegin();
+// [ 4] reverse_iterator rend();
+// [ 4] iterator find(const key_type&);
+// [ 4] iterator lower_bound(const key_type&);
+// [ 4] iterator upper_bound(const key_type&);
+// [ 4] pair<iterator, iterator> equal_range(const key_type&);
+//
+// ACCESSORS
+// [ 2] allocator_type get_allocator() const;
+// [ 4] const_iterator begin() const;
+// [ 4] const_iterator cbegin() const;
+// [ 4] const_iterator end() const;
+// [ 4] const_iterator cend() const;
+// [ 4] const_reverse_iterator rbegin() const;
+// [ 4] const_reverse_iterator crbegin() const;
+// [ 4] const_reverse_iterator rend() const;
+// [ 4] const_reverse_iterator crend() const;
+// [ 3] const VALUE& at(const key_type&) const;
+// [ 4] bool contains(const key_type&) const;
+// [ 4] size_type count(const key_type&) const;
+// [ 4] const_iterator find(const key_type&) const;
+// [ 4] const_iterator lower_bound(const key_type&) const;
+// [ 4] const_iterator upper_bound(const key_type&) const;
+// [ 4] pair<const_iterator, const_iterator> equal_range(const key_type&);
+// [ 2] key_compare key_comp() const;
+// [ 2] value_compare value_comp() const;
+// [ 2] bool empty() const;
+// [ 2] size_type size() const;
+// [ 2] size_type max_size() const;
+// [ 4] size_type capacity() const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const flat_map&, const flat_map&);
+// [ 5] bool operator!=(const flat_map&, const flat_map&);
+// [ 5] bool operator< (const flat_map&, const flat_map&);
+// [ 5] bool operator> (const flat_map&, const flat_map&);
+// [ 5] bool operator<=(const flat_map&, const flat_map&);
+// [ 5] bool operator>=(const flat_map&, const flat_map&);
+// [ 5] void swap(flat_map&, flat_map&);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [ 6] CONCERN: 'flat_map' has the expected type traits
+// [-1] PERFORMANCE COMPARISON WITH 'bsl::map'
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslmf::MovableRefUtil                 MoveUtil;
+
+typedef bsl::flat_map<int, int>               Obj;
+typedef bsl::map<int, int>                    Oracle;
+typedef bsl::pair<int, int>                   Pair;
+typedef bsl::flat_map<int, bsl::string>       StringObj;
+
+#define LONG_STRING "a string long enough to allocate from its allocator"
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+template <class OBJ, class ORACLE>
+bool matches(const OBJ& object, const ORACLE& oracle)
+    // Return 'true' if the specified 'object' holds the same sequence of
+    // key-value pairs as the specified 'oracle', and 'false' otherwise.
+{
+    if (object.size() != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+
+    typename OBJ::const_iterator    it = object.begin();
+    typename ORACLE::const_iterator jt = oracle.begin();
+    for (; jt != oracle.end(); ++it, ++jt) {
+        if (it->first != jt->first || it->second != jt->second) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+unsigned nextRandom(unsigned *state)
+    // Return the next value of the pseudo-random sequence having the
+    // specified 'state', and update 'state'.
+{
+    *state = *state * 1103515245u + 12345u;
+    return (*state >> 8) & 0xffffff;
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVerbose;
+    (void) veryVeryVerbose;
+    (void) veryVeryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Read-Mostly Lookup Table
+///- - - - - - - - - - - - - - - - - - -
+// Suppose we are writing a message router that maps each message type code
+// to the name of the queue that handles it.  The table is loaded once from
+// configuration and then consulted for every message, so a 'flat_map' is a
+// good fit.
+//
+// First, we load the routes, which arrive in no particular order, into a
+// vector:
+//..
+    typedef bsl::pair<int, bsl::string> Route;
+
+    bslma::TestAllocator oa("object", veryVeryVerbose);
+
+    bsl::vector<Route> config(&oa);
+    config.push_back(Route(300, "trades"));
+    config.push_back(Route(100, "quotes"));
+    config.push_back(Route(200, "orders"));
+    config.push_back(Route(150, "news"));
+//..
+// Then, we build the routing table in one step, which sorts the routes once
+// rather than shifting them on each insertion:
+//..
+    bsl::flat_map<int, bsl::string> routes(config.begin(), config.end(), &oa);
+
+    ASSERT(4 == routes.size());
+    ASSERT(100 == routes.begin()->first);
+//..
+// Now, we route a few messages:
+//..
+    ASSERT("orders" == routes.at(200));
+    ASSERT(routes.end() == routes.find(250));
+//..
+// Finally, we map a new message type to a default queue using 'operator[]':
+//..
+    routes[250] = "misc";
+
+    ASSERT(5 == routes.size());
+    ASSERT("misc" == routes.find(250)->second);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TYPE TRAITS
+        //
+        // Concerns:
+        //: 1 'flat_map' has STL iterators.
+        //:
+        //: 2 'flat_map' uses 'bslma' allocators exactly when 'ALLOCATOR' is
+        //:   convertible from 'bslma::Allocator *'.
+        //:
+        //: 3 'flat_map' is bitwise moveable when its comparator and allocator
+        //:   are, regardless of the key and value types.
+        //
+        // Plan:
+        //: 1 Check the traits for several instantiations.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: 'flat_map' has the expected type traits
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTYPE TRAITS"
+                            "\n===========\n");
+
+        typedef bsl::flat_map<int,
+                              int,
+                              std::less<int>,
+                              std::allocator<Pair> > StdAllocObj;
+
+        ASSERT( bslalg::HasStlIterators<Obj>::value);
+        ASSERT( bslalg::HasStlIterators<StringObj>::value);
+
+        ASSERT( bslma::UsesBslmaAllocator<Obj>::value);
+        ASSERT( bslma::UsesBslmaAllocator<StringObj>::value);
+        ASSERT(!bslma::UsesBslmaAllocator<StdAllocObj>::value);
+
+        ASSERT( bslmf::IsBitwiseMoveable<Obj>::value);
+        ASSERT( bslmf::IsBitwiseMoveable<StringObj>::value);
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // ASSIGNMENT, SWAP, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 The assignment operators give the target the value of the source
+        //:   and retain the target's allocator.
+        //:
+        //: 2 'swap' (member and free) exchanges the values without
+        //:   allocating.
+        //:
+        //: 3 The comparison operators agree with those of 'bsl::map', and
+        //:   take the mapped values into account.
+        //
+        // Plan:
+        //: 1 Assign and swap objects built from short arrays, and verify the
+        //:   results and allocators.  (C-1..2)
+        //:
+        //: 2 For each pair of a set of short sequences of pairs, compare the
+        //:   results of each operator with those of 'bsl::map'.  (C-3)
+        //
+        // Testing:
+        //   flat_map& operator=(const flat_map&);
+        //   flat_map& operator=(MovableRef<flat_map>);
+        //   flat_map& operator=(initializer_list<VT>);
+        //   void swap(flat_map&);
+        //   bool operator==(const flat_map&, const flat_map&);
+        //   bool operator!=(const flat_map&, const flat_map&);
+        //   bool operator< (const flat_map&, const flat_map&);
+        //   bool operator> (const flat_map&, const flat_map&);
+        //   bool operator<=(const flat_map&, const flat_map&);
+        //   bool operator>=(const flat_map&, const flat_map&);
+        //   void swap(flat_map&, flat_map&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nASSIGNMENT, SWAP, AND COMPARISON"
+                            "\n================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        const Pair DA[] = { Pair(4, 40), Pair(2, 20), Pair(9, 90) };
+        const Pair DB[] = { Pair(1, 10), Pair(7, 70) };
+
+        if (verbose) printf("\tAssignment.\n");
+        {
+            const Obj A(DA, DA + 3, &oa);
+
+            Obj mX(&za);  const Obj& X = mX;
+
+            mX = A;
+            ASSERT(A   == X);
+            ASSERT(&za == X.get_allocator());
+
+            Obj mS(DB, DB + 2, &za);
+
+            bslma::TestAllocatorMonitor zam(&za);
+
+            mX = MoveUtil::move(mS);
+            ASSERT(2   == X.size());
+            ASSERT(10  == X.begin()->second);
+            ASSERT(&za == X.get_allocator());
+            ASSERT(zam.isTotalSame());
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            mX = { Pair(5, 1), Pair(3, 2) };
+            ASSERT(2 == X.size());
+            ASSERT(3 == X.begin()->first);
+#endif
+        }
+
+        if (verbose) printf("\tSwap.\n");
+        {
+            Obj mX(DA, DA + 3, &oa);  const Obj& X = mX;
+            Obj mY(DB, DB + 2, &oa);  const Obj& Y = mY;
+
+            const Obj XX(X, &za);
+            const Obj YY(Y, &za);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            mX.swap(mY);
+            ASSERT(YY == X);
+            ASSERT(XX == Y);
+
+            swap(mX, mY);
+            ASSERT(XX == X);
+            ASSERT(YY == Y);
+
+            ASSERT(oam.isTotalSame());
+        }
+
+        if (verbose) printf("\tComparison.\n");
+        {
+            static const struct {
+                int         d_line;
+                const char *d_spec_p;  // key-value pairs as character pairs
+            } DATA[] = {
+                { L_, ""     },
+                { L_, "a1"   },
+                { L_, "a2"   },
+                { L_, "a1b1" },
+                { L_, "a1b2" },
+                { L_, "a2b1" },
+                { L_, "b1"   },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const char *const SI = DATA[ti].d_spec_p;
+
+                Obj    mX(&oa);  const Obj&    X  = mX;
+                Oracle mXO(&oa); const Oracle& XO = mXO;
+                for (const char *s = SI; *s; s += 2) {
+                    mX[s[0]]  = s[1];
+                    mXO[s[0]] = s[1];
+                }
+
+                for (int tj = 0; tj < NUM_DATA; ++tj) {
+                    const char *const SJ = DATA[tj].d_spec_p;
+
+                    Obj    mY(&oa);  const Obj&    Y  = mY;
+                    Oracle mYO(&oa); const Oracle& YO = mYO;
+                    for (const char *s = SJ; *s; s += 2) {
+                        mY[s[0]]  = s[1];
+                        mYO[s[0]] = s[1];
+                    }
+
+                    ASSERTV(ti, tj, (XO == YO) == (X == Y));
+                    ASSERTV(ti, tj, (XO != YO) == (X != Y));
+                    ASSERTV(ti, tj, (XO <  YO) == (X <  Y));
+                    ASSERTV(ti, tj, (XO >  YO) == (X >  Y));
+                    ASSERTV(ti, tj, (XO <= YO) == (X <= Y));
+                    ASSERTV(ti, tj, (XO >= YO) == (X >= Y));
+                }
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // MODIFIERS, LOOKUP, AND ITERATORS
+        //
+        // Concerns:
+        //: 1 Each 'insert' overload inserts a pair whose key is absent and
+        //:   leaves the map unchanged otherwise.
+        //:
+        //: 2 Each 'erase' overload removes the indicated pairs.
+        //:
+        //: 3 The lookup methods agree with those of 'bsl::map', and the
+        //:   non-'const' overloads provide modifiable access to the values.
+        //:
+        //: 4 The (reverse) iterators traverse the pairs in (reverse) order.
+        //:
+        //: 5 'clear', 'reserve', and 'shrink_to_fit' forward to the vector.
+        //
+        // Plan:
+        //: 1 Apply a sequence of operations to an object and to an oracle
+        //:   'bsl::map', and compare the results after each.  (C-1..4)
+        //:
+        //: 2 Check 'capacity' after 'clear', 'reserve', and 'shrink_to_fit'.
+        //:   (C-5)
+        //
+        // Testing:
+        //   pair<iterator, bool> insert(const value_type&);
+        //   pair<iterator, bool> insert(MovableRef<value_type>);
+        //   iterator insert(const_iterator, const value_type&);
+        //   iterator insert(const_iterator, MovableRef<value_type>);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(initializer_list<VT>);
+        //   iterator erase(const_iterator);
+        //   size_type erase(const key_type&);
+        //   iterator erase(const_iterator, const_iterator);
+        //   void clear();
+        //   void reserve(size_type);
+        //   void shrink_to_fit();
+        //   iterator begin();
+        //   iterator end();
+        //   reverse_iterator rbegin();
+        //   reverse_iterator rend();
+        //   iterator find(const key_type&);
+        //   iterator lower_bound(const key_type&);
+        //   iterator upper_bound(const key_type&);
+        //   pair<iterator, iterator> equal_range(const key_type&);
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   const_reverse_iterator crend() const;
+        //   bool contains(const key_type&) const;
+        //   size_type count(const key_type&) const;
+        //   const_iterator find(const key_type&) const;
+        //   const_iterator lower_bound(const key_type&) const;
+        //   const_iterator upper_bound(const key_type&) const;
+        //   pair<const_iterator, const_iterator> equal_range(const key_type&);
+        //   size_type capacity() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nMODIFIERS, LOOKUP, AND ITERATORS"
+                            "\n================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj    mX(&oa);      const Obj& X = mX;
+        Oracle oracle(&oa);
+
+        if (verbose) printf("\tInsertion.\n");
+        {
+            for (int i = 0; i < 40; ++i) {
+                const int key = (i * 7) % 23;
+                Pair      value(key, i);
+
+                const bool expInserted = oracle.insert(value).second;
+
+                switch (i % 4) {
+                  case 0: {
+                    ASSERTV(i, expInserted == mX.insert(value).second);
+                  } break;
+                  case 1: {
+                    ASSERTV(i, expInserted ==
+                                    mX.insert(MoveUtil::move(value)).second);
+                  } break;
+                  case 2: {
+                    Obj::iterator it = mX.insert(X.lower_bound(key), value);
+                    ASSERTV(i, key == it->first);
+                  } break;
+                  case 3: {
+                    Obj::iterator it = mX.insert(X.begin(),
+                                                 MoveUtil::move(value));
+                    ASSERTV(i, key == it->first);
+                  } break;
+                }
+                ASSERTV(i, matches(X, oracle));
+            }
+
+            const Pair UNSORTED[] = { Pair(50, 1), Pair(30, 2), Pair(40, 3),
+                                      Pair(30, 2), Pair(0, 5) };
+            mX.insert(UNSORTED, UNSORTED + 5);
+            oracle.insert(UNSORTED, UNSORTED + 5);
+            ASSERT(matches(X, oracle));
+
+            const Pair SORTED[] = { Pair(31, 1), Pair(32, 2), Pair(60, 3) };
+            mX.insert(bsl::sorted_unique, SORTED, SORTED + 3);
+            oracle.insert(SORTED, SORTED + 3);
+            ASSERT(matches(X, oracle));
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            mX.insert({ Pair(70, 7), Pair(1, 7) });
+            oracle.insert({ Pair(70, 7), Pair(1, 7) });
+            ASSERT(matches(X, oracle));
+#endif
+        }
+
+        if (verbose) printf("\tLookup.\n");
+        {
+            for (int key = -1; key <= 72; ++key) {
+                ASSERTV(key, oracle.count(key) == X.count(key));
+                ASSERTV(key, (0 != oracle.count(key)) == X.contains(key));
+
+                const Oracle& O = oracle;
+
+                const int findIndex  = static_cast<int>(
+                                 std::distance(O.begin(), O.find(key)));
+                const int lowerIndex = static_cast<int>(
+                                 std::distance(O.begin(), O.lower_bound(key)));
+                const int upperIndex = static_cast<int>(
+                                 std::distance(O.begin(), O.upper_bound(key)));
+
+                ASSERTV(key, findIndex  == X.find(key)         - X.begin());
+                ASSERTV(key, findIndex  == mX.find(key)        - mX.begin());
+                ASSERTV(key, lowerIndex == X.lower_bound(key)  - X.begin());
+                ASSERTV(key, lowerIndex == mX.lower_bound(key) - mX.begin());
+                ASSERTV(key, upperIndex == X.upper_bound(key)  - X.begin());
+                ASSERTV(key, upperIndex == mX.upper_bound(key) - mX.begin());
+
+                const bsl::pair<Obj::const_iterator, Obj::const_iterator> R =
+                                                           X.equal_range(key);
+                ASSERTV(key, lowerIndex == R.first  - X.begin());
+                ASSERTV(key, upperIndex == R.second - X.begin());
+
+                const bsl::pair<Obj::iterator, Obj::iterator> MR =
+                                                          mX.equal_range(key);
+                ASSERTV(key, lowerIndex == MR.first  - mX.begin());
+                ASSERTV(key, upperIndex == MR.second - mX.begin());
+            }
+
+            mX.find(70)->second = 77;
+            oracle.find(70)->second = 77;
+            ASSERT(matches(X, oracle));
+        }
+
+        if (verbose) printf("\tIterators.\n");
+        {
+            ASSERT(X.begin() == X.cbegin());
+            ASSERT(X.end()   == X.cend());
+            ASSERT(X.begin() == mX.begin());
+            ASSERT(X.end()   == mX.end());
+            ASSERT(X.rend()  == X.crend());
+
+            Oracle::const_reverse_iterator jt = oracle.rbegin();
+            for (Obj::const_reverse_iterator it = X.crbegin();
+                 it != X.crend();
+                 ++it, ++jt) {
+                ASSERT(it->first  == jt->first);
+                ASSERT(it->second == jt->second);
+            }
+            ASSERT(oracle.rend() == jt);
+
+            for (Obj::reverse_iterator it = mX.rbegin();
+                 it != mX.rend();
+                 ++it) {
+                ++it->second;
+            }
+            for (Oracle::iterator it = oracle.begin();
+                 it != oracle.end();
+                 ++it) {
+                ++it->second;
+            }
+            ASSERT(matches(X, oracle));
+            ASSERT(X.rbegin() == Obj::const_reverse_iterator(X.end()));
+        }
+
+        if (verbose) printf("\tErasure.\n");
+        {
+            for (int key = 0; key < 72; key += 3) {
+                ASSERTV(key, oracle.erase(key) == mX.erase(key));
+            }
+            ASSERT(matches(X, oracle));
+
+            Obj::iterator next = mX.erase(X.begin());
+            oracle.erase(oracle.begin());
+            ASSERT(next == X.begin());
+            ASSERT(matches(X, oracle));
+
+            next = mX.erase(X.lower_bound(10), X.lower_bound(40));
+            oracle.erase(oracle.lower_bound(10), oracle.lower_bound(40));
+            ASSERT(next->first == oracle.lower_bound(10)->first);
+            ASSERT(matches(X, oracle));
+        }
+
+        if (verbose) printf("\tCapacity.\n");
+        {
+            const Obj::size_type capacity = X.capacity();
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(capacity == X.capacity());
+
+            mX.shrink_to_fit();
+            ASSERT(0 == X.capacity());
+
+            mX.reserve(10);
+            ASSERT(10 <= X.capacity());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ELEMENT ACCESS
+        //
+        // Concerns:
+        //: 1 'operator[]' returns the value mapped to a present key, and
+        //:   otherwise inserts a default-constructed value at the key's sorted
+        //:   position and returns it.
+        //:
+        //: 2 A value inserted by 'operator[]' uses the object allocator, and
+        //:   no memory comes from the default allocator.
+        //:
+        //: 3 'at' returns the value mapped to a present key, and otherwise
+        //:   throws 'std::out_of_range' without modifying the map.
+        //
+        // Plan:
+        //: 1 Apply 'operator[]' (both overloads) to a map and an oracle
+        //:   'bsl::map' for a sequence of keys, and compare.  (C-1)
+        //:
+        //: 2 Use a map of 'bsl::string' values and check the allocator of
+        //:   each value, and the default allocator.  (C-2)
+        //:
+        //: 3 Call 'at' ('const' and not) for present and absent keys.  (C-3)
+        //
+        // Testing:
+        //   VALUE& operator[](const key_type&);
+        //   VALUE& operator[](MovableRef<key_type>);
+        //   VALUE& at(const key_type&);
+        //   const VALUE& at(const key_type&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nELEMENT ACCESS"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tOperator[].\n");
+        {
+            Obj    mX(&oa);  const Obj& X = mX;
+            Oracle oracle(&oa);
+
+            for (int i = 0; i < 60; ++i) {
+                int key = (i * 11) % 37;
+
+                if (i % 2) {
+                    mX[key] += i;
+                }
+                else {
+                    mX[MoveUtil::move(key)] += i;
+                }
+                oracle[key] += i;
+
+                ASSERTV(i, matches(X, oracle));
+            }
+        }
+
+        if (verbose) printf("\tAllocator of mapped values.\n");
+        {
+            StringObj mX(&oa);  const StringObj& X = mX;
+
+            mX[5] = LONG_STRING;
+            mX[3];
+            mX[9].append(LONG_STRING);
+            mX[5].append("!");
+
+            ASSERT(3 == X.size());
+            for (StringObj::const_iterator it = X.begin(); it != X.end();
+                                                                        ++it) {
+                ASSERTV(it->first, &oa == it->second.get_allocator());
+            }
+            ASSERT(X.at(3).empty());
+            ASSERT(LONG_STRING "!" == X.at(5));
+        }
+
+        if (verbose) printf("\tAt.\n");
+        {
+            const Pair DATA[] = { Pair(1, 10), Pair(3, 30) };
+
+            Obj mX(DATA, DATA + 2, &oa);  const Obj& X = mX;
+
+            ASSERT(10 == X.at(1));
+            mX.at(3) = 33;
+            ASSERT(33 == X.at(3));
+
+#if defined(BDE_BUILD_TARGET_EXC)
+            bool caught = false;
+            try {
+                mX.at(2);
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            caught = false;
+            try {
+                X.at(4);
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(2 == X.size());
+#endif
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates an object having the expected value,
+        //:   comparator, and allocator.
+        //:
+        //: 2 The range constructors sort the range once and keep one pair for
+        //:   each key.
+        //:
+        //: 3 The object allocator is supplied to keys and values that use
+        //:   'bslma' allocators.
+        //:
+        //: 4 Move construction with the same allocator does not allocate.
+        //
+        // Plan:
+        //: 1 Construct objects with each constructor, supplying an allocator
+        //:   where possible, and verify the value, 'key_comp', 'value_comp',
+        //:   and 'get_allocator'.  (C-1..2, 4)
+        //:
+        //: 2 Construct a map of 'bsl::string' values from a range and check
+        //:   the allocator of each value.  (C-3)
+        //:
+        //: 3 Construct maps from large pseudo-random ranges having many
+        //:   duplicate keys, and compare with an oracle 'bsl::map' built from
+        //:   the same range with the keys retained.  (C-2)
+        //
+        // Testing:
+        //   flat_map();
+        //   flat_map(const COMPARATOR&, const ALLOCATOR&);
+        //   flat_map(const ALLOCATOR&);
+        //   flat_map(const flat_map&);
+        //   flat_map(MovableRef<flat_map>);
+        //   flat_map(const flat_map&, const ALLOCATOR&);
+        //   flat_map(MovableRef<flat_map>, const ALLOCATOR&);
+        //   flat_map(ITER, ITER, const COMPARATOR&, const ALLOCATOR&);
+        //   flat_map(ITER, ITER, const ALLOCATOR&);
+        //   flat_map(sorted_unique_t, ITER, ITER, const COMP&, const ALLOC&);
+        //   flat_map(sorted_unique_t, ITER, ITER, const ALLOCATOR&);
+        //   flat_map(initializer_list<VT>, const COMP&, const ALLOCATOR&);
+        //   flat_map(initializer_list<VT>, const ALLOCATOR&);
+        //   ~flat_map();
+        //   allocator_type get_allocator() const;
+        //   key_compare key_comp() const;
+        //   value_compare value_comp() const;
+        //   bool empty() const;
+        //   size_type size() const;
+        //   size_type max_size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONSTRUCTORS AND BASIC ACCESSORS"
+                            "\n================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        const Pair DATA[]   = { Pair(5, 50), Pair(1, 10), Pair(4, 40),
+                                Pair(1, 10), Pair(3, 30), Pair(2, 20) };
+        const Pair SORTED[] = { Pair(1, 10), Pair(2, 20), Pair(3, 30),
+                                Pair(4, 40), Pair(5, 50) };
+        const Oracle EXP(SORTED, SORTED + 5, &oa);
+
+        typedef bsl::flat_map<int, int, std::greater<int> > ReverseObj;
+
+        if (verbose) printf("\tEmpty objects.\n");
+        {
+            {
+                const Obj X;
+                ASSERT(X.empty());
+                ASSERT(0 == X.size());
+                ASSERT(0 <  X.max_size());
+                ASSERT(&defaultAllocator == X.get_allocator());
+            }
+            {
+                const Obj X(&oa);
+                ASSERT(X.empty());
+                ASSERT(&oa == X.get_allocator());
+            }
+            {
+                const ReverseObj X(std::greater<int>(), &oa);
+                ASSERT(X.empty());
+                ASSERT(&oa == X.get_allocator());
+                ASSERT(X.key_comp()(2, 1));
+                ASSERT(X.value_comp()(Pair(2, 0), Pair(1, 9)));
+                ASSERT(!X.value_comp()(Pair(1, 9), Pair(2, 0)));
+            }
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+        }
+
+        if (verbose) printf("\tRange constructors.\n");
+        {
+            {
+                const Obj X(DATA, DATA + 6, &oa);
+                ASSERT(matches(X, EXP));
+                ASSERT(&oa == X.get_allocator());
+            }
+            {
+                const Obj X(DATA, DATA + 6, std::less<int>(), &oa);
+                ASSERT(matches(X, EXP));
+            }
+            {
+                const ReverseObj X(DATA, DATA + 6, std::greater<int>(), &oa);
+                ASSERT(5 == X.size());
+                ASSERT(5 == X.begin()->first);
+                ASSERT(1 == X.rbegin()->first);
+            }
+            {
+                const Obj X(bsl::sorted_unique, SORTED, SORTED + 5, &oa);
+                ASSERT(matches(X, EXP));
+                ASSERT(&oa == X.get_allocator());
+            }
+            {
+                const Obj X(bsl::sorted_unique,
+                            SORTED,
+                            SORTED + 5,
+                            std::less<int>(),
+                            &oa);
+                ASSERT(matches(X, EXP));
+            }
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            {
+                const Obj X({ Pair(2, 20), Pair(1, 10), Pair(2, 20) }, &oa);
+                ASSERT(2 == X.size());
+                ASSERT(&oa == X.get_allocator());
+            }
+            {
+                const Obj X({ Pair(2, 20), Pair(1, 10) },
+                            std::less<int>(),
+                            &oa);
+                ASSERT(2 == X.size());
+            }
+#endif
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+        }
+
+        if (verbose) printf("\tAllocator of keys and values.\n");
+        {
+            bsl::vector<bsl::pair<int, bsl::string> > input(&za);
+            for (int i = 0; i < 10; ++i) {
+                input.push_back(bsl::pair<int, bsl::string>((i * 3) % 7,
+                                                            LONG_STRING));
+            }
+
+            const StringObj X(input.begin(), input.end(), &oa);
+            ASSERT(7 == X.size());
+            for (StringObj::const_iterator it = X.begin(); it != X.end();
+                                                                        ++it) {
+                ASSERTV(it->first, &oa == it->second.get_allocator());
+            }
+        }
+
+        if (verbose) printf("\tLarge unsorted ranges.\n");
+        {
+            unsigned state = 99;
+
+            for (int length = 0; length < 2000; length = length * 2 + 1) {
+                bsl::vector<Pair> input(&oa);
+                for (int i = 0; i < length; ++i) {
+                    const int key = static_cast<int>(
+                                        nextRandom(&state) % (length / 2 + 1));
+                    input.push_back(Pair(key, key * 2));
+                }
+
+                const Obj    X(input.begin(), input.end(), &oa);
+                const Oracle XO(input.begin(), input.end(), &oa);
+
+                ASSERTV(length, matches(X, XO));
+            }
+        }
+
+        if (verbose) printf("\tCopy and move constructors.\n");
+        {
+            Obj mW(DATA, DATA + 6, &oa);  const Obj& W = mW;
+
+            {
+                const Obj X(W);
+                ASSERT(W == X);
+                ASSERT(&defaultAllocator == X.get_allocator());
+            }
+            {
+                const Obj X(W, &za);
+                ASSERT(W == X);
+                ASSERT(&za == X.get_allocator());
+            }
+            {
+                Obj mS(W, &oa);
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                Obj mX(MoveUtil::move(mS));  const Obj& X = mX;
+                ASSERT(W == X);
+                ASSERT(&oa == X.get_allocator());
+                ASSERT(oam.isTotalSame());
+
+                const Obj Y(MoveUtil::move(mX), &oa);
+                ASSERT(W == Y);
+                ASSERT(oam.isTotalSame());
+            }
+            {
+                Obj mS(W, &oa);
+
+                const Obj X(MoveUtil::move(mS), &za);
+                ASSERT(W == X);
+                ASSERT(&za == X.get_allocator());
+            }
+        }
+        ASSERT(0 == za.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a map, insert pairs singly, as a range, and with
+        //:   'operator[]', look them up, copy the map, and erase the pairs.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        ASSERT(X.empty());
+        ASSERT( mX.insert(Pair(10, 1)).second);
+        ASSERT(!mX.insert(Pair(10, 2)).second);
+        ASSERT(1 == X.at(10));
+
+        const Pair DATA[] = { Pair(30, 3), Pair(20, 2), Pair(20, 4) };
+        mX.insert(DATA, DATA + 3);
+        ASSERT(3 == X.size());
+        ASSERT(10 == X.begin()->first);
+
+        mX[5] = 5;
+        ASSERT(4 == X.size());
+        ASSERT(5 == X.begin()->second);
+
+        ASSERT(X.contains(20));
+        ASSERT(X.end() == X.find(15));
+        ASSERT(20 == X.lower_bound(15)->first);
+
+        Obj mY(X, &oa);  const Obj& Y = mY;
+        ASSERT(X == Y);
+
+        mY[30] = 0;
+        ASSERT(X != Y);
+        ASSERT(Y < X);
+
+        ASSERT(1 == mX.erase(20));
+        ASSERT(3 == X.size());
+
+        mX.clear();
+        ASSERT(X.empty());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE COMPARISON WITH 'bsl::map'
+        //   Compare the time taken by 'bsl::flat_map' and 'bsl::map' to be
+        //   built from an unsorted range and to look up keys.  Command line
+        //   parameters:
+        //   2nd parameter: number of keys (defaults to 1000).
+        //   3rd parameter: number of repetitions (defaults to 1000).
+        //
+        // Concerns:
+        //: 1 Report the average time to build each map from an unsorted
+        //:   range, and to look up present and absent keys.
+        //
+        // Plan:
+        //: 1 Generate pseudo-random keys, and time each operation on each
+        //:   map type using 'bsls::Stopwatch'.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE COMPARISON WITH 'bsl::map'
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE COMPARISON WITH 'bsl::map'"
+               "\n======================================\n");
+
+        const int numKeys        = argc > 2 ? atoi(argv[2]) : 1000;
+        const int numRepetitions = argc > 3 ? atoi(argv[3]) : 1000;
+
+        printf("numKeys = %d, numRepetitions = %d\n",
+               numKeys,
+               numRepetitions);
+
+        bsl::vector<Pair> input;
+        bsl::vector<int>  present;
+        bsl::vector<int>  absent;
+
+        unsigned state = 1;
+        for (int i = 0; i < numKeys; ++i) {
+            const int key = static_cast<int>(nextRandom(&state)) * 2;
+            input.push_back(Pair(key, i));
+            present.push_back(key);
+            absent.push_back(key + 1);
+        }
+
+        bsls::Stopwatch timer;
+        long            checksum = 0;
+
+        timer.start();
+        for (int r = 0; r < numRepetitions; ++r) {
+            const Obj X(input.begin(), input.end());
+            checksum += static_cast<long>(X.size());
+        }
+        timer.stop();
+        const double flatBuild = timer.elapsedTime() / numRepetitions;
+
+        timer.reset();
+        timer.start();
+        for (int r = 0; r < numRepetitions; ++r) {
+            const Oracle X(input.begin(), input.end());
+            checksum += static_cast<long>(X.size());
+        }
+        timer.stop();
+        const double mapBuild = timer.elapsedTime() / numRepetitions;
+
+        const Obj    FLAT(input.begin(), input.end());
+        const Oracle MAP(input.begin(), input.end());
+
+        double flatHit, flatMiss, mapHit, mapMiss;
+
+#define TIME_LOOKUPS(RESULT, OBJECT, KEYS)                                    \
+        timer.reset();                                                        \
+        timer.start();                                                        \
+        for (int r = 0; r < numRepetitions; ++r) {                            \
+            for (int k = 0; k < static_cast<int>(KEYS.size()); ++k) {         \
+                checksum += OBJECT.count(KEYS[k]);                            \
+            }                                                                 \
+        }                                                                     \
+        timer.stop();                                                         \
+        RESULT = timer.elapsedTime() / numRepetitions / KEYS.size();
+
+        TIME_LOOKUPS(flatHit,  FLAT, present);
+        TIME_LOOKUPS(flatMiss, FLAT, absent);
+        TIME_LOOKUPS(mapHit,   MAP,  present);
+        TIME_LOOKUPS(mapMiss,  MAP,  absent);
+
+#undef TIME_LOOKUPS
+
+        printf("%-24s %14s %14s\n", "", "flat_map", "map");
+        printf("%-24s %12.3fus %12.3fus\n",
+               "build (per map)",
+               flatBuild * 1e6,
+               mapBuild * 1e6);
+        printf("%-24s %12.2fns %12.2fns\n",
+               "find, present (per key)",
+               flatHit * 1e9,
+               mapHit * 1e9);
+        printf("%-24s %12.2fns %12.2fns\n",
+               "find, absent (per key)",
+               flatMiss * 1e9,
+               mapMiss * 1e9);
+        printf("(checksum %ld)\n", checksum);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1225 @@
+// bslstl_flatset.h                                                   -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATSET
+#define INCLUDED_BSLSTL_FLATSET
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a set container implemented as a sorted vector.
+//
+//@CLASSES:
+//   bsl::flat_set: set of unique keys held in a sorted, contiguous sequence
+//
+//@SEE_ALSO: bslstl_flatmap, bslstl_set, bslstl_flattree
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::flat_set', implementing a container holding an ordered sequence of
+// unique keys, having the interface of 'bsl::set', in a 'bsl::vector' kept
+// sorted by key.  It follows the 'std::flat_set' of C++23 where that differs
+// from 'bsl::set'.
+//
+// An instantiation of 'flat_set' is an allocator-aware, value-semantic type
+// whose salient attributes are its size (number of keys) and the ordered
+// sequence of keys the 'flat_set' contains.  If 'flat_set' is instantiated
+// with a key type that is not itself value-semantic, then it will not retain
+// all of its value-semantic qualities.
+//
+///'flat_set' vs. 'set'
+///--------------------
+// A 'bsl::set' allocates a node for each key and links the nodes into a
+// red-black tree.  A 'flat_set' holds its keys in a single contiguous array,
+// so that a lookup is a binary search touching a few cache lines, iteration
+// is a linear scan, and the memory overhead per key is nil.  The price is
+// paid on modification: inserting or erasing a single key shifts the keys
+// that follow it, and so has linear complexity, and an insertion or erasure
+// invalidates all iterators and references into the container.  A 'flat_set'
+// is therefore best suited to small sets, and to sets built once (or in bulk)
+// and then searched often.
+//
+// Building a 'flat_set' from a range with the range constructor (or the range
+// 'insert' method) sorts the keys of the range once and discards duplicates,
+// which is 'O[N * log(N)]'; inserting the same 'N' keys one at a time is
+// 'O[N * N]'.  If the keys are known to be sorted and unique already, passing
+// the 'bsl::sorted_unique' tag avoids the sort.
+//
+// The 'iterator' and 'const_iterator' types of a 'flat_set' are the same
+// random-access iterator, providing non-modifiable access to the keys.
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a flat set's 'ALLOCATOR' template parameter determines
+// how that flat set will allocate memory, as for 'bsl::set'.  If 'ALLOCATOR'
+// is 'bsl::allocator' (the default), a 'flat_set' accepts an optional
+// 'bslma::Allocator' argument at construction, uses it to supply memory for
+// its array, and passes it to the constructors of keys having the
+// 'bslma::UsesBslmaAllocator' trait.
+//
+// A 'flat_set' holds its keys out of line, in memory obtained from its
+// allocator, and so is bitwise moveable (regardless of 'KEY') if its
+// comparator and allocator are bitwise moveable.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'flat_set':
+//..
+//  Legend
+//  ------
+//  'K'             - (template parameter) type 'KEY' of the flat set
+//  'a', 'b'        - two distinct objects of type 'flat_set<K>'
+//  'n', 'm'        - number of elements in 'a' and 'b' respectively
+//  'k'             - an object of type 'K'
+//  'i1', 'i2'      - two iterators defining a sequence of 'value_type' objects
+//  'N'             - distance(i1,i2)
+//
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | flat_set<K> a(i1, i2);                             | O[N * log(N)]      |
+//  +----------------------------------------------------+--------------------+
+//  | flat_set<K> a(sorted_unique, i1, i2);              | O[N]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(i1, i2)                                   | O[N * log(N) + n]  |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(sorted_unique, i1, i2)                    | O[N + n]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(k), a.erase(k)                            | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.find(k), a.count(k), a.contains(k),              | O[log(n)]          |
+//  | a.lower_bound(k), a.upper_bound(k),                |                    |
+//  | a.equal_range(k)                                   |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.swap(b), swap(a,b)                               | O[1] if 'a' and    |
+//  |                                                    | 'b' use the same   |
+//  |                                                    | allocator,         |
+//  |                                                    | O[n + m] otherwise |
+//  +----------------------------------------------------+--------------------+
+//..
+// The remaining operations have the complexity of the corresponding
+// operations of 'bsl::vector'.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Table of Reserved Words
+/// - - - - - - - - - - - - - - - - - -
+// Suppose a parser must classify identifiers as reserved words.  The set of
+// reserved words is fixed once the parser is configured, and is searched for
+// every identifier parsed, so a 'flat_set' is a good fit.
+//
+// First, we create the set in one step from an (unsorted) array of words,
+// which contains a duplicate:
+//..
+//  const char *const WORDS[] = { "while", "if", "else", "for", "if", "do" };
+//  const int         NUM_WORDS = sizeof WORDS / sizeof *WORDS;
+//
+//  bslma::TestAllocator oa("object", veryVeryVerbose);
+//
+//  bsl::flat_set<bsl::string> reserved(WORDS, WORDS + NUM_WORDS, &oa);
+//..
+// The words are sorted and the duplicate is discarded:
+//..
+//  assert(5 == reserved.size());
+//  assert("do"    == *reserved.begin());
+//  assert("while" == *(reserved.end() - 1));
+//..
+// Then, we classify a few identifiers:
+//..
+//  assert( reserved.contains("for"));
+//  assert(!reserved.contains("foreach"));
+//  assert( reserved.count("else"));
+//..
+// Finally, since keys are held contiguously, the set can be indexed like an
+// array:
+//..
+//  assert("else" == reserved.begin()[1]);
+//..
+
+// Prevent 'bslstl' headers from being included directly in 'BSL_OVERRIDES_STD'
+// mode.  Doing so is unsupported, and is likely to cause compilation errors.
+#if defined(BSL_OVERRIDES_STD) && !defined(BOS_STDHDRS_PROLOGUE_IN_EFFECT)
+#error "include <bsl_flat_set.h> instead of <bslstl_flatset.h> in \
+BSL_OVERRIDES_STD mode"
+#endif
+#include <bslscm_version.h>
+
+#include <bslstl_flattree.h>
+#include <bslstl_iterator.h>
+#include <bslstl_pair.h>
+
+#include <bslalg_rangecompare.h>
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bslma_allocatortraits.h>
+#include <bslma_stdallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+
+#include <functional>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+# include <initializer_list>
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                          // ========================
+                          // struct FlatSet_EntryUtil
+                          // ========================
+
+template <class KEY>
+struct FlatSet_EntryUtil {
+    // This 'struct' provides the key of an entry of a 'flat_set', which is
+    // the entry itself, as required by 'FlatTree'.
+
+    // CLASS METHODS
+    static const KEY& key(const KEY& entry);
+        // Return the specified 'entry'.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                              // ==============
+                              // class flat_set
+                              // ==============
+
+template <class KEY,
+          class COMPARATOR = std::less<KEY>,
+          class ALLOCATOR  = bsl::allocator<KEY> >
+class flat_set {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of unique keys (of the template parameter type
+    // 'KEY') in a sorted 'bsl::vector'.
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslstl::FlatTree<
+                                  KEY,
+                                  KEY,
+                                  BloombergLP::bslstl::FlatSet_EntryUtil<KEY>,
+                                  COMPARATOR,
+                                  ALLOCATOR>           Tree;
+        // This 'typedef' is an alias for the sorted vector holding the keys.
+
+    typedef bsl::allocator_traits<ALLOCATOR>           AllocatorTraits;
+        // This 'typedef' is an alias for the allocator traits type associated
+        // with this container.
+
+    typedef BloombergLP::bslmf::MovableRefUtil         MoveUtil;
+        // This 'typedef' is a convenient alias for the utility associated
+        // with movable references.
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef KEY                                        value_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef COMPARATOR                                 value_compare;
+    typedef ALLOCATOR                                  allocator_type;
+    typedef value_type&                                reference;
+    typedef const value_type&                          const_reference;
+
+    typedef typename AllocatorTraits::size_type        size_type;
+    typedef typename AllocatorTraits::difference_type  difference_type;
+    typedef typename AllocatorTraits::pointer          pointer;
+    typedef typename AllocatorTraits::const_pointer    const_pointer;
+
+    typedef typename Tree::const_iterator              iterator;
+    typedef typename Tree::const_iterator              const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+  private:
+    // DATA
+    Tree d_tree;  // sorted vector of keys, and comparator
+
+  public:
+    // CREATORS
+    flat_set();
+    explicit flat_set(const COMPARATOR& comparator,
+                      const ALLOCATOR&  basicAllocator = ALLOCATOR())
+        // Create an empty flat set.  Optionally specify a 'comparator' used
+        // to order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the type 'ALLOCATOR' is 'bsl::allocator'
+        // and 'basicAllocator' is not supplied, the currently installed
+        // default allocator is used.
+    : d_tree(comparator, basicAllocator)
+    {
+        // The implementation is placed here in the class definition to work
+        // around an AIX compiler bug (see 'bslstl_set').
+    }
+
+    explicit flat_set(const ALLOCATOR& basicAllocator);
+        // Create an empty flat set that uses the specified 'basicAllocator'
+        // to supply memory.  Use a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' to order the keys.
+
+    flat_set(const flat_set& original);
+        // Create a flat set having the same value as the specified 'original'
+        // object.  Use a copy of 'original.key_comp()' to order the keys
+        // contained in this flat set.  Use the allocator returned by
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // allocate memory.
+
+    flat_set(BloombergLP::bslmf::MovableRef<flat_set> original);    // IMPLICIT
+        // Create a flat set having the same value as the specified 'original'
+        // object by moving (in constant time) the contents of 'original' to
+        // the new flat set.  The allocator associated with 'original' is
+        // propagated for use in the new flat set.  'original' is left in a
+        // valid but unspecified state.
+
+    flat_set(const flat_set& original, const ALLOCATOR& basicAllocator);
+        // Create a flat set having the same value as the specified 'original'
+        // object that uses the specified 'basicAllocator' to supply memory.
+
+    flat_set(BloombergLP::bslmf::MovableRef<flat_set> original,
+             const ALLOCATOR&                         basicAllocator);
+        // Create a flat set having the same value as the specified 'original'
+        // object that uses the specified 'basicAllocator' to supply memory.
+        // The contents of 'original' are moved (in constant time) to the new
+        // flat set if 'basicAllocator == original.get_allocator()', and are
+        // move-inserted (in linear time) using 'basicAllocator' otherwise.
+        // 'original' is left in a valid but unspecified state.
+
+    template <class INPUT_ITERATOR>
+    flat_set(INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const COMPARATOR& comparator = COMPARATOR(),
+             const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    template <class INPUT_ITERATOR>
+    flat_set(INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const ALLOCATOR&  basicAllocator);
+        // Create a flat set holding the keys in the range starting at the
+        // specified 'first' element, and ending immediately before the
+        // specified 'last' element, sorting them (once) and keeping only one
+        // of each set of equivalent keys.  It is unspecified which of a set
+        // of equivalent keys is kept.  Optionally specify a 'comparator' used
+        // to order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  This operation has 'O[N * log(N)]'
+        // complexity, where 'N' is the number of elements in the range.  The
+        // behavior is undefined unless '[first .. last)' is a valid range.
+
+    template <class INPUT_ITERATOR>
+    flat_set(sorted_unique_t,
+             INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const COMPARATOR& comparator = COMPARATOR(),
+             const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    template <class INPUT_ITERATOR>
+    flat_set(sorted_unique_t,
+             INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const ALLOCATOR&  basicAllocator);
+        // Create a flat set holding the keys in the range starting at the
+        // specified 'first' element, and ending immediately before the
+        // specified 'last' element, in linear time.  Optionally specify a
+        // 'comparator' used to order keys contained in this object.  If
+        // 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied, a default-constructed object of the (template
+        // parameter) type 'ALLOCATOR' is used.  The behavior is undefined
+        // unless '[first .. last)' is a valid range that is sorted according
+        // to the comparator and has no equivalent keys.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_set(std::initializer_list<KEY> values,
+             const COMPARATOR&          comparator = COMPARATOR(),
+             const ALLOCATOR&           basicAllocator = ALLOCATOR());
+    flat_set(std::initializer_list<KEY> values,
+             const ALLOCATOR&           basicAllocator);
+        // Create a flat set holding the keys in the specified 'values'
+        // initializer list, keeping only one of each set of equivalent keys.
+        // Optionally specify a 'comparator' used to order keys contained in
+        // this object.  If 'comparator' is not supplied, a default-constructed
+        // object of the (template parameter) type 'COMPARATOR' is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is not supplied, a default-constructed object of
+        // the (template parameter) type 'ALLOCATOR' is used.
+#endif
+
+    ~flat_set();
+        // Destroy this object.
+
+    // MANIPULATORS
+    flat_set& operator=(const flat_set& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, propagate to this object the allocator of 'rhs' if
+        // the 'ALLOCATOR' type has trait
+        // 'propagate_on_container_copy_assignment', and return a reference
+        // providing modifiable access to this object.
+
+    flat_set& operator=(BloombergLP::bslmf::MovableRef<flat_set> rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, propagate to this object the allocator of 'rhs' if
+        // the 'ALLOCATOR' type has trait
+        // 'propagate_on_container_move_assignment', and return a reference
+        // providing modifiable access to this object.  The contents of 'rhs'
+        // are moved (in constant time) to this flat set if
+        // 'get_allocator() == rhs.get_allocator()' (after accounting for the
+        // aforementioned trait), and are move-inserted (in linear time)
+        // otherwise.  'rhs' is left in a valid but unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_set& operator=(std::initializer_list<KEY> values);
+        // Assign to this object the value resulting from first clearing this
+        // flat set and then inserting each key in the specified 'values'
+        // initializer list, keeping only one of each set of equivalent keys,
+        // and return a reference providing modifiable access to this object.
+#endif
+
+    pair<iterator, bool> insert(const value_type& value);
+    pair<iterator, bool> insert(
+                          BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' into this flat set if a key equivalent
+        // to 'value' does not already exist in this flat set; otherwise, if a
+        // key equivalent to 'value' already exists in this flat set, this
+        // method has no effect.  Return a pair whose 'first' member is an
+        // iterator referring to the (possibly newly inserted) key in this
+        // flat set that is equivalent to 'value', and whose 'second' member
+        // is 'true' if a new key was inserted, and 'false' if the key was
+        // already present.  Note that this operation shifts the keys ordered
+        // after 'value', and invalidates all iterators into this flat set.
+
+    iterator insert(const_iterator hint, const value_type& value);
+    iterator insert(const_iterator                             hint,
+                    BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' into this flat set (in amortized
+        // constant time, not counting the shift of subsequent keys, if the
+        // specified 'hint' is the position of 'value') if a key equivalent to
+        // 'value' does not already exist in this flat set.  Return an
+        // iterator referring to the (possibly newly inserted) key in this
+        // flat set that is equivalent to 'value'.  The behavior is undefined
+        // unless 'hint' is an iterator in the range '[begin() .. end()]'
+        // (both endpoints included).
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this flat set the keys in the range starting at the
+        // specified 'first' position, and ending immediately before the
+        // specified 'last' position, that are not equivalent to a key in this
+        // flat set, sorting the range once and merging it with the keys of
+        // this flat set.  It is unspecified which of a set of equivalent keys
+        // in the range is inserted.  The behavior is undefined unless
+        // '[first .. last)' is a valid range not referring into this flat
+        // set.
+
+    template <class INPUT_ITERATOR>
+    void insert(sorted_unique_t, INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this flat set the keys in the range starting at the
+        // specified 'first' position, and ending immediately before the
+        // specified 'last' position, that are not equivalent to a key in this
+        // flat set, merging the range with the keys of this flat set.  The
+        // behavior is undefined unless '[first .. last)' is a valid range,
+        // not referring into this flat set, that is sorted according to
+        // 'key_comp()' and has no equivalent keys.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(std::initializer_list<KEY> values);
+        // Insert into this flat set the keys in the specified 'values'
+        // initializer list that are not equivalent to a key in this flat set.
+#endif
+
+    iterator erase(const_iterator position);
+        // Remove from this flat set the key at the specified 'position', and
+        // return an iterator referring to the key immediately following the
+        // removed key, or 'end()' if the removed key was the last.  The
+        // behavior is undefined unless 'position' refers to a key in this
+        // flat set.
+
+    size_type erase(const key_type& key);
+        // Remove from this flat set the key equivalent to the specified
+        // 'key', if such a key exists, and return the number of keys removed
+        // (0 or 1).
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this flat set the keys starting at the specified
+        // 'first' position up to, but not including, the specified 'last'
+        // position, and return 'last'.  The behavior is undefined unless
+        // '[first .. last)' is a valid range of this flat set.
+
+    void clear();
+        // Remove all keys from this flat set.  Note that the capacity of this
+        // flat set is retained.
+
+    void reserve(size_type numKeys);
+        // Reserve memory sufficient for this flat set to hold the specified
+        // 'numKeys' without allocating.
+
+    void shrink_to_fit();
+        // Reduce the memory used by this flat set to that required by its
+        // keys, if possible.
+
+    void swap(flat_set& other);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object; also exchange the allocator of this
+        // object with that of 'other' if the (template parameter) type
+        // 'ALLOCATOR' has the 'propagate_on_container_swap' trait.  This
+        // method provides the no-throw exception-safety guarantee if the
+        // allocators are equal (or propagated) and the comparator does not
+        // throw on swap; otherwise, the keys are copied (in linear time).
+
+    // ACCESSORS
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // flat set.
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator providing non-modifiable access to the first key
+        // (the key ordered first) in this flat set, or 'end()' if this flat
+        // set is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return the past-the-end iterator of this flat set.
+
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last key in this flat set, or 'rend()' if this flat set is empty.
+
+    const_reverse_iterator rend() const;
+    const_reverse_iterator crend() const;
+        // Return the past-the-end reverse iterator of this flat set.
+
+    bool contains(const key_type& key) const;
+        // Return 'true' if this flat set contains a key equivalent to the
+        // specified 'key', and 'false' otherwise.
+
+    size_type count(const key_type& key) const;
+        // Return the number of keys in this flat set equivalent to the
+        // specified 'key' (0 or 1).
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator referring to the key in this flat set equivalent
+        // to the specified 'key', or 'end()' if there is no such key.
+
+    const_iterator lower_bound(const key_type& key) const;
+        // Return an iterator referring to the first key in this flat set that
+        // is not ordered before the specified 'key', or 'end()' if there is
+        // no such key.
+
+    const_iterator upper_bound(const key_type& key) const;
+        // Return an iterator referring to the first key in this flat set that
+        // is ordered after the specified 'key', or 'end()' if there is no
+        // such key.
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                   const key_type& key) const;
+        // Return a pair of iterators delimiting the (empty or one-element)
+        // sequence of keys in this flat set equivalent to the specified
+        // 'key'.
+
+    key_compare key_comp() const;
+        // Return the comparison functor used by this flat set to order keys.
+
+    value_compare value_comp() const;
+        // Return the comparison functor used by this flat set to order keys.
+        // Note that 'value_compare' and 'key_compare' are the same type.
+
+    bool empty() const;
+        // Return 'true' if this flat set contains no keys, and 'false'
+        // otherwise.
+
+    size_type size() const;
+        // Return the number of keys in this flat set.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the largest number of keys that
+        // this flat set could possibly hold.
+
+    size_type capacity() const;
+        // Return the number of keys this flat set can hold without
+        // allocating.
+};
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator==(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_set' objects have the same
+    // value if they have the same number of keys, and each key in 'lhs' is
+    // equal (using 'operator==') to the key at the same position in 'rhs'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator< (const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' flat set is
+    // lexicographically less than that of the specified 'rhs' flat set (see
+    // 'bsl::set'), and 'false' otherwise.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator> (const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' flat set is
+    // lexicographically greater than that of the specified 'rhs' flat set,
+    // and 'false' otherwise.  Note that this operator returns 'rhs < lhs'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' flat set is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // flat set, and 'false' otherwise.  Note that this operator returns
+    // '!(rhs < lhs)'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' flat set is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // flat set, and 'false' otherwise.  Note that this operator returns
+    // '!(lhs < rhs)'.
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void swap(flat_set<KEY, COMPARATOR, ALLOCATOR>& a,
+          flat_set<KEY, COMPARATOR, ALLOCATOR>& b);
+    // Exchange the value and comparator of the specified 'a' object with
+    // those of the specified 'b' object (see 'flat_set::swap').
+
+}  // close namespace bsl
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+namespace BloombergLP {
+namespace bslstl {
+
+                          // ------------------------
+                          // struct FlatSet_EntryUtil
+                          // ------------------------
+
+// CLASS METHODS
+template <class KEY>
+inline
+const KEY& FlatSet_EntryUtil<KEY>::key(const KEY& entry)
+{
+    return entry;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                              // --------------
+                              // class flat_set
+                              // --------------
+
+// CREATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set()
+: d_tree(COMPARATOR(), ALLOCATOR())
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                              const ALLOCATOR& basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(const flat_set& original)
+: d_tree(original.d_tree,
+         AllocatorTraits::select_on_container_copy_construction(
+                                                     original.get_allocator()))
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                            BloombergLP::bslmf::MovableRef<flat_set> original)
+: d_tree(MoveUtil::move(MoveUtil::access(original).d_tree))
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                              const flat_set&  original,
+                                              const ALLOCATOR& basicAllocator)
+: d_tree(original.d_tree, basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                     BloombergLP::bslmf::MovableRef<flat_set> original,
+                     const ALLOCATOR&                         basicAllocator)
+: d_tree(MoveUtil::move(MoveUtil::access(original).d_tree), basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                             INPUT_ITERATOR    first,
+                                             INPUT_ITERATOR    last,
+                                             const COMPARATOR& comparator,
+                                             const ALLOCATOR&  basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+    d_tree.insert(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                             INPUT_ITERATOR    first,
+                                             INPUT_ITERATOR    last,
+                                             const ALLOCATOR&  basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+    d_tree.insert(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                             sorted_unique_t,
+                                             INPUT_ITERATOR    first,
+                                             INPUT_ITERATOR    last,
+                                             const COMPARATOR& comparator,
+                                             const ALLOCATOR&  basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+    d_tree.insert(sorted_unique, first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                             sorted_unique_t,
+                                             INPUT_ITERATOR    first,
+                                             INPUT_ITERATOR    last,
+                                             const ALLOCATOR&  basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+    d_tree.insert(sorted_unique, first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                   std::initializer_list<KEY> values,
+                                   const COMPARATOR&          comparator,
+                                   const ALLOCATOR&           basicAllocator)
+: d_tree(comparator, basicAllocator)
+{
+    d_tree.insert(values.begin(), values.end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                   std::initializer_list<KEY> values,
+                                   const ALLOCATOR&           basicAllocator)
+: d_tree(COMPARATOR(), basicAllocator)
+{
+    d_tree.insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::~flat_set()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>&
+flat_set<KEY, COMPARATOR, ALLOCATOR>::operator=(const flat_set& rhs)
+{
+    d_tree = rhs.d_tree;
+    return *this;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>&
+flat_set<KEY, COMPARATOR, ALLOCATOR>::operator=(
+                                 BloombergLP::bslmf::MovableRef<flat_set> rhs)
+{
+    d_tree = MoveUtil::move(MoveUtil::access(rhs).d_tree);
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>&
+flat_set<KEY, COMPARATOR, ALLOCATOR>::operator=(
+                                             std::initializer_list<KEY> values)
+{
+    d_tree.clear();
+    d_tree.insert(values.begin(), values.end());
+    return *this;
+}
+#endif
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator, bool>
+flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
+{
+    return pair<iterator, bool>(d_tree.insert(value));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator, bool>
+flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(
+                              BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    return pair<iterator, bool>(d_tree.insert(MoveUtil::move(value)));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(const_iterator    hint,
+                                             const value_type& value)
+{
+    return d_tree.insert(hint, value);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(
+                       const_iterator                             hint,
+                       BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    return d_tree.insert(hint, MoveUtil::move(value));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                  INPUT_ITERATOR last)
+{
+    d_tree.insert(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(sorted_unique_t,
+                                                  INPUT_ITERATOR  first,
+                                                  INPUT_ITERATOR  last)
+{
+    d_tree.insert(sorted_unique, first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(
+                                             std::initializer_list<KEY> values)
+{
+    d_tree.insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    return d_tree.erase(position);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    return d_tree.erase(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                            const_iterator last)
+{
+    return d_tree.erase(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::clear()
+{
+    d_tree.clear();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::reserve(size_type numKeys)
+{
+    d_tree.reserve(numKeys);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::shrink_to_fit()
+{
+    d_tree.shrinkToFit();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::swap(flat_set& other)
+{
+    d_tree.swap(other.d_tree);
+}
+
+// ACCESSORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::allocator_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::get_allocator() const
+{
+    return d_tree.allocator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return d_tree.begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::cbegin() const
+{
+    return d_tree.begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::end() const
+{
+    return d_tree.end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::cend() const
+{
+    return d_tree.end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::crbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::crend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_set<KEY, COMPARATOR, ALLOCATOR>::contains(const key_type& key) const
+{
+    return d_tree.contains(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::count(const key_type& key) const
+{
+    return d_tree.contains(key) ? 1 : 0;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::find(const key_type& key) const
+{
+    return d_tree.find(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::lower_bound(const key_type& key) const
+{
+    return d_tree.lowerBound(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::upper_bound(const key_type& key) const
+{
+    return d_tree.upperBound(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator,
+     typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator>
+flat_set<KEY, COMPARATOR, ALLOCATOR>::equal_range(const key_type& key) const
+{
+    const const_iterator first = d_tree.lowerBound(key);
+    const const_iterator last  = first != end() && !key_comp()(key, *first)
+                                 ? first + 1
+                                 : first;
+
+    return pair<const_iterator, const_iterator>(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::key_compare
+flat_set<KEY, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_tree.comparator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::value_compare
+flat_set<KEY, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return d_tree.comparator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_set<KEY, COMPARATOR, ALLOCATOR>::empty() const
+{
+    return 0 == d_tree.size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_tree.size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::max_size() const
+{
+    return d_tree.maxSize();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::capacity() const
+{
+    return d_tree.capacity();
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                    const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                    const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& a,
+               bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for STL *ordered* containers:
+//: o An ordered container defines STL iterators.
+//: o An ordered container uses 'bslma' allocators if the (template parameter)
+//:   type 'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+//
+// In addition, a 'flat_set' is bitwise moveable if its comparator and
+// allocator are, since its keys are held out of line.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+struct HasStlIterators<bsl::flat_set<KEY, COMPARATOR, ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::flat_set<KEY, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close namespace bslma
+
+namespace bslmf {
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+struct IsBitwiseMoveable<bsl::flat_set<KEY, COMPARATOR, ALLOCATOR> >
+    : bsl::integral_constant<bool, IsBitwiseMoveable<COMPARATOR>::value
+                                && IsBitwiseMoveable<ALLOCATOR>::value>
+{};
+
+}  // close namespace bslmf
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,843 @@
+// bslstl_flatset.t.cpp                                               -*-C++-*-
+#include <bslstl_flatset.h>
+
+#include <bslstl_set.h>
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_stdallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_compilerfeatures.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a set container, 'bsl::flat_set', implemented
+// by forwarding to 'bslstl::FlatTree' (tested thoroughly in its own
+// component).  We therefore concentrate on the forwarding of each method, on
+// the allocator used by each constructor, and on the agreement of the
+// observable behavior with that of 'bsl::set', which we use as an oracle.
+//
+// Global Concerns:
+//: o All memory is supplied by the allocator passed at construction.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_set();
+// [ 2] flat_set(const COMPARATOR&, const ALLOCATOR&);
+// [ 2] flat_set(const ALLOCATOR&);
+// [ 2] flat_set(const flat_set&);
+// [ 2] flat_set(MovableRef<flat_set>);
+// [ 2] flat_set(const flat_set&, const ALLOCATOR&);
+// [ 2] flat_set(MovableRef<flat_set>, const ALLOCATOR&);
+// [ 2] flat_set(ITER, ITER, const COMPARATOR&, const ALLOCATOR&);
+// [ 2] flat_set(ITER, ITER, const ALLOCATOR&);
+// [ 2] flat_set(sorted_unique_t, ITER, ITER, const COMP&, const ALLOC&);
+// [ 2] flat_set(sorted_unique_t, ITER, ITER, const ALLOCATOR&);
+// [ 2] flat_set(initializer_list<KEY>, const COMP&, const ALLOCATOR&);
+// [ 2] flat_set(initializer_list<KEY>, const ALLOCATOR&);
+// [ 2] ~flat_set();
+//
+// MANIPULATORS
+// [ 4] flat_set& operator=(const flat_set&);
+// [ 4] flat_set& operator=(MovableRef<flat_set>);
+// [ 4] flat_set& operator=(initializer_list<KEY>);
+// [ 3] pair<iterator, bool> insert(const value_type&);
+// [ 3] pair<iterator, bool> insert(MovableRef<value_type>);
+// [ 3] iterator insert(const_iterator, const value_type&);
+// [ 3] iterator insert(const_iterator, MovableRef<value_type>);
+// [ 3] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] void insert(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] void insert(initializer_list<KEY>);
+// [ 3] iterator erase(const_iterator);
+// [ 3] size_type erase(const key_type&);
+// [ 3] iterator erase(const_iterator, const_iterator);
+// [ 3] void clear();
+// [ 3] void reserve(size_type);
+// [ 3] void shrink_to_fit();
+// [ 4] void swap(flat_set&);
+//
+// ACCESSORS
+// [ 2] allocator_type get_allocator() const;
+// [ 3] const_iterator begin() const;
+// [ 3] const_iterator cbegin() const;
+// [ 3] const_iterator end() const;
+// [ 3] const_iterator cend() const;
+// [ 3] const_reverse_iterator rbegin() const;
+// [ 3] const_reverse_iterator crbegin() const;
+// [ 3] const_reverse_iterator rend() const;
+// [ 3] const_reverse_iterator crend() const;
+// [ 3] bool contains(const key_type&) const;
+// [ 3] size_type count(const key_type&) const;
+// [ 3] const_iterator find(const key_type&) const;
+// [ 3] const_iterator lower_bound(const key_type&) const;
+// [ 3] const_iterator upper_bound(const key_type&) const;
+// [ 3] pair<const_iterator, const_iterator> equal_range(const key_type&);
+// [ 2] key_compare key_comp() const;
+// [ 2] value_compare value_comp() const;
+// [ 2] bool empty() const;
+// [ 2] size_type size() const;
+// [ 2] size_type max_size() const;
+// [ 3] size_type capacity() const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const flat_set&, const flat_set&);
+// [ 4] bool operator!=(const flat_set&, const flat_set&);
+// [ 4] bool operator< (const flat_set&, const flat_set&);
+// [ 4] bool operator> (const flat_set&, const flat_set&);
+// [ 4] bool operator<=(const flat_set&, const flat_set&);
+// [ 4] bool operator>=(const flat_set&, const flat_set&);
+// [ 4] void swap(flat_set&, flat_set&);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [ 5] CONCERN: 'flat_set' has the expected type traits
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslmf::MovableRefUtil    MoveUtil;
+
+typedef bsl::flat_set<int>       Obj;
+typedef bsl::set<int>            Oracle;
+typedef bsl::flat_set<bsl::string> StringObj;
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+template <class OBJ, class ORACLE>
+bool matches(const OBJ& object, const ORACLE& oracle)
+    // Return 'true' if the specified 'object' holds the same sequence of keys
+    // as the specified 'oracle', and 'false' otherwise.
+{
+    return object.size() == oracle.size()
+        && std::equal(oracle.begin(), oracle.end(), object.begin());
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVerbose;
+    (void) veryVeryVerbose;
+    (void) veryVeryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Table of Reserved Words
+/// - - - - - - - - - - - - - - - - - -
+// Suppose a parser must classify identifiers as reserved words.  The set of
+// reserved words is fixed once the parser is configured, and is searched for
+// every identifier parsed, so a 'flat_set' is a good fit.
+//
+// First, we create the set in one step from an (unsorted) array of words,
+// which contains a duplicate:
+//..
+    const char *const WORDS[] = { "while", "if", "else", "for", "if", "do" };
+    const int         NUM_WORDS = sizeof WORDS / sizeof *WORDS;
+
+    bslma::TestAllocator oa("object", veryVeryVerbose);
+
+    bsl::flat_set<bsl::string> reserved(WORDS, WORDS + NUM_WORDS, &oa);
+//..
+// The words are sorted and the duplicate is discarded:
+//..
+    ASSERT(5 == reserved.size());
+    ASSERT("do"    == *reserved.begin());
+    ASSERT("while" == *(reserved.end() - 1));
+//..
+// Then, we classify a few identifiers:
+//..
+    ASSERT( reserved.contains("for"));
+    ASSERT(!reserved.contains("foreach"));
+    ASSERT( reserved.count("else"));
+//..
+// Finally, since keys are held contiguously, the set can be indexed like an
+// array:
+//..
+    ASSERT("else" == reserved.begin()[1]);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TYPE TRAITS
+        //
+        // Concerns:
+        //: 1 'flat_set' has STL iterators.
+        //:
+        //: 2 'flat_set' uses 'bslma' allocators exactly when 'ALLOCATOR' is
+        //:   convertible from 'bslma::Allocator *'.
+        //:
+        //: 3 'flat_set' is bitwise moveable when its comparator and allocator
+        //:   are, regardless of the key type.
+        //
+        // Plan:
+        //: 1 Check the traits for several instantiations.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: 'flat_set' has the expected type traits
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTYPE TRAITS"
+                            "\n===========\n");
+
+        typedef bsl::flat_set<int, std::less<int>, std::allocator<int> >
+                                                                   StdAllocObj;
+
+        ASSERT( bslalg::HasStlIterators<Obj>::value);
+        ASSERT( bslalg::HasStlIterators<StringObj>::value);
+
+        ASSERT( bslma::UsesBslmaAllocator<Obj>::value);
+        ASSERT( bslma::UsesBslmaAllocator<StringObj>::value);
+        ASSERT(!bslma::UsesBslmaAllocator<StdAllocObj>::value);
+
+        ASSERT( bslmf::IsBitwiseMoveable<Obj>::value);
+        ASSERT( bslmf::IsBitwiseMoveable<StringObj>::value);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ASSIGNMENT, SWAP, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 The assignment operators give the target the value of the source
+        //:   and retain the target's allocator.
+        //:
+        //: 2 'swap' (member and free) exchanges the values.
+        //:
+        //: 3 The comparison operators agree with those of 'bsl::set'.
+        //
+        // Plan:
+        //: 1 Assign and swap objects built from short arrays, and verify the
+        //:   results and allocators.  (C-1..2)
+        //:
+        //: 2 For each pair of a set of short key sequences, compare the
+        //:   results of each operator with those of 'bsl::set'.  (C-3)
+        //
+        // Testing:
+        //   flat_set& operator=(const flat_set&);
+        //   flat_set& operator=(MovableRef<flat_set>);
+        //   flat_set& operator=(initializer_list<KEY>);
+        //   void swap(flat_set&);
+        //   bool operator==(const flat_set&, const flat_set&);
+        //   bool operator!=(const flat_set&, const flat_set&);
+        //   bool operator< (const flat_set&, const flat_set&);
+        //   bool operator> (const flat_set&, const flat_set&);
+        //   bool operator<=(const flat_set&, const flat_set&);
+        //   bool operator>=(const flat_set&, const flat_set&);
+        //   void swap(flat_set&, flat_set&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nASSIGNMENT, SWAP, AND COMPARISON"
+                            "\n================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        const int DA[] = { 4, 2, 9 };
+        const int DB[] = { 1, 7 };
+
+        if (verbose) printf("\tAssignment.\n");
+        {
+            const Obj A(DA, DA + 3, &oa);
+
+            Obj mX(&za);  const Obj& X = mX;
+
+            mX = A;
+            ASSERT(A   == X);
+            ASSERT(&za == X.get_allocator());
+
+            Obj mS(DB, DB + 2, &za);
+
+            bslma::TestAllocatorMonitor zam(&za);
+
+            mX = MoveUtil::move(mS);
+            ASSERT(2   == X.size());
+            ASSERT(1   == *X.begin());
+            ASSERT(&za == X.get_allocator());
+            ASSERT(zam.isTotalSame());
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            mX = { 5, 3, 5 };
+            ASSERT(2 == X.size());
+            ASSERT(3 == *X.begin());
+#endif
+        }
+
+        if (verbose) printf("\tSwap.\n");
+        {
+            Obj mX(DA, DA + 3, &oa);  const Obj& X = mX;
+            Obj mY(DB, DB + 2, &oa);  const Obj& Y = mY;
+
+            const Obj XX(X, &za);
+            const Obj YY(Y, &za);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            mX.swap(mY);
+            ASSERT(YY == X);
+            ASSERT(XX == Y);
+
+            swap(mX, mY);
+            ASSERT(XX == X);
+            ASSERT(YY == Y);
+
+            ASSERT(oam.isTotalSame());
+        }
+
+        if (verbose) printf("\tComparison.\n");
+        {
+            static const struct {
+                int         d_line;
+                const char *d_keys_p;
+            } DATA[] = {
+                { L_, ""    },
+                { L_, "a"   },
+                { L_, "ab"  },
+                { L_, "abc" },
+                { L_, "ac"  },
+                { L_, "b"   },
+                { L_, "bc"  },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const char *const KI = DATA[ti].d_keys_p;
+
+                const bsl::flat_set<char> X(KI, KI + strlen(KI), &oa);
+                const bsl::set<char>      XO(KI, KI + strlen(KI), &oa);
+
+                for (int tj = 0; tj < NUM_DATA; ++tj) {
+                    const char *const KJ = DATA[tj].d_keys_p;
+
+                    const bsl::flat_set<char> Y(KJ, KJ + strlen(KJ), &oa);
+                    const bsl::set<char>      YO(KJ, KJ + strlen(KJ), &oa);
+
+                    ASSERTV(ti, tj, (XO == YO) == (X == Y));
+                    ASSERTV(ti, tj, (XO != YO) == (X != Y));
+                    ASSERTV(ti, tj, (XO <  YO) == (X <  Y));
+                    ASSERTV(ti, tj, (XO >  YO) == (X >  Y));
+                    ASSERTV(ti, tj, (XO <= YO) == (X <= Y));
+                    ASSERTV(ti, tj, (XO >= YO) == (X >= Y));
+                }
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // MODIFIERS, LOOKUP, AND ITERATORS
+        //
+        // Concerns:
+        //: 1 Each 'insert' overload inserts a key that is absent and leaves
+        //:   the set unchanged otherwise.
+        //:
+        //: 2 Each 'erase' overload removes the indicated keys.
+        //:
+        //: 3 The lookup methods agree with those of 'bsl::set'.
+        //:
+        //: 4 The (reverse) iterators traverse the keys in (reverse) order.
+        //:
+        //: 5 'clear', 'reserve', and 'shrink_to_fit' forward to the vector.
+        //
+        // Plan:
+        //: 1 Apply a sequence of operations to an object and to an oracle
+        //:   'bsl::set', and compare the results after each.  (C-1..4)
+        //:
+        //: 2 Check 'capacity' after 'clear', 'reserve', and 'shrink_to_fit'.
+        //:   (C-5)
+        //
+        // Testing:
+        //   pair<iterator, bool> insert(const value_type&);
+        //   pair<iterator, bool> insert(MovableRef<value_type>);
+        //   iterator insert(const_iterator, const value_type&);
+        //   iterator insert(const_iterator, MovableRef<value_type>);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(initializer_list<KEY>);
+        //   iterator erase(const_iterator);
+        //   size_type erase(const key_type&);
+        //   iterator erase(const_iterator, const_iterator);
+        //   void clear();
+        //   void reserve(size_type);
+        //   void shrink_to_fit();
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   const_reverse_iterator crend() const;
+        //   bool contains(const key_type&) const;
+        //   size_type count(const key_type&) const;
+        //   const_iterator find(const key_type&) const;
+        //   const_iterator lower_bound(const key_type&) const;
+        //   const_iterator upper_bound(const key_type&) const;
+        //   pair<const_iterator, const_iterator> equal_range(const key_type&);
+        //   size_type capacity() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nMODIFIERS, LOOKUP, AND ITERATORS"
+                            "\n================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj    mX(&oa);      const Obj& X = mX;
+        Oracle oracle(&oa);
+
+        if (verbose) printf("\tInsertion.\n");
+        {
+            for (int i = 0; i < 40; ++i) {
+                int key = (i * 7) % 23;
+
+                const bool expInserted = oracle.insert(key).second;
+
+                switch (i % 4) {
+                  case 0: {
+                    ASSERTV(i, expInserted == mX.insert(key).second);
+                  } break;
+                  case 1: {
+                    ASSERTV(i, expInserted ==
+                                      mX.insert(MoveUtil::move(key)).second);
+                  } break;
+                  case 2: {
+                    ASSERTV(i, key == *mX.insert(X.lower_bound(key), key));
+                  } break;
+                  case 3: {
+                    ASSERTV(i, key == *mX.insert(X.begin(),
+                                                 MoveUtil::move(key)));
+                  } break;
+                }
+                ASSERTV(i, matches(X, oracle));
+            }
+
+            const int UNSORTED[] = { 50, 30, 40, 30, 0 };
+            mX.insert(UNSORTED, UNSORTED + 5);
+            oracle.insert(UNSORTED, UNSORTED + 5);
+            ASSERT(matches(X, oracle));
+
+            const int SORTED[] = { 31, 32, 60 };
+            mX.insert(bsl::sorted_unique, SORTED, SORTED + 3);
+            oracle.insert(SORTED, SORTED + 3);
+            ASSERT(matches(X, oracle));
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            mX.insert({ 70, 1, 70 });
+            oracle.insert({ 70, 1, 70 });
+            ASSERT(matches(X, oracle));
+#endif
+        }
+
+        if (verbose) printf("\tLookup.\n");
+        {
+            for (int key = -1; key <= 72; ++key) {
+                ASSERTV(key, oracle.count(key) == X.count(key));
+                ASSERTV(key, (0 != oracle.count(key)) == X.contains(key));
+                ASSERTV(key,
+                        std::distance(oracle.begin(), oracle.find(key)) ==
+                                             std::distance(X.begin(),
+                                                           X.find(key)));
+                ASSERTV(key,
+                        std::distance(oracle.begin(),
+                                      oracle.lower_bound(key)) ==
+                                    std::distance(X.begin(),
+                                                  X.lower_bound(key)));
+                ASSERTV(key,
+                        std::distance(oracle.begin(),
+                                      oracle.upper_bound(key)) ==
+                                    std::distance(X.begin(),
+                                                  X.upper_bound(key)));
+
+                const bsl::pair<Obj::const_iterator, Obj::const_iterator> R =
+                                                           X.equal_range(key);
+                ASSERTV(key, R.first  == X.lower_bound(key));
+                ASSERTV(key, R.second == X.upper_bound(key));
+            }
+        }
+
+        if (verbose) printf("\tIterators.\n");
+        {
+            ASSERT(X.begin() == X.cbegin());
+            ASSERT(X.end()   == X.cend());
+            ASSERT(std::equal(oracle.rbegin(), oracle.rend(), X.rbegin()));
+            ASSERT(std::equal(oracle.crbegin(), oracle.crend(), X.crbegin()));
+            ASSERT(X.rend()  == X.crend());
+            ASSERT(static_cast<int>(X.size()) == X.end() - X.begin());
+        }
+
+        if (verbose) printf("\tErasure.\n");
+        {
+            for (int key = 0; key < 72; key += 3) {
+                ASSERTV(key, oracle.erase(key) == mX.erase(key));
+            }
+            ASSERT(matches(X, oracle));
+
+            Obj::iterator next = mX.erase(X.begin());
+            oracle.erase(oracle.begin());
+            ASSERT(next == X.begin());
+            ASSERT(matches(X, oracle));
+
+            next = mX.erase(X.lower_bound(10), X.lower_bound(40));
+            oracle.erase(oracle.lower_bound(10), oracle.lower_bound(40));
+            ASSERT(*next == *oracle.lower_bound(10));
+            ASSERT(matches(X, oracle));
+        }
+
+        if (verbose) printf("\tCapacity.\n");
+        {
+            const Obj::size_type capacity = X.capacity();
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(capacity == X.capacity());
+
+            mX.shrink_to_fit();
+            ASSERT(0 == X.capacity());
+
+            mX.reserve(10);
+            ASSERT(10 <= X.capacity());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates an object having the expected value,
+        //:   comparator, and allocator.
+        //:
+        //: 2 The range constructors sort the range and discard duplicates.
+        //:
+        //: 3 Move construction with the same allocator does not allocate.
+        //:
+        //: 4 No memory is allocated from the default allocator unless it is
+        //:   the object allocator.
+        //
+        // Plan:
+        //: 1 Construct objects with each constructor, supplying an allocator
+        //:   where possible, and verify the value, 'key_comp', 'value_comp',
+        //:   and 'get_allocator'.  (C-1..3)
+        //:
+        //: 2 Verify the default allocator is used only by the constructors
+        //:   not supplied an allocator.  (C-4)
+        //
+        // Testing:
+        //   flat_set();
+        //   flat_set(const COMPARATOR&, const ALLOCATOR&);
+        //   flat_set(const ALLOCATOR&);
+        //   flat_set(const flat_set&);
+        //   flat_set(MovableRef<flat_set>);
+        //   flat_set(const flat_set&, const ALLOCATOR&);
+        //   flat_set(MovableRef<flat_set>, const ALLOCATOR&);
+        //   flat_set(ITER, ITER, const COMPARATOR&, const ALLOCATOR&);
+        //   flat_set(ITER, ITER, const ALLOCATOR&);
+        //   flat_set(sorted_unique_t, ITER, ITER, const COMP&, const ALLOC&);
+        //   flat_set(sorted_unique_t, ITER, ITER, const ALLOCATOR&);
+        //   flat_set(initializer_list<KEY>, const COMP&, const ALLOCATOR&);
+        //   flat_set(initializer_list<KEY>, const ALLOCATOR&);
+        //   ~flat_set();
+        //   allocator_type get_allocator() const;
+        //   key_compare key_comp() const;
+        //   value_compare value_comp() const;
+        //   bool empty() const;
+        //   size_type size() const;
+        //   size_type max_size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONSTRUCTORS AND BASIC ACCESSORS"
+                            "\n================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        const int DATA[]  = { 5, 1, 4, 1, 3, 5, 2 };
+        const int SORTED[] = { 1, 2, 3, 4, 5 };
+        const Oracle EXP(SORTED, SORTED + 5, &oa);
+
+        typedef bsl::flat_set<int, std::greater<int> > ReverseObj;
+
+        if (verbose) printf("\tEmpty objects.\n");
+        {
+            {
+                const Obj X;
+                ASSERT(X.empty());
+                ASSERT(0 == X.size());
+                ASSERT(0 <  X.max_size());
+                ASSERT(&defaultAllocator == X.get_allocator());
+            }
+            {
+                const Obj X(&oa);
+                ASSERT(X.empty());
+                ASSERT(&oa == X.get_allocator());
+            }
+            {
+                const ReverseObj X(std::greater<int>(), &oa);
+                ASSERT(X.empty());
+                ASSERT(&oa == X.get_allocator());
+                ASSERT(X.key_comp()(2, 1));
+                ASSERT(X.value_comp()(2, 1));
+            }
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+        }
+
+        if (verbose) printf("\tRange constructors.\n");
+        {
+            {
+                const Obj X(DATA, DATA + 7, &oa);
+                ASSERT(matches(X, EXP));
+                ASSERT(&oa == X.get_allocator());
+            }
+            {
+                const Obj X(DATA, DATA + 7, std::less<int>(), &oa);
+                ASSERT(matches(X, EXP));
+                ASSERT(&oa == X.get_allocator());
+            }
+            {
+                const ReverseObj X(DATA, DATA + 7, std::greater<int>(), &oa);
+                ASSERT(5 == X.size());
+                ASSERT(5 == *X.begin());
+                ASSERT(1 == *X.rbegin());
+            }
+            {
+                const Obj X(bsl::sorted_unique, SORTED, SORTED + 5, &oa);
+                ASSERT(matches(X, EXP));
+                ASSERT(&oa == X.get_allocator());
+            }
+            {
+                const Obj X(bsl::sorted_unique,
+                            SORTED,
+                            SORTED + 5,
+                            std::less<int>(),
+                            &oa);
+                ASSERT(matches(X, EXP));
+                ASSERT(&oa == X.get_allocator());
+            }
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            {
+                const Obj X({ 5, 1, 4, 1, 3, 5, 2 }, &oa);
+                ASSERT(matches(X, EXP));
+                ASSERT(&oa == X.get_allocator());
+            }
+            {
+                const Obj X({ 5, 1, 4, 1, 3, 5, 2 }, std::less<int>(), &oa);
+                ASSERT(matches(X, EXP));
+                ASSERT(&oa == X.get_allocator());
+            }
+#endif
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+        }
+
+        if (verbose) printf("\tCopy and move constructors.\n");
+        {
+            Obj mW(DATA, DATA + 7, &oa);  const Obj& W = mW;
+
+            {
+                const Obj X(W);
+                ASSERT(W == X);
+                ASSERT(&defaultAllocator == X.get_allocator());
+            }
+            {
+                const Obj X(W, &za);
+                ASSERT(W == X);
+                ASSERT(&za == X.get_allocator());
+            }
+            {
+                Obj mS(W, &oa);
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                Obj mX(MoveUtil::move(mS));  const Obj& X = mX;
+                ASSERT(W == X);
+                ASSERT(&oa == X.get_allocator());
+                ASSERT(oam.isTotalSame());
+
+                const Obj Y(MoveUtil::move(mX), &oa);
+                ASSERT(W == Y);
+                ASSERT(oam.isTotalSame());
+            }
+            {
+                Obj mS(W, &oa);
+
+                const Obj X(MoveUtil::move(mS), &za);
+                ASSERT(W == X);
+                ASSERT(&za == X.get_allocator());
+            }
+        }
+        ASSERT(0 == za.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a set, insert keys singly and as a range, look them up,
+        //:   copy the set, and erase the keys.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        ASSERT(X.empty());
+        ASSERT( mX.insert(10).second);
+        ASSERT(!mX.insert(10).second);
+
+        const int DATA[] = { 30, 20, 20, 5 };
+        mX.insert(DATA, DATA + 4);
+        ASSERT(4 == X.size());
+        ASSERT(5 == *X.begin());
+
+        ASSERT(X.contains(20));
+        ASSERT(X.end() == X.find(15));
+        ASSERT(20 == *X.lower_bound(15));
+
+        Obj mY(X, &oa);  const Obj& Y = mY;
+        ASSERT(X == Y);
+
+        ASSERT(1 == mY.erase(20));
+        ASSERT(X != Y);
+        ASSERT(X < Y);
+
+        mX.clear();
+        ASSERT(X.empty());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1251 @@
+// bslstl_flattree.h                                                  -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATTREE
+#define INCLUDED_BSLSTL_FLATTREE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a sorted-vector implementation of unique-key containers.
+//
+//@CLASSES:
+//  bslstl::FlatTree: sorted 'bsl::vector' of entries having unique keys
+//  bsl::sorted_unique_t: tag type for input known to be sorted and unique
+//
+//@SEE_ALSO: bslstl_flatmap, bslstl_flatset
+//
+//@DESCRIPTION: This component defines a class template, 'bslstl::FlatTree',
+// holding a sequence of entries, having unique keys, in a 'bsl::vector' kept
+// sorted by key, that is the implementation of the 'bsl::flat_map' and
+// 'bsl::flat_set' containers.  A lookup is a binary search over contiguous
+// storage, and a 'FlatTree' allocates no memory per entry; an insertion or
+// erasure of a single entry shifts the entries that follow it, and so has
+// linear complexity.  A 'FlatTree' is therefore suited to tables that are
+// built once (or rarely changed) and then searched often.
+//
+// The range insertion method appends the entries of the range to the vector,
+// sorts them (once), discards those whose keys are duplicated within the
+// range or present in the tree, and merges them with the existing entries, so
+// that building a tree of 'N' entries from unsorted input has
+// 'O[N * log(N)]' complexity rather than the 'O[N * N]' of 'N' individual
+// insertions.  An overload taking a 'bsl::sorted_unique_t' tag omits the
+// sort and the check for duplicates within the range, for input known to be
+// sorted and unique.
+//
+// This component is for use by the 'bslstl' package.  Other clients should
+// use 'bsl::flat_map' and 'bsl::flat_set' (by including 'bsl_flat_map.h' and
+// 'bsl_flat_set.h').
+//
+///Requirements on 'ENTRY_UTIL'
+///----------------------------
+// The (template parameter) type 'ENTRY_UTIL' must provide a static member
+// function that may be called as if it had the following signature:
+//..
+//  static const KEY& key(const ENTRY& entry);
+//      // Return the key of the specified 'entry'.
+//..
+// 'COMPARATOR' must be a functor, invocable on a 'const' object, that
+// defines a strict weak ordering of 'KEY' values.
+//
+///Exception Safety
+///----------------
+// The methods of 'FlatTree' provide the basic exception safety guarantee.
+// If an exception is thrown by the range insertion methods, the tree holds a
+// subset (possibly empty) of the entries it held beforehand.
+//
+///Usage
+///-----
+// This component is an implementation detail of 'bslstl' and is not intended
+// for direct client use.  It is subject to change without notice.  As such, a
+// usage example is not provided.
+
+// Prevent 'bslstl' headers from being included directly in 'BSL_OVERRIDES_STD'
+// mode.  Doing so is unsupported, and is likely to cause compilation errors.
+#if defined(BSL_OVERRIDES_STD) && !defined(BOS_STDHDRS_PROLOGUE_IN_EFFECT)
+#error "<bslstl_flattree.h> header can't be included directly in \
+BSL_OVERRIDES_STD mode"
+#endif
+#include <bslscm_version.h>
+
+#include <bslstl_pair.h>
+#include <bslstl_vector.h>
+
+#include <bslalg_swaputil.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_performancehint.h>
+
+#include <algorithm>
+
+namespace bsl {
+
+                           // =====================
+                           // struct sorted_unique_t
+                           // =====================
+
+struct sorted_unique_t {
+    // This tag type indicates, to the methods and constructors of the flat
+    // containers that take one, that the supplied input is sorted by the
+    // comparator of the container and has no equivalent keys.
+};
+
+static const sorted_unique_t sorted_unique = { };
+    // Value of type 'sorted_unique_t' used to select the overloads of the
+    // flat containers taking input known to be sorted and unique.
+
+}  // close namespace bsl
+
+namespace BloombergLP {
+namespace bslstl {
+
+                       // =============================
+                       // class FlatTree_EntryComparator
+                       // =============================
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+class FlatTree_EntryComparator {
+    // This class provides a functor comparing two 'ENTRY' objects by their
+    // keys, as required by 'std::sort'.
+
+    // DATA
+    const COMPARATOR *d_comparator_p;  // key comparator (held, not owned)
+
+  public:
+    // CREATORS
+    explicit FlatTree_EntryComparator(const COMPARATOR& comparator);
+        // Create an entry comparator using the specified 'comparator' to
+        // compare keys.
+
+    // ACCESSORS
+    bool operator()(const ENTRY& lhs, const ENTRY& rhs) const;
+        // Return 'true' if the key of the specified 'lhs' is ordered before
+        // the key of the specified 'rhs', and 'false' otherwise.
+};
+
+                       // =============================
+                       // class FlatTree_TruncateProctor
+                       // =============================
+
+template <class CONTAINER>
+class FlatTree_TruncateProctor {
+    // This class implements a proctor that, unless released, erases the
+    // entries of a container beyond a length on destruction.
+
+    // DATA
+    CONTAINER                     *d_container_p;  // managed container, or 0
+    typename CONTAINER::size_type  d_length;       // length to truncate to
+
+  private:
+    // NOT IMPLEMENTED
+    FlatTree_TruncateProctor(const FlatTree_TruncateProctor&);
+    FlatTree_TruncateProctor& operator=(const FlatTree_TruncateProctor&);
+
+  public:
+    // CREATORS
+    FlatTree_TruncateProctor(CONTAINER                     *container,
+                             typename CONTAINER::size_type  length);
+        // Create a proctor managing the specified 'container' that, on
+        // destruction, erases the entries of 'container' beyond the specified
+        // 'length'.
+
+    ~FlatTree_TruncateProctor();
+        // Destroy this proctor, erasing the entries of the managed container
+        // beyond the managed length, if any, unless this proctor has been
+        // released.
+
+    // MANIPULATORS
+    void release();
+        // Release the managed container from management by this proctor.
+
+    void setLength(typename CONTAINER::size_type length);
+        // Set the length to which the managed container is truncated on
+        // destruction to the specified 'length'.
+};
+
+                               // ==============
+                               // class FlatTree
+                               // ==============
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+class FlatTree {
+    // This class template implements a value-semantic container holding a
+    // sequence of 'ENTRY' objects having unique keys, kept sorted by key in
+    // a 'bsl::vector'.  The key of an entry is obtained by 'ENTRY_UTIL', and
+    // keys are ordered by 'COMPARATOR'.
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::vector<ENTRY, ALLOCATOR>           ContainerType;
+    typedef typename ContainerType::size_type       size_type;
+    typedef typename ContainerType::iterator        iterator;
+    typedef typename ContainerType::const_iterator  const_iterator;
+
+  private:
+    // PRIVATE TYPES
+    typedef FlatTree_EntryComparator<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>
+                                                    EntryComparator;
+
+    typedef FlatTree_TruncateProctor<ContainerType> TruncateProctor;
+
+    typedef BloombergLP::bslmf::MovableRefUtil      MoveUtil;
+
+    // DATA
+    ContainerType d_entries;     // entries, sorted by key
+    COMPARATOR    d_comparator;  // key comparator
+
+    // PRIVATE MANIPULATORS
+    void mergeSortedSuffix(size_type numOldEntries);
+        // Merge the entries at and beyond the specified 'numOldEntries'
+        // position, which must be sorted and unique, with the (sorted and
+        // unique) entries before that position, discarding each entry of the
+        // suffix whose key is that of an entry before the position.
+
+    // PRIVATE ACCESSORS
+    bool isEquivalent(const KEY& key, const ENTRY& entry) const;
+        // Return 'true' if the specified 'key' is equivalent to the key of the
+        // specified 'entry', given that the key of 'entry' is not ordered
+        // before 'key', and 'false' otherwise.
+
+    bool isSortedUnique(const_iterator first, const_iterator last) const;
+        // Return 'true' if the entries in the specified range
+        // '[first .. last)' are sorted by key and have no equivalent keys, and
+        // 'false' otherwise.
+
+    size_type lowerBoundIndex(const KEY& key) const;
+        // Return the index of the first entry whose key is not ordered before
+        // the specified 'key', or 'size()' if there is no such entry.
+
+    size_type upperBoundIndex(const KEY& key) const;
+        // Return the index of the first entry whose key is ordered after the
+        // specified 'key', or 'size()' if there is no such entry.
+
+  public:
+    // CREATORS
+    FlatTree(const COMPARATOR& comparator, const ALLOCATOR& basicAllocator);
+        // Create an empty tree that orders keys using a copy of the specified
+        // 'comparator', and uses the specified 'basicAllocator' to supply
+        // memory.
+
+    FlatTree(const FlatTree& original, const ALLOCATOR& basicAllocator);
+        // Create a tree having the same value and comparator as the specified
+        // 'original' tree that uses the specified 'basicAllocator' to supply
+        // memory.
+
+    FlatTree(bslmf::MovableRef<FlatTree> original);                 // IMPLICIT
+        // Create a tree having the same value, comparator, and allocator as
+        // the specified 'original' tree by moving (in constant time) the
+        // entries of 'original'.  'original' is left in a valid but
+        // unspecified state.
+
+    FlatTree(bslmf::MovableRef<FlatTree> original,
+             const ALLOCATOR&            basicAllocator);
+        // Create a tree having the same value and comparator as the specified
+        // 'original' tree that uses the specified 'basicAllocator' to supply
+        // memory.  The entries of 'original' are moved (in constant time) if
+        // 'basicAllocator == original.allocator()', and are move-inserted (in
+        // linear time) otherwise.  'original' is left in a valid but
+        // unspecified state.
+
+    // MANIPULATORS
+    FlatTree& operator=(const FlatTree& rhs);
+        // Assign to this tree the value and comparator of the specified 'rhs'
+        // tree, propagate the allocator of 'rhs' if the allocator traits so
+        // specify, and return a reference providing modifiable access to this
+        // tree.
+
+    FlatTree& operator=(bslmf::MovableRef<FlatTree> rhs);
+        // Assign to this tree the value and comparator of the specified 'rhs'
+        // tree, moving the entries of 'rhs' (in constant time) if the
+        // allocators are equal or the allocator traits specify propagation,
+        // and return a reference providing modifiable access to this tree.
+        // 'rhs' is left in a valid but unspecified state.
+
+    void clear();
+        // Remove all entries from this tree.  Note that the capacity is
+        // retained.
+
+    template <class ARG1, class ARG2>
+    iterator emplaceAt(const_iterator                          position,
+                       BSLS_COMPILERFEATURES_FORWARD_REF(ARG1) arg1,
+                       BSLS_COMPILERFEATURES_FORWARD_REF(ARG2) arg2);
+        // Insert into this tree, at the specified 'position', an entry
+        // constructed from the specified 'arg1' and 'arg2', and return an
+        // iterator to the inserted entry.  The behavior is undefined unless
+        // the key of the entry is absent from this tree and 'position' is
+        // 'lower_bound' of that key.
+
+    iterator erase(const_iterator position);
+        // Remove the entry at the specified 'position' from this tree, and
+        // return an iterator to the entry that followed it.  The behavior is
+        // undefined unless 'position' refers to an entry of this tree.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove the entries in the specified range '[first .. last)' from
+        // this tree, and return 'last' (as an 'iterator').  The behavior is
+        // undefined unless '[first .. last)' is a valid range of this tree.
+
+    size_type erase(const KEY& key);
+        // Remove the entry having the specified 'key' from this tree, if
+        // any, and return the number of entries removed (0 or 1).
+
+    bsl::pair<iterator, bool> insert(const ENTRY& entry);
+    bsl::pair<iterator, bool> insert(bslmf::MovableRef<ENTRY> entry);
+        // Insert the specified 'entry' into this tree if its key is absent.
+        // Return a pair whose 'first' member is an iterator to the entry in
+        // this tree having the key of 'entry', and whose 'second' member is
+        // 'true' if 'entry' was inserted, and 'false' otherwise.
+
+    iterator insert(const_iterator hint, const ENTRY& entry);
+    iterator insert(const_iterator hint, bslmf::MovableRef<ENTRY> entry);
+        // Insert the specified 'entry' into this tree if its key is absent,
+        // using the specified 'hint' as the position of 'entry' if it is
+        // correct, and return an iterator to the entry in this tree having
+        // the key of 'entry'.  Note that the search for the position is
+        // avoided if 'hint' is 'lower_bound' of the key.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this tree each entry of the specified range
+        // '[first .. last)' whose key is absent from this tree, sorting the
+        // range once and merging it with the existing entries.  If entries of
+        // the range have equivalent keys, it is unspecified which of them is
+        // inserted.
+
+    template <class INPUT_ITERATOR>
+    void insert(bsl::sorted_unique_t,
+                INPUT_ITERATOR       first,
+                INPUT_ITERATOR       last);
+        // Insert into this tree each entry of the specified range
+        // '[first .. last)' whose key is absent from this tree, merging the
+        // range with the existing entries.  The behavior is undefined unless
+        // the range is sorted by key and has no equivalent keys.
+
+    void reserve(size_type numEntries);
+        // Reserve memory sufficient for this tree to hold the specified
+        // 'numEntries' without allocating.
+
+    void shrinkToFit();
+        // Reduce the memory used by this tree to that required by its
+        // entries, if possible.
+
+    void swap(FlatTree& other);
+        // Exchange the value and comparator of this tree with those of the
+        // specified 'other' tree, and the allocators if the allocator traits
+        // so specify.
+
+    iterator begin();
+        // Return an iterator to the first entry of this tree, or 'end()' if
+        // this tree is empty.
+
+    iterator end();
+        // Return the past-the-end iterator of this tree.
+
+    iterator find(const KEY& key);
+        // Return an iterator to the entry having the specified 'key', or
+        // 'end()' if there is no such entry.
+
+    iterator lowerBound(const KEY& key);
+        // Return an iterator to the first entry whose key is not ordered
+        // before the specified 'key', or 'end()' if there is no such entry.
+
+    iterator upperBound(const KEY& key);
+        // Return an iterator to the first entry whose key is ordered after
+        // the specified 'key', or 'end()' if there is no such entry.
+
+    // ACCESSORS
+    ALLOCATOR allocator() const;
+        // Return a copy of the allocator used by this tree to supply memory.
+
+    const_iterator begin() const;
+        // Return an iterator to the first entry of this tree, or 'end()' if
+        // this tree is empty.
+
+    size_type capacity() const;
+        // Return the number of entries this tree can hold without
+        // allocating.
+
+    const COMPARATOR& comparator() const;
+        // Return a reference providing non-modifiable access to the key
+        // comparator of this tree.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this tree holds an entry having the specified
+        // 'key', and 'false' otherwise.
+
+    const ContainerType& entries() const;
+        // Return a reference providing non-modifiable access to the sorted
+        // entries of this tree.
+
+    const_iterator end() const;
+        // Return the past-the-end iterator of this tree.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator to the entry having the specified 'key', or
+        // 'end()' if there is no such entry.
+
+    const_iterator lowerBound(const KEY& key) const;
+        // Return an iterator to the first entry whose key is not ordered
+        // before the specified 'key', or 'end()' if there is no such entry.
+
+    size_type maxSize() const;
+        // Return the theoretical maximum number of entries of this tree.
+
+    size_type size() const;
+        // Return the number of entries in this tree.
+
+    const_iterator upperBound(const KEY& key) const;
+        // Return an iterator to the first entry whose key is ordered after
+        // the specified 'key', or 'end()' if there is no such entry.
+};
+
+// ============================================================================
+//                          INLINE DEFINITIONS
+// ============================================================================
+
+                       // -----------------------------
+                       // class FlatTree_EntryComparator
+                       // -----------------------------
+
+// CREATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+FlatTree_EntryComparator<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::
+                    FlatTree_EntryComparator(const COMPARATOR& comparator)
+: d_comparator_p(&comparator)
+{
+}
+
+// ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bool FlatTree_EntryComparator<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::operator()(
+                                                  const ENTRY& lhs,
+                                                  const ENTRY& rhs) const
+{
+    return (*d_comparator_p)(ENTRY_UTIL::key(lhs), ENTRY_UTIL::key(rhs));
+}
+
+                       // -----------------------------
+                       // class FlatTree_TruncateProctor
+                       // -----------------------------
+
+// CREATORS
+template <class CONTAINER>
+inline
+FlatTree_TruncateProctor<CONTAINER>::FlatTree_TruncateProctor(
+                                     CONTAINER                     *container,
+                                     typename CONTAINER::size_type  length)
+: d_container_p(container)
+, d_length(length)
+{
+}
+
+template <class CONTAINER>
+inline
+FlatTree_TruncateProctor<CONTAINER>::~FlatTree_TruncateProctor()
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_container_p)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        if (d_length < d_container_p->size()) {
+            d_container_p->erase(d_container_p->begin() + d_length,
+                                 d_container_p->end());
+        }
+    }
+}
+
+// MANIPULATORS
+template <class CONTAINER>
+inline
+void FlatTree_TruncateProctor<CONTAINER>::release()
+{
+    d_container_p = 0;
+}
+
+template <class CONTAINER>
+inline
+void FlatTree_TruncateProctor<CONTAINER>::setLength(
+                                          typename CONTAINER::size_type length)
+{
+    d_length = length;
+}
+
+                               // --------------
+                               // class FlatTree
+                               // --------------
+
+// PRIVATE MANIPULATORS
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+void FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::
+                                   mergeSortedSuffix(size_type numOldEntries)
+{
+    BSLS_ASSERT_SAFE(numOldEntries <= d_entries.size());
+
+    const size_type numEntries = d_entries.size();
+
+    if (numOldEntries == numEntries) {
+        return;                                                       // RETURN
+    }
+
+    if (0 == numOldEntries
+     || d_comparator(ENTRY_UTIL::key(d_entries[numOldEntries - 1]),
+                     ENTRY_UTIL::key(d_entries[numOldEntries]))) {
+        // The suffix follows the existing entries: no merge is needed.
+
+        return;                                                       // RETURN
+    }
+
+    // If an exception is thrown once entries have been moved, no entry of
+    // 'd_entries' can be relied upon, so clear the tree.
+
+    TruncateProctor proctor(&d_entries, 0);
+
+    ContainerType merged(d_entries.get_allocator());
+    merged.reserve(numEntries);
+
+    iterator       oldIt  = d_entries.begin();
+    iterator       newIt  = oldIt + numOldEntries;
+    const iterator oldEnd = newIt;
+    const iterator newEnd = d_entries.end();
+
+    while (oldIt != oldEnd && newIt != newEnd) {
+        const KEY& oldKey = ENTRY_UTIL::key(*oldIt);
+        const KEY& newKey = ENTRY_UTIL::key(*newIt);
+
+        if (d_comparator(newKey, oldKey)) {
+            merged.push_back(MoveUtil::move(*newIt));
+            ++newIt;
+        }
+        else {
+            if (!d_comparator(oldKey, newKey)) {
+                ++newIt;  // 'newIt' duplicates an existing key: discard it
+            }
+            merged.push_back(MoveUtil::move(*oldIt));
+            ++oldIt;
+        }
+    }
+    for (; oldIt != oldEnd; ++oldIt) {
+        merged.push_back(MoveUtil::move(*oldIt));
+    }
+    for (; newIt != newEnd; ++newIt) {
+        merged.push_back(MoveUtil::move(*newIt));
+    }
+
+    d_entries.swap(merged);
+
+    proctor.release();
+}
+
+// PRIVATE ACCESSORS
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+bool FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::isEquivalent(
+                                                const KEY&   key,
+                                                const ENTRY& entry) const
+{
+    return !d_comparator(key, ENTRY_UTIL::key(entry));
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+bool FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::isSortedUnique(
+                                                   const_iterator first,
+                                                   const_iterator last) const
+{
+    if (first == last) {
+        return true;                                                  // RETURN
+    }
+
+    const_iterator next = first;
+    for (++next; next != last; ++first, ++next) {
+        if (!d_comparator(ENTRY_UTIL::key(*first), ENTRY_UTIL::key(*next))) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::size_type
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::lowerBoundIndex(
+                                                          const KEY& key) const
+{
+    size_type first = 0;
+    size_type count = d_entries.size();
+
+    while (0 < count) {
+        const size_type half = count / 2;
+
+        if (d_comparator(ENTRY_UTIL::key(d_entries[first + half]), key)) {
+            first += half + 1;
+            count -= half + 1;
+        }
+        else {
+            count = half;
+        }
+    }
+    return first;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::size_type
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::upperBoundIndex(
+                                                          const KEY& key) const
+{
+    size_type first = 0;
+    size_type count = d_entries.size();
+
+    while (0 < count) {
+        const size_type half = count / 2;
+
+        if (!d_comparator(key, ENTRY_UTIL::key(d_entries[first + half]))) {
+            first += half + 1;
+            count -= half + 1;
+        }
+        else {
+            count = half;
+        }
+    }
+    return first;
+}
+
+// CREATORS
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::FlatTree(
+                                             const COMPARATOR& comparator,
+                                             const ALLOCATOR&  basicAllocator)
+: d_entries(basicAllocator)
+, d_comparator(comparator)
+{
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::FlatTree(
+                                              const FlatTree&  original,
+                                              const ALLOCATOR& basicAllocator)
+: d_entries(original.d_entries, basicAllocator)
+, d_comparator(original.d_comparator)
+{
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::FlatTree(
+                                          bslmf::MovableRef<FlatTree> original)
+: d_entries(MoveUtil::move(MoveUtil::access(original).d_entries))
+, d_comparator(MoveUtil::access(original).d_comparator)
+{
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::FlatTree(
+                                  bslmf::MovableRef<FlatTree> original,
+                                  const ALLOCATOR&            basicAllocator)
+: d_entries(MoveUtil::move(MoveUtil::access(original).d_entries),
+            basicAllocator)
+, d_comparator(MoveUtil::access(original).d_comparator)
+{
+}
+
+// MANIPULATORS
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>&
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::operator=(
+                                                           const FlatTree& rhs)
+{
+    d_entries    = rhs.d_entries;
+    d_comparator = rhs.d_comparator;
+
+    return *this;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>&
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::operator=(
+                                               bslmf::MovableRef<FlatTree> rhs)
+{
+    FlatTree& lvalue = rhs;
+
+    d_entries    = MoveUtil::move(lvalue.d_entries);
+    d_comparator = lvalue.d_comparator;
+
+    return *this;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+void FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::clear()
+{
+    d_entries.clear();
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+template <class ARG1, class ARG2>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::emplaceAt(
+                          const_iterator                          position,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARG1) arg1,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ARG2) arg2)
+{
+    BSLS_ASSERT_SAFE(begin() <= position);
+    BSLS_ASSERT_SAFE(position <= end());
+
+    return d_entries.emplace(position,
+                             BSLS_COMPILERFEATURES_FORWARD(ARG1, arg1),
+                             BSLS_COMPILERFEATURES_FORWARD(ARG2, arg2));
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::erase(
+                                                       const_iterator position)
+{
+    BSLS_ASSERT_SAFE(begin() <= position);
+    BSLS_ASSERT_SAFE(position < end());
+
+    return d_entries.erase(position);
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::erase(
+                                                          const_iterator first,
+                                                          const_iterator last)
+{
+    BSLS_ASSERT_SAFE(begin() <= first);
+    BSLS_ASSERT_SAFE(first <= last);
+    BSLS_ASSERT_SAFE(last <= end());
+
+    return d_entries.erase(first, last);
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::size_type
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::erase(const KEY& key)
+{
+    const_iterator it = find(key);
+    if (it == end()) {
+        return 0;                                                     // RETURN
+    }
+    d_entries.erase(it);
+    return 1;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+bsl::pair<
+    typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::iterator,
+    bool>
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::insert(
+                                                            const ENTRY& entry)
+{
+    const KEY&      key   = ENTRY_UTIL::key(entry);
+    const size_type index = lowerBoundIndex(key);
+
+    if (index < d_entries.size() && isEquivalent(key, d_entries[index])) {
+        return bsl::pair<iterator, bool>(begin() + index, false);     // RETURN
+    }
+
+    return bsl::pair<iterator, bool>(
+                            d_entries.insert(d_entries.begin() + index, entry),
+                              true);
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+bsl::pair<
+    typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::iterator,
+    bool>
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::insert(
+                                                bslmf::MovableRef<ENTRY> entry)
+{
+    ENTRY&          lvalue = entry;
+    const KEY&      key    = ENTRY_UTIL::key(lvalue);
+    const size_type index  = lowerBoundIndex(key);
+
+    if (index < d_entries.size() && isEquivalent(key, d_entries[index])) {
+        return bsl::pair<iterator, bool>(begin() + index, false);     // RETURN
+    }
+
+    return bsl::pair<iterator, bool>(
+                          d_entries.insert(d_entries.begin() + index,
+                                           MoveUtil::move(lvalue)),
+                          true);
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::insert(
+                                                       const_iterator hint,
+                                                       const ENTRY&   entry)
+{
+    BSLS_ASSERT_SAFE(begin() <= hint);
+    BSLS_ASSERT_SAFE(hint <= end());
+
+    const KEY& key = ENTRY_UTIL::key(entry);
+
+    if ((hint == end()   || d_comparator(key, ENTRY_UTIL::key(*hint)))
+     && (hint == begin() || d_comparator(ENTRY_UTIL::key(*(hint - 1)), key))) {
+        return d_entries.insert(hint, entry);                         // RETURN
+    }
+    return insert(entry).first;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::insert(
+                                        const_iterator           hint,
+                                        bslmf::MovableRef<ENTRY> entry)
+{
+    BSLS_ASSERT_SAFE(begin() <= hint);
+    BSLS_ASSERT_SAFE(hint <= end());
+
+    ENTRY&     lvalue = entry;
+    const KEY& key    = ENTRY_UTIL::key(lvalue);
+
+    if ((hint == end()   || d_comparator(key, ENTRY_UTIL::key(*hint)))
+     && (hint == begin() || d_comparator(ENTRY_UTIL::key(*(hint - 1)), key))) {
+        return d_entries.insert(hint, MoveUtil::move(lvalue));        // RETURN
+    }
+    return insert(MoveUtil::move(lvalue)).first;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::insert(
+                                                         INPUT_ITERATOR first,
+                                                         INPUT_ITERATOR last)
+{
+    const size_type numOldEntries = d_entries.size();
+
+    TruncateProctor proctor(&d_entries, numOldEntries);
+
+    d_entries.insert(d_entries.end(), first, last);
+
+    const iterator suffix = d_entries.begin() + numOldEntries;
+    const EntryComparator entryComparator(d_comparator);
+
+    if (!isSortedUnique(suffix, d_entries.end())) {
+        std::sort(suffix, d_entries.end(), entryComparator);
+
+        // Discard all but the first of each run of entries having equivalent
+        // keys.
+
+        iterator out = suffix;
+        for (iterator it = suffix + 1; it < d_entries.end(); ++it) {
+            if (entryComparator(*out, *it)) {
+                ++out;
+                if (out != it) {
+                    *out = MoveUtil::move(*it);
+                }
+            }
+        }
+        d_entries.erase(out + 1, d_entries.end());
+    }
+
+    mergeSortedSuffix(numOldEntries);
+
+    proctor.release();
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::insert(
+                                                  bsl::sorted_unique_t,
+                                                  INPUT_ITERATOR       first,
+                                                  INPUT_ITERATOR       last)
+{
+    const size_type numOldEntries = d_entries.size();
+
+    TruncateProctor proctor(&d_entries, numOldEntries);
+
+    d_entries.insert(d_entries.end(), first, last);
+
+    BSLS_ASSERT_SAFE(isSortedUnique(d_entries.begin() + numOldEntries,
+                                    d_entries.end()));
+
+    mergeSortedSuffix(numOldEntries);
+
+    proctor.release();
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+void FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::reserve(
+                                                          size_type numEntries)
+{
+    d_entries.reserve(numEntries);
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+void FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::shrinkToFit()
+{
+    d_entries.shrink_to_fit();
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+void FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::swap(
+                                                               FlatTree& other)
+{
+    d_entries.swap(other.d_entries);
+    bslalg::SwapUtil::swap(&d_comparator, &other.d_comparator);
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::begin()
+{
+    return d_entries.begin();
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::end()
+{
+    return d_entries.end();
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::find(const KEY& key)
+{
+    const size_type index = lowerBoundIndex(key);
+
+    return index < d_entries.size() && isEquivalent(key, d_entries[index])
+           ? begin() + index
+           : end();
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::lowerBound(
+                                                                const KEY& key)
+{
+    return begin() + lowerBoundIndex(key);
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::upperBound(
+                                                                const KEY& key)
+{
+    return begin() + upperBoundIndex(key);
+}
+
+// ACCESSORS
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+ALLOCATOR
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::allocator() const
+{
+    return d_entries.get_allocator();
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::
+                                                                 const_iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return d_entries.begin();
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::size_type
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::capacity() const
+{
+    return d_entries.capacity();
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+const COMPARATOR&
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::comparator() const
+{
+    return d_comparator;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+bool FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::contains(
+                                                          const KEY& key) const
+{
+    return find(key) != end();
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+const typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::
+                                                                 ContainerType&
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::entries() const
+{
+    return d_entries;
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::
+                                                                 const_iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::end() const
+{
+    return d_entries.end();
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::
+                                                                 const_iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::find(
+                                                          const KEY& key) const
+{
+    const size_type index = lowerBoundIndex(key);
+
+    return index < d_entries.size() && isEquivalent(key, d_entries[index])
+           ? begin() + index
+           : end();
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::
+                                                                 const_iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::lowerBound(
+                                                          const KEY& key) const
+{
+    return begin() + lowerBoundIndex(key);
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::size_type
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::maxSize() const
+{
+    return d_entries.max_size();
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::size_type
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_entries.size();
+}
+
+template <class KEY,
+          class ENTRY,
+          class ENTRY_UTIL,
+          class COMPARATOR,
+          class ALLOCATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::
+                                                                 const_iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR, ALLOCATOR>::upperBound(
+                                                          const KEY& key) const
+{
+    return begin() + upperBoundIndex(key);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
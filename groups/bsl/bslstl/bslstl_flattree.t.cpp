@@ -0,0 +1,970 @@
+// bslstl_flattree.t.cpp                                              -*-C++-*-
+#include <bslstl_flattree.h>
+
+#include <bslstl_pair.h>
+#include <bslstl_set.h>
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_stdallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a sorted-vector implementation of unique-key
+// containers, 'bslstl::FlatTree', used by 'bsl::flat_map' and 'bsl::flat_set'.
+// We test it with two entry types: 'int' (the entry is its own key, as in
+// 'flat_set') and 'bsl::pair<int, int>' keyed on 'first' (as in 'flat_map'),
+// the latter letting us observe *which* of several entries having equivalent
+// keys is retained.  A 'bsl::set' serves as an oracle for the sequence of
+// keys.
+//
+// Global Concerns:
+//: o All memory is supplied by the allocator passed at construction.
+//: o Precondition violations are detected in appropriate build modes.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatTree(const COMPARATOR&, const ALLOCATOR&);
+// [ 6] FlatTree(const FlatTree&, const ALLOCATOR&);
+// [ 6] FlatTree(MovableRef<FlatTree>);
+// [ 6] FlatTree(MovableRef<FlatTree>, const ALLOCATOR&);
+//
+// MANIPULATORS
+// [ 6] FlatTree& operator=(const FlatTree&);
+// [ 6] FlatTree& operator=(MovableRef<FlatTree>);
+// [ 5] void clear();
+// [ 2] iterator emplaceAt(const_iterator, ARG1&&, ARG2&&);
+// [ 5] iterator erase(const_iterator);
+// [ 5] iterator erase(const_iterator, const_iterator);
+// [ 5] size_type erase(const KEY&);
+// [ 2] pair<iterator, bool> insert(const ENTRY&);
+// [ 2] pair<iterator, bool> insert(MovableRef<ENTRY>);
+// [ 2] iterator insert(const_iterator, const ENTRY&);
+// [ 2] iterator insert(const_iterator, MovableRef<ENTRY>);
+// [ 3] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] void insert(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 5] void reserve(size_type);
+// [ 5] void shrinkToFit();
+// [ 6] void swap(FlatTree&);
+// [ 2] iterator find(const KEY&);
+// [ 2] iterator lowerBound(const KEY&);
+// [ 2] iterator upperBound(const KEY&);
+//
+// ACCESSORS
+// [ 2] ALLOCATOR allocator() const;
+// [ 5] size_type capacity() const;
+// [ 2] const COMPARATOR& comparator() const;
+// [ 2] bool contains(const KEY&) const;
+// [ 2] const ContainerType& entries() const;
+// [ 2] const_iterator find(const KEY&) const;
+// [ 2] const_iterator lowerBound(const KEY&) const;
+// [ 2] size_type size() const;
+// [ 2] const_iterator upperBound(const KEY&) const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: range insertion is exception safe
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslmf::MovableRefUtil MoveUtil;
+
+struct IdentityUtil {
+    // This 'struct' provides the key of an entry that is its own key.
+
+    template <class KEY>
+    static const KEY& key(const KEY& entry)
+        // Return the specified 'entry'.
+    {
+        return entry;
+    }
+};
+
+struct FirstUtil {
+    // This 'struct' provides the key of a 'bsl::pair' entry, its 'first'
+    // member.
+
+    static const int& key(const bsl::pair<int, int>& entry)
+        // Return the 'first' member of the specified 'entry'.
+    {
+        return entry.first;
+    }
+};
+
+typedef bsl::pair<int, int> Pair;
+
+typedef bslstl::FlatTree<int,
+                         int,
+                         IdentityUtil,
+                         std::less<int>,
+                         bsl::allocator<int> >          IntObj;
+
+typedef bslstl::FlatTree<int,
+                         Pair,
+                         FirstUtil,
+                         std::less<int>,
+                         bsl::allocator<Pair> >         PairObj;
+
+typedef bslstl::FlatTree<bsl::string,
+                         bsl::string,
+                         IdentityUtil,
+                         std::less<bsl::string>,
+                         bsl::allocator<bsl::string> >  StringObj;
+
+typedef bslstl::FlatTree<int,
+                         int,
+                         IdentityUtil,
+                         std::greater<int>,
+                         bsl::allocator<int> >          ReverseObj;
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+template <class OBJ>
+bool isValid(const OBJ& object)
+    // Return 'true' if the entries of the specified 'object' are strictly
+    // ordered by its comparator, and 'false' otherwise.
+{
+    typedef typename OBJ::const_iterator Iter;
+
+    if (object.begin() == object.end()) {
+        return true;                                                  // RETURN
+    }
+    for (Iter prev = object.begin(), it = prev + 1;
+         it != object.end();
+         ++prev, ++it) {
+        if (!object.comparator()(*prev, *it)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+bool isValidPairs(const PairObj& object)
+    // Return 'true' if the entries of the specified 'object' are strictly
+    // ordered by key, and 'false' otherwise.
+{
+    for (PairObj::size_type i = 1; i < object.size(); ++i) {
+        if (!(object.entries()[i - 1].first < object.entries()[i].first)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+bool matches(const IntObj& object, const bsl::set<int>& oracle)
+    // Return 'true' if the specified 'object' holds the same sequence of keys
+    // as the specified 'oracle', and 'false' otherwise.
+{
+    return object.entries().size() == oracle.size()
+        && std::equal(oracle.begin(), oracle.end(), object.begin());
+}
+
+unsigned nextRandom(unsigned *state)
+    // Return the next value of the pseudo-random sequence having the
+    // specified 'state', and update 'state'.
+{
+    *state = *state * 1103515245u + 12345u;
+    return (*state >> 16) & 0x7fff;
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVerbose;
+    (void) veryVeryVerbose;
+    (void) veryVeryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, AND SWAP
+        //
+        // Concerns:
+        //: 1 Copy construction and copy assignment produce an equal tree
+        //:   using the allocator supplied (or retained).
+        //:
+        //: 2 Move construction (with the same or no allocator) and move
+        //:   assignment (with equal allocators) transfer the entries without
+        //:   allocating.
+        //:
+        //: 3 Move construction with a different allocator copies the entries
+        //:   into memory from that allocator.
+        //:
+        //: 4 'swap' exchanges the entries and comparators.
+        //
+        // Plan:
+        //: 1 Construct trees of 'bsl::string' from a range, and exercise each
+        //:   operation, verifying the entries and the allocator use with
+        //:   'bslma::TestAllocatorMonitor'.  (C-1..3)
+        //:
+        //: 2 Swap two trees of different sizes and verify their entries.
+        //:   (C-4)
+        //
+        // Testing:
+        //   FlatTree(const FlatTree&, const ALLOCATOR&);
+        //   FlatTree(MovableRef<FlatTree>);
+        //   FlatTree(MovableRef<FlatTree>, const ALLOCATOR&);
+        //   FlatTree& operator=(const FlatTree&);
+        //   FlatTree& operator=(MovableRef<FlatTree>);
+        //   void swap(FlatTree&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, MOVE, AND SWAP"
+                            "\n====================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        const char *const DATA[] = {
+            "a long string that allocates memory from the allocator #4",
+            "a long string that allocates memory from the allocator #1",
+            "a long string that allocates memory from the allocator #3",
+            "a long string that allocates memory from the allocator #2",
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        StringObj mX(std::less<bsl::string>(), &oa);  const StringObj& X = mX;
+        mX.insert(DATA, DATA + NUM_DATA);
+        ASSERT(NUM_DATA == static_cast<int>(X.size()));
+        ASSERT(isValid(X));
+
+        if (verbose) printf("\tCopy construction.\n");
+        {
+            StringObj mY(X, &za);  const StringObj& Y = mY;
+            ASSERT(X.entries() == Y.entries());
+            ASSERT(&za == Y.allocator());
+            ASSERT(1 + NUM_DATA == za.numBlocksInUse());
+        }
+        ASSERT(0 == za.numBlocksInUse());
+
+        if (verbose) printf("\tMove construction.\n");
+        {
+            StringObj mS(X, &oa);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            StringObj mY(MoveUtil::move(mS));  const StringObj& Y = mY;
+            ASSERT(X.entries() == Y.entries());
+            ASSERT(&oa == Y.allocator());
+            ASSERT(oam.isTotalSame());
+
+            StringObj mZ(MoveUtil::move(mY), &oa);  const StringObj& Z = mZ;
+            ASSERT(X.entries() == Z.entries());
+            ASSERT(oam.isTotalSame());
+
+            bslma::TestAllocatorMonitor zam(&za);
+
+            StringObj mW(MoveUtil::move(mZ), &za);  const StringObj& W = mW;
+            ASSERT(X.entries() == W.entries());
+            ASSERT(&za == W.allocator());
+            ASSERT(zam.isTotalUp());
+        }
+
+        if (verbose) printf("\tAssignment.\n");
+        {
+            StringObj mY(std::less<bsl::string>(), &za);
+            const StringObj& Y = mY;
+
+            mY = X;
+            ASSERT(X.entries() == Y.entries());
+            ASSERT(&za == Y.allocator());
+
+            StringObj mS(X, &za);
+
+            bslma::TestAllocatorMonitor zam(&za);
+
+            mY.clear();
+            mY = MoveUtil::move(mS);
+            ASSERT(X.entries() == Y.entries());
+            ASSERT(zam.isTotalSame());
+        }
+
+        if (verbose) printf("\tSwap.\n");
+        {
+            IntObj mA(std::less<int>(), &oa);  const IntObj& A = mA;
+            IntObj mB(std::less<int>(), &oa);  const IntObj& B = mB;
+
+            const int DA[] = { 3, 1, 2 };
+            const int DB[] = { 9 };
+
+            mA.insert(DA, DA + 3);
+            mB.insert(DB, DB + 1);
+
+            mA.swap(mB);
+
+            ASSERT(1 == A.size());
+            ASSERT(9 == A.entries()[0]);
+            ASSERT(3 == B.size());
+            ASSERT(1 == B.entries()[0]);
+            ASSERT(isValid(A));
+            ASSERT(isValid(B));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // ERASE AND CAPACITY
+        //
+        // Concerns:
+        //: 1 'erase(key)' removes the entry having the key, if any, and
+        //:   returns the number of entries removed.
+        //:
+        //: 2 'erase(position)' and 'erase(first, last)' remove the indicated
+        //:   entries and return an iterator to the entry that followed.
+        //:
+        //: 3 'clear' removes all entries and retains the capacity.
+        //:
+        //: 4 'reserve' and 'shrinkToFit' adjust the capacity without changing
+        //:   the entries.
+        //:
+        //: 5 Erasing by an invalid position is detected in "SAFE" mode.
+        //
+        // Plan:
+        //: 1 Erase keys from a tree and compare against an oracle 'bsl::set'.
+        //:   (C-1..2)
+        //:
+        //: 2 Exercise 'clear', 'reserve', and 'shrinkToFit', checking
+        //:   'capacity'.  (C-3..4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered (using the 'BSLS_ASSERTTEST_*' macros).  (C-5)
+        //
+        // Testing:
+        //   void clear();
+        //   iterator erase(const_iterator);
+        //   iterator erase(const_iterator, const_iterator);
+        //   size_type erase(const KEY&);
+        //   void reserve(size_type);
+        //   void shrinkToFit();
+        //   size_type capacity() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nERASE AND CAPACITY"
+                            "\n==================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        IntObj        mX(std::less<int>(), &oa);  const IntObj& X = mX;
+        bsl::set<int> oracle;
+
+        for (int i = 0; i < 100; ++i) {
+            mX.insert(i * 3);
+            oracle.insert(i * 3);
+        }
+
+        for (int k = 0; k < 300; k += 2) {
+            const IntObj::size_type n = mX.erase(k);
+            ASSERTV(k, oracle.erase(k) == n);
+        }
+        ASSERT(matches(X, oracle));
+
+        {
+            IntObj::iterator it = mX.find(9);
+            ASSERT(it != mX.end());
+            IntObj::iterator next = mX.erase(it);
+            oracle.erase(9);
+            ASSERT(15 == *next);
+            ASSERT(matches(X, oracle));
+        }
+        {
+            IntObj::iterator first = mX.lowerBound(100);
+            IntObj::iterator last  = mX.lowerBound(200);
+            IntObj::iterator next  = mX.erase(first, last);
+            oracle.erase(oracle.lower_bound(100), oracle.lower_bound(200));
+            ASSERT(201 == *next);
+            ASSERT(matches(X, oracle));
+        }
+
+        const IntObj::size_type capacity = X.capacity();
+        mX.clear();
+        ASSERT(0        == X.size());
+        ASSERT(capacity == X.capacity());
+
+        mX.shrinkToFit();
+        ASSERT(0 == X.capacity());
+
+        mX.reserve(50);
+        ASSERT(50 <= X.capacity());
+
+        const bsls::Types::Int64 numAllocations = oa.numAllocations();
+        for (int i = 0; i < 50; ++i) {
+            mX.insert(i);
+        }
+        ASSERT(numAllocations == oa.numAllocations());
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_SAFE_FAIL(mX.erase(X.end()));
+            ASSERT_SAFE_PASS(mX.erase(X.end() - 1));
+            ASSERT_SAFE_FAIL(mX.erase(X.end(), X.begin()));
+            ASSERT_SAFE_PASS(mX.erase(X.begin(), X.begin()));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // RANGE INSERTION EXCEPTION SAFETY
+        //
+        // Concerns:
+        //: 1 If an allocation fails during a range insertion, the tree is
+        //:   left holding (sorted and unique) a subset of its original
+        //:   entries, and no memory is leaked.
+        //
+        // Plan:
+        //: 1 Within the 'bslma' exception-test loop, insert a range of long
+        //:   strings into trees that are empty, hold keys all less than those
+        //:   of the range, and hold keys interleaved with those of the range.
+        //:   On exception, verify that the tree is valid and every entry is
+        //:   one of the original entries; on success verify the result.
+        //:   (C-1)
+        //
+        // Testing:
+        //   CONCERN: range insertion is exception safe
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRANGE INSERTION EXCEPTION SAFETY"
+                            "\n================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const char *const ORIGINAL[] = {
+            "b: a long string that allocates memory from the allocator",
+            "d: a long string that allocates memory from the allocator",
+            "f: a long string that allocates memory from the allocator",
+        };
+        const char *const LOW[] = {
+            "0: a long string that allocates memory from the allocator",
+        };
+        const char *const RANGE[] = {
+            "e: a long string that allocates memory from the allocator",
+            "c: a long string that allocates memory from the allocator",
+            "g: a long string that allocates memory from the allocator",
+            "c: a long string that allocates memory from the allocator",
+            "d: a long string that allocates memory from the allocator",
+        };
+
+        struct {
+            int                d_line;
+            const char *const *d_original_p;
+            int                d_numOriginal;
+            int                d_expSize;
+        } DATA[] = {
+            { L_, ORIGINAL, 0, 4 },
+            { L_, LOW,      1, 5 },
+            { L_, ORIGINAL, 3, 6 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int                LINE         = DATA[ti].d_line;
+            const char *const *const ORIG         = DATA[ti].d_original_p;
+            const int                NUM_ORIGINAL = DATA[ti].d_numOriginal;
+            const int                EXP_SIZE     = DATA[ti].d_expSize;
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                StringObj mX(std::less<bsl::string>(), &oa);
+                const StringObj& X = mX;
+
+                {
+                    // Insert the original entries outside the limit.
+
+                    oa.setAllocationLimit(-1);
+                    mX.insert(ORIG, ORIG + NUM_ORIGINAL);
+                    oa.setAllocationLimit(bslmaExceptionCounter);
+                }
+
+                bool inserted = false;
+                try {
+                    mX.insert(RANGE, RANGE + 5);
+                    inserted = true;
+                }
+                catch (...) {
+                    oa.setAllocationLimit(-1);
+
+                    ASSERTV(LINE, isValid(X));
+                    for (StringObj::size_type i = 0; i < X.size(); ++i) {
+                        ASSERTV(LINE, std::find(ORIG,
+                                                ORIG + NUM_ORIGINAL,
+                                                X.entries()[i])
+                                                      != ORIG + NUM_ORIGINAL);
+                    }
+                    throw;
+                }
+                ASSERTV(LINE, inserted);
+                ASSERTV(LINE, X.size(),
+                        EXP_SIZE == static_cast<int>(X.size()));
+                ASSERTV(LINE, isValid(X));
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // RANGE INSERTION
+        //
+        // Concerns:
+        //: 1 Inserting an unsorted range having duplicate keys into an empty
+        //:   tree yields the sorted, unique keys of the range.
+        //:
+        //: 2 Inserting a range into a non-empty tree merges the keys of the
+        //:   range with the existing keys, retaining the existing entry where
+        //:   the keys are equivalent.
+        //:
+        //: 3 Inserting a range whose keys all follow the existing keys, and an
+        //:   empty range, work correctly.
+        //:
+        //: 4 The 'sorted_unique_t' overload inserts a sorted and unique range,
+        //:   and detects an unsorted or non-unique range in "SAFE" mode.
+        //:
+        //: 5 A comparator other than 'std::less' orders the entries.
+        //
+        // Plan:
+        //: 1 For a series of pseudo-random ranges, insert each range into a
+        //:   tree and into an oracle 'bsl::set' and compare.  (C-1..3)
+        //:
+        //: 2 Insert ranges of pairs keyed on 'first' into a tree of pairs and
+        //:   verify the 'second' member of each retained entry.  (C-2)
+        //:
+        //: 3 Insert sorted ranges using 'bsl::sorted_unique', and use the
+        //:   'BSLS_ASSERTTEST_*' macros for unsorted ranges.  (C-4)
+        //:
+        //: 4 Repeat P-1 for a tree ordered by 'std::greater'.  (C-5)
+        //
+        // Testing:
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRANGE INSERTION"
+                            "\n===============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tPseudo-random ranges.\n");
+        {
+            unsigned state = 12345;
+
+            for (int round = 0; round < 50; ++round) {
+                IntObj        mX(std::less<int>(), &oa);
+                const IntObj& X = mX;
+                bsl::set<int> oracle;
+
+                const int numRanges = 1 + round % 4;
+                for (int r = 0; r < numRanges; ++r) {
+                    const int length  = static_cast<int>(
+                                                      nextRandom(&state) % 40);
+                    const int modulus = 1 + round * 3;
+                    const int offset  = (round % 5 == 0) ? r * 1000 : 0;
+
+                    bsl::vector<int> range;
+                    for (int i = 0; i < length; ++i) {
+                        const unsigned value = nextRandom(&state) % modulus;
+                        range.push_back(offset + static_cast<int>(value));
+                    }
+                    mX.insert(range.begin(), range.end());
+                    oracle.insert(range.begin(), range.end());
+
+                    ASSERTV(round, r, matches(X, oracle));
+                }
+            }
+        }
+
+        if (verbose) printf("\tRetention of existing entries.\n");
+        {
+            PairObj mX(std::less<int>(), &oa);  const PairObj& X = mX;
+
+            const Pair D1[] = { Pair(5, 1), Pair(1, 1), Pair(3, 1) };
+            mX.insert(D1, D1 + 3);
+            ASSERT(3 == X.size());
+
+            const Pair D2[] = { Pair(4, 2), Pair(3, 2), Pair(0, 2),
+                                Pair(9, 2), Pair(5, 2), Pair(4, 3) };
+            mX.insert(D2, D2 + 6);
+            ASSERT(6 == X.size());
+            ASSERT(isValidPairs(X));
+
+            const int EXP_KEY[]    = { 0, 1, 3, 4, 5, 9 };
+            const int EXP_SECOND[] = { 2, 1, 1, 0, 1, 2 };
+                // 0 for key 4 stands for "either 2 or 3" (unspecified)
+
+            for (int i = 0; i < 6; ++i) {
+                ASSERTV(i, EXP_KEY[i] == X.entries()[i].first);
+                if (EXP_SECOND[i]) {
+                    ASSERTV(i, EXP_SECOND[i] == X.entries()[i].second);
+                }
+            }
+        }
+
+        if (verbose) printf("\tAppended and empty ranges.\n");
+        {
+            IntObj mX(std::less<int>(), &oa);  const IntObj& X = mX;
+
+            const int D1[] = { 2, 1 };
+            const int D2[] = { 4, 3, 3 };
+
+            mX.insert(D1, D1);
+            ASSERT(0 == X.size());
+
+            mX.insert(D1, D1 + 2);
+            mX.insert(D2, D2 + 3);
+            ASSERT(4 == X.size());
+            ASSERT(isValid(X));
+
+            mX.insert(D2, D2);
+            ASSERT(4 == X.size());
+        }
+
+        if (verbose) printf("\tSorted and unique ranges.\n");
+        {
+            IntObj mX(std::less<int>(), &oa);  const IntObj& X = mX;
+
+            const int D1[] = { 1, 3, 5, 7 };
+            const int D2[] = { 0, 3, 4, 8 };
+
+            mX.insert(bsl::sorted_unique, D1, D1 + 4);
+            ASSERT(4 == X.size());
+
+            mX.insert(bsl::sorted_unique, D2, D2 + 4);
+            ASSERT(7 == X.size());
+            ASSERT(isValid(X));
+
+            const int UNSORTED[]  = { 10, 9 };
+            const int DUPLICATE[] = { 10, 10 };
+
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_SAFE_FAIL(mX.insert(bsl::sorted_unique,
+                                       UNSORTED,
+                                       UNSORTED + 2));
+            mX.clear();
+            ASSERT_SAFE_FAIL(mX.insert(bsl::sorted_unique,
+                                       DUPLICATE,
+                                       DUPLICATE + 2));
+            mX.clear();
+            ASSERT_SAFE_PASS(mX.insert(bsl::sorted_unique,
+                                       DUPLICATE,
+                                       DUPLICATE + 1));
+        }
+
+        if (verbose) printf("\tReverse ordering.\n");
+        {
+            ReverseObj mX(std::greater<int>(), &oa);
+            const ReverseObj& X = mX;
+
+            const int D1[] = { 3, 9, 1, 9, 4 };
+            const int D2[] = { 2, 10, 4 };
+
+            mX.insert(D1, D1 + 5);
+            mX.insert(D2, D2 + 3);
+
+            const int EXP[] = { 10, 9, 4, 3, 2, 1 };
+            ASSERT(6 == X.size());
+            ASSERT(std::equal(EXP, EXP + 6, X.begin()));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // SINGLE-ENTRY INSERTION AND LOOKUP
+        //
+        // Concerns:
+        //: 1 'insert' inserts an entry whose key is absent, at its sorted
+        //:   position, and otherwise returns the existing entry.
+        //:
+        //: 2 The hinted 'insert' uses a correct hint and ignores an incorrect
+        //:   one.
+        //:
+        //: 3 The lookup methods agree with those of 'bsl::set'.
+        //:
+        //: 4 'emplaceAt' constructs an entry at the given position.
+        //:
+        //: 5 All memory comes from the object allocator.
+        //
+        // Plan:
+        //: 1 Insert pseudo-random keys, alternating the overloads, into a
+        //:   tree and an oracle 'bsl::set', and compare the results.  (C-1..2)
+        //:
+        //: 2 For every key in a range covering the inserted keys, compare
+        //:   'find', 'lowerBound', 'upperBound', and 'contains' with the
+        //:   oracle.  (C-3)
+        //:
+        //: 3 Insert pairs with 'emplaceAt' at their 'lowerBound'.  (C-4)
+        //:
+        //: 4 Install a default allocator and verify that it is not used.
+        //:   (C-5)
+        //
+        // Testing:
+        //   FlatTree(const COMPARATOR&, const ALLOCATOR&);
+        //   iterator emplaceAt(const_iterator, ARG1&&, ARG2&&);
+        //   pair<iterator, bool> insert(const ENTRY&);
+        //   pair<iterator, bool> insert(MovableRef<ENTRY>);
+        //   iterator insert(const_iterator, const ENTRY&);
+        //   iterator insert(const_iterator, MovableRef<ENTRY>);
+        //   iterator find(const KEY&);
+        //   iterator lowerBound(const KEY&);
+        //   iterator upperBound(const KEY&);
+        //   ALLOCATOR allocator() const;
+        //   const COMPARATOR& comparator() const;
+        //   bool contains(const KEY&) const;
+        //   const ContainerType& entries() const;
+        //   const_iterator find(const KEY&) const;
+        //   const_iterator lowerBound(const KEY&) const;
+        //   size_type size() const;
+        //   const_iterator upperBound(const KEY&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSINGLE-ENTRY INSERTION AND LOOKUP"
+                            "\n=================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        IntObj        mX(std::less<int>(), &oa);  const IntObj& X = mX;
+        bsl::set<int> oracle(&oa);
+
+        ASSERT(&oa == X.allocator());
+
+        unsigned state = 7;
+        for (int i = 0; i < 500; ++i) {
+            int key = static_cast<int>(nextRandom(&state) % 300);
+
+            const bool expInserted = oracle.insert(key).second;
+
+            switch (i % 4) {
+              case 0: {
+                bsl::pair<IntObj::iterator, bool> r = mX.insert(key);
+                ASSERTV(i, expInserted == r.second);
+                ASSERTV(i, key == *r.first);
+              } break;
+              case 1: {
+                bsl::pair<IntObj::iterator, bool> r =
+                                                mX.insert(MoveUtil::move(key));
+                ASSERTV(i, expInserted == r.second);
+                ASSERTV(i, key == *r.first);
+              } break;
+              case 2: {
+                // Correct hint.
+
+                IntObj::iterator it = mX.insert(X.lowerBound(key), key);
+                ASSERTV(i, key == *it);
+              } break;
+              case 3: {
+                // Arbitrary (mostly incorrect) hint.
+
+                IntObj::iterator it = mX.insert(X.begin() + X.size() / 2,
+                                                MoveUtil::move(key));
+                ASSERTV(i, key == *it);
+              } break;
+            }
+            ASSERTV(i, matches(X, oracle));
+        }
+
+        for (int key = -1; key <= 301; ++key) {
+            const bsl::set<int>::const_iterator oLower =
+                                                     oracle.lower_bound(key);
+            const bsl::set<int>::const_iterator oUpper =
+                                                     oracle.upper_bound(key);
+
+            const int lowerIndex = static_cast<int>(
+                                       std::distance(oracle.begin(), oLower));
+            const int upperIndex = static_cast<int>(
+                                       std::distance(oracle.begin(), oUpper));
+
+            ASSERTV(key, lowerIndex == X.lowerBound(key) - X.begin());
+            ASSERTV(key, upperIndex == X.upperBound(key) - X.begin());
+            ASSERTV(key, lowerIndex == mX.lowerBound(key) - mX.begin());
+            ASSERTV(key, upperIndex == mX.upperBound(key) - mX.begin());
+
+            const bool found = oracle.count(key);
+            ASSERTV(key, found == X.contains(key));
+            ASSERTV(key, found == (X.find(key) != X.end()));
+            ASSERTV(key, found == (mX.find(key) != mX.end()));
+            if (found) {
+                ASSERTV(key, key == *X.find(key));
+            }
+        }
+
+        {
+            PairObj mY(std::less<int>(), &oa);  const PairObj& Y = mY;
+
+            const int KEYS[] = { 5, 2, 8, 1 };
+            for (int i = 0; i < 4; ++i) {
+                PairObj::iterator it = mY.emplaceAt(mY.lowerBound(KEYS[i]),
+                                                    KEYS[i],
+                                                    i);
+                ASSERTV(i, KEYS[i] == it->first);
+                ASSERTV(i, i       == it->second);
+            }
+            ASSERT(4 == Y.size());
+            ASSERT(isValidPairs(Y));
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a tree, insert keys singly and as a range, look them up,
+        //:   and erase them.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        IntObj mX(std::less<int>(), &oa);  const IntObj& X = mX;
+
+        ASSERT(0 == X.size());
+        ASSERT(X.begin() == X.end());
+
+        ASSERT( mX.insert(3).second);
+        ASSERT( mX.insert(1).second);
+        ASSERT(!mX.insert(3).second);
+        ASSERT(2 == X.size());
+        ASSERT(1 == *X.begin());
+
+        const int DATA[] = { 7, 2, 5, 2, 1 };
+        mX.insert(DATA, DATA + 5);
+        ASSERT(5 == X.size());
+        ASSERT(isValid(X));
+
+        ASSERT(X.contains(5));
+        ASSERT(!X.contains(4));
+        ASSERT(X.find(4) == X.end());
+        ASSERT(5 == *X.lowerBound(4));
+        ASSERT(7 == *X.upperBound(5));
+
+        ASSERT(1 == mX.erase(5));
+        ASSERT(0 == mX.erase(5));
+        ASSERT(4 == X.size());
+
+        mX.clear();
+        ASSERT(0 == X.size());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -12,6 +12,8 @@ BSLS_IDENT_PRAGMA_ONCE
 
 #include <bdlat_attributeinfo.h>
 
+#include <bdlat_nameindex.h>
+
 #include <bdlat_selectioninfo.h>
 
 #include <bdlat_typetraits.h>
@@ -265,6 +267,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const BasicRecord& rhs);
 // TRAITS
 
 BDLAT_DECL_SEQUENCE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(s_baltst::BasicRecord)
+BDLAT_DECL_NAME_INDEX_TRAITS(s_baltst::BasicRecord)
 
 // ============================================================================
 //                         INLINE FUNCTION DEFINITIONS
@@ -12,6 +12,8 @@ BSLS_IDENT_PRAGMA_ONCE
 
 #include <bdlat_attributeinfo.h>
 
+#include <bdlat_nameindex.h>
+
 #include <bdlat_selectioninfo.h>
 
 #include <bdlat_typetraits.h>
@@ -586,6 +588,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const FeatureTestMessage& rhs);
 // TRAITS
 
 BDLAT_DECL_CHOICE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(s_baltst::FeatureTestMessage)
+BDLAT_DECL_NAME_INDEX_TRAITS(s_baltst::FeatureTestMessage)
 
 // ============================================================================
 //                         INLINE FUNCTION DEFINITIONS
@@ -12,6 +12,8 @@ BSLS_IDENT_PRAGMA_ONCE
 
 #include <bdlat_attributeinfo.h>
 
+#include <bdlat_nameindex.h>
+
 #include <bdlat_selectioninfo.h>
 
 #include <bdlat_typetraits.h>
@@ -283,6 +285,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const MySimpleContent& rhs);
 // TRAITS
 
 BDLAT_DECL_SEQUENCE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(s_baltst::MySimpleContent)
+BDLAT_DECL_NAME_INDEX_TRAITS(s_baltst::MySimpleContent)
 
 // ============================================================================
 //                         INLINE FUNCTION DEFINITIONS
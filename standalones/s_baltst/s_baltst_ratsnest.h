@@ -13,6 +13,7 @@ BSLS_IDENT_PRAGMA_ONCE
 #include <s_baltst_enumerated.h>
 
 #include <bdlat_attributeinfo.h>
+#include <bdlat_nameindex.h>
 #include <bdlat_selectioninfo.h>
 #include <bdlat_typetraits.h>
 #include <bdlb_nullableallocatedvalue.h>
@@ -316,6 +317,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Choice1& rhs);
 // TRAITS
 
 BDLAT_DECL_CHOICE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(s_baltst::Choice1)
+BDLAT_DECL_NAME_INDEX_TRAITS(s_baltst::Choice1)
 
 namespace s_baltst {
 
@@ -590,6 +592,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Choice2& rhs);
 // TRAITS
 
 BDLAT_DECL_CHOICE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(s_baltst::Choice2)
+BDLAT_DECL_NAME_INDEX_TRAITS(s_baltst::Choice2)
 
 namespace s_baltst {
 
@@ -856,6 +859,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Sequence2& rhs);
 // TRAITS
 
 BDLAT_DECL_SEQUENCE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(s_baltst::Sequence2)
+BDLAT_DECL_NAME_INDEX_TRAITS(s_baltst::Sequence2)
 
 namespace s_baltst {
 
@@ -1111,6 +1115,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Sequence3& rhs);
 // TRAITS
 
 BDLAT_DECL_SEQUENCE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(s_baltst::Sequence3)
+BDLAT_DECL_NAME_INDEX_TRAITS(s_baltst::Sequence3)
 
 namespace s_baltst {
 
@@ -1509,6 +1514,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Sequence4& rhs);
 // TRAITS
 
 BDLAT_DECL_SEQUENCE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(s_baltst::Sequence4)
+BDLAT_DECL_NAME_INDEX_TRAITS(s_baltst::Sequence4)
 
 namespace s_baltst {
 
@@ -1776,6 +1782,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Sequence5& rhs);
 // TRAITS
 
 BDLAT_DECL_SEQUENCE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(s_baltst::Sequence5)
+BDLAT_DECL_NAME_INDEX_TRAITS(s_baltst::Sequence5)
 
 namespace s_baltst {
 
@@ -2130,6 +2137,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Sequence6& rhs);
 // TRAITS
 
 BDLAT_DECL_SEQUENCE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(s_baltst::Sequence6)
+BDLAT_DECL_NAME_INDEX_TRAITS(s_baltst::Sequence6)
 
 namespace s_baltst {
 
@@ -2408,6 +2416,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Choice3& rhs);
 // TRAITS
 
 BDLAT_DECL_CHOICE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(s_baltst::Choice3)
+BDLAT_DECL_NAME_INDEX_TRAITS(s_baltst::Choice3)
 
 namespace s_baltst {
 
@@ -2653,6 +2662,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Sequence1& rhs);
 // TRAITS
 
 BDLAT_DECL_SEQUENCE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(s_baltst::Sequence1)
+BDLAT_DECL_NAME_INDEX_TRAITS(s_baltst::Sequence1)
 
 // ============================================================================
 //                         INLINE FUNCTION DEFINITIONS
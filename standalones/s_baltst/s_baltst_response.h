@@ -12,6 +12,8 @@ BSLS_IDENT_PRAGMA_ONCE
 
 #include <bdlat_attributeinfo.h>
 
+#include <bdlat_nameindex.h>
+
 #include <bdlat_selectioninfo.h>
 
 #include <bdlat_typetraits.h>
@@ -353,6 +355,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Response& rhs);
 // TRAITS
 
 BDLAT_DECL_CHOICE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(s_baltst::Response)
+BDLAT_DECL_NAME_INDEX_TRAITS(s_baltst::Response)
 
 // ============================================================================
 //                         INLINE FUNCTION DEFINITIONS
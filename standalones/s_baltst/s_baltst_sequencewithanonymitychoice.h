@@ -12,6 +12,8 @@ BSLS_IDENT_PRAGMA_ONCE
 
 #include <bdlat_attributeinfo.h>
 
+#include <bdlat_nameindex.h>
+
 #include <bdlat_selectioninfo.h>
 
 #include <bdlat_typetraits.h>
@@ -374,6 +376,7 @@ bsl::ostream& operator<<(bsl::ostream& stream, const SequenceWithAnonymityChoice
 // TRAITS
 
 BDLAT_DECL_CHOICE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(s_baltst::SequenceWithAnonymityChoice)
+BDLAT_DECL_NAME_INDEX_TRAITS(s_baltst::SequenceWithAnonymityChoice)
 
 // ============================================================================
 //                         INLINE FUNCTION DEFINITIONS